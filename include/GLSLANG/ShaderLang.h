@@ -25,7 +25,7 @@
 
 // Version number for shader translation API.
 // It is incremented every time the API changes.
-#define ANGLE_SH_VERSION 196
+#define ANGLE_SH_VERSION 201
 
 enum ShShaderSpec
 {
@@ -65,6 +65,10 @@ enum ShShaderOutput
 
     // Output specialized GLSL to be fed to glslang for Vulkan SPIR.
     SH_GLSL_VULKAN_OUTPUT = 0x8B4B,
+
+    // Output the same GLSL as SH_GLSL_VULKAN_OUTPUT, and also SPIR-V generated directly from the
+    // AST when the shader only uses the features that the SPIR-V output supports.
+    SH_SPIRV_VULKAN_OUTPUT = 0x8B4C,
 };
 
 // Compile options.
@@ -261,6 +265,25 @@ const ShCompileOptions SH_SKIP_D3D_CONSTANT_REGISTER_ZERO = UINT64_C(1) << 37;
 // Clamp gl_FragDepth to the range [0.0, 1.0] in case it is statically used.
 const ShCompileOptions SH_CLAMP_FRAG_DEPTH = UINT64_C(1) << 38;
 
+// Keep the AST after parsing, and reuse it when the compiler is next given the same source. Only
+// the option-dependent checks, transformations and output run again, so the same shader can be
+// translated with several sets of options at the cost of a single parse. The compiler holds on to
+// the AST of the last shader parsed with this option until it parses another one. Ignored
+// together with SH_REGENERATE_STRUCT_NAMES.
+const ShCompileOptions SH_REUSE_PARSED_AST = UINT64_C(1) << 39;
+
+// Record the time spent, the AST nodes visited and allocated, and the pool memory allocated in
+// each stage of the compilation. The stages are preprocessing, parsing, each AST pass and writing
+// the output. Query the results with sh::GetCompileStatistics. Adds some overhead to the
+// compilation, preprocessing in particular.
+const ShCompileOptions SH_COLLECT_COMPILE_STATISTICS = UINT64_C(1) << 40;
+
+// Run the AST transformations that only look at one function at a time on several threads, each
+// function definition and other top-level statement being transformed on its own. The output is
+// the same from one compilation to the next, but temporary variables may be numbered differently
+// than without the option. Currently only affects HLSL output.
+const ShCompileOptions SH_PARALLELIZE_FUNCTION_TRANSFORMS = UINT64_C(1) << 41;
+
 // If the flag is enabled, shaders will be forcedly compiled into ESSL3. Required for 
 // multiview support in WebGL 1
 const ShCompileOptions SH_ENFORCE_OUTPUT_TO_ESSL3 = UINT64_C(1) << 63;
@@ -555,6 +578,37 @@ const std::string &GetInfoLog(const ShHandle handle);
 // handle: Specifies the compiler
 const std::string &GetObjectCode(const ShHandle handle);
 
+// Returns the SPIR-V generated for a compiled shader with SH_SPIRV_VULKAN_OUTPUT. It is empty if
+// the shader couldn't be output as SPIR-V, in which case only the object code can be used.
+// Parameters:
+// handle: Specifies the compiler
+const std::vector<uint32_t> &GetObjectBinary(const ShHandle handle);
+
+// Returns the largest amount of memory, in bytes, held by the compiler's pool allocator during
+// the last compilation. This includes the memory used by the built-in symbol table.
+// Parameters:
+// handle: Specifies the compiler
+size_t GetPoolMemoryHighWaterMark(const ShHandle handle);
+
+// Statistics of one stage of a compilation.
+struct CompileStageStatistics
+{
+    // The name of the stage. AST passes that share a single traversal are one stage.
+    std::string name;
+    double seconds;
+    // The number of AST nodes visited by traversers and the number of AST nodes created.
+    size_t nodesVisited;
+    size_t nodesAllocated;
+    // The number of bytes allocated from the compiler's pool allocator.
+    size_t poolBytes;
+};
+
+// Returns the statistics of the stages of the last compilation in the order they ran. They're only
+// recorded if the SH_COLLECT_COMPILE_STATISTICS compile option was set.
+// Parameters:
+// handle: Specifies the compiler
+const std::vector<CompileStageStatistics> *GetCompileStatistics(const ShHandle handle);
+
 // Returns a (original_name, hash) map containing all the user defined names in the shader,
 // including variable names, function names, struct names, and struct field names.
 // Parameters:
@@ -11,10 +11,23 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <map>
 #include <sstream>
+#include <thread>
 #include <vector>
 #include "angle_gl.h"
 
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#endif
+
 //
 // Return codes from main.
 //
@@ -41,8 +54,65 @@ typedef std::vector<char *> ShaderSource;
 static bool ReadShaderSource(const char *fileName, ShaderSource &source);
 static void FreeShaderSource(ShaderSource &source);
 
+static bool ParseShaderSpec(const std::string &, ShShaderSpec *spec, ShBuiltInResources *resources);
+static bool ParseShaderOutput(const std::string &,
+                              ShShaderOutput *output,
+                              ShCompileOptions *compileOptions);
 static bool ParseGLSLOutputVersion(const std::string &, ShShaderOutput *outResult);
 static bool ParseIntValue(const std::string &, int emptyDefault, int *outValue);
+static void AdjustResourcesForSpec(ShShaderSpec spec, ShBuiltInResources *resources);
+
+//
+// Batch mode translates a whole corpus of shaders on several threads and writes a report
+// instead of printing the results of each shader.
+//
+struct TranslationTarget
+{
+    std::string specName;
+    std::string outputName;
+    ShShaderSpec spec;
+    ShShaderOutput output;
+    ShCompileOptions compileOptions;
+    ShBuiltInResources resources;
+};
+
+struct BatchJob
+{
+    std::string fileName;
+    sh::GLenum shaderType;
+    size_t targetIndex;
+};
+
+struct BatchResult
+{
+    BatchResult() : compiled(false), translateMilliseconds(0.0), poolHighWaterMark(0), outputSize(0)
+    {
+    }
+
+    bool compiled;
+    double translateMilliseconds;
+    size_t poolHighWaterMark;
+    size_t outputSize;
+    std::string infoLog;
+};
+
+struct Batch
+{
+    Batch() : numThreads(std::max(std::thread::hardware_concurrency(), 1u)) {}
+
+    std::vector<TranslationTarget> targets;
+    std::vector<BatchJob> jobs;
+    unsigned int numThreads;
+    std::string reportFileName;
+};
+
+static size_t AddBatchTarget(Batch *batch, const TranslationTarget &target);
+static void AddBatchFile(Batch *batch, const std::string &fileName, size_t targetIndex);
+static bool AddBatchManifest(Batch *batch,
+                             const std::string &manifestName,
+                             const TranslationTarget &defaultTarget);
+static bool AddBatchDirectory(Batch *batch, const std::string &directoryName, size_t targetIndex);
+static TFailCode RunBatch(const Batch &batch);
 
 //
 // Set up the per compile resources
@@ -78,6 +148,8 @@ int main(int argc, char *argv[])
     ShHandle geometryCompiler       = 0;
     ShShaderSpec spec = SH_GLES2_SPEC;
     ShShaderOutput output = SH_ESSL_OUTPUT;
+    std::string specName   = "e2";
+    std::string outputName = "e";
 
     sh::Initialize();
 
@@ -86,6 +158,29 @@ int main(int argc, char *argv[])
 
     argc--;
     argv++;
+
+    // Shaders are only collected while parsing the arguments in batch mode, and translated
+    // together at the end.
+    bool batchMode = false;
+    for (int argIndex = 0; argIndex < argc; ++argIndex)
+    {
+        if (strncmp(argv[argIndex], "-m=", 3) == 0 || strncmp(argv[argIndex], "-d=", 3) == 0)
+        {
+            batchMode = true;
+        }
+    }
+    Batch batch;
+    auto currentTarget = [&]() {
+        TranslationTarget target;
+        target.specName       = specName;
+        target.outputName     = outputName;
+        target.spec           = spec;
+        target.output         = output;
+        target.compileOptions = compileOptions;
+        target.resources      = resources;
+        AdjustResourcesForSpec(spec, &target.resources);
+        return target;
+    };
     for (; (argc >= 1) && (failCode == ESuccess); argc--, argv++)
     {
         if (argv[0][0] == '-')
@@ -97,84 +192,51 @@ int main(int argc, char *argv[])
               case 'u': compileOptions |= SH_VARIABLES; break;
               case 'p': resources.WEBGL_debug_shader_precision = 1; break;
               case 's':
-                if (argv[0][2] == '=')
+                if (argv[0][2] != '=' || !ParseShaderSpec(&argv[0][3], &spec, &resources))
                 {
-                    switch (argv[0][3])
-                    {
-                        case 'e':
-                            if (argv[0][4] == '3')
-                            {
-                                if (argv[0][5] == '1')
-                                {
-                                    spec = SH_GLES3_1_SPEC;
-                                }
-                                else
-                                {
-                                    spec = SH_GLES3_SPEC;
-                                }
-                            }
-                            else
-                            {
-                                spec = SH_GLES2_SPEC;
-                            }
-                            break;
-                        case 'w':
-                            if (argv[0][4] == '3')
-                            {
-                                spec = SH_WEBGL3_SPEC;
-                            }
-                            else if (argv[0][4] == '2')
-                            {
-                                spec = SH_WEBGL2_SPEC;
-                            }
-                            else if (argv[0][4] == 'n')
-                            {
-                                spec = SH_WEBGL_SPEC;
-                            }
-                            else
-                            {
-                                spec = SH_WEBGL_SPEC;
-                                resources.FragmentPrecisionHigh = 1;
-                            }
-                            break;
-                        default:
-                            failCode = EFailUsage;
-                    }
+                    failCode = EFailUsage;
                 }
-                else
+                specName = &argv[0][3];
+                break;
+              case 'b':
+                if (argv[0][2] != '=' ||
+                    !ParseShaderOutput(&argv[0][3], &output, &compileOptions))
                 {
                     failCode = EFailUsage;
                 }
+                outputName = &argv[0][3];
                 break;
-              case 'b':
-                if (argv[0][2] == '=')
+              case 'm':
+                if (argv[0][2] != '=' || !AddBatchManifest(&batch, &argv[0][3], currentTarget()))
                 {
-                    switch (argv[0][3])
-                    {
-                        case 'e':
-                            output = SH_ESSL_OUTPUT;
-                            compileOptions |= SH_INITIALIZE_UNINITIALIZED_LOCALS;
-                            break;
-                        case 'g':
-                            if (!ParseGLSLOutputVersion(&argv[0][sizeof("-b=g") - 1], &output))
-                            {
-                                failCode = EFailUsage;
-                            }
-                            compileOptions |= SH_INITIALIZE_UNINITIALIZED_LOCALS;
-                            break;
-                        case 'h':
-                            if (argv[0][4] == '1' && argv[0][5] == '1')
-                            {
-                                output = SH_HLSL_4_1_OUTPUT;
-                            }
-                            else
-                            {
-                                output = SH_HLSL_3_0_OUTPUT;
-                            }
-                            break;
-                        default:
-                            failCode = EFailUsage;
-                    }
+                    failCode = EFailUsage;
+                }
+                break;
+              case 'd':
+                if (argv[0][2] != '=' ||
+                    !AddBatchDirectory(&batch, &argv[0][3], AddBatchTarget(&batch, currentTarget())))
+                {
+                    failCode = EFailUsage;
+                }
+                break;
+              case 'j':
+              {
+                  int numThreads = 0;
+                  if (argv[0][2] != '=' || !ParseIntValue(&argv[0][3], 0, &numThreads) ||
+                      numThreads < 1)
+                  {
+                      failCode = EFailUsage;
+                  }
+                  else
+                  {
+                      batch.numThreads = static_cast<unsigned int>(numThreads);
+                  }
+                  break;
+              }
+              case 'r':
+                if (argv[0][2] == '=' && argv[0][3] != '\0')
+                {
+                    batch.reportFileName = &argv[0][3];
                 }
                 else
                 {
@@ -237,12 +299,13 @@ int main(int argc, char *argv[])
         }
         else
         {
-            if (spec != SH_GLES2_SPEC && spec != SH_WEBGL_SPEC)
+            if (batchMode)
             {
-                resources.MaxDrawBuffers = 8;
-                resources.MaxVertexTextureImageUnits = 16;
-                resources.MaxTextureImageUnits       = 16;
+                AddBatchFile(&batch, argv[0], AddBatchTarget(&batch, currentTarget()));
+                continue;
             }
+
+            AdjustResourcesForSpec(spec, &resources);
             ShHandle compiler = 0;
             switch (FindShaderType(argv[0]))
             {
@@ -316,8 +379,15 @@ int main(int argc, char *argv[])
         }
     }
 
-    if ((vertexCompiler == 0) && (fragmentCompiler == 0) && (computeCompiler == 0) &&
-        (geometryCompiler == 0))
+    if (batchMode)
+    {
+        if (batch.jobs.empty())
+            failCode = EFailUsage;
+        else if (failCode == ESuccess)
+            failCode = RunBatch(batch);
+    }
+    else if ((vertexCompiler == 0) && (fragmentCompiler == 0) && (computeCompiler == 0) &&
+             (geometryCompiler == 0))
         failCode = EFailUsage;
     if (failCode == EFailUsage)
         usage();
@@ -344,6 +414,7 @@ void usage()
     // clang-format off
     printf(
         "Usage: translate [-i -o -u -l -p -b=e -b=g -b=h9 -x=i -x=d] file1 file2 ...\n"
+        "       translate [options] [-j=NUM -r=REPORT] [-m=MANIFEST] [-d=DIR] [file1 ...]\n"
         "Where: filename : filename ending in .frag or .vert\n"
         "       -i       : print intermediate tree\n"
         "       -o       : print translated code\n"
@@ -372,7 +443,14 @@ void usage()
         "       -x=n     : enable NV_shader_framebuffer_fetch\n"
         "       -x=a     : enable ARM_shader_framebuffer_fetch\n"
         "       -x=m     : enable OVR_multiview\n"
-        "       -x=y     : enable YUV_target\n");
+        "       -x=y     : enable YUV_target\n"
+        "Batch mode (selected by -m or -d):\n"
+        "       -m=FILE  : translate the shaders listed in FILE, one per line. Each path can be\n"
+        "                  followed by -s= and -b= options that override the command line ones.\n"
+        "                  Relative paths are relative to the directory of FILE.\n"
+        "       -d=DIR   : translate all .frag, .vert, .comp and .geom files under DIR\n"
+        "       -j=NUM   : number of translation threads (default: number of CPU cores)\n"
+        "       -r=FILE  : write the JSON report to FILE instead of stdout\n");
     // clang-format on
 }
 
@@ -680,6 +758,96 @@ static void FreeShaderSource(ShaderSource &source)
     source.clear();
 }
 
+static bool ParseShaderSpec(const std::string &arg, ShShaderSpec *spec, ShBuiltInResources *resources)
+{
+    if (arg.empty())
+    {
+        return false;
+    }
+
+    switch (arg[0])
+    {
+        case 'e':
+            if (arg.compare(1, 2, "31") == 0)
+            {
+                *spec = SH_GLES3_1_SPEC;
+            }
+            else if (arg.compare(1, 1, "3") == 0)
+            {
+                *spec = SH_GLES3_SPEC;
+            }
+            else
+            {
+                *spec = SH_GLES2_SPEC;
+            }
+            return true;
+        case 'w':
+            if (arg.compare(1, 1, "3") == 0)
+            {
+                *spec = SH_WEBGL3_SPEC;
+            }
+            else if (arg.compare(1, 1, "2") == 0)
+            {
+                *spec = SH_WEBGL2_SPEC;
+            }
+            else if (arg.compare(1, 1, "n") == 0)
+            {
+                *spec = SH_WEBGL_SPEC;
+            }
+            else
+            {
+                *spec                            = SH_WEBGL_SPEC;
+                resources->FragmentPrecisionHigh = 1;
+            }
+            return true;
+        default:
+            return false;
+    }
+}
+
+static bool ParseShaderOutput(const std::string &arg,
+                              ShShaderOutput *output,
+                              ShCompileOptions *compileOptions)
+{
+    if (arg.empty())
+    {
+        return false;
+    }
+
+    switch (arg[0])
+    {
+        case 'e':
+            *output = SH_ESSL_OUTPUT;
+            *compileOptions |= SH_INITIALIZE_UNINITIALIZED_LOCALS;
+            return true;
+        case 'g':
+            *compileOptions |= SH_INITIALIZE_UNINITIALIZED_LOCALS;
+            return ParseGLSLOutputVersion(arg.substr(1), output);
+        case 'h':
+            if (arg.compare(1, 2, "11") == 0)
+            {
+                *output = SH_HLSL_4_1_OUTPUT;
+            }
+            else
+            {
+                *output = SH_HLSL_3_0_OUTPUT;
+            }
+            return true;
+        default:
+            return false;
+    }
+}
+
+static void AdjustResourcesForSpec(ShShaderSpec spec, ShBuiltInResources *resources)
+{
+    if (spec != SH_GLES2_SPEC && spec != SH_WEBGL_SPEC)
+    {
+        resources->MaxDrawBuffers             = 8;
+        resources->MaxVertexTextureImageUnits = 16;
+        resources->MaxTextureImageUnits       = 16;
+    }
+}
+
 static bool ParseGLSLOutputVersion(const std::string &num, ShShaderOutput *outResult)
 {
     if (num.length() == 0)
@@ -749,3 +917,406 @@ static bool ParseIntValue(const std::string &num, int emptyDefault, int *outValu
     *outValue = value;
     return true;
 }
+
+static bool IsShaderFileName(const std::string &fileName)
+{
+    size_t extensionPos = fileName.rfind('.');
+    if (extensionPos == std::string::npos)
+    {
+        return false;
+    }
+    for (const char *extension : {".frag", ".vert", ".comp", ".geom"})
+    {
+        if (fileName.compare(extensionPos, 5, extension) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool ReadFileToString(const std::string &fileName, std::string *contents)
+{
+    std::ifstream in(fileName.c_str(), std::ios::binary);
+    if (!in)
+    {
+        return false;
+    }
+    std::ostringstream stream;
+    stream << in.rdbuf();
+    *contents = stream.str();
+    return true;
+}
+
+static size_t AddBatchTarget(Batch *batch, const TranslationTarget &target)
+{
+    for (size_t targetIndex = 0; targetIndex < batch->targets.size(); ++targetIndex)
+    {
+        const TranslationTarget &existing = batch->targets[targetIndex];
+        if (existing.specName == target.specName && existing.outputName == target.outputName &&
+            existing.spec == target.spec &&
+            existing.output == target.output && existing.compileOptions == target.compileOptions &&
+            memcmp(&existing.resources, &target.resources, sizeof(ShBuiltInResources)) == 0)
+        {
+            return targetIndex;
+        }
+    }
+    batch->targets.push_back(target);
+    return batch->targets.size() - 1;
+}
+
+static void AddBatchFile(Batch *batch, const std::string &fileName, size_t targetIndex)
+{
+    BatchJob job;
+    job.fileName    = fileName;
+    job.shaderType  = FindShaderType(fileName.c_str());
+    job.targetIndex = targetIndex;
+    batch->jobs.push_back(job);
+}
+
+static bool AddBatchManifest(Batch *batch,
+                             const std::string &manifestName,
+                             const TranslationTarget &defaultTarget)
+{
+    std::ifstream manifest(manifestName.c_str());
+    if (!manifest)
+    {
+        printf("Error: unable to open manifest: %s\n", manifestName.c_str());
+        return false;
+    }
+
+    std::string baseDirectory;
+    size_t separatorPos = manifestName.find_last_of("/\\");
+    if (separatorPos != std::string::npos)
+    {
+        baseDirectory = manifestName.substr(0, separatorPos + 1);
+    }
+
+    std::string line;
+    for (int lineNumber = 1; std::getline(manifest, line); ++lineNumber)
+    {
+        std::istringstream tokens(line);
+        std::string fileName;
+        if (!(tokens >> fileName) || fileName[0] == '#')
+        {
+            continue;
+        }
+
+        TranslationTarget target = defaultTarget;
+        std::string option;
+        while (tokens >> option)
+        {
+            bool valid = false;
+            if (option.compare(0, 3, "-s=") == 0)
+            {
+                target.specName = option.substr(3);
+                valid = ParseShaderSpec(target.specName, &target.spec, &target.resources);
+            }
+            else if (option.compare(0, 3, "-b=") == 0)
+            {
+                target.outputName = option.substr(3);
+                valid = ParseShaderOutput(target.outputName, &target.output, &target.compileOptions);
+            }
+            if (!valid)
+            {
+                printf("Error: invalid option %s at %s:%d\n", option.c_str(), manifestName.c_str(),
+                       lineNumber);
+                return false;
+            }
+        }
+        AdjustResourcesForSpec(target.spec, &target.resources);
+
+        bool isAbsolute = fileName[0] == '/' || fileName[0] == '\\' ||
+                          (fileName.size() > 1 && fileName[1] == ':');
+        AddBatchFile(batch, isAbsolute ? fileName : baseDirectory + fileName,
+                     AddBatchTarget(batch, target));
+    }
+    return true;
+}
+
+static bool ListDirectory(const std::string &directoryName,
+                          std::vector<std::string> *fileNames,
+                          std::vector<std::string> *subdirectoryNames)
+{
+#if defined(_WIN32)
+    WIN32_FIND_DATAA findData;
+    HANDLE findHandle = FindFirstFileA((directoryName + "\\*").c_str(), &findData);
+    if (findHandle == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+    do
+    {
+        std::string name = findData.cFileName;
+        if (name == "." || name == "..")
+        {
+            continue;
+        }
+        if (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+        {
+            subdirectoryNames->push_back(name);
+        }
+        else
+        {
+            fileNames->push_back(name);
+        }
+    } while (FindNextFileA(findHandle, &findData));
+    FindClose(findHandle);
+#else
+    DIR *directory = opendir(directoryName.c_str());
+    if (!directory)
+    {
+        return false;
+    }
+    while (dirent *entry = readdir(directory))
+    {
+        std::string name = entry->d_name;
+        if (name == "." || name == "..")
+        {
+            continue;
+        }
+        struct stat status;
+        if (stat((directoryName + "/" + name).c_str(), &status) != 0)
+        {
+            continue;
+        }
+        if (S_ISDIR(status.st_mode))
+        {
+            subdirectoryNames->push_back(name);
+        }
+        else if (S_ISREG(status.st_mode))
+        {
+            fileNames->push_back(name);
+        }
+    }
+    closedir(directory);
+#endif
+    return true;
+}
+
+static bool AddBatchDirectory(Batch *batch, const std::string &directoryName, size_t targetIndex)
+{
+    std::vector<std::string> fileNames;
+    std::vector<std::string> subdirectoryNames;
+    if (!ListDirectory(directoryName, &fileNames, &subdirectoryNames))
+    {
+        printf("Error: unable to open input directory: %s\n", directoryName.c_str());
+        return false;
+    }
+
+    // Sort the entries so that reports for the same corpus can be compared.
+    std::sort(fileNames.begin(), fileNames.end());
+    std::sort(subdirectoryNames.begin(), subdirectoryNames.end());
+
+    for (const std::string &fileName : fileNames)
+    {
+        if (IsShaderFileName(fileName))
+        {
+            AddBatchFile(batch, directoryName + "/" + fileName, targetIndex);
+        }
+    }
+    for (const std::string &subdirectoryName : subdirectoryNames)
+    {
+        if (!AddBatchDirectory(batch, directoryName + "/" + subdirectoryName, targetIndex))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//
+//   Translate jobs until there are none left. Each thread keeps one compiler per shader type and
+//   target, so the built-in symbol tables are only set up once per thread.
+//
+static void RunBatchWorker(const Batch &batch,
+                           std::atomic<size_t> *nextJob,
+                           std::vector<BatchResult> *results)
+{
+    std::map<std::pair<sh::GLenum, size_t>, ShHandle> compilers;
+
+    for (size_t jobIndex = (*nextJob)++; jobIndex < batch.jobs.size(); jobIndex = (*nextJob)++)
+    {
+        const BatchJob &job              = batch.jobs[jobIndex];
+        const TranslationTarget &target  = batch.targets[job.targetIndex];
+        BatchResult &result              = (*results)[jobIndex];
+
+        ShHandle &compiler = compilers[std::make_pair(job.shaderType, job.targetIndex)];
+        if (compiler == 0)
+        {
+            compiler =
+                sh::ConstructCompiler(job.shaderType, target.spec, target.output, &target.resources);
+        }
+        if (compiler == 0)
+        {
+            result.infoLog = "Error: unable to create compiler";
+            continue;
+        }
+
+        std::string source;
+        if (!ReadFileToString(job.fileName, &source))
+        {
+            result.infoLog = "Error: unable to open input file";
+            continue;
+        }
+        const char *sourceStrings[] = {source.c_str()};
+
+        auto startTime  = std::chrono::steady_clock::now();
+        result.compiled = sh::Compile(compiler, sourceStrings, 1,
+                                      target.compileOptions | SH_OBJECT_CODE);
+        auto endTime    = std::chrono::steady_clock::now();
+
+        result.translateMilliseconds =
+            std::chrono::duration<double, std::milli>(endTime - startTime).count();
+        result.poolHighWaterMark = sh::GetPoolMemoryHighWaterMark(compiler);
+        result.outputSize        = sh::GetObjectCode(compiler).size();
+        if (!result.compiled)
+        {
+            result.infoLog = sh::GetInfoLog(compiler);
+        }
+    }
+
+    for (const auto &compiler : compilers)
+    {
+        if (compiler.second)
+            sh::Destruct(compiler.second);
+    }
+}
+
+static std::string JsonString(const std::string &str)
+{
+    std::string escaped = "\"";
+    for (char c : str)
+    {
+        switch (c)
+        {
+            case '"': escaped += "\\\""; break;
+            case '\\': escaped += "\\\\"; break;
+            case '\n': escaped += "\\n"; break;
+            case '\r': escaped += "\\r"; break;
+            case '\t': escaped += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    char code[7];
+                    snprintf(code, sizeof(code), "\\u%04x", c);
+                    escaped += code;
+                }
+                else
+                {
+                    escaped += c;
+                }
+                break;
+        }
+    }
+    return escaped + "\"";
+}
+
+static const char *GetShaderTypeName(sh::GLenum shaderType)
+{
+    switch (shaderType)
+    {
+      case GL_VERTEX_SHADER: return "vertex";
+      case GL_FRAGMENT_SHADER: return "fragment";
+      case GL_COMPUTE_SHADER: return "compute";
+      case GL_GEOMETRY_SHADER_EXT: return "geometry";
+      default: return "unknown";
+    }
+}
+
+static void WriteBatchReport(FILE *out,
+                             const Batch &batch,
+                             const std::vector<BatchResult> &results,
+                             unsigned int numThreads,
+                             double wallMilliseconds)
+{
+    size_t failedCount              = 0;
+    double totalTranslateMillisecs  = 0.0;
+    size_t maxPoolHighWaterMark     = 0;
+    size_t totalOutputSize          = 0;
+
+    fprintf(out, "{\n  \"shaders\": [");
+    for (size_t jobIndex = 0; jobIndex < batch.jobs.size(); ++jobIndex)
+    {
+        const BatchJob &job       = batch.jobs[jobIndex];
+        const BatchResult &result = results[jobIndex];
+
+        const TranslationTarget &target = batch.targets[job.targetIndex];
+
+        fprintf(out, "%s\n    {\"file\": %s, \"type\": \"%s\", \"spec\": %s, \"output\": %s, ",
+                jobIndex == 0 ? "" : ",", JsonString(job.fileName).c_str(),
+                GetShaderTypeName(job.shaderType), JsonString(target.specName).c_str(),
+                JsonString(target.outputName).c_str());
+        fprintf(out,
+                "\"compiled\": %s, \"translate_ms\": %.3f, \"pool_high_water_bytes\": %zu, "
+                "\"output_bytes\": %zu",
+                result.compiled ? "true" : "false", result.translateMilliseconds,
+                result.poolHighWaterMark, result.outputSize);
+        if (!result.compiled)
+        {
+            fprintf(out, ", \"info_log\": %s", JsonString(result.infoLog).c_str());
+        }
+        fprintf(out, "}");
+
+        failedCount += result.compiled ? 0 : 1;
+        totalTranslateMillisecs += result.translateMilliseconds;
+        maxPoolHighWaterMark = std::max(maxPoolHighWaterMark, result.poolHighWaterMark);
+        totalOutputSize += result.outputSize;
+    }
+    fprintf(out, "\n  ],\n");
+
+    fprintf(out,
+            "  \"summary\": {\"shaders\": %zu, \"failed\": %zu, \"threads\": %u, "
+            "\"wall_ms\": %.3f, \"translate_ms\": %.3f, \"max_pool_high_water_bytes\": %zu, "
+            "\"output_bytes\": %zu}\n}\n",
+            batch.jobs.size(), failedCount, numThreads, wallMilliseconds,
+            totalTranslateMillisecs, maxPoolHighWaterMark, totalOutputSize);
+}
+
+static TFailCode RunBatch(const Batch &batch)
+{
+    std::vector<BatchResult> results(batch.jobs.size());
+    std::atomic<size_t> nextJob(0);
+
+    unsigned int numThreads =
+        static_cast<unsigned int>(std::min<size_t>(batch.numThreads, batch.jobs.size()));
+
+    auto startTime = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (unsigned int threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+    {
+        threads.emplace_back(RunBatchWorker, std::cref(batch), &nextJob, &results);
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+    auto endTime = std::chrono::steady_clock::now();
+    double wallMilliseconds =
+        std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+    FILE *out = stdout;
+    if (!batch.reportFileName.empty())
+    {
+        out = fopen(batch.reportFileName.c_str(), "w");
+        if (!out)
+        {
+            printf("Error: unable to open report file: %s\n", batch.reportFileName.c_str());
+            return EFailCompile;
+        }
+    }
+    WriteBatchReport(out, batch, results, numThreads, wallMilliseconds);
+    if (out != stdout)
+    {
+        fclose(out);
+    }
+
+    for (const BatchResult &result : results)
+    {
+        if (!result.compiled)
+        {
+            return EFailCompile;
+        }
+    }
+    return ESuccess;
+}
@@ -87,6 +87,16 @@ generators = {
         ],
         'script': 'src/libANGLE/gen_format_map.py',
     },
+    'built-in symbol table': {
+        'inputs': [
+            'src/compiler/translator/builtin_function_declarations.txt',
+        ],
+        'outputs': [
+            'src/compiler/translator/SymbolTable_autogen.cpp',
+            'src/compiler/translator/SymbolTable_autogen.h',
+        ],
+        'script': 'src/compiler/translator/gen_builtin_symbols.py',
+    },
     'uniform type': {
         'inputs': [],
         'outputs': [
@@ -8,7 +8,7 @@
 //   Might be implemented differently depending on platform.
 //
 
-#include "libANGLE/WorkerThread.h"
+#include "common/WorkerThread.h"
 
 namespace angle
 {
@@ -72,27 +72,86 @@ void SingleThreadedWaitableEvent::signalImpl()
     mSignaled = true;
 }
 
+bool SingleThreadedWaitableEvent::isReadyImpl()
+{
+    // Tasks run to completion when they are posted, so there is never anything to wait for.
+    return true;
+}
+
 #if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
 // AsyncWorkerPool implementation.
-AsyncWorkerPool::AsyncWorkerPool(size_t maxThreads) : WorkerThreadPoolBase(maxThreads)
+AsyncWorkerPool::AsyncWorkerPool(size_t maxThreads)
+    : WorkerThreadPoolBase(maxThreads),
+      mMaxThreads(maxThreads),
+      mIdleThreadCount(0),
+      mTerminated(false)
 {
+    ASSERT(mMaxThreads > 0);
 }
 
 AsyncWorkerPool::~AsyncWorkerPool()
 {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mTerminated = true;
+    }
+    mCondition.notify_all();
+
+    for (std::thread &thread : mThreads)
+    {
+        thread.join();
+    }
 }
 
 AsyncWaitableEvent AsyncWorkerPool::postWorkerTaskImpl(Closure *task)
 {
-    auto future = std::async(std::launch::async, [task] { (*task)(); });
+    std::packaged_task<void()> packagedTask([task] { (*task)(); });
 
     AsyncWaitableEvent waitable(EventResetPolicy::Automatic, EventInitialState::NonSignaled);
+    waitable.setFuture(packagedTask.get_future());
 
-    waitable.setFuture(std::move(future));
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mTaskQueue.push_back(std::move(packagedTask));
+
+        // Tasks that are already queued will take the idle threads first.
+        if (mIdleThreadCount < mTaskQueue.size() && mThreads.size() < mMaxThreads)
+        {
+            mThreads.emplace_back(&AsyncWorkerPool::threadLoop, this);
+        }
+    }
+    mCondition.notify_one();
 
     return waitable;
 }
 
+void AsyncWorkerPool::threadLoop()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (true)
+    {
+        if (mTaskQueue.empty())
+        {
+            if (mTerminated)
+            {
+                return;
+            }
+
+            mIdleThreadCount++;
+            mCondition.wait(lock, [this] { return !mTaskQueue.empty() || mTerminated; });
+            mIdleThreadCount--;
+            continue;
+        }
+
+        std::packaged_task<void()> task = std::move(mTaskQueue.front());
+        mTaskQueue.pop_front();
+
+        lock.unlock();
+        task();
+        lock.lock();
+    }
+}
+
 // AsyncWaitableEvent implementation.
 AsyncWaitableEvent::AsyncWaitableEvent()
     : AsyncWaitableEvent(EventResetPolicy::Automatic, EventInitialState::NonSignaled)
@@ -150,6 +209,16 @@ void AsyncWaitableEvent::signalImpl()
         reset();
     }
 }
+
+bool AsyncWaitableEvent::isReadyImpl()
+{
+    if (mSignaled || !mFuture.valid())
+    {
+        return true;
+    }
+
+    return mFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
 #endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
 
 }  // namespace priv
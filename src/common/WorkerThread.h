@@ -8,17 +8,30 @@
 //   Can be implemented as different targets, depending on platform.
 //
 
-#ifndef LIBANGLE_WORKER_THREAD_H_
-#define LIBANGLE_WORKER_THREAD_H_
+#ifndef COMMON_WORKER_THREAD_H_
+#define COMMON_WORKER_THREAD_H_
 
 #include <array>
 #include <vector>
 
 #include "common/debug.h"
-#include "libANGLE/features.h"
+#include "common/platform.h"
+
+// Controls if our threading code uses std::async or falls back to single-threaded operations.
+#if !defined(ANGLE_STD_ASYNC_WORKERS)
+#if defined(ANGLE_PLATFORM_WINDOWS) || defined(ANGLE_PLATFORM_LINUX)
+#define ANGLE_STD_ASYNC_WORKERS ANGLE_ENABLED
+#else
+#define ANGLE_STD_ASYNC_WORKERS ANGLE_DISABLED
+#endif  // defined(ANGLE_PLATFORM_WINDOWS) || defined(ANGLE_PLATFORM_LINUX)
+#endif  // !defined(ANGLE_STD_ASYNC_WORKERS)
 
 #if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+#include <condition_variable>
+#include <deque>
 #include <future>
+#include <mutex>
+#include <thread>
 #endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
 
 namespace angle
@@ -67,6 +80,9 @@ class WaitableEventBase : angle::NonCopyable
     // The event state is reset to non-signaled after a waiting thread has been released.
     void signal();
 
+    // Returns true if wait() would return without blocking.
+    bool isReady();
+
   protected:
     Impl &copyBase(Impl &&other);
 
@@ -108,6 +124,12 @@ void WaitableEventBase<Impl>::signal()
     static_cast<Impl *>(this)->signalImpl();
 }
 
+template <typename Impl>
+bool WaitableEventBase<Impl>::isReady()
+{
+    return static_cast<Impl *>(this)->isReadyImpl();
+}
+
 template <typename Impl>
 template <size_t Count>
 // static
@@ -144,6 +166,7 @@ class SingleThreadedWaitableEvent : public WaitableEventBase<SingleThreadedWaita
     void resetImpl();
     void waitImpl();
     void signalImpl();
+    bool isReadyImpl();
 
     // Wait, synchronously, on multiple events.
     // returns the index of a WaitableEvent which has been signaled.
@@ -173,6 +196,7 @@ class AsyncWaitableEvent : public WaitableEventBase<AsyncWaitableEvent>
     void resetImpl();
     void waitImpl();
     void signalImpl();
+    bool isReadyImpl();
 
     // Wait, synchronously, on multiple events.
     // returns the index of a WaitableEvent which has been signaled.
@@ -259,6 +283,9 @@ class SingleThreadedWorkerPool : public WorkerThreadPoolBase<SingleThreadedWorke
 };
 
 #if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+// Runs the tasks on at most maxThreads threads, in the order they were posted. Threads are started
+// when tasks are posted and none is idle, and are joined when the pool is destroyed, after they
+// have run all the tasks left in the queue.
 class AsyncWorkerPool : public WorkerThreadPoolBase<AsyncWorkerPool>
 {
   public:
@@ -266,6 +293,18 @@ class AsyncWorkerPool : public WorkerThreadPoolBase<AsyncWorkerPool>
     ~AsyncWorkerPool();
 
     AsyncWaitableEvent postWorkerTaskImpl(Closure *task);
+
+  private:
+    void threadLoop();
+
+    size_t mMaxThreads;
+
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    std::deque<std::packaged_task<void()>> mTaskQueue;
+    std::vector<std::thread> mThreads;
+    size_t mIdleThreadCount;
+    bool mTerminated;
 };
 #endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
 
@@ -281,4 +320,4 @@ using WorkerThreadPool = priv::SingleThreadedWorkerPool;
 
 }  // namespace angle
 
-#endif  // LIBANGLE_WORKER_THREAD_H_
+#endif  // COMMON_WORKER_THREAD_H_
@@ -0,0 +1,161 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// WorkerThread_unittest:
+//   Simple tests for the worker thread class.
+
+#include <array>
+#include <atomic>
+#include <gtest/gtest.h>
+
+#include "common/WorkerThread.h"
+
+using namespace angle;
+
+namespace
+{
+
+template <typename T>
+class WorkerPoolTest : public ::testing::Test
+{
+  public:
+    T workerPool = {4};
+};
+
+#if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+using WorkerPoolTypes = ::testing::Types<priv::AsyncWorkerPool, priv::SingleThreadedWorkerPool>;
+#else
+using WorkerPoolTypes = ::testing::Types<priv::SingleThreadedWorkerPool>;
+#endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+
+TYPED_TEST_CASE(WorkerPoolTest, WorkerPoolTypes);
+
+// Tests simple worker pool application.
+TYPED_TEST(WorkerPoolTest, SimpleTask)
+{
+    class TestTask : public Closure
+    {
+      public:
+        void operator()() override { fired = true; }
+
+        bool fired = false;
+    };
+
+    std::array<TestTask, 4> tasks;
+    std::array<typename TypeParam::WaitableEventType, 4> waitables = {{
+        this->workerPool.postWorkerTask(&tasks[0]), this->workerPool.postWorkerTask(&tasks[1]),
+        this->workerPool.postWorkerTask(&tasks[2]), this->workerPool.postWorkerTask(&tasks[3]),
+    }};
+
+    TypeParam::WaitableEventType::WaitMany(&waitables);
+
+    for (const auto &task : tasks)
+    {
+        EXPECT_TRUE(task.fired);
+    }
+}
+
+// Tests polling a task for completion without waiting on it.
+TYPED_TEST(WorkerPoolTest, IsReady)
+{
+    class TestTask : public Closure
+    {
+      public:
+        void operator()() override { fired = true; }
+
+        bool fired = false;
+    };
+
+    TestTask task;
+    typename TypeParam::WaitableEventType waitable = this->workerPool.postWorkerTask(&task);
+
+    while (!waitable.isReady())
+    {
+    }
+    EXPECT_TRUE(task.fired);
+
+    waitable.wait();
+    EXPECT_TRUE(waitable.isReady());
+}
+
+// Tests posting more tasks than the pool has threads, including tasks that are never waited on.
+TYPED_TEST(WorkerPoolTest, ManyTasks)
+{
+    class TestTask : public Closure
+    {
+      public:
+        void operator()() override { fired = true; }
+
+        bool fired = false;
+    };
+
+    // The pool is destroyed first, which runs the tasks that are left before they go away.
+    std::array<TestTask, 64> tasks;
+    TypeParam workerPool(2);
+
+    std::vector<typename TypeParam::WaitableEventType> waitables;
+    for (TestTask &task : tasks)
+    {
+        waitables.push_back(workerPool.postWorkerTask(&task));
+    }
+
+    for (size_t taskIndex = 0; taskIndex < tasks.size(); taskIndex += 2)
+    {
+        waitables[taskIndex].wait();
+        EXPECT_TRUE(tasks[taskIndex].fired);
+    }
+}
+
+#if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+// Tests that the async pool doesn't run more tasks at once than it has threads.
+TEST(AsyncWorkerPoolTest, MaxThreads)
+{
+    class TestTask : public Closure
+    {
+      public:
+        TestTask(std::atomic<int> *runningCountIn, std::atomic<int> *maxRunningCountIn)
+            : runningCount(runningCountIn), maxRunningCount(maxRunningCountIn)
+        {
+        }
+
+        void operator()() override
+        {
+            int running    = ++(*runningCount);
+            int maxRunning = maxRunningCount->load();
+            while (running > maxRunning &&
+                   !maxRunningCount->compare_exchange_weak(maxRunning, running))
+            {
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            --(*runningCount);
+        }
+
+        std::atomic<int> *runningCount;
+        std::atomic<int> *maxRunningCount;
+    };
+
+    std::atomic<int> runningCount(0);
+    std::atomic<int> maxRunningCount(0);
+
+    std::vector<TestTask> tasks(32, TestTask(&runningCount, &maxRunningCount));
+    std::vector<priv::AsyncWaitableEvent> waitables;
+    {
+        priv::AsyncWorkerPool workerPool(2);
+        for (TestTask &task : tasks)
+        {
+            waitables.push_back(workerPool.postWorkerTask(&task));
+        }
+    }
+
+    // Destroying the pool runs the tasks left in the queue.
+    for (priv::AsyncWaitableEvent &waitable : waitables)
+    {
+        EXPECT_TRUE(waitable.isReady());
+    }
+    EXPECT_GE(2, maxRunningCount.load());
+}
+#endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+
+}  // anonymous namespace
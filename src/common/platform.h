@@ -9,6 +9,10 @@
 #ifndef COMMON_PLATFORM_H_
 #define COMMON_PLATFORM_H_
 
+// Values of the switches that turn features on and off, such as those in libANGLE/features.h.
+#define ANGLE_DISABLED 0
+#define ANGLE_ENABLED 1
+
 #if defined(_WIN32) || defined(_WIN64)
 #   define ANGLE_PLATFORM_WINDOWS 1
 #elif defined(__APPLE__)
@@ -90,6 +94,9 @@
 #elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
 #include <x86intrin.h>
 #define ANGLE_USE_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define ANGLE_USE_NEON
 #endif
 
 // Mips and arm devices need to include stddef for size_t.
@@ -23,6 +23,9 @@ bool SetCWD(const char *dirName);
 bool SetEnvironmentVar(const char *variableName, const char *value);
 std::string GetEnvironmentVar(const char *variableName);
 const char *GetPathSeparator();
+// Renames a file, replacing the destination if it exists. Readers of the destination see either
+// the old or the new file, never a partially written one.
+bool RenameFile(const char *oldPath, const char *newPath);
 bool PrependPathToEnvironmentVar(const char *variableName, const char *path);
 
 }  // namespace angle
@@ -14,6 +14,7 @@
 #include <unistd.h>
 
 #include <array>
+#include <cstdio>
 
 namespace angle
 {
@@ -97,4 +98,9 @@ const char *GetPathSeparator()
     return ":";
 }
 
+bool RenameFile(const char *oldPath, const char *newPath)
+{
+    return (rename(oldPath, newPath) == 0);
+}
+
 }  // namespace angle
@@ -10,6 +10,7 @@
 
 #include <unistd.h>
 
+#include <cstdio>
 #include <cstdlib>
 #include <mach-o/dyld.h>
 #include <vector>
@@ -102,4 +103,9 @@ const char *GetPathSeparator()
     return ":";
 }
 
+bool RenameFile(const char *oldPath, const char *newPath)
+{
+    return (rename(oldPath, newPath) == 0);
+}
+
 }  // namespace angle
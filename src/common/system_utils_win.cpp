@@ -96,4 +96,9 @@ const char *GetPathSeparator()
     return ";";
 }
 
+bool RenameFile(const char *oldPath, const char *newPath)
+{
+    return (MoveFileExA(oldPath, newPath, MOVEFILE_REPLACE_EXISTING) == TRUE);
+}
+
 }  // namespace angle
@@ -34,10 +34,11 @@
 #   error Unsupported platform.
 #endif
 
-// TODO(kbr): for POSIX platforms this will have to be changed to take
-// in a destructor function pointer, to allow the thread-local storage
-// to be properly deallocated upon thread exit.
-TLSIndex CreateTLSIndex();
+// On POSIX platforms, |destructor| is called with the value of each thread that exits with a
+// value other than nullptr, so that it can be deallocated. It is ignored on Windows, where the
+// values are deallocated when the DLL is notified that a thread is exiting.
+typedef void (*TLSDestructor)(void *value);
+TLSIndex CreateTLSIndex(TLSDestructor destructor);
 bool DestroyTLSIndex(TLSIndex index);
 
 bool SetTLSValue(TLSIndex index, void *value);
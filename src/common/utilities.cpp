@@ -11,6 +11,7 @@
 #include "common/mathutil.h"
 #include "common/platform.h"
 
+#include <algorithm>
 #include <set>
 
 #if defined(ANGLE_ENABLE_WINDOWS_STORE)
@@ -46,6 +47,7 @@ gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
                 minIndex = indices[i];
                 maxIndex = indices[i];
                 nonPrimitiveRestartIndices++;
+                i++;
                 break;
             }
         }
@@ -90,6 +92,281 @@ gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
                           nonPrimitiveRestartIndices);
 }
 
+#if defined(ANGLE_USE_SSE) || defined(ANGLE_USE_NEON)
+
+// Shorter runs of indices are scanned one index at a time.
+constexpr size_t kMinVectorIndexCount = 64;
+
+#if defined(ANGLE_USE_SSE)
+
+// SSE2 only has unsigned min and max for bytes. The wider indices have their top bit flipped when
+// they are loaded so that the signed operations order them like unsigned ones.
+struct SSE2Indices8
+{
+    using IndexType = GLubyte;
+    using Vector    = __m128i;
+
+    static constexpr size_t kLanes   = 16;
+    static constexpr IndexType kBias = 0;
+
+    static Vector Load(const IndexType *indices)
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices));
+    }
+    static Vector Splat(IndexType value) { return _mm_set1_epi8(static_cast<char>(value)); }
+    static Vector Min(Vector a, Vector b) { return _mm_min_epu8(a, b); }
+    static Vector Max(Vector a, Vector b) { return _mm_max_epu8(a, b); }
+    static Vector Add(Vector a, Vector b) { return _mm_add_epi8(a, b); }
+    static Vector Subtract(Vector a, Vector b) { return _mm_sub_epi8(a, b); }
+    static Vector Equal(Vector a, Vector b) { return _mm_cmpeq_epi8(a, b); }
+    static void Store(Vector v, IndexType *out)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out), v);
+    }
+};
+
+struct SSE2Indices16
+{
+    using IndexType = GLushort;
+    using Vector    = __m128i;
+
+    static constexpr size_t kLanes   = 8;
+    static constexpr IndexType kBias = 0x8000;
+
+    static Vector Load(const IndexType *indices)
+    {
+        return _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(indices)),
+                             Splat(kBias));
+    }
+    static Vector Splat(IndexType value) { return _mm_set1_epi16(static_cast<short>(value)); }
+    static Vector Min(Vector a, Vector b) { return _mm_min_epi16(a, b); }
+    static Vector Max(Vector a, Vector b) { return _mm_max_epi16(a, b); }
+    static Vector Add(Vector a, Vector b) { return _mm_add_epi16(a, b); }
+    static Vector Subtract(Vector a, Vector b) { return _mm_sub_epi16(a, b); }
+    static Vector Equal(Vector a, Vector b) { return _mm_cmpeq_epi16(a, b); }
+    static void Store(Vector v, IndexType *out)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out), v);
+    }
+};
+
+struct SSE2Indices32
+{
+    using IndexType = GLuint;
+    using Vector    = __m128i;
+
+    static constexpr size_t kLanes   = 4;
+    static constexpr IndexType kBias = 0x80000000u;
+
+    static Vector Load(const IndexType *indices)
+    {
+        return _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(indices)),
+                             Splat(kBias));
+    }
+    static Vector Splat(IndexType value) { return _mm_set1_epi32(static_cast<int>(value)); }
+    static Vector Min(Vector a, Vector b)
+    {
+        __m128i aGreater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(aGreater, b), _mm_andnot_si128(aGreater, a));
+    }
+    static Vector Max(Vector a, Vector b)
+    {
+        __m128i aGreater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(aGreater, a), _mm_andnot_si128(aGreater, b));
+    }
+    static Vector Add(Vector a, Vector b) { return _mm_add_epi32(a, b); }
+    static Vector Subtract(Vector a, Vector b) { return _mm_sub_epi32(a, b); }
+    static Vector Equal(Vector a, Vector b) { return _mm_cmpeq_epi32(a, b); }
+    static void Store(Vector v, IndexType *out)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out), v);
+    }
+};
+
+using VectorIndices8  = SSE2Indices8;
+using VectorIndices16 = SSE2Indices16;
+using VectorIndices32 = SSE2Indices32;
+
+bool SupportsVectorIndexRange()
+{
+#if defined(_MSC_VER)
+    return gl::supportsSSE2();
+#else
+    // gl::supportsSSE2() only queries the CPU on Windows, and enabling it elsewhere would also
+    // switch the image loaders over. The index kernels check on their own.
+    static const bool supports = __builtin_cpu_supports("sse2");
+    return supports;
+#endif  // defined(_MSC_VER)
+}
+
+#else  // defined(ANGLE_USE_SSE)
+
+struct NEONIndices8
+{
+    using IndexType = GLubyte;
+    using Vector    = uint8x16_t;
+
+    static constexpr size_t kLanes   = 16;
+    static constexpr IndexType kBias = 0;
+
+    static Vector Load(const IndexType *indices) { return vld1q_u8(indices); }
+    static Vector Splat(IndexType value) { return vdupq_n_u8(value); }
+    static Vector Min(Vector a, Vector b) { return vminq_u8(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u8(a, b); }
+    static Vector Add(Vector a, Vector b) { return vaddq_u8(a, b); }
+    static Vector Subtract(Vector a, Vector b) { return vsubq_u8(a, b); }
+    static Vector Equal(Vector a, Vector b) { return vceqq_u8(a, b); }
+    static void Store(Vector v, IndexType *out) { vst1q_u8(out, v); }
+};
+
+struct NEONIndices16
+{
+    using IndexType = GLushort;
+    using Vector    = uint16x8_t;
+
+    static constexpr size_t kLanes   = 8;
+    static constexpr IndexType kBias = 0;
+
+    static Vector Load(const IndexType *indices) { return vld1q_u16(indices); }
+    static Vector Splat(IndexType value) { return vdupq_n_u16(value); }
+    static Vector Min(Vector a, Vector b) { return vminq_u16(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u16(a, b); }
+    static Vector Add(Vector a, Vector b) { return vaddq_u16(a, b); }
+    static Vector Subtract(Vector a, Vector b) { return vsubq_u16(a, b); }
+    static Vector Equal(Vector a, Vector b) { return vceqq_u16(a, b); }
+    static void Store(Vector v, IndexType *out) { vst1q_u16(out, v); }
+};
+
+struct NEONIndices32
+{
+    using IndexType = GLuint;
+    using Vector    = uint32x4_t;
+
+    static constexpr size_t kLanes   = 4;
+    static constexpr IndexType kBias = 0;
+
+    static Vector Load(const IndexType *indices) { return vld1q_u32(indices); }
+    static Vector Splat(IndexType value) { return vdupq_n_u32(value); }
+    static Vector Min(Vector a, Vector b) { return vminq_u32(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u32(a, b); }
+    static Vector Add(Vector a, Vector b) { return vaddq_u32(a, b); }
+    static Vector Subtract(Vector a, Vector b) { return vsubq_u32(a, b); }
+    static Vector Equal(Vector a, Vector b) { return vceqq_u32(a, b); }
+    static void Store(Vector v, IndexType *out) { vst1q_u32(out, v); }
+};
+
+using VectorIndices8  = NEONIndices8;
+using VectorIndices16 = NEONIndices16;
+using VectorIndices32 = NEONIndices32;
+
+bool SupportsVectorIndexRange()
+{
+    return true;
+}
+
+#endif  // defined(ANGLE_USE_SSE)
+
+// The primitive restart index is the largest index of its type. It never lowers the minimum, and
+// adding one to it wraps it around to zero, so the maximum of the incremented indices is one more
+// than the maximum of the other indices. The restart indices are counted with the all-ones lanes
+// of the comparison masks, which are subtracted from per-lane counters.
+template <typename Traits>
+gl::IndexRange ComputeVectorIndexRange(const typename Traits::IndexType *indices,
+                                       size_t count,
+                                       bool primitiveRestartEnabled)
+{
+    using IndexType = typename Traits::IndexType;
+    using Vector    = typename Traits::Vector;
+
+    constexpr size_t kLanes       = Traits::kLanes;
+    constexpr IndexType kBias     = Traits::kBias;
+    constexpr IndexType kMaxIndex = std::numeric_limits<IndexType>::max();
+    // The counters are added up before any of their lanes can wrap around.
+    constexpr size_t kChunkCount = kLanes * std::min<size_t>(kMaxIndex, 0xFFFF);
+
+    const size_t vectorCount = count - count % kLanes;
+    const Vector ones        = Traits::Splat(1);
+    Vector minVector         = Traits::Splat(kMaxIndex ^ kBias);
+    Vector maxVector         = Traits::Splat(kBias);
+    size_t restartCount      = 0;
+
+    if (primitiveRestartEnabled)
+    {
+        const Vector restartVector = Traits::Splat(kMaxIndex ^ kBias);
+        for (size_t chunkBegin = 0; chunkBegin < vectorCount; chunkBegin += kChunkCount)
+        {
+            size_t chunkEnd       = std::min(vectorCount, chunkBegin + kChunkCount);
+            Vector restartCounter = Traits::Splat(0);
+            for (size_t i = chunkBegin; i < chunkEnd; i += kLanes)
+            {
+                Vector v       = Traits::Load(indices + i);
+                minVector      = Traits::Min(minVector, v);
+                maxVector      = Traits::Max(maxVector, Traits::Add(v, ones));
+                restartCounter = Traits::Subtract(restartCounter, Traits::Equal(v, restartVector));
+            }
+
+            IndexType counterLanes[kLanes];
+            Traits::Store(restartCounter, counterLanes);
+            for (IndexType laneCount : counterLanes)
+            {
+                restartCount += laneCount;
+            }
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < vectorCount; i += kLanes)
+        {
+            Vector v  = Traits::Load(indices + i);
+            minVector = Traits::Min(minVector, v);
+            maxVector = Traits::Max(maxVector, v);
+        }
+    }
+
+    IndexType minLanes[kLanes];
+    IndexType maxLanes[kLanes];
+    Traits::Store(minVector, minLanes);
+    Traits::Store(maxVector, maxLanes);
+
+    IndexType minIndex = kMaxIndex;
+    IndexType maxIndex = 0;
+    for (size_t lane = 0; lane < kLanes; ++lane)
+    {
+        minIndex = std::min(minIndex, static_cast<IndexType>(minLanes[lane] ^ kBias));
+
+        IndexType laneMax = static_cast<IndexType>(maxLanes[lane] ^ kBias);
+        if (primitiveRestartEnabled)
+        {
+            // Zero means that the lane only had restart indices.
+            if (laneMax == 0)
+            {
+                continue;
+            }
+            --laneMax;
+        }
+        maxIndex = std::max(maxIndex, laneMax);
+    }
+
+    for (size_t i = vectorCount; i < count; ++i)
+    {
+        if (primitiveRestartEnabled && indices[i] == kMaxIndex)
+        {
+            ++restartCount;
+            continue;
+        }
+        minIndex = std::min(minIndex, indices[i]);
+        maxIndex = std::max(maxIndex, indices[i]);
+    }
+
+    if (restartCount == count)
+    {
+        return gl::IndexRange();
+    }
+    return gl::IndexRange(minIndex, maxIndex, count - restartCount);
+}
+
+#endif  // defined(ANGLE_USE_SSE) || defined(ANGLE_USE_NEON)
+
 }  // anonymous namespace
 
 namespace gl
@@ -573,6 +850,27 @@ IndexRange ComputeIndexRange(GLenum indexType,
                              size_t count,
                              bool primitiveRestartEnabled)
 {
+#if defined(ANGLE_USE_SSE) || defined(ANGLE_USE_NEON)
+    if (count >= kMinVectorIndexCount && SupportsVectorIndexRange())
+    {
+        switch (indexType)
+        {
+            case GL_UNSIGNED_BYTE:
+                return ComputeVectorIndexRange<VectorIndices8>(
+                    static_cast<const GLubyte *>(indices), count, primitiveRestartEnabled);
+            case GL_UNSIGNED_SHORT:
+                return ComputeVectorIndexRange<VectorIndices16>(
+                    static_cast<const GLushort *>(indices), count, primitiveRestartEnabled);
+            case GL_UNSIGNED_INT:
+                return ComputeVectorIndexRange<VectorIndices32>(
+                    static_cast<const GLuint *>(indices), count, primitiveRestartEnabled);
+            default:
+                UNREACHABLE();
+                return IndexRange();
+        }
+    }
+#endif  // defined(ANGLE_USE_SSE) || defined(ANGLE_USE_NEON)
+
     switch (indexType)
     {
         case GL_UNSIGNED_BYTE:
@@ -593,6 +891,24 @@ IndexRange ComputeIndexRange(GLenum indexType,
     }
 }
 
+void ComputeIndexBlockRanges(GLenum indexType,
+                             const GLvoid *indices,
+                             size_t count,
+                             size_t indicesPerBlock,
+                             IndexRange *outRanges)
+{
+    ASSERT(indicesPerBlock > 0);
+
+    const uint8_t *blockIndices = static_cast<const uint8_t *>(indices);
+    size_t blockBytes           = indicesPerBlock * ElementTypeSize(indexType);
+    for (size_t first = 0; first < count; first += indicesPerBlock)
+    {
+        size_t blockCount = std::min(indicesPerBlock, count - first);
+        *outRanges++      = ComputeIndexRange(indexType, blockIndices, blockCount, true);
+        blockIndices += blockBytes;
+    }
+}
+
 GLuint GetPrimitiveRestartIndex(GLenum indexType)
 {
     switch (indexType)
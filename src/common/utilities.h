@@ -74,6 +74,14 @@ IndexRange ComputeIndexRange(GLenum indexType,
                              size_t count,
                              bool primitiveRestartEnabled);
 
+// Computes the range of each run of |indicesPerBlock| indices, with primitive restart enabled. The
+// last block is shorter if |count| isn't a multiple of |indicesPerBlock|.
+void ComputeIndexBlockRanges(GLenum indexType,
+                             const GLvoid *indices,
+                             size_t count,
+                             size_t indicesPerBlock,
+                             IndexRange *outRanges);
+
 // Get the primitive restart index value for the given index type.
 GLuint GetPrimitiveRestartIndex(GLenum indexType);
 
@@ -177,4 +177,86 @@ TEST(ParseArrayIndex, ArrayIndexOutOfRange)
     EXPECT_EQ(15u, nameLengthWithoutArrayIndex);
 }
 
+// Test that primitive restart indices are left out of the range and the count of the indices.
+TEST(ComputeIndexRange, PrimitiveRestart)
+{
+    const GLushort indices[] = {0xFFFF, 7, 3, 0xFFFF, 5};
+
+    gl::IndexRange range = gl::ComputeIndexRange(GL_UNSIGNED_SHORT, indices, 5, true);
+    EXPECT_EQ(3u, range.start);
+    EXPECT_EQ(7u, range.end);
+    EXPECT_EQ(3u, range.vertexIndexCount);
+
+    range = gl::ComputeIndexRange(GL_UNSIGNED_SHORT, indices, 5, false);
+    EXPECT_EQ(3u, range.start);
+    EXPECT_EQ(0xFFFFu, range.end);
+    EXPECT_EQ(5u, range.vertexIndexCount);
+}
+
+template <typename IndexType>
+void CheckLongIndexRanges(GLenum indexType)
+{
+    const IndexType restartIndex = std::numeric_limits<IndexType>::max();
+
+    // Long enough for the vector paths, with a remainder that doesn't fill a vector.
+    std::vector<IndexType> indices(1003);
+    for (size_t i = 0; i < indices.size(); ++i)
+    {
+        indices[i] = static_cast<IndexType>(10 + i % 100);
+    }
+    indices[500]  = 3;
+    indices[1002] = 120;
+    indices[7]    = restartIndex;
+    indices[8]    = restartIndex;
+    indices[1001] = restartIndex;
+
+    gl::IndexRange range = gl::ComputeIndexRange(indexType, indices.data(), indices.size(), true);
+    EXPECT_EQ(3u, range.start);
+    EXPECT_EQ(120u, range.end);
+    EXPECT_EQ(1000u, range.vertexIndexCount);
+
+    range = gl::ComputeIndexRange(indexType, indices.data(), indices.size(), false);
+    EXPECT_EQ(3u, range.start);
+    EXPECT_EQ(restartIndex, range.end);
+    EXPECT_EQ(1003u, range.vertexIndexCount);
+
+    std::fill(indices.begin(), indices.end(), restartIndex);
+    range = gl::ComputeIndexRange(indexType, indices.data(), indices.size(), true);
+    EXPECT_EQ(0u, range.start);
+    EXPECT_EQ(0u, range.end);
+    EXPECT_EQ(0u, range.vertexIndexCount);
+
+    indices[1000] = 0;
+    range = gl::ComputeIndexRange(indexType, indices.data(), indices.size(), true);
+    EXPECT_EQ(0u, range.start);
+    EXPECT_EQ(0u, range.end);
+    EXPECT_EQ(1u, range.vertexIndexCount);
+}
+
+// Test the ranges of runs of indices that are long enough to be scanned several at a time.
+TEST(ComputeIndexRange, LongRuns)
+{
+    CheckLongIndexRanges<GLubyte>(GL_UNSIGNED_BYTE);
+    CheckLongIndexRanges<GLushort>(GL_UNSIGNED_SHORT);
+    CheckLongIndexRanges<GLuint>(GL_UNSIGNED_INT);
+}
+
+// Test the ranges of blocks of indices, where the last block is shorter.
+TEST(ComputeIndexBlockRanges, ShortLastBlock)
+{
+    const GLubyte indices[] = {4, 2, 0xFF, 9, 0xFF, 0xFF, 1};
+
+    gl::IndexRange ranges[3];
+    gl::ComputeIndexBlockRanges(GL_UNSIGNED_BYTE, indices, 7, 3, ranges);
+    EXPECT_EQ(2u, ranges[0].start);
+    EXPECT_EQ(4u, ranges[0].end);
+    EXPECT_EQ(2u, ranges[0].vertexIndexCount);
+    EXPECT_EQ(9u, ranges[1].start);
+    EXPECT_EQ(9u, ranges[1].end);
+    EXPECT_EQ(1u, ranges[1].vertexIndexCount);
+    EXPECT_EQ(1u, ranges[2].start);
+    EXPECT_EQ(1u, ranges[2].end);
+    EXPECT_EQ(1u, ranges[2].vertexIndexCount);
+}
+
 }  // anonymous namespace
@@ -201,6 +201,7 @@ class DefinedParser : public Lexer
 
 DirectiveParser::DirectiveParser(Tokenizer *tokenizer,
                                  MacroSet *macroSet,
+                                 MacroExpansionCache *expansionCache,
                                  Diagnostics *diagnostics,
                                  DirectiveHandler *directiveHandler,
                                  int maxMacroExpansionDepth)
@@ -208,6 +209,7 @@ DirectiveParser::DirectiveParser(Tokenizer *tokenizer,
       mSeenNonPreprocessorToken(false),
       mTokenizer(tokenizer),
       mMacroSet(macroSet),
+      mExpansionCache(expansionCache),
       mDiagnostics(diagnostics),
       mDirectiveHandler(directiveHandler),
       mShaderVersion(100),
@@ -421,7 +423,10 @@ void DirectiveParser::parseDefine(Token *token)
         mDiagnostics->report(Diagnostics::PP_MACRO_REDEFINED, token->location, macro->name);
         return;
     }
-    mMacroSet->insert(std::make_pair(macro->name, macro));
+    if (mMacroSet->insert(std::make_pair(macro->name, macro)).second)
+    {
+        clearExpansionCache();
+    }
 }
 
 void DirectiveParser::parseUndef(Token *token)
@@ -453,6 +458,7 @@ void DirectiveParser::parseUndef(Token *token)
         else
         {
             mMacroSet->erase(iter);
+            clearExpansionCache();
         }
     }
 
@@ -829,6 +835,7 @@ void DirectiveParser::parseVersion(Token *token)
         mDirectiveHandler->handleVersion(token->location, version);
         mShaderVersion = version;
         PredefineMacro(mMacroSet, "__VERSION__", version);
+        clearExpansionCache();
     }
 }
 
@@ -840,7 +847,8 @@ void DirectiveParser::parseLine(Token *token)
     bool parsedFileNumber = false;
     int line = 0, file = 0;
 
-    MacroExpander macroExpander(mTokenizer, mMacroSet, mDiagnostics, mMaxMacroExpansionDepth);
+    MacroExpander macroExpander(mTokenizer, mMacroSet, mExpansionCache, mDiagnostics,
+                                mMaxMacroExpansionDepth);
 
     // Lex the first token after "#line" so we can check it for EOD.
     macroExpander.lex(token);
@@ -894,6 +902,15 @@ void DirectiveParser::parseLine(Token *token)
     }
 }
 
+void DirectiveParser::clearExpansionCache()
+{
+    // Cached expansions may depend on any of the macros.
+    if (mExpansionCache)
+    {
+        mExpansionCache->clear();
+    }
+}
+
 bool DirectiveParser::skipping() const
 {
     if (mConditionalStack.empty())
@@ -949,7 +966,8 @@ int DirectiveParser::parseExpressionIf(Token *token)
     ASSERT((getDirective(token) == DIRECTIVE_IF) || (getDirective(token) == DIRECTIVE_ELIF));
 
     DefinedParser definedParser(mTokenizer, mMacroSet, mDiagnostics);
-    MacroExpander macroExpander(&definedParser, mMacroSet, mDiagnostics, mMaxMacroExpansionDepth);
+    MacroExpander macroExpander(&definedParser, mMacroSet, mExpansionCache, mDiagnostics,
+                                mMaxMacroExpansionDepth);
     ExpressionParser expressionParser(&macroExpander, mDiagnostics);
 
     int expression = 0;
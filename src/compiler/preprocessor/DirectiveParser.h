@@ -16,13 +16,16 @@ namespace pp
 
 class Diagnostics;
 class DirectiveHandler;
+class MacroExpansionCache;
 class Tokenizer;
 
 class DirectiveParser : public Lexer
 {
   public:
+    // The expansion cache is optional.
     DirectiveParser(Tokenizer *tokenizer,
                     MacroSet *macroSet,
+                    MacroExpansionCache *expansionCache,
                     Diagnostics *diagnostics,
                     DirectiveHandler *directiveHandler,
                     int maxMacroExpansionDepth);
@@ -46,6 +49,7 @@ class DirectiveParser : public Lexer
     void parseVersion(Token *token);
     void parseLine(Token *token);
 
+    void clearExpansionCache();
     bool skipping() const;
     void parseConditionalIf(Token *token);
     int parseExpressionIf(Token *token);
@@ -72,6 +76,7 @@ class DirectiveParser : public Lexer
     std::vector<ConditionalBlock> mConditionalStack;
     Tokenizer *mTokenizer;
     MacroSet *mMacroSet;
+    MacroExpansionCache *mExpansionCache;
     Diagnostics *mDiagnostics;
     DirectiveHandler *mDirectiveHandler;
     int mShaderVersion;
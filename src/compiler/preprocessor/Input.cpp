@@ -100,7 +100,7 @@ size_t Input::read(char *buf, size_t maxSize, int *lineNo)
     while ((nRead < maxRead) && (mReadLoc.sIndex < mCount))
     {
         size_t size = mLength[mReadLoc.sIndex] - mReadLoc.cIndex;
-        size        = std::min(size, maxSize);
+        size        = std::min(size, maxSize - nRead);
         for (size_t i = 0; i < size; ++i)
         {
             // Stop if a possible line continuation is encountered.
@@ -20,6 +20,21 @@ namespace
 
 const size_t kMaxContextTokens = 10000;
 
+// The cache is cleared when it would grow past this many tokens.
+const size_t kMaxCachedTokens = 100000;
+
+// Most keys fit in this many bytes without reallocating.
+const size_t kKeyReserveSize = 256;
+
+// The keys seen only once are forgotten when there are more than this many of them.
+const size_t kMaxSeenKeys = 10000;
+
+template <typename T>
+void AppendToKey(std::string *key, const T &value)
+{
+    key->append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
 class TokenLexer : public Lexer
 {
   public:
@@ -51,6 +66,104 @@ class TokenLexer : public Lexer
 
 }  // anonymous namespace
 
+MacroExpansionCache::MacroExpansionCache() : mCachedTokenCount(0), mUncacheableCount(0)
+{
+}
+
+MacroExpansionCache::~MacroExpansionCache()
+{
+}
+
+void MacroExpansionCache::clear()
+{
+    mEntries.clear();
+    mSeenKeys.clear();
+    mCachedTokenCount = 0;
+}
+
+void MacroExpansionCache::addDisabledMacro(const Macro *macro)
+{
+    // The disabled macros are kept sorted so that they can be added to the key as is.
+    auto iter = std::lower_bound(mDisabledMacros.begin(), mDisabledMacros.end(), macro);
+    ASSERT(iter == mDisabledMacros.end() || *iter != macro);
+    mDisabledMacros.insert(iter, macro);
+}
+
+void MacroExpansionCache::removeDisabledMacro(const Macro *macro)
+{
+    auto iter = std::lower_bound(mDisabledMacros.begin(), mDisabledMacros.end(), macro);
+    ASSERT(iter != mDisabledMacros.end() && *iter == macro);
+    mDisabledMacros.erase(iter);
+}
+
+void MacroExpansionCache::makeKey(const Macro &macro,
+                                  int allowedMacroExpansionDepth,
+                                  const MacroArgs &args,
+                                  Key *keyOut) const
+{
+    std::string *data = &keyOut->data;
+    data->clear();
+    data->reserve(kKeyReserveSize);
+    // The cache is cleared whenever the macro set changes, so macros can be identified by their
+    // address.
+    AppendToKey(data, &macro);
+    AppendToKey(data, allowedMacroExpansionDepth);
+    AppendToKey(data, mDisabledMacros.size());
+    for (const Macro *disabledMacro : mDisabledMacros)
+    {
+        AppendToKey(data, disabledMacro);
+    }
+    // Token locations only affect the expansion through the __LINE__ and __FILE__ macros, which
+    // make the expansion uncacheable.
+    for (const std::vector<Token> &arg : args)
+    {
+        AppendToKey(data, arg.size());
+        for (const Token &token : arg)
+        {
+            const int tokenHeader[] = {token.type, static_cast<int>(token.flags),
+                                       static_cast<int>(token.text.size())};
+            AppendToKey(data, tokenHeader);
+            data->append(token.text);
+        }
+    }
+    keyOut->hash = std::hash<std::string>()(*data);
+}
+
+const MacroExpansionCache::Entry *MacroExpansionCache::find(const Key &key) const
+{
+    if (mSeenKeys.count(key.hash) == 0)
+    {
+        return nullptr;
+    }
+    auto iter = mEntries.find(key.data);
+    return iter != mEntries.end() ? &iter->second : nullptr;
+}
+
+void MacroExpansionCache::insert(const Key &key,
+                                 const std::vector<Token> &replacements,
+                                 size_t argTokenCount)
+{
+    // Most invocations are never repeated, so storing the expansion only pays off once the same
+    // invocation has been seen before. Until then, just the hash of the key is remembered.
+    if (mSeenKeys.size() >= kMaxSeenKeys)
+    {
+        mSeenKeys.clear();
+    }
+    if (mSeenKeys.insert(key.hash).second)
+    {
+        return;
+    }
+
+    if (mCachedTokenCount + replacements.size() > kMaxCachedTokens)
+    {
+        clear();
+    }
+    Entry &entry        = mEntries[key.data];
+    mCachedTokenCount   = mCachedTokenCount - entry.replacements.size() + replacements.size();
+    entry.replacements  = replacements;
+    entry.argTokenCount = argTokenCount;
+}
+
 class MacroExpander::ScopedMacroReenabler final : angle::NonCopyable
 {
   public:
@@ -75,17 +188,19 @@ MacroExpander::ScopedMacroReenabler::~ScopedMacroReenabler()
         // Copying the string here by using substr is a check for use-after-free. It detects
         // use-after-free more reliably than just toggling the disabled flag.
         ASSERT(macro->name.substr() != "");
-        macro->disabled = false;
+        mExpander->setMacroDisabled(*macro, false);
     }
     mExpander->mMacrosToReenable.clear();
 }
 
 MacroExpander::MacroExpander(Lexer *lexer,
                              MacroSet *macroSet,
+                             MacroExpansionCache *expansionCache,
                              Diagnostics *diagnostics,
                              int allowedMacroExpansionDepth)
     : mLexer(lexer),
       mMacroSet(macroSet),
+      mExpansionCache(expansionCache),
       mDiagnostics(diagnostics),
       mTotalTokensInContexts(0),
       mAllowedMacroExpansionDepth(allowedMacroExpansionDepth),
@@ -205,7 +320,7 @@ bool MacroExpander::pushMacro(std::shared_ptr<Macro> macro, const Token &identif
         return false;
 
     // Macro is disabled for expansion until it is popped off the stack.
-    macro->disabled = true;
+    setMacroDisabled(*macro, true);
 
     MacroContext *context = new MacroContext;
     context->macro        = macro;
@@ -231,13 +346,38 @@ void MacroExpander::popMacro()
     }
     else
     {
-        context->macro->disabled = false;
+        setMacroDisabled(*context->macro, false);
     }
     context->macro->expansionCount--;
     mTotalTokensInContexts -= context->replacements.size();
     delete context;
 }
 
+void MacroExpander::setMacroDisabled(const Macro &macro, bool disabled)
+{
+    ASSERT(macro.disabled != disabled);
+    macro.disabled = disabled;
+    if (mExpansionCache)
+    {
+        if (disabled)
+        {
+            mExpansionCache->addDisabledMacro(&macro);
+        }
+        else
+        {
+            mExpansionCache->removeDisabledMacro(&macro);
+        }
+    }
+}
+
+void MacroExpander::markExpansionUncacheable()
+{
+    if (mExpansionCache)
+    {
+        mExpansionCache->markUncacheable();
+    }
+}
+
 bool MacroExpander::expandMacro(const Macro &macro,
                                 const Token &identifier,
                                 std::vector<Token> *replacements)
@@ -263,10 +403,12 @@ bool MacroExpander::expandMacro(const Macro &macro,
             if (macro.name == kLine)
             {
                 repl.text = ToString(identifier.location.line);
+                markExpansionUncacheable();
             }
             else if (macro.name == kFile)
             {
                 repl.text = ToString(identifier.location.file);
+                markExpansionUncacheable();
             }
         }
     }
@@ -275,10 +417,48 @@ bool MacroExpander::expandMacro(const Macro &macro,
         ASSERT(macro.type == Macro::kTypeFunc);
         std::vector<MacroArg> args;
         args.reserve(macro.parameters.size());
-        if (!collectMacroArgs(macro, identifier, &args, &replacementLocation))
+
+        // Defer reenabling macros until the args are collected and expanded to avoid the
+        // possibility of infinite recursion. Otherwise infinite recursion might happen when
+        // expanding the args after macros have been popped from the context stack when parsing the
+        // args.
+        ScopedMacroReenabler deferReenablingMacros(this);
+
+        Token closingParenthesis;
+        if (!collectMacroArgs(macro, identifier, &args, &closingParenthesis))
             return false;
+        replacementLocation = closingParenthesis.location;
+
+        // Substituting arguments that don't contain any macros is cheaper than looking up the
+        // cache, so only invocations that have macros in the arguments are cached. The cached
+        // expansion can only be used if expanding again wouldn't run out of memory.
+        bool cacheable = mExpansionCache && argsContainMacros(args);
+        MacroExpansionCache::Key cacheKey;
+        const MacroExpansionCache::Entry *cached = nullptr;
+        if (cacheable)
+        {
+            mExpansionCache->makeKey(macro, mAllowedMacroExpansionDepth, args, &cacheKey);
+            cached = mExpansionCache->find(cacheKey);
+        }
+        if (cached && cached->argTokenCount + mTotalTokensInContexts <= kMaxContextTokens &&
+            cached->replacements.size() + mTotalTokensInContexts <= kMaxContextTokens)
+        {
+            replacements->assign(cached->replacements.begin(), cached->replacements.end());
+        }
+        else
+        {
+            size_t uncacheableCount = cacheable ? mExpansionCache->getUncacheableCount() : 0;
 
-        replaceMacroParams(macro, args, replacements);
+            size_t argTokenCount = 0;
+            if (!expandMacroArgs(closingParenthesis, &args, &argTokenCount))
+                return false;
+            replaceMacroParams(macro, args, replacements);
+
+            if (cacheable && mExpansionCache->getUncacheableCount() == uncacheableCount)
+            {
+                mExpansionCache->insert(cacheKey, *replacements, argTokenCount);
+            }
+        }
     }
 
     for (std::size_t i = 0; i < replacements->size(); ++i)
@@ -299,7 +479,7 @@ bool MacroExpander::expandMacro(const Macro &macro,
 bool MacroExpander::collectMacroArgs(const Macro &macro,
                                      const Token &identifier,
                                      std::vector<MacroArg> *args,
-                                     SourceLocation *closingParenthesisLocation)
+                                     Token *closingParenthesis)
 {
     Token token;
     getToken(&token);
@@ -307,11 +487,6 @@ bool MacroExpander::collectMacroArgs(const Macro &macro,
 
     args->push_back(MacroArg());
 
-    // Defer reenabling macros until args collection is finished to avoid the possibility of
-    // infinite recursion. Otherwise infinite recursion might happen when expanding the args after
-    // macros have been popped from the context stack when parsing the args.
-    ScopedMacroReenabler deferReenablingMacros(this);
-
     int openParens = 1;
     while (openParens != 0)
     {
@@ -321,6 +496,7 @@ bool MacroExpander::collectMacroArgs(const Macro &macro,
         {
             mDiagnostics->report(Diagnostics::PP_MACRO_UNTERMINATED_INVOCATION, identifier.location,
                                  identifier.text);
+            markExpansionUncacheable();
             // Do not lose EOF token.
             ungetToken(token);
             return false;
@@ -335,8 +511,7 @@ bool MacroExpander::collectMacroArgs(const Macro &macro,
                 break;
             case ')':
                 --openParens;
-                isArg                       = openParens != 0;
-                *closingParenthesisLocation = token.location;
+                isArg = openParens != 0;
                 break;
             case ',':
                 // The individual arguments are separated by comma tokens, but
@@ -373,12 +548,37 @@ bool MacroExpander::collectMacroArgs(const Macro &macro,
                                  ? Diagnostics::PP_MACRO_TOO_FEW_ARGS
                                  : Diagnostics::PP_MACRO_TOO_MANY_ARGS;
         mDiagnostics->report(id, identifier.location, identifier.text);
+        markExpansionUncacheable();
         return false;
     }
 
+    *closingParenthesis = token;
+    return true;
+}
+
+bool MacroExpander::argsContainMacros(const std::vector<MacroArg> &args) const
+{
+    for (const MacroArg &arg : args)
+    {
+        for (const Token &token : arg)
+        {
+            if (token.type == Token::IDENTIFIER && mMacroSet->find(token.text) != mMacroSet->end())
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool MacroExpander::expandMacroArgs(const Token &closingParenthesis,
+                                    std::vector<MacroArg> *args,
+                                    size_t *argTokenCount)
+{
     // Pre-expand each argument before substitution.
     // This step expands each argument individually before they are
     // inserted into the macro body.
+    Token token      = closingParenthesis;
     size_t numTokens = 0;
     for (auto &arg : *args)
     {
@@ -387,9 +587,11 @@ bool MacroExpander::collectMacroArgs(const Macro &macro,
         {
             mDiagnostics->report(Diagnostics::PP_MACRO_INVOCATION_CHAIN_TOO_DEEP, token.location,
                                  token.text);
+            markExpansionUncacheable();
             return false;
         }
-        MacroExpander expander(&lexer, mMacroSet, mDiagnostics, mAllowedMacroExpansionDepth - 1);
+        MacroExpander expander(&lexer, mMacroSet, mExpansionCache, mDiagnostics,
+                               mAllowedMacroExpansionDepth - 1);
 
         arg.clear();
         expander.lex(&token);
@@ -401,10 +603,12 @@ bool MacroExpander::collectMacroArgs(const Macro &macro,
             if (numTokens + mTotalTokensInContexts > kMaxContextTokens)
             {
                 mDiagnostics->report(Diagnostics::PP_OUT_OF_MEMORY, token.location, token.text);
+                markExpansionUncacheable();
                 return false;
             }
         }
     }
+    *argTokenCount = numTokens;
     return true;
 }
 
@@ -419,6 +623,7 @@ void MacroExpander::replaceMacroParams(const Macro &macro,
         {
             const Token &token = replacements->back();
             mDiagnostics->report(Diagnostics::PP_OUT_OF_MEMORY, token.location, token.text);
+            markExpansionUncacheable();
             return;
         }
 
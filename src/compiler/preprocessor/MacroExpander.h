@@ -8,10 +8,14 @@
 #define COMPILER_PREPROCESSOR_MACROEXPANDER_H_
 
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "compiler/preprocessor/Lexer.h"
 #include "compiler/preprocessor/Macro.h"
+#include "compiler/preprocessor/Token.h"
 
 namespace pp
 {
@@ -19,11 +23,71 @@ namespace pp
 class Diagnostics;
 struct SourceLocation;
 
+// Remembers the replacement lists that function-like macro invocations expanded to, so that
+// invoking a macro again with the same arguments doesn't need to expand the arguments and
+// substitute them into the replacement list again. How the arguments expand depends on which
+// macros are defined, so the cache must be cleared whenever a macro is defined or undefined. It
+// also depends on which macros are disabled for expansion at the time, so those are part of the
+// key.
+class MacroExpansionCache : angle::NonCopyable
+{
+  public:
+    typedef std::vector<std::vector<Token>> MacroArgs;
+
+    struct Key
+    {
+        std::string data;
+        size_t hash;
+    };
+
+    struct Entry
+    {
+        std::vector<Token> replacements;
+        // The number of tokens the arguments expanded to.
+        size_t argTokenCount;
+    };
+
+    MacroExpansionCache();
+    ~MacroExpansionCache();
+
+    // Forgets all cached expansions.
+    void clear();
+
+    void addDisabledMacro(const Macro *macro);
+    void removeDisabledMacro(const Macro *macro);
+
+    // Expansions that depend on anything that is not part of the key, such as the location of
+    // the invocation, must not be cached. They are detected by checking if the uncacheable count
+    // changed while expanding.
+    void markUncacheable() { ++mUncacheableCount; }
+    size_t getUncacheableCount() const { return mUncacheableCount; }
+
+    void makeKey(const Macro &macro,
+                 int allowedMacroExpansionDepth,
+                 const MacroArgs &args,
+                 Key *keyOut) const;
+    const Entry *find(const Key &key) const;
+    void insert(const Key &key,
+                const std::vector<Token> &replacements,
+                size_t argTokenCount);
+
+  private:
+    std::unordered_map<std::string, Entry> mEntries;
+    // Hashes of the keys that have been inserted at least once.
+    std::unordered_set<size_t> mSeenKeys;
+    size_t mCachedTokenCount;
+
+    std::vector<const Macro *> mDisabledMacros;
+    size_t mUncacheableCount;
+};
+
 class MacroExpander : public Lexer
 {
   public:
+    // The expansion cache is optional.
     MacroExpander(Lexer *lexer,
                   MacroSet *macroSet,
+                  MacroExpansionCache *expansionCache,
                   Diagnostics *diagnostics,
                   int allowedMacroExpansionDepth);
     ~MacroExpander() override;
@@ -37,6 +101,8 @@ class MacroExpander : public Lexer
 
     bool pushMacro(std::shared_ptr<Macro> macro, const Token &identifier);
     void popMacro();
+    void setMacroDisabled(const Macro &macro, bool disabled);
+    void markExpansionUncacheable();
 
     bool expandMacro(const Macro &macro, const Token &identifier, std::vector<Token> *replacements);
 
@@ -44,7 +110,11 @@ class MacroExpander : public Lexer
     bool collectMacroArgs(const Macro &macro,
                           const Token &identifier,
                           std::vector<MacroArg> *args,
-                          SourceLocation *closingParenthesisLocation);
+                          Token *closingParenthesis);
+    bool argsContainMacros(const std::vector<MacroArg> &args) const;
+    bool expandMacroArgs(const Token &closingParenthesis,
+                         std::vector<MacroArg> *args,
+                         size_t *argTokenCount);
     void replaceMacroParams(const Macro &macro,
                             const std::vector<MacroArg> &args,
                             std::vector<Token> *replacements);
@@ -64,6 +134,7 @@ class MacroExpander : public Lexer
 
     Lexer *mLexer;
     MacroSet *mMacroSet;
+    MacroExpansionCache *mExpansionCache;
     Diagnostics *mDiagnostics;
 
     std::unique_ptr<Token> mReserveToken;
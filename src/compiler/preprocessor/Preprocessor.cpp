@@ -21,6 +21,7 @@ struct PreprocessorImpl
 {
     Diagnostics *diagnostics;
     MacroSet macroSet;
+    MacroExpansionCache expansionCache;
     Tokenizer tokenizer;
     DirectiveParser directiveParser;
     MacroExpander macroExpander;
@@ -32,10 +33,15 @@ struct PreprocessorImpl
           tokenizer(diag),
           directiveParser(&tokenizer,
                           &macroSet,
+                          settings.cacheMacroExpansions ? &expansionCache : nullptr,
                           diag,
                           directiveHandler,
                           settings.maxMacroExpansionDepth),
-          macroExpander(&directiveParser, &macroSet, diag, settings.maxMacroExpansionDepth)
+          macroExpander(&directiveParser,
+                        &macroSet,
+                        settings.cacheMacroExpansions ? &expansionCache : nullptr,
+                        diag,
+                        settings.maxMacroExpansionDepth)
     {
     }
 };
@@ -68,6 +74,7 @@ bool Preprocessor::init(size_t count, const char *const string[], const int leng
 void Preprocessor::predefineMacro(const char *name, int value)
 {
     PredefineMacro(&mImpl->macroSet, name, value);
+    mImpl->expansionCache.clear();
 }
 
 void Preprocessor::lex(Token *token)
@@ -21,8 +21,10 @@ struct Token;
 
 struct PreprocessorSettings : private angle::NonCopyable
 {
-    PreprocessorSettings() : maxMacroExpansionDepth(1000) {}
+    PreprocessorSettings() : maxMacroExpansionDepth(1000), cacheMacroExpansions(true) {}
     int maxMacroExpansionDepth;
+    // Reuse the expansion of function-like macro invocations that have the same arguments.
+    bool cacheMacroExpansions;
 };
 
 class Preprocessor : angle::NonCopyable
@@ -7,32 +7,24 @@
 #ifndef COMPILER_PREPROCESSOR_TOKENIZER_H_
 #define COMPILER_PREPROCESSOR_TOKENIZER_H_
 
+#include <vector>
+
 #include "common/angleutils.h"
 #include "compiler/preprocessor/Input.h"
 #include "compiler/preprocessor/Lexer.h"
+#include "compiler/preprocessor/SourceLocation.h"
 
 namespace pp
 {
 
 class Diagnostics;
 
+// Hand-written scanner for preprocessing tokens. Characters are classified with a lookup table, so
+// runs of whitespace, comment text, identifier characters and digits are each skipped with a
+// single loop over the input buffer.
 class Tokenizer : public Lexer
 {
   public:
-    struct Context
-    {
-        Diagnostics *diagnostics;
-
-        Input input;
-        // The location where yytext points to. Token location should track
-        // scanLoc instead of Input::mReadLoc because they may not be the same
-        // if text is buffered up in the scanner input buffer.
-        Input::Location scanLoc;
-
-        bool leadingSpace;
-        bool lineStart;
-    };
-
     Tokenizer(Diagnostics *diagnostics);
     ~Tokenizer() override;
 
@@ -45,11 +37,49 @@ class Tokenizer : public Lexer
     void lex(Token *token) override;
 
   private:
-    bool initScanner();
-    void destroyScanner();
+    // Scans the next token, skipping whitespace and comments. Returns the token type.
+    int scan(Token *token);
+    int scanNumber(Token *token);
+    int scanNewline(Token *token, int c);
+    int scanEndOfInput(Token *token);
+
+    // Returns the character at the given offset from the scan position, reading more input if
+    // necessary. Returns a negative value if the input runs out before that.
+    int peek(size_t offset);
+    // Returns the offset of the first character at or after the given offset whose class, masked
+    // with charClass, isn't equal to match.
+    size_t skip(size_t offset, unsigned char charClass, unsigned char match);
+    // Returns the offset after an exponent part starting at the given offset, or 0 if there isn't
+    // one.
+    size_t skipExponent(size_t offset);
+    bool readMore();
+
+    // Sets the token text and moves past it.
+    int emit(Token *token, int type, size_t length);
+    // Moves the scan position past a piece of input that was matched, and sets location to where
+    // it starts.
+    void consume(size_t length, SourceLocation *location);
+
+    Diagnostics *mDiagnostics;
+
+    Input mInput;
+    // The location in the input of the scan position. Token locations track this instead of the
+    // read location of mInput because text may be buffered up ahead of the scan position.
+    Input::Location mScanLoc;
+
+    // Input that has been read with line continuations removed. Everything before mScanPos has
+    // been scanned already.
+    std::vector<char> mBuffer;
+    size_t mScanPos;
+    size_t mBufferEnd;
+    bool mEndOfInput;
+
+    int mFileNumber;
+    int mLineNumber;
+    bool mInComment;
+    bool mLeadingSpace;
+    bool mLineStart;
 
-    void *mHandle;         // Scanner handle.
-    Context mContext;      // Scanner extra.
     size_t mMaxTokenSize;  // Maximum token size
 };
 
@@ -0,0 +1,434 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BuildSPIRV: Helpers for writing SPIR-V modules. Types and constants are deduplicated, and the
+//   instructions are collected in one blob per section of the SPIR-V logical layout so that they
+//   can be written in any order and joined when the module is finished.
+//   See: https://www.khronos.org/registry/spir-v/specs/1.0/SPIRV.html
+//
+
+#include "compiler/translator/BuildSPIRV.h"
+
+#include <string.h>
+
+#include <algorithm>
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+
+namespace sh
+{
+
+namespace spirv
+{
+
+size_t BeginInstruction(Blob *blob, Op op)
+{
+    blob->push_back(op);
+    return blob->size() - 1;
+}
+
+void EndInstruction(Blob *blob, size_t start)
+{
+    size_t wordCount = blob->size() - start;
+    ASSERT(wordCount <= 0xFFFF);
+    (*blob)[start] |= static_cast<uint32_t>(wordCount) << 16;
+}
+
+void WriteString(Blob *blob, const char *str)
+{
+    // The string is nul-terminated, and padded with nul characters to a whole number of words.
+    size_t length    = strlen(str);
+    size_t wordCount = length / 4 + 1;
+    size_t start     = blob->size();
+    blob->resize(start + wordCount, 0);
+    memcpy(&(*blob)[start], str, length);
+}
+
+void WriteInstruction(Blob *blob, Op op, std::initializer_list<uint32_t> operands)
+{
+    blob->push_back(static_cast<uint32_t>(operands.size() + 1) << 16 | op);
+    blob->insert(blob->end(), operands.begin(), operands.end());
+}
+
+void WriteInstruction(Blob *blob,
+                      Op op,
+                      std::initializer_list<uint32_t> operands,
+                      const std::vector<IdRef> &moreOperands)
+{
+    blob->push_back(static_cast<uint32_t>(operands.size() + moreOperands.size() + 1) << 16 | op);
+    blob->insert(blob->end(), operands.begin(), operands.end());
+    blob->insert(blob->end(), moreOperands.begin(), moreOperands.end());
+}
+
+}  // namespace spirv
+
+namespace
+{
+
+constexpr uint32_t kDim2D   = 1;
+constexpr uint32_t kDim3D   = 2;
+constexpr uint32_t kDimCube = 3;
+
+constexpr uint32_t kAddressingModelLogical = 0;
+constexpr uint32_t kMemoryModelGLSL450     = 1;
+
+}  // anonymous namespace
+
+SPIRVBuilder::SPIRVBuilder() : mNextId(1), mGLSLstd450(0)
+{
+}
+
+spirv::IdRef SPIRVBuilder::getVoidType()
+{
+    return getDeclaration(spirv::OpTypeVoid, {});
+}
+
+spirv::IdRef SPIRVBuilder::getBasicType(TBasicType type, int vectorSize)
+{
+    if (vectorSize > 1)
+    {
+        return getDeclaration(spirv::OpTypeVector,
+                              {getBasicType(type, 1), static_cast<uint32_t>(vectorSize)});
+    }
+
+    switch (type)
+    {
+        case EbtFloat:
+            return getDeclaration(spirv::OpTypeFloat, {32});
+        case EbtInt:
+            return getDeclaration(spirv::OpTypeInt, {32, 1});
+        case EbtUInt:
+            return getDeclaration(spirv::OpTypeInt, {32, 0});
+        case EbtBool:
+            return getDeclaration(spirv::OpTypeBool, {});
+        default:
+            UNREACHABLE();
+            return 0;
+    }
+}
+
+spirv::IdRef SPIRVBuilder::getMatrixType(int columns, int rows)
+{
+    return getDeclaration(spirv::OpTypeMatrix,
+                          {getBasicType(EbtFloat, rows), static_cast<uint32_t>(columns)});
+}
+
+spirv::IdRef SPIRVBuilder::getArrayType(spirv::IdRef elementType,
+                                        unsigned int arraySize,
+                                        int arrayStride)
+{
+    spirv::IdRef length = getUintConstant(arraySize);
+
+    // Arrays with different strides are different types, even though the instruction declaring
+    // them is the same.
+    std::vector<uint32_t> key = {spirv::OpTypeArray, elementType, length,
+                                 static_cast<uint32_t>(arrayStride)};
+    auto iter = mDeclarations.find(key);
+    if (iter != mDeclarations.end())
+    {
+        return iter->second;
+    }
+
+    spirv::IdRef id = getNewId();
+    spirv::WriteInstruction(&mTypesAndGlobals, spirv::OpTypeArray, {id, elementType, length});
+    if (arrayStride > 0)
+    {
+        addDecoration(id, spirv::DecorationArrayStride, {static_cast<uint32_t>(arrayStride)});
+    }
+    mDeclarations[key] = id;
+    return id;
+}
+
+spirv::IdRef SPIRVBuilder::getSampledImageType(TBasicType samplerType)
+{
+    TBasicType sampledType = EbtFloat;
+    uint32_t dim           = kDim2D;
+    uint32_t arrayed       = 0;
+
+    switch (samplerType)
+    {
+        case EbtSampler2D:
+            break;
+        case EbtSampler3D:
+            dim = kDim3D;
+            break;
+        case EbtSamplerCube:
+            dim = kDimCube;
+            break;
+        case EbtSampler2DArray:
+            arrayed = 1;
+            break;
+        case EbtISampler2D:
+            sampledType = EbtInt;
+            break;
+        case EbtISampler3D:
+            sampledType = EbtInt;
+            dim         = kDim3D;
+            break;
+        case EbtISamplerCube:
+            sampledType = EbtInt;
+            dim         = kDimCube;
+            break;
+        case EbtISampler2DArray:
+            sampledType = EbtInt;
+            arrayed     = 1;
+            break;
+        case EbtUSampler2D:
+            sampledType = EbtUInt;
+            break;
+        case EbtUSampler3D:
+            sampledType = EbtUInt;
+            dim         = kDim3D;
+            break;
+        case EbtUSamplerCube:
+            sampledType = EbtUInt;
+            dim         = kDimCube;
+            break;
+        case EbtUSampler2DArray:
+            sampledType = EbtUInt;
+            arrayed     = 1;
+            break;
+        default:
+            UNREACHABLE();
+            return 0;
+    }
+
+    // Not a depth image, not multisampled, used with a sampler, and of unknown format.
+    spirv::IdRef imageType = getDeclaration(
+        spirv::OpTypeImage, {getBasicType(sampledType, 1), dim, 0, arrayed, 0, 1, 0});
+    return getDeclaration(spirv::OpTypeSampledImage, {imageType});
+}
+
+spirv::IdRef SPIRVBuilder::getPointerType(spirv::IdRef type, spirv::StorageClass storageClass)
+{
+    return getDeclaration(spirv::OpTypePointer, {storageClass, type});
+}
+
+spirv::IdRef SPIRVBuilder::getFunctionType(spirv::IdRef returnType,
+                                           const std::vector<spirv::IdRef> &parameterTypes)
+{
+    return getDeclaration(spirv::OpTypeFunction, {returnType}, parameterTypes);
+}
+
+spirv::IdRef SPIRVBuilder::addStructType(const std::vector<spirv::IdRef> &memberTypes)
+{
+    spirv::IdRef id = getNewId();
+    spirv::WriteInstruction(&mTypesAndGlobals, spirv::OpTypeStruct, {id}, memberTypes);
+    return id;
+}
+
+spirv::IdRef SPIRVBuilder::getBoolConstant(bool value)
+{
+    spirv::IdRef boolType = getBasicType(EbtBool, 1);
+    return getDeclaration(value ? spirv::OpConstantTrue : spirv::OpConstantFalse, {boolType});
+}
+
+spirv::IdRef SPIRVBuilder::getIntConstant(int32_t value)
+{
+    return getDeclaration(spirv::OpConstant,
+                          {getBasicType(EbtInt, 1), static_cast<uint32_t>(value)});
+}
+
+spirv::IdRef SPIRVBuilder::getUintConstant(uint32_t value)
+{
+    return getDeclaration(spirv::OpConstant, {getBasicType(EbtUInt, 1), value});
+}
+
+spirv::IdRef SPIRVBuilder::getFloatConstant(float value)
+{
+    return getDeclaration(spirv::OpConstant,
+                          {getBasicType(EbtFloat, 1), gl::bitCast<uint32_t>(value)});
+}
+
+spirv::IdRef SPIRVBuilder::getCompositeConstant(spirv::IdRef type,
+                                                const std::vector<spirv::IdRef> &constituents)
+{
+    return getDeclaration(spirv::OpConstantComposite, {type}, constituents);
+}
+
+spirv::IdRef SPIRVBuilder::getUndef(spirv::IdRef type)
+{
+    return getDeclaration(spirv::OpUndef, {type});
+}
+
+spirv::IdRef SPIRVBuilder::addGlobalVariable(spirv::IdRef type,
+                                             spirv::StorageClass storageClass,
+                                             spirv::IdRef initializer)
+{
+    spirv::IdRef id          = getNewId();
+    spirv::IdRef pointerType = getPointerType(type, storageClass);
+    if (initializer != 0)
+    {
+        spirv::WriteInstruction(&mTypesAndGlobals, spirv::OpVariable,
+                                {pointerType, id, storageClass, initializer});
+    }
+    else
+    {
+        spirv::WriteInstruction(&mTypesAndGlobals, spirv::OpVariable,
+                                {pointerType, id, storageClass});
+    }
+    return id;
+}
+
+spirv::IdRef SPIRVBuilder::getGLSLstd450()
+{
+    if (mGLSLstd450 == 0)
+    {
+        mGLSLstd450 = getNewId();
+    }
+    return mGLSLstd450;
+}
+
+void SPIRVBuilder::addName(spirv::IdRef target, const char *name)
+{
+    size_t start = spirv::BeginInstruction(&mDebugNames, spirv::OpName);
+    mDebugNames.push_back(target);
+    spirv::WriteString(&mDebugNames, name);
+    spirv::EndInstruction(&mDebugNames, start);
+}
+
+void SPIRVBuilder::addMemberName(spirv::IdRef structType, uint32_t member, const char *name)
+{
+    size_t start = spirv::BeginInstruction(&mDebugNames, spirv::OpMemberName);
+    mDebugNames.push_back(structType);
+    mDebugNames.push_back(member);
+    spirv::WriteString(&mDebugNames, name);
+    spirv::EndInstruction(&mDebugNames, start);
+}
+
+void SPIRVBuilder::addDecoration(spirv::IdRef target,
+                                 spirv::Decoration decoration,
+                                 std::initializer_list<uint32_t> operands)
+{
+    size_t start = spirv::BeginInstruction(&mDecorations, spirv::OpDecorate);
+    mDecorations.push_back(target);
+    mDecorations.push_back(decoration);
+    mDecorations.insert(mDecorations.end(), operands.begin(), operands.end());
+    spirv::EndInstruction(&mDecorations, start);
+}
+
+void SPIRVBuilder::addMemberDecoration(spirv::IdRef structType,
+                                       uint32_t member,
+                                       spirv::Decoration decoration,
+                                       std::initializer_list<uint32_t> operands)
+{
+    size_t start = spirv::BeginInstruction(&mDecorations, spirv::OpMemberDecorate);
+    mDecorations.push_back(structType);
+    mDecorations.push_back(member);
+    mDecorations.push_back(decoration);
+    mDecorations.insert(mDecorations.end(), operands.begin(), operands.end());
+    spirv::EndInstruction(&mDecorations, start);
+}
+
+void SPIRVBuilder::addExecutionMode(spirv::ExecutionMode executionMode)
+{
+    if (std::find(mExecutionModes.begin(), mExecutionModes.end(), executionMode) ==
+        mExecutionModes.end())
+    {
+        mExecutionModes.push_back(executionMode);
+    }
+}
+
+void SPIRVBuilder::addFunction(const spirv::Blob &function)
+{
+    mFunctions.insert(mFunctions.end(), function.begin(), function.end());
+}
+
+void SPIRVBuilder::finish(spirv::ExecutionModel executionModel,
+                          spirv::IdRef entryPoint,
+                          const std::vector<spirv::IdRef> &interfaceVariables,
+                          int shaderVersion,
+                          spirv::Blob *moduleOut) const
+{
+    spirv::Blob &module = *moduleOut;
+    module.clear();
+    module.reserve(mDebugNames.size() + mDecorations.size() + mTypesAndGlobals.size() +
+                   mFunctions.size() + 64);
+
+    // Header: magic number, version, generator, id bound and the reserved schema.
+    module.push_back(spirv::kMagicNumber);
+    module.push_back(spirv::kVersion_1_0);
+    module.push_back(0);
+    module.push_back(mNextId);
+    module.push_back(0);
+
+    spirv::WriteInstruction(&module, spirv::OpCapability, {spirv::CapabilityShader});
+
+    if (mGLSLstd450 != 0)
+    {
+        size_t start = spirv::BeginInstruction(&module, spirv::OpExtInstImport);
+        module.push_back(mGLSLstd450);
+        spirv::WriteString(&module, "GLSL.std.450");
+        spirv::EndInstruction(&module, start);
+    }
+
+    spirv::WriteInstruction(&module, spirv::OpMemoryModel,
+                            {kAddressingModelLogical, kMemoryModelGLSL450});
+
+    size_t start = spirv::BeginInstruction(&module, spirv::OpEntryPoint);
+    module.push_back(executionModel);
+    module.push_back(entryPoint);
+    spirv::WriteString(&module, "main");
+    module.insert(module.end(), interfaceVariables.begin(), interfaceVariables.end());
+    spirv::EndInstruction(&module, start);
+
+    for (spirv::ExecutionMode executionMode : mExecutionModes)
+    {
+        spirv::WriteInstruction(&module, spirv::OpExecutionMode, {entryPoint, executionMode});
+    }
+
+    spirv::WriteInstruction(&module, spirv::OpSource,
+                            {spirv::SourceLanguageESSL, static_cast<uint32_t>(shaderVersion)});
+
+    module.insert(module.end(), mDebugNames.begin(), mDebugNames.end());
+    module.insert(module.end(), mDecorations.begin(), mDecorations.end());
+    module.insert(module.end(), mTypesAndGlobals.begin(), mTypesAndGlobals.end());
+    module.insert(module.end(), mFunctions.begin(), mFunctions.end());
+}
+
+spirv::IdRef SPIRVBuilder::getDeclaration(spirv::Op op, std::initializer_list<uint32_t> operands)
+{
+    return getDeclaration(op, operands, {});
+}
+
+spirv::IdRef SPIRVBuilder::getDeclaration(spirv::Op op,
+                                          std::initializer_list<uint32_t> operands,
+                                          const std::vector<spirv::IdRef> &moreOperands)
+{
+    std::vector<uint32_t> key;
+    key.reserve(1 + operands.size() + moreOperands.size());
+    key.push_back(op);
+    key.insert(key.end(), operands.begin(), operands.end());
+    key.insert(key.end(), moreOperands.begin(), moreOperands.end());
+
+    auto iter = mDeclarations.find(key);
+    if (iter != mDeclarations.end())
+    {
+        return iter->second;
+    }
+
+    spirv::IdRef id = getNewId();
+
+    // Types have the result id first, and constants have it after the result type.
+    bool hasResultType = (op == spirv::OpConstantTrue || op == spirv::OpConstantFalse ||
+                          op == spirv::OpConstant || op == spirv::OpConstantComposite ||
+                          op == spirv::OpUndef);
+    size_t start = spirv::BeginInstruction(&mTypesAndGlobals, op);
+    auto operandIter = operands.begin();
+    if (hasResultType)
+    {
+        mTypesAndGlobals.push_back(*operandIter++);
+    }
+    mTypesAndGlobals.push_back(id);
+    mTypesAndGlobals.insert(mTypesAndGlobals.end(), operandIter, operands.end());
+    mTypesAndGlobals.insert(mTypesAndGlobals.end(), moreOperands.begin(), moreOperands.end());
+    spirv::EndInstruction(&mTypesAndGlobals, start);
+
+    mDeclarations[key] = id;
+    return id;
+}
+
+}  // namespace sh
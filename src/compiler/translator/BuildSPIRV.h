@@ -0,0 +1,388 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BuildSPIRV: Helpers for writing SPIR-V modules. Types and constants are deduplicated, and the
+//   instructions are collected in one blob per section of the SPIR-V logical layout so that they
+//   can be written in any order and joined when the module is finished.
+//   See: https://www.khronos.org/registry/spir-v/specs/1.0/SPIRV.html
+//
+
+#ifndef COMPILER_TRANSLATOR_BUILDSPIRV_H_
+#define COMPILER_TRANSLATOR_BUILDSPIRV_H_
+
+#include <initializer_list>
+#include <map>
+#include <vector>
+
+#include "common/angleutils.h"
+#include "compiler/translator/BaseTypes.h"
+
+namespace sh
+{
+
+namespace spirv
+{
+
+using IdRef = uint32_t;
+using Blob  = std::vector<uint32_t>;
+
+constexpr uint32_t kMagicNumber = 0x07230203;
+constexpr uint32_t kVersion_1_0 = 0x00010000;
+
+// The subset of the SPIR-V 1.0 enumerants that the translator uses.
+enum Op : uint32_t
+{
+    OpUndef                      = 1,
+    OpSource                     = 3,
+    OpName                       = 5,
+    OpMemberName                 = 6,
+    OpExtInstImport              = 11,
+    OpExtInst                    = 12,
+    OpMemoryModel                = 14,
+    OpEntryPoint                 = 15,
+    OpExecutionMode              = 16,
+    OpCapability                 = 17,
+    OpTypeVoid                   = 19,
+    OpTypeBool                   = 20,
+    OpTypeInt                    = 21,
+    OpTypeFloat                  = 22,
+    OpTypeVector                 = 23,
+    OpTypeMatrix                 = 24,
+    OpTypeImage                  = 25,
+    OpTypeSampledImage           = 27,
+    OpTypeArray                  = 28,
+    OpTypeStruct                 = 30,
+    OpTypePointer                = 32,
+    OpTypeFunction               = 33,
+    OpConstantTrue               = 41,
+    OpConstantFalse              = 42,
+    OpConstant                   = 43,
+    OpConstantComposite          = 44,
+    OpFunction                   = 54,
+    OpFunctionParameter          = 55,
+    OpFunctionEnd                = 56,
+    OpFunctionCall               = 57,
+    OpVariable                   = 59,
+    OpLoad                       = 61,
+    OpStore                      = 62,
+    OpAccessChain                = 65,
+    OpDecorate                   = 71,
+    OpMemberDecorate             = 72,
+    OpVectorExtractDynamic       = 77,
+    OpVectorShuffle              = 79,
+    OpCompositeConstruct         = 80,
+    OpCompositeExtract           = 81,
+    OpTranspose                  = 84,
+    OpImageSampleImplicitLod     = 87,
+    OpImageSampleExplicitLod     = 88,
+    OpImageSampleProjImplicitLod = 91,
+    OpImageSampleProjExplicitLod = 92,
+    OpConvertFToU                = 109,
+    OpConvertFToS                = 110,
+    OpConvertSToF                = 111,
+    OpConvertUToF                = 112,
+    OpBitcast                    = 124,
+    OpSNegate                    = 126,
+    OpFNegate                    = 127,
+    OpIAdd                       = 128,
+    OpFAdd                       = 129,
+    OpISub                       = 130,
+    OpFSub                       = 131,
+    OpIMul                       = 132,
+    OpFMul                       = 133,
+    OpUDiv                       = 134,
+    OpSDiv                       = 135,
+    OpFDiv                       = 136,
+    OpUMod                       = 137,
+    OpSMod                       = 139,
+    OpFMod                       = 141,
+    OpVectorTimesScalar          = 142,
+    OpMatrixTimesScalar          = 143,
+    OpVectorTimesMatrix          = 144,
+    OpMatrixTimesVector          = 145,
+    OpMatrixTimesMatrix          = 146,
+    OpOuterProduct               = 147,
+    OpDot                        = 148,
+    OpAny                        = 154,
+    OpAll                        = 155,
+    OpIsNan                      = 156,
+    OpIsInf                      = 157,
+    OpLogicalEqual               = 164,
+    OpLogicalNotEqual            = 165,
+    OpLogicalOr                  = 166,
+    OpLogicalAnd                 = 167,
+    OpLogicalNot                 = 168,
+    OpSelect                     = 169,
+    OpIEqual                     = 170,
+    OpINotEqual                  = 171,
+    OpUGreaterThan               = 172,
+    OpSGreaterThan               = 173,
+    OpUGreaterThanEqual          = 174,
+    OpSGreaterThanEqual          = 175,
+    OpULessThan                  = 176,
+    OpSLessThan                  = 177,
+    OpULessThanEqual             = 178,
+    OpSLessThanEqual             = 179,
+    OpFOrdEqual                  = 180,
+    OpFUnordNotEqual             = 183,
+    OpFOrdLessThan               = 184,
+    OpFOrdGreaterThan            = 186,
+    OpFOrdLessThanEqual          = 188,
+    OpFOrdGreaterThanEqual       = 190,
+    OpShiftRightLogical          = 194,
+    OpShiftRightArithmetic       = 195,
+    OpShiftLeftLogical           = 196,
+    OpBitwiseOr                  = 197,
+    OpBitwiseXor                 = 198,
+    OpBitwiseAnd                 = 199,
+    OpNot                        = 200,
+    OpDPdx                       = 207,
+    OpDPdy                       = 208,
+    OpFwidth                     = 209,
+    OpPhi                        = 245,
+    OpLoopMerge                  = 246,
+    OpSelectionMerge             = 247,
+    OpLabel                      = 248,
+    OpBranch                     = 249,
+    OpBranchConditional          = 250,
+    OpKill                       = 252,
+    OpReturn                     = 253,
+    OpReturnValue                = 254,
+    OpUnreachable                = 255,
+};
+
+enum Capability : uint32_t
+{
+    CapabilityShader = 1,
+};
+
+enum ExecutionModel : uint32_t
+{
+    ExecutionModelVertex   = 0,
+    ExecutionModelFragment = 4,
+};
+
+enum ExecutionMode : uint32_t
+{
+    ExecutionModeOriginUpperLeft = 7,
+    ExecutionModeDepthReplacing  = 12,
+};
+
+enum StorageClass : uint32_t
+{
+    StorageClassUniformConstant = 0,
+    StorageClassInput           = 1,
+    StorageClassUniform         = 2,
+    StorageClassOutput          = 3,
+    StorageClassPrivate         = 6,
+    StorageClassFunction        = 7,
+};
+
+enum Decoration : uint32_t
+{
+    DecorationBlock         = 2,
+    DecorationColMajor      = 5,
+    DecorationArrayStride   = 6,
+    DecorationMatrixStride  = 7,
+    DecorationBuiltIn       = 11,
+    DecorationFlat          = 14,
+    DecorationCentroid      = 16,
+    DecorationInvariant     = 18,
+    DecorationLocation      = 30,
+    DecorationBinding       = 33,
+    DecorationDescriptorSet = 34,
+    DecorationOffset        = 35,
+};
+
+enum BuiltIn : uint32_t
+{
+    BuiltInPosition      = 0,
+    BuiltInPointSize     = 1,
+    BuiltInFragCoord     = 15,
+    BuiltInPointCoord    = 16,
+    BuiltInFrontFacing   = 17,
+    BuiltInFragDepth     = 22,
+    BuiltInVertexIndex   = 42,
+    BuiltInInstanceIndex = 43,
+};
+
+enum ImageOperands : uint32_t
+{
+    ImageOperandsBias = 0x1,
+    ImageOperandsLod  = 0x2,
+};
+
+enum SourceLanguage : uint32_t
+{
+    SourceLanguageESSL = 1,
+};
+
+// Instructions of the GLSL.std.450 extended instruction set.
+enum GLSLstd450 : uint32_t
+{
+    GLSLstd450Round           = 1,
+    GLSLstd450RoundEven       = 2,
+    GLSLstd450Trunc           = 3,
+    GLSLstd450FAbs            = 4,
+    GLSLstd450SAbs            = 5,
+    GLSLstd450FSign           = 6,
+    GLSLstd450SSign           = 7,
+    GLSLstd450Floor           = 8,
+    GLSLstd450Ceil            = 9,
+    GLSLstd450Fract           = 10,
+    GLSLstd450Radians         = 11,
+    GLSLstd450Degrees         = 12,
+    GLSLstd450Sin             = 13,
+    GLSLstd450Cos             = 14,
+    GLSLstd450Tan             = 15,
+    GLSLstd450Asin            = 16,
+    GLSLstd450Acos            = 17,
+    GLSLstd450Atan            = 18,
+    GLSLstd450Sinh            = 19,
+    GLSLstd450Cosh            = 20,
+    GLSLstd450Tanh            = 21,
+    GLSLstd450Asinh           = 22,
+    GLSLstd450Acosh           = 23,
+    GLSLstd450Atanh           = 24,
+    GLSLstd450Atan2           = 25,
+    GLSLstd450Pow             = 26,
+    GLSLstd450Exp             = 27,
+    GLSLstd450Log             = 28,
+    GLSLstd450Exp2            = 29,
+    GLSLstd450Log2            = 30,
+    GLSLstd450Sqrt            = 31,
+    GLSLstd450InverseSqrt     = 32,
+    GLSLstd450Determinant     = 33,
+    GLSLstd450MatrixInverse   = 34,
+    GLSLstd450FMin            = 37,
+    GLSLstd450UMin            = 38,
+    GLSLstd450SMin            = 39,
+    GLSLstd450FMax            = 40,
+    GLSLstd450UMax            = 41,
+    GLSLstd450SMax            = 42,
+    GLSLstd450FClamp          = 43,
+    GLSLstd450UClamp          = 44,
+    GLSLstd450SClamp          = 45,
+    GLSLstd450FMix            = 46,
+    GLSLstd450Step            = 48,
+    GLSLstd450SmoothStep      = 49,
+    GLSLstd450PackSnorm4x8    = 54,
+    GLSLstd450PackUnorm4x8    = 55,
+    GLSLstd450PackSnorm2x16   = 56,
+    GLSLstd450PackUnorm2x16   = 57,
+    GLSLstd450PackHalf2x16    = 58,
+    GLSLstd450UnpackSnorm2x16 = 60,
+    GLSLstd450UnpackUnorm2x16 = 61,
+    GLSLstd450UnpackHalf2x16  = 62,
+    GLSLstd450UnpackSnorm4x8  = 63,
+    GLSLstd450UnpackUnorm4x8  = 64,
+    GLSLstd450Length          = 66,
+    GLSLstd450Distance        = 67,
+    GLSLstd450Cross           = 68,
+    GLSLstd450Normalize       = 69,
+    GLSLstd450FaceForward     = 70,
+    GLSLstd450Reflect         = 71,
+    GLSLstd450Refract         = 72,
+};
+
+// Starts an instruction, and returns its position so that EndInstruction can fill in its length
+// once all the operands have been written.
+size_t BeginInstruction(Blob *blob, Op op);
+void EndInstruction(Blob *blob, size_t start);
+
+// Writes a nul-terminated string operand, packed into words.
+void WriteString(Blob *blob, const char *str);
+
+void WriteInstruction(Blob *blob, Op op, std::initializer_list<uint32_t> operands);
+void WriteInstruction(Blob *blob,
+                      Op op,
+                      std::initializer_list<uint32_t> operands,
+                      const std::vector<IdRef> &moreOperands);
+
+}  // namespace spirv
+
+class SPIRVBuilder : angle::NonCopyable
+{
+  public:
+    SPIRVBuilder();
+
+    spirv::IdRef getNewId() { return mNextId++; }
+
+    // Types. Scalars have a vector size of 1, and bools can't be used in externally visible
+    // storage.
+    spirv::IdRef getVoidType();
+    spirv::IdRef getBasicType(TBasicType type, int vectorSize);
+    spirv::IdRef getMatrixType(int columns, int rows);
+    // An array stride of 0 leaves the array type undecorated, as required outside of blocks.
+    spirv::IdRef getArrayType(spirv::IdRef elementType, unsigned int arraySize, int arrayStride);
+    spirv::IdRef getSampledImageType(TBasicType samplerType);
+    spirv::IdRef getPointerType(spirv::IdRef type, spirv::StorageClass storageClass);
+    spirv::IdRef getFunctionType(spirv::IdRef returnType,
+                                 const std::vector<spirv::IdRef> &parameterTypes);
+    // Structs aren't deduplicated, since their members are decorated individually.
+    spirv::IdRef addStructType(const std::vector<spirv::IdRef> &memberTypes);
+
+    // Constants.
+    spirv::IdRef getBoolConstant(bool value);
+    spirv::IdRef getIntConstant(int32_t value);
+    spirv::IdRef getUintConstant(uint32_t value);
+    spirv::IdRef getFloatConstant(float value);
+    spirv::IdRef getCompositeConstant(spirv::IdRef type,
+                                      const std::vector<spirv::IdRef> &constituents);
+    spirv::IdRef getUndef(spirv::IdRef type);
+
+    // Declares a global variable. The initializer is optional and must be a constant.
+    spirv::IdRef addGlobalVariable(spirv::IdRef type,
+                                   spirv::StorageClass storageClass,
+                                   spirv::IdRef initializer);
+
+    // The GLSL.std.450 extended instruction set, imported on first use.
+    spirv::IdRef getGLSLstd450();
+
+    void addName(spirv::IdRef target, const char *name);
+    void addMemberName(spirv::IdRef structType, uint32_t member, const char *name);
+    void addDecoration(spirv::IdRef target,
+                       spirv::Decoration decoration,
+                       std::initializer_list<uint32_t> operands);
+    void addMemberDecoration(spirv::IdRef structType,
+                             uint32_t member,
+                             spirv::Decoration decoration,
+                             std::initializer_list<uint32_t> operands);
+    void addExecutionMode(spirv::ExecutionMode executionMode);
+
+    // Appends a complete function, from OpFunction to OpFunctionEnd.
+    void addFunction(const spirv::Blob &function);
+
+    // Joins the sections into a module with the given entry point.
+    void finish(spirv::ExecutionModel executionModel,
+                spirv::IdRef entryPoint,
+                const std::vector<spirv::IdRef> &interfaceVariables,
+                int shaderVersion,
+                spirv::Blob *moduleOut) const;
+
+  private:
+    // Returns the id of the type or constant declared by an instruction with these operands
+    // (excluding the result id), declaring it if it's not already declared.
+    spirv::IdRef getDeclaration(spirv::Op op, std::initializer_list<uint32_t> operands);
+    spirv::IdRef getDeclaration(spirv::Op op,
+                                std::initializer_list<uint32_t> operands,
+                                const std::vector<spirv::IdRef> &moreOperands);
+
+    spirv::IdRef mNextId;
+    spirv::IdRef mGLSLstd450;
+
+    // The key holds the opcode followed by the operands, leaving out the result id.
+    std::map<std::vector<uint32_t>, spirv::IdRef> mDeclarations;
+
+    std::vector<spirv::ExecutionMode> mExecutionModes;
+    spirv::Blob mDebugNames;
+    spirv::Blob mDecorations;
+    spirv::Blob mTypesAndGlobals;
+    spirv::Blob mFunctions;
+};
+
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_BUILDSPIRV_H_
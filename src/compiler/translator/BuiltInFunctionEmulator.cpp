@@ -6,6 +6,7 @@
 
 #include "compiler/translator/BuiltInFunctionEmulator.h"
 #include "angle_gl.h"
+#include "compiler/translator/FusedTraverser.h"
 #include "compiler/translator/IntermTraverse.h"
 #include "compiler/translator/SymbolTable.h"
 #include "compiler/translator/StaticType.h"
@@ -266,6 +267,17 @@ void BuiltInFunctionEmulator::markBuiltInFunctionsForEmulation(TIntermNode *root
     root->traverse(&marker);
 }
 
+void BuiltInFunctionEmulator::markBuiltInFunctionsForEmulation(TFusedTraverser *fusedTraverser)
+{
+    ASSERT(fusedTraverser);
+
+    if (mEmulatedFunctions.empty() && mQueryFunctions.empty())
+        return;
+
+    fusedTraverser->addTraverser(
+        std::unique_ptr<TIntermTraverser>(new BuiltInFunctionEmulationMarker(*this)));
+}
+
 void BuiltInFunctionEmulator::cleanup()
 {
     mFunctions.clear();
@@ -14,6 +14,8 @@
 namespace sh
 {
 
+class TFusedTraverser;
+
 struct MiniFunctionId
 {
     constexpr MiniFunctionId(TOperator op         = EOpNull,
@@ -96,6 +98,8 @@ class BuiltInFunctionEmulator
     BuiltInFunctionEmulator();
 
     void markBuiltInFunctionsForEmulation(TIntermNode *root);
+    // Adds the marking to a fused traversal.
+    void markBuiltInFunctionsForEmulation(TFusedTraverser *fusedTraverser);
 
     void cleanup();
 
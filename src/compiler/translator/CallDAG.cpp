@@ -10,6 +10,8 @@
 
 #include "compiler/translator/CallDAG.h"
 
+#include <map>
+
 #include "compiler/translator/Diagnostics.h"
 #include "compiler/translator/IntermTraverse.h"
 #include "compiler/translator/SymbolTable.h"
@@ -54,7 +56,7 @@ class CallDAG::CallDAGCreator : public TIntermTraverser
         return INITDAG_SUCCESS;
     }
 
-    void fillDataStructures(std::vector<Record> *records, std::map<int, int> *idToIndex)
+    void fillDataStructures(std::vector<Record> *records, TFlatHashMap<int, int> *idToIndex)
     {
         ASSERT(records->empty());
         ASSERT(idToIndex->empty());
@@ -80,7 +82,7 @@ class CallDAG::CallDAGCreator : public TIntermTraverser
                 record.callees.push_back(static_cast<int>(callee->index));
             }
 
-            (*idToIndex)[it.first] = static_cast<int>(data.index);
+            idToIndex->insert(it.first, static_cast<int>(data.index));
         }
     }
 
@@ -103,7 +105,7 @@ class CallDAG::CallDAGCreator : public TIntermTraverser
     bool visitFunctionDefinition(Visit visit, TIntermFunctionDefinition *node) override
     {
         // Create the record if need be and remember the definition node.
-        mCurrentFunction = &mFunctions[node->getFunction()->uniqueId().get()];
+        mCurrentFunction = getOrCreateFunction(node->getFunction()->uniqueId().get());
         // Name will be overwritten here. If we've already traversed the prototype of this function,
         // it should have had the same name.
         ASSERT(mCurrentFunction->name == "" ||
@@ -121,8 +123,8 @@ class CallDAG::CallDAGCreator : public TIntermTraverser
         ASSERT(mCurrentFunction == nullptr);
 
         // Function declaration, create an empty record.
-        auto &record = mFunctions[node->getFunction()->uniqueId().get()];
-        record.name  = node->getFunction()->name();
+        CreatorFunctionData *record = getOrCreateFunction(node->getFunction()->uniqueId().get());
+        record->name                = node->getFunction()->name();
 
         // No need to traverse the parameters.
         return false;
@@ -134,15 +136,16 @@ class CallDAG::CallDAGCreator : public TIntermTraverser
         if (node->getOp() == EOpCallFunctionInAST)
         {
             // Function call, add the callees
-            auto it = mFunctions.find(node->getFunction()->uniqueId().get());
-            ASSERT(it != mFunctions.end());
+            CreatorFunctionData *const *callee =
+                mFunctionsById.find(node->getFunction()->uniqueId().get());
+            ASSERT(callee != nullptr);
 
             // We might be traversing the initializer of a global variable. Even though function
             // calls in global scope are forbidden by the parser, some subsequent AST
             // transformations can add them to emulate particular features.
             if (mCurrentFunction)
             {
-                mCurrentFunction->callees.insert(&it->second);
+                mCurrentFunction->callees.insert(*callee);
             }
         }
         return true;
@@ -254,9 +257,24 @@ class CallDAG::CallDAGCreator : public TIntermTraverser
         return result;
     }
 
+    CreatorFunctionData *getOrCreateFunction(int id)
+    {
+        CreatorFunctionData *const *function = mFunctionsById.find(id);
+        if (function != nullptr)
+        {
+            return *function;
+        }
+        CreatorFunctionData *created = &mFunctions[id];
+        mFunctionsById.insert(id, created);
+        return created;
+    }
+
     TDiagnostics *mDiagnostics;
 
+    // Ordered by id, which decides the order the indices are assigned in. Calls are looked up in
+    // mFunctionsById instead.
     std::map<int, CreatorFunctionData> mFunctions;
+    TFlatHashMap<int, CreatorFunctionData *> mFunctionsById;
     CreatorFunctionData *mCurrentFunction;
     size_t mCurrentIndex;
 };
@@ -275,15 +293,15 @@ const size_t CallDAG::InvalidIndex = std::numeric_limits<size_t>::max();
 
 size_t CallDAG::findIndex(const TSymbolUniqueId &id) const
 {
-    auto it = mFunctionIdToIndex.find(id.get());
+    const int *index = mFunctionIdToIndex.find(id.get());
 
-    if (it == mFunctionIdToIndex.end())
+    if (index == nullptr)
     {
         return InvalidIndex;
     }
     else
     {
-        return it->second;
+        return *index;
     }
 }
 
@@ -11,8 +11,7 @@
 #ifndef COMPILER_TRANSLATOR_CALLDAG_H_
 #define COMPILER_TRANSLATOR_CALLDAG_H_
 
-#include <map>
-
+#include "compiler/translator/FlatHashMap.h"
 #include "compiler/translator/IntermNode.h"
 
 namespace sh
@@ -67,7 +66,7 @@ class CallDAG : angle::NonCopyable
 
   private:
     std::vector<Record> mRecords;
-    std::map<int, int> mFunctionIdToIndex;
+    TFlatHashMap<int, int> mFunctionIdToIndex;
 
     class CallDAGCreator;
 };
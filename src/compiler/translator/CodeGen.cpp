@@ -56,7 +56,7 @@ TCompiler *ConstructCompiler(sh::GLenum type, ShShaderSpec spec, ShShaderOutput
 #ifdef ANGLE_ENABLE_VULKAN
     if (IsOutputVulkan(output))
     {
-        return new TranslatorVulkan(type, spec);
+        return new TranslatorVulkan(type, spec, output);
     }
 #endif  // ANGLE_ENABLE_VULKAN
 
@@ -9,6 +9,7 @@
 
 #include "angle_gl.h"
 #include "common/utilities.h"
+#include "compiler/translator/FusedTraverser.h"
 #include "compiler/translator/HashNames.h"
 #include "compiler/translator/IntermTraverse.h"
 #include "compiler/translator/SymbolTable.h"
@@ -922,4 +923,25 @@ void CollectVariables(TIntermBlock *root,
     root->traverse(&collect);
 }
 
+void CollectVariables(TFusedTraverser *fusedTraverser,
+                      std::vector<Attribute> *attributes,
+                      std::vector<OutputVariable> *outputVariables,
+                      std::vector<Uniform> *uniforms,
+                      std::vector<Varying> *inputVaryings,
+                      std::vector<Varying> *outputVaryings,
+                      std::vector<InterfaceBlock> *uniformBlocks,
+                      std::vector<InterfaceBlock> *shaderStorageBlocks,
+                      std::vector<InterfaceBlock> *inBlocks,
+                      ShHashFunction64 hashFunction,
+                      TSymbolTable *symbolTable,
+                      int shaderVersion,
+                      GLenum shaderType,
+                      const TExtensionBehavior &extensionBehavior)
+{
+    fusedTraverser->addTraverser(std::unique_ptr<TIntermTraverser>(new CollectVariablesTraverser(
+        attributes, outputVariables, uniforms, inputVaryings, outputVaryings, uniformBlocks,
+        shaderStorageBlocks, inBlocks, hashFunction, symbolTable, shaderVersion, shaderType,
+        extensionBehavior)));
+}
+
 }  // namespace sh
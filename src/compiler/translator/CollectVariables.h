@@ -15,6 +15,7 @@
 namespace sh
 {
 
+class TFusedTraverser;
 class TIntermBlock;
 class TSymbolTable;
 
@@ -32,6 +33,23 @@ void CollectVariables(TIntermBlock *root,
                       int shaderVersion,
                       GLenum shaderType,
                       const TExtensionBehavior &extensionBehavior);
+
+// Adds the pass to a fused traversal. The variables are collected once the fused traversal has
+// finished.
+void CollectVariables(TFusedTraverser *fusedTraverser,
+                      std::vector<Attribute> *attributes,
+                      std::vector<OutputVariable> *outputVariables,
+                      std::vector<Uniform> *uniforms,
+                      std::vector<Varying> *inputVaryings,
+                      std::vector<Varying> *outputVaryings,
+                      std::vector<InterfaceBlock> *uniformBlocks,
+                      std::vector<InterfaceBlock> *shaderStorageBlocks,
+                      std::vector<InterfaceBlock> *inBlocks,
+                      ShHashFunction64 hashFunction,
+                      TSymbolTable *symbolTable,
+                      int shaderVersion,
+                      GLenum shaderType,
+                      const TExtensionBehavior &extensionBehavior);
 }
 
 #endif  // COMPILER_TRANSLATOR_COLLECTVARIABLES_H_
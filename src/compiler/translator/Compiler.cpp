@@ -6,6 +6,7 @@
 
 #include "compiler/translator/Compiler.h"
 
+#include <chrono>
 #include <sstream>
 
 #include "angle_gl.h"
@@ -20,9 +21,12 @@
 #include "compiler/translator/EmulateGLFragColorBroadcast.h"
 #include "compiler/translator/EmulatePrecision.h"
 #include "compiler/translator/FoldExpressions.h"
+#include "compiler/translator/FusedTraverser.h"
 #include "compiler/translator/Initialize.h"
 #include "compiler/translator/InitializeVariables.h"
 #include "compiler/translator/IntermNodePatternMatcher.h"
+#include "compiler/translator/IntermNode_util.h"
+#include "compiler/translator/IntermTraverse.h"
 #include "compiler/translator/IsASTDepthBelowLimit.h"
 #include "compiler/translator/OutputTree.h"
 #include "compiler/translator/ParseContext.h"
@@ -89,6 +93,80 @@ void DumpFuzzerCase(char const *const *shaderStrings,
     fclose(f);
 }
 #endif  // defined(ANGLE_ENABLE_FUZZER_CORPUS_OUTPUT)
+
+// Records the statistics of consecutive compilation stages. Each stage lasts until the next one
+// begins or the recorder goes out of scope. The counters are read from the global pool allocator,
+// which must not change during a stage, and which only counts nodes during a stage. Does nothing
+// if statistics is null.
+class StageRecorder : angle::NonCopyable
+{
+  public:
+    StageRecorder(std::vector<CompileStageStatistics> *statistics)
+        : mStatistics(statistics), mCurrentStage(nullptr), mAllocator(nullptr)
+    {
+    }
+    ~StageRecorder() { endStage(); }
+
+    void beginStage(const char *name)
+    {
+        if (mStatistics == nullptr)
+        {
+            return;
+        }
+        endStage();
+        mCurrentStage = name;
+        mAllocator    = GetGlobalPoolAllocator();
+        mAllocator->setStatisticsEnabled(true);
+
+        mStart.seconds        = 0.0;
+        mStart.nodesVisited   = mAllocator->getNumNodesVisited();
+        mStart.nodesAllocated = mAllocator->getNumNodesAllocated();
+        mStart.poolBytes      = mAllocator->getTotalBytesAllocated();
+        mStartTime            = std::chrono::steady_clock::now();
+    }
+
+    // Records a stage that ran interleaved with the current one. Only its time is known, and it's
+    // left out of the time of the current stage.
+    void addInterleavedStage(const char *name, double seconds)
+    {
+        if (mStatistics == nullptr)
+        {
+            return;
+        }
+        ASSERT(mCurrentStage != nullptr);
+        mStatistics->push_back({name, seconds, 0u, 0u, 0u});
+        mStart.seconds += seconds;
+    }
+
+  private:
+    void endStage()
+    {
+        if (mCurrentStage == nullptr)
+        {
+            return;
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - mStartTime;
+        ASSERT(mAllocator == GetGlobalPoolAllocator());
+
+        CompileStageStatistics stage;
+        stage.name           = mCurrentStage;
+        stage.seconds        = elapsed.count() - mStart.seconds;
+        stage.nodesVisited   = mAllocator->getNumNodesVisited() - mStart.nodesVisited;
+        stage.nodesAllocated = mAllocator->getNumNodesAllocated() - mStart.nodesAllocated;
+        stage.poolBytes      = mAllocator->getTotalBytesAllocated() - mStart.poolBytes;
+        mStatistics->push_back(stage);
+        mAllocator->setStatisticsEnabled(false);
+        mCurrentStage = nullptr;
+    }
+
+    std::vector<CompileStageStatistics> *mStatistics;
+    const char *mCurrentStage;
+    TPoolAllocator *mAllocator;
+    // The counters at the beginning of the current stage, and the time of interleaved stages.
+    CompileStageStatistics mStart;
+    std::chrono::steady_clock::time_point mStartTime;
+};
+
 }  // anonymous namespace
 
 bool IsWebGLBasedSpec(ShShaderSpec spec)
@@ -177,9 +255,14 @@ class TScopedPoolAllocator
     {
         mAllocator->push();
         SetGlobalPoolAllocator(mAllocator);
+
+        // Everything freed during the compilation belongs to this compiler, so its memory can be
+        // reused.
+        mAllocator->setRecyclingEnabled(true);
     }
     ~TScopedPoolAllocator()
     {
+        mAllocator->setRecyclingEnabled(false);
         SetGlobalPoolAllocator(nullptr);
         mAllocator->pop();
     }
@@ -206,6 +289,72 @@ class TScopedSymbolTableLevel
     TSymbolTable *mTable;
 };
 
+// Types cache their mangled names in the pool that is current when the name is first needed. The
+// symbols of a reused AST outlive the pool of any single compilation, so their mangled names are
+// computed up front while the AST's own pool is current.
+class RealizeSharedTypesTraverser : public TIntermTraverser
+{
+  public:
+    RealizeSharedTypesTraverser() : TIntermTraverser(true, false, false) {}
+
+    void visitSymbol(TIntermSymbol *node) override { node->getType().getMangledName(); }
+    void visitConstantUnion(TIntermConstantUnion *node) override
+    {
+        node->getType().getMangledName();
+    }
+    bool visitSwizzle(Visit visit, TIntermSwizzle *node) override
+    {
+        node->getType().getMangledName();
+        return true;
+    }
+    bool visitBinary(Visit visit, TIntermBinary *node) override
+    {
+        node->getType().getMangledName();
+        return true;
+    }
+    bool visitUnary(Visit visit, TIntermUnary *node) override
+    {
+        node->getType().getMangledName();
+        return true;
+    }
+    bool visitTernary(Visit visit, TIntermTernary *node) override
+    {
+        node->getType().getMangledName();
+        return true;
+    }
+    bool visitAggregate(Visit visit, TIntermAggregate *node) override
+    {
+        node->getType().getMangledName();
+        if (node->getFunction() != nullptr)
+        {
+            realizeFunction(*node->getFunction());
+        }
+        return true;
+    }
+    bool visitFunctionPrototype(Visit visit, TIntermFunctionPrototype *node) override
+    {
+        realizeFunction(*node->getFunction());
+        return true;
+    }
+
+  private:
+    void realizeFunction(const TFunction &function)
+    {
+        function.getMangledName();
+        function.getReturnType().getMangledName();
+        for (size_t i = 0; i < function.getParamCount(); ++i)
+        {
+            function.getParam(i).type->getMangledName();
+        }
+    }
+};
+
+void RealizeSharedTypes(TIntermBlock *root)
+{
+    RealizeSharedTypesTraverser traverser;
+    root->traverse(&traverser);
+}
+
 int MapSpecToShaderVersion(ShShaderSpec spec)
 {
     switch (spec)
@@ -227,6 +376,93 @@ int MapSpecToShaderVersion(ShShaderSpec spec)
 
 }  // namespace
 
+// Options that change the AST produced by the parser. A parsed AST is only reused when these match.
+constexpr ShCompileOptions kParseOptions = SH_FLATTEN_PRAGMA_STDGL_INVARIANT_ALL;
+
+// An AST kept from an earlier compilation together with the rest of the parsing results, so that
+// the same source can be compiled again with different options without parsing it again.
+struct ParsedShader : angle::NonCopyable
+{
+    ParsedShader(const char *const shaderStrings[],
+                 size_t numStrings,
+                 ShCompileOptions compileOptions,
+                 bool fragmentPrecisionHighIn)
+        : sources(shaderStrings, shaderStrings + numStrings),
+          parseOptions(compileOptions & kParseOptions),
+          fragmentPrecisionHighBeforeParsing(fragmentPrecisionHighIn),
+          root(nullptr),
+          globalScope(new TSymbolTable::SavedGlobalScope()),
+          shaderVersion(100),
+          computeShaderLocalSizeDeclared(false),
+          computeShaderLocalSize(1),
+          numViews(-1),
+          fragmentPrecisionHighAfterParsing(false),
+          geometryShaderMaxVertices(-1),
+          geometryShaderInvocations(0),
+          geometryShaderInputPrimitiveType(EptUndefined),
+          geometryShaderOutputPrimitiveType(EptUndefined)
+    {
+        allocator.push();
+    }
+
+    ~ParsedShader()
+    {
+        // The containers in the global level free their memory through the current pool.
+        TPoolAllocator *previousAllocator = GetGlobalPoolAllocator();
+        SetGlobalPoolAllocator(&allocator);
+        globalScope.reset();
+        SetGlobalPoolAllocator(previousAllocator);
+        allocator.popAll();
+    }
+
+    bool matches(const char *const shaderStrings[],
+                 size_t numStrings,
+                 ShCompileOptions compileOptions,
+                 bool fragmentPrecisionHighIn) const
+    {
+        if (numStrings != sources.size() || (compileOptions & kParseOptions) != parseOptions)
+        {
+            return false;
+        }
+        // Parsing turns highp support on for ESSL 3.00 and later, and only reads it for ESSL 1.00.
+        if (shaderVersion < 300 && fragmentPrecisionHighIn != fragmentPrecisionHighBeforeParsing)
+        {
+            return false;
+        }
+        for (size_t i = 0; i < numStrings; ++i)
+        {
+            if (sources[i] != shaderStrings[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Holds the AST and the symbols declared by the shader.
+    TPoolAllocator allocator;
+
+    std::vector<std::string> sources;
+    ShCompileOptions parseOptions;
+    bool fragmentPrecisionHighBeforeParsing;
+
+    TIntermBlock *root;
+    std::unique_ptr<TSymbolTable::SavedGlobalScope> globalScope;
+
+    TPersistString infoLog;
+    TExtensionBehavior extensionBehavior;
+    int shaderVersion;
+    TPragma pragma;
+    bool computeShaderLocalSizeDeclared;
+    sh::WorkGroupSize computeShaderLocalSize;
+    int numViews;
+    bool fragmentPrecisionHighAfterParsing;
+    int geometryShaderMaxVertices;
+    int geometryShaderInvocations;
+    TLayoutPrimitiveType geometryShaderInputPrimitiveType;
+    TLayoutPrimitiveType geometryShaderOutputPrimitiveType;
+};
+
 TShHandleBase::TShHandleBase()
 {
     allocator.push();
@@ -259,7 +495,8 @@ TCompiler::TCompiler(sh::GLenum type, ShShaderSpec spec, ShShaderOutput output)
       mGeometryShaderMaxVertices(-1),
       mGeometryShaderInvocations(0),
       mGeometryShaderInputPrimitiveType(EptUndefined),
-      mGeometryShaderOutputPrimitiveType(EptUndefined)
+      mGeometryShaderOutputPrimitiveType(EptUndefined),
+      mPoolHighWaterMark(0)
 {
 }
 
@@ -329,19 +566,70 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
         ++firstSource;
     }
 
+    // Regenerating struct names renames the structs in place, which would leak into the later
+    // compilations of a reused AST.
+    if ((compileOptions & SH_REUSE_PARSED_AST) == 0 ||
+        (compileOptions & SH_REGENERATE_STRUCT_NAMES) != 0)
+    {
+        // We preserve symbols at the built-in level from compile-to-compile.
+        // Start pushing the user-defined symbols at global level.
+        TScopedSymbolTableLevel globalLevel(&symbolTable);
+        ASSERT(symbolTable.atGlobalLevel());
+
+        TIntermBlock *root =
+            parseShader(&shaderStrings[firstSource], numStrings - firstSource, compileOptions);
+        if (root == nullptr || !checkAndSimplifyAST(root, compileOptions))
+        {
+            return nullptr;
+        }
+        return root;
+    }
+
+    if (mParsedShader &&
+        mParsedShader->matches(&shaderStrings[firstSource], numStrings - firstSource,
+                               compileOptions, fragmentPrecisionHigh))
+    {
+        restoreASTMetadata(*mParsedShader);
+    }
+    else
+    {
+        mParsedShader.reset();
+        mParsedShader =
+            parseShaderForReuse(&shaderStrings[firstSource], numStrings - firstSource,
+                                compileOptions);
+        if (!mParsedShader)
+        {
+            return nullptr;
+        }
+    }
+
+    // The transformations modify the AST, so they run on a copy in the pool of this compilation.
+    TIntermBlock *root = DeepCopyTree(mParsedShader->root);
+
+    symbolTable.restoreGlobalScope(mParsedShader->globalScope.get());
+    bool success = checkAndSimplifyAST(root, compileOptions);
+    symbolTable.saveGlobalScope(mParsedShader->globalScope.get());
+
+    return success ? root : nullptr;
+}
+
+TIntermBlock *TCompiler::parseShader(const char *const shaderStrings[],
+                                     size_t numStrings,
+                                     ShCompileOptions compileOptions)
+{
+    ASSERT(symbolTable.atGlobalLevel());
+
     TParseContext parseContext(symbolTable, extensionBehavior, shaderType, shaderSpec,
                                compileOptions, true, &mDiagnostics, getResources());
 
     parseContext.setFragmentPrecisionHighOnESSL1(fragmentPrecisionHigh);
 
-    // We preserve symbols at the built-in level from compile-to-compile.
-    // Start pushing the user-defined symbols at global level.
-    TScopedSymbolTableLevel globalLevel(&symbolTable);
-    ASSERT(symbolTable.atGlobalLevel());
-
-    // Parse shader.
-    if (PaParseStrings(numStrings - firstSource, &shaderStrings[firstSource], nullptr,
-                       &parseContext) != 0)
+    // Parse shader. The parser pulls tokens from the preprocessor as it goes.
+    StageRecorder stages(getStatisticsOutput(compileOptions));
+    stages.beginStage("Parse");
+    int parseResult = PaParseStrings(numStrings, shaderStrings, nullptr, &parseContext);
+    stages.addInterleavedStage("Preprocess", parseContext.getPreprocessorSeconds());
+    if (parseResult != 0)
     {
         return nullptr;
     }
@@ -358,13 +646,67 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
         return nullptr;
     }
 
-    TIntermBlock *root = parseContext.getTreeRoot();
-    if (!checkAndSimplifyAST(root, parseContext, compileOptions))
+    return parseContext.getTreeRoot();
+}
+
+std::unique_ptr<ParsedShader> TCompiler::parseShaderForReuse(const char *const shaderStrings[],
+                                                             size_t numStrings,
+                                                             ShCompileOptions compileOptions)
+{
+    std::unique_ptr<ParsedShader> parsedShader(
+        new ParsedShader(shaderStrings, numStrings, compileOptions, fragmentPrecisionHigh));
+
+    TPoolAllocator *compileAllocator = GetGlobalPoolAllocator();
+    SetGlobalPoolAllocator(&parsedShader->allocator);
+
+    symbolTable.push();
+    parsedShader->root = parseShader(shaderStrings, numStrings, compileOptions);
+    if (parsedShader->root != nullptr)
+    {
+        RealizeSharedTypes(parsedShader->root);
+        symbolTable.saveGlobalScope(parsedShader->globalScope.get());
+    }
+    else
+    {
+        symbolTable.pop();
+    }
+
+    SetGlobalPoolAllocator(compileAllocator);
+
+    if (parsedShader->root == nullptr)
     {
         return nullptr;
     }
 
-    return root;
+    parsedShader->infoLog                           = infoSink.info.str();
+    parsedShader->extensionBehavior                 = extensionBehavior;
+    parsedShader->shaderVersion                     = shaderVersion;
+    parsedShader->pragma                            = mPragma;
+    parsedShader->computeShaderLocalSizeDeclared    = mComputeShaderLocalSizeDeclared;
+    parsedShader->computeShaderLocalSize            = mComputeShaderLocalSize;
+    parsedShader->numViews                          = mNumViews;
+    parsedShader->fragmentPrecisionHighAfterParsing = fragmentPrecisionHigh;
+    parsedShader->geometryShaderMaxVertices         = mGeometryShaderMaxVertices;
+    parsedShader->geometryShaderInvocations         = mGeometryShaderInvocations;
+    parsedShader->geometryShaderInputPrimitiveType  = mGeometryShaderInputPrimitiveType;
+    parsedShader->geometryShaderOutputPrimitiveType = mGeometryShaderOutputPrimitiveType;
+    return parsedShader;
+}
+
+void TCompiler::restoreASTMetadata(const ParsedShader &parsedShader)
+{
+    infoSink.info << parsedShader.infoLog;
+    extensionBehavior                  = parsedShader.extensionBehavior;
+    shaderVersion                      = parsedShader.shaderVersion;
+    mPragma                            = parsedShader.pragma;
+    mComputeShaderLocalSizeDeclared    = parsedShader.computeShaderLocalSizeDeclared;
+    mComputeShaderLocalSize            = parsedShader.computeShaderLocalSize;
+    mNumViews                          = parsedShader.numViews;
+    fragmentPrecisionHigh              = parsedShader.fragmentPrecisionHighAfterParsing;
+    mGeometryShaderMaxVertices         = parsedShader.geometryShaderMaxVertices;
+    mGeometryShaderInvocations         = parsedShader.geometryShaderInvocations;
+    mGeometryShaderInputPrimitiveType  = parsedShader.geometryShaderInputPrimitiveType;
+    mGeometryShaderOutputPrimitiveType = parsedShader.geometryShaderOutputPrimitiveType;
 }
 
 bool TCompiler::checkShaderVersion(TParseContext *parseContext)
@@ -435,16 +777,18 @@ void TCompiler::setASTMetadata(const TParseContext &parseContext)
     }
 }
 
-bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
-                                    const TParseContext &parseContext,
-                                    ShCompileOptions compileOptions)
+bool TCompiler::checkAndSimplifyAST(TIntermBlock *root, ShCompileOptions compileOptions)
 {
+    StageRecorder stages(getStatisticsOutput(compileOptions));
+
     // Disallow expressions deemed too complex.
+    stages.beginStage("LimitExpressionComplexity");
     if ((compileOptions & SH_LIMIT_EXPRESSION_COMPLEXITY) && !limitExpressionComplexity(root))
     {
         return false;
     }
 
+    stages.beginStage("ValidateLimitations");
     if (shouldRunLoopAndIndexingValidation(compileOptions) &&
         !ValidateLimitations(root, shaderType, &symbolTable, &mDiagnostics))
     {
@@ -453,6 +797,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     // Fold expressions that could not be folded before validation that was done as a part of
     // parsing.
+    stages.beginStage("FoldExpressions");
     FoldExpressions(root, &mDiagnostics);
     // Folding should only be able to generate warnings.
     ASSERT(mDiagnostics.numErrors() == 0);
@@ -464,6 +809,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     //      for float, so float literal statements would end up with no precision which is
     //      invalid ESSL.
     // After this empty declarations are not allowed in the AST.
+    stages.beginStage("PruneNoOps");
     PruneNoOps(root, &symbolTable);
 
     // In case the last case inside a switch statement is a certain type of no-op, GLSL
@@ -471,12 +817,24 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // end of switch statements. This is also required because PruneNoOps may have left switch
     // statements that only contained an empty declaration inside the final case in an invalid
     // state. Relies on that PruneNoOps has already been run.
-    RemoveNoOpCasesFromEndOfSwitchStatements(root, &symbolTable);
-
-    // Remove empty switch statements - this makes output simpler.
-    RemoveEmptySwitchStatements(root);
+    //
+    // After that, remove empty switch statements - this makes output simpler.
+    //
+    // The two passes share a traversal: RemoveNoOpCasesFromEndOfSwitchStatements edits the
+    // statement list of a switch in place when visiting it, so RemoveEmptySwitchStatements
+    // already sees the cleaned up list when it visits the same switch right after.
+    // RemoveEmptySwitchStatements only queues updates to the parent block of the switch, which the
+    // other pass doesn't look at.
+    stages.beginStage("Fused: RemoveNoOpCasesFromEndOfSwitchStatements, RemoveEmptySwitchStatements");
+    {
+        TFusedTraverser switchCleanupTraverser;
+        RemoveNoOpCasesFromEndOfSwitchStatements(&switchCleanupTraverser, &symbolTable);
+        RemoveEmptySwitchStatements(&switchCleanupTraverser);
+        switchCleanupTraverser.traverseAndUpdateTree(root);
+    }
 
     // Create the function DAG and check there is no recursion
+    stages.beginStage("CallDAG");
     if (!initCallDag(root))
     {
         return false;
@@ -488,6 +846,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     }
 
     // Checks which functions are used and if "main" exists
+    stages.beginStage("PruneUnusedFunctions");
     functionMetadata.clear();
     functionMetadata.resize(mCallDag.size());
     if (!tagUsedFunctions())
@@ -500,11 +859,13 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         pruneUnusedFunctions(root);
     }
 
+    stages.beginStage("ValidateVaryingLocations");
     if (shaderVersion >= 310 && !ValidateVaryingLocations(root, &mDiagnostics, shaderType))
     {
         return false;
     }
 
+    stages.beginStage("ValidateOutputs");
     if (shaderVersion >= 300 && shaderType == GL_FRAGMENT_SHADER &&
         !ValidateOutputs(root, getExtensionBehavior(), compileResources.MaxDrawBuffers,
                          &mDiagnostics))
@@ -523,36 +884,47 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // Clamping uniform array bounds needs to happen after validateLimitations pass.
     if (compileOptions & SH_CLAMP_INDIRECT_ARRAY_BOUNDS)
     {
+        stages.beginStage("MarkIndirectArrayBoundsForClamping");
         arrayBoundsClamper.MarkIndirectArrayBoundsForClamping(root);
     }
 
     if ((compileOptions & SH_INITIALIZE_BUILTINS_FOR_INSTANCED_MULTIVIEW) &&
-        parseContext.isExtensionEnabled(TExtension::OVR_multiview) &&
+        IsExtensionEnabled(extensionBehavior, TExtension::OVR_multiview) &&
         getShaderType() != GL_COMPUTE_SHADER)
     {
+        stages.beginStage("DeclareAndInitBuiltinsForInstancedMultiview");
         DeclareAndInitBuiltinsForInstancedMultiview(root, mNumViews, shaderType, compileOptions,
                                                     outputType, &symbolTable);
     }
 
     // This pass might emit short circuits so keep it before the short circuit unfolding
     if (compileOptions & SH_REWRITE_DO_WHILE_LOOPS)
+    {
+        stages.beginStage("RewriteDoWhile");
         RewriteDoWhile(root, &symbolTable);
+    }
 
     if (compileOptions & SH_ADD_AND_TRUE_TO_LOOP_CONDITION)
+    {
+        stages.beginStage("AddAndTrueToLoopCondition");
         AddAndTrueToLoopCondition(root);
+    }
 
     if (compileOptions & SH_UNFOLD_SHORT_CIRCUIT)
     {
+        stages.beginStage("UnfoldShortCircuitAST");
         UnfoldShortCircuitAST(root);
     }
 
     if (compileOptions & SH_REMOVE_POW_WITH_CONSTANT_EXPONENT)
     {
+        stages.beginStage("RemovePow");
         RemovePow(root);
     }
 
     if (compileOptions & SH_REGENERATE_STRUCT_NAMES)
     {
+        stages.beginStage("RegenerateStructNames");
         RegenerateStructNames gen(&symbolTable);
         root->traverse(&gen);
     }
@@ -561,6 +933,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         compileResources.EXT_draw_buffers && compileResources.MaxDrawBuffers > 1 &&
         IsExtensionEnabled(extensionBehavior, TExtension::EXT_draw_buffers))
     {
+        stages.beginStage("EmulateGLFragColorBroadcast");
         EmulateGLFragColorBroadcast(root, compileResources.MaxDrawBuffers, &outputVariables,
                                     &symbolTable, shaderVersion);
     }
@@ -572,6 +945,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // Split multi declarations and remove calls to array length().
     // Note that SimplifyLoopConditions needs to be run before any other AST transformations
     // that may need to generate new statements from loop conditions or loop expressions.
+    stages.beginStage("SimplifyLoopConditions");
     SimplifyLoopConditions(root,
                            IntermNodePatternMatcher::kMultiDeclaration |
                                IntermNodePatternMatcher::kArrayLengthMethod | simplifyScalarized,
@@ -579,13 +953,17 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     // Note that separate declarations need to be run before other AST transformations that
     // generate new statements from expressions.
+    stages.beginStage("SeparateDeclarations");
     SeparateDeclarations(root);
 
+    stages.beginStage("SplitSequenceOperator");
     SplitSequenceOperator(root, IntermNodePatternMatcher::kArrayLengthMethod | simplifyScalarized,
                           &getSymbolTable());
 
+    stages.beginStage("RemoveArrayLengthMethod");
     RemoveArrayLengthMethod(root);
 
+    stages.beginStage("RemoveUnreferencedVariables");
     RemoveUnreferencedVariables(root, &symbolTable);
 
     // Built-in function emulation needs to happen after validateLimitations pass.
@@ -593,23 +971,44 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     GetGlobalPoolAllocator()->lock();
     initBuiltInFunctionEmulator(&builtInFunctionEmulator, compileOptions);
     GetGlobalPoolAllocator()->unlock();
-    builtInFunctionEmulator.markBuiltInFunctionsForEmulation(root);
 
+    // Marking built-in functions for emulation only sets flags on the function call nodes, which
+    // collecting variables doesn't look at, so the two share a traversal unless scalarizing
+    // constructor arguments needs to change the tree in between.
+    TFusedTraverser markAndCollectTraverser;
     if (compileOptions & SH_SCALARIZE_VEC_AND_MAT_CONSTRUCTOR_ARGS)
     {
+        stages.beginStage("MarkBuiltInFunctionsForEmulation");
+        builtInFunctionEmulator.markBuiltInFunctionsForEmulation(root);
+
+        stages.beginStage("ScalarizeVecAndMatConstructorArgs");
         ScalarizeVecAndMatConstructorArgs(root, shaderType, fragmentPrecisionHigh, &symbolTable);
     }
+    else
+    {
+        builtInFunctionEmulator.markBuiltInFunctionsForEmulation(&markAndCollectTraverser);
+    }
 
-    if (shouldCollectVariables(compileOptions))
+    bool collectVariables = shouldCollectVariables(compileOptions);
+    if (collectVariables)
     {
         ASSERT(!variablesCollected);
-        CollectVariables(root, &attributes, &outputVariables, &uniforms, &inputVaryings,
-                         &outputVaryings, &uniformBlocks, &shaderStorageBlocks, &inBlocks,
-                         hashFunction, &symbolTable, shaderVersion, shaderType, extensionBehavior);
+        CollectVariables(&markAndCollectTraverser, &attributes, &outputVariables, &uniforms,
+                         &inputVaryings, &outputVaryings, &uniformBlocks, &shaderStorageBlocks,
+                         &inBlocks, hashFunction, &symbolTable, shaderVersion, shaderType,
+                         extensionBehavior);
+    }
+
+    stages.beginStage("Fused: MarkBuiltInFunctionsForEmulation, CollectVariables");
+    markAndCollectTraverser.traverseAndUpdateTree(root);
+
+    if (collectVariables)
+    {
         collectInterfaceBlocks();
         variablesCollected = true;
         if (compileOptions & SH_USE_UNUSED_STANDARD_SHARED_BLOCKS)
         {
+            stages.beginStage("UseAllMembersInUnusedStandardAndSharedBlocks");
             useAllMembersInUnusedStandardAndSharedBlocks(root);
         }
         if (compileOptions & SH_ENFORCE_PACKING_RESTRICTIONS)
@@ -624,6 +1023,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         }
         if (compileOptions & SH_INIT_OUTPUT_VARIABLES)
         {
+            stages.beginStage("InitializeOutputVariables");
             initializeOutputVariables(root);
         }
     }
@@ -632,6 +1032,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // Otherwise, built-in invariant declarations don't apply.
     if (RemoveInvariant(shaderType, shaderVersion, outputType, compileOptions))
     {
+        stages.beginStage("RemoveInvariantDeclaration");
         RemoveInvariantDeclaration(root);
     }
 
@@ -641,6 +1042,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     if (shaderType == GL_VERTEX_SHADER && !mGLPositionInitialized &&
         ((compileOptions & SH_INIT_GL_POSITION) || (outputType == SH_GLSL_COMPATIBILITY_OUTPUT)))
     {
+        stages.beginStage("InitializeGLPosition");
         initializeGLPosition(root);
         mGLPositionInitialized = true;
     }
@@ -654,6 +1056,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     bool canUseLoopsToInitialize = !(compileOptions & SH_DONT_USE_LOOPS_TO_INITIALIZE_VARIABLES);
     bool highPrecisionSupported =
         shaderType != GL_FRAGMENT_SHADER || compileResources.FragmentPrecisionHigh;
+    stages.beginStage("DeferGlobalInitializers");
     DeferGlobalInitializers(root, initializeLocalsAndGlobals, canUseLoopsToInitialize,
                             highPrecisionSupported, &symbolTable);
 
@@ -669,28 +1072,33 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
         if (!shouldRunLoopAndIndexingValidation(compileOptions))
         {
+            stages.beginStage("SimplifyLoopConditions");
             SimplifyLoopConditions(root,
                                    IntermNodePatternMatcher::kArrayDeclaration |
                                        IntermNodePatternMatcher::kNamelessStructDeclaration,
                                    &getSymbolTable());
         }
 
+        stages.beginStage("InitializeUninitializedLocals");
         InitializeUninitializedLocals(root, getShaderVersion(), canUseLoopsToInitialize,
                                       highPrecisionSupported, &getSymbolTable());
     }
 
     if (getShaderType() == GL_VERTEX_SHADER && (compileOptions & SH_CLAMP_POINT_SIZE))
     {
+        stages.beginStage("ClampPointSize");
         ClampPointSize(root, compileResources.MaxPointSize, &getSymbolTable());
     }
 
     if (getShaderType() == GL_FRAGMENT_SHADER && (compileOptions & SH_CLAMP_FRAG_DEPTH))
     {
+        stages.beginStage("ClampFragDepth");
         ClampFragDepth(root, &getSymbolTable());
     }
 
     if (compileOptions & SH_REWRITE_VECTOR_SCALAR_ARITHMETIC)
     {
+        stages.beginStage("VectorizeVectorScalarArithmetic");
         VectorizeVectorScalarArithmetic(root, &getSymbolTable());
     }
 
@@ -717,25 +1125,36 @@ bool TCompiler::compile(const char *const shaderStrings[],
         compileOptions |= SH_FLATTEN_PRAGMA_STDGL_INVARIANT_ALL;
     }
 
-    TScopedPoolAllocator scopedAlloc(&allocator);
-    TIntermBlock *root = compileTreeImpl(shaderStrings, numStrings, compileOptions);
-
-    if (root)
+    bool success = false;
     {
-        if (compileOptions & SH_INTERMEDIATE_TREE)
-            OutputTree(root, infoSink.info);
+        TScopedPoolAllocator scopedAlloc(&allocator);
+        allocator.resetHighWaterMark();
+        TIntermBlock *root = compileTreeImpl(shaderStrings, numStrings, compileOptions);
 
-        if (compileOptions & SH_OBJECT_CODE)
+        if (root)
         {
-            PerformanceDiagnostics perfDiagnostics(&mDiagnostics);
-            translate(root, compileOptions, &perfDiagnostics);
+            if (compileOptions & SH_INTERMEDIATE_TREE)
+                OutputTree(root, infoSink.info);
+
+            if (compileOptions & SH_OBJECT_CODE)
+            {
+                StageRecorder stages(getStatisticsOutput(compileOptions));
+                stages.beginStage("Output");
+                PerformanceDiagnostics perfDiagnostics(&mDiagnostics);
+                translate(root, compileOptions, &perfDiagnostics);
+            }
+
+            // The IntermNode tree doesn't need to be deleted here, since the
+            // memory will be freed in a big chunk by the PoolAllocator.
         }
 
-        // The IntermNode tree doesn't need to be deleted here, since the
-        // memory will be freed in a big chunk by the PoolAllocator.
-        return true;
+        mPoolHighWaterMark = allocator.getHighWaterMark();
+        success            = root != nullptr;
     }
-    return false;
+
+    // The compilation's pool may have recycled memory of the worker pools, so they go last.
+    mWorkerPoolAllocators.clear();
+    return success;
 }
 
 bool TCompiler::InitBuiltInSymbolTable(const ShBuiltInResources &resources)
@@ -856,6 +1275,7 @@ void TCompiler::clearResults()
     infoSink.info.erase();
     infoSink.obj.erase();
     infoSink.debug.erase();
+    mObjectBinary.clear();
     mDiagnostics.resetErrorCount();
 
     attributes.clear();
@@ -884,6 +1304,14 @@ void TCompiler::clearResults()
     mSourcePath     = nullptr;
 
     symbolTable.clearCompilationResults();
+
+    mCompileStatistics.clear();
+}
+
+std::vector<CompileStageStatistics> *TCompiler::getStatisticsOutput(
+    ShCompileOptions compileOptions)
+{
+    return (compileOptions & SH_COLLECT_COMPILE_STATISTICS) ? &mCompileStatistics : nullptr;
 }
 
 bool TCompiler::initCallDag(TIntermNode *root)
@@ -1050,6 +1478,19 @@ void TCompiler::pruneUnusedFunctions(TIntermBlock *root)
     }
 }
 
+void TCompiler::runFunctionLocalTransforms(TIntermBlock *root,
+                                           ShCompileOptions compileOptions,
+                                           const std::function<void(TIntermBlock *)> &transform)
+{
+    bool parallel = (compileOptions & SH_PARALLELIZE_FUNCTION_TRANSFORMS) != 0;
+    if (parallel)
+    {
+        // The statements share types, whose mangled names are otherwise computed on first use.
+        RealizeSharedTypes(root);
+    }
+    RunFunctionLocalTransforms(root, &symbolTable, parallel, &mWorkerPoolAllocators, transform);
+}
+
 bool TCompiler::limitExpressionComplexity(TIntermBlock *root)
 {
     if (!IsASTDepthBelowLimit(root, maxExpressionComplexity))
@@ -14,12 +14,15 @@
 // This should not be included by driver code.
 //
 
+#include <memory>
+
 #include <GLSLANG/ShaderVars.h>
 
 #include "compiler/translator/BuiltInFunctionEmulator.h"
 #include "compiler/translator/CallDAG.h"
 #include "compiler/translator/Diagnostics.h"
 #include "compiler/translator/ExtensionBehavior.h"
+#include "compiler/translator/FunctionLocalTransforms.h"
 #include "compiler/translator/HashNames.h"
 #include "compiler/translator/InfoSink.h"
 #include "compiler/translator/Pragma.h"
@@ -31,6 +34,7 @@ namespace sh
 
 class TCompiler;
 class TParseContext;
+struct ParsedShader;
 #ifdef ANGLE_ENABLE_HLSL
 class TranslatorHLSL;
 #endif  // ANGLE_ENABLE_HLSL
@@ -101,6 +105,7 @@ class TCompiler : public TShHandleBase
     // Get results of the last compilation.
     int getShaderVersion() const { return shaderVersion; }
     TInfoSink &getInfoSink() { return infoSink; }
+    const std::vector<uint32_t> &getObjectBinary() const { return mObjectBinary; }
 
     bool isComputeShaderLocalSizeDeclared() const { return mComputeShaderLocalSizeDeclared; }
     const sh::WorkGroupSize &getComputeShaderLocalSize() const { return mComputeShaderLocalSize; }
@@ -147,6 +152,17 @@ class TCompiler : public TShHandleBase
 
     sh::GLenum getShaderType() const { return shaderType; }
 
+    // Statistics of the stages of the last compilation, if it was done with
+    // SH_COLLECT_COMPILE_STATISTICS. Passes that share a single traversal are one stage.
+    const std::vector<CompileStageStatistics> &getCompileStatistics() const
+    {
+        return mCompileStatistics;
+    }
+
+    // Largest amount of pool memory held at any point during the last compilation, including the
+    // memory that stays allocated between compilations.
+    size_t getPoolHighWaterMark() const { return mPoolHighWaterMark; }
+
   protected:
     // Initialize symbol-table with built-in symbols.
     bool InitBuiltInSymbolTable(const ShBuiltInResources &resources);
@@ -173,6 +189,12 @@ class TCompiler : public TShHandleBase
     // while spec says it is allowed.
     // This function should only be applied to vertex shaders.
     void initializeGLPosition(TIntermBlock *root);
+    // Runs |transform| on the AST, on each top-level statement separately and on several threads
+    // with SH_PARALLELIZE_FUNCTION_TRANSFORMS. See RunFunctionLocalTransforms for what |transform|
+    // may do.
+    void runFunctionLocalTransforms(TIntermBlock *root,
+                                    ShCompileOptions compileOptions,
+                                    const std::function<void(TIntermBlock *)> &transform);
     // Return true if the maximum expression complexity is below the limit.
     bool limitExpressionComplexity(TIntermBlock *root);
     // Get built-in extensions with default behavior.
@@ -201,6 +223,9 @@ class TCompiler : public TShHandleBase
     std::vector<sh::InterfaceBlock> shaderStorageBlocks;
     std::vector<sh::InterfaceBlock> inBlocks;
 
+    // SPIR-V written by translate() besides the object code, if the output type has any.
+    std::vector<uint32_t> mObjectBinary;
+
   private:
     // Creates the function call DAG for further analysis, returning false if there is a recursion
     bool initCallDag(TIntermNode *root);
@@ -224,6 +249,19 @@ class TCompiler : public TShHandleBase
                                   size_t numStrings,
                                   const ShCompileOptions compileOptions);
 
+    // Parses the shader into the global level of the symbol table, which must have been pushed
+    // already. Returns nullptr on errors.
+    TIntermBlock *parseShader(const char *const shaderStrings[],
+                              size_t numStrings,
+                              ShCompileOptions compileOptions);
+
+    // Parses the shader into a pool of its own so that the AST stays valid after this compilation
+    // and can be compiled again with different options. See SH_REUSE_PARSED_AST.
+    std::unique_ptr<ParsedShader> parseShaderForReuse(const char *const shaderStrings[],
+                                                      size_t numStrings,
+                                                      ShCompileOptions compileOptions);
+    void restoreASTMetadata(const ParsedShader &parsedShader);
+
     // Fetches and stores shader metadata that is not stored within the AST itself, such as shader
     // version.
     void setASTMetadata(const TParseContext &parseContext);
@@ -232,9 +270,10 @@ class TCompiler : public TShHandleBase
     bool checkShaderVersion(TParseContext *parseContext);
 
     // Does checks that need to be run after parsing is complete and returns true if they pass.
-    bool checkAndSimplifyAST(TIntermBlock *root,
-                             const TParseContext &parseContext,
-                             ShCompileOptions compileOptions);
+    bool checkAndSimplifyAST(TIntermBlock *root, ShCompileOptions compileOptions);
+
+    // Where to record the compile statistics, or null if they're not collected.
+    std::vector<CompileStageStatistics> *getStatisticsOutput(ShCompileOptions compileOptions);
 
     sh::GLenum shaderType;
     ShShaderSpec shaderSpec;
@@ -292,6 +331,16 @@ class TCompiler : public TShHandleBase
     NameMap nameMap;
 
     TPragma mPragma;
+
+    std::vector<CompileStageStatistics> mCompileStatistics;
+
+    size_t mPoolHighWaterMark;
+
+    // Pools of the threads running runFunctionLocalTransforms, freed after the compilation.
+    TWorkerPoolAllocators mWorkerPoolAllocators;
+
+    // The last shader parsed with SH_REUSE_PARSED_AST.
+    std::unique_ptr<ParsedShader> mParsedShader;
 };
 
 //
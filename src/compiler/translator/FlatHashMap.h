@@ -0,0 +1,119 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FlatHashMap.h: A hash map for lookups on the hot paths of the translator. The entries are kept
+// in insertion order in a single array, and an open-addressing table of entry indices with linear
+// probing finds them. Each entry keeps its hash, so most mismatches are rejected without comparing
+// keys and the table can grow without hashing the keys again. Entries can't be removed one by one,
+// only all at once.
+//
+
+#ifndef COMPILER_TRANSLATOR_FLATHASHMAP_H_
+#define COMPILER_TRANSLATOR_FLATHASHMAP_H_
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace sh
+{
+
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class TFlatHashMap
+{
+  public:
+    TFlatHashMap() {}
+
+    // Returns nullptr if |key| isn't in the map.
+    const Value *find(const Key &key) const
+    {
+        if (mEntries.empty())
+        {
+            return nullptr;
+        }
+        size_t hash = Hash()(key);
+        size_t mask = mSlots.size() - 1u;
+        for (size_t slot = hash & mask; mSlots[slot] != 0u; slot = (slot + 1u) & mask)
+        {
+            const Entry &entry = mEntries[mSlots[slot] - 1u];
+            if (entry.hash == hash && entry.key == key)
+            {
+                return &entry.value;
+            }
+        }
+        return nullptr;
+    }
+
+    // Adds |key| with |value|, or gives |key| the new value if it's in the map already.
+    void insert(const Key &key, const Value &value)
+    {
+        if ((mEntries.size() + 1u) * 2u > mSlots.size())
+        {
+            grow();
+        }
+        size_t hash = Hash()(key);
+        size_t mask = mSlots.size() - 1u;
+        size_t slot = hash & mask;
+        for (; mSlots[slot] != 0u; slot = (slot + 1u) & mask)
+        {
+            Entry &entry = mEntries[mSlots[slot] - 1u];
+            if (entry.hash == hash && entry.key == key)
+            {
+                entry.value = value;
+                return;
+            }
+        }
+        mEntries.push_back(Entry(hash, key, value));
+        mSlots[slot] = static_cast<unsigned int>(mEntries.size());
+    }
+
+    size_t size() const { return mEntries.size(); }
+    bool empty() const { return mEntries.empty(); }
+
+    // Keeps the memory to be used again.
+    void clear()
+    {
+        mEntries.clear();
+        mSlots.assign(mSlots.size(), 0u);
+    }
+
+  private:
+    struct Entry
+    {
+        Entry(size_t hash, const Key &key, const Value &value) : hash(hash), key(key), value(value)
+        {
+        }
+
+        size_t hash;
+        Key key;
+        Value value;
+    };
+
+    // Keeps the table at most half full.
+    void grow()
+    {
+        size_t slotCount = mSlots.empty() ? 16u : mSlots.size() * 2u;
+        mSlots.assign(slotCount, 0u);
+        size_t mask = slotCount - 1u;
+        for (size_t index = 0u; index < mEntries.size(); ++index)
+        {
+            size_t slot = mEntries[index].hash & mask;
+            while (mSlots[slot] != 0u)
+            {
+                slot = (slot + 1u) & mask;
+            }
+            mSlots[slot] = static_cast<unsigned int>(index + 1u);
+        }
+    }
+
+    std::vector<Entry> mEntries;
+    // One past the index of the entry in each slot, zero for an empty slot. The size is a power of
+    // two.
+    std::vector<unsigned int> mSlots;
+};
+
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_FLATHASHMAP_H_
@@ -0,0 +1,232 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FunctionLocalTransforms: Runs AST transformations that only look at one function at a time on
+// each top-level statement separately, spreading the statements over several threads.
+//
+
+#include "compiler/translator/FunctionLocalTransforms.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+#include <thread>
+
+#include "common/WorkerThread.h"
+#include "common/angleutils.h"
+#include "compiler/translator/IntermNode.h"
+#include "compiler/translator/PoolAlloc.h"
+#include "compiler/translator/SymbolTable.h"
+
+namespace sh
+{
+
+namespace
+{
+
+// Unique ids reserved for the symbols created while transforming one statement. Should a
+// statement need more, the rest come from the shared counter and may be numbered differently
+// from one compilation to the next.
+constexpr int kUniqueIdsPerStatement = 1 << 16;
+
+// Leaves at least half of the id space to the rest of the compilation.
+constexpr size_t kMaxParallelStatements =
+    static_cast<size_t>(std::numeric_limits<int>::max() / 2 / kUniqueIdsPerStatement);
+
+// Threads transforming the statements of one compilation, counting the thread that compiles.
+constexpr size_t kMaxTransformThreads = 4;
+
+#if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+// The threads shared by all the compilations in the process. Compilations may themselves run on
+// several threads, so giving each one threads of its own would multiply the thread count.
+std::mutex gTransformThreadPoolMutex;
+angle::WorkerThreadPool *gTransformThreadPool = nullptr;
+
+size_t GetTransformHelperThreadCount()
+{
+    size_t hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    return std::min(hardwareThreads, kMaxTransformThreads) - 1u;
+}
+
+angle::WorkerThreadPool *GetTransformThreadPool()
+{
+    std::lock_guard<std::mutex> lock(gTransformThreadPoolMutex);
+    if (!gTransformThreadPool)
+    {
+        gTransformThreadPool = new angle::WorkerThreadPool(GetTransformHelperThreadCount());
+    }
+    return gTransformThreadPool;
+}
+#endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+
+// The statements of one call to RunFunctionLocalTransforms. Pool threads may only start after the
+// calling thread has transformed all the statements, so they hold on to this and must not touch
+// anything else once all the statements are taken.
+struct SplitStatements : angle::NonCopyable
+{
+    SplitStatements(TIntermSequence *statementsIn,
+                    TSymbolTable *symbolTableIn,
+                    TWorkerPoolAllocators *workerPoolsIn,
+                    const std::function<void(TIntermBlock *)> *transformIn)
+        : statements(statementsIn),
+          statementCount(statementsIn->size()),
+          symbolTable(symbolTableIn),
+          workerPools(workerPoolsIn),
+          transform(transformIn),
+          firstId(symbolTable->reserveUniqueIds(static_cast<int>(statementCount) *
+                                                kUniqueIdsPerStatement)),
+          transformed(statementCount, nullptr),
+          nextStatement(0u),
+          doneCount(0u)
+    {
+    }
+
+    void transformStatement(size_t index)
+    {
+        TSymbolTable::ScopedUniqueIdRange ids(
+            symbolTable, firstId + static_cast<int>(index) * kUniqueIdsPerStatement,
+            kUniqueIdsPerStatement);
+
+        TIntermBlock *block = new TIntermBlock();
+        block->appendStatement((*statements)[index]);
+        (*transform)(block);
+        transformed[index] = block;
+
+        bool allDone = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            allDone = (++doneCount == statementCount);
+        }
+        if (allDone)
+        {
+            allDoneCondition.notify_all();
+        }
+    }
+
+    // Only valid until all the statements are done.
+    TIntermSequence *statements;
+    size_t statementCount;
+    TSymbolTable *symbolTable;
+    TWorkerPoolAllocators *workerPools;
+    const std::function<void(TIntermBlock *)> *transform;
+    int firstId;
+    std::vector<TIntermBlock *> transformed;
+
+    std::atomic<size_t> nextStatement;
+    std::mutex mutex;
+    std::condition_variable allDoneCondition;
+    size_t doneCount;
+};
+
+void TransformStatementsOnPoolThread(const std::shared_ptr<SplitStatements> &split)
+{
+    size_t index = split->nextStatement++;
+    if (index >= split->statementCount)
+    {
+        return;
+    }
+
+    // The pool threads don't use the pool of the compilation. They get pools of their own, which
+    // don't recycle memory since the AST they change comes from other pools.
+    TPoolAllocator *pool = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(split->mutex);
+        split->workerPools->emplace_back(new TPoolAllocator());
+        pool = split->workerPools->back().get();
+    }
+    pool->push();
+    SetGlobalPoolAllocator(pool);
+
+    do
+    {
+        split->transformStatement(index);
+    } while ((index = split->nextStatement++) < split->statementCount);
+
+    SetGlobalPoolAllocator(nullptr);
+}
+
+#if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+// Nobody waits for the task itself, so it deletes itself once it has run.
+class TransformStatementsTask : public angle::Closure
+{
+  public:
+    TransformStatementsTask(const std::shared_ptr<SplitStatements> &split) : mSplit(split) {}
+
+    void operator()() override
+    {
+        TransformStatementsOnPoolThread(mSplit);
+        delete this;
+    }
+
+  private:
+    std::shared_ptr<SplitStatements> mSplit;
+};
+#endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+
+}  // anonymous namespace
+
+void RunFunctionLocalTransforms(TIntermBlock *root,
+                                TSymbolTable *symbolTable,
+                                bool parallel,
+                                TWorkerPoolAllocators *workerPools,
+                                const std::function<void(TIntermBlock *)> &transform)
+{
+    TIntermSequence *statements = root->getSequence();
+    size_t statementCount       = statements->size();
+    if (!parallel || statementCount <= 1u || statementCount > kMaxParallelStatements)
+    {
+        transform(root);
+        return;
+    }
+
+    auto split =
+        std::make_shared<SplitStatements>(statements, symbolTable, workerPools, &transform);
+
+#if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+    size_t helperCount = std::min(GetTransformHelperThreadCount(), statementCount - 1u);
+    if (helperCount > 0u)
+    {
+        angle::WorkerThreadPool *threadPool = GetTransformThreadPool();
+        for (size_t helperIndex = 0; helperIndex < helperCount; ++helperIndex)
+        {
+            threadPool->postWorkerTask(new TransformStatementsTask(split));
+        }
+    }
+#endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+
+    // The calling thread takes part with the pool of the compilation, so the statements get done
+    // even if the pool threads are busy with other compilations.
+    size_t index;
+    while ((index = split->nextStatement++) < split->statementCount)
+    {
+        split->transformStatement(index);
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(split->mutex);
+        split->allDoneCondition.wait(
+            lock, [&split] { return split->doneCount == split->statementCount; });
+    }
+
+    TIntermSequence merged;
+    for (TIntermBlock *block : split->transformed)
+    {
+        TIntermSequence *blockStatements = block->getSequence();
+        merged.insert(merged.end(), blockStatements->begin(), blockStatements->end());
+    }
+    statements->swap(merged);
+}
+
+void ShutDownFunctionLocalTransformThreads()
+{
+#if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+    std::lock_guard<std::mutex> lock(gTransformThreadPoolMutex);
+    SafeDelete(gTransformThreadPool);
+#endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+}
+
+}  // namespace sh
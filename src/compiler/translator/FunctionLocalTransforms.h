@@ -0,0 +1,47 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FunctionLocalTransforms: Runs AST transformations that only look at one function at a time on
+// each top-level statement separately, spreading the statements over several threads.
+//
+
+#ifndef COMPILER_TRANSLATOR_FUNCTIONLOCALTRANSFORMS_H_
+#define COMPILER_TRANSLATOR_FUNCTIONLOCALTRANSFORMS_H_
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+class TPoolAllocator;
+
+namespace sh
+{
+
+class TIntermBlock;
+class TSymbolTable;
+
+// Pools the worker threads allocate from. What the transformations allocate becomes part of the
+// AST, so the pools need to stay alive until the pool of the compilation has been popped.
+using TWorkerPoolAllocators = std::vector<std::unique_ptr<TPoolAllocator>>;
+
+// With |parallel| set, runs |transform| on a block holding a single top-level statement of |root|
+// for each statement, and then replaces the statements of |root| with the statements left in the
+// blocks. The statements are spread over the threads of a pool shared by the whole process, which
+// the calling thread joins. Otherwise runs |transform| on |root| as a whole.
+// |transform| may only change the block it's given and the subtrees in it, and may only add
+// symbols to |symbolTable| by creating them. With |parallel| set, the mangled names of the types in
+// the AST must have been computed already, since the types may be shared between statements.
+void RunFunctionLocalTransforms(TIntermBlock *root,
+                                TSymbolTable *symbolTable,
+                                bool parallel,
+                                TWorkerPoolAllocators *workerPools,
+                                const std::function<void(TIntermBlock *)> &transform);
+
+// Joins the threads used by RunFunctionLocalTransforms. No compilation may be running.
+void ShutDownFunctionLocalTransformThreads();
+
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_FUNCTIONLOCALTRANSFORMS_H_
@@ -9,6 +9,8 @@
 
 #include "compiler/translator/FunctionLookup.h"
 
+#include "compiler/translator/ImmutableStringBuilder.h"
+
 namespace sh
 {
 
@@ -24,7 +26,11 @@ constexpr const ImmutableString kEmptyName("");
 TFunctionLookup::TFunctionLookup(const ImmutableString &name,
                                  const TType *constructorType,
                                  const TSymbol *symbol)
-    : mName(name), mConstructorType(constructorType), mThisNode(nullptr), mSymbol(symbol)
+    : mName(name),
+      mConstructorType(constructorType),
+      mThisNode(nullptr),
+      mSymbol(symbol),
+      mMangledName(kEmptyName)
 {
 }
 
@@ -50,20 +56,29 @@ const ImmutableString &TFunctionLookup::name() const
 
 ImmutableString TFunctionLookup::getMangledName() const
 {
-    return GetMangledName(mName.data(), mArguments);
+    if (mMangledName.empty())
+    {
+        mMangledName = GetMangledName(mName.data(), mArguments);
+    }
+    return mMangledName;
 }
 
 ImmutableString TFunctionLookup::GetMangledName(const char *functionName,
                                                 const TIntermSequence &arguments)
 {
-    std::string newName(functionName);
-    newName += kFunctionMangledNameSeparator;
+    size_t length = strlen(functionName) + 1u;
+    for (TIntermNode *argument : arguments)
+    {
+        length += strlen(argument->getAsTyped()->getType().getMangledName());
+    }
 
+    ImmutableStringBuilder newName(length);
+    newName << functionName << kFunctionMangledNameSeparator;
     for (TIntermNode *argument : arguments)
     {
-        newName += argument->getAsTyped()->getType().getMangledName();
+        newName << argument->getAsTyped()->getType().getMangledName();
     }
-    return ImmutableString(newName);
+    return newName;
 }
 
 bool TFunctionLookup::isConstructor() const
@@ -89,6 +104,7 @@ TIntermTyped *TFunctionLookup::thisNode() const
 void TFunctionLookup::addArgument(TIntermTyped *argument)
 {
     mArguments.push_back(argument);
+    mMangledName = kEmptyName;
 }
 
 TIntermSequence &TFunctionLookup::arguments()
@@ -25,6 +25,7 @@ class TFunctionLookup : angle::NonCopyable
     static TFunctionLookup *CreateFunctionCall(const ImmutableString &name, const TSymbol *symbol);
 
     const ImmutableString &name() const;
+    // The mangled name is built once and kept until more arguments are added.
     ImmutableString getMangledName() const;
     static ImmutableString GetMangledName(const char *functionName,
                                           const TIntermSequence &arguments);
@@ -52,6 +53,7 @@ class TFunctionLookup : angle::NonCopyable
     TIntermTyped *mThisNode;
     TIntermSequence mArguments;
     const TSymbol *mSymbol;
+    mutable ImmutableString mMangledName;
 };
 
 }  // namespace sh
@@ -0,0 +1,372 @@
+//
+// Copyright (c) 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FusedTraverser.cpp: Runs several independent AST traversers in a single walk over the tree.
+// The traverse functions mirror the ones in IntermTraverse.cpp, but track the visit state of each
+// fused traverser separately.
+//
+
+#include "compiler/translator/FusedTraverser.h"
+
+namespace sh
+{
+
+TFusedTraverser::ScopedNodeInFusedTraversalPaths::ScopedNodeInFusedTraversalPaths(
+    TFusedTraverser *fusedTraverser,
+    TIntermNode *current)
+    : mFusedTraverser(fusedTraverser)
+{
+    if (mFusedTraverser->mNodeVisitCounter)
+    {
+        ++*mFusedTraverser->mNodeVisitCounter;
+    }
+    mFusedTraverser->incrementDepth(current);
+    for (auto &traverser : mFusedTraverser->mTraversers)
+    {
+        traverser->incrementDepth(current);
+    }
+}
+
+TFusedTraverser::ScopedNodeInFusedTraversalPaths::~ScopedNodeInFusedTraversalPaths()
+{
+    mFusedTraverser->decrementDepth();
+    for (auto &traverser : mFusedTraverser->mTraversers)
+    {
+        traverser->decrementDepth();
+    }
+}
+
+TFusedTraverser::TFusedTraverser() : TIntermTraverser(true, true, true), mActiveMask(0u)
+{
+}
+
+TFusedTraverser::~TFusedTraverser()
+{
+}
+
+void TFusedTraverser::addTraverser(std::unique_ptr<TIntermTraverser> traverser)
+{
+    ASSERT(mTraversers.size() < kMaxFusedTraversers);
+    mTraversers.push_back(std::move(traverser));
+}
+
+void TFusedTraverser::traverseAndUpdateTree(TIntermNode *root)
+{
+    if (mTraversers.empty())
+    {
+        return;
+    }
+
+    mActiveMask = static_cast<TraverserMask>((1ull << mTraversers.size()) - 1u);
+    root->traverse(this);
+    mActiveMask = 0u;
+
+    // All the queued updates refer to the tree as it was before any of them were applied, so they
+    // can be applied together. Insertion positions don't change until the insertions are done.
+    for (auto &traverser : mTraversers)
+    {
+        mInsertions.insert(mInsertions.end(), traverser->mInsertions.begin(),
+                           traverser->mInsertions.end());
+        mReplacements.insert(mReplacements.end(), traverser->mReplacements.begin(),
+                             traverser->mReplacements.end());
+        mMultiReplacements.insert(mMultiReplacements.end(), traverser->mMultiReplacements.begin(),
+                                  traverser->mMultiReplacements.end());
+        traverser->clearReplacementQueue();
+    }
+    updateTree();
+
+    mTraversers.clear();
+}
+
+template <typename NodeType>
+TFusedTraverser::TraverserMask TFusedTraverser::visitFused(
+    bool (TIntermTraverser::*visitFunc)(Visit, NodeType *),
+    Visit visit,
+    NodeType *node,
+    TraverserMask visitMask)
+{
+    for (size_t index = 0u; index < mTraversers.size(); ++index)
+    {
+        TraverserMask bit = 1u << index;
+        if ((visitMask & bit) == 0u)
+        {
+            continue;
+        }
+        TIntermTraverser *traverser = mTraversers[index].get();
+        bool visitRequested         = (visit == PreVisit && traverser->preVisit) ||
+                              (visit == InVisit && traverser->inVisit) ||
+                              (visit == PostVisit && traverser->postVisit);
+        if (visitRequested && !(traverser->*visitFunc)(visit, node))
+        {
+            visitMask &= ~bit;
+        }
+    }
+    return visitMask;
+}
+
+template <typename NodeType>
+void TFusedTraverser::visitFusedLeaf(void (TIntermTraverser::*visitFunc)(NodeType *),
+                                     NodeType *node)
+{
+    for (size_t index = 0u; index < mTraversers.size(); ++index)
+    {
+        if ((mActiveMask & (1u << index)) != 0u)
+        {
+            (mTraversers[index].get()->*visitFunc)(node);
+        }
+    }
+}
+
+void TFusedTraverser::traverseFusedChild(TIntermNode *child, TraverserMask childMask)
+{
+    // Skip the subtree altogether if none of the traversers want to visit it.
+    if (childMask == 0u)
+    {
+        return;
+    }
+    TraverserMask parentMask = mActiveMask;
+    mActiveMask              = childMask;
+    child->traverse(this);
+    mActiveMask = parentMask;
+}
+
+template <typename NodeType>
+void TFusedTraverser::traverseFusedSequence(bool (TIntermTraverser::*visitFunc)(Visit, NodeType *),
+                                            NodeType *node)
+{
+    ScopedNodeInFusedTraversalPaths addToPaths(this, node);
+
+    TIntermSequence *sequence = node->getSequence();
+
+    // A traverser that returns false from an in-visit still traverses the rest of the children, it
+    // just doesn't get any more visits of this node. childMask tracks the former and visit the
+    // latter.
+    TraverserMask childMask = visitFused(visitFunc, PreVisit, node, mActiveMask);
+    TraverserMask visit     = childMask;
+
+    for (auto *child : *sequence)
+    {
+        traverseFusedChild(child, childMask);
+        if (child != sequence->back())
+        {
+            visit = visitFused(visitFunc, InVisit, node, visit);
+        }
+    }
+
+    visitFused(visitFunc, PostVisit, node, visit);
+}
+
+void TFusedTraverser::traverseSymbol(TIntermSymbol *node)
+{
+    ScopedNodeInFusedTraversalPaths addToPaths(this, node);
+    visitFusedLeaf(&TIntermTraverser::visitSymbol, node);
+}
+
+void TFusedTraverser::traverseRaw(TIntermRaw *node)
+{
+    ScopedNodeInFusedTraversalPaths addToPaths(this, node);
+    visitFusedLeaf(&TIntermTraverser::visitRaw, node);
+}
+
+void TFusedTraverser::traverseConstantUnion(TIntermConstantUnion *node)
+{
+    ScopedNodeInFusedTraversalPaths addToPaths(this, node);
+    visitFusedLeaf(&TIntermTraverser::visitConstantUnion, node);
+}
+
+void TFusedTraverser::traverseSwizzle(TIntermSwizzle *node)
+{
+    ScopedNodeInFusedTraversalPaths addToPaths(this, node);
+
+    TraverserMask visit = visitFused(&TIntermTraverser::visitSwizzle, PreVisit, node, mActiveMask);
+    traverseFusedChild(node->getOperand(), visit);
+    visitFused(&TIntermTraverser::visitSwizzle, PostVisit, node, visit);
+}
+
+void TFusedTraverser::traverseBinary(TIntermBinary *node)
+{
+    ScopedNodeInFusedTraversalPaths addToPaths(this, node);
+
+    TraverserMask visit = visitFused(&TIntermTraverser::visitBinary, PreVisit, node, mActiveMask);
+    if (node->getLeft())
+        traverseFusedChild(node->getLeft(), visit);
+    visit = visitFused(&TIntermTraverser::visitBinary, InVisit, node, visit);
+    if (node->getRight())
+        traverseFusedChild(node->getRight(), visit);
+    visitFused(&TIntermTraverser::visitBinary, PostVisit, node, visit);
+}
+
+void TFusedTraverser::traverseUnary(TIntermUnary *node)
+{
+    ScopedNodeInFusedTraversalPaths addToPaths(this, node);
+
+    TraverserMask visit = visitFused(&TIntermTraverser::visitUnary, PreVisit, node, mActiveMask);
+    traverseFusedChild(node->getOperand(), visit);
+    visitFused(&TIntermTraverser::visitUnary, PostVisit, node, visit);
+}
+
+void TFusedTraverser::traverseTernary(TIntermTernary *node)
+{
+    ScopedNodeInFusedTraversalPaths addToPaths(this, node);
+
+    TraverserMask visit = visitFused(&TIntermTraverser::visitTernary, PreVisit, node, mActiveMask);
+    traverseFusedChild(node->getCondition(), visit);
+    if (node->getTrueExpression())
+        traverseFusedChild(node->getTrueExpression(), visit);
+    if (node->getFalseExpression())
+        traverseFusedChild(node->getFalseExpression(), visit);
+    visitFused(&TIntermTraverser::visitTernary, PostVisit, node, visit);
+}
+
+void TFusedTraverser::traverseIfElse(TIntermIfElse *node)
+{
+    ScopedNodeInFusedTraversalPaths addToPaths(this, node);
+
+    TraverserMask visit = visitFused(&TIntermTraverser::visitIfElse, PreVisit, node, mActiveMask);
+    traverseFusedChild(node->getCondition(), visit);
+    if (node->getTrueBlock())
+        traverseFusedChild(node->getTrueBlock(), visit);
+    if (node->getFalseBlock())
+        traverseFusedChild(node->getFalseBlock(), visit);
+    visitFused(&TIntermTraverser::visitIfElse, PostVisit, node, visit);
+}
+
+void TFusedTraverser::traverseSwitch(TIntermSwitch *node)
+{
+    ScopedNodeInFusedTraversalPaths addToPaths(this, node);
+
+    TraverserMask visit = visitFused(&TIntermTraverser::visitSwitch, PreVisit, node, mActiveMask);
+    traverseFusedChild(node->getInit(), visit);
+    visit = visitFused(&TIntermTraverser::visitSwitch, InVisit, node, visit);
+    if (node->getStatementList())
+        traverseFusedChild(node->getStatementList(), visit);
+    visitFused(&TIntermTraverser::visitSwitch, PostVisit, node, visit);
+}
+
+void TFusedTraverser::traverseCase(TIntermCase *node)
+{
+    ScopedNodeInFusedTraversalPaths addToPaths(this, node);
+
+    TraverserMask visit = visitFused(&TIntermTraverser::visitCase, PreVisit, node, mActiveMask);
+    if (node->getCondition())
+        traverseFusedChild(node->getCondition(), visit);
+    visitFused(&TIntermTraverser::visitCase, PostVisit, node, visit);
+}
+
+void TFusedTraverser::traverseFunctionPrototype(TIntermFunctionPrototype *node)
+{
+    traverseFusedSequence(&TIntermTraverser::visitFunctionPrototype, node);
+}
+
+void TFusedTraverser::traverseFunctionDefinition(TIntermFunctionDefinition *node)
+{
+    ScopedNodeInFusedTraversalPaths addToPaths(this, node);
+
+    // Like in TIntermTraverser::traverseFunctionDefinition, the body is traversed even if the
+    // in-visit returns false.
+    TraverserMask childMask =
+        visitFused(&TIntermTraverser::visitFunctionDefinition, PreVisit, node, mActiveMask);
+
+    for (auto &traverser : mTraversers)
+    {
+        traverser->mInGlobalScope = false;
+    }
+
+    traverseFusedChild(node->getFunctionPrototype(), childMask);
+    TraverserMask visit =
+        visitFused(&TIntermTraverser::visitFunctionDefinition, InVisit, node, childMask);
+    traverseFusedChild(node->getBody(), childMask);
+
+    for (auto &traverser : mTraversers)
+    {
+        traverser->mInGlobalScope = true;
+    }
+
+    visitFused(&TIntermTraverser::visitFunctionDefinition, PostVisit, node, visit);
+}
+
+void TFusedTraverser::traverseAggregate(TIntermAggregate *node)
+{
+    traverseFusedSequence(&TIntermTraverser::visitAggregate, node);
+}
+
+void TFusedTraverser::traverseBlock(TIntermBlock *node)
+{
+    ScopedNodeInFusedTraversalPaths addToPaths(this, node);
+    for (auto &traverser : mTraversers)
+    {
+        traverser->pushParentBlock(node);
+    }
+
+    TIntermSequence *sequence = node->getSequence();
+
+    TraverserMask childMask =
+        visitFused(&TIntermTraverser::visitBlock, PreVisit, node, mActiveMask);
+    TraverserMask visit     = childMask;
+
+    for (auto *child : *sequence)
+    {
+        traverseFusedChild(child, childMask);
+        if (child != sequence->back())
+        {
+            visit = visitFused(&TIntermTraverser::visitBlock, InVisit, node, visit);
+        }
+
+        for (auto &traverser : mTraversers)
+        {
+            traverser->incrementParentBlockPos();
+        }
+    }
+
+    visitFused(&TIntermTraverser::visitBlock, PostVisit, node, visit);
+
+    for (auto &traverser : mTraversers)
+    {
+        traverser->popParentBlock();
+    }
+}
+
+void TFusedTraverser::traverseInvariantDeclaration(TIntermInvariantDeclaration *node)
+{
+    ScopedNodeInFusedTraversalPaths addToPaths(this, node);
+
+    TraverserMask visit =
+        visitFused(&TIntermTraverser::visitInvariantDeclaration, PreVisit, node, mActiveMask);
+    traverseFusedChild(node->getSymbol(), visit);
+    visitFused(&TIntermTraverser::visitInvariantDeclaration, PostVisit, node, visit);
+}
+
+void TFusedTraverser::traverseDeclaration(TIntermDeclaration *node)
+{
+    traverseFusedSequence(&TIntermTraverser::visitDeclaration, node);
+}
+
+void TFusedTraverser::traverseLoop(TIntermLoop *node)
+{
+    ScopedNodeInFusedTraversalPaths addToPaths(this, node);
+
+    TraverserMask visit = visitFused(&TIntermTraverser::visitLoop, PreVisit, node, mActiveMask);
+    if (node->getInit())
+        traverseFusedChild(node->getInit(), visit);
+    if (node->getCondition())
+        traverseFusedChild(node->getCondition(), visit);
+    if (node->getBody())
+        traverseFusedChild(node->getBody(), visit);
+    if (node->getExpression())
+        traverseFusedChild(node->getExpression(), visit);
+    visitFused(&TIntermTraverser::visitLoop, PostVisit, node, visit);
+}
+
+void TFusedTraverser::traverseBranch(TIntermBranch *node)
+{
+    ScopedNodeInFusedTraversalPaths addToPaths(this, node);
+
+    TraverserMask visit = visitFused(&TIntermTraverser::visitBranch, PreVisit, node, mActiveMask);
+    if (node->getExpression())
+        traverseFusedChild(node->getExpression(), visit);
+    visitFused(&TIntermTraverser::visitBranch, PostVisit, node, visit);
+}
+
+}  // namespace sh
@@ -0,0 +1,103 @@
+//
+// Copyright (c) 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FusedTraverser.h: Runs several independent AST traversers in a single walk over the tree.
+//
+// Each node is visited by the fused traversers in the order they were added, and each traverser
+// sees exactly the visits it would see if it was run on its own. A traverser sees in-place changes
+// that earlier traversers made to the node being visited, but tree updates queued with
+// queueReplacement(), insertStatementsInParentBlock() etc. are only applied once the walk has
+// finished. This means that traversers can only be fused if none of them needs to see the changes
+// queued by the others.
+//
+// Traversers that override any of the traverse*() functions, like TLValueTrackingTraverser, can't
+// be fused since the fused traverser does the traversing on their behalf.
+//
+
+#ifndef COMPILER_TRANSLATOR_FUSEDTRAVERSER_H_
+#define COMPILER_TRANSLATOR_FUSEDTRAVERSER_H_
+
+#include <memory>
+#include <vector>
+
+#include "compiler/translator/IntermTraverse.h"
+
+namespace sh
+{
+
+class TFusedTraverser : public TIntermTraverser
+{
+  public:
+    TFusedTraverser();
+    ~TFusedTraverser() override;
+
+    void addTraverser(std::unique_ptr<TIntermTraverser> traverser);
+    bool empty() const { return mTraversers.empty(); }
+
+    // Walks the tree once with all the added traversers and then applies the tree updates queued by
+    // them. The traversers are removed afterwards so that the fused traverser can be reused.
+    void traverseAndUpdateTree(TIntermNode *root);
+
+    void traverseSymbol(TIntermSymbol *node) override;
+    void traverseRaw(TIntermRaw *node) override;
+    void traverseConstantUnion(TIntermConstantUnion *node) override;
+    void traverseSwizzle(TIntermSwizzle *node) override;
+    void traverseBinary(TIntermBinary *node) override;
+    void traverseUnary(TIntermUnary *node) override;
+    void traverseTernary(TIntermTernary *node) override;
+    void traverseIfElse(TIntermIfElse *node) override;
+    void traverseSwitch(TIntermSwitch *node) override;
+    void traverseCase(TIntermCase *node) override;
+    void traverseFunctionPrototype(TIntermFunctionPrototype *node) override;
+    void traverseFunctionDefinition(TIntermFunctionDefinition *node) override;
+    void traverseAggregate(TIntermAggregate *node) override;
+    void traverseBlock(TIntermBlock *node) override;
+    void traverseInvariantDeclaration(TIntermInvariantDeclaration *node) override;
+    void traverseDeclaration(TIntermDeclaration *node) override;
+    void traverseLoop(TIntermLoop *node) override;
+    void traverseBranch(TIntermBranch *node) override;
+
+  private:
+    // The state of the fused traversers is tracked with bit masks, one bit per traverser.
+    using TraverserMask                     = unsigned int;
+    static constexpr size_t kMaxFusedTraversers = sizeof(TraverserMask) * 8u;
+
+    // RAII helper to add the current node to the traversal path of all the fused traversers.
+    class ScopedNodeInFusedTraversalPaths : angle::NonCopyable
+    {
+      public:
+        ScopedNodeInFusedTraversalPaths(TFusedTraverser *fusedTraverser, TIntermNode *current);
+        ~ScopedNodeInFusedTraversalPaths();
+
+      private:
+        TFusedTraverser *mFusedTraverser;
+    };
+
+    // Calls the visit function of the traversers in visitMask that requested this kind of visit.
+    // Returns visitMask without the traversers that returned false.
+    template <typename NodeType>
+    TraverserMask visitFused(bool (TIntermTraverser::*visitFunc)(Visit, NodeType *),
+                             Visit visit,
+                             NodeType *node,
+                             TraverserMask visitMask);
+    template <typename NodeType>
+    void visitFusedLeaf(void (TIntermTraverser::*visitFunc)(NodeType *), NodeType *node);
+
+    // Traverses a child node with only the traversers in childMask.
+    void traverseFusedChild(TIntermNode *child, TraverserMask childMask);
+
+    template <typename NodeType>
+    void traverseFusedSequence(bool (TIntermTraverser::*visitFunc)(Visit, NodeType *),
+                               NodeType *node);
+
+    std::vector<std::unique_ptr<TIntermTraverser>> mTraversers;
+
+    // The traversers that visit the subtree currently being traversed.
+    TraverserMask mActiveMask;
+};
+
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_FUSEDTRAVERSER_H_
@@ -47,6 +47,22 @@ ImmutableString HashName(const ImmutableString &name, ShHashFunction64 hashFunct
 
 }  // anonymous namespace
 
+NameMap::NameMap() = default;
+
+NameMap::~NameMap() = default;
+
+void NameMap::insert(const ImmutableString &name, const ImmutableString &hashedName)
+{
+    mCache.insert(name, hashedName);
+    mHashedNames[name.data()] = hashedName.data();
+}
+
+void NameMap::clear()
+{
+    mCache.clear();
+    mHashedNames.clear();
+}
+
 ImmutableString HashName(const ImmutableString &name,
                          ShHashFunction64 hashFunction,
                          NameMap *nameMap)
@@ -66,17 +82,16 @@ ImmutableString HashName(const ImmutableString &name,
     }
     if (nameMap)
     {
-        NameMap::const_iterator it = nameMap->find(name.data());
-        if (it != nameMap->end())
+        const ImmutableString *cachedName = nameMap->find(name);
+        if (cachedName != nullptr)
         {
-            // TODO(oetuaho): Would be nice if we didn't need to allocate a string here.
-            return ImmutableString(it->second);
+            return *cachedName;
         }
     }
     ImmutableString hashedName = HashName(name, hashFunction);
     if (nameMap)
     {
-        (*nameMap)[name.data()] = hashedName.data();
+        nameMap->insert(name, hashedName);
     }
     return hashedName;
 }
@@ -11,15 +11,44 @@
 
 #include "GLSLANG/ShaderLang.h"
 #include "compiler/translator/Common.h"
+#include "compiler/translator/FlatHashMap.h"
+#include "compiler/translator/ImmutableString.h"
 
 namespace sh
 {
 
-typedef std::map<TPersistString, TPersistString> NameMap;
-
-class ImmutableString;
 class TSymbol;
 
+// The hashed names of the user-defined identifiers of a compilation. The names are looked up in a
+// hash table keyed by the names themselves, which point to pool memory or static strings, so a
+// lookup doesn't need to build a string. Only names hashed for the first time are added to the
+// ordered map returned by sh::GetNameHashingMap.
+class NameMap : angle::NonCopyable
+{
+  public:
+    NameMap();
+    ~NameMap();
+
+    // Returns nullptr if |name| hasn't been hashed in this compilation.
+    const ImmutableString *find(const ImmutableString &name) const { return mCache.find(name); }
+    void insert(const ImmutableString &name, const ImmutableString &hashedName);
+
+    // Needs to be called between compilations, since the cached names are freed with the pool.
+    void clear();
+
+    const std::map<TPersistString, TPersistString> &getHashedNames() const
+    {
+        return mHashedNames;
+    }
+
+  private:
+    TFlatHashMap<ImmutableString,
+                 ImmutableString,
+                 ImmutableString::FowlerNollVoHash<sizeof(size_t)>>
+        mCache;
+    std::map<TPersistString, TPersistString> mHashedNames;
+};
+
 ImmutableString HashName(const ImmutableString &name,
                          ShHashFunction64 hashFunction,
                          NameMap *nameMap);
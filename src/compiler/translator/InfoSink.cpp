@@ -35,14 +35,12 @@ TInfoSinkBase &TInfoSinkBase::operator<<(const ImmutableString &str)
 
 void TInfoSinkBase::location(int file, int line)
 {
-    TPersistStringStream stream;
+    *this << file;
     if (line)
-        stream << file << ":" << line;
+        *this << ":" << line;
     else
-        stream << file << ":? ";
-    stream << ": ";
-
-    sink.append(stream.str());
+        *this << ":? ";
+    sink.append(": ");
 }
 
 }  // namespace sh
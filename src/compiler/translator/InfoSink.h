@@ -9,6 +9,10 @@
 
 #include <math.h>
 #include <stdlib.h>
+#include <cmath>
+#include <memory>
+#include <type_traits>
+
 #include "compiler/translator/Common.h"
 #include "compiler/translator/Severity.h"
 
@@ -40,7 +44,7 @@ class TInfoSinkBase
     template <typename T>
     TInfoSinkBase &operator<<(const T &t)
     {
-        TPersistStringStream stream;
+        TPersistStringStream &stream = formatStream();
         stream << t;
         sink.append(stream.str());
         return *this;
@@ -64,11 +68,19 @@ class TInfoSinkBase
     }
     TInfoSinkBase &operator<<(const TString &str)
     {
-        sink.append(str.c_str());
+        sink.append(str.c_str(), str.size());
         return *this;
     }
     TInfoSinkBase &operator<<(const ImmutableString &str);
 
+    // Integers are formatted directly into the sink instead of going through a string stream.
+    TInfoSinkBase &operator<<(int i) { return appendSigned(i); }
+    TInfoSinkBase &operator<<(long i) { return appendSigned(i); }
+    TInfoSinkBase &operator<<(long long i) { return appendSigned(i); }
+    TInfoSinkBase &operator<<(unsigned int i) { return appendUnsigned(i, false); }
+    TInfoSinkBase &operator<<(unsigned long i) { return appendUnsigned(i, false); }
+    TInfoSinkBase &operator<<(unsigned long long i) { return appendUnsigned(i, false); }
+
     // Make sure floats are written with correct precision.
     TInfoSinkBase &operator<<(float f)
     {
@@ -76,20 +88,33 @@ class TInfoSinkBase
         // does not have a fractional part, the default precision format does
         // not write the decimal portion which gets interpreted as integer by
         // the compiler.
-        TPersistStringStream stream;
         if (fractionalPart(f) == 0.0f)
         {
+            // Most float constants in shaders are small whole numbers. Those are written as
+            // integers with a ".0" suffix, which is exactly what the fixed format gives.
+            if (f > -1e18f && f < 1e18f)
+            {
+                if (f == 0.0f && std::signbit(f))
+                {
+                    sink.append("-0.0");
+                    return *this;
+                }
+                appendSigned(static_cast<long long>(f));
+                sink.append(".0");
+                return *this;
+            }
+            TPersistStringStream &stream = formatStream();
             stream.precision(1);
             stream << std::showpoint << std::fixed << f;
+            sink.append(stream.str());
         }
         else
         {
-            stream.unsetf(std::ios::fixed);
-            stream.unsetf(std::ios::scientific);
+            TPersistStringStream &stream = formatStream();
             stream.precision(8);
             stream << f;
+            sink.append(stream.str());
         }
-        sink.append(stream.str());
         return *this;
     }
     // Write boolean values as their names instead of integral value.
@@ -110,7 +135,59 @@ class TInfoSinkBase
     void location(int file, int line);
 
   private:
+    template <typename T>
+    TInfoSinkBase &appendSigned(T value)
+    {
+        using UnsignedT = typename std::make_unsigned<T>::type;
+        if (value < 0)
+        {
+            return appendUnsigned(static_cast<UnsignedT>(0) - static_cast<UnsignedT>(value), true);
+        }
+        return appendUnsigned(static_cast<UnsignedT>(value), false);
+    }
+
+    template <typename T>
+    TInfoSinkBase &appendUnsigned(T value, bool negative)
+    {
+        // Digits are written from the end of the buffer, which has room for any 64-bit value and a
+        // sign.
+        char buffer[24];
+        char *end   = buffer + sizeof(buffer);
+        char *begin = end;
+        do
+        {
+            *--begin = static_cast<char>('0' + value % 10u);
+            value /= 10u;
+        } while (value != 0u);
+        if (negative)
+        {
+            *--begin = '-';
+        }
+        sink.append(begin, end);
+        return *this;
+    }
+
+    // The stream used for the types that don't have a faster path is created once and reused,
+    // since constructing a stream is costly compared to formatting a single value.
+    TPersistStringStream &formatStream()
+    {
+        if (!mFormatStream)
+        {
+            mFormatStream.reset(new TPersistStringStream());
+        }
+        else
+        {
+            // Start from the state of a new stream.
+            mFormatStream->str(std::string());
+            mFormatStream->clear();
+            mFormatStream->flags(std::ios::dec | std::ios::skipws);
+            mFormatStream->precision(6);
+        }
+        return *mFormatStream;
+    }
+
     TPersistString sink;
+    std::unique_ptr<TPersistStringStream> mFormatStream;
 };
 
 class TInfoSink
@@ -5,6 +5,7 @@
 //
 
 #include "compiler/translator/InitializeDll.h"
+#include "compiler/translator/FunctionLocalTransforms.h"
 #include "compiler/translator/InitializeGlobals.h"
 
 #include "common/platform.h"
@@ -27,6 +28,7 @@ bool InitProcess()
 
 void DetachProcess()
 {
+    ShutDownFunctionLocalTransformThreads();
     FreePoolIndex();
 }
 
@@ -183,7 +183,8 @@ bool CanFoldAggregateBuiltInOp(TOperator op)
 //
 ////////////////////////////////////////////////////////////////
 
-TIntermExpression::TIntermExpression(const TType &t) : TIntermTyped(), mType(t)
+TIntermExpression::TIntermExpression(NodeKind kind, const TType &t)
+    : TIntermTyped(kind), mType(t)
 {
 }
 
@@ -308,7 +309,8 @@ bool TIntermAggregateBase::insertChildNodes(TIntermSequence::size_type position,
     return true;
 }
 
-TIntermSymbol::TIntermSymbol(const TVariable *variable) : TIntermTyped(), mVariable(variable)
+TIntermSymbol::TIntermSymbol(const TVariable *variable)
+    : TIntermTyped(NodeKind::Symbol), mVariable(variable)
 {
 }
 
@@ -367,7 +369,7 @@ TIntermAggregate::TIntermAggregate(const TFunction *func,
                                    const TType &type,
                                    TOperator op,
                                    TIntermSequence *arguments)
-    : TIntermOperator(op, type),
+    : TIntermOperator(NodeKind::Aggregate, op, type),
       mUseEmulatedFunction(false),
       mGotPrecisionFromChildren(false),
       mFunction(func)
@@ -736,7 +738,7 @@ bool TIntermCase::replaceChildNode(TIntermNode *original, TIntermNode *replaceme
     return false;
 }
 
-TIntermTyped::TIntermTyped(const TIntermTyped &node) : TIntermNode()
+TIntermTyped::TIntermTyped(const TIntermTyped &node) : TIntermNode(node.getKind())
 {
     // Copy constructor is disallowed for TIntermNode in order to disallow it for subclasses that
     // don't explicitly allow it, so normal TIntermNode constructor is used to construct the copy.
@@ -761,7 +763,7 @@ TIntermConstantUnion::TIntermConstantUnion(const TIntermConstantUnion &node)
 }
 
 TIntermFunctionPrototype::TIntermFunctionPrototype(const TFunction *function)
-    : TIntermTyped(), mFunction(function)
+    : TIntermTyped(NodeKind::FunctionPrototype), mFunction(function)
 {
     ASSERT(mFunction->symbolType() != SymbolType::Empty);
 }
@@ -1045,7 +1047,7 @@ void TIntermUnary::promote()
 }
 
 TIntermSwizzle::TIntermSwizzle(TIntermTyped *operand, const TVector<int> &swizzleOffsets)
-    : TIntermExpression(TType(EbtFloat, EbpUndefined)),
+    : TIntermExpression(NodeKind::Swizzle, TType(EbtFloat, EbpUndefined)),
       mOperand(operand),
       mSwizzleOffsets(swizzleOffsets)
 {
@@ -1054,13 +1056,13 @@ TIntermSwizzle::TIntermSwizzle(TIntermTyped *operand, const TVector<int> &swizzl
 }
 
 TIntermUnary::TIntermUnary(TOperator op, TIntermTyped *operand)
-    : TIntermOperator(op), mOperand(operand), mUseEmulatedFunction(false)
+    : TIntermOperator(NodeKind::Unary, op), mOperand(operand), mUseEmulatedFunction(false)
 {
     promote();
 }
 
 TIntermBinary::TIntermBinary(TOperator op, TIntermTyped *left, TIntermTyped *right)
-    : TIntermOperator(op), mLeft(left), mRight(right), mAddIndexClamp(false)
+    : TIntermOperator(NodeKind::Binary, op), mLeft(left), mRight(right), mAddIndexClamp(false)
 {
     promote();
 }
@@ -1075,7 +1077,7 @@ TIntermBinary *TIntermBinary::CreateComma(TIntermTyped *left,
 }
 
 TIntermInvariantDeclaration::TIntermInvariantDeclaration(TIntermSymbol *symbol, const TSourceLoc &line)
-    : TIntermNode(), mSymbol(symbol)
+    : TIntermNode(NodeKind::InvariantDeclaration), mSymbol(symbol)
 {
     ASSERT(symbol);
     setLine(line);
@@ -1084,7 +1086,7 @@ TIntermInvariantDeclaration::TIntermInvariantDeclaration(TIntermSymbol *symbol,
 TIntermTernary::TIntermTernary(TIntermTyped *cond,
                                TIntermTyped *trueExpression,
                                TIntermTyped *falseExpression)
-    : TIntermExpression(trueExpression->getType()),
+    : TIntermExpression(NodeKind::Ternary, trueExpression->getType()),
       mCondition(cond),
       mTrueExpression(trueExpression),
       mFalseExpression(falseExpression)
@@ -1098,7 +1100,12 @@ TIntermLoop::TIntermLoop(TLoopType type,
                          TIntermTyped *cond,
                          TIntermTyped *expr,
                          TIntermBlock *body)
-    : mType(type), mInit(init), mCond(cond), mExpr(expr), mBody(body)
+    : TIntermNode(NodeKind::Loop),
+      mType(type),
+      mInit(init),
+      mCond(cond),
+      mExpr(expr),
+      mBody(body)
 {
     // Declaration nodes with no children can appear if all the declarators just added constants to
     // the symbol table instead of generating code. They're no-ops so don't add them to the tree.
@@ -1110,7 +1117,7 @@ TIntermLoop::TIntermLoop(TLoopType type,
 }
 
 TIntermIfElse::TIntermIfElse(TIntermTyped *cond, TIntermBlock *trueB, TIntermBlock *falseB)
-    : TIntermNode(), mCondition(cond), mTrueBlock(trueB), mFalseBlock(falseB)
+    : TIntermNode(NodeKind::IfElse), mCondition(cond), mTrueBlock(trueB), mFalseBlock(falseB)
 {
     // Prune empty false blocks so that there won't be unnecessary operations done on it.
     if (mFalseBlock && mFalseBlock->getSequence()->empty())
@@ -1120,7 +1127,7 @@ TIntermIfElse::TIntermIfElse(TIntermTyped *cond, TIntermBlock *trueB, TIntermBlo
 }
 
 TIntermSwitch::TIntermSwitch(TIntermTyped *init, TIntermBlock *statementList)
-    : TIntermNode(), mInit(init), mStatementList(statementList)
+    : TIntermNode(NodeKind::Switch), mInit(init), mStatementList(statementList)
 {
     ASSERT(mStatementList);
 }
@@ -62,14 +62,48 @@ class TSymbolTable;
 class TFunction;
 class TVariable;
 
+// The concrete class of a node. Checking the class of a node and dispatching the traversal are done
+// by switching on this instead of through virtual calls.
+enum class NodeKind : unsigned char
+{
+    Symbol,
+    Raw,
+    ConstantUnion,
+    Swizzle,
+    Binary,
+    Unary,
+    Ternary,
+    IfElse,
+    Switch,
+    Case,
+    FunctionPrototype,
+    FunctionDefinition,
+    Aggregate,
+    Block,
+    InvariantDeclaration,
+    Declaration,
+    Loop,
+    Branch
+};
+
 //
 // Base class for the tree nodes
 //
 class TIntermNode : angle::NonCopyable
 {
   public:
-    POOL_ALLOCATOR_NEW_DELETE();
-    TIntermNode()
+    // Nodes are allocated from the pool like the rest of the AST, but also counted for the compile
+    // statistics.
+    void *operator new(size_t s)
+    {
+        TPoolAllocator *allocator = GetGlobalPoolAllocator();
+        allocator->countNodeAllocation();
+        return allocator->allocate(s);
+    }
+    void *operator new(size_t, void *where) { return where; }
+    void operator delete(void *) {}
+    void operator delete(void *, void *) {}
+    explicit TIntermNode(NodeKind kind) : mKind(kind)
     {
         // TODO: Move this to TSourceLoc constructor
         // after getting rid of TPublicType.
@@ -81,26 +115,31 @@ class TIntermNode : angle::NonCopyable
     const TSourceLoc &getLine() const { return mLine; }
     void setLine(const TSourceLoc &l) { mLine = l; }
 
-    virtual void traverse(TIntermTraverser *) = 0;
-    virtual TIntermTyped *getAsTyped() { return 0; }
-    virtual TIntermConstantUnion *getAsConstantUnion() { return 0; }
-    virtual TIntermFunctionDefinition *getAsFunctionDefinition() { return nullptr; }
-    virtual TIntermAggregate *getAsAggregate() { return 0; }
-    virtual TIntermBlock *getAsBlock() { return nullptr; }
-    virtual TIntermFunctionPrototype *getAsFunctionPrototypeNode() { return nullptr; }
-    virtual TIntermInvariantDeclaration *getAsInvariantDeclarationNode() { return nullptr; }
-    virtual TIntermDeclaration *getAsDeclarationNode() { return nullptr; }
-    virtual TIntermSwizzle *getAsSwizzleNode() { return nullptr; }
-    virtual TIntermBinary *getAsBinaryNode() { return 0; }
-    virtual TIntermUnary *getAsUnaryNode() { return 0; }
-    virtual TIntermTernary *getAsTernaryNode() { return nullptr; }
-    virtual TIntermIfElse *getAsIfElseNode() { return nullptr; }
-    virtual TIntermSwitch *getAsSwitchNode() { return 0; }
-    virtual TIntermCase *getAsCaseNode() { return 0; }
-    virtual TIntermSymbol *getAsSymbolNode() { return 0; }
-    virtual TIntermLoop *getAsLoopNode() { return 0; }
-    virtual TIntermRaw *getAsRawNode() { return 0; }
-    virtual TIntermBranch *getAsBranchNode() { return 0; }
+    NodeKind getKind() const { return mKind; }
+
+    // Calls the traverse*() function of |it| that matches the kind of the node.
+    void traverse(TIntermTraverser *it);
+
+    // These return nullptr if the node is not of the requested class.
+    TIntermTyped *getAsTyped();
+    TIntermConstantUnion *getAsConstantUnion();
+    TIntermFunctionDefinition *getAsFunctionDefinition();
+    TIntermAggregate *getAsAggregate();
+    TIntermBlock *getAsBlock();
+    TIntermFunctionPrototype *getAsFunctionPrototypeNode();
+    TIntermInvariantDeclaration *getAsInvariantDeclarationNode();
+    TIntermDeclaration *getAsDeclarationNode();
+    TIntermSwizzle *getAsSwizzleNode();
+    TIntermBinary *getAsBinaryNode();
+    TIntermUnary *getAsUnaryNode();
+    TIntermTernary *getAsTernaryNode();
+    TIntermIfElse *getAsIfElseNode();
+    TIntermSwitch *getAsSwitchNode();
+    TIntermCase *getAsCaseNode();
+    TIntermSymbol *getAsSymbolNode();
+    TIntermLoop *getAsLoopNode();
+    TIntermRaw *getAsRawNode();
+    TIntermBranch *getAsBranchNode();
 
     // Replace a child node. Return true if |original| is a child
     // node and it is replaced; otherwise, return false.
@@ -108,6 +147,9 @@ class TIntermNode : angle::NonCopyable
 
   protected:
     TSourceLoc mLine;
+
+  private:
+    const NodeKind mKind;
 };
 
 //
@@ -125,12 +167,10 @@ struct TIntermNodePair
 class TIntermTyped : public TIntermNode
 {
   public:
-    TIntermTyped() {}
+    explicit TIntermTyped(NodeKind kind) : TIntermNode(kind) {}
 
     virtual TIntermTyped *deepCopy() const = 0;
 
-    TIntermTyped *getAsTyped() override { return this; }
-
     virtual TIntermTyped *fold(TDiagnostics *diagnostics) { return this; }
 
     // getConstantValue() returns the constant value that this node represents, if any. It
@@ -189,8 +229,6 @@ class TIntermLoop : public TIntermNode
                 TIntermTyped *expr,
                 TIntermBlock *body);
 
-    TIntermLoop *getAsLoopNode() override { return this; }
-    void traverse(TIntermTraverser *it) override;
     bool replaceChildNode(TIntermNode *original, TIntermNode *replacement) override;
 
     TLoopType getType() const { return mType; }
@@ -218,10 +256,11 @@ class TIntermLoop : public TIntermNode
 class TIntermBranch : public TIntermNode
 {
   public:
-    TIntermBranch(TOperator op, TIntermTyped *e) : mFlowOp(op), mExpression(e) {}
+    TIntermBranch(TOperator op, TIntermTyped *e)
+        : TIntermNode(NodeKind::Branch), mFlowOp(op), mExpression(e)
+    {
+    }
 
-    void traverse(TIntermTraverser *it) override;
-    TIntermBranch *getAsBranchNode() override { return this; }
     bool replaceChildNode(TIntermNode *original, TIntermNode *replacement) override;
 
     TOperator getFlowOp() { return mFlowOp; }
@@ -253,8 +292,6 @@ class TIntermSymbol : public TIntermTyped
     ImmutableString getName() const;
     const TVariable &variable() const { return *mVariable; }
 
-    void traverse(TIntermTraverser *it) override;
-    TIntermSymbol *getAsSymbolNode() override { return this; }
     bool replaceChildNode(TIntermNode *, TIntermNode *) override { return false; }
 
   private:
@@ -267,7 +304,7 @@ class TIntermSymbol : public TIntermTyped
 class TIntermExpression : public TIntermTyped
 {
   public:
-    TIntermExpression(const TType &t);
+    TIntermExpression(NodeKind kind, const TType &t);
 
     const TType &getType() const override { return mType; }
 
@@ -288,7 +325,7 @@ class TIntermRaw : public TIntermExpression
 {
   public:
     TIntermRaw(const TType &type, const ImmutableString &rawText)
-        : TIntermExpression(type), mRawText(rawText)
+        : TIntermExpression(NodeKind::Raw, type), mRawText(rawText)
     {
     }
     TIntermRaw(const TIntermRaw &) = delete;
@@ -303,9 +340,7 @@ class TIntermRaw : public TIntermExpression
 
     const ImmutableString &getRawText() const { return mRawText; }
 
-    void traverse(TIntermTraverser *it) override;
 
-    TIntermRaw *getAsRawNode() override { return this; }
     bool replaceChildNode(TIntermNode *, TIntermNode *) override { return false; }
 
   protected:
@@ -322,7 +357,7 @@ class TIntermConstantUnion : public TIntermExpression
 {
   public:
     TIntermConstantUnion(const TConstantUnion *unionPointer, const TType &type)
-        : TIntermExpression(type), mUnionArrayPointer(unionPointer)
+        : TIntermExpression(NodeKind::ConstantUnion, type), mUnionArrayPointer(unionPointer)
     {
         ASSERT(unionPointer);
     }
@@ -351,8 +386,6 @@ class TIntermConstantUnion : public TIntermExpression
         return mUnionArrayPointer ? mUnionArrayPointer[index].getBConst() : false;
     }
 
-    TIntermConstantUnion *getAsConstantUnion() override { return this; }
-    void traverse(TIntermTraverser *it) override;
     bool replaceChildNode(TIntermNode *, TIntermNode *) override { return false; }
 
     TConstantUnion *foldUnaryNonComponentWise(TOperator op);
@@ -404,8 +437,14 @@ class TIntermOperator : public TIntermExpression
     bool hasSideEffects() const override { return isAssignment(); }
 
   protected:
-    TIntermOperator(TOperator op) : TIntermExpression(TType(EbtFloat, EbpUndefined)), mOp(op) {}
-    TIntermOperator(TOperator op, const TType &type) : TIntermExpression(type), mOp(op) {}
+    TIntermOperator(NodeKind kind, TOperator op)
+        : TIntermExpression(kind, TType(EbtFloat, EbpUndefined)), mOp(op)
+    {
+    }
+    TIntermOperator(NodeKind kind, TOperator op, const TType &type)
+        : TIntermExpression(kind, type), mOp(op)
+    {
+    }
 
     TIntermOperator(const TIntermOperator &) = default;
 
@@ -421,13 +460,12 @@ class TIntermSwizzle : public TIntermExpression
 
     TIntermTyped *deepCopy() const override { return new TIntermSwizzle(*this); }
 
-    TIntermSwizzle *getAsSwizzleNode() override { return this; };
-    void traverse(TIntermTraverser *it) override;
     bool replaceChildNode(TIntermNode *original, TIntermNode *replacement) override;
 
     bool hasSideEffects() const override { return mOperand->hasSideEffects(); }
 
     TIntermTyped *getOperand() { return mOperand; }
+    const TVector<int> &getSwizzleOffsets() const { return mSwizzleOffsets; }
     void writeOffsetsAsXYZW(TInfoSinkBase *out) const;
 
     bool hasDuplicateOffsets() const;
@@ -464,8 +502,6 @@ class TIntermBinary : public TIntermOperator
     static TOperator GetMulOpBasedOnOperands(const TType &left, const TType &right);
     static TOperator GetMulAssignOpBasedOnOperands(const TType &left, const TType &right);
 
-    TIntermBinary *getAsBinaryNode() override { return this; };
-    void traverse(TIntermTraverser *it) override;
     bool replaceChildNode(TIntermNode *original, TIntermNode *replacement) override;
 
     bool hasSideEffects() const override
@@ -507,8 +543,6 @@ class TIntermUnary : public TIntermOperator
 
     TIntermTyped *deepCopy() const override { return new TIntermUnary(*this); }
 
-    void traverse(TIntermTraverser *it) override;
-    TIntermUnary *getAsUnaryNode() override { return this; }
     bool replaceChildNode(TIntermNode *original, TIntermNode *replacement) override;
 
     bool hasSideEffects() const override { return isAssignment() || mOperand->hasSideEffects(); }
@@ -579,8 +613,6 @@ class TIntermAggregate : public TIntermOperator, public TIntermAggregateBase
     bool hasConstantValue() const override;
     const TConstantUnion *getConstantValue() const override;
 
-    TIntermAggregate *getAsAggregate() override { return this; }
-    void traverse(TIntermTraverser *it) override;
     bool replaceChildNode(TIntermNode *original, TIntermNode *replacement) override;
 
     bool hasSideEffects() const override;
@@ -641,11 +673,9 @@ class TIntermAggregate : public TIntermOperator, public TIntermAggregateBase
 class TIntermBlock : public TIntermNode, public TIntermAggregateBase
 {
   public:
-    TIntermBlock() : TIntermNode() {}
+    TIntermBlock() : TIntermNode(NodeKind::Block) {}
     ~TIntermBlock() {}
 
-    TIntermBlock *getAsBlock() override { return this; }
-    void traverse(TIntermTraverser *it) override;
     bool replaceChildNode(TIntermNode *original, TIntermNode *replacement) override;
 
     // Only intended for initially building the block.
@@ -666,8 +696,6 @@ class TIntermFunctionPrototype : public TIntermTyped, public TIntermAggregateBas
     TIntermFunctionPrototype(const TFunction *function);
     ~TIntermFunctionPrototype() {}
 
-    TIntermFunctionPrototype *getAsFunctionPrototypeNode() override { return this; }
-    void traverse(TIntermTraverser *it) override;
     bool replaceChildNode(TIntermNode *original, TIntermNode *replacement) override;
 
     const TType &getType() const override;
@@ -703,14 +731,12 @@ class TIntermFunctionDefinition : public TIntermNode
 {
   public:
     TIntermFunctionDefinition(TIntermFunctionPrototype *prototype, TIntermBlock *body)
-        : TIntermNode(), mPrototype(prototype), mBody(body)
+        : TIntermNode(NodeKind::FunctionDefinition), mPrototype(prototype), mBody(body)
     {
         ASSERT(prototype != nullptr);
         ASSERT(body != nullptr);
     }
 
-    TIntermFunctionDefinition *getAsFunctionDefinition() override { return this; }
-    void traverse(TIntermTraverser *it) override;
     bool replaceChildNode(TIntermNode *original, TIntermNode *replacement) override;
 
     TIntermFunctionPrototype *getFunctionPrototype() const { return mPrototype; }
@@ -727,11 +753,9 @@ class TIntermFunctionDefinition : public TIntermNode
 class TIntermDeclaration : public TIntermNode, public TIntermAggregateBase
 {
   public:
-    TIntermDeclaration() : TIntermNode() {}
+    TIntermDeclaration() : TIntermNode(NodeKind::Declaration) {}
     ~TIntermDeclaration() {}
 
-    TIntermDeclaration *getAsDeclarationNode() override { return this; }
-    void traverse(TIntermTraverser *it) override;
     bool replaceChildNode(TIntermNode *original, TIntermNode *replacement) override;
 
     // Only intended for initially building the declaration.
@@ -751,11 +775,9 @@ class TIntermInvariantDeclaration : public TIntermNode
   public:
     TIntermInvariantDeclaration(TIntermSymbol *symbol, const TSourceLoc &line);
 
-    virtual TIntermInvariantDeclaration *getAsInvariantDeclarationNode() override { return this; }
 
     TIntermSymbol *getSymbol() { return mSymbol; }
 
-    void traverse(TIntermTraverser *it) override;
     bool replaceChildNode(TIntermNode *original, TIntermNode *replacement) override;
 
   private:
@@ -768,13 +790,11 @@ class TIntermTernary : public TIntermExpression
   public:
     TIntermTernary(TIntermTyped *cond, TIntermTyped *trueExpression, TIntermTyped *falseExpression);
 
-    void traverse(TIntermTraverser *it) override;
     bool replaceChildNode(TIntermNode *original, TIntermNode *replacement) override;
 
     TIntermTyped *getCondition() const { return mCondition; }
     TIntermTyped *getTrueExpression() const { return mTrueExpression; }
     TIntermTyped *getFalseExpression() const { return mFalseExpression; }
-    TIntermTernary *getAsTernaryNode() override { return this; }
 
     TIntermTyped *deepCopy() const override { return new TIntermTernary(*this); }
 
@@ -803,13 +823,11 @@ class TIntermIfElse : public TIntermNode
   public:
     TIntermIfElse(TIntermTyped *cond, TIntermBlock *trueB, TIntermBlock *falseB);
 
-    void traverse(TIntermTraverser *it) override;
     bool replaceChildNode(TIntermNode *original, TIntermNode *replacement) override;
 
     TIntermTyped *getCondition() const { return mCondition; }
     TIntermBlock *getTrueBlock() const { return mTrueBlock; }
     TIntermBlock *getFalseBlock() const { return mFalseBlock; }
-    TIntermIfElse *getAsIfElseNode() override { return this; }
 
   protected:
     TIntermTyped *mCondition;
@@ -825,10 +843,8 @@ class TIntermSwitch : public TIntermNode
   public:
     TIntermSwitch(TIntermTyped *init, TIntermBlock *statementList);
 
-    void traverse(TIntermTraverser *it) override;
     bool replaceChildNode(TIntermNode *original, TIntermNode *replacement) override;
 
-    TIntermSwitch *getAsSwitchNode() override { return this; }
 
     TIntermTyped *getInit() { return mInit; }
     TIntermBlock *getStatementList() { return mStatementList; }
@@ -847,12 +863,10 @@ class TIntermSwitch : public TIntermNode
 class TIntermCase : public TIntermNode
 {
   public:
-    TIntermCase(TIntermTyped *condition) : TIntermNode(), mCondition(condition) {}
+    TIntermCase(TIntermTyped *condition) : TIntermNode(NodeKind::Case), mCondition(condition) {}
 
-    void traverse(TIntermTraverser *it) override;
     bool replaceChildNode(TIntermNode *original, TIntermNode *replacement) override;
 
-    TIntermCase *getAsCaseNode() override { return this; }
 
     bool hasCondition() const { return mCondition != nullptr; }
     TIntermTyped *getCondition() const { return mCondition; }
@@ -861,6 +875,119 @@ class TIntermCase : public TIntermNode
     TIntermTyped *mCondition;
 };
 
+inline TIntermTyped *TIntermNode::getAsTyped()
+{
+    switch (mKind)
+    {
+        case NodeKind::Symbol:
+        case NodeKind::Raw:
+        case NodeKind::ConstantUnion:
+        case NodeKind::Swizzle:
+        case NodeKind::Binary:
+        case NodeKind::Unary:
+        case NodeKind::Ternary:
+        case NodeKind::Aggregate:
+        case NodeKind::FunctionPrototype:
+            return static_cast<TIntermTyped *>(this);
+        default:
+            return nullptr;
+    }
+}
+
+inline TIntermConstantUnion *TIntermNode::getAsConstantUnion()
+{
+    return mKind == NodeKind::ConstantUnion ? static_cast<TIntermConstantUnion *>(this) : nullptr;
+}
+
+inline TIntermFunctionDefinition *TIntermNode::getAsFunctionDefinition()
+{
+    return mKind == NodeKind::FunctionDefinition ? static_cast<TIntermFunctionDefinition *>(this)
+                                                 : nullptr;
+}
+
+inline TIntermAggregate *TIntermNode::getAsAggregate()
+{
+    return mKind == NodeKind::Aggregate ? static_cast<TIntermAggregate *>(this) : nullptr;
+}
+
+inline TIntermBlock *TIntermNode::getAsBlock()
+{
+    return mKind == NodeKind::Block ? static_cast<TIntermBlock *>(this) : nullptr;
+}
+
+inline TIntermFunctionPrototype *TIntermNode::getAsFunctionPrototypeNode()
+{
+    return mKind == NodeKind::FunctionPrototype ? static_cast<TIntermFunctionPrototype *>(this)
+                                                : nullptr;
+}
+
+inline TIntermInvariantDeclaration *TIntermNode::getAsInvariantDeclarationNode()
+{
+    return mKind == NodeKind::InvariantDeclaration
+               ? static_cast<TIntermInvariantDeclaration *>(this)
+               : nullptr;
+}
+
+inline TIntermDeclaration *TIntermNode::getAsDeclarationNode()
+{
+    return mKind == NodeKind::Declaration ? static_cast<TIntermDeclaration *>(this) : nullptr;
+}
+
+inline TIntermSwizzle *TIntermNode::getAsSwizzleNode()
+{
+    return mKind == NodeKind::Swizzle ? static_cast<TIntermSwizzle *>(this) : nullptr;
+}
+
+inline TIntermBinary *TIntermNode::getAsBinaryNode()
+{
+    return mKind == NodeKind::Binary ? static_cast<TIntermBinary *>(this) : nullptr;
+}
+
+inline TIntermUnary *TIntermNode::getAsUnaryNode()
+{
+    return mKind == NodeKind::Unary ? static_cast<TIntermUnary *>(this) : nullptr;
+}
+
+inline TIntermTernary *TIntermNode::getAsTernaryNode()
+{
+    return mKind == NodeKind::Ternary ? static_cast<TIntermTernary *>(this) : nullptr;
+}
+
+inline TIntermIfElse *TIntermNode::getAsIfElseNode()
+{
+    return mKind == NodeKind::IfElse ? static_cast<TIntermIfElse *>(this) : nullptr;
+}
+
+inline TIntermSwitch *TIntermNode::getAsSwitchNode()
+{
+    return mKind == NodeKind::Switch ? static_cast<TIntermSwitch *>(this) : nullptr;
+}
+
+inline TIntermCase *TIntermNode::getAsCaseNode()
+{
+    return mKind == NodeKind::Case ? static_cast<TIntermCase *>(this) : nullptr;
+}
+
+inline TIntermSymbol *TIntermNode::getAsSymbolNode()
+{
+    return mKind == NodeKind::Symbol ? static_cast<TIntermSymbol *>(this) : nullptr;
+}
+
+inline TIntermLoop *TIntermNode::getAsLoopNode()
+{
+    return mKind == NodeKind::Loop ? static_cast<TIntermLoop *>(this) : nullptr;
+}
+
+inline TIntermRaw *TIntermNode::getAsRawNode()
+{
+    return mKind == NodeKind::Raw ? static_cast<TIntermRaw *>(this) : nullptr;
+}
+
+inline TIntermBranch *TIntermNode::getAsBranchNode()
+{
+    return mKind == NodeKind::Branch ? static_cast<TIntermBranch *>(this) : nullptr;
+}
+
 }  // namespace sh
 
 #endif  // COMPILER_TRANSLATOR_INTERMNODE_H_
@@ -32,6 +32,115 @@ const TFunction *LookUpBuiltInFunction(const char *name,
     return nullptr;
 }
 
+TIntermNode *DeepCopyNode(TIntermNode *node);
+
+TIntermTyped *DeepCopyTyped(TIntermTyped *node)
+{
+    return node != nullptr ? node->deepCopy() : nullptr;
+}
+
+TIntermBlock *DeepCopyBlock(TIntermBlock *block)
+{
+    if (block == nullptr)
+    {
+        return nullptr;
+    }
+    TIntermBlock *copy = new TIntermBlock();
+    for (TIntermNode *statement : *block->getSequence())
+    {
+        copy->appendStatement(DeepCopyNode(statement));
+    }
+    copy->setLine(block->getLine());
+    return copy;
+}
+
+TIntermFunctionPrototype *DeepCopyFunctionPrototype(TIntermFunctionPrototype *prototype)
+{
+    TIntermFunctionPrototype *copy = new TIntermFunctionPrototype(prototype->getFunction());
+    for (TIntermNode *parameter : *prototype->getSequence())
+    {
+        copy->appendParameter(parameter->getAsSymbolNode()->deepCopy()->getAsSymbolNode());
+    }
+    copy->setLine(prototype->getLine());
+    return copy;
+}
+
+TIntermNode *DeepCopyNode(TIntermNode *node)
+{
+    if (node == nullptr)
+    {
+        return nullptr;
+    }
+
+    TIntermNode *copy = nullptr;
+    if (TIntermBlock *block = node->getAsBlock())
+    {
+        return DeepCopyBlock(block);
+    }
+    else if (TIntermFunctionPrototype *prototype = node->getAsFunctionPrototypeNode())
+    {
+        return DeepCopyFunctionPrototype(prototype);
+    }
+    else if (TIntermTyped *typed = node->getAsTyped())
+    {
+        return typed->deepCopy();
+    }
+    else if (TIntermDeclaration *declaration = node->getAsDeclarationNode())
+    {
+        TIntermDeclaration *declarationCopy = new TIntermDeclaration();
+        for (TIntermNode *declarator : *declaration->getSequence())
+        {
+            declarationCopy->appendDeclarator(declarator->getAsTyped()->deepCopy());
+        }
+        copy = declarationCopy;
+    }
+    else if (TIntermFunctionDefinition *definition = node->getAsFunctionDefinition())
+    {
+        copy = new TIntermFunctionDefinition(
+            DeepCopyFunctionPrototype(definition->getFunctionPrototype()),
+            DeepCopyBlock(definition->getBody()));
+    }
+    else if (TIntermInvariantDeclaration *invariant = node->getAsInvariantDeclarationNode())
+    {
+        copy = new TIntermInvariantDeclaration(
+            invariant->getSymbol()->deepCopy()->getAsSymbolNode(), invariant->getLine());
+    }
+    else if (TIntermIfElse *ifElse = node->getAsIfElseNode())
+    {
+        copy = new TIntermIfElse(ifElse->getCondition()->deepCopy(),
+                                 DeepCopyBlock(ifElse->getTrueBlock()),
+                                 DeepCopyBlock(ifElse->getFalseBlock()));
+    }
+    else if (TIntermSwitch *switchNode = node->getAsSwitchNode())
+    {
+        copy = new TIntermSwitch(switchNode->getInit()->deepCopy(),
+                                 DeepCopyBlock(switchNode->getStatementList()));
+    }
+    else if (TIntermCase *caseNode = node->getAsCaseNode())
+    {
+        copy = new TIntermCase(DeepCopyTyped(caseNode->getCondition()));
+    }
+    else if (TIntermLoop *loop = node->getAsLoopNode())
+    {
+        copy = new TIntermLoop(loop->getType(), DeepCopyNode(loop->getInit()),
+                               DeepCopyTyped(loop->getCondition()),
+                               DeepCopyTyped(loop->getExpression()),
+                               DeepCopyBlock(loop->getBody()));
+    }
+    else if (TIntermBranch *branch = node->getAsBranchNode())
+    {
+        copy = new TIntermBranch(branch->getFlowOp(), DeepCopyTyped(branch->getExpression()));
+    }
+    else
+    {
+        // Raw nodes are only added by the HLSL output, after the tree has been transformed.
+        UNREACHABLE();
+        return nullptr;
+    }
+    copy->setLine(node->getLine());
+    return copy;
+}
+
 }  // anonymous namespace
 
 TIntermFunctionPrototype *CreateInternalFunctionPrototypeNode(const TFunction &func)
@@ -234,6 +343,11 @@ TIntermBlock *EnsureBlock(TIntermNode *node)
     return blockNode;
 }
 
+TIntermBlock *DeepCopyTree(TIntermBlock *root)
+{
+    return DeepCopyBlock(root);
+}
+
 TIntermSymbol *ReferenceGlobalVariable(const ImmutableString &name, const TSymbolTable &symbolTable)
 {
     const TVariable *var = reinterpret_cast<const TVariable *>(symbolTable.findGlobal(name));
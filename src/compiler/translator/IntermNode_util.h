@@ -48,6 +48,10 @@ TVariable *DeclareTempVariable(TSymbolTable *symbolTable,
 // If the input node is not a block node, put it inside a block node and return that.
 TIntermBlock *EnsureBlock(TIntermNode *node);
 
+// Copies a whole AST into the current pool. The copy shares the symbols of the original, but none
+// of its nodes.
+TIntermBlock *DeepCopyTree(TIntermBlock *root);
+
 // Should be called from inside Compiler::compileTreeImpl() where the global level is in scope.
 TIntermSymbol *ReferenceGlobalVariable(const ImmutableString &name,
                                        const TSymbolTable &symbolTable);
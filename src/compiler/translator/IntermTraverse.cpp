@@ -13,94 +13,68 @@
 namespace sh
 {
 
-void TIntermSymbol::traverse(TIntermTraverser *it)
+void TIntermNode::traverse(TIntermTraverser *it)
 {
-    it->traverseSymbol(this);
-}
-
-void TIntermRaw::traverse(TIntermTraverser *it)
-{
-    it->traverseRaw(this);
-}
-
-void TIntermConstantUnion::traverse(TIntermTraverser *it)
-{
-    it->traverseConstantUnion(this);
-}
-
-void TIntermSwizzle::traverse(TIntermTraverser *it)
-{
-    it->traverseSwizzle(this);
-}
-
-void TIntermBinary::traverse(TIntermTraverser *it)
-{
-    it->traverseBinary(this);
-}
-
-void TIntermUnary::traverse(TIntermTraverser *it)
-{
-    it->traverseUnary(this);
-}
-
-void TIntermTernary::traverse(TIntermTraverser *it)
-{
-    it->traverseTernary(this);
-}
-
-void TIntermIfElse::traverse(TIntermTraverser *it)
-{
-    it->traverseIfElse(this);
-}
-
-void TIntermSwitch::traverse(TIntermTraverser *it)
-{
-    it->traverseSwitch(this);
-}
-
-void TIntermCase::traverse(TIntermTraverser *it)
-{
-    it->traverseCase(this);
-}
-
-void TIntermFunctionDefinition::traverse(TIntermTraverser *it)
-{
-    it->traverseFunctionDefinition(this);
-}
-
-void TIntermBlock::traverse(TIntermTraverser *it)
-{
-    it->traverseBlock(this);
-}
-
-void TIntermInvariantDeclaration::traverse(TIntermTraverser *it)
-{
-    it->traverseInvariantDeclaration(this);
-}
-
-void TIntermDeclaration::traverse(TIntermTraverser *it)
-{
-    it->traverseDeclaration(this);
-}
-
-void TIntermFunctionPrototype::traverse(TIntermTraverser *it)
-{
-    it->traverseFunctionPrototype(this);
-}
-
-void TIntermAggregate::traverse(TIntermTraverser *it)
-{
-    it->traverseAggregate(this);
-}
-
-void TIntermLoop::traverse(TIntermTraverser *it)
-{
-    it->traverseLoop(this);
-}
-
-void TIntermBranch::traverse(TIntermTraverser *it)
-{
-    it->traverseBranch(this);
+    switch (mKind)
+    {
+        case NodeKind::Symbol:
+            it->traverseSymbol(static_cast<TIntermSymbol *>(this));
+            break;
+        case NodeKind::Raw:
+            it->traverseRaw(static_cast<TIntermRaw *>(this));
+            break;
+        case NodeKind::ConstantUnion:
+            it->traverseConstantUnion(static_cast<TIntermConstantUnion *>(this));
+            break;
+        case NodeKind::Swizzle:
+            it->traverseSwizzle(static_cast<TIntermSwizzle *>(this));
+            break;
+        case NodeKind::Binary:
+            it->traverseBinary(static_cast<TIntermBinary *>(this));
+            break;
+        case NodeKind::Unary:
+            it->traverseUnary(static_cast<TIntermUnary *>(this));
+            break;
+        case NodeKind::Ternary:
+            it->traverseTernary(static_cast<TIntermTernary *>(this));
+            break;
+        case NodeKind::IfElse:
+            it->traverseIfElse(static_cast<TIntermIfElse *>(this));
+            break;
+        case NodeKind::Switch:
+            it->traverseSwitch(static_cast<TIntermSwitch *>(this));
+            break;
+        case NodeKind::Case:
+            it->traverseCase(static_cast<TIntermCase *>(this));
+            break;
+        case NodeKind::FunctionPrototype:
+            it->traverseFunctionPrototype(static_cast<TIntermFunctionPrototype *>(this));
+            break;
+        case NodeKind::FunctionDefinition:
+            it->traverseFunctionDefinition(static_cast<TIntermFunctionDefinition *>(this));
+            break;
+        case NodeKind::Aggregate:
+            it->traverseAggregate(static_cast<TIntermAggregate *>(this));
+            break;
+        case NodeKind::Block:
+            it->traverseBlock(static_cast<TIntermBlock *>(this));
+            break;
+        case NodeKind::InvariantDeclaration:
+            it->traverseInvariantDeclaration(static_cast<TIntermInvariantDeclaration *>(this));
+            break;
+        case NodeKind::Declaration:
+            it->traverseDeclaration(static_cast<TIntermDeclaration *>(this));
+            break;
+        case NodeKind::Loop:
+            it->traverseLoop(static_cast<TIntermLoop *>(this));
+            break;
+        case NodeKind::Branch:
+            it->traverseBranch(static_cast<TIntermBranch *>(this));
+            break;
+        default:
+            UNREACHABLE();
+            break;
+    }
 }
 
 TIntermTraverser::TIntermTraverser(bool preVisit,
@@ -113,8 +87,14 @@ TIntermTraverser::TIntermTraverser(bool preVisit,
       mDepth(-1),
       mMaxDepth(0),
       mInGlobalScope(true),
-      mSymbolTable(symbolTable)
+      mSymbolTable(symbolTable),
+      mNodeVisitCounter(nullptr)
 {
+    TPoolAllocator *allocator = GetGlobalPoolAllocator();
+    if (allocator)
+    {
+        mNodeVisitCounter = allocator->getNodeVisitCounter();
+    }
 }
 
 TIntermTraverser::~TIntermTraverser()
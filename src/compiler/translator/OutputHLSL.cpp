@@ -268,9 +268,9 @@ void OutputHLSL::output(TIntermNode *treeRoot, TInfoSinkBase &objSink)
     header(mHeader, std140Structs, &builtInFunctionEmulator);
     mInfoSinkStack.pop();
 
-    objSink << mHeader.c_str();
-    objSink << mBody.c_str();
-    objSink << mFooter.c_str();
+    objSink << mHeader.str();
+    objSink << mBody.str();
+    objSink << mFooter.str();
 
     builtInFunctionEmulator.cleanup();
 }
@@ -0,0 +1,2590 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// OutputSPIRV: Generates SPIR-V for Vulkan directly from the validated AST.
+//
+
+#include "compiler/translator/OutputSPIRV.h"
+
+#include <algorithm>
+#include <map>
+#include <set>
+
+#include "angle_gl.h"
+#include "common/utilities.h"
+#include "compiler/translator/IntermNode.h"
+#include "compiler/translator/Symbol.h"
+#include "compiler/translator/blocklayout.h"
+#include "compiler/translator/util.h"
+
+namespace sh
+{
+
+namespace
+{
+
+constexpr uint32_t kFunctionControlNone  = 0;
+constexpr uint32_t kLoopControlNone      = 0;
+constexpr uint32_t kSelectionControlNone = 0;
+
+constexpr char kDefaultUniformsName[] = "defaultUniforms";
+
+// Where a variable is stored. The members of gl_PerVertex and of the default uniform block are
+// reached through indices into the block variable.
+struct SymbolInfo
+{
+    SymbolInfo() : id(0), storageClass(spirv::StorageClassFunction), inDefaultUniforms(false) {}
+
+    spirv::IdRef id;
+    spirv::StorageClass storageClass;
+    std::vector<spirv::IdRef> indices;
+    bool inDefaultUniforms;
+};
+
+// An lvalue: an access chain into a variable, optionally followed by a swizzle of the vector it
+// leads to. |pointeeType| is the type the access chain leads to, before the swizzle.
+struct AccessChain
+{
+    AccessChain()
+        : baseId(0),
+          storageClass(spirv::StorageClassFunction),
+          inDefaultUniforms(false),
+          pointeeType(nullptr)
+    {
+    }
+
+    spirv::IdRef baseId;
+    spirv::StorageClass storageClass;
+    std::vector<spirv::IdRef> indices;
+    std::vector<int> swizzle;
+    bool inDefaultUniforms;
+    const TType *pointeeType;
+};
+
+struct FunctionInfo
+{
+    spirv::IdRef id;
+    spirv::IdRef returnTypeId;
+    spirv::IdRef typeId;
+};
+
+struct LoopInfo
+{
+    spirv::IdRef continueLabel;
+    spirv::IdRef mergeLabel;
+};
+
+bool IsSupportedSampler(TBasicType type)
+{
+    switch (type)
+    {
+        case EbtSampler2D:
+        case EbtSampler3D:
+        case EbtSamplerCube:
+        case EbtSampler2DArray:
+        case EbtISampler2D:
+        case EbtISampler3D:
+        case EbtISamplerCube:
+        case EbtISampler2DArray:
+        case EbtUSampler2D:
+        case EbtUSampler3D:
+        case EbtUSamplerCube:
+        case EbtUSampler2DArray:
+            return true;
+        default:
+            return false;
+    }
+}
+
+int GetConstantIndex(TIntermTyped *index)
+{
+    TIntermConstantUnion *constant = index->getAsConstantUnion();
+    ASSERT(constant);
+    return constant->getBasicType() == EbtUInt ? static_cast<int>(constant->getUConst(0))
+                                               : constant->getIConst(0);
+}
+
+// The number of elements that an index into |type| can select.
+int GetIndexableSize(const TType &type)
+{
+    if (type.isArray())
+    {
+        return static_cast<int>(type.getOutermostArraySize());
+    }
+    return type.isMatrix() ? type.getCols() : type.getNominalSize();
+}
+
+spirv::Op SelectOp(TBasicType type,
+                   spirv::Op floatOp,
+                   spirv::Op signedOp,
+                   spirv::Op unsignedOp,
+                   spirv::Op boolOp)
+{
+    switch (type)
+    {
+        case EbtFloat:
+            return floatOp;
+        case EbtInt:
+            return signedOp;
+        case EbtUInt:
+            return unsignedOp;
+        default:
+            ASSERT(type == EbtBool);
+            return boolOp;
+    }
+}
+
+TOperator GetCompoundAssignmentOp(TOperator op)
+{
+    switch (op)
+    {
+        case EOpAddAssign:
+            return EOpAdd;
+        case EOpSubAssign:
+            return EOpSub;
+        case EOpMulAssign:
+            return EOpMul;
+        case EOpVectorTimesMatrixAssign:
+            return EOpVectorTimesMatrix;
+        case EOpVectorTimesScalarAssign:
+            return EOpVectorTimesScalar;
+        case EOpMatrixTimesScalarAssign:
+            return EOpMatrixTimesScalar;
+        case EOpMatrixTimesMatrixAssign:
+            return EOpMatrixTimesMatrix;
+        case EOpDivAssign:
+            return EOpDiv;
+        case EOpIModAssign:
+            return EOpIMod;
+        case EOpBitShiftLeftAssign:
+            return EOpBitShiftLeft;
+        case EOpBitShiftRightAssign:
+            return EOpBitShiftRight;
+        case EOpBitwiseAndAssign:
+            return EOpBitwiseAnd;
+        case EOpBitwiseXorAssign:
+            return EOpBitwiseXor;
+        case EOpBitwiseOrAssign:
+            return EOpBitwiseOr;
+        default:
+            return EOpNull;
+    }
+}
+
+class SPIRVGenerator : angle::NonCopyable
+{
+  public:
+    SPIRVGenerator(sh::GLenum shaderType, int shaderVersion, const std::vector<Uniform> &uniforms);
+
+    bool generate(TIntermBlock *root, spirv::Blob *spirvOut);
+
+  private:
+    void markUnsupported() { mUnsupported = true; }
+
+    // Types and constants.
+    spirv::IdRef getTypeId(const TType &type);
+    spirv::IdRef getPointeeTypeId(const AccessChain &chain);
+    spirv::IdRef getScalarTypeId(TBasicType type) { return mBuilder.getBasicType(type, 1); }
+    spirv::IdRef getScalarConstant(TBasicType type, const TConstantUnion &value);
+    spirv::IdRef getScalarConstant(TBasicType type, int value);
+    spirv::IdRef emitConstant(const TType &type, const TConstantUnion *values);
+
+    // Variables.
+    const SymbolInfo &getSymbol(const TVariable &variable);
+    void declareInterfaceVariable(const TVariable &variable, SymbolInfo *info);
+    void declareBuiltInVariable(const TVariable &variable, SymbolInfo *info);
+    void declareDefaultUniform(const TVariable &variable, SymbolInfo *info);
+    spirv::IdRef declareBuiltIn(spirv::IdRef typeId,
+                                spirv::StorageClass storageClass,
+                                spirv::BuiltIn builtIn,
+                                const char *name);
+    spirv::IdRef getPerVertexVariable();
+    spirv::IdRef getDefaultUniformsVariable();
+    spirv::IdRef declareLocalVariable(spirv::IdRef typeId, const char *name);
+    bool isInvariant(const TVariable &variable) const;
+
+    // Functions and statements.
+    void declareFunctions(TIntermBlock *root);
+    void emitFunction(TIntermFunctionDefinition *node);
+    void emitGlobalDeclaration(TIntermDeclaration *node);
+    void emitStatement(TIntermNode *node);
+    void emitBlock(TIntermBlock *node);
+    void emitDeclaration(TIntermDeclaration *node);
+    void emitIfElse(TIntermIfElse *node);
+    void emitLoop(TIntermLoop *node);
+    void emitBranch(TIntermBranch *node);
+
+    // Control flow. Instructions after a terminator start a new, unreachable block.
+    void startBlock(spirv::IdRef label);
+    void ensureBlock();
+    void terminate(spirv::Op op, std::initializer_list<uint32_t> operands);
+
+    // Expressions.
+    spirv::IdRef emitExpression(TIntermTyped *node);
+    bool isLValue(TIntermTyped *node);
+    AccessChain emitLValue(TIntermTyped *node);
+    spirv::IdRef emitIndexValue(TIntermTyped *indexNode, const TType &indexedType, bool clamp);
+    spirv::IdRef getAccessChainPointer(const AccessChain &chain);
+    spirv::IdRef load(const AccessChain &chain);
+    void store(const AccessChain &chain, spirv::IdRef value);
+    spirv::IdRef emitSwizzle(spirv::IdRef value,
+                             TBasicType basicType,
+                             const std::vector<int> &swizzle);
+    spirv::IdRef emitIndex(TIntermBinary *node);
+    spirv::IdRef emitBinary(TIntermBinary *node);
+    spirv::IdRef emitShortCircuit(TIntermBinary *node);
+    spirv::IdRef emitUnary(TIntermUnary *node);
+    spirv::IdRef emitIncrementDecrement(TIntermUnary *node);
+    spirv::IdRef emitTernary(TIntermTernary *node);
+    spirv::IdRef emitAggregate(TIntermAggregate *node);
+    spirv::IdRef emitConstructor(TIntermAggregate *node);
+    spirv::IdRef emitFunctionCall(TIntermAggregate *node);
+    spirv::IdRef emitTextureCall(TIntermAggregate *node);
+    spirv::IdRef emitBuiltInOp(TOperator op,
+                               const TType &resultType,
+                               const std::vector<TIntermTyped *> &arguments);
+    spirv::IdRef emitArithmetic(TOperator op,
+                                const TType &resultType,
+                                const TType &leftType,
+                                spirv::IdRef left,
+                                const TType &rightType,
+                                spirv::IdRef right);
+    spirv::IdRef emitComponentWise(spirv::Op op,
+                                   spirv::IdRef resultTypeId,
+                                   const TType &leftType,
+                                   spirv::IdRef left,
+                                   const TType &rightType,
+                                   spirv::IdRef right);
+    spirv::IdRef emitEquality(bool equal,
+                              const TType &type,
+                              spirv::IdRef left,
+                              spirv::IdRef right);
+
+    // Helpers writing instructions to the current function.
+    spirv::IdRef emitOp(spirv::Op op,
+                        spirv::IdRef resultTypeId,
+                        std::initializer_list<uint32_t> operands);
+    spirv::IdRef emitOp(spirv::Op op,
+                        spirv::IdRef resultTypeId,
+                        std::initializer_list<uint32_t> operands,
+                        const std::vector<spirv::IdRef> &moreOperands);
+    spirv::IdRef emitExtInst(spirv::GLSLstd450 instruction,
+                             spirv::IdRef resultTypeId,
+                             const std::vector<spirv::IdRef> &operands);
+    spirv::IdRef splat(spirv::IdRef scalar, TBasicType type, int size);
+    std::vector<spirv::IdRef> getScalars(spirv::IdRef value, const TType &type);
+    spirv::IdRef convertScalar(spirv::IdRef value, TBasicType from, TBasicType to);
+
+    const sh::GLenum mShaderType;
+    const int mShaderVersion;
+    const std::vector<Uniform> &mUniforms;
+    bool mUnsupported;
+
+    SPIRVBuilder mBuilder;
+    std::map<int, SymbolInfo> mSymbols;
+    std::map<int, FunctionInfo> mFunctions;
+    std::set<int> mInvariantVariables;
+    std::vector<spirv::IdRef> mInterfaceVariables;
+    spirv::IdRef mEntryPointId;
+    spirv::IdRef mPerVertexTypeId;
+    spirv::IdRef mPerVertexId;
+    spirv::IdRef mDefaultUniformsId;
+    std::map<std::string, uint32_t> mDefaultUniformMembers;
+
+    // State of the function being generated. The variables are written separately from the body
+    // since they have to be declared at the start of the first block.
+    spirv::Blob mVariables;
+    spirv::Blob mBody;
+    spirv::IdRef mCurrentLabel;
+    bool mBlockTerminated;
+    std::vector<LoopInfo> mLoops;
+};
+
+SPIRVGenerator::SPIRVGenerator(sh::GLenum shaderType,
+                               int shaderVersion,
+                               const std::vector<Uniform> &uniforms)
+    : mShaderType(shaderType),
+      mShaderVersion(shaderVersion),
+      mUniforms(uniforms),
+      mUnsupported(false),
+      mEntryPointId(0),
+      mPerVertexTypeId(0),
+      mPerVertexId(0),
+      mDefaultUniformsId(0),
+      mCurrentLabel(0),
+      mBlockTerminated(true)
+{
+}
+
+bool SPIRVGenerator::generate(TIntermBlock *root, spirv::Blob *spirvOut)
+{
+    if (mShaderType != GL_VERTEX_SHADER && mShaderType != GL_FRAGMENT_SHADER)
+    {
+        return false;
+    }
+
+    declareFunctions(root);
+
+    for (TIntermNode *node : *root->getSequence())
+    {
+        if (mUnsupported)
+        {
+            return false;
+        }
+
+        if (TIntermFunctionDefinition *definition = node->getAsFunctionDefinition())
+        {
+            emitFunction(definition);
+        }
+        else if (TIntermDeclaration *declaration = node->getAsDeclarationNode())
+        {
+            emitGlobalDeclaration(declaration);
+        }
+        else if (!node->getAsFunctionPrototypeNode() && !node->getAsInvariantDeclarationNode())
+        {
+            markUnsupported();
+        }
+    }
+
+    if (mUnsupported || mEntryPointId == 0)
+    {
+        return false;
+    }
+
+    spirv::ExecutionModel executionModel = spirv::ExecutionModelVertex;
+    if (mShaderType == GL_FRAGMENT_SHADER)
+    {
+        executionModel = spirv::ExecutionModelFragment;
+        mBuilder.addExecutionMode(spirv::ExecutionModeOriginUpperLeft);
+    }
+
+    mBuilder.finish(executionModel, mEntryPointId, mInterfaceVariables, mShaderVersion, spirvOut);
+    return true;
+}
+
+spirv::IdRef SPIRVGenerator::getTypeId(const TType &type)
+{
+    TBasicType basicType = type.getBasicType();
+    spirv::IdRef typeId  = 0;
+
+    if (type.getStruct() || type.getInterfaceBlock())
+    {
+        markUnsupported();
+        return 0;
+    }
+
+    switch (basicType)
+    {
+        case EbtVoid:
+            typeId = mBuilder.getVoidType();
+            break;
+        case EbtFloat:
+            typeId = type.isMatrix() ? mBuilder.getMatrixType(type.getCols(), type.getRows())
+                                     : mBuilder.getBasicType(basicType, type.getNominalSize());
+            break;
+        case EbtInt:
+        case EbtUInt:
+        case EbtBool:
+            typeId = mBuilder.getBasicType(basicType, type.getNominalSize());
+            break;
+        default:
+            if (!IsSupportedSampler(basicType))
+            {
+                markUnsupported();
+                return 0;
+            }
+            typeId = mBuilder.getSampledImageType(basicType);
+            break;
+    }
+
+    // The array sizes are listed from the innermost one.
+    if (type.isArray())
+    {
+        for (unsigned int arraySize : *type.getArraySizes())
+        {
+            typeId = mBuilder.getArrayType(typeId, arraySize, 0);
+        }
+    }
+
+    return typeId;
+}
+
+spirv::IdRef SPIRVGenerator::getPointeeTypeId(const AccessChain &chain)
+{
+    const TType &type = *chain.pointeeType;
+    if (!chain.inDefaultUniforms)
+    {
+        return getTypeId(type);
+    }
+
+    // Arrays in the default uniform block have an explicit stride, which makes them a different
+    // type from the arrays everywhere else, so they are only accessed one element at a time.
+    if (type.isArray())
+    {
+        markUnsupported();
+        return 0;
+    }
+
+    // Bools are stored as uints.
+    if (type.getBasicType() == EbtBool)
+    {
+        return mBuilder.getBasicType(EbtUInt, type.getNominalSize());
+    }
+
+    return getTypeId(type);
+}
+
+spirv::IdRef SPIRVGenerator::getScalarConstant(TBasicType type, const TConstantUnion &value)
+{
+    TConstantUnion converted;
+    if (!converted.cast(type, value))
+    {
+        markUnsupported();
+        return 0;
+    }
+
+    switch (type)
+    {
+        case EbtFloat:
+            return mBuilder.getFloatConstant(converted.getFConst());
+        case EbtInt:
+            return mBuilder.getIntConstant(converted.getIConst());
+        case EbtUInt:
+            return mBuilder.getUintConstant(converted.getUConst());
+        case EbtBool:
+            return mBuilder.getBoolConstant(converted.getBConst());
+        default:
+            markUnsupported();
+            return 0;
+    }
+}
+
+spirv::IdRef SPIRVGenerator::getScalarConstant(TBasicType type, int value)
+{
+    switch (type)
+    {
+        case EbtFloat:
+            return mBuilder.getFloatConstant(static_cast<float>(value));
+        case EbtInt:
+            return mBuilder.getIntConstant(value);
+        case EbtUInt:
+            return mBuilder.getUintConstant(static_cast<uint32_t>(value));
+        case EbtBool:
+            return mBuilder.getBoolConstant(value != 0);
+        default:
+            UNREACHABLE();
+            return 0;
+    }
+}
+
+spirv::IdRef SPIRVGenerator::emitConstant(const TType &type, const TConstantUnion *values)
+{
+    if (type.getStruct() || values == nullptr)
+    {
+        markUnsupported();
+        return 0;
+    }
+
+    spirv::IdRef typeId = getTypeId(type);
+
+    if (type.isArray())
+    {
+        TType elementType(type);
+        elementType.toArrayElementType();
+        size_t elementSize = elementType.getObjectSize();
+
+        std::vector<spirv::IdRef> elements;
+        for (unsigned int index = 0; index < type.getOutermostArraySize(); ++index)
+        {
+            elements.push_back(emitConstant(elementType, values + index * elementSize));
+        }
+        return mBuilder.getCompositeConstant(typeId, elements);
+    }
+
+    TBasicType basicType = type.getBasicType();
+    std::vector<spirv::IdRef> components;
+    for (size_t index = 0; index < type.getObjectSize(); ++index)
+    {
+        components.push_back(getScalarConstant(basicType, values[index]));
+    }
+
+    if (type.isMatrix())
+    {
+        int rows                  = type.getRows();
+        spirv::IdRef columnTypeId = mBuilder.getBasicType(basicType, rows);
+        std::vector<spirv::IdRef> columns;
+        for (int column = 0; column < type.getCols(); ++column)
+        {
+            std::vector<spirv::IdRef> columnComponents(components.begin() + column * rows,
+                                                       components.begin() + (column + 1) * rows);
+            columns.push_back(mBuilder.getCompositeConstant(columnTypeId, columnComponents));
+        }
+        return mBuilder.getCompositeConstant(typeId, columns);
+    }
+
+    if (type.isVector())
+    {
+        return mBuilder.getCompositeConstant(typeId, components);
+    }
+
+    return components[0];
+}
+
+const SymbolInfo &SPIRVGenerator::getSymbol(const TVariable &variable)
+{
+    int uniqueId = variable.uniqueId().get();
+    auto iter    = mSymbols.find(uniqueId);
+    if (iter != mSymbols.end())
+    {
+        return iter->second;
+    }
+
+    SymbolInfo &info     = mSymbols[uniqueId];
+    const TType &type    = variable.getType();
+    TQualifier qualifier = type.getQualifier();
+
+    switch (qualifier)
+    {
+        case EvqConst:
+            // Constant variables are usually folded into their uses, except where the AST still
+            // indexes into them.
+            if (variable.getConstPointer() == nullptr)
+            {
+                markUnsupported();
+                break;
+            }
+            info.storageClass = spirv::StorageClassPrivate;
+            info.id           = mBuilder.addGlobalVariable(
+                getTypeId(type), info.storageClass,
+                emitConstant(type, variable.getConstPointer()));
+            mBuilder.addName(info.id, variable.name().data());
+            break;
+
+        case EvqAttribute:
+        case EvqVertexIn:
+        case EvqFragmentOut:
+            declareInterfaceVariable(variable, &info);
+            break;
+
+        case EvqUniform:
+            if (IsSampler(type.getBasicType()))
+            {
+                info.storageClass = spirv::StorageClassUniformConstant;
+                info.id = mBuilder.addGlobalVariable(getTypeId(type), info.storageClass, 0);
+                mBuilder.addName(info.id, variable.name().data());
+                mBuilder.addDecoration(info.id, spirv::DecorationDescriptorSet, {1});
+                mBuilder.addDecoration(info.id, spirv::DecorationBinding, {0});
+            }
+            else
+            {
+                declareDefaultUniform(variable, &info);
+            }
+            break;
+
+        default:
+            if (IsVaryingIn(qualifier) || IsVaryingOut(qualifier))
+            {
+                declareInterfaceVariable(variable, &info);
+            }
+            else if (variable.symbolType() == SymbolType::BuiltIn)
+            {
+                declareBuiltInVariable(variable, &info);
+            }
+            else
+            {
+                // Other variables are declared before they are used.
+                markUnsupported();
+            }
+            break;
+    }
+
+    return info;
+}
+
+void SPIRVGenerator::declareInterfaceVariable(const TVariable &variable, SymbolInfo *info)
+{
+    const TType &type    = variable.getType();
+    TQualifier qualifier = type.getQualifier();
+
+    bool isInput =
+        qualifier == EvqAttribute || qualifier == EvqVertexIn || IsVaryingIn(qualifier);
+    info->storageClass = isInput ? spirv::StorageClassInput : spirv::StorageClassOutput;
+    info->id           = mBuilder.addGlobalVariable(getTypeId(type), info->storageClass, 0);
+    mInterfaceVariables.push_back(info->id);
+
+    // The name identifies the variable when the locations are assigned at link time. See
+    // corresponding code in GlslangWrapper.cpp.
+    mBuilder.addName(info->id, variable.name().data());
+
+    int location = type.getLayoutQualifier().location;
+    mBuilder.addDecoration(info->id, spirv::DecorationLocation,
+                           {static_cast<uint32_t>(std::max(location, 0))});
+
+    if (qualifier == EvqFlatIn || qualifier == EvqFlatOut ||
+        (IsVaryingIn(qualifier) && type.getBasicType() != EbtFloat))
+    {
+        mBuilder.addDecoration(info->id, spirv::DecorationFlat, {});
+    }
+    if (qualifier == EvqCentroidIn || qualifier == EvqCentroidOut)
+    {
+        mBuilder.addDecoration(info->id, spirv::DecorationCentroid, {});
+    }
+    if (IsVaryingOut(qualifier) && isInvariant(variable))
+    {
+        mBuilder.addDecoration(info->id, spirv::DecorationInvariant, {});
+    }
+}
+
+void SPIRVGenerator::declareBuiltInVariable(const TVariable &variable, SymbolInfo *info)
+{
+    const TType &type = variable.getType();
+
+    switch (type.getQualifier())
+    {
+        case EvqPosition:
+        case EvqPointSize:
+        {
+            uint32_t member    = type.getQualifier() == EvqPosition ? 0 : 1;
+            info->id           = getPerVertexVariable();
+            info->storageClass = spirv::StorageClassOutput;
+            info->indices.push_back(mBuilder.getIntConstant(member));
+            if (isInvariant(variable))
+            {
+                mBuilder.addMemberDecoration(mPerVertexTypeId, member,
+                                             spirv::DecorationInvariant, {});
+            }
+            break;
+        }
+        case EvqFragCoord:
+            info->storageClass = spirv::StorageClassInput;
+            info->id = declareBuiltIn(getTypeId(type), info->storageClass,
+                                      spirv::BuiltInFragCoord, "gl_FragCoord");
+            break;
+        case EvqFrontFacing:
+            info->storageClass = spirv::StorageClassInput;
+            info->id = declareBuiltIn(getTypeId(type), info->storageClass,
+                                      spirv::BuiltInFrontFacing, "gl_FrontFacing");
+            break;
+        case EvqPointCoord:
+            info->storageClass = spirv::StorageClassInput;
+            info->id = declareBuiltIn(getTypeId(type), info->storageClass,
+                                      spirv::BuiltInPointCoord, "gl_PointCoord");
+            break;
+        case EvqVertexID:
+            info->storageClass = spirv::StorageClassInput;
+            info->id = declareBuiltIn(getTypeId(type), info->storageClass,
+                                      spirv::BuiltInVertexIndex, "gl_VertexIndex");
+            break;
+        case EvqInstanceID:
+            info->storageClass = spirv::StorageClassInput;
+            info->id = declareBuiltIn(getTypeId(type), info->storageClass,
+                                      spirv::BuiltInInstanceIndex, "gl_InstanceIndex");
+            break;
+        case EvqFragDepth:
+        case EvqFragDepthEXT:
+            info->storageClass = spirv::StorageClassOutput;
+            info->id = declareBuiltIn(getTypeId(type), info->storageClass,
+                                      spirv::BuiltInFragDepth, "gl_FragDepth");
+            mBuilder.addExecutionMode(spirv::ExecutionModeDepthReplacing);
+            break;
+        case EvqFragColor:
+        case EvqFragData:
+            // Declared as webgl_FragColor and webgl_FragData like in the GLSL output.
+            info->storageClass = spirv::StorageClassOutput;
+            info->id = mBuilder.addGlobalVariable(getTypeId(type), info->storageClass, 0);
+            mInterfaceVariables.push_back(info->id);
+            mBuilder.addName(info->id, type.getQualifier() == EvqFragColor ? "webgl_FragColor"
+                                                                           : "webgl_FragData");
+            mBuilder.addDecoration(info->id, spirv::DecorationLocation, {0});
+            break;
+        default:
+            markUnsupported();
+            break;
+    }
+}
+
+void SPIRVGenerator::declareDefaultUniform(const TVariable &variable, SymbolInfo *info)
+{
+    info->id = getDefaultUniformsVariable();
+
+    auto iter = mDefaultUniformMembers.find(variable.name().data());
+    if (info->id == 0 || iter == mDefaultUniformMembers.end())
+    {
+        markUnsupported();
+        return;
+    }
+
+    info->storageClass      = spirv::StorageClassUniform;
+    info->inDefaultUniforms = true;
+    info->indices.push_back(mBuilder.getIntConstant(static_cast<int32_t>(iter->second)));
+}
+
+spirv::IdRef SPIRVGenerator::declareBuiltIn(spirv::IdRef typeId,
+                                            spirv::StorageClass storageClass,
+                                            spirv::BuiltIn builtIn,
+                                            const char *name)
+{
+    spirv::IdRef id = mBuilder.addGlobalVariable(typeId, storageClass, 0);
+    mInterfaceVariables.push_back(id);
+    mBuilder.addName(id, name);
+    mBuilder.addDecoration(id, spirv::DecorationBuiltIn, {builtIn});
+    return id;
+}
+
+spirv::IdRef SPIRVGenerator::getPerVertexVariable()
+{
+    if (mPerVertexId != 0)
+    {
+        return mPerVertexId;
+    }
+
+    mPerVertexTypeId = mBuilder.addStructType(
+        {mBuilder.getBasicType(EbtFloat, 4), mBuilder.getBasicType(EbtFloat, 1)});
+    mBuilder.addName(mPerVertexTypeId, "gl_PerVertex");
+    mBuilder.addMemberName(mPerVertexTypeId, 0, "gl_Position");
+    mBuilder.addMemberName(mPerVertexTypeId, 1, "gl_PointSize");
+    mBuilder.addDecoration(mPerVertexTypeId, spirv::DecorationBlock, {});
+    mBuilder.addMemberDecoration(mPerVertexTypeId, 0, spirv::DecorationBuiltIn,
+                                 {spirv::BuiltInPosition});
+    mBuilder.addMemberDecoration(mPerVertexTypeId, 1, spirv::DecorationBuiltIn,
+                                 {spirv::BuiltInPointSize});
+
+    mPerVertexId = mBuilder.addGlobalVariable(mPerVertexTypeId, spirv::StorageClassOutput, 0);
+    mInterfaceVariables.push_back(mPerVertexId);
+    return mPerVertexId;
+}
+
+spirv::IdRef SPIRVGenerator::getDefaultUniformsVariable()
+{
+    if (mDefaultUniformsId != 0)
+    {
+        return mDefaultUniformsId;
+    }
+
+    // The members and their layout match the default uniform block that ProgramVk fills in.
+    sh::Std140BlockEncoder blockEncoder;
+    sh::BlockLayoutMap blockLayoutMap;
+    sh::GetUniformBlockInfo(mUniforms, "", &blockEncoder, &blockLayoutMap);
+
+    std::vector<const Uniform *> members;
+    std::vector<spirv::IdRef> memberTypeIds;
+    for (const Uniform &uniform : mUniforms)
+    {
+        if (gl::IsSamplerType(uniform.type))
+        {
+            continue;
+        }
+        if (uniform.isStruct() || uniform.isArrayOfArrays() || gl::IsOpaqueType(uniform.type))
+        {
+            markUnsupported();
+            return 0;
+        }
+
+        const sh::BlockMemberInfo &layout = blockLayoutMap[uniform.name];
+
+        spirv::IdRef typeId = 0;
+        if (gl::IsMatrixType(uniform.type))
+        {
+            typeId = mBuilder.getMatrixType(gl::VariableColumnCount(uniform.type),
+                                            gl::VariableRowCount(uniform.type));
+        }
+        else
+        {
+            TBasicType basicType = EbtFloat;
+            switch (gl::VariableComponentType(uniform.type))
+            {
+                case GL_INT:
+                    basicType = EbtInt;
+                    break;
+                case GL_UNSIGNED_INT:
+                case GL_BOOL:
+                    basicType = EbtUInt;
+                    break;
+                default:
+                    break;
+            }
+            typeId =
+                mBuilder.getBasicType(basicType, gl::VariableComponentCount(uniform.type));
+        }
+        if (uniform.isArray())
+        {
+            typeId = mBuilder.getArrayType(typeId, uniform.getOutermostArraySize(),
+                                           layout.arrayStride);
+        }
+
+        mDefaultUniformMembers[uniform.name] = static_cast<uint32_t>(members.size());
+        members.push_back(&uniform);
+        memberTypeIds.push_back(typeId);
+    }
+
+    spirv::IdRef structTypeId = mBuilder.addStructType(memberTypeIds);
+    mBuilder.addName(structTypeId, kDefaultUniformsName);
+    mBuilder.addDecoration(structTypeId, spirv::DecorationBlock, {});
+    for (uint32_t member = 0; member < members.size(); ++member)
+    {
+        const Uniform &uniform            = *members[member];
+        const sh::BlockMemberInfo &layout = blockLayoutMap[uniform.name];
+
+        mBuilder.addMemberName(structTypeId, member, uniform.name.c_str());
+        mBuilder.addMemberDecoration(structTypeId, member, spirv::DecorationOffset,
+                                     {static_cast<uint32_t>(layout.offset)});
+        if (gl::IsMatrixType(uniform.type))
+        {
+            mBuilder.addMemberDecoration(structTypeId, member, spirv::DecorationColMajor, {});
+            mBuilder.addMemberDecoration(structTypeId, member, spirv::DecorationMatrixStride,
+                                         {static_cast<uint32_t>(layout.matrixStride)});
+        }
+    }
+
+    // The set and binding are assigned at link time, like the GLSL output's
+    // DEFAULT-UNIFORMS-SET-BINDING placeholder.
+    mDefaultUniformsId = mBuilder.addGlobalVariable(structTypeId, spirv::StorageClassUniform, 0);
+    mBuilder.addName(mDefaultUniformsId, kDefaultUniformsName);
+    mBuilder.addDecoration(mDefaultUniformsId, spirv::DecorationDescriptorSet, {0});
+    mBuilder.addDecoration(mDefaultUniformsId, spirv::DecorationBinding, {0});
+    return mDefaultUniformsId;
+}
+
+spirv::IdRef SPIRVGenerator::declareLocalVariable(spirv::IdRef typeId, const char *name)
+{
+    spirv::IdRef id = mBuilder.getNewId();
+    spirv::WriteInstruction(&mVariables, spirv::OpVariable,
+                            {mBuilder.getPointerType(typeId, spirv::StorageClassFunction), id,
+                             spirv::StorageClassFunction});
+    if (name != nullptr)
+    {
+        mBuilder.addName(id, name);
+    }
+    return id;
+}
+
+bool SPIRVGenerator::isInvariant(const TVariable &variable) const
+{
+    return variable.getType().isInvariant() ||
+           mInvariantVariables.count(variable.uniqueId().get()) > 0;
+}
+
+void SPIRVGenerator::declareFunctions(TIntermBlock *root)
+{
+    // Functions get their ids up front, since they can be called before they are defined.
+    for (TIntermNode *node : *root->getSequence())
+    {
+        if (TIntermInvariantDeclaration *invariant = node->getAsInvariantDeclarationNode())
+        {
+            mInvariantVariables.insert(invariant->getSymbol()->uniqueId().get());
+            continue;
+        }
+
+        TIntermFunctionDefinition *definition = node->getAsFunctionDefinition();
+        if (!definition)
+        {
+            continue;
+        }
+
+        const TFunction *function = definition->getFunction();
+
+        std::vector<spirv::IdRef> parameterTypeIds;
+        for (TIntermNode *parameterNode : *definition->getFunctionPrototype()->getSequence())
+        {
+            const TType &parameterType = parameterNode->getAsSymbolNode()->getType();
+
+            // Parameters are passed by value, which rules out out parameters. Samplers would have
+            // to be passed by pointer.
+            TQualifier qualifier = parameterType.getQualifier();
+            if (qualifier == EvqOut || qualifier == EvqInOut ||
+                IsSampler(parameterType.getBasicType()))
+            {
+                markUnsupported();
+                return;
+            }
+            parameterTypeIds.push_back(getTypeId(parameterType));
+        }
+
+        FunctionInfo info;
+        info.id           = mBuilder.getNewId();
+        info.returnTypeId = getTypeId(function->getReturnType());
+        info.typeId       = mBuilder.getFunctionType(info.returnTypeId, parameterTypeIds);
+        mFunctions[function->uniqueId().get()] = info;
+
+        mBuilder.addName(info.id, function->name().data());
+        if (function->isMain())
+        {
+            mEntryPointId = info.id;
+        }
+    }
+}
+
+void SPIRVGenerator::emitFunction(TIntermFunctionDefinition *node)
+{
+    const FunctionInfo &info = mFunctions[node->getFunction()->uniqueId().get()];
+
+    mVariables.clear();
+    mBody.clear();
+    mLoops.clear();
+
+    spirv::Blob function;
+    spirv::WriteInstruction(&function, spirv::OpFunction,
+                            {info.returnTypeId, info.id, kFunctionControlNone, info.typeId});
+
+    // Parameters are copied to variables, since they can be assigned to.
+    for (TIntermNode *parameterNode : *node->getFunctionPrototype()->getSequence())
+    {
+        TIntermSymbol *parameter = parameterNode->getAsSymbolNode();
+        spirv::IdRef typeId      = getTypeId(parameter->getType());
+        spirv::IdRef parameterId = mBuilder.getNewId();
+        spirv::WriteInstruction(&function, spirv::OpFunctionParameter, {typeId, parameterId});
+
+        if (parameter->variable().symbolType() == SymbolType::Empty)
+        {
+            continue;
+        }
+
+        SymbolInfo &parameterInfo = mSymbols[parameter->uniqueId().get()];
+        parameterInfo.id = declareLocalVariable(typeId, parameter->getName().data());
+        spirv::WriteInstruction(&mBody, spirv::OpStore, {parameterInfo.id, parameterId});
+    }
+
+    spirv::IdRef entryLabel = mBuilder.getNewId();
+    mCurrentLabel           = entryLabel;
+    mBlockTerminated        = false;
+
+    emitBlock(node->getBody());
+
+    if (!mBlockTerminated)
+    {
+        if (node->getFunction()->getReturnType().getBasicType() == EbtVoid)
+        {
+            terminate(spirv::OpReturn, {});
+        }
+        else
+        {
+            // Falling off the end of a function that returns a value gives an undefined value.
+            terminate(spirv::OpReturnValue, {mBuilder.getUndef(info.returnTypeId)});
+        }
+    }
+
+    spirv::WriteInstruction(&function, spirv::OpLabel, {entryLabel});
+    function.insert(function.end(), mVariables.begin(), mVariables.end());
+    function.insert(function.end(), mBody.begin(), mBody.end());
+    spirv::WriteInstruction(&function, spirv::OpFunctionEnd, {});
+
+    mBuilder.addFunction(function);
+}
+
+void SPIRVGenerator::emitGlobalDeclaration(TIntermDeclaration *node)
+{
+    for (TIntermNode *declarator : *node->getSequence())
+    {
+        TIntermSymbol *symbol     = declarator->getAsSymbolNode();
+        TIntermTyped *initializer = nullptr;
+        if (TIntermBinary *initNode = declarator->getAsBinaryNode())
+        {
+            ASSERT(initNode->getOp() == EOpInitialize);
+            symbol      = initNode->getLeft()->getAsSymbolNode();
+            initializer = initNode->getRight();
+        }
+        ASSERT(symbol);
+
+        const TType &type    = symbol->getType();
+        TQualifier qualifier = type.getQualifier();
+
+        // Interface variables are declared when they are first used.
+        if (qualifier != EvqGlobal && qualifier != EvqTemporary && qualifier != EvqConst)
+        {
+            continue;
+        }
+
+        // Non-constant global initializers have been moved to main().
+        spirv::IdRef initializerId = 0;
+        if (initializer)
+        {
+            initializerId = emitConstant(initializer->getType(), initializer->getConstantValue());
+        }
+        else if (symbol->variable().symbolType() == SymbolType::Empty)
+        {
+            // A struct declaration without a variable.
+            markUnsupported();
+            return;
+        }
+
+        SymbolInfo &info  = mSymbols[symbol->uniqueId().get()];
+        info.storageClass = spirv::StorageClassPrivate;
+        info.id = mBuilder.addGlobalVariable(getTypeId(type), info.storageClass, initializerId);
+        mBuilder.addName(info.id, symbol->getName().data());
+    }
+}
+
+void SPIRVGenerator::emitStatement(TIntermNode *node)
+{
+    if (mUnsupported)
+    {
+        return;
+    }
+
+    ensureBlock();
+
+    if (TIntermBlock *block = node->getAsBlock())
+    {
+        emitBlock(block);
+    }
+    else if (TIntermDeclaration *declaration = node->getAsDeclarationNode())
+    {
+        emitDeclaration(declaration);
+    }
+    else if (TIntermIfElse *ifElse = node->getAsIfElseNode())
+    {
+        emitIfElse(ifElse);
+    }
+    else if (TIntermLoop *loop = node->getAsLoopNode())
+    {
+        emitLoop(loop);
+    }
+    else if (TIntermBranch *branch = node->getAsBranchNode())
+    {
+        emitBranch(branch);
+    }
+    else if (TIntermTyped *expression = node->getAsTyped())
+    {
+        emitExpression(expression);
+    }
+    else
+    {
+        // Switch statements aren't supported.
+        markUnsupported();
+    }
+}
+
+void SPIRVGenerator::emitBlock(TIntermBlock *node)
+{
+    if (!node)
+    {
+        return;
+    }
+
+    for (TIntermNode *statement : *node->getSequence())
+    {
+        emitStatement(statement);
+    }
+}
+
+void SPIRVGenerator::emitDeclaration(TIntermDeclaration *node)
+{
+    for (TIntermNode *declarator : *node->getSequence())
+    {
+        TIntermSymbol *symbol     = declarator->getAsSymbolNode();
+        TIntermTyped *initializer = nullptr;
+        if (TIntermBinary *initNode = declarator->getAsBinaryNode())
+        {
+            ASSERT(initNode->getOp() == EOpInitialize);
+            symbol      = initNode->getLeft()->getAsSymbolNode();
+            initializer = initNode->getRight();
+        }
+        ASSERT(symbol);
+
+        if (symbol->variable().symbolType() == SymbolType::Empty)
+        {
+            markUnsupported();
+            return;
+        }
+
+        SymbolInfo &info = mSymbols[symbol->uniqueId().get()];
+        info.id = declareLocalVariable(getTypeId(symbol->getType()), symbol->getName().data());
+
+        if (initializer)
+        {
+            spirv::IdRef value = emitExpression(initializer);
+            spirv::WriteInstruction(&mBody, spirv::OpStore, {info.id, value});
+        }
+    }
+}
+
+void SPIRVGenerator::emitIfElse(TIntermIfElse *node)
+{
+    spirv::IdRef condition  = emitExpression(node->getCondition());
+    spirv::IdRef trueLabel  = mBuilder.getNewId();
+    spirv::IdRef mergeLabel = mBuilder.getNewId();
+    spirv::IdRef falseLabel = node->getFalseBlock() ? mBuilder.getNewId() : mergeLabel;
+
+    spirv::WriteInstruction(&mBody, spirv::OpSelectionMerge, {mergeLabel, kSelectionControlNone});
+    terminate(spirv::OpBranchConditional, {condition, trueLabel, falseLabel});
+
+    startBlock(trueLabel);
+    emitBlock(node->getTrueBlock());
+    if (!mBlockTerminated)
+    {
+        terminate(spirv::OpBranch, {mergeLabel});
+    }
+
+    if (node->getFalseBlock())
+    {
+        startBlock(falseLabel);
+        emitBlock(node->getFalseBlock());
+        if (!mBlockTerminated)
+        {
+            terminate(spirv::OpBranch, {mergeLabel});
+        }
+    }
+
+    startBlock(mergeLabel);
+}
+
+void SPIRVGenerator::emitLoop(TIntermLoop *node)
+{
+    // for and while loops check the condition in a block of its own after the loop header:
+    //
+    //   header: OpLoopMerge merge continue; OpBranch condition
+    //   condition: OpBranchConditional body merge
+    //   body: ...; OpBranch continue
+    //   continue: ...; OpBranch header
+    //   merge:
+    //
+    // do-while loops check it in the continue block instead.
+    bool isDoWhile = node->getType() == ELoopDoWhile;
+
+    if (node->getInit())
+    {
+        emitStatement(node->getInit());
+    }
+
+    spirv::IdRef headerLabel    = mBuilder.getNewId();
+    spirv::IdRef bodyLabel      = mBuilder.getNewId();
+    spirv::IdRef continueLabel  = mBuilder.getNewId();
+    spirv::IdRef mergeLabel     = mBuilder.getNewId();
+    spirv::IdRef conditionLabel = isDoWhile ? bodyLabel : mBuilder.getNewId();
+
+    terminate(spirv::OpBranch, {headerLabel});
+
+    startBlock(headerLabel);
+    spirv::WriteInstruction(&mBody, spirv::OpLoopMerge,
+                            {mergeLabel, continueLabel, kLoopControlNone});
+    terminate(spirv::OpBranch, {conditionLabel});
+
+    if (!isDoWhile)
+    {
+        startBlock(conditionLabel);
+        if (node->getCondition())
+        {
+            spirv::IdRef condition = emitExpression(node->getCondition());
+            terminate(spirv::OpBranchConditional, {condition, bodyLabel, mergeLabel});
+        }
+        else
+        {
+            terminate(spirv::OpBranch, {bodyLabel});
+        }
+    }
+
+    startBlock(bodyLabel);
+    mLoops.push_back({continueLabel, mergeLabel});
+    emitBlock(node->getBody());
+    mLoops.pop_back();
+    if (!mBlockTerminated)
+    {
+        terminate(spirv::OpBranch, {continueLabel});
+    }
+
+    startBlock(continueLabel);
+    if (isDoWhile)
+    {
+        spirv::IdRef condition = emitExpression(node->getCondition());
+        terminate(spirv::OpBranchConditional, {condition, headerLabel, mergeLabel});
+    }
+    else
+    {
+        if (node->getExpression())
+        {
+            emitExpression(node->getExpression());
+        }
+        terminate(spirv::OpBranch, {headerLabel});
+    }
+
+    startBlock(mergeLabel);
+}
+
+void SPIRVGenerator::emitBranch(TIntermBranch *node)
+{
+    switch (node->getFlowOp())
+    {
+        case EOpKill:
+            terminate(spirv::OpKill, {});
+            break;
+        case EOpReturn:
+            if (node->getExpression())
+            {
+                spirv::IdRef value = emitExpression(node->getExpression());
+                terminate(spirv::OpReturnValue, {value});
+            }
+            else
+            {
+                terminate(spirv::OpReturn, {});
+            }
+            break;
+        case EOpBreak:
+        case EOpContinue:
+            if (mLoops.empty())
+            {
+                markUnsupported();
+                return;
+            }
+            terminate(spirv::OpBranch, {node->getFlowOp() == EOpBreak
+                                            ? mLoops.back().mergeLabel
+                                            : mLoops.back().continueLabel});
+            break;
+        default:
+            UNREACHABLE();
+            break;
+    }
+}
+
+void SPIRVGenerator::startBlock(spirv::IdRef label)
+{
+    spirv::WriteInstruction(&mBody, spirv::OpLabel, {label});
+    mCurrentLabel    = label;
+    mBlockTerminated = false;
+}
+
+void SPIRVGenerator::ensureBlock()
+{
+    if (mBlockTerminated)
+    {
+        startBlock(mBuilder.getNewId());
+    }
+}
+
+void SPIRVGenerator::terminate(spirv::Op op, std::initializer_list<uint32_t> operands)
+{
+    spirv::WriteInstruction(&mBody, op, operands);
+    mBlockTerminated = true;
+}
+
+spirv::IdRef SPIRVGenerator::emitExpression(TIntermTyped *node)
+{
+    if (mUnsupported)
+    {
+        return 0;
+    }
+
+    if (TIntermConstantUnion *constant = node->getAsConstantUnion())
+    {
+        return emitConstant(constant->getType(), constant->getConstantValue());
+    }
+
+    if (isLValue(node))
+    {
+        return load(emitLValue(node));
+    }
+
+    if (TIntermSwizzle *swizzle = node->getAsSwizzleNode())
+    {
+        spirv::IdRef value          = emitExpression(swizzle->getOperand());
+        const TVector<int> &offsets = swizzle->getSwizzleOffsets();
+        return emitSwizzle(value, node->getBasicType(),
+                           std::vector<int>(offsets.begin(), offsets.end()));
+    }
+    if (TIntermBinary *binary = node->getAsBinaryNode())
+    {
+        return emitBinary(binary);
+    }
+    if (TIntermUnary *unary = node->getAsUnaryNode())
+    {
+        return emitUnary(unary);
+    }
+    if (TIntermAggregate *aggregate = node->getAsAggregate())
+    {
+        return emitAggregate(aggregate);
+    }
+    if (TIntermTernary *ternary = node->getAsTernaryNode())
+    {
+        return emitTernary(ternary);
+    }
+
+    markUnsupported();
+    return 0;
+}
+
+bool SPIRVGenerator::isLValue(TIntermTyped *node)
+{
+    if (node->getAsSymbolNode())
+    {
+        return true;
+    }
+    if (TIntermSwizzle *swizzle = node->getAsSwizzleNode())
+    {
+        return isLValue(swizzle->getOperand());
+    }
+    if (TIntermBinary *binary = node->getAsBinaryNode())
+    {
+        return (binary->getOp() == EOpIndexDirect || binary->getOp() == EOpIndexIndirect) &&
+               isLValue(binary->getLeft());
+    }
+    return false;
+}
+
+AccessChain SPIRVGenerator::emitLValue(TIntermTyped *node)
+{
+    AccessChain chain;
+
+    if (TIntermSymbol *symbol = node->getAsSymbolNode())
+    {
+        const SymbolInfo &info  = getSymbol(symbol->variable());
+        chain.baseId            = info.id;
+        chain.storageClass      = info.storageClass;
+        chain.indices           = info.indices;
+        chain.inDefaultUniforms = info.inDefaultUniforms;
+        chain.pointeeType       = &node->getType();
+        return chain;
+    }
+
+    if (TIntermSwizzle *swizzle = node->getAsSwizzleNode())
+    {
+        chain = emitLValue(swizzle->getOperand());
+
+        std::vector<int> components;
+        for (int offset : swizzle->getSwizzleOffsets())
+        {
+            components.push_back(chain.swizzle.empty() ? offset : chain.swizzle[offset]);
+        }
+
+        // A single component is selected by the access chain itself.
+        if (components.size() == 1)
+        {
+            chain.indices.push_back(mBuilder.getIntConstant(components[0]));
+            chain.pointeeType = &node->getType();
+            chain.swizzle.clear();
+        }
+        else
+        {
+            chain.swizzle = components;
+        }
+        return chain;
+    }
+
+    TIntermBinary *binary = node->getAsBinaryNode();
+    ASSERT(binary && (binary->getOp() == EOpIndexDirect || binary->getOp() == EOpIndexIndirect));
+
+    chain = emitLValue(binary->getLeft());
+    if (!chain.swizzle.empty())
+    {
+        if (binary->getOp() != EOpIndexDirect)
+        {
+            markUnsupported();
+            return chain;
+        }
+        int component = chain.swizzle[GetConstantIndex(binary->getRight())];
+        chain.indices.push_back(mBuilder.getIntConstant(component));
+        chain.swizzle.clear();
+    }
+    else
+    {
+        chain.indices.push_back(emitIndexValue(binary->getRight(), binary->getLeft()->getType(),
+                                               binary->getAddIndexClamp()));
+    }
+    chain.pointeeType = &node->getType();
+    return chain;
+}
+
+spirv::IdRef SPIRVGenerator::emitIndexValue(TIntermTyped *indexNode,
+                                            const TType &indexedType,
+                                            bool clamp)
+{
+    if (indexNode->getAsConstantUnion())
+    {
+        return mBuilder.getIntConstant(GetConstantIndex(indexNode));
+    }
+
+    spirv::IdRef index = emitExpression(indexNode);
+    if (!clamp)
+    {
+        return index;
+    }
+
+    // Keep the index in range like the clamp() the GLSL output adds.
+    int maxIndex = GetIndexableSize(indexedType) - 1;
+    if (indexNode->getBasicType() == EbtUInt)
+    {
+        return emitExtInst(spirv::GLSLstd450UMin, getScalarTypeId(EbtUInt),
+                           {index, mBuilder.getUintConstant(maxIndex)});
+    }
+    return emitExtInst(spirv::GLSLstd450SClamp, getScalarTypeId(EbtInt),
+                       {index, mBuilder.getIntConstant(0), mBuilder.getIntConstant(maxIndex)});
+}
+
+spirv::IdRef SPIRVGenerator::getAccessChainPointer(const AccessChain &chain)
+{
+    if (chain.indices.empty())
+    {
+        return chain.baseId;
+    }
+
+    spirv::IdRef pointerTypeId =
+        mBuilder.getPointerType(getPointeeTypeId(chain), chain.storageClass);
+    return emitOp(spirv::OpAccessChain, pointerTypeId, {chain.baseId}, chain.indices);
+}
+
+spirv::IdRef SPIRVGenerator::load(const AccessChain &chain)
+{
+    const TType &type  = *chain.pointeeType;
+    spirv::IdRef value = emitOp(spirv::OpLoad, getPointeeTypeId(chain),
+                                {getAccessChainPointer(chain)});
+
+    if (chain.inDefaultUniforms && type.getBasicType() == EbtBool)
+    {
+        int size          = type.getNominalSize();
+        spirv::IdRef zero = mBuilder.getUintConstant(0);
+        if (size > 1)
+        {
+            zero = mBuilder.getCompositeConstant(mBuilder.getBasicType(EbtUInt, size),
+                                                 std::vector<spirv::IdRef>(size, zero));
+        }
+        value = emitOp(spirv::OpINotEqual, mBuilder.getBasicType(EbtBool, size), {value, zero});
+    }
+
+    if (!chain.swizzle.empty())
+    {
+        value = emitSwizzle(value, type.getBasicType(), chain.swizzle);
+    }
+    return value;
+}
+
+void SPIRVGenerator::store(const AccessChain &chain, spirv::IdRef value)
+{
+    if (chain.inDefaultUniforms)
+    {
+        markUnsupported();
+        return;
+    }
+
+    spirv::IdRef pointer = getAccessChainPointer(chain);
+
+    if (!chain.swizzle.empty())
+    {
+        // Write the swizzled components into the rest of the vector.
+        const TType &type          = *chain.pointeeType;
+        spirv::IdRef vectorTypeId  = getTypeId(type);
+        uint32_t size              = static_cast<uint32_t>(type.getNominalSize());
+        spirv::IdRef previousValue = emitOp(spirv::OpLoad, vectorTypeId, {pointer});
+
+        std::vector<spirv::IdRef> components;
+        for (uint32_t component = 0; component < size; ++component)
+        {
+            components.push_back(component);
+        }
+        for (size_t index = 0; index < chain.swizzle.size(); ++index)
+        {
+            components[chain.swizzle[index]] = size + static_cast<uint32_t>(index);
+        }
+        value = emitOp(spirv::OpVectorShuffle, vectorTypeId, {previousValue, value}, components);
+    }
+
+    spirv::WriteInstruction(&mBody, spirv::OpStore, {pointer, value});
+}
+
+spirv::IdRef SPIRVGenerator::emitSwizzle(spirv::IdRef value,
+                                         TBasicType basicType,
+                                         const std::vector<int> &swizzle)
+{
+    if (swizzle.size() == 1)
+    {
+        return emitOp(spirv::OpCompositeExtract, getScalarTypeId(basicType),
+                      {value, static_cast<uint32_t>(swizzle[0])});
+    }
+
+    std::vector<spirv::IdRef> components(swizzle.begin(), swizzle.end());
+    return emitOp(spirv::OpVectorShuffle,
+                  mBuilder.getBasicType(basicType, static_cast<int>(swizzle.size())),
+                  {value, value}, components);
+}
+
+spirv::IdRef SPIRVGenerator::emitIndex(TIntermBinary *node)
+{
+    TIntermTyped *left        = node->getLeft();
+    const TType &leftType     = left->getType();
+    spirv::IdRef resultTypeId = getTypeId(node->getType());
+
+    if (node->getOp() != EOpIndexDirect && node->getOp() != EOpIndexIndirect)
+    {
+        // Structs and interface blocks.
+        markUnsupported();
+        return 0;
+    }
+
+    spirv::IdRef base = emitExpression(left);
+    if (node->getOp() == EOpIndexDirect)
+    {
+        return emitOp(spirv::OpCompositeExtract, resultTypeId,
+                      {base, static_cast<uint32_t>(GetConstantIndex(node->getRight()))});
+    }
+
+    spirv::IdRef index = emitIndexValue(node->getRight(), leftType, node->getAddIndexClamp());
+    if (leftType.isVector())
+    {
+        return emitOp(spirv::OpVectorExtractDynamic, resultTypeId, {base, index});
+    }
+
+    // Arrays and matrices can only be indexed dynamically through a pointer.
+    spirv::IdRef temporary = declareLocalVariable(getTypeId(leftType), nullptr);
+    spirv::WriteInstruction(&mBody, spirv::OpStore, {temporary, base});
+    spirv::IdRef pointer =
+        emitOp(spirv::OpAccessChain,
+               mBuilder.getPointerType(resultTypeId, spirv::StorageClassFunction),
+               {temporary, index});
+    return emitOp(spirv::OpLoad, resultTypeId, {pointer});
+}
+
+spirv::IdRef SPIRVGenerator::emitBinary(TIntermBinary *node)
+{
+    TOperator op        = node->getOp();
+    TIntermTyped *left  = node->getLeft();
+    TIntermTyped *right = node->getRight();
+
+    switch (op)
+    {
+        case EOpIndexDirect:
+        case EOpIndexIndirect:
+        case EOpIndexDirectStruct:
+        case EOpIndexDirectInterfaceBlock:
+            return emitIndex(node);
+
+        case EOpComma:
+            emitExpression(left);
+            return emitExpression(right);
+
+        case EOpAssign:
+        {
+            AccessChain chain  = emitLValue(left);
+            spirv::IdRef value = emitExpression(right);
+            store(chain, value);
+            return value;
+        }
+
+        case EOpLogicalAnd:
+        case EOpLogicalOr:
+            return emitShortCircuit(node);
+
+        case EOpInitialize:
+            markUnsupported();
+            return 0;
+
+        default:
+            break;
+    }
+
+    TOperator compoundOp = GetCompoundAssignmentOp(op);
+    if (compoundOp != EOpNull)
+    {
+        AccessChain chain    = emitLValue(left);
+        spirv::IdRef value   = load(chain);
+        spirv::IdRef operand = emitExpression(right);
+        spirv::IdRef result  = emitArithmetic(compoundOp, left->getType(), left->getType(), value,
+                                             right->getType(), operand);
+        store(chain, result);
+        return result;
+    }
+
+    spirv::IdRef leftValue  = emitExpression(left);
+    spirv::IdRef rightValue = emitExpression(right);
+    return emitArithmetic(op, node->getType(), left->getType(), leftValue, right->getType(),
+                          rightValue);
+}
+
+spirv::IdRef SPIRVGenerator::emitShortCircuit(TIntermBinary *node)
+{
+    bool isAnd            = node->getOp() == EOpLogicalAnd;
+    spirv::IdRef boolType = getScalarTypeId(EbtBool);
+    spirv::IdRef left     = emitExpression(node->getLeft());
+
+    // The right side only needs to be skipped if evaluating it has side effects.
+    if (!node->getRight()->hasSideEffects())
+    {
+        spirv::IdRef right = emitExpression(node->getRight());
+        return emitOp(isAnd ? spirv::OpLogicalAnd : spirv::OpLogicalOr, boolType, {left, right});
+    }
+
+    spirv::IdRef leftLabel  = mCurrentLabel;
+    spirv::IdRef rightLabel = mBuilder.getNewId();
+    spirv::IdRef mergeLabel = mBuilder.getNewId();
+
+    spirv::WriteInstruction(&mBody, spirv::OpSelectionMerge, {mergeLabel, kSelectionControlNone});
+    if (isAnd)
+    {
+        terminate(spirv::OpBranchConditional, {left, rightLabel, mergeLabel});
+    }
+    else
+    {
+        terminate(spirv::OpBranchConditional, {left, mergeLabel, rightLabel});
+    }
+
+    startBlock(rightLabel);
+    spirv::IdRef right         = emitExpression(node->getRight());
+    spirv::IdRef rightEndLabel = mCurrentLabel;
+    terminate(spirv::OpBranch, {mergeLabel});
+
+    startBlock(mergeLabel);
+    return emitOp(spirv::OpPhi, boolType, {left, leftLabel, right, rightEndLabel});
+}
+
+spirv::IdRef SPIRVGenerator::emitUnary(TIntermUnary *node)
+{
+    if (node->getUseEmulatedFunction())
+    {
+        markUnsupported();
+        return 0;
+    }
+
+    TIntermTyped *operand     = node->getOperand();
+    const TType &type         = node->getType();
+    spirv::IdRef resultTypeId = getTypeId(type);
+
+    switch (node->getOp())
+    {
+        case EOpNegative:
+        {
+            spirv::IdRef value = emitExpression(operand);
+            if (type.isMatrix())
+            {
+                spirv::IdRef columnTypeId = mBuilder.getBasicType(EbtFloat, type.getRows());
+                std::vector<spirv::IdRef> columns;
+                for (int column = 0; column < type.getCols(); ++column)
+                {
+                    spirv::IdRef columnValue = emitOp(spirv::OpCompositeExtract, columnTypeId,
+                                                      {value, static_cast<uint32_t>(column)});
+                    columns.push_back(emitOp(spirv::OpFNegate, columnTypeId, {columnValue}));
+                }
+                return emitOp(spirv::OpCompositeConstruct, resultTypeId, {}, columns);
+            }
+            return emitOp(type.getBasicType() == EbtFloat ? spirv::OpFNegate : spirv::OpSNegate,
+                          resultTypeId, {value});
+        }
+        case EOpPositive:
+            return emitExpression(operand);
+        case EOpLogicalNot:
+            return emitOp(spirv::OpLogicalNot, resultTypeId, {emitExpression(operand)});
+        case EOpBitwiseNot:
+            return emitOp(spirv::OpNot, resultTypeId, {emitExpression(operand)});
+        case EOpPostIncrement:
+        case EOpPostDecrement:
+        case EOpPreIncrement:
+        case EOpPreDecrement:
+            return emitIncrementDecrement(node);
+        case EOpArrayLength:
+            return mBuilder.getIntConstant(
+                static_cast<int32_t>(operand->getType().getOutermostArraySize()));
+        default:
+            return emitBuiltInOp(node->getOp(), type, {operand});
+    }
+}
+
+spirv::IdRef SPIRVGenerator::emitIncrementDecrement(TIntermUnary *node)
+{
+    TOperator op      = node->getOp();
+    const TType &type = node->getOperand()->getType();
+
+    AccessChain chain  = emitLValue(node->getOperand());
+    spirv::IdRef value = load(chain);
+
+    TType scalarType(type.getBasicType());
+    bool isIncrement = op == EOpPostIncrement || op == EOpPreIncrement;
+    spirv::IdRef result =
+        emitArithmetic(isIncrement ? EOpAdd : EOpSub, type, type, value, scalarType,
+                       getScalarConstant(type.getBasicType(), 1));
+    store(chain, result);
+
+    return (op == EOpPostIncrement || op == EOpPostDecrement) ? value : result;
+}
+
+spirv::IdRef SPIRVGenerator::emitTernary(TIntermTernary *node)
+{
+    const TType &type             = node->getType();
+    TIntermTyped *trueExpression  = node->getTrueExpression();
+    TIntermTyped *falseExpression = node->getFalseExpression();
+    spirv::IdRef condition        = emitExpression(node->getCondition());
+
+    if (type.isScalar() && !trueExpression->hasSideEffects() &&
+        !falseExpression->hasSideEffects())
+    {
+        spirv::IdRef trueValue  = emitExpression(trueExpression);
+        spirv::IdRef falseValue = emitExpression(falseExpression);
+        return emitOp(spirv::OpSelect, getTypeId(type), {condition, trueValue, falseValue});
+    }
+
+    spirv::IdRef trueLabel  = mBuilder.getNewId();
+    spirv::IdRef falseLabel = mBuilder.getNewId();
+    spirv::IdRef mergeLabel = mBuilder.getNewId();
+
+    spirv::WriteInstruction(&mBody, spirv::OpSelectionMerge, {mergeLabel, kSelectionControlNone});
+    terminate(spirv::OpBranchConditional, {condition, trueLabel, falseLabel});
+
+    startBlock(trueLabel);
+    spirv::IdRef trueValue    = emitExpression(trueExpression);
+    spirv::IdRef trueEndLabel = mCurrentLabel;
+    terminate(spirv::OpBranch, {mergeLabel});
+
+    startBlock(falseLabel);
+    spirv::IdRef falseValue    = emitExpression(falseExpression);
+    spirv::IdRef falseEndLabel = mCurrentLabel;
+    terminate(spirv::OpBranch, {mergeLabel});
+
+    startBlock(mergeLabel);
+    if (type.getBasicType() == EbtVoid)
+    {
+        return 0;
+    }
+    return emitOp(spirv::OpPhi, getTypeId(type),
+                  {trueValue, trueEndLabel, falseValue, falseEndLabel});
+}
+
+spirv::IdRef SPIRVGenerator::emitAggregate(TIntermAggregate *node)
+{
+    if (node->getUseEmulatedFunction())
+    {
+        markUnsupported();
+        return 0;
+    }
+
+    switch (node->getOp())
+    {
+        case EOpConstruct:
+            return emitConstructor(node);
+        case EOpCallFunctionInAST:
+            return emitFunctionCall(node);
+        case EOpCallBuiltInFunction:
+            return emitTextureCall(node);
+        case EOpCallInternalRawFunction:
+            markUnsupported();
+            return 0;
+        default:
+            break;
+    }
+
+    std::vector<TIntermTyped *> arguments;
+    for (TIntermNode *argument : *node->getSequence())
+    {
+        arguments.push_back(argument->getAsTyped());
+    }
+    return emitBuiltInOp(node->getOp(), node->getType(), arguments);
+}
+
+spirv::IdRef SPIRVGenerator::emitConstructor(TIntermAggregate *node)
+{
+    const TType &type           = node->getType();
+    const TIntermSequence &args = *node->getSequence();
+    spirv::IdRef typeId         = getTypeId(type);
+    TBasicType basicType        = type.getBasicType();
+    TIntermTyped *firstArgument = args[0]->getAsTyped();
+    const TType &firstType      = firstArgument->getType();
+
+    if (type.isArray())
+    {
+        std::vector<spirv::IdRef> elements;
+        for (TIntermNode *argument : args)
+        {
+            elements.push_back(emitExpression(argument->getAsTyped()));
+        }
+        return emitOp(spirv::OpCompositeConstruct, typeId, {}, elements);
+    }
+
+    if (args.size() == 1 && firstType.getBasicType() == basicType &&
+        firstType.getNominalSize() == type.getNominalSize() &&
+        firstType.getSecondarySize() == type.getSecondarySize())
+    {
+        return emitExpression(firstArgument);
+    }
+
+    if (type.isMatrix())
+    {
+        int columns               = type.getCols();
+        int rows                  = type.getRows();
+        spirv::IdRef columnTypeId = mBuilder.getBasicType(EbtFloat, rows);
+        std::vector<spirv::IdRef> components;
+
+        if (args.size() == 1 && firstType.isMatrix())
+        {
+            // Take the overlapping part of the matrix, and fill the rest from the identity.
+            spirv::IdRef value = emitExpression(firstArgument);
+            for (int column = 0; column < columns; ++column)
+            {
+                for (int row = 0; row < rows; ++row)
+                {
+                    if (column < firstType.getCols() && row < firstType.getRows())
+                    {
+                        components.push_back(emitOp(
+                            spirv::OpCompositeExtract, getScalarTypeId(EbtFloat),
+                            {value, static_cast<uint32_t>(column), static_cast<uint32_t>(row)}));
+                    }
+                    else
+                    {
+                        components.push_back(
+                            mBuilder.getFloatConstant(column == row ? 1.0f : 0.0f));
+                    }
+                }
+            }
+        }
+        else if (args.size() == 1 && firstType.isScalar())
+        {
+            // A scalar sets the diagonal.
+            spirv::IdRef value =
+                convertScalar(emitExpression(firstArgument), firstType.getBasicType(), EbtFloat);
+            for (int column = 0; column < columns; ++column)
+            {
+                for (int row = 0; row < rows; ++row)
+                {
+                    components.push_back(column == row ? value : mBuilder.getFloatConstant(0.0f));
+                }
+            }
+        }
+        else
+        {
+            for (TIntermNode *argument : args)
+            {
+                TIntermTyped *typedArgument = argument->getAsTyped();
+                spirv::IdRef value          = emitExpression(typedArgument);
+                for (spirv::IdRef component : getScalars(value, typedArgument->getType()))
+                {
+                    components.push_back(convertScalar(
+                        component, typedArgument->getBasicType(), EbtFloat));
+                }
+            }
+        }
+
+        std::vector<spirv::IdRef> columnValues;
+        for (int column = 0; column < columns; ++column)
+        {
+            std::vector<spirv::IdRef> columnComponents(components.begin() + column * rows,
+                                                       components.begin() + (column + 1) * rows);
+            columnValues.push_back(
+                emitOp(spirv::OpCompositeConstruct, columnTypeId, {}, columnComponents));
+        }
+        return emitOp(spirv::OpCompositeConstruct, typeId, {}, columnValues);
+    }
+
+    // Scalars and vectors take the components of their arguments in order, converting each of
+    // them. A single scalar argument is used for all the components.
+    size_t size = static_cast<size_t>(type.getNominalSize());
+    std::vector<spirv::IdRef> components;
+    for (TIntermNode *argument : args)
+    {
+        TIntermTyped *typedArgument = argument->getAsTyped();
+        spirv::IdRef value          = emitExpression(typedArgument);
+        for (spirv::IdRef component : getScalars(value, typedArgument->getType()))
+        {
+            if (components.size() == size)
+            {
+                break;
+            }
+            components.push_back(
+                convertScalar(component, typedArgument->getBasicType(), basicType));
+        }
+    }
+
+    if (size == 1)
+    {
+        return components[0];
+    }
+    if (args.size() == 1 && firstType.isScalar())
+    {
+        return splat(components[0], basicType, static_cast<int>(size));
+    }
+    return emitOp(spirv::OpCompositeConstruct, typeId, {}, components);
+}
+
+spirv::IdRef SPIRVGenerator::emitFunctionCall(TIntermAggregate *node)
+{
+    auto iter = mFunctions.find(node->getFunction()->uniqueId().get());
+    if (iter == mFunctions.end())
+    {
+        markUnsupported();
+        return 0;
+    }
+
+    std::vector<spirv::IdRef> arguments;
+    for (TIntermNode *argument : *node->getSequence())
+    {
+        arguments.push_back(emitExpression(argument->getAsTyped()));
+    }
+
+    const FunctionInfo &info = iter->second;
+    return emitOp(spirv::OpFunctionCall, info.returnTypeId, {info.id}, arguments);
+}
+
+spirv::IdRef SPIRVGenerator::emitTextureCall(TIntermAggregate *node)
+{
+    struct TextureFunction
+    {
+        const char *name;
+        bool isProj;
+        bool isLod;
+    };
+    constexpr TextureFunction kTextureFunctions[] = {
+        {"texture2D", false, false},          {"textureCube", false, false},
+        {"texture", false, false},            {"texture2DProj", true, false},
+        {"textureProj", true, false},         {"texture2DLod", false, true},
+        {"textureCubeLod", false, true},      {"textureLod", false, true},
+        {"texture2DLodEXT", false, true},     {"textureCubeLodEXT", false, true},
+        {"texture2DProjLod", true, true},     {"textureProjLod", true, true},
+        {"texture2DProjLodEXT", true, true},
+    };
+
+    const ImmutableString &name     = node->getFunction()->name();
+    const TextureFunction *function = nullptr;
+    for (const TextureFunction &textureFunction : kTextureFunctions)
+    {
+        if (name == textureFunction.name)
+        {
+            function = &textureFunction;
+            break;
+        }
+    }
+
+    const TIntermSequence &args = *node->getSequence();
+    TBasicType samplerType      = args[0]->getAsTyped()->getBasicType();
+    if (function == nullptr || !IsSupportedSampler(samplerType))
+    {
+        markUnsupported();
+        return 0;
+    }
+
+    spirv::IdRef sampledImage = emitExpression(args[0]->getAsTyped());
+    TIntermTyped *coordinates = args[1]->getAsTyped();
+    spirv::IdRef coordinate   = emitExpression(coordinates);
+    spirv::IdRef extra        = args.size() > 2 ? emitExpression(args[2]->getAsTyped()) : 0;
+    spirv::IdRef resultTypeId = getTypeId(node->getType());
+
+    // The projective coordinate of 2D lookups with a vec4 is in w.
+    if (function->isProj && coordinates->getNominalSize() == 4 && !IsSampler3D(samplerType))
+    {
+        coordinate = emitOp(spirv::OpVectorShuffle, mBuilder.getBasicType(EbtFloat, 3),
+                            {coordinate, coordinate, 0, 1, 3});
+    }
+
+    // Implicit derivatives are only available in fragment shaders. Elsewhere the base level is
+    // sampled.
+    if (!function->isLod && mShaderType != GL_FRAGMENT_SHADER)
+    {
+        extra = mBuilder.getFloatConstant(0.0f);
+    }
+
+    if (function->isLod || mShaderType != GL_FRAGMENT_SHADER)
+    {
+        return emitOp(function->isProj ? spirv::OpImageSampleProjExplicitLod
+                                       : spirv::OpImageSampleExplicitLod,
+                      resultTypeId, {sampledImage, coordinate, spirv::ImageOperandsLod, extra});
+    }
+
+    spirv::Op op =
+        function->isProj ? spirv::OpImageSampleProjImplicitLod : spirv::OpImageSampleImplicitLod;
+    if (extra != 0)
+    {
+        return emitOp(op, resultTypeId,
+                      {sampledImage, coordinate, spirv::ImageOperandsBias, extra});
+    }
+    return emitOp(op, resultTypeId, {sampledImage, coordinate});
+}
+
+spirv::IdRef SPIRVGenerator::emitBuiltInOp(TOperator op,
+                                           const TType &resultType,
+                                           const std::vector<TIntermTyped *> &arguments)
+{
+    std::vector<spirv::IdRef> values;
+    for (TIntermTyped *argument : arguments)
+    {
+        values.push_back(emitExpression(argument));
+    }
+
+    spirv::IdRef resultTypeId = getTypeId(resultType);
+    const TType &firstType    = arguments[0]->getType();
+    TBasicType basicType      = firstType.getBasicType();
+    bool isFloat              = basicType == EbtFloat;
+    bool isSigned             = basicType == EbtInt;
+
+    // Most built-ins map to an instruction of GLSL.std.450, which takes operands of the same type
+    // where GLSL also accepts scalars.
+    spirv::GLSLstd450 instruction;
+    bool splatScalars = false;
+
+    switch (op)
+    {
+        case EOpRadians:
+            instruction = spirv::GLSLstd450Radians;
+            break;
+        case EOpDegrees:
+            instruction = spirv::GLSLstd450Degrees;
+            break;
+        case EOpSin:
+            instruction = spirv::GLSLstd450Sin;
+            break;
+        case EOpCos:
+            instruction = spirv::GLSLstd450Cos;
+            break;
+        case EOpTan:
+            instruction = spirv::GLSLstd450Tan;
+            break;
+        case EOpAsin:
+            instruction = spirv::GLSLstd450Asin;
+            break;
+        case EOpAcos:
+            instruction = spirv::GLSLstd450Acos;
+            break;
+        case EOpAtan:
+            instruction = values.size() == 2 ? spirv::GLSLstd450Atan2 : spirv::GLSLstd450Atan;
+            break;
+        case EOpSinh:
+            instruction = spirv::GLSLstd450Sinh;
+            break;
+        case EOpCosh:
+            instruction = spirv::GLSLstd450Cosh;
+            break;
+        case EOpTanh:
+            instruction = spirv::GLSLstd450Tanh;
+            break;
+        case EOpAsinh:
+            instruction = spirv::GLSLstd450Asinh;
+            break;
+        case EOpAcosh:
+            instruction = spirv::GLSLstd450Acosh;
+            break;
+        case EOpAtanh:
+            instruction = spirv::GLSLstd450Atanh;
+            break;
+        case EOpPow:
+            instruction = spirv::GLSLstd450Pow;
+            break;
+        case EOpExp:
+            instruction = spirv::GLSLstd450Exp;
+            break;
+        case EOpLog:
+            instruction = spirv::GLSLstd450Log;
+            break;
+        case EOpExp2:
+            instruction = spirv::GLSLstd450Exp2;
+            break;
+        case EOpLog2:
+            instruction = spirv::GLSLstd450Log2;
+            break;
+        case EOpSqrt:
+            instruction = spirv::GLSLstd450Sqrt;
+            break;
+        case EOpInversesqrt:
+            instruction = spirv::GLSLstd450InverseSqrt;
+            break;
+        case EOpAbs:
+            instruction = isFloat ? spirv::GLSLstd450FAbs : spirv::GLSLstd450SAbs;
+            break;
+        case EOpSign:
+            instruction = isFloat ? spirv::GLSLstd450FSign : spirv::GLSLstd450SSign;
+            break;
+        case EOpFloor:
+            instruction = spirv::GLSLstd450Floor;
+            break;
+        case EOpTrunc:
+            instruction = spirv::GLSLstd450Trunc;
+            break;
+        case EOpRound:
+            instruction = spirv::GLSLstd450Round;
+            break;
+        case EOpRoundEven:
+            instruction = spirv::GLSLstd450RoundEven;
+            break;
+        case EOpCeil:
+            instruction = spirv::GLSLstd450Ceil;
+            break;
+        case EOpFract:
+            instruction = spirv::GLSLstd450Fract;
+            break;
+        case EOpMin:
+            instruction = isFloat ? spirv::GLSLstd450FMin
+                                  : (isSigned ? spirv::GLSLstd450SMin : spirv::GLSLstd450UMin);
+            splatScalars = true;
+            break;
+        case EOpMax:
+            instruction = isFloat ? spirv::GLSLstd450FMax
+                                  : (isSigned ? spirv::GLSLstd450SMax : spirv::GLSLstd450UMax);
+            splatScalars = true;
+            break;
+        case EOpClamp:
+            instruction = isFloat ? spirv::GLSLstd450FClamp
+                                  : (isSigned ? spirv::GLSLstd450SClamp : spirv::GLSLstd450UClamp);
+            splatScalars = true;
+            break;
+        case EOpMix:
+            // mix() with a boolean selector picks components instead of interpolating.
+            if (arguments[2]->getBasicType() == EbtBool)
+            {
+                return emitOp(spirv::OpSelect, resultTypeId, {values[2], values[1], values[0]});
+            }
+            instruction  = spirv::GLSLstd450FMix;
+            splatScalars = true;
+            break;
+        case EOpStep:
+            instruction  = spirv::GLSLstd450Step;
+            splatScalars = true;
+            break;
+        case EOpSmoothstep:
+            instruction  = spirv::GLSLstd450SmoothStep;
+            splatScalars = true;
+            break;
+        case EOpPackSnorm2x16:
+            instruction = spirv::GLSLstd450PackSnorm2x16;
+            break;
+        case EOpPackUnorm2x16:
+            instruction = spirv::GLSLstd450PackUnorm2x16;
+            break;
+        case EOpPackHalf2x16:
+            instruction = spirv::GLSLstd450PackHalf2x16;
+            break;
+        case EOpUnpackSnorm2x16:
+            instruction = spirv::GLSLstd450UnpackSnorm2x16;
+            break;
+        case EOpUnpackUnorm2x16:
+            instruction = spirv::GLSLstd450UnpackUnorm2x16;
+            break;
+        case EOpUnpackHalf2x16:
+            instruction = spirv::GLSLstd450UnpackHalf2x16;
+            break;
+        case EOpPackUnorm4x8:
+            instruction = spirv::GLSLstd450PackUnorm4x8;
+            break;
+        case EOpPackSnorm4x8:
+            instruction = spirv::GLSLstd450PackSnorm4x8;
+            break;
+        case EOpUnpackUnorm4x8:
+            instruction = spirv::GLSLstd450UnpackUnorm4x8;
+            break;
+        case EOpUnpackSnorm4x8:
+            instruction = spirv::GLSLstd450UnpackSnorm4x8;
+            break;
+        case EOpLength:
+            instruction = spirv::GLSLstd450Length;
+            break;
+        case EOpDistance:
+            instruction = spirv::GLSLstd450Distance;
+            break;
+        case EOpCross:
+            instruction = spirv::GLSLstd450Cross;
+            break;
+        case EOpNormalize:
+            instruction = spirv::GLSLstd450Normalize;
+            break;
+        case EOpFaceforward:
+            instruction = spirv::GLSLstd450FaceForward;
+            break;
+        case EOpReflect:
+            instruction = spirv::GLSLstd450Reflect;
+            break;
+        case EOpRefract:
+            instruction = spirv::GLSLstd450Refract;
+            break;
+        case EOpDeterminant:
+            instruction = spirv::GLSLstd450Determinant;
+            break;
+        case EOpInverse:
+            instruction = spirv::GLSLstd450MatrixInverse;
+            break;
+
+        // Built-ins with instructions of their own.
+        case EOpMod:
+            if (resultType.isVector() && arguments[1]->getType().isScalar())
+            {
+                values[1] = splat(values[1], EbtFloat, resultType.getNominalSize());
+            }
+            return emitOp(spirv::OpFMod, resultTypeId, {values[0], values[1]});
+        case EOpDot:
+            return emitOp(firstType.isScalar() ? spirv::OpFMul : spirv::OpDot, resultTypeId,
+                          {values[0], values[1]});
+        case EOpOuterProduct:
+            return emitOp(spirv::OpOuterProduct, resultTypeId, {values[0], values[1]});
+        case EOpMulMatrixComponentWise:
+            return emitComponentWise(spirv::OpFMul, resultTypeId, firstType, values[0],
+                                     arguments[1]->getType(), values[1]);
+        case EOpTranspose:
+            return emitOp(spirv::OpTranspose, resultTypeId, {values[0]});
+        case EOpAny:
+            return emitOp(spirv::OpAny, resultTypeId, {values[0]});
+        case EOpAll:
+            return emitOp(spirv::OpAll, resultTypeId, {values[0]});
+        case EOpLogicalNotComponentWise:
+            return emitOp(spirv::OpLogicalNot, resultTypeId, {values[0]});
+        case EOpIsnan:
+            return emitOp(spirv::OpIsNan, resultTypeId, {values[0]});
+        case EOpIsinf:
+            return emitOp(spirv::OpIsInf, resultTypeId, {values[0]});
+        case EOpFloatBitsToInt:
+        case EOpFloatBitsToUint:
+        case EOpIntBitsToFloat:
+        case EOpUintBitsToFloat:
+            return emitOp(spirv::OpBitcast, resultTypeId, {values[0]});
+        case EOpDFdx:
+            return emitOp(spirv::OpDPdx, resultTypeId, {values[0]});
+        case EOpDFdy:
+            return emitOp(spirv::OpDPdy, resultTypeId, {values[0]});
+        case EOpFwidth:
+            return emitOp(spirv::OpFwidth, resultTypeId, {values[0]});
+        case EOpEqualComponentWise:
+        case EOpNotEqualComponentWise:
+        case EOpLessThanComponentWise:
+        case EOpLessThanEqualComponentWise:
+        case EOpGreaterThanComponentWise:
+        case EOpGreaterThanEqualComponentWise:
+            return emitArithmetic(op, resultType, firstType, values[0], arguments[1]->getType(),
+                                  values[1]);
+
+        default:
+            markUnsupported();
+            return 0;
+    }
+
+    if (splatScalars && resultType.isVector())
+    {
+        for (size_t index = 0; index < values.size(); ++index)
+        {
+            if (arguments[index]->getType().isScalar())
+            {
+                values[index] = splat(values[index], arguments[index]->getBasicType(),
+                                      resultType.getNominalSize());
+            }
+        }
+    }
+
+    return emitExtInst(instruction, resultTypeId, values);
+}
+
+spirv::IdRef SPIRVGenerator::emitArithmetic(TOperator op,
+                                            const TType &resultType,
+                                            const TType &leftType,
+                                            spirv::IdRef left,
+                                            const TType &rightType,
+                                            spirv::IdRef right)
+{
+    spirv::IdRef resultTypeId = getTypeId(resultType);
+    TBasicType basicType      = leftType.getBasicType();
+
+    switch (op)
+    {
+        case EOpAdd:
+            return emitComponentWise(
+                SelectOp(basicType, spirv::OpFAdd, spirv::OpIAdd, spirv::OpIAdd, spirv::OpIAdd),
+                resultTypeId, leftType, left, rightType, right);
+        case EOpSub:
+            return emitComponentWise(
+                SelectOp(basicType, spirv::OpFSub, spirv::OpISub, spirv::OpISub, spirv::OpISub),
+                resultTypeId, leftType, left, rightType, right);
+        case EOpDiv:
+            return emitComponentWise(
+                SelectOp(basicType, spirv::OpFDiv, spirv::OpSDiv, spirv::OpUDiv, spirv::OpUDiv),
+                resultTypeId, leftType, left, rightType, right);
+        case EOpIMod:
+            return emitComponentWise(
+                SelectOp(basicType, spirv::OpFMod, spirv::OpSMod, spirv::OpUMod, spirv::OpUMod),
+                resultTypeId, leftType, left, rightType, right);
+
+        case EOpMul:
+        case EOpVectorTimesScalar:
+        case EOpVectorTimesMatrix:
+        case EOpMatrixTimesVector:
+        case EOpMatrixTimesScalar:
+        case EOpMatrixTimesMatrix:
+            if (leftType.isMatrix() && rightType.isMatrix())
+            {
+                return emitOp(spirv::OpMatrixTimesMatrix, resultTypeId, {left, right});
+            }
+            if (leftType.isMatrix() && rightType.isVector())
+            {
+                return emitOp(spirv::OpMatrixTimesVector, resultTypeId, {left, right});
+            }
+            if (leftType.isVector() && rightType.isMatrix())
+            {
+                return emitOp(spirv::OpVectorTimesMatrix, resultTypeId, {left, right});
+            }
+            if (leftType.isMatrix() || rightType.isMatrix())
+            {
+                return emitOp(spirv::OpMatrixTimesScalar, resultTypeId,
+                              leftType.isMatrix() ? std::initializer_list<uint32_t>{left, right}
+                                                  : std::initializer_list<uint32_t>{right, left});
+            }
+            if (basicType == EbtFloat && leftType.getNominalSize() != rightType.getNominalSize())
+            {
+                return emitOp(spirv::OpVectorTimesScalar, resultTypeId,
+                              leftType.isVector() ? std::initializer_list<uint32_t>{left, right}
+                                                  : std::initializer_list<uint32_t>{right, left});
+            }
+            return emitComponentWise(
+                SelectOp(basicType, spirv::OpFMul, spirv::OpIMul, spirv::OpIMul, spirv::OpIMul),
+                resultTypeId, leftType, left, rightType, right);
+
+        case EOpEqual:
+        case EOpNotEqual:
+            return emitEquality(op == EOpEqual, leftType, left, right);
+
+        case EOpEqualComponentWise:
+            return emitComponentWise(SelectOp(basicType, spirv::OpFOrdEqual, spirv::OpIEqual,
+                                              spirv::OpIEqual, spirv::OpLogicalEqual),
+                                     resultTypeId, leftType, left, rightType, right);
+        case EOpNotEqualComponentWise:
+            return emitComponentWise(SelectOp(basicType, spirv::OpFUnordNotEqual,
+                                              spirv::OpINotEqual, spirv::OpINotEqual,
+                                              spirv::OpLogicalNotEqual),
+                                     resultTypeId, leftType, left, rightType, right);
+        case EOpLessThan:
+        case EOpLessThanComponentWise:
+            return emitComponentWise(SelectOp(basicType, spirv::OpFOrdLessThan,
+                                              spirv::OpSLessThan, spirv::OpULessThan,
+                                              spirv::OpULessThan),
+                                     resultTypeId, leftType, left, rightType, right);
+        case EOpGreaterThan:
+        case EOpGreaterThanComponentWise:
+            return emitComponentWise(SelectOp(basicType, spirv::OpFOrdGreaterThan,
+                                              spirv::OpSGreaterThan, spirv::OpUGreaterThan,
+                                              spirv::OpUGreaterThan),
+                                     resultTypeId, leftType, left, rightType, right);
+        case EOpLessThanEqual:
+        case EOpLessThanEqualComponentWise:
+            return emitComponentWise(SelectOp(basicType, spirv::OpFOrdLessThanEqual,
+                                              spirv::OpSLessThanEqual, spirv::OpULessThanEqual,
+                                              spirv::OpULessThanEqual),
+                                     resultTypeId, leftType, left, rightType, right);
+        case EOpGreaterThanEqual:
+        case EOpGreaterThanEqualComponentWise:
+            return emitComponentWise(SelectOp(basicType, spirv::OpFOrdGreaterThanEqual,
+                                              spirv::OpSGreaterThanEqual,
+                                              spirv::OpUGreaterThanEqual,
+                                              spirv::OpUGreaterThanEqual),
+                                     resultTypeId, leftType, left, rightType, right);
+
+        case EOpLogicalXor:
+            return emitOp(spirv::OpLogicalNotEqual, resultTypeId, {left, right});
+
+        case EOpBitShiftLeft:
+            return emitComponentWise(spirv::OpShiftLeftLogical, resultTypeId, leftType, left,
+                                     rightType, right);
+        case EOpBitShiftRight:
+            return emitComponentWise(basicType == EbtInt ? spirv::OpShiftRightArithmetic
+                                                         : spirv::OpShiftRightLogical,
+                                     resultTypeId, leftType, left, rightType, right);
+        case EOpBitwiseAnd:
+            return emitComponentWise(spirv::OpBitwiseAnd, resultTypeId, leftType, left,
+                                     rightType, right);
+        case EOpBitwiseXor:
+            return emitComponentWise(spirv::OpBitwiseXor, resultTypeId, leftType, left,
+                                     rightType, right);
+        case EOpBitwiseOr:
+            return emitComponentWise(spirv::OpBitwiseOr, resultTypeId, leftType, left, rightType,
+                                     right);
+
+        default:
+            markUnsupported();
+            return 0;
+    }
+}
+
+spirv::IdRef SPIRVGenerator::emitComponentWise(spirv::Op op,
+                                               spirv::IdRef resultTypeId,
+                                               const TType &leftType,
+                                               spirv::IdRef left,
+                                               const TType &rightType,
+                                               spirv::IdRef right)
+{
+    if (leftType.isMatrix() || rightType.isMatrix())
+    {
+        // Matrices are operated on one column at a time.
+        const TType &matrixType   = leftType.isMatrix() ? leftType : rightType;
+        int rows                  = matrixType.getRows();
+        spirv::IdRef columnTypeId = mBuilder.getBasicType(EbtFloat, rows);
+
+        std::vector<spirv::IdRef> columns;
+        for (int column = 0; column < matrixType.getCols(); ++column)
+        {
+            uint32_t columnIndex = static_cast<uint32_t>(column);
+            spirv::IdRef leftColumn =
+                leftType.isMatrix()
+                    ? emitOp(spirv::OpCompositeExtract, columnTypeId, {left, columnIndex})
+                    : splat(left, EbtFloat, rows);
+            spirv::IdRef rightColumn =
+                rightType.isMatrix()
+                    ? emitOp(spirv::OpCompositeExtract, columnTypeId, {right, columnIndex})
+                    : splat(right, EbtFloat, rows);
+            columns.push_back(emitOp(op, columnTypeId, {leftColumn, rightColumn}));
+        }
+        return emitOp(spirv::OpCompositeConstruct, resultTypeId, {}, columns);
+    }
+
+    // Scalars are used for every component of the other operand.
+    int size = std::max(leftType.getNominalSize(), rightType.getNominalSize());
+    if (leftType.getNominalSize() < size)
+    {
+        left = splat(left, leftType.getBasicType(), size);
+    }
+    if (rightType.getNominalSize() < size)
+    {
+        right = splat(right, rightType.getBasicType(), size);
+    }
+    return emitOp(op, resultTypeId, {left, right});
+}
+
+spirv::IdRef SPIRVGenerator::emitEquality(bool equal,
+                                          const TType &type,
+                                          spirv::IdRef left,
+                                          spirv::IdRef right)
+{
+    if (type.isArray() || type.getStruct())
+    {
+        markUnsupported();
+        return 0;
+    }
+
+    TBasicType basicType  = type.getBasicType();
+    spirv::IdRef boolType = getScalarTypeId(EbtBool);
+    spirv::Op compareOp   = equal ? SelectOp(basicType, spirv::OpFOrdEqual, spirv::OpIEqual,
+                                           spirv::OpIEqual, spirv::OpLogicalEqual)
+                                : SelectOp(basicType, spirv::OpFUnordNotEqual, spirv::OpINotEqual,
+                                           spirv::OpINotEqual, spirv::OpLogicalNotEqual);
+    spirv::Op reduceOp    = equal ? spirv::OpAll : spirv::OpAny;
+
+    if (type.isMatrix())
+    {
+        int rows                  = type.getRows();
+        spirv::IdRef columnTypeId = mBuilder.getBasicType(EbtFloat, rows);
+        spirv::IdRef result       = 0;
+        for (int column = 0; column < type.getCols(); ++column)
+        {
+            uint32_t columnIndex = static_cast<uint32_t>(column);
+            spirv::IdRef leftColumn =
+                emitOp(spirv::OpCompositeExtract, columnTypeId, {left, columnIndex});
+            spirv::IdRef rightColumn =
+                emitOp(spirv::OpCompositeExtract, columnTypeId, {right, columnIndex});
+            spirv::IdRef compare = emitOp(compareOp, mBuilder.getBasicType(EbtBool, rows),
+                                          {leftColumn, rightColumn});
+            spirv::IdRef columnResult = emitOp(reduceOp, boolType, {compare});
+            result = result == 0 ? columnResult
+                                 : emitOp(equal ? spirv::OpLogicalAnd : spirv::OpLogicalOr,
+                                          boolType, {result, columnResult});
+        }
+        return result;
+    }
+
+    if (type.isVector())
+    {
+        spirv::IdRef compare =
+            emitOp(compareOp, mBuilder.getBasicType(EbtBool, type.getNominalSize()), {left, right});
+        return emitOp(reduceOp, boolType, {compare});
+    }
+
+    return emitOp(compareOp, boolType, {left, right});
+}
+
+spirv::IdRef SPIRVGenerator::emitOp(spirv::Op op,
+                                    spirv::IdRef resultTypeId,
+                                    std::initializer_list<uint32_t> operands)
+{
+    return emitOp(op, resultTypeId, operands, {});
+}
+
+spirv::IdRef SPIRVGenerator::emitOp(spirv::Op op,
+                                    spirv::IdRef resultTypeId,
+                                    std::initializer_list<uint32_t> operands,
+                                    const std::vector<spirv::IdRef> &moreOperands)
+{
+    spirv::IdRef result = mBuilder.getNewId();
+    size_t start        = spirv::BeginInstruction(&mBody, op);
+    mBody.push_back(resultTypeId);
+    mBody.push_back(result);
+    mBody.insert(mBody.end(), operands.begin(), operands.end());
+    mBody.insert(mBody.end(), moreOperands.begin(), moreOperands.end());
+    spirv::EndInstruction(&mBody, start);
+    return result;
+}
+
+spirv::IdRef SPIRVGenerator::emitExtInst(spirv::GLSLstd450 instruction,
+                                         spirv::IdRef resultTypeId,
+                                         const std::vector<spirv::IdRef> &operands)
+{
+    return emitOp(spirv::OpExtInst, resultTypeId, {mBuilder.getGLSLstd450(), instruction},
+                  operands);
+}
+
+spirv::IdRef SPIRVGenerator::splat(spirv::IdRef scalar, TBasicType type, int size)
+{
+    if (size <= 1)
+    {
+        return scalar;
+    }
+    return emitOp(spirv::OpCompositeConstruct, mBuilder.getBasicType(type, size), {},
+                  std::vector<spirv::IdRef>(size, scalar));
+}
+
+std::vector<spirv::IdRef> SPIRVGenerator::getScalars(spirv::IdRef value, const TType &type)
+{
+    if (type.isScalar())
+    {
+        return {value};
+    }
+
+    spirv::IdRef scalarTypeId = getScalarTypeId(type.getBasicType());
+    std::vector<spirv::IdRef> scalars;
+    if (type.isMatrix())
+    {
+        for (int column = 0; column < type.getCols(); ++column)
+        {
+            for (int row = 0; row < type.getRows(); ++row)
+            {
+                scalars.push_back(
+                    emitOp(spirv::OpCompositeExtract, scalarTypeId,
+                           {value, static_cast<uint32_t>(column), static_cast<uint32_t>(row)}));
+            }
+        }
+    }
+    else
+    {
+        for (int component = 0; component < type.getNominalSize(); ++component)
+        {
+            scalars.push_back(emitOp(spirv::OpCompositeExtract, scalarTypeId,
+                                     {value, static_cast<uint32_t>(component)}));
+        }
+    }
+    return scalars;
+}
+
+spirv::IdRef SPIRVGenerator::convertScalar(spirv::IdRef value, TBasicType from, TBasicType to)
+{
+    if (from == to)
+    {
+        return value;
+    }
+
+    spirv::IdRef typeId = getScalarTypeId(to);
+
+    if (to == EbtBool)
+    {
+        return emitOp(from == EbtFloat ? spirv::OpFUnordNotEqual : spirv::OpINotEqual, typeId,
+                      {value, getScalarConstant(from, 0)});
+    }
+    if (from == EbtBool)
+    {
+        return emitOp(spirv::OpSelect, typeId,
+                      {value, getScalarConstant(to, 1), getScalarConstant(to, 0)});
+    }
+    if (from == EbtFloat)
+    {
+        return emitOp(to == EbtInt ? spirv::OpConvertFToS : spirv::OpConvertFToU, typeId,
+                      {value});
+    }
+    if (to == EbtFloat)
+    {
+        return emitOp(from == EbtInt ? spirv::OpConvertSToF : spirv::OpConvertUToF, typeId,
+                      {value});
+    }
+    return emitOp(spirv::OpBitcast, typeId, {value});
+}
+
+}  // anonymous namespace
+
+bool OutputSPIRV(TIntermBlock *root,
+                 sh::GLenum shaderType,
+                 int shaderVersion,
+                 const std::vector<Uniform> &uniforms,
+                 spirv::Blob *spirvOut)
+{
+    SPIRVGenerator generator(shaderType, shaderVersion, uniforms);
+    return generator.generate(root, spirvOut);
+}
+
+}  // namespace sh
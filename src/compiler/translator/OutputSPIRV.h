@@ -0,0 +1,37 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// OutputSPIRV: Generates SPIR-V for Vulkan directly from the validated AST, so that the
+//   GLSL -> glslang round trip can be skipped at link time. Only a subset of the language is
+//   supported. The interface variables are named after their GLSL names and given placeholder
+//   locations, sets and bindings, which are patched when the program is linked, like the layout
+//   placeholders of the GLSL output.
+//
+
+#ifndef COMPILER_TRANSLATOR_OUTPUTSPIRV_H_
+#define COMPILER_TRANSLATOR_OUTPUTSPIRV_H_
+
+#include <vector>
+
+#include "GLSLANG/ShaderLang.h"
+#include "compiler/translator/BuildSPIRV.h"
+
+namespace sh
+{
+
+class TIntermBlock;
+
+// Returns false without writing anything if the shader uses something that isn't supported, in
+// which case the GLSL output should be used instead. |uniforms| are the uniforms collected by the
+// translator, which make up the default uniform block in the same order as on the GL side.
+bool OutputSPIRV(TIntermBlock *root,
+                 sh::GLenum shaderType,
+                 int shaderVersion,
+                 const std::vector<Uniform> &uniforms,
+                 spirv::Blob *spirvOut);
+
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_OUTPUTSPIRV_H_
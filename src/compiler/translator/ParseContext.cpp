@@ -8,6 +8,7 @@
 
 #include <stdarg.h>
 #include <stdio.h>
+#include <chrono>
 
 #include "common/mathutil.h"
 #include "compiler/preprocessor/SourceLocation.h"
@@ -221,6 +222,7 @@ TParseContext::TParseContext(TSymbolTable &symt,
                         mShaderType,
                         resources.WEBGL_debug_shader_precision == 1),
       mPreprocessor(mDiagnostics, &mDirectiveHandler, pp::PreprocessorSettings()),
+      mPreprocessorSeconds(0.0),
       mScanner(nullptr),
       mUsesFragData(false),
       mUsesFragColor(false),
@@ -254,6 +256,19 @@ TParseContext::~TParseContext()
 {
 }
 
+void TParseContext::lexPreprocessorToken(pp::Token *token)
+{
+    if ((mCompileOptions & SH_COLLECT_COMPILE_STATISTICS) == 0)
+    {
+        mPreprocessor.lex(token);
+        return;
+    }
+    auto startTime = std::chrono::steady_clock::now();
+    mPreprocessor.lex(token);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+    mPreprocessorSeconds += elapsed.count();
+}
+
 bool TParseContext::parseVectorFields(const TSourceLoc &line,
                                       const ImmutableString &compString,
                                       int vecSize,
@@ -3440,7 +3455,8 @@ TFunction *TParseContext::parseFunctionHeader(const TPublicType &type,
     }
 
     // Add the function as a prototype after parsing it (we do not support recursion)
-    return new TFunction(&symbolTable, name, SymbolType::UserDefined, new TType(type), false);
+    return new TFunction(&symbolTable, name, SymbolType::UserDefined,
+                         mTypeInterner.intern(TType(type)), false);
 }
 
 TFunctionLookup *TParseContext::addNonConstructorFunc(const ImmutableString &name,
@@ -3462,14 +3478,14 @@ TFunctionLookup *TParseContext::addConstructorFunc(const TPublicType &publicType
               getBasicString(publicType.getBasicType()));
     }
 
-    TType *type = new TType(publicType);
-    if (!type->canBeConstructed())
+    TType type(publicType);
+    if (!type.canBeConstructed())
     {
         error(publicType.getLine(), "cannot construct this type",
               getBasicString(publicType.getBasicType()));
-        type->setBasicType(EbtFloat);
+        type.setBasicType(EbtFloat);
     }
-    return TFunctionLookup::CreateConstructor(type);
+    return TFunctionLookup::CreateConstructor(mTypeInterner.intern(type));
 }
 
 void TParseContext::checkIsNotUnsizedArray(const TSourceLoc &line,
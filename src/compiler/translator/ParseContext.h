@@ -14,6 +14,7 @@
 #include "compiler/translator/FunctionLookup.h"
 #include "compiler/translator/QualifierTypes.h"
 #include "compiler/translator/SymbolTable.h"
+#include "compiler/translator/TypeInterner.h"
 
 namespace sh
 {
@@ -45,6 +46,10 @@ class TParseContext : angle::NonCopyable
 
     const pp::Preprocessor &getPreprocessor() const { return mPreprocessor; }
     pp::Preprocessor &getPreprocessor() { return mPreprocessor; }
+    // Lexes the next token from the preprocessor. The time spent in the preprocessor is measured
+    // if compile statistics are collected.
+    void lexPreprocessorToken(pp::Token *token);
+    double getPreprocessorSeconds() const { return mPreprocessorSeconds; }
     void *getScanner() const { return mScanner; }
     void setScanner(void *scanner) { mScanner = scanner; }
     int getShaderVersion() const { return mShaderVersion; }
@@ -605,6 +610,10 @@ class TParseContext : angle::NonCopyable
     TDiagnostics *mDiagnostics;
     TDirectiveHandler mDirectiveHandler;
     pp::Preprocessor mPreprocessor;
+    // Shares the types that are not modified after they are parsed, like constructor and function
+    // return types, between all their uses in the shader.
+    TTypeInterner mTypeInterner;
+    double mPreprocessorSeconds;
     void *mScanner;
     bool mUsesFragData;  // track if we are using both gl_FragData and gl_FragColor
     bool mUsesFragColor;
@@ -22,7 +22,7 @@ bool InitializePoolIndex()
 {
     assert(PoolIndex == TLS_INVALID_INDEX);
 
-    PoolIndex = CreateTLSIndex();
+    PoolIndex = CreateTLSIndex(nullptr);
     return PoolIndex != TLS_INVALID_INDEX;
 }
 
@@ -58,8 +58,14 @@ TPoolAllocator::TPoolAllocator(int growthIncrement, int allocationAlignment)
       inUseList(0),
       numCalls(0),
       totalBytes(0),
+      bytesInUse(0),
+      highWaterMark(0),
+      recyclingEnabled(false),
 #endif
-      mLocked(false)
+      mLocked(false),
+      statisticsEnabled(false),
+      numNodesAllocated(0),
+      numNodesVisited(0)
 {
     //
     // Adjust alignment to be at least pointer aligned and
@@ -97,6 +103,8 @@ TPoolAllocator::TPoolAllocator(int growthIncrement, int allocationAlignment)
     {
         headerSkip = (sizeof(tHeader) + alignmentMask) & ~alignmentMask;
     }
+
+    clearRecycledBlocks();
 #else  // !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
     mStack.push_back({});
 #endif
@@ -206,12 +214,16 @@ void TPoolAllocator::pop()
     tHeader *page     = mStack.back().page;
     currentPageOffset = mStack.back().offset;
 
+    // Recycled blocks may be in the pages that are freed.
+    clearRecycledBlocks();
+
     while (inUseList != page)
     {
         // invoke destructor to free allocation list
         inUseList->~tHeader();
 
         tHeader *nextInUse = inUseList->nextPage;
+        bytesInUse -= inUseList->pageCount * pageSize;
         if (inUseList->pageCount > 1)
             delete[] reinterpret_cast<char *>(inUseList);
         else
@@ -253,6 +265,17 @@ void *TPoolAllocator::allocate(size_t numBytes)
     ++numCalls;
     totalBytes += numBytes;
 
+    if (recyclingEnabled && numBytes <= kMaxRecycledBlockSize)
+    {
+        size_t index = recycledBlockIndex(numBytes);
+        void *block  = recycledBlocks[index];
+        if (block)
+        {
+            recycledBlocks[index] = *reinterpret_cast<void **>(block);
+            return block;
+        }
+    }
+
     // If we are using guard blocks, all allocations are bracketed by
     // them: [guardblock][allocation][guardblock].  numBytes is how
     // much memory the caller asked for.  allocationSize is the total
@@ -297,6 +320,7 @@ void *TPoolAllocator::allocate(size_t numBytes)
         // Use placement-new to initialize header
         new (memory) tHeader(inUseList, (numBytesToAlloc + pageSize - 1) / pageSize);
         inUseList = memory;
+        trackPageInUse(memory);
 
         currentPageOffset = pageSize;  // make next allocation come from a new page
 
@@ -323,6 +347,7 @@ void *TPoolAllocator::allocate(size_t numBytes)
     // Use placement-new to initialize header
     new (memory) tHeader(inUseList, 1);
     inUseList = memory;
+    trackPageInUse(memory);
 
     unsigned char *ret = reinterpret_cast<unsigned char *>(inUseList) + headerSkip;
     currentPageOffset  = (headerSkip + allocationSize + alignmentMask) & ~alignmentMask;
@@ -338,6 +363,30 @@ void *TPoolAllocator::allocate(size_t numBytes)
 #endif
 }
 
+void TPoolAllocator::deallocate(void *memory, size_t numBytes)
+{
+#if !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
+    if (recyclingEnabled && memory && numBytes > 0 && numBytes <= kMaxRecycledBlockSize)
+    {
+        size_t index                       = recycledBlockIndex(numBytes);
+        *reinterpret_cast<void **>(memory) = recycledBlocks[index];
+        recycledBlocks[index]              = memory;
+    }
+#endif
+}
+
+void TPoolAllocator::setRecyclingEnabled(bool enabled)
+{
+#if !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC) && !defined(GUARD_BLOCKS)
+    // Guard blocks track every allocation, so blocks can't be reused when they're enabled.
+    recyclingEnabled = enabled;
+    if (!enabled)
+    {
+        clearRecycledBlocks();
+    }
+#endif
+}
+
 void TPoolAllocator::lock()
 {
     ASSERT(!mLocked);
@@ -350,6 +399,40 @@ void TPoolAllocator::unlock()
     mLocked = false;
 }
 
+size_t TPoolAllocator::getBytesInUse() const
+{
+#if !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
+    return bytesInUse;
+#else
+    return 0;
+#endif
+}
+
+size_t TPoolAllocator::getHighWaterMark() const
+{
+#if !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
+    return highWaterMark;
+#else
+    return 0;
+#endif
+}
+
+void TPoolAllocator::resetHighWaterMark()
+{
+#if !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
+    highWaterMark = bytesInUse;
+#endif
+}
+
+size_t TPoolAllocator::getTotalBytesAllocated() const
+{
+#if !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
+    return totalBytes;
+#else
+    return 0;
+#endif
+}
+
 //
 // Check all allocations in a list for damage by calling check on each.
 //
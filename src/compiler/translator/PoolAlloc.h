@@ -33,6 +33,7 @@
 
 #include <stddef.h>
 #include <string.h>
+#include <type_traits>
 #include <vector>
 
 // If we are using guard blocks, we must track each indivual
@@ -152,17 +153,55 @@ class TPoolAllocator
     void *allocate(size_t numBytes);
 
     //
-    // There is no deallocate.  The point of this class is that
-    // deallocation can be skipped by the user of it, as the model
-    // of use is to simultaneously deallocate everything at once
-    // by calling pop(), and to not have to solve memory leak problems.
+    // Deallocation can be skipped by the user of this class, as the model
+    // of use is to simultaneously deallocate everything at once by calling
+    // pop(), and to not have to solve memory leak problems.
     //
+    // Containers that outgrow their storage do give it back through
+    // deallocate() though.  While recycling is enabled, small blocks given
+    // back are kept in free lists by size and handed out again by allocate(),
+    // so that rewriting the tree doesn't keep growing the pool.  The free
+    // lists are emptied by pop() and when recycling is disabled.  Only enable
+    // recycling while everything deallocated is known to come from this pool.
+    //
+    void deallocate(void *memory, size_t numBytes);
+    void setRecyclingEnabled(bool enabled);
 
     // Catch unwanted allocations.
     // TODO(jmadill): Remove this when we remove the global allocator.
     void lock();
     void unlock();
 
+    //
+    // The amount of page memory currently held for live allocations, and the
+    // largest it has been since the last call to resetHighWaterMark().
+    //
+    size_t getBytesInUse() const;
+    size_t getHighWaterMark() const;
+    void resetHighWaterMark();
+
+    //
+    // Running totals for the compile statistics: the bytes requested from
+    // allocate(), the AST nodes allocated from the pool, and the nodes visited
+    // by traversers created while this is the global pool allocator.  They're
+    // kept here since the pool allocator is the per-thread state of a
+    // compilation.  Nodes are only counted while statistics are enabled, so
+    // that compiles that don't collect them don't pay for the counting, and
+    // getNodeVisitCounter() returns null while they're disabled.
+    //
+    size_t getTotalBytesAllocated() const;
+    void setStatisticsEnabled(bool enabled) { statisticsEnabled = enabled; }
+    void countNodeAllocation()
+    {
+        if (statisticsEnabled)
+        {
+            ++numNodesAllocated;
+        }
+    }
+    size_t getNumNodesAllocated() const { return numNodesAllocated; }
+    size_t *getNodeVisitCounter() { return statisticsEnabled ? &numNodesVisited : nullptr; }
+    size_t getNumNodesVisited() const { return numNodesVisited; }
+
   private:
     size_t alignment;  // all returned allocations will be aligned at
                        // this granularity, which will be a power of 2
@@ -216,6 +255,13 @@ class TPoolAllocator
         return TAllocation::offsetAllocation(memory);
     }
 
+    void trackPageInUse(const tHeader *page)
+    {
+        bytesInUse += page->pageCount * pageSize;
+        if (bytesInUse > highWaterMark)
+            highWaterMark = bytesInUse;
+    }
+
     size_t pageSize;           // granularity of allocation from the OS
     size_t headerSkip;         // amount of memory to skip to make room for the
                                //      header (basically, size of header, rounded
@@ -228,6 +274,22 @@ class TPoolAllocator
     int numCalls;       // just an interesting statistic
     size_t totalBytes;  // just an interesting statistic
 
+    size_t bytesInUse;     // size of the pages in inUseList
+    size_t highWaterMark;  // largest bytesInUse since the last reset
+
+    // Free lists of recycled blocks, indexed by the block size in pointer-sized
+    // units.  The first word of each block points to the next one in the list.
+    static const size_t kMaxRecycledBlockSize = 1024;
+    static const size_t kNumRecycledBlockSizes = kMaxRecycledBlockSize / sizeof(void *) + 1;
+    size_t recycledBlockIndex(size_t numBytes) const
+    {
+        return ((numBytes + alignmentMask) & ~alignmentMask) / sizeof(void *);
+    }
+    void clearRecycledBlocks() { memset(recycledBlocks, 0, sizeof(recycledBlocks)); }
+
+    bool recyclingEnabled;
+    void *recycledBlocks[kNumRecycledBlockSizes];
+
 #else  // !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
     std::vector<std::vector<void *>> mStack;
 #endif
@@ -235,6 +297,10 @@ class TPoolAllocator
     TPoolAllocator &operator=(const TPoolAllocator &);  // dont allow assignment operator
     TPoolAllocator(const TPoolAllocator &);             // dont allow default copy constructor
     bool mLocked;
+
+    bool statisticsEnabled;
+    size_t numNodesAllocated;
+    size_t numNodesVisited;
 };
 
 //
@@ -272,19 +338,29 @@ class pool_allocator
     pointer address(reference x) const { return &x; }
     const_pointer address(const_reference x) const { return &x; }
 
-    pool_allocator() {}
+    // Containers take their memory from the pool that is the global one when they're created, and
+    // give it back to that same pool even if another pool is the global one by then.
+    pool_allocator() : mPool(GetGlobalPoolAllocator()) {}
 
     template <class Other>
-    pool_allocator(const pool_allocator<Other> &p)
+    pool_allocator(const pool_allocator<Other> &p) : mPool(p.mPool)
     {
     }
 
     template <class Other>
     pool_allocator<T> &operator=(const pool_allocator<Other> &p)
     {
+        mPool = p.mPool;
         return *this;
     }
 
+    // A copy of a container is made in the current global pool rather than in the pool of the
+    // original, which may be a longer-lived one such as the pool of the built-in symbols.
+    pool_allocator select_on_container_copy_construction() const { return pool_allocator(); }
+    typedef std::false_type propagate_on_container_copy_assignment;
+    typedef std::true_type propagate_on_container_move_assignment;
+    typedef std::true_type propagate_on_container_swap;
+
 #if defined(__SUNPRO_CC) && !defined(_RWSTD_ALLOCATOR)
     // libCStd on some platforms have a different allocate/deallocate interface.
     // Caller pre-bakes sizeof(T) into 'n' which is the number of bytes to be
@@ -301,19 +377,33 @@ class pool_allocator
     {
         return reinterpret_cast<pointer>(getAllocator().allocate(n * sizeof(T)));
     }
-    void deallocate(pointer, size_type) {}
+    void deallocate(pointer p, size_type n)
+    {
+        // Containers created while there was no global pool don't know where their memory came
+        // from, so it is left to be freed with the pool.
+        if (mPool)
+        {
+            mPool->deallocate(p, n * sizeof(T));
+        }
+    }
 #endif  // _RWSTD_ALLOCATOR
 
     void construct(pointer p, const T &val) { new ((void *)p) T(val); }
     void destroy(pointer p) { p->T::~T(); }
 
-    bool operator==(const pool_allocator &rhs) const { return true; }
-    bool operator!=(const pool_allocator &rhs) const { return false; }
+    bool operator==(const pool_allocator &rhs) const { return mPool == rhs.mPool; }
+    bool operator!=(const pool_allocator &rhs) const { return mPool != rhs.mPool; }
 
     size_type max_size() const { return static_cast<size_type>(-1) / sizeof(T); }
     size_type max_size(int size) const { return static_cast<size_type>(-1) / size; }
 
-    TPoolAllocator &getAllocator() const { return *GetGlobalPoolAllocator(); }
+    TPoolAllocator &getAllocator() const { return mPool ? *mPool : *GetGlobalPoolAllocator(); }
+
+  private:
+    template <class Other>
+    friend class pool_allocator;
+
+    TPoolAllocator *mPool;
 };
 
 #endif  // COMPILER_TRANSLATOR_POOLALLOC_H_
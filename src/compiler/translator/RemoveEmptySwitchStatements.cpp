@@ -7,6 +7,7 @@
 
 #include "compiler/translator/RemoveEmptySwitchStatements.h"
 
+#include "compiler/translator/FusedTraverser.h"
 #include "compiler/translator/IntermTraverse.h"
 
 namespace sh
@@ -53,4 +54,10 @@ void RemoveEmptySwitchStatements(TIntermBlock *root)
     traverser.updateTree();
 }
 
+void RemoveEmptySwitchStatements(TFusedTraverser *fusedTraverser)
+{
+    fusedTraverser->addTraverser(
+        std::unique_ptr<TIntermTraverser>(new RemoveEmptySwitchStatementsTraverser()));
+}
+
 }  // namespace sh
@@ -10,9 +10,14 @@
 
 namespace sh
 {
+class TFusedTraverser;
 class TIntermBlock;
 
 void RemoveEmptySwitchStatements(TIntermBlock *root);
+
+// Adds the pass to a fused traversal. The switch statements are removed once the fused traversal
+// updates the tree.
+void RemoveEmptySwitchStatements(TFusedTraverser *fusedTraverser);
 }
 
 #endif  // COMPILER_TRANSLATOR_REMOVEEMPTYSWITCHSTATEMENTS_H_
\ No newline at end of file
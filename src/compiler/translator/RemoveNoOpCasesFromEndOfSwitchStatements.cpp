@@ -8,6 +8,7 @@
 
 #include "compiler/translator/RemoveNoOpCasesFromEndOfSwitchStatements.h"
 
+#include "compiler/translator/FusedTraverser.h"
 #include "compiler/translator/IntermNode.h"
 #include "compiler/translator/IntermNode_util.h"
 #include "compiler/translator/IntermTraverse.h"
@@ -113,4 +114,11 @@ void RemoveNoOpCasesFromEndOfSwitchStatements(TIntermBlock *root, TSymbolTable *
     root->traverse(&traverser);
 }
 
+void RemoveNoOpCasesFromEndOfSwitchStatements(TFusedTraverser *fusedTraverser,
+                                              TSymbolTable *symbolTable)
+{
+    fusedTraverser->addTraverser(std::unique_ptr<TIntermTraverser>(
+        new RemoveNoOpCasesFromEndOfSwitchTraverser(symbolTable)));
+}
+
 }  // namespace sh
@@ -11,11 +11,17 @@
 
 namespace sh
 {
+class TFusedTraverser;
 class TIntermBlock;
 class TSymbolTable;
 
 void RemoveNoOpCasesFromEndOfSwitchStatements(TIntermBlock *root, TSymbolTable *symbolTable);
 
+// Adds the pass to a fused traversal. The cases are removed in place when the switch statement is
+// visited.
+void RemoveNoOpCasesFromEndOfSwitchStatements(TFusedTraverser *fusedTraverser,
+                                              TSymbolTable *symbolTable);
+
 }  // namespace sh
 
 #endif  // COMPILER_TRANSLATOR_REMOVENOOPCASESFROMENDOFSWITCHSTATEMENTS_H_
@@ -19,7 +19,9 @@ namespace sh
 namespace
 {
 
-class CollectVariableRefCountsTraverser : public TIntermTraverser
+// Only reads the tree, so it can use the statically dispatched traversal.
+class CollectVariableRefCountsTraverser
+    : public TIntermPreOrderTraverser<CollectVariableRefCountsTraverser>
 {
   public:
     CollectVariableRefCountsTraverser();
@@ -28,9 +30,9 @@ class CollectVariableRefCountsTraverser : public TIntermTraverser
     RefCountMap &getSymbolIdRefCounts() { return mSymbolIdRefCounts; }
     RefCountMap &getStructIdRefCounts() { return mStructIdRefCounts; }
 
-    void visitSymbol(TIntermSymbol *node) override;
-    bool visitAggregate(Visit visit, TIntermAggregate *node) override;
-    bool visitFunctionPrototype(Visit visit, TIntermFunctionPrototype *node) override;
+    void visitSymbol(TIntermSymbol *node);
+    bool visitAggregate(Visit visit, TIntermAggregate *node);
+    bool visitFunctionPrototype(Visit visit, TIntermFunctionPrototype *node);
 
   private:
     void incrementStructTypeRefCount(const TType &type);
@@ -47,7 +49,6 @@ class CollectVariableRefCountsTraverser : public TIntermTraverser
 };
 
 CollectVariableRefCountsTraverser::CollectVariableRefCountsTraverser()
-    : TIntermTraverser(true, false, false)
 {
 }
 
@@ -360,7 +361,7 @@ void RemoveUnreferencedVariablesTraverser::traverseLoop(TIntermLoop *node)
 void RemoveUnreferencedVariables(TIntermBlock *root, TSymbolTable *symbolTable)
 {
     CollectVariableRefCountsTraverser collector;
-    root->traverse(&collector);
+    collector.traverse(root);
     RemoveUnreferencedVariablesTraverser traverser(&collector.getSymbolIdRefCounts(),
                                                    &collector.getStructIdRefCounts(), symbolTable);
     root->traverse(&traverser);
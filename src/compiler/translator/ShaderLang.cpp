@@ -397,11 +397,33 @@ const std::string &GetObjectCode(const ShHandle handle)
     return infoSink.obj.str();
 }
 
+const std::vector<uint32_t> &GetObjectBinary(const ShHandle handle)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    ASSERT(compiler);
+
+    return compiler->getObjectBinary();
+}
+
+size_t GetPoolMemoryHighWaterMark(const ShHandle handle)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    ASSERT(compiler);
+    return compiler->getPoolHighWaterMark();
+}
+
+const std::vector<CompileStageStatistics> *GetCompileStatistics(const ShHandle handle)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    ASSERT(compiler);
+    return &compiler->getCompileStatistics();
+}
+
 const std::map<std::string, std::string> *GetNameHashingMap(const ShHandle handle)
 {
     TCompiler *compiler = GetCompilerFromHandle(handle);
     ASSERT(compiler);
-    return &(compiler->getNameMap());
+    return &(compiler->getNameMap().getHashedNames());
 }
 
 const std::vector<Uniform> *GetUniforms(const ShHandle handle)
@@ -215,6 +215,29 @@ class TFunction : public TSymbol
               TOperator op,
               bool knownToNotHaveSideEffects);
 
+    // Statically allocated built-in function, see SymbolTable_autogen.cpp.
+    constexpr TFunction(const TSymbolUniqueId &id,
+                        const ImmutableString &name,
+                        TExtension extension,
+                        const TConstParameter *parameters,
+                        size_t paramCount,
+                        const TType *retType,
+                        const ImmutableString &mangledName,
+                        TOperator op,
+                        bool knownToNotHaveSideEffects)
+        : TSymbol(id, name, SymbolType::BuiltIn, extension),
+          mParametersVector(nullptr),
+          mParameters(parameters),
+          mParamCount(paramCount),
+          returnType(retType),
+          mMangledName(mangledName),
+          mOp(op),
+          defined(false),
+          mHasPrototypeDeclaration(false),
+          mKnownToNotHaveSideEffects(knownToNotHaveSideEffects)
+    {
+    }
+
     bool isFunction() const override { return true; }
 
     void addParameter(const TConstParameter &p);
@@ -247,28 +270,6 @@ class TFunction : public TSymbol
     bool isImageFunction() const;
 
   private:
-    constexpr TFunction(const TSymbolUniqueId &id,
-                        const ImmutableString &name,
-                        TExtension extension,
-                        const TConstParameter *parameters,
-                        size_t paramCount,
-                        const TType *retType,
-                        const ImmutableString &mangledName,
-                        TOperator op,
-                        bool knownToNotHaveSideEffects)
-        : TSymbol(id, name, SymbolType::BuiltIn, extension),
-          mParametersVector(nullptr),
-          mParameters(parameters),
-          mParamCount(paramCount),
-          returnType(retType),
-          mMangledName(mangledName),
-          mOp(op),
-          defined(false),
-          mHasPrototypeDeclaration(false),
-          mKnownToNotHaveSideEffects(knownToNotHaveSideEffects)
-    {
-    }
-
     ImmutableString buildMangledName() const;
 
     typedef TVector<TConstParameter> TParamVector;
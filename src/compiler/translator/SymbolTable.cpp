@@ -20,10 +20,37 @@
 #include "compiler/translator/ImmutableString.h"
 #include "compiler/translator/IntermNode.h"
 #include "compiler/translator/StaticType.h"
+#include "compiler/translator/SymbolTable_autogen.h"
 
 namespace sh
 {
 
+namespace
+{
+
+// The id range symbols created on this thread take their ids from, if any.
+thread_local TSymbolTable::ScopedUniqueIdRange *gCurrentUniqueIdRange = nullptr;
+
+unsigned char GetBuiltInShaderTypeBit(sh::GLenum type)
+{
+    switch (type)
+    {
+        case GL_VERTEX_SHADER:
+            return kBuiltInVertexShader;
+        case GL_FRAGMENT_SHADER:
+            return kBuiltInFragmentShader;
+        case GL_COMPUTE_SHADER:
+            return kBuiltInComputeShader;
+        case GL_GEOMETRY_SHADER_EXT:
+            return kBuiltInGeometryShaderEXT;
+        default:
+            UNREACHABLE();
+            return 0u;
+    }
+}
+
+}  // anonymous namespace
+
 class TSymbolTable::TSymbolTableLevel
 {
   public:
@@ -67,9 +94,6 @@ class TSymbolTable::TSymbolTableBuiltInLevel
 
     const TSymbol *find(const ImmutableString &name) const;
 
-    void insertUnmangledBuiltIn(const char *name, TExtension ext);
-    const UnmangledBuiltIn *getUnmangledBuiltIn(const ImmutableString &name) const;
-
   private:
     using tLevel        = TUnorderedMap<ImmutableString,
                                  const TSymbol *,
@@ -78,8 +102,6 @@ class TSymbolTable::TSymbolTableBuiltInLevel
     using tInsertResult = std::pair<tLevel::iterator, bool>;
 
     tLevel mLevel;
-
-    std::map<ImmutableString, UnmangledBuiltIn> mUnmangledBuiltIns;
 };
 
 bool TSymbolTable::TSymbolTableLevel::insert(TSymbol *symbol)
@@ -119,29 +141,8 @@ const TSymbol *TSymbolTable::TSymbolTableBuiltInLevel::find(const ImmutableStrin
         return (*it).second;
 }
 
-void TSymbolTable::TSymbolTableBuiltInLevel::insertUnmangledBuiltIn(const char *name,
-                                                                    TExtension ext)
-{
-    ImmutableString immName(name);
-    if (ext == TExtension::UNDEFINED ||
-        mUnmangledBuiltIns.find(immName) == mUnmangledBuiltIns.end())
-    {
-        mUnmangledBuiltIns[immName] = UnmangledBuiltIn(ext);
-    }
-}
-
-const UnmangledBuiltIn *TSymbolTable::TSymbolTableBuiltInLevel::getUnmangledBuiltIn(
-    const ImmutableString &name) const
-{
-    auto it = mUnmangledBuiltIns.find(ImmutableString(name));
-    if (it == mUnmangledBuiltIns.end())
-    {
-        return nullptr;
-    }
-    return &(it->second);
-}
-
-TSymbolTable::TSymbolTable() : mUniqueIdCounter(0), mUserDefinedUniqueIdsStart(-1)
+TSymbolTable::TSymbolTable()
+    : mShaderTypeBit(0u), mUniqueIdCounter(kLastStaticBuiltInId), mUserDefinedUniqueIdsStart(-1)
 {
 }
 
@@ -165,6 +166,31 @@ void TSymbolTable::pop()
     mPrecisionStack.pop_back();
 }
 
+TSymbolTable::SavedGlobalScope::SavedGlobalScope() : mUniqueIdCounter(0)
+{
+}
+
+TSymbolTable::SavedGlobalScope::~SavedGlobalScope() = default;
+
+void TSymbolTable::saveGlobalScope(SavedGlobalScope *scope)
+{
+    ASSERT(atGlobalLevel());
+    ASSERT(scope->empty());
+    scope->mLevel           = std::move(mTable.back());
+    scope->mPrecisionLevel  = std::move(mPrecisionStack.back());
+    scope->mUniqueIdCounter = mUniqueIdCounter.load();
+    pop();
+}
+
+void TSymbolTable::restoreGlobalScope(SavedGlobalScope *scope)
+{
+    ASSERT(atBuiltInLevel());
+    ASSERT(!scope->empty());
+    mTable.push_back(std::move(scope->mLevel));
+    mPrecisionStack.push_back(std::move(scope->mPrecisionLevel));
+    mUniqueIdCounter.store(scope->mUniqueIdCounter);
+}
+
 const TFunction *TSymbolTable::markFunctionHasPrototypeDeclaration(
     const ImmutableString &mangledName,
     bool *hadPrototypeDeclarationOut)
@@ -229,20 +255,46 @@ const TSymbol *TSymbolTable::findBuiltIn(const ImmutableString &name, int shader
     return findBuiltIn(name, shaderVersion, false);
 }
 
+bool TSymbolTable::IsBuiltInLevelVisible(ESymbolLevel level,
+                                         int shaderVersion,
+                                         bool includeGLSLBuiltins)
+{
+    switch (level)
+    {
+        case GLSL_BUILTINS:
+            return includeGLSLBuiltins;
+        case ESSL3_1_BUILTINS:
+            return shaderVersion == 310;
+        case ESSL3_BUILTINS:
+            return shaderVersion >= 300;
+        case ESSL1_BUILTINS:
+            return shaderVersion == 100;
+        default:
+            return true;
+    }
+}
+
 const TSymbol *TSymbolTable::findBuiltIn(const ImmutableString &name,
                                          int shaderVersion,
                                          bool includeGLSLBuiltins) const
 {
+    // Built-in functions are allocated statically and looked up from a perfect hash table keyed by
+    // the mangled name. The entries are sorted from the highest level to the lowest.
+    size_t functionCount                  = 0u;
+    const BuiltInFunctionEntry *functions = FindMangledBuiltInFunctions(name, &functionCount);
+    for (size_t i = 0u; i < functionCount; ++i)
+    {
+        if ((functions[i].shaderTypes & mShaderTypeBit) != 0 &&
+            IsBuiltInLevelVisible(functions[i].level, shaderVersion, includeGLSLBuiltins))
+        {
+            return functions[i].function;
+        }
+    }
+
     for (int level = LAST_BUILTIN_LEVEL; level >= 0; level--)
     {
-        if (level == GLSL_BUILTINS && !includeGLSLBuiltins)
-            level--;
-        if (level == ESSL3_1_BUILTINS && shaderVersion != 310)
-            level--;
-        if (level == ESSL3_BUILTINS && shaderVersion < 300)
-            level--;
-        if (level == ESSL1_BUILTINS && shaderVersion != 100)
-            level--;
+        if (!IsBuiltInLevelVisible(level, shaderVersion, includeGLSLBuiltins))
+            continue;
 
         const TSymbol *symbol = mBuiltInTable[level]->find(name);
 
@@ -252,87 +304,6 @@ const TSymbol *TSymbolTable::findBuiltIn(const ImmutableString &name,
 
     return nullptr;
 }
-
-constexpr bool IsGenType(const TType *type)
-{
-    if (type)
-    {
-        TBasicType basicType = type->getBasicType();
-        return basicType == EbtGenType || basicType == EbtGenIType || basicType == EbtGenUType ||
-               basicType == EbtGenBType;
-    }
-
-    return false;
-}
-
-constexpr bool IsVecType(const TType *type)
-{
-    if (type)
-    {
-        TBasicType basicType = type->getBasicType();
-        return basicType == EbtVec || basicType == EbtIVec || basicType == EbtUVec ||
-               basicType == EbtBVec;
-    }
-
-    return false;
-}
-
-constexpr const TType *SpecificType(const TType *type, int size)
-{
-    ASSERT(size >= 1 && size <= 4);
-
-    if (!type)
-    {
-        return nullptr;
-    }
-
-    ASSERT(!IsVecType(type));
-
-    switch (type->getBasicType())
-    {
-        case EbtGenType:
-            return StaticType::GetForVec<EbtFloat>(type->getQualifier(),
-                                                            static_cast<unsigned char>(size));
-        case EbtGenIType:
-            return StaticType::GetForVec<EbtInt>(type->getQualifier(),
-                                                          static_cast<unsigned char>(size));
-        case EbtGenUType:
-            return StaticType::GetForVec<EbtUInt>(type->getQualifier(),
-                                                           static_cast<unsigned char>(size));
-        case EbtGenBType:
-            return StaticType::GetForVec<EbtBool>(type->getQualifier(),
-                                                           static_cast<unsigned char>(size));
-        default:
-            return type;
-    }
-}
-
-constexpr const TType *VectorType(const TType *type, int size)
-{
-    ASSERT(size >= 2 && size <= 4);
-
-    if (!type)
-    {
-        return nullptr;
-    }
-
-    ASSERT(!IsGenType(type));
-
-    switch (type->getBasicType())
-    {
-        case EbtVec:
-            return StaticType::GetForVecMat<EbtFloat>(static_cast<unsigned char>(size));
-        case EbtIVec:
-            return StaticType::GetForVecMat<EbtInt>(static_cast<unsigned char>(size));
-        case EbtUVec:
-            return StaticType::GetForVecMat<EbtUInt>(static_cast<unsigned char>(size));
-        case EbtBVec:
-            return StaticType::GetForVecMat<EbtBool>(static_cast<unsigned char>(size));
-        default:
-            return type;
-    }
-}
-
 bool TSymbolTable::declareVariable(TVariable *variable)
 {
     ASSERT(variable->symbolType() == SymbolType::UserDefined);
@@ -471,220 +442,6 @@ bool TSymbolTable::insertConstIvec3(ESymbolLevel level,
     return insert(level, constantIvec3);
 }
 
-void TSymbolTable::insertBuiltIn(ESymbolLevel level,
-                                 TOperator op,
-                                 TExtension ext,
-                                 const TType *rvalue,
-                                 const char *name,
-                                 const TType *ptype1,
-                                 const TType *ptype2,
-                                 const TType *ptype3,
-                                 const TType *ptype4,
-                                 const TType *ptype5)
-{
-    if (ptype1->getBasicType() == EbtGSampler2D)
-    {
-        insertUnmangledBuiltIn(name, ext, level);
-        bool gvec4 = (rvalue->getBasicType() == EbtGVec4);
-        insertBuiltIn(level, gvec4 ? StaticType::GetBasic<EbtFloat, 4>() : rvalue, name,
-                      StaticType::GetBasic<EbtSampler2D>(), ptype2, ptype3, ptype4, ptype5);
-        insertBuiltIn(level, gvec4 ? StaticType::GetBasic<EbtInt, 4>() : rvalue, name,
-                      StaticType::GetBasic<EbtISampler2D>(), ptype2, ptype3, ptype4, ptype5);
-        insertBuiltIn(level, gvec4 ? StaticType::GetBasic<EbtUInt, 4>() : rvalue, name,
-                      StaticType::GetBasic<EbtUSampler2D>(), ptype2, ptype3, ptype4, ptype5);
-    }
-    else if (ptype1->getBasicType() == EbtGSampler3D)
-    {
-        insertUnmangledBuiltIn(name, ext, level);
-        bool gvec4 = (rvalue->getBasicType() == EbtGVec4);
-        insertBuiltIn(level, gvec4 ? StaticType::GetBasic<EbtFloat, 4>() : rvalue, name,
-                      StaticType::GetBasic<EbtSampler3D>(), ptype2, ptype3, ptype4, ptype5);
-        insertBuiltIn(level, gvec4 ? StaticType::GetBasic<EbtInt, 4>() : rvalue, name,
-                      StaticType::GetBasic<EbtISampler3D>(), ptype2, ptype3, ptype4, ptype5);
-        insertBuiltIn(level, gvec4 ? StaticType::GetBasic<EbtUInt, 4>() : rvalue, name,
-                      StaticType::GetBasic<EbtUSampler3D>(), ptype2, ptype3, ptype4, ptype5);
-    }
-    else if (ptype1->getBasicType() == EbtGSamplerCube)
-    {
-        insertUnmangledBuiltIn(name, ext, level);
-        bool gvec4 = (rvalue->getBasicType() == EbtGVec4);
-        insertBuiltIn(level, gvec4 ? StaticType::GetBasic<EbtFloat, 4>() : rvalue, name,
-                      StaticType::GetBasic<EbtSamplerCube>(), ptype2, ptype3, ptype4, ptype5);
-        insertBuiltIn(level, gvec4 ? StaticType::GetBasic<EbtInt, 4>() : rvalue, name,
-                      StaticType::GetBasic<EbtISamplerCube>(), ptype2, ptype3, ptype4, ptype5);
-        insertBuiltIn(level, gvec4 ? StaticType::GetBasic<EbtUInt, 4>() : rvalue, name,
-                      StaticType::GetBasic<EbtUSamplerCube>(), ptype2, ptype3, ptype4, ptype5);
-    }
-    else if (ptype1->getBasicType() == EbtGSampler2DArray)
-    {
-        insertUnmangledBuiltIn(name, ext, level);
-        bool gvec4 = (rvalue->getBasicType() == EbtGVec4);
-        insertBuiltIn(level, gvec4 ? StaticType::GetBasic<EbtFloat, 4>() : rvalue, name,
-                      StaticType::GetBasic<EbtSampler2DArray>(), ptype2, ptype3, ptype4,
-                      ptype5);
-        insertBuiltIn(level, gvec4 ? StaticType::GetBasic<EbtInt, 4>() : rvalue, name,
-                      StaticType::GetBasic<EbtISampler2DArray>(), ptype2, ptype3, ptype4,
-                      ptype5);
-        insertBuiltIn(level, gvec4 ? StaticType::GetBasic<EbtUInt, 4>() : rvalue, name,
-                      StaticType::GetBasic<EbtUSampler2DArray>(), ptype2, ptype3, ptype4,
-                      ptype5);
-    }
-    else if (ptype1->getBasicType() == EbtGSampler2DMS)
-    {
-        insertUnmangledBuiltIn(name, ext, level);
-        bool gvec4 = (rvalue->getBasicType() == EbtGVec4);
-        insertBuiltIn(level, gvec4 ? StaticType::GetBasic<EbtFloat, 4>() : rvalue, name,
-                      StaticType::GetBasic<EbtSampler2DMS>(), ptype2, ptype3, ptype4, ptype5);
-        insertBuiltIn(level, gvec4 ? StaticType::GetBasic<EbtInt, 4>() : rvalue, name,
-                      StaticType::GetBasic<EbtISampler2DMS>(), ptype2, ptype3, ptype4, ptype5);
-        insertBuiltIn(level, gvec4 ? StaticType::GetBasic<EbtUInt, 4>() : rvalue, name,
-                      StaticType::GetBasic<EbtUSampler2DMS>(), ptype2, ptype3, ptype4, ptype5);
-    }
-    else if (IsGImage(ptype1->getBasicType()))
-    {
-        insertUnmangledBuiltIn(name, ext, level);
-
-        const TType *floatType    = StaticType::GetBasic<EbtFloat, 4>();
-        const TType *intType      = StaticType::GetBasic<EbtInt, 4>();
-        const TType *unsignedType = StaticType::GetBasic<EbtUInt, 4>();
-
-        const TType *floatImage    = StaticType::GetForFloatImage(ptype1->getBasicType());
-        const TType *intImage      = StaticType::GetForIntImage(ptype1->getBasicType());
-        const TType *unsignedImage = StaticType::GetForUintImage(ptype1->getBasicType());
-
-        // GLSL ES 3.10, Revision 4, 8.12 Image Functions
-        if (rvalue->getBasicType() == EbtGVec4)
-        {
-            // imageLoad
-            insertBuiltIn(level, floatType, name, floatImage, ptype2, ptype3, ptype4, ptype5);
-            insertBuiltIn(level, intType, name, intImage, ptype2, ptype3, ptype4, ptype5);
-            insertBuiltIn(level, unsignedType, name, unsignedImage, ptype2, ptype3, ptype4, ptype5);
-        }
-        else if (rvalue->getBasicType() == EbtVoid)
-        {
-            // imageStore
-            insertBuiltIn(level, rvalue, name, floatImage, ptype2, floatType, ptype4, ptype5);
-            insertBuiltIn(level, rvalue, name, intImage, ptype2, intType, ptype4, ptype5);
-            insertBuiltIn(level, rvalue, name, unsignedImage, ptype2, unsignedType, ptype4, ptype5);
-        }
-        else
-        {
-            // imageSize
-            insertBuiltIn(level, rvalue, name, floatImage, ptype2, ptype3, ptype4, ptype5);
-            insertBuiltIn(level, rvalue, name, intImage, ptype2, ptype3, ptype4, ptype5);
-            insertBuiltIn(level, rvalue, name, unsignedImage, ptype2, ptype3, ptype4, ptype5);
-        }
-    }
-    else if (IsGenType(rvalue) || IsGenType(ptype1) || IsGenType(ptype2) || IsGenType(ptype3) ||
-             IsGenType(ptype4))
-    {
-        ASSERT(!ptype5);
-        insertUnmangledBuiltIn(name, ext, level);
-        insertBuiltIn(level, op, ext, SpecificType(rvalue, 1), name, SpecificType(ptype1, 1),
-                      SpecificType(ptype2, 1), SpecificType(ptype3, 1), SpecificType(ptype4, 1));
-        insertBuiltIn(level, op, ext, SpecificType(rvalue, 2), name, SpecificType(ptype1, 2),
-                      SpecificType(ptype2, 2), SpecificType(ptype3, 2), SpecificType(ptype4, 2));
-        insertBuiltIn(level, op, ext, SpecificType(rvalue, 3), name, SpecificType(ptype1, 3),
-                      SpecificType(ptype2, 3), SpecificType(ptype3, 3), SpecificType(ptype4, 3));
-        insertBuiltIn(level, op, ext, SpecificType(rvalue, 4), name, SpecificType(ptype1, 4),
-                      SpecificType(ptype2, 4), SpecificType(ptype3, 4), SpecificType(ptype4, 4));
-    }
-    else if (IsVecType(rvalue) || IsVecType(ptype1) || IsVecType(ptype2) || IsVecType(ptype3))
-    {
-        ASSERT(!ptype4 && !ptype5);
-        insertUnmangledBuiltIn(name, ext, level);
-        insertBuiltIn(level, op, ext, VectorType(rvalue, 2), name, VectorType(ptype1, 2),
-                      VectorType(ptype2, 2), VectorType(ptype3, 2));
-        insertBuiltIn(level, op, ext, VectorType(rvalue, 3), name, VectorType(ptype1, 3),
-                      VectorType(ptype2, 3), VectorType(ptype3, 3));
-        insertBuiltIn(level, op, ext, VectorType(rvalue, 4), name, VectorType(ptype1, 4),
-                      VectorType(ptype2, 4), VectorType(ptype3, 4));
-    }
-    else
-    {
-        size_t paramCount       = 1;
-        TConstParameter *params = new TConstParameter[5];
-        new (params) TConstParameter(ptype1);
-
-        if (ptype2)
-        {
-            new (params + 1) TConstParameter(ptype2);
-            paramCount = 2;
-        }
-        if (ptype3)
-        {
-            new (params + 2) TConstParameter(ptype3);
-            paramCount = 3;
-        }
-        if (ptype4)
-        {
-            new (params + 3) TConstParameter(ptype4);
-            paramCount = 4;
-        }
-        if (ptype5)
-        {
-            new (params + 4) TConstParameter(ptype5);
-            paramCount = 5;
-        }
-        TFunction *function =
-            new TFunction(this, ImmutableString(name), ext, params, paramCount, rvalue, op, false);
-
-        ASSERT(hasUnmangledBuiltInAtLevel(name, level));
-        insert(level, function);
-    }
-}
-
-void TSymbolTable::insertBuiltInOp(ESymbolLevel level,
-                                   TOperator op,
-                                   const TType *rvalue,
-                                   const TType *ptype1,
-                                   const TType *ptype2,
-                                   const TType *ptype3,
-                                   const TType *ptype4,
-                                   const TType *ptype5)
-{
-    const char *name = GetOperatorString(op);
-    ASSERT(strlen(name) > 0);
-    insertUnmangledBuiltIn(name, TExtension::UNDEFINED, level);
-    insertBuiltIn(level, op, TExtension::UNDEFINED, rvalue, name, ptype1, ptype2, ptype3, ptype4,
-                  ptype5);
-}
-
-void TSymbolTable::insertBuiltInOp(ESymbolLevel level,
-                                   TOperator op,
-                                   TExtension ext,
-                                   const TType *rvalue,
-                                   const TType *ptype1,
-                                   const TType *ptype2,
-                                   const TType *ptype3,
-                                   const TType *ptype4,
-                                   const TType *ptype5)
-{
-    const char *name = GetOperatorString(op);
-    insertUnmangledBuiltIn(name, ext, level);
-    insertBuiltIn(level, op, ext, rvalue, name, ptype1, ptype2, ptype3, ptype4, ptype5);
-}
-
-void TSymbolTable::insertBuiltInFunctionNoParameters(ESymbolLevel level,
-                                                     TOperator op,
-                                                     const TType *rvalue,
-                                                     const char *name)
-{
-    insertUnmangledBuiltIn(name, TExtension::UNDEFINED, level);
-    insert(level, new TFunction(this, ImmutableString(name), TExtension::UNDEFINED, nullptr, 0,
-                                rvalue, op, false));
-}
-
-void TSymbolTable::insertBuiltInFunctionNoParametersExt(ESymbolLevel level,
-                                                        TExtension ext,
-                                                        TOperator op,
-                                                        const TType *rvalue,
-                                                        const char *name)
-{
-    insertUnmangledBuiltIn(name, ext, level);
-    insert(level, new TFunction(this, ImmutableString(name), ext, nullptr, 0, rvalue, op, false));
-}
-
 void TSymbolTable::setDefaultPrecision(TBasicType type, TPrecision prec)
 {
     int indexOfLastElement = static_cast<int>(mPrecisionStack.size()) - 1;
@@ -735,42 +492,18 @@ void TSymbolTable::setGlobalInvariant(bool invariant)
     mTable.back()->setGlobalInvariant(invariant);
 }
 
-void TSymbolTable::insertUnmangledBuiltIn(const char *name, TExtension ext, ESymbolLevel level)
-{
-    ASSERT(level >= 0 && level <= LAST_BUILTIN_LEVEL);
-    ASSERT(mUserDefinedUniqueIdsStart == -1);
-    mBuiltInTable[level]->insertUnmangledBuiltIn(name, ext);
-}
-
-bool TSymbolTable::hasUnmangledBuiltInAtLevel(const char *name, ESymbolLevel level)
-{
-    ASSERT(level >= 0 && level <= LAST_BUILTIN_LEVEL);
-    return mBuiltInTable[level]->getUnmangledBuiltIn(ImmutableString(name)) != nullptr;
-}
-
 const UnmangledBuiltIn *TSymbolTable::getUnmangledBuiltInForShaderVersion(
     const ImmutableString &name,
     int shaderVersion)
 {
-    for (int level = LAST_BUILTIN_LEVEL; level >= 0; --level)
+    size_t builtInCount                   = 0u;
+    const UnmangledBuiltInEntry *builtIns = FindUnmangledBuiltIns(name, &builtInCount);
+    for (size_t i = 0u; i < builtInCount; ++i)
     {
-        if (level == ESSL3_1_BUILTINS && shaderVersion != 310)
-        {
-            --level;
-        }
-        if (level == ESSL3_BUILTINS && shaderVersion < 300)
-        {
-            --level;
-        }
-        if (level == ESSL1_BUILTINS && shaderVersion != 100)
-        {
-            --level;
-        }
-
-        const UnmangledBuiltIn *builtIn = mBuiltInTable[level]->getUnmangledBuiltIn(name);
-        if (builtIn != nullptr)
+        if ((builtIns[i].shaderTypes & mShaderTypeBit) != 0 &&
+            IsBuiltInLevelVisible(builtIns[i].level, shaderVersion, true))
         {
-            return builtIn;
+            return &builtIns[i].builtIn;
         }
     }
     return nullptr;
@@ -778,12 +511,12 @@ const UnmangledBuiltIn *TSymbolTable::getUnmangledBuiltInForShaderVersion(
 
 void TSymbolTable::markBuiltInInitializationFinished()
 {
-    mUserDefinedUniqueIdsStart = mUniqueIdCounter;
+    mUserDefinedUniqueIdsStart = mUniqueIdCounter.load();
 }
 
 void TSymbolTable::clearCompilationResults()
 {
-    mUniqueIdCounter = mUserDefinedUniqueIdsStart;
+    mUniqueIdCounter.store(mUserDefinedUniqueIdsStart);
 
     // User-defined scopes should have already been cleared when the compilation finished.
     ASSERT(mTable.size() == 0u);
@@ -791,15 +524,46 @@ void TSymbolTable::clearCompilationResults()
 
 int TSymbolTable::nextUniqueIdValue()
 {
-    ASSERT(mUniqueIdCounter < std::numeric_limits<int>::max());
+    ScopedUniqueIdRange *range = gCurrentUniqueIdRange;
+    if (range != nullptr && range->mSymbolTable == this && range->mNextId < range->mEndId)
+    {
+        return range->mNextId++;
+    }
+    ASSERT(mUniqueIdCounter.load() < std::numeric_limits<int>::max());
     return ++mUniqueIdCounter;
 }
 
+int TSymbolTable::reserveUniqueIds(int count)
+{
+    ASSERT(count > 0);
+    ASSERT(mUniqueIdCounter.load() <= std::numeric_limits<int>::max() - count);
+    return mUniqueIdCounter.fetch_add(count) + 1;
+}
+
+TSymbolTable::ScopedUniqueIdRange::ScopedUniqueIdRange(const TSymbolTable *symbolTable,
+                                                       int firstId,
+                                                       int count)
+    : mSymbolTable(symbolTable),
+      mNextId(firstId),
+      mEndId(firstId + count),
+      mPrevious(gCurrentUniqueIdRange)
+{
+    gCurrentUniqueIdRange = this;
+}
+
+TSymbolTable::ScopedUniqueIdRange::~ScopedUniqueIdRange()
+{
+    ASSERT(gCurrentUniqueIdRange == this);
+    gCurrentUniqueIdRange = mPrevious;
+}
+
 void TSymbolTable::initializeBuiltIns(sh::GLenum type,
                                       ShShaderSpec spec,
                                       const ShBuiltInResources &resources)
 {
     ASSERT(isEmpty());
+    mShaderTypeBit = GetBuiltInShaderTypeBit(type);
+
     pushBuiltInLevel();  // COMMON_BUILTINS
     pushBuiltInLevel();  // ESSL1_BUILTINS
     pushBuiltInLevel();  // ESSL3_BUILTINS
@@ -837,7 +601,6 @@ void TSymbolTable::initializeBuiltIns(sh::GLenum type,
 
     setDefaultPrecision(EbtAtomicCounter, EbpHigh);
 
-    initializeBuiltInFunctions(type);
     initializeBuiltInVariables(type, spec, resources);
     markBuiltInInitializationFinished();
 }
@@ -848,621 +611,6 @@ void TSymbolTable::initSamplerDefaultPrecision(TBasicType samplerType)
     setDefaultPrecision(samplerType, EbpLow);
 }
 
-void TSymbolTable::initializeBuiltInFunctions(sh::GLenum type)
-{
-    const TType *voidType = StaticType::GetBasic<EbtVoid>();
-    const TType *float1   = StaticType::GetBasic<EbtFloat>();
-    const TType *float2   = StaticType::GetBasic<EbtFloat, 2>();
-    const TType *float3   = StaticType::GetBasic<EbtFloat, 3>();
-    const TType *float4   = StaticType::GetBasic<EbtFloat, 4>();
-    const TType *int1     = StaticType::GetBasic<EbtInt>();
-    const TType *int2     = StaticType::GetBasic<EbtInt, 2>();
-    const TType *int3     = StaticType::GetBasic<EbtInt, 3>();
-    const TType *uint1    = StaticType::GetBasic<EbtUInt>();
-    const TType *bool1    = StaticType::GetBasic<EbtBool>();
-    const TType *genType  = StaticType::GetBasic<EbtGenType>();
-    const TType *genIType = StaticType::GetBasic<EbtGenIType>();
-    const TType *genUType = StaticType::GetBasic<EbtGenUType>();
-    const TType *genBType = StaticType::GetBasic<EbtGenBType>();
-
-    //
-    // Angle and Trigonometric Functions.
-    //
-    insertBuiltInOp(COMMON_BUILTINS, EOpRadians, genType, genType);
-    insertBuiltInOp(COMMON_BUILTINS, EOpDegrees, genType, genType);
-    insertBuiltInOp(COMMON_BUILTINS, EOpSin, genType, genType);
-    insertBuiltInOp(COMMON_BUILTINS, EOpCos, genType, genType);
-    insertBuiltInOp(COMMON_BUILTINS, EOpTan, genType, genType);
-    insertBuiltInOp(COMMON_BUILTINS, EOpAsin, genType, genType);
-    insertBuiltInOp(COMMON_BUILTINS, EOpAcos, genType, genType);
-    insertBuiltInOp(COMMON_BUILTINS, EOpAtan, genType, genType, genType);
-    insertBuiltInOp(COMMON_BUILTINS, EOpAtan, genType, genType);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpSinh, genType, genType);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpCosh, genType, genType);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpTanh, genType, genType);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpAsinh, genType, genType);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpAcosh, genType, genType);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpAtanh, genType, genType);
-
-    //
-    // Exponential Functions.
-    //
-    insertBuiltInOp(COMMON_BUILTINS, EOpPow, genType, genType, genType);
-    insertBuiltInOp(COMMON_BUILTINS, EOpExp, genType, genType);
-    insertBuiltInOp(COMMON_BUILTINS, EOpLog, genType, genType);
-    insertBuiltInOp(COMMON_BUILTINS, EOpExp2, genType, genType);
-    insertBuiltInOp(COMMON_BUILTINS, EOpLog2, genType, genType);
-    insertBuiltInOp(COMMON_BUILTINS, EOpSqrt, genType, genType);
-    insertBuiltInOp(COMMON_BUILTINS, EOpInversesqrt, genType, genType);
-
-    //
-    // Common Functions.
-    //
-    insertBuiltInOp(COMMON_BUILTINS, EOpAbs, genType, genType);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpAbs, genIType, genIType);
-    insertBuiltInOp(COMMON_BUILTINS, EOpSign, genType, genType);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpSign, genIType, genIType);
-    insertBuiltInOp(COMMON_BUILTINS, EOpFloor, genType, genType);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpTrunc, genType, genType);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpRound, genType, genType);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpRoundEven, genType, genType);
-    insertBuiltInOp(COMMON_BUILTINS, EOpCeil, genType, genType);
-    insertBuiltInOp(COMMON_BUILTINS, EOpFract, genType, genType);
-    insertBuiltInOp(COMMON_BUILTINS, EOpMod, genType, genType, float1);
-    insertBuiltInOp(COMMON_BUILTINS, EOpMod, genType, genType, genType);
-    insertBuiltInOp(COMMON_BUILTINS, EOpMin, genType, genType, float1);
-    insertBuiltInOp(COMMON_BUILTINS, EOpMin, genType, genType, genType);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpMin, genIType, genIType, genIType);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpMin, genIType, genIType, int1);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpMin, genUType, genUType, genUType);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpMin, genUType, genUType, uint1);
-    insertBuiltInOp(COMMON_BUILTINS, EOpMax, genType, genType, float1);
-    insertBuiltInOp(COMMON_BUILTINS, EOpMax, genType, genType, genType);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpMax, genIType, genIType, genIType);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpMax, genIType, genIType, int1);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpMax, genUType, genUType, genUType);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpMax, genUType, genUType, uint1);
-    insertBuiltInOp(COMMON_BUILTINS, EOpClamp, genType, genType, float1, float1);
-    insertBuiltInOp(COMMON_BUILTINS, EOpClamp, genType, genType, genType, genType);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpClamp, genIType, genIType, int1, int1);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpClamp, genIType, genIType, genIType, genIType);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpClamp, genUType, genUType, uint1, uint1);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpClamp, genUType, genUType, genUType, genUType);
-    insertBuiltInOp(COMMON_BUILTINS, EOpMix, genType, genType, genType, float1);
-    insertBuiltInOp(COMMON_BUILTINS, EOpMix, genType, genType, genType, genType);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpMix, genType, genType, genType, genBType);
-    insertBuiltInOp(COMMON_BUILTINS, EOpStep, genType, genType, genType);
-    insertBuiltInOp(COMMON_BUILTINS, EOpStep, genType, float1, genType);
-    insertBuiltInOp(COMMON_BUILTINS, EOpSmoothstep, genType, genType, genType, genType);
-    insertBuiltInOp(COMMON_BUILTINS, EOpSmoothstep, genType, float1, float1, genType);
-
-    const TType *outGenType  = StaticType::GetQualified<EbtGenType, EvqOut>();
-    const TType *outGenIType = StaticType::GetQualified<EbtGenIType, EvqOut>();
-
-    insertBuiltInOp(ESSL3_BUILTINS, EOpModf, genType, genType, outGenType);
-
-    insertBuiltInOp(ESSL3_BUILTINS, EOpIsnan, genBType, genType);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpIsinf, genBType, genType);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpFloatBitsToInt, genIType, genType);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpFloatBitsToUint, genUType, genType);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpIntBitsToFloat, genType, genIType);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpUintBitsToFloat, genType, genUType);
-
-    insertBuiltInOp(ESSL3_1_BUILTINS, EOpFrexp, genType, genType, outGenIType);
-    insertBuiltInOp(ESSL3_1_BUILTINS, EOpLdexp, genType, genType, genIType);
-
-    insertBuiltInOp(ESSL3_BUILTINS, EOpPackSnorm2x16, uint1, float2);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpPackUnorm2x16, uint1, float2);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpPackHalf2x16, uint1, float2);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpUnpackSnorm2x16, float2, uint1);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpUnpackUnorm2x16, float2, uint1);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpUnpackHalf2x16, float2, uint1);
-
-    insertBuiltInOp(ESSL3_1_BUILTINS, EOpPackUnorm4x8, uint1, float4);
-    insertBuiltInOp(ESSL3_1_BUILTINS, EOpPackSnorm4x8, uint1, float4);
-    insertBuiltInOp(ESSL3_1_BUILTINS, EOpUnpackUnorm4x8, float4, uint1);
-    insertBuiltInOp(ESSL3_1_BUILTINS, EOpUnpackSnorm4x8, float4, uint1);
-
-    //
-    // Geometric Functions.
-    //
-    insertBuiltInOp(COMMON_BUILTINS, EOpLength, float1, genType);
-    insertBuiltInOp(COMMON_BUILTINS, EOpDistance, float1, genType, genType);
-    insertBuiltInOp(COMMON_BUILTINS, EOpDot, float1, genType, genType);
-    insertBuiltInOp(COMMON_BUILTINS, EOpCross, float3, float3, float3);
-    insertBuiltInOp(COMMON_BUILTINS, EOpNormalize, genType, genType);
-    insertBuiltInOp(COMMON_BUILTINS, EOpFaceforward, genType, genType, genType, genType);
-    insertBuiltInOp(COMMON_BUILTINS, EOpReflect, genType, genType, genType);
-    insertBuiltInOp(COMMON_BUILTINS, EOpRefract, genType, genType, genType, float1);
-
-    const TType *mat2   = StaticType::GetBasic<EbtFloat, 2, 2>();
-    const TType *mat3   = StaticType::GetBasic<EbtFloat, 3, 3>();
-    const TType *mat4   = StaticType::GetBasic<EbtFloat, 4, 4>();
-    const TType *mat2x3 = StaticType::GetBasic<EbtFloat, 2, 3>();
-    const TType *mat3x2 = StaticType::GetBasic<EbtFloat, 3, 2>();
-    const TType *mat2x4 = StaticType::GetBasic<EbtFloat, 2, 4>();
-    const TType *mat4x2 = StaticType::GetBasic<EbtFloat, 4, 2>();
-    const TType *mat3x4 = StaticType::GetBasic<EbtFloat, 3, 4>();
-    const TType *mat4x3 = StaticType::GetBasic<EbtFloat, 4, 3>();
-
-    //
-    // Matrix Functions.
-    //
-    insertBuiltInOp(COMMON_BUILTINS, EOpMulMatrixComponentWise, mat2, mat2, mat2);
-    insertBuiltInOp(COMMON_BUILTINS, EOpMulMatrixComponentWise, mat3, mat3, mat3);
-    insertBuiltInOp(COMMON_BUILTINS, EOpMulMatrixComponentWise, mat4, mat4, mat4);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpMulMatrixComponentWise, mat2x3, mat2x3, mat2x3);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpMulMatrixComponentWise, mat3x2, mat3x2, mat3x2);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpMulMatrixComponentWise, mat2x4, mat2x4, mat2x4);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpMulMatrixComponentWise, mat4x2, mat4x2, mat4x2);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpMulMatrixComponentWise, mat3x4, mat3x4, mat3x4);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpMulMatrixComponentWise, mat4x3, mat4x3, mat4x3);
-
-    insertBuiltInOp(ESSL3_BUILTINS, EOpOuterProduct, mat2, float2, float2);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpOuterProduct, mat3, float3, float3);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpOuterProduct, mat4, float4, float4);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpOuterProduct, mat2x3, float3, float2);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpOuterProduct, mat3x2, float2, float3);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpOuterProduct, mat2x4, float4, float2);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpOuterProduct, mat4x2, float2, float4);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpOuterProduct, mat3x4, float4, float3);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpOuterProduct, mat4x3, float3, float4);
-
-    insertBuiltInOp(ESSL3_BUILTINS, EOpTranspose, mat2, mat2);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpTranspose, mat3, mat3);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpTranspose, mat4, mat4);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpTranspose, mat2x3, mat3x2);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpTranspose, mat3x2, mat2x3);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpTranspose, mat2x4, mat4x2);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpTranspose, mat4x2, mat2x4);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpTranspose, mat3x4, mat4x3);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpTranspose, mat4x3, mat3x4);
-
-    insertBuiltInOp(ESSL3_BUILTINS, EOpDeterminant, float1, mat2);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpDeterminant, float1, mat3);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpDeterminant, float1, mat4);
-
-    insertBuiltInOp(ESSL3_BUILTINS, EOpInverse, mat2, mat2);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpInverse, mat3, mat3);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpInverse, mat4, mat4);
-
-    const TType *vec  = StaticType::GetBasic<EbtVec>();
-    const TType *ivec = StaticType::GetBasic<EbtIVec>();
-    const TType *uvec = StaticType::GetBasic<EbtUVec>();
-    const TType *bvec = StaticType::GetBasic<EbtBVec>();
-
-    //
-    // Vector relational functions.
-    //
-    insertBuiltInOp(COMMON_BUILTINS, EOpLessThanComponentWise, bvec, vec, vec);
-    insertBuiltInOp(COMMON_BUILTINS, EOpLessThanComponentWise, bvec, ivec, ivec);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpLessThanComponentWise, bvec, uvec, uvec);
-    insertBuiltInOp(COMMON_BUILTINS, EOpLessThanEqualComponentWise, bvec, vec, vec);
-    insertBuiltInOp(COMMON_BUILTINS, EOpLessThanEqualComponentWise, bvec, ivec, ivec);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpLessThanEqualComponentWise, bvec, uvec, uvec);
-    insertBuiltInOp(COMMON_BUILTINS, EOpGreaterThanComponentWise, bvec, vec, vec);
-    insertBuiltInOp(COMMON_BUILTINS, EOpGreaterThanComponentWise, bvec, ivec, ivec);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpGreaterThanComponentWise, bvec, uvec, uvec);
-    insertBuiltInOp(COMMON_BUILTINS, EOpGreaterThanEqualComponentWise, bvec, vec, vec);
-    insertBuiltInOp(COMMON_BUILTINS, EOpGreaterThanEqualComponentWise, bvec, ivec, ivec);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpGreaterThanEqualComponentWise, bvec, uvec, uvec);
-    insertBuiltInOp(COMMON_BUILTINS, EOpEqualComponentWise, bvec, vec, vec);
-    insertBuiltInOp(COMMON_BUILTINS, EOpEqualComponentWise, bvec, ivec, ivec);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpEqualComponentWise, bvec, uvec, uvec);
-    insertBuiltInOp(COMMON_BUILTINS, EOpEqualComponentWise, bvec, bvec, bvec);
-    insertBuiltInOp(COMMON_BUILTINS, EOpNotEqualComponentWise, bvec, vec, vec);
-    insertBuiltInOp(COMMON_BUILTINS, EOpNotEqualComponentWise, bvec, ivec, ivec);
-    insertBuiltInOp(ESSL3_BUILTINS, EOpNotEqualComponentWise, bvec, uvec, uvec);
-    insertBuiltInOp(COMMON_BUILTINS, EOpNotEqualComponentWise, bvec, bvec, bvec);
-    insertBuiltInOp(COMMON_BUILTINS, EOpAny, bool1, bvec);
-    insertBuiltInOp(COMMON_BUILTINS, EOpAll, bool1, bvec);
-    insertBuiltInOp(COMMON_BUILTINS, EOpLogicalNotComponentWise, bvec, bvec);
-
-    //
-    // Integer functions
-    //
-    const TType *outGenUType = StaticType::GetQualified<EbtGenUType, EvqOut>();
-
-    insertBuiltInOp(ESSL3_1_BUILTINS, EOpBitfieldExtract, genIType, genIType, int1, int1);
-    insertBuiltInOp(ESSL3_1_BUILTINS, EOpBitfieldExtract, genUType, genUType, int1, int1);
-    insertBuiltInOp(ESSL3_1_BUILTINS, EOpBitfieldInsert, genIType, genIType, genIType, int1, int1);
-    insertBuiltInOp(ESSL3_1_BUILTINS, EOpBitfieldInsert, genUType, genUType, genUType, int1, int1);
-    insertBuiltInOp(ESSL3_1_BUILTINS, EOpBitfieldReverse, genIType, genIType);
-    insertBuiltInOp(ESSL3_1_BUILTINS, EOpBitfieldReverse, genUType, genUType);
-    insertBuiltInOp(ESSL3_1_BUILTINS, EOpBitCount, genIType, genIType);
-    insertBuiltInOp(ESSL3_1_BUILTINS, EOpBitCount, genIType, genUType);
-    insertBuiltInOp(ESSL3_1_BUILTINS, EOpFindLSB, genIType, genIType);
-    insertBuiltInOp(ESSL3_1_BUILTINS, EOpFindLSB, genIType, genUType);
-    insertBuiltInOp(ESSL3_1_BUILTINS, EOpFindMSB, genIType, genIType);
-    insertBuiltInOp(ESSL3_1_BUILTINS, EOpFindMSB, genIType, genUType);
-    insertBuiltInOp(ESSL3_1_BUILTINS, EOpUaddCarry, genUType, genUType, genUType, outGenUType);
-    insertBuiltInOp(ESSL3_1_BUILTINS, EOpUsubBorrow, genUType, genUType, genUType, outGenUType);
-    insertBuiltInOp(ESSL3_1_BUILTINS, EOpUmulExtended, voidType, genUType, genUType, outGenUType,
-                    outGenUType);
-    insertBuiltInOp(ESSL3_1_BUILTINS, EOpImulExtended, voidType, genIType, genIType, outGenIType,
-                    outGenIType);
-
-    const TType *sampler2D   = StaticType::GetBasic<EbtSampler2D>();
-    const TType *samplerCube = StaticType::GetBasic<EbtSamplerCube>();
-    const TType *samplerExternalOES = StaticType::GetBasic<EbtSamplerExternalOES>();
-
-    //
-    // Texture Functions for GLSL ES 1.0
-    //
-    insertBuiltIn(ESSL1_BUILTINS, float4, "texture2D", sampler2D, float2);
-    insertBuiltIn(ESSL1_BUILTINS, float4, "texture2DProj", sampler2D, float3);
-    insertBuiltIn(ESSL1_BUILTINS, float4, "texture2DProj", sampler2D, float4);
-    insertBuiltIn(ESSL1_BUILTINS, float4, "textureCube", samplerCube, float3);
-
-    // These are extension functions from OES_EGL_image_external and
-    // NV_EGL_stream_consumer_external. We don't have a way to mark a built-in with two alternative
-    // extensions, so these are marked with none. This is fine, since these functions overload core
-    // function names and the functions require a samplerExternalOES parameter, which can only be
-    // created if one of the extensions is enabled.
-    // TODO(oetuaho): Consider implementing a cleaner solution.
-    insertBuiltIn(ESSL1_BUILTINS, float4, "texture2D", samplerExternalOES, float2);
-    insertBuiltIn(ESSL1_BUILTINS, float4, "texture2DProj", samplerExternalOES, float3);
-    insertBuiltIn(ESSL1_BUILTINS, float4, "texture2DProj", samplerExternalOES, float4);
-
-    // Note that ARB_texture_rectangle extension directive defaults to enabled in case the extension
-    // is supported. The symbols are still conditional on the extension.
-    const TType *sampler2DRect = StaticType::GetBasic<EbtSampler2DRect>();
-    insertBuiltIn(ESSL1_BUILTINS, TExtension::ARB_texture_rectangle, float4, "texture2DRect",
-                  sampler2DRect, float2);
-    insertBuiltIn(ESSL1_BUILTINS, TExtension::ARB_texture_rectangle, float4, "texture2DRectProj",
-                  sampler2DRect, float3);
-    insertBuiltIn(ESSL1_BUILTINS, TExtension::ARB_texture_rectangle, float4, "texture2DRectProj",
-                  sampler2DRect, float4);
-
-    /* The *Grad* variants are new to both vertex and fragment shaders; the fragment
-     * shader specific pieces are added separately below.
-     */
-    insertBuiltIn(ESSL1_BUILTINS, TExtension::EXT_shader_texture_lod, float4, "texture2DGradEXT",
-                  sampler2D, float2, float2, float2);
-    insertBuiltIn(ESSL1_BUILTINS, TExtension::EXT_shader_texture_lod, float4,
-                  "texture2DProjGradEXT", sampler2D, float3, float2, float2);
-    insertBuiltIn(ESSL1_BUILTINS, TExtension::EXT_shader_texture_lod, float4,
-                  "texture2DProjGradEXT", sampler2D, float4, float2, float2);
-    insertBuiltIn(ESSL1_BUILTINS, TExtension::EXT_shader_texture_lod, float4, "textureCubeGradEXT",
-                  samplerCube, float3, float3, float3);
-
-    if (type == GL_FRAGMENT_SHADER)
-    {
-        insertBuiltIn(ESSL1_BUILTINS, float4, "texture2D", sampler2D, float2, float1);
-        insertBuiltIn(ESSL1_BUILTINS, float4, "texture2DProj", sampler2D, float3, float1);
-        insertBuiltIn(ESSL1_BUILTINS, float4, "texture2DProj", sampler2D, float4, float1);
-        insertBuiltIn(ESSL1_BUILTINS, float4, "textureCube", samplerCube, float3, float1);
-
-        insertBuiltInOp(ESSL1_BUILTINS, EOpDFdx, TExtension::OES_standard_derivatives, genType,
-                        genType);
-        insertBuiltInOp(ESSL1_BUILTINS, EOpDFdy, TExtension::OES_standard_derivatives, genType,
-                        genType);
-        insertBuiltInOp(ESSL1_BUILTINS, EOpFwidth, TExtension::OES_standard_derivatives, genType,
-                        genType);
-
-        insertBuiltIn(ESSL1_BUILTINS, TExtension::EXT_shader_texture_lod, float4, "texture2DLodEXT",
-                      sampler2D, float2, float1);
-        insertBuiltIn(ESSL1_BUILTINS, TExtension::EXT_shader_texture_lod, float4,
-                      "texture2DProjLodEXT", sampler2D, float3, float1);
-        insertBuiltIn(ESSL1_BUILTINS, TExtension::EXT_shader_texture_lod, float4,
-                      "texture2DProjLodEXT", sampler2D, float4, float1);
-        insertBuiltIn(ESSL1_BUILTINS, TExtension::EXT_shader_texture_lod, float4,
-                      "textureCubeLodEXT", samplerCube, float3, float1);
-    }
-
-    if (type == GL_VERTEX_SHADER)
-    {
-        insertBuiltIn(ESSL1_BUILTINS, float4, "texture2DLod", sampler2D, float2, float1);
-        insertBuiltIn(ESSL1_BUILTINS, float4, "texture2DProjLod", sampler2D, float3, float1);
-        insertBuiltIn(ESSL1_BUILTINS, float4, "texture2DProjLod", sampler2D, float4, float1);
-        insertBuiltIn(ESSL1_BUILTINS, float4, "textureCubeLod", samplerCube, float3, float1);
-    }
-
-    const TType *gvec4 = StaticType::GetBasic<EbtGVec4>();
-
-    const TType *gsampler2D      = StaticType::GetBasic<EbtGSampler2D>();
-    const TType *gsamplerCube    = StaticType::GetBasic<EbtGSamplerCube>();
-    const TType *gsampler3D      = StaticType::GetBasic<EbtGSampler3D>();
-    const TType *gsampler2DArray = StaticType::GetBasic<EbtGSampler2DArray>();
-    const TType *gsampler2DMS    = StaticType::GetBasic<EbtGSampler2DMS>();
-
-    //
-    // Texture Functions for GLSL ES 3.0
-    //
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "texture", gsampler2D, float2);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "texture", gsampler3D, float3);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "texture", gsamplerCube, float3);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "texture", gsampler2DArray, float3);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureProj", gsampler2D, float3);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureProj", gsampler2D, float4);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureProj", gsampler3D, float4);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureLod", gsampler2D, float2, float1);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureLod", gsampler3D, float3, float1);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureLod", gsamplerCube, float3, float1);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureLod", gsampler2DArray, float3, float1);
-
-    insertBuiltIn(ESSL3_BUILTINS, TExtension::OES_EGL_image_external_essl3, float4, "texture",
-                  samplerExternalOES, float2);
-    insertBuiltIn(ESSL3_BUILTINS, TExtension::OES_EGL_image_external_essl3, float4, "textureProj",
-                  samplerExternalOES, float3);
-    insertBuiltIn(ESSL3_BUILTINS, TExtension::OES_EGL_image_external_essl3, float4, "textureProj",
-                  samplerExternalOES, float4);
-
-    const TType *samplerExternal2DY2YEXT = StaticType::GetBasic<EbtSamplerExternal2DY2YEXT>();
-
-    insertBuiltIn(ESSL3_BUILTINS, TExtension::EXT_YUV_target, float4, "texture",
-                  samplerExternal2DY2YEXT, float2);
-    insertBuiltIn(ESSL3_BUILTINS, TExtension::EXT_YUV_target, float4, "textureProj",
-                  samplerExternal2DY2YEXT, float3);
-    insertBuiltIn(ESSL3_BUILTINS, TExtension::EXT_YUV_target, float4, "textureProj",
-                  samplerExternal2DY2YEXT, float4);
-
-    const TType *yuvCscStandardEXT = StaticType::GetBasic<EbtYuvCscStandardEXT>();
-
-    insertBuiltIn(ESSL3_BUILTINS, TExtension::EXT_YUV_target, float3, "rgb_2_yuv", float3,
-                  yuvCscStandardEXT);
-    insertBuiltIn(ESSL3_BUILTINS, TExtension::EXT_YUV_target, float3, "yuv_2_rgb", float3,
-                  yuvCscStandardEXT);
-
-    if (type == GL_FRAGMENT_SHADER)
-    {
-        insertBuiltIn(ESSL3_BUILTINS, gvec4, "texture", gsampler2D, float2, float1);
-        insertBuiltIn(ESSL3_BUILTINS, gvec4, "texture", gsampler3D, float3, float1);
-        insertBuiltIn(ESSL3_BUILTINS, gvec4, "texture", gsamplerCube, float3, float1);
-        insertBuiltIn(ESSL3_BUILTINS, gvec4, "texture", gsampler2DArray, float3, float1);
-        insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureProj", gsampler2D, float3, float1);
-        insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureProj", gsampler2D, float4, float1);
-        insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureProj", gsampler3D, float4, float1);
-
-        insertBuiltIn(ESSL3_BUILTINS, TExtension::OES_EGL_image_external_essl3, float4, "texture",
-                      samplerExternalOES, float2, float1);
-        insertBuiltIn(ESSL3_BUILTINS, TExtension::OES_EGL_image_external_essl3, float4,
-                      "textureProj", samplerExternalOES, float3, float1);
-        insertBuiltIn(ESSL3_BUILTINS, TExtension::OES_EGL_image_external_essl3, float4,
-                      "textureProj", samplerExternalOES, float4, float1);
-
-        insertBuiltIn(ESSL3_BUILTINS, TExtension::EXT_YUV_target, float4, "texture",
-                      samplerExternal2DY2YEXT, float2, float1);
-        insertBuiltIn(ESSL3_BUILTINS, TExtension::EXT_YUV_target, float4, "textureProj",
-                      samplerExternal2DY2YEXT, float3, float1);
-        insertBuiltIn(ESSL3_BUILTINS, TExtension::EXT_YUV_target, float4, "textureProj",
-                      samplerExternal2DY2YEXT, float4, float1);
-    }
-
-    const TType *sampler2DShadow      = StaticType::GetBasic<EbtSampler2DShadow>();
-    const TType *samplerCubeShadow    = StaticType::GetBasic<EbtSamplerCubeShadow>();
-    const TType *sampler2DArrayShadow = StaticType::GetBasic<EbtSampler2DArrayShadow>();
-
-    insertBuiltIn(ESSL3_BUILTINS, float1, "texture", sampler2DShadow, float3);
-    insertBuiltIn(ESSL3_BUILTINS, float1, "texture", samplerCubeShadow, float4);
-    insertBuiltIn(ESSL3_BUILTINS, float1, "texture", sampler2DArrayShadow, float4);
-    insertBuiltIn(ESSL3_BUILTINS, float1, "textureProj", sampler2DShadow, float4);
-    insertBuiltIn(ESSL3_BUILTINS, float1, "textureLod", sampler2DShadow, float3, float1);
-
-    if (type == GL_FRAGMENT_SHADER)
-    {
-        insertBuiltIn(ESSL3_BUILTINS, float1, "texture", sampler2DShadow, float3, float1);
-        insertBuiltIn(ESSL3_BUILTINS, float1, "texture", samplerCubeShadow, float4, float1);
-        insertBuiltIn(ESSL3_BUILTINS, float1, "textureProj", sampler2DShadow, float4, float1);
-    }
-
-    insertBuiltIn(ESSL3_BUILTINS, int2, "textureSize", gsampler2D, int1);
-    insertBuiltIn(ESSL3_BUILTINS, int3, "textureSize", gsampler3D, int1);
-    insertBuiltIn(ESSL3_BUILTINS, int2, "textureSize", gsamplerCube, int1);
-    insertBuiltIn(ESSL3_BUILTINS, int3, "textureSize", gsampler2DArray, int1);
-    insertBuiltIn(ESSL3_BUILTINS, int2, "textureSize", sampler2DShadow, int1);
-    insertBuiltIn(ESSL3_BUILTINS, int2, "textureSize", samplerCubeShadow, int1);
-    insertBuiltIn(ESSL3_BUILTINS, int3, "textureSize", sampler2DArrayShadow, int1);
-    insertBuiltIn(ESSL3_BUILTINS, int2, "textureSize", gsampler2DMS);
-
-    insertBuiltIn(ESSL3_BUILTINS, TExtension::OES_EGL_image_external_essl3, int2, "textureSize",
-                  samplerExternalOES, int1);
-
-    insertBuiltIn(ESSL3_BUILTINS, TExtension::EXT_YUV_target, int2, "textureSize",
-                  samplerExternal2DY2YEXT, int1);
-
-    if (type == GL_FRAGMENT_SHADER)
-    {
-        insertBuiltInOp(ESSL3_BUILTINS, EOpDFdx, genType, genType);
-        insertBuiltInOp(ESSL3_BUILTINS, EOpDFdy, genType, genType);
-        insertBuiltInOp(ESSL3_BUILTINS, EOpFwidth, genType, genType);
-    }
-
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureOffset", gsampler2D, float2, int2);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureOffset", gsampler3D, float3, int3);
-    insertBuiltIn(ESSL3_BUILTINS, float1, "textureOffset", sampler2DShadow, float3, int2);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureOffset", gsampler2DArray, float3, int2);
-
-    if (type == GL_FRAGMENT_SHADER)
-    {
-        insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureOffset", gsampler2D, float2, int2, float1);
-        insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureOffset", gsampler3D, float3, int3, float1);
-        insertBuiltIn(ESSL3_BUILTINS, float1, "textureOffset", sampler2DShadow, float3, int2,
-                      float1);
-        insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureOffset", gsampler2DArray, float3, int2,
-                      float1);
-    }
-
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureProjOffset", gsampler2D, float3, int2);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureProjOffset", gsampler2D, float4, int2);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureProjOffset", gsampler3D, float4, int3);
-    insertBuiltIn(ESSL3_BUILTINS, float1, "textureProjOffset", sampler2DShadow, float4, int2);
-
-    if (type == GL_FRAGMENT_SHADER)
-    {
-        insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureProjOffset", gsampler2D, float3, int2, float1);
-        insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureProjOffset", gsampler2D, float4, int2, float1);
-        insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureProjOffset", gsampler3D, float4, int3, float1);
-        insertBuiltIn(ESSL3_BUILTINS, float1, "textureProjOffset", sampler2DShadow, float4, int2,
-                      float1);
-    }
-
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureLodOffset", gsampler2D, float2, float1, int2);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureLodOffset", gsampler3D, float3, float1, int3);
-    insertBuiltIn(ESSL3_BUILTINS, float1, "textureLodOffset", sampler2DShadow, float3, float1,
-                  int2);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureLodOffset", gsampler2DArray, float3, float1, int2);
-
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureProjLod", gsampler2D, float3, float1);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureProjLod", gsampler2D, float4, float1);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureProjLod", gsampler3D, float4, float1);
-    insertBuiltIn(ESSL3_BUILTINS, float1, "textureProjLod", sampler2DShadow, float4, float1);
-
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureProjLodOffset", gsampler2D, float3, float1, int2);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureProjLodOffset", gsampler2D, float4, float1, int2);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureProjLodOffset", gsampler3D, float4, float1, int3);
-    insertBuiltIn(ESSL3_BUILTINS, float1, "textureProjLodOffset", sampler2DShadow, float4, float1,
-                  int2);
-
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "texelFetch", gsampler2D, int2, int1);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "texelFetch", gsampler3D, int3, int1);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "texelFetch", gsampler2DArray, int3, int1);
-
-    insertBuiltIn(ESSL3_BUILTINS, TExtension::OES_EGL_image_external_essl3, float4, "texelFetch",
-                  samplerExternalOES, int2, int1);
-
-    insertBuiltIn(ESSL3_BUILTINS, TExtension::EXT_YUV_target, float4, "texelFetch",
-                  samplerExternal2DY2YEXT, int2, int1);
-
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "texelFetchOffset", gsampler2D, int2, int1, int2);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "texelFetchOffset", gsampler3D, int3, int1, int3);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "texelFetchOffset", gsampler2DArray, int3, int1, int2);
-
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureGrad", gsampler2D, float2, float2, float2);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureGrad", gsampler3D, float3, float3, float3);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureGrad", gsamplerCube, float3, float3, float3);
-    insertBuiltIn(ESSL3_BUILTINS, float1, "textureGrad", sampler2DShadow, float3, float2, float2);
-    insertBuiltIn(ESSL3_BUILTINS, float1, "textureGrad", samplerCubeShadow, float4, float3, float3);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureGrad", gsampler2DArray, float3, float2, float2);
-    insertBuiltIn(ESSL3_BUILTINS, float1, "textureGrad", sampler2DArrayShadow, float4, float2,
-                  float2);
-
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureGradOffset", gsampler2D, float2, float2, float2,
-                  int2);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureGradOffset", gsampler3D, float3, float3, float3,
-                  int3);
-    insertBuiltIn(ESSL3_BUILTINS, float1, "textureGradOffset", sampler2DShadow, float3, float2,
-                  float2, int2);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureGradOffset", gsampler2DArray, float3, float2,
-                  float2, int2);
-    insertBuiltIn(ESSL3_BUILTINS, float1, "textureGradOffset", sampler2DArrayShadow, float4, float2,
-                  float2, int2);
-
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureProjGrad", gsampler2D, float3, float2, float2);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureProjGrad", gsampler2D, float4, float2, float2);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureProjGrad", gsampler3D, float4, float3, float3);
-    insertBuiltIn(ESSL3_BUILTINS, float1, "textureProjGrad", sampler2DShadow, float4, float2,
-                  float2);
-
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureProjGradOffset", gsampler2D, float3, float2,
-                  float2, int2);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureProjGradOffset", gsampler2D, float4, float2,
-                  float2, int2);
-    insertBuiltIn(ESSL3_BUILTINS, gvec4, "textureProjGradOffset", gsampler3D, float4, float3,
-                  float3, int3);
-    insertBuiltIn(ESSL3_BUILTINS, float1, "textureProjGradOffset", sampler2DShadow, float4, float2,
-                  float2, int2);
-
-    const TType *atomicCounter = StaticType::GetBasic<EbtAtomicCounter>();
-    insertBuiltIn(ESSL3_1_BUILTINS, uint1, "atomicCounter", atomicCounter);
-    insertBuiltIn(ESSL3_1_BUILTINS, uint1, "atomicCounterIncrement", atomicCounter);
-    insertBuiltIn(ESSL3_1_BUILTINS, uint1, "atomicCounterDecrement", atomicCounter);
-
-    // Insert all atomic memory functions
-    const TType *int1InOut  = StaticType::GetQualified<EbtInt, EvqInOut>();
-    const TType *uint1InOut = StaticType::GetQualified<EbtUInt, EvqInOut>();
-    insertBuiltIn(ESSL3_1_BUILTINS, uint1, "atomicAdd", uint1InOut, uint1);
-    insertBuiltIn(ESSL3_1_BUILTINS, int1, "atomicAdd", int1InOut, int1);
-    insertBuiltIn(ESSL3_1_BUILTINS, uint1, "atomicMin", uint1InOut, uint1);
-    insertBuiltIn(ESSL3_1_BUILTINS, int1, "atomicMin", int1InOut, int1);
-    insertBuiltIn(ESSL3_1_BUILTINS, uint1, "atomicMax", uint1InOut, uint1);
-    insertBuiltIn(ESSL3_1_BUILTINS, int1, "atomicMax", int1InOut, int1);
-    insertBuiltIn(ESSL3_1_BUILTINS, uint1, "atomicAnd", uint1InOut, uint1);
-    insertBuiltIn(ESSL3_1_BUILTINS, int1, "atomicAnd", int1InOut, int1);
-    insertBuiltIn(ESSL3_1_BUILTINS, uint1, "atomicOr", uint1InOut, uint1);
-    insertBuiltIn(ESSL3_1_BUILTINS, int1, "atomicOr", int1InOut, int1);
-    insertBuiltIn(ESSL3_1_BUILTINS, uint1, "atomicXor", uint1InOut, uint1);
-    insertBuiltIn(ESSL3_1_BUILTINS, int1, "atomicXor", int1InOut, int1);
-    insertBuiltIn(ESSL3_1_BUILTINS, uint1, "atomicExchange", uint1InOut, uint1);
-    insertBuiltIn(ESSL3_1_BUILTINS, int1, "atomicExchange", int1InOut, int1);
-    insertBuiltIn(ESSL3_1_BUILTINS, uint1, "atomicCompSwap", uint1InOut, uint1, uint1);
-    insertBuiltIn(ESSL3_1_BUILTINS, int1, "atomicCompSwap", int1InOut, int1, int1);
-
-    const TType *gimage2D      = StaticType::GetBasic<EbtGImage2D>();
-    const TType *gimage3D      = StaticType::GetBasic<EbtGImage3D>();
-    const TType *gimage2DArray = StaticType::GetBasic<EbtGImage2DArray>();
-    const TType *gimageCube    = StaticType::GetBasic<EbtGImageCube>();
-
-    insertBuiltIn(ESSL3_1_BUILTINS, voidType, "imageStore", gimage2D, int2, gvec4);
-    insertBuiltIn(ESSL3_1_BUILTINS, voidType, "imageStore", gimage3D, int3, gvec4);
-    insertBuiltIn(ESSL3_1_BUILTINS, voidType, "imageStore", gimage2DArray, int3, gvec4);
-    insertBuiltIn(ESSL3_1_BUILTINS, voidType, "imageStore", gimageCube, int3, gvec4);
-
-    insertBuiltIn(ESSL3_1_BUILTINS, gvec4, "imageLoad", gimage2D, int2);
-    insertBuiltIn(ESSL3_1_BUILTINS, gvec4, "imageLoad", gimage3D, int3);
-    insertBuiltIn(ESSL3_1_BUILTINS, gvec4, "imageLoad", gimage2DArray, int3);
-    insertBuiltIn(ESSL3_1_BUILTINS, gvec4, "imageLoad", gimageCube, int3);
-
-    insertBuiltIn(ESSL3_1_BUILTINS, int2, "imageSize", gimage2D);
-    insertBuiltIn(ESSL3_1_BUILTINS, int3, "imageSize", gimage3D);
-    insertBuiltIn(ESSL3_1_BUILTINS, int3, "imageSize", gimage2DArray);
-    insertBuiltIn(ESSL3_1_BUILTINS, int2, "imageSize", gimageCube);
-
-    insertBuiltInFunctionNoParameters(ESSL3_1_BUILTINS, EOpMemoryBarrier, voidType,
-                                      "memoryBarrier");
-    insertBuiltInFunctionNoParameters(ESSL3_1_BUILTINS, EOpMemoryBarrierAtomicCounter, voidType,
-                                      "memoryBarrierAtomicCounter");
-    insertBuiltInFunctionNoParameters(ESSL3_1_BUILTINS, EOpMemoryBarrierBuffer, voidType,
-                                      "memoryBarrierBuffer");
-    insertBuiltInFunctionNoParameters(ESSL3_1_BUILTINS, EOpMemoryBarrierImage, voidType,
-                                      "memoryBarrierImage");
-
-    insertBuiltIn(ESSL3_1_BUILTINS, gvec4, "texelFetch", gsampler2DMS, int2, int1);
-
-    // Insert all variations of textureGather.
-    insertBuiltIn(ESSL3_1_BUILTINS, gvec4, "textureGather", gsampler2D, float2);
-    insertBuiltIn(ESSL3_1_BUILTINS, gvec4, "textureGather", gsampler2D, float2, int1);
-    insertBuiltIn(ESSL3_1_BUILTINS, gvec4, "textureGather", gsampler2DArray, float3);
-    insertBuiltIn(ESSL3_1_BUILTINS, gvec4, "textureGather", gsampler2DArray, float3, int1);
-    insertBuiltIn(ESSL3_1_BUILTINS, gvec4, "textureGather", gsamplerCube, float3);
-    insertBuiltIn(ESSL3_1_BUILTINS, gvec4, "textureGather", gsamplerCube, float3, int1);
-    insertBuiltIn(ESSL3_1_BUILTINS, float4, "textureGather", sampler2DShadow, float2);
-    insertBuiltIn(ESSL3_1_BUILTINS, float4, "textureGather", sampler2DShadow, float2, float1);
-    insertBuiltIn(ESSL3_1_BUILTINS, float4, "textureGather", sampler2DArrayShadow, float3);
-    insertBuiltIn(ESSL3_1_BUILTINS, float4, "textureGather", sampler2DArrayShadow, float3, float1);
-    insertBuiltIn(ESSL3_1_BUILTINS, float4, "textureGather", samplerCubeShadow, float3);
-    insertBuiltIn(ESSL3_1_BUILTINS, float4, "textureGather", samplerCubeShadow, float3, float1);
-
-    // Insert all variations of textureGatherOffset.
-    insertBuiltIn(ESSL3_1_BUILTINS, gvec4, "textureGatherOffset", gsampler2D, float2, int2);
-    insertBuiltIn(ESSL3_1_BUILTINS, gvec4, "textureGatherOffset", gsampler2D, float2, int2, int1);
-    insertBuiltIn(ESSL3_1_BUILTINS, gvec4, "textureGatherOffset", gsampler2DArray, float3, int2);
-    insertBuiltIn(ESSL3_1_BUILTINS, gvec4, "textureGatherOffset", gsampler2DArray, float3, int2,
-                  int1);
-    insertBuiltIn(ESSL3_1_BUILTINS, float4, "textureGatherOffset", sampler2DShadow, float2, float1,
-                  int2);
-    insertBuiltIn(ESSL3_1_BUILTINS, float4, "textureGatherOffset", sampler2DArrayShadow, float3,
-                  float1, int2);
-
-    if (type == GL_COMPUTE_SHADER)
-    {
-        insertBuiltInFunctionNoParameters(ESSL3_1_BUILTINS, EOpBarrier, voidType, "barrier");
-        insertBuiltInFunctionNoParameters(ESSL3_1_BUILTINS, EOpMemoryBarrierShared, voidType,
-                                          "memoryBarrierShared");
-        insertBuiltInFunctionNoParameters(ESSL3_1_BUILTINS, EOpGroupMemoryBarrier, voidType,
-                                          "groupMemoryBarrier");
-    }
-
-    if (type == GL_GEOMETRY_SHADER_EXT)
-    {
-        TExtension extension = TExtension::EXT_geometry_shader;
-        insertBuiltInFunctionNoParametersExt(ESSL3_1_BUILTINS, extension, EOpEmitVertex, voidType,
-                                             "EmitVertex");
-        insertBuiltInFunctionNoParametersExt(ESSL3_1_BUILTINS, extension, EOpEndPrimitive, voidType,
-                                             "EndPrimitive");
-    }
-}
-
 void TSymbolTable::initializeBuiltInVariables(sh::GLenum type,
                                               ShShaderSpec spec,
                                               const ShBuiltInResources &resources)
@@ -31,6 +31,7 @@
 //
 
 #include <array>
+#include <atomic>
 #include <memory>
 
 #include "common/angleutils.h"
@@ -86,6 +87,17 @@ class TSymbolTable : angle::NonCopyable
     void push();
     void pop();
 
+    // The global level of a parsed shader, detached from the table so that the AST can be compiled
+    // again later without parsing it again.
+    class SavedGlobalScope;
+
+    // Detaches the global level, which must be the topmost level. Symbol ids assigned after this
+    // will start over from the same value when the scope is restored.
+    void saveGlobalScope(SavedGlobalScope *scope);
+    // Pushes a saved global level back onto the built-in levels. The scope stays owned by |scope|
+    // and needs to be saved again before the table is cleared.
+    void restoreGlobalScope(SavedGlobalScope *scope);
+
     // The declare* entry points are used when parsing and declare symbols at the current scope.
     // They return the created true in case the declaration was successful, and false if the
     // declaration failed due to redefinition.
@@ -133,6 +145,28 @@ class TSymbolTable : angle::NonCopyable
 
     const TSymbolUniqueId nextUniqueId() { return TSymbolUniqueId(this); }
 
+    // Reserves |count| consecutive unique ids and returns the first one.
+    int reserveUniqueIds(int count);
+
+    // While in scope, ids for symbols created on the current thread are taken from a range
+    // reserved with reserveUniqueIds(), so that AST transformations running on several threads at
+    // once give their symbols the same ids no matter how the threads are scheduled. Ids come from
+    // the shared counter again once the range runs out.
+    class ScopedUniqueIdRange : angle::NonCopyable
+    {
+      public:
+        ScopedUniqueIdRange(const TSymbolTable *symbolTable, int firstId, int count);
+        ~ScopedUniqueIdRange();
+
+      private:
+        friend class TSymbolTable;
+
+        const TSymbolTable *mSymbolTable;
+        int mNextId;
+        int mEndId;
+        ScopedUniqueIdRange *mPrevious;
+    };
+
     // Gets the built-in accessible by a shader with the specified version, if any.
     const UnmangledBuiltIn *getUnmangledBuiltInForShaderVersion(const ImmutableString &name,
                                                                 int shaderVersion);
@@ -182,78 +216,6 @@ class TSymbolTable : angle::NonCopyable
                           const ImmutableString &name,
                           const std::array<int, 3> &values);
 
-    // Note that for inserted built-in functions the const char *name needs to remain valid for the
-    // lifetime of the SymbolTable. SymbolTable does not allocate a copy of it.
-    void insertBuiltIn(ESymbolLevel level,
-                       TOperator op,
-                       TExtension ext,
-                       const TType *rvalue,
-                       const char *name,
-                       const TType *ptype1,
-                       const TType *ptype2 = 0,
-                       const TType *ptype3 = 0,
-                       const TType *ptype4 = 0,
-                       const TType *ptype5 = 0);
-
-    void insertBuiltIn(ESymbolLevel level,
-                       const TType *rvalue,
-                       const char *name,
-                       const TType *ptype1,
-                       const TType *ptype2 = 0,
-                       const TType *ptype3 = 0,
-                       const TType *ptype4 = 0,
-                       const TType *ptype5 = 0)
-    {
-        insertUnmangledBuiltIn(name, TExtension::UNDEFINED, level);
-        insertBuiltIn(level, EOpCallBuiltInFunction, TExtension::UNDEFINED, rvalue, name, ptype1,
-                      ptype2, ptype3, ptype4, ptype5);
-    }
-
-    void insertBuiltIn(ESymbolLevel level,
-                       TExtension ext,
-                       const TType *rvalue,
-                       const char *name,
-                       const TType *ptype1,
-                       const TType *ptype2 = 0,
-                       const TType *ptype3 = 0,
-                       const TType *ptype4 = 0,
-                       const TType *ptype5 = 0)
-    {
-        insertUnmangledBuiltIn(name, ext, level);
-        insertBuiltIn(level, EOpCallBuiltInFunction, ext, rvalue, name, ptype1, ptype2, ptype3,
-                      ptype4, ptype5);
-    }
-
-    void insertBuiltInOp(ESymbolLevel level,
-                         TOperator op,
-                         const TType *rvalue,
-                         const TType *ptype1,
-                         const TType *ptype2 = 0,
-                         const TType *ptype3 = 0,
-                         const TType *ptype4 = 0,
-                         const TType *ptype5 = 0);
-
-    void insertBuiltInOp(ESymbolLevel level,
-                         TOperator op,
-                         TExtension ext,
-                         const TType *rvalue,
-                         const TType *ptype1,
-                         const TType *ptype2 = 0,
-                         const TType *ptype3 = 0,
-                         const TType *ptype4 = 0,
-                         const TType *ptype5 = 0);
-
-    void insertBuiltInFunctionNoParameters(ESymbolLevel level,
-                                           TOperator op,
-                                           const TType *rvalue,
-                                           const char *name);
-
-    void insertBuiltInFunctionNoParametersExt(ESymbolLevel level,
-                                              TExtension ext,
-                                              TOperator op,
-                                              const TType *rvalue,
-                                              const char *name);
-
     TVariable *insertVariable(ESymbolLevel level,
                               const ImmutableString &name,
                               const TType *type,
@@ -263,20 +225,19 @@ class TSymbolTable : angle::NonCopyable
 
     TFunction *findUserDefinedFunction(const ImmutableString &name) const;
 
-    // Used to insert unmangled functions to check redeclaration of built-ins in ESSL 3.00 and
-    // above.
-    void insertUnmangledBuiltIn(const char *name, TExtension ext, ESymbolLevel level);
-
-    bool hasUnmangledBuiltInAtLevel(const char *name, ESymbolLevel level);
+    static bool IsBuiltInLevelVisible(ESymbolLevel level,
+                                      int shaderVersion,
+                                      bool includeGLSLBuiltins);
 
     void initSamplerDefaultPrecision(TBasicType samplerType);
 
-    void initializeBuiltInFunctions(sh::GLenum type);
     void initializeBuiltInVariables(sh::GLenum type,
                                     ShShaderSpec spec,
                                     const ShBuiltInResources &resources);
     void markBuiltInInitializationFinished();
 
+    // Built-in functions are statically allocated in SymbolTable_autogen.cpp. Only built-in
+    // variables that depend on ShBuiltInResources are stored in the built-in levels.
     std::vector<std::unique_ptr<TSymbolTableBuiltInLevel>> mBuiltInTable;
     std::vector<std::unique_ptr<TSymbolTableLevel>> mTable;
 
@@ -285,14 +246,33 @@ class TSymbolTable : angle::NonCopyable
     typedef TMap<TBasicType, TPrecision> PrecisionStackLevel;
     std::vector<std::unique_ptr<PrecisionStackLevel>> mPrecisionStack;
 
-    int mUniqueIdCounter;
+    // Built-in functions available in the shader type the table was initialized for.
+    unsigned char mShaderTypeBit;
+
+    // Starts after the ids reserved for the statically allocated built-in functions. Atomic since
+    // several threads may create symbols at once, see ScopedUniqueIdRange.
+    std::atomic<int> mUniqueIdCounter;
 
     // -1 before built-in init has finished, one past the last built-in id afterwards.
-    // TODO(oetuaho): Make this a compile-time constant once the symbol table is initialized at
-    // compile time. http://anglebug.com/1432
     int mUserDefinedUniqueIdsStart;
 };
 
+class TSymbolTable::SavedGlobalScope : angle::NonCopyable
+{
+  public:
+    SavedGlobalScope();
+    ~SavedGlobalScope();
+
+    bool empty() const { return mLevel == nullptr; }
+
+  private:
+    friend class TSymbolTable;
+
+    std::unique_ptr<TSymbolTableLevel> mLevel;
+    std::unique_ptr<PrecisionStackLevel> mPrecisionLevel;
+    int mUniqueIdCounter;
+};
+
 }  // namespace sh
 
 #endif  // COMPILER_TRANSLATOR_SYMBOLTABLE_H_
@@ -0,0 +1,12096 @@
+// GENERATED FILE - DO NOT EDIT.
+// Generated by gen_builtin_symbols.py using data from builtin_function_declarations.txt.
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// SymbolTable_autogen.cpp:
+//   Statically allocated built-in function symbols and the perfect hash tables used to look them
+//   up. 851 functions, 839 mangled names, 146 unmangled names.
+
+#include "compiler/translator/SymbolTable_autogen.h"
+
+#include "compiler/translator/StaticType.h"
+#include "compiler/translator/Symbol.h"
+
+namespace sh
+{
+
+namespace
+{
+
+// FNV-1a over the characters of the name, starting from a seed specific to the hash table slot
+// computation. gen_builtin_symbols.py computes the same hash when building the tables.
+uint32_t HashBuiltInName(const ImmutableString &name, uint32_t seed)
+{
+    uint32_t hash = 2166136261u ^ seed;
+    for (size_t i = 0u; i < name.length(); ++i)
+    {
+        hash ^= static_cast<unsigned char>(name.data()[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+struct BuiltInHashSlot
+{
+    const char *name;
+    unsigned short firstEntry;
+    unsigned short entryCount;
+};
+
+// Hash and displace: the first hash selects a displacement that is used as the seed of the second
+// hash. The displacements are chosen by the generator so that no two names map to the same slot.
+template <size_t kDisplacementCount, size_t kSlotCount>
+const BuiltInHashSlot *FindSlot(const ImmutableString &name,
+                                const unsigned short (&displacements)[kDisplacementCount],
+                                const BuiltInHashSlot (&slots)[kSlotCount])
+{
+    static_assert((kSlotCount & (kSlotCount - 1)) == 0, "slot count must be a power of two");
+    uint32_t displacement = displacements[HashBuiltInName(name, 0u) % kDisplacementCount];
+    const BuiltInHashSlot &slot = slots[HashBuiltInName(name, displacement) & (kSlotCount - 1)];
+    if (slot.name == nullptr || name != slot.name)
+    {
+        return nullptr;
+    }
+    return &slot;
+}
+
+// Parameter lists shared between the built-in functions.
+constexpr const TConstParameter kParams_f[1] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_2f[1] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_3f[1] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_4f[1] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_f_f[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_2f_2f[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_3f_3f[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_4f_4f[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_i[1] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_2i[1] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_3i[1] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_4i[1] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_2f_f[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_3f_f[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_4f_f[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_i_i[2] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_2i_2i[2] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_3i_3i[2] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_4i_4i[2] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_2i_i[2] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_3i_i[2] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_4i_i[2] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_u_u[2] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_2u_2u[2] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_3u_3u[2] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_4u_4u[2] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_2u_u[2] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_3u_u[2] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_4u_u[2] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_f_f_f[3] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_2f_f_f[3] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_3f_f_f[3] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_4f_f_f[3] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_2f_2f_2f[3] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_3f_3f_3f[3] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_4f_4f_4f[3] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_i_i_i[3] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_2i_i_i[3] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_3i_i_i[3] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_4i_i_i[3] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_2i_2i_2i[3] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_3i_3i_3i[3] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_4i_4i_4i[3] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_u_u_u[3] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_2u_u_u[3] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_3u_u_u[3] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_4u_u_u[3] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_2u_2u_2u[3] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_3u_3u_3u[3] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_4u_4u_4u[3] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_2f_2f_f[3] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_3f_3f_f[3] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_4f_4f_f[3] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_f_f_b[3] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_2f_2f_2b[3] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_3f_3f_3b[3] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_4f_4f_4b[3] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_f_2f[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_f_3f[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_f_4f[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_f_f_2f[3] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_f_f_3f[3] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_f_f_4f[3] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_f_of[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqOut, 1, 1>()),
+};
+constexpr const TConstParameter kParams_2f_o2f[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqOut, 2, 1>()),
+};
+constexpr const TConstParameter kParams_3f_o3f[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqOut, 3, 1>()),
+};
+constexpr const TConstParameter kParams_4f_o4f[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqOut, 4, 1>()),
+};
+constexpr const TConstParameter kParams_u[1] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_2u[1] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_3u[1] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_4u[1] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_f_oi[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqOut, 1, 1>()),
+};
+constexpr const TConstParameter kParams_2f_o2i[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqOut, 2, 1>()),
+};
+constexpr const TConstParameter kParams_3f_o3i[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqOut, 3, 1>()),
+};
+constexpr const TConstParameter kParams_4f_o4i[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqOut, 4, 1>()),
+};
+constexpr const TConstParameter kParams_f_i[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_2f_2i[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_3f_3i[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_4f_4i[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_22f_22f[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 2>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 2>()),
+};
+constexpr const TConstParameter kParams_33f_33f[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 3>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 3>()),
+};
+constexpr const TConstParameter kParams_44f_44f[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 4>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 4>()),
+};
+constexpr const TConstParameter kParams_23f_23f[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 3>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 3>()),
+};
+constexpr const TConstParameter kParams_32f_32f[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 2>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 2>()),
+};
+constexpr const TConstParameter kParams_24f_24f[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 4>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 4>()),
+};
+constexpr const TConstParameter kParams_42f_42f[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 2>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 2>()),
+};
+constexpr const TConstParameter kParams_34f_34f[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 4>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 4>()),
+};
+constexpr const TConstParameter kParams_43f_43f[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 3>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 3>()),
+};
+constexpr const TConstParameter kParams_3f_2f[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_2f_3f[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_4f_2f[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_2f_4f[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_4f_3f[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_3f_4f[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_22f[1] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 2>()),
+};
+constexpr const TConstParameter kParams_33f[1] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 3>()),
+};
+constexpr const TConstParameter kParams_44f[1] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 4>()),
+};
+constexpr const TConstParameter kParams_32f[1] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 2>()),
+};
+constexpr const TConstParameter kParams_23f[1] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 3>()),
+};
+constexpr const TConstParameter kParams_42f[1] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 2>()),
+};
+constexpr const TConstParameter kParams_24f[1] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 4>()),
+};
+constexpr const TConstParameter kParams_43f[1] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 3>()),
+};
+constexpr const TConstParameter kParams_34f[1] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 4>()),
+};
+constexpr const TConstParameter kParams_2b_2b[2] = {
+    TConstParameter(StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_3b_3b[2] = {
+    TConstParameter(StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_4b_4b[2] = {
+    TConstParameter(StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_2b[1] = {
+    TConstParameter(StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_3b[1] = {
+    TConstParameter(StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_4b[1] = {
+    TConstParameter(StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_u_i_i[3] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_2u_i_i[3] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_3u_i_i[3] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_4u_i_i[3] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_i_i_i_i[4] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_2i_2i_i_i[4] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_3i_3i_i_i[4] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_4i_4i_i_i[4] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_u_u_i_i[4] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_2u_2u_i_i[4] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_3u_3u_i_i[4] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_4u_4u_i_i[4] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_u_u_ou[3] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqOut, 1, 1>()),
+};
+constexpr const TConstParameter kParams_2u_2u_o2u[3] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqOut, 2, 1>()),
+};
+constexpr const TConstParameter kParams_3u_3u_o3u[3] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqOut, 3, 1>()),
+};
+constexpr const TConstParameter kParams_4u_4u_o4u[3] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqOut, 4, 1>()),
+};
+constexpr const TConstParameter kParams_u_u_ou_ou[4] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqOut, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqOut, 1, 1>()),
+};
+constexpr const TConstParameter kParams_2u_2u_o2u_o2u[4] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqOut, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqOut, 2, 1>()),
+};
+constexpr const TConstParameter kParams_3u_3u_o3u_o3u[4] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqOut, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqOut, 3, 1>()),
+};
+constexpr const TConstParameter kParams_4u_4u_o4u_o4u[4] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqOut, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqOut, 4, 1>()),
+};
+constexpr const TConstParameter kParams_i_i_oi_oi[4] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqOut, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqOut, 1, 1>()),
+};
+constexpr const TConstParameter kParams_2i_2i_o2i_o2i[4] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqOut, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqOut, 2, 1>()),
+};
+constexpr const TConstParameter kParams_3i_3i_o3i_o3i[4] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqOut, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqOut, 3, 1>()),
+};
+constexpr const TConstParameter kParams_4i_4i_o4i_o4i[4] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqOut, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqOut, 4, 1>()),
+};
+constexpr const TConstParameter kParams_s2_2f[2] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_s2_3f[2] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_s2_4f[2] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_sC_3f[2] = {
+    TConstParameter(StaticType::Get<EbtSamplerCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_sX_2f[2] = {
+    TConstParameter(StaticType::Get<EbtSamplerExternalOES, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_sX_3f[2] = {
+    TConstParameter(StaticType::Get<EbtSamplerExternalOES, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_sX_4f[2] = {
+    TConstParameter(StaticType::Get<EbtSamplerExternalOES, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_sR_2f[2] = {
+    TConstParameter(StaticType::Get<EbtSampler2DRect, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_sR_3f[2] = {
+    TConstParameter(StaticType::Get<EbtSampler2DRect, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_sR_4f[2] = {
+    TConstParameter(StaticType::Get<EbtSampler2DRect, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_s2_2f_2f_2f[4] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_s2_3f_2f_2f[4] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_s2_4f_2f_2f[4] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_sC_3f_3f_3f[4] = {
+    TConstParameter(StaticType::Get<EbtSamplerCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_s2_2f_f[3] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_s2_3f_f[3] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_s2_4f_f[3] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_sC_3f_f[3] = {
+    TConstParameter(StaticType::Get<EbtSamplerCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_is2_2f[2] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_us2_2f[2] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_s3_3f[2] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_is3_3f[2] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_us3_3f[2] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_isC_3f[2] = {
+    TConstParameter(StaticType::Get<EbtISamplerCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_usC_3f[2] = {
+    TConstParameter(StaticType::Get<EbtUSamplerCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_sA_3f[2] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_isA_3f[2] = {
+    TConstParameter(StaticType::Get<EbtISampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_usA_3f[2] = {
+    TConstParameter(StaticType::Get<EbtUSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_is2_3f[2] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_us2_3f[2] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_is2_4f[2] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_us2_4f[2] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_s3_4f[2] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_is3_4f[2] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_us3_4f[2] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_is2_2f_f[3] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_us2_2f_f[3] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_s3_3f_f[3] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_is3_3f_f[3] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_us3_3f_f[3] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_isC_3f_f[3] = {
+    TConstParameter(StaticType::Get<EbtISamplerCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_usC_3f_f[3] = {
+    TConstParameter(StaticType::Get<EbtUSamplerCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_sA_3f_f[3] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_isA_3f_f[3] = {
+    TConstParameter(StaticType::Get<EbtISampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_usA_3f_f[3] = {
+    TConstParameter(StaticType::Get<EbtUSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_sY_2f[2] = {
+    TConstParameter(StaticType::Get<EbtSamplerExternal2DY2YEXT, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_sY_3f[2] = {
+    TConstParameter(StaticType::Get<EbtSamplerExternal2DY2YEXT, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_sY_4f[2] = {
+    TConstParameter(StaticType::Get<EbtSamplerExternal2DY2YEXT, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_3f_y[2] = {
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtYuvCscStandardEXT, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_is2_3f_f[3] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_us2_3f_f[3] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_is2_4f_f[3] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_us2_4f_f[3] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_s3_4f_f[3] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_is3_4f_f[3] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_us3_4f_f[3] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_sX_2f_f[3] = {
+    TConstParameter(StaticType::Get<EbtSamplerExternalOES, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_sX_3f_f[3] = {
+    TConstParameter(StaticType::Get<EbtSamplerExternalOES, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_sX_4f_f[3] = {
+    TConstParameter(StaticType::Get<EbtSamplerExternalOES, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_sY_2f_f[3] = {
+    TConstParameter(StaticType::Get<EbtSamplerExternal2DY2YEXT, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_sY_3f_f[3] = {
+    TConstParameter(StaticType::Get<EbtSamplerExternal2DY2YEXT, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_sY_4f_f[3] = {
+    TConstParameter(StaticType::Get<EbtSamplerExternal2DY2YEXT, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_s2s_3f[2] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_sCs_4f[2] = {
+    TConstParameter(StaticType::Get<EbtSamplerCubeShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_sAs_4f[2] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArrayShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_s2s_4f[2] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_s2s_3f_f[3] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_sCs_4f_f[3] = {
+    TConstParameter(StaticType::Get<EbtSamplerCubeShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_s2s_4f_f[3] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_s2_i[2] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_is2_i[2] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_us2_i[2] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_s3_i[2] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_is3_i[2] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_us3_i[2] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_sC_i[2] = {
+    TConstParameter(StaticType::Get<EbtSamplerCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_isC_i[2] = {
+    TConstParameter(StaticType::Get<EbtISamplerCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_usC_i[2] = {
+    TConstParameter(StaticType::Get<EbtUSamplerCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_sA_i[2] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_isA_i[2] = {
+    TConstParameter(StaticType::Get<EbtISampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_usA_i[2] = {
+    TConstParameter(StaticType::Get<EbtUSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_s2s_i[2] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_sCs_i[2] = {
+    TConstParameter(StaticType::Get<EbtSamplerCubeShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_sAs_i[2] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArrayShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_sM[1] = {
+    TConstParameter(StaticType::Get<EbtSampler2DMS, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_isM[1] = {
+    TConstParameter(StaticType::Get<EbtISampler2DMS, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_usM[1] = {
+    TConstParameter(StaticType::Get<EbtUSampler2DMS, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_sX_i[2] = {
+    TConstParameter(StaticType::Get<EbtSamplerExternalOES, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_sY_i[2] = {
+    TConstParameter(StaticType::Get<EbtSamplerExternal2DY2YEXT, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_s2_2f_2i[3] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_is2_2f_2i[3] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_us2_2f_2i[3] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_s3_3f_3i[3] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_is3_3f_3i[3] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_us3_3f_3i[3] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_s2s_3f_2i[3] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_sA_3f_2i[3] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_isA_3f_2i[3] = {
+    TConstParameter(StaticType::Get<EbtISampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_usA_3f_2i[3] = {
+    TConstParameter(StaticType::Get<EbtUSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_s2_2f_2i_f[4] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_is2_2f_2i_f[4] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_us2_2f_2i_f[4] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_s3_3f_3i_f[4] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_is3_3f_3i_f[4] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_us3_3f_3i_f[4] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_s2s_3f_2i_f[4] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_sA_3f_2i_f[4] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_isA_3f_2i_f[4] = {
+    TConstParameter(StaticType::Get<EbtISampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_usA_3f_2i_f[4] = {
+    TConstParameter(StaticType::Get<EbtUSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_s2_3f_2i[3] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_is2_3f_2i[3] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_us2_3f_2i[3] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_s2_4f_2i[3] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_is2_4f_2i[3] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_us2_4f_2i[3] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_s3_4f_3i[3] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_is3_4f_3i[3] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_us3_4f_3i[3] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_s2s_4f_2i[3] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_s2_3f_2i_f[4] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_is2_3f_2i_f[4] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_us2_3f_2i_f[4] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_s2_4f_2i_f[4] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_is2_4f_2i_f[4] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_us2_4f_2i_f[4] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_s3_4f_3i_f[4] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_is3_4f_3i_f[4] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_us3_4f_3i_f[4] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_s2s_4f_2i_f[4] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_s2_2f_f_2i[4] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_is2_2f_f_2i[4] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_us2_2f_f_2i[4] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_s3_3f_f_3i[4] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_is3_3f_f_3i[4] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_us3_3f_f_3i[4] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_s2s_3f_f_2i[4] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_sA_3f_f_2i[4] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_isA_3f_f_2i[4] = {
+    TConstParameter(StaticType::Get<EbtISampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_usA_3f_f_2i[4] = {
+    TConstParameter(StaticType::Get<EbtUSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_s2_3f_f_2i[4] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_is2_3f_f_2i[4] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_us2_3f_f_2i[4] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_s2_4f_f_2i[4] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_is2_4f_f_2i[4] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_us2_4f_f_2i[4] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_s3_4f_f_3i[4] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_is3_4f_f_3i[4] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_us3_4f_f_3i[4] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_s2s_4f_f_2i[4] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_s2_2i_i[3] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_is2_2i_i[3] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_us2_2i_i[3] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_s3_3i_i[3] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_is3_3i_i[3] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_us3_3i_i[3] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_sA_3i_i[3] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_isA_3i_i[3] = {
+    TConstParameter(StaticType::Get<EbtISampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_usA_3i_i[3] = {
+    TConstParameter(StaticType::Get<EbtUSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_sX_2i_i[3] = {
+    TConstParameter(StaticType::Get<EbtSamplerExternalOES, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_sY_2i_i[3] = {
+    TConstParameter(StaticType::Get<EbtSamplerExternal2DY2YEXT, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_s2_2i_i_2i[4] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_is2_2i_i_2i[4] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_us2_2i_i_2i[4] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_s3_3i_i_3i[4] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_is3_3i_i_3i[4] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_us3_3i_i_3i[4] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_sA_3i_i_2i[4] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_isA_3i_i_2i[4] = {
+    TConstParameter(StaticType::Get<EbtISampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_usA_3i_i_2i[4] = {
+    TConstParameter(StaticType::Get<EbtUSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_is2_2f_2f_2f[4] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_us2_2f_2f_2f[4] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_s3_3f_3f_3f[4] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_is3_3f_3f_3f[4] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_us3_3f_3f_3f[4] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_isC_3f_3f_3f[4] = {
+    TConstParameter(StaticType::Get<EbtISamplerCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_usC_3f_3f_3f[4] = {
+    TConstParameter(StaticType::Get<EbtUSamplerCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_s2s_3f_2f_2f[4] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_sCs_4f_3f_3f[4] = {
+    TConstParameter(StaticType::Get<EbtSamplerCubeShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_sA_3f_2f_2f[4] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_isA_3f_2f_2f[4] = {
+    TConstParameter(StaticType::Get<EbtISampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_usA_3f_2f_2f[4] = {
+    TConstParameter(StaticType::Get<EbtUSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_sAs_4f_2f_2f[4] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArrayShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_s2_2f_2f_2f_2i[5] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_is2_2f_2f_2f_2i[5] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_us2_2f_2f_2f_2i[5] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_s3_3f_3f_3f_3i[5] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_is3_3f_3f_3f_3i[5] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_us3_3f_3f_3f_3i[5] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_s2s_3f_2f_2f_2i[5] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_sA_3f_2f_2f_2i[5] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_isA_3f_2f_2f_2i[5] = {
+    TConstParameter(StaticType::Get<EbtISampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_usA_3f_2f_2f_2i[5] = {
+    TConstParameter(StaticType::Get<EbtUSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_sAs_4f_2f_2f_2i[5] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArrayShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_is2_3f_2f_2f[4] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_us2_3f_2f_2f[4] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_is2_4f_2f_2f[4] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_us2_4f_2f_2f[4] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_s3_4f_3f_3f[4] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_is3_4f_3f_3f[4] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_us3_4f_3f_3f[4] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_s2s_4f_2f_2f[4] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_s2_3f_2f_2f_2i[5] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_is2_3f_2f_2f_2i[5] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_us2_3f_2f_2f_2i[5] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_s2_4f_2f_2f_2i[5] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_is2_4f_2f_2f_2i[5] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_us2_4f_2f_2f_2i[5] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_s3_4f_3f_3f_3i[5] = {
+    TConstParameter(StaticType::Get<EbtSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_is3_4f_3f_3f_3i[5] = {
+    TConstParameter(StaticType::Get<EbtISampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_us3_4f_3f_3f_3i[5] = {
+    TConstParameter(StaticType::Get<EbtUSampler3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_s2s_4f_2f_2f_2i[5] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_a[1] = {
+    TConstParameter(StaticType::Get<EbtAtomicCounter, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_iou_u[2] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqInOut, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_ioi_i[2] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqInOut, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_iou_u_u[3] = {
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqInOut, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_ioi_i_i[3] = {
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqInOut, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_I2_2i_4f[3] = {
+    TConstParameter(StaticType::Get<EbtImage2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_iI2_2i_4i[3] = {
+    TConstParameter(StaticType::Get<EbtIImage2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_uI2_2i_4u[3] = {
+    TConstParameter(StaticType::Get<EbtUImage2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_I3_3i_4f[3] = {
+    TConstParameter(StaticType::Get<EbtImage3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_iI3_3i_4i[3] = {
+    TConstParameter(StaticType::Get<EbtIImage3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_uI3_3i_4u[3] = {
+    TConstParameter(StaticType::Get<EbtUImage3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_IA_3i_4f[3] = {
+    TConstParameter(StaticType::Get<EbtImage2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_iIA_3i_4i[3] = {
+    TConstParameter(StaticType::Get<EbtIImage2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_uIA_3i_4u[3] = {
+    TConstParameter(StaticType::Get<EbtUImage2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_Ic_3i_4f[3] = {
+    TConstParameter(StaticType::Get<EbtImageCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_iIc_3i_4i[3] = {
+    TConstParameter(StaticType::Get<EbtIImageCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_uIc_3i_4u[3] = {
+    TConstParameter(StaticType::Get<EbtUImageCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>()),
+};
+constexpr const TConstParameter kParams_I2_2i[2] = {
+    TConstParameter(StaticType::Get<EbtImage2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_iI2_2i[2] = {
+    TConstParameter(StaticType::Get<EbtIImage2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_uI2_2i[2] = {
+    TConstParameter(StaticType::Get<EbtUImage2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_I3_3i[2] = {
+    TConstParameter(StaticType::Get<EbtImage3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_iI3_3i[2] = {
+    TConstParameter(StaticType::Get<EbtIImage3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_uI3_3i[2] = {
+    TConstParameter(StaticType::Get<EbtUImage3D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_IA_3i[2] = {
+    TConstParameter(StaticType::Get<EbtImage2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_iIA_3i[2] = {
+    TConstParameter(StaticType::Get<EbtIImage2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_uIA_3i[2] = {
+    TConstParameter(StaticType::Get<EbtUImage2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_Ic_3i[2] = {
+    TConstParameter(StaticType::Get<EbtImageCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_iIc_3i[2] = {
+    TConstParameter(StaticType::Get<EbtIImageCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_uIc_3i[2] = {
+    TConstParameter(StaticType::Get<EbtUImageCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_I2[1] = {
+    TConstParameter(StaticType::Get<EbtImage2D, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_iI2[1] = {
+    TConstParameter(StaticType::Get<EbtIImage2D, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_uI2[1] = {
+    TConstParameter(StaticType::Get<EbtUImage2D, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_I3[1] = {
+    TConstParameter(StaticType::Get<EbtImage3D, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_iI3[1] = {
+    TConstParameter(StaticType::Get<EbtIImage3D, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_uI3[1] = {
+    TConstParameter(StaticType::Get<EbtUImage3D, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_IA[1] = {
+    TConstParameter(StaticType::Get<EbtImage2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_iIA[1] = {
+    TConstParameter(StaticType::Get<EbtIImage2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_uIA[1] = {
+    TConstParameter(StaticType::Get<EbtUImage2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_Ic[1] = {
+    TConstParameter(StaticType::Get<EbtImageCube, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_iIc[1] = {
+    TConstParameter(StaticType::Get<EbtIImageCube, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_uIc[1] = {
+    TConstParameter(StaticType::Get<EbtUImageCube, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_sM_2i_i[3] = {
+    TConstParameter(StaticType::Get<EbtSampler2DMS, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_isM_2i_i[3] = {
+    TConstParameter(StaticType::Get<EbtISampler2DMS, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_usM_2i_i[3] = {
+    TConstParameter(StaticType::Get<EbtUSampler2DMS, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_s2_2f_i[3] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_is2_2f_i[3] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_us2_2f_i[3] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_sA_3f_i[3] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_isA_3f_i[3] = {
+    TConstParameter(StaticType::Get<EbtISampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_usA_3f_i[3] = {
+    TConstParameter(StaticType::Get<EbtUSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_sC_3f_i[3] = {
+    TConstParameter(StaticType::Get<EbtSamplerCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_isC_3f_i[3] = {
+    TConstParameter(StaticType::Get<EbtISamplerCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_usC_3f_i[3] = {
+    TConstParameter(StaticType::Get<EbtUSamplerCube, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_s2s_2f[2] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_s2s_2f_f[3] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_sAs_3f[2] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArrayShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_sAs_3f_f[3] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArrayShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_sCs_3f[2] = {
+    TConstParameter(StaticType::Get<EbtSamplerCubeShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+};
+constexpr const TConstParameter kParams_sCs_3f_f[3] = {
+    TConstParameter(StaticType::Get<EbtSamplerCubeShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_s2_2f_2i_i[4] = {
+    TConstParameter(StaticType::Get<EbtSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_is2_2f_2i_i[4] = {
+    TConstParameter(StaticType::Get<EbtISampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_us2_2f_2i_i[4] = {
+    TConstParameter(StaticType::Get<EbtUSampler2D, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_sA_3f_2i_i[4] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_isA_3f_2i_i[4] = {
+    TConstParameter(StaticType::Get<EbtISampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_usA_3f_2i_i[4] = {
+    TConstParameter(StaticType::Get<EbtUSampler2DArray, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>()),
+};
+constexpr const TConstParameter kParams_s2s_2f_f_2i[4] = {
+    TConstParameter(StaticType::Get<EbtSampler2DShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+constexpr const TConstParameter kParams_sAs_3f_f_2i[4] = {
+    TConstParameter(StaticType::Get<EbtSampler2DArrayShadow, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>()),
+    TConstParameter(StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>()),
+    TConstParameter(StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>()),
+};
+
+// Built-in functions.
+constexpr const TFunction kFunction_radians_f(TSymbolUniqueId(1),
+                             ImmutableString("radians"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("radians(f;"),
+                             EOpRadians,
+                             false);
+constexpr const TFunction kFunction_radians_2f(TSymbolUniqueId(2),
+                             ImmutableString("radians"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("radians(2f;"),
+                             EOpRadians,
+                             false);
+constexpr const TFunction kFunction_radians_3f(TSymbolUniqueId(3),
+                             ImmutableString("radians"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("radians(3f;"),
+                             EOpRadians,
+                             false);
+constexpr const TFunction kFunction_radians_4f(TSymbolUniqueId(4),
+                             ImmutableString("radians"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("radians(4f;"),
+                             EOpRadians,
+                             false);
+constexpr const TFunction kFunction_degrees_f(TSymbolUniqueId(5),
+                             ImmutableString("degrees"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("degrees(f;"),
+                             EOpDegrees,
+                             false);
+constexpr const TFunction kFunction_degrees_2f(TSymbolUniqueId(6),
+                             ImmutableString("degrees"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("degrees(2f;"),
+                             EOpDegrees,
+                             false);
+constexpr const TFunction kFunction_degrees_3f(TSymbolUniqueId(7),
+                             ImmutableString("degrees"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("degrees(3f;"),
+                             EOpDegrees,
+                             false);
+constexpr const TFunction kFunction_degrees_4f(TSymbolUniqueId(8),
+                             ImmutableString("degrees"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("degrees(4f;"),
+                             EOpDegrees,
+                             false);
+constexpr const TFunction kFunction_sin_f(TSymbolUniqueId(9),
+                             ImmutableString("sin"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("sin(f;"),
+                             EOpSin,
+                             false);
+constexpr const TFunction kFunction_sin_2f(TSymbolUniqueId(10),
+                             ImmutableString("sin"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("sin(2f;"),
+                             EOpSin,
+                             false);
+constexpr const TFunction kFunction_sin_3f(TSymbolUniqueId(11),
+                             ImmutableString("sin"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("sin(3f;"),
+                             EOpSin,
+                             false);
+constexpr const TFunction kFunction_sin_4f(TSymbolUniqueId(12),
+                             ImmutableString("sin"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("sin(4f;"),
+                             EOpSin,
+                             false);
+constexpr const TFunction kFunction_cos_f(TSymbolUniqueId(13),
+                             ImmutableString("cos"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("cos(f;"),
+                             EOpCos,
+                             false);
+constexpr const TFunction kFunction_cos_2f(TSymbolUniqueId(14),
+                             ImmutableString("cos"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("cos(2f;"),
+                             EOpCos,
+                             false);
+constexpr const TFunction kFunction_cos_3f(TSymbolUniqueId(15),
+                             ImmutableString("cos"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("cos(3f;"),
+                             EOpCos,
+                             false);
+constexpr const TFunction kFunction_cos_4f(TSymbolUniqueId(16),
+                             ImmutableString("cos"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("cos(4f;"),
+                             EOpCos,
+                             false);
+constexpr const TFunction kFunction_tan_f(TSymbolUniqueId(17),
+                             ImmutableString("tan"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("tan(f;"),
+                             EOpTan,
+                             false);
+constexpr const TFunction kFunction_tan_2f(TSymbolUniqueId(18),
+                             ImmutableString("tan"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("tan(2f;"),
+                             EOpTan,
+                             false);
+constexpr const TFunction kFunction_tan_3f(TSymbolUniqueId(19),
+                             ImmutableString("tan"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("tan(3f;"),
+                             EOpTan,
+                             false);
+constexpr const TFunction kFunction_tan_4f(TSymbolUniqueId(20),
+                             ImmutableString("tan"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("tan(4f;"),
+                             EOpTan,
+                             false);
+constexpr const TFunction kFunction_asin_f(TSymbolUniqueId(21),
+                             ImmutableString("asin"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("asin(f;"),
+                             EOpAsin,
+                             false);
+constexpr const TFunction kFunction_asin_2f(TSymbolUniqueId(22),
+                             ImmutableString("asin"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("asin(2f;"),
+                             EOpAsin,
+                             false);
+constexpr const TFunction kFunction_asin_3f(TSymbolUniqueId(23),
+                             ImmutableString("asin"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("asin(3f;"),
+                             EOpAsin,
+                             false);
+constexpr const TFunction kFunction_asin_4f(TSymbolUniqueId(24),
+                             ImmutableString("asin"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("asin(4f;"),
+                             EOpAsin,
+                             false);
+constexpr const TFunction kFunction_acos_f(TSymbolUniqueId(25),
+                             ImmutableString("acos"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("acos(f;"),
+                             EOpAcos,
+                             false);
+constexpr const TFunction kFunction_acos_2f(TSymbolUniqueId(26),
+                             ImmutableString("acos"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("acos(2f;"),
+                             EOpAcos,
+                             false);
+constexpr const TFunction kFunction_acos_3f(TSymbolUniqueId(27),
+                             ImmutableString("acos"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("acos(3f;"),
+                             EOpAcos,
+                             false);
+constexpr const TFunction kFunction_acos_4f(TSymbolUniqueId(28),
+                             ImmutableString("acos"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("acos(4f;"),
+                             EOpAcos,
+                             false);
+constexpr const TFunction kFunction_atan_ff(TSymbolUniqueId(29),
+                             ImmutableString("atan"),
+                             TExtension::UNDEFINED,
+                             kParams_f_f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("atan(f;f;"),
+                             EOpAtan,
+                             false);
+constexpr const TFunction kFunction_atan_2f2f(TSymbolUniqueId(30),
+                             ImmutableString("atan"),
+                             TExtension::UNDEFINED,
+                             kParams_2f_2f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("atan(2f;2f;"),
+                             EOpAtan,
+                             false);
+constexpr const TFunction kFunction_atan_3f3f(TSymbolUniqueId(31),
+                             ImmutableString("atan"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_3f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("atan(3f;3f;"),
+                             EOpAtan,
+                             false);
+constexpr const TFunction kFunction_atan_4f4f(TSymbolUniqueId(32),
+                             ImmutableString("atan"),
+                             TExtension::UNDEFINED,
+                             kParams_4f_4f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("atan(4f;4f;"),
+                             EOpAtan,
+                             false);
+constexpr const TFunction kFunction_atan_f(TSymbolUniqueId(33),
+                             ImmutableString("atan"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("atan(f;"),
+                             EOpAtan,
+                             false);
+constexpr const TFunction kFunction_atan_2f(TSymbolUniqueId(34),
+                             ImmutableString("atan"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("atan(2f;"),
+                             EOpAtan,
+                             false);
+constexpr const TFunction kFunction_atan_3f(TSymbolUniqueId(35),
+                             ImmutableString("atan"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("atan(3f;"),
+                             EOpAtan,
+                             false);
+constexpr const TFunction kFunction_atan_4f(TSymbolUniqueId(36),
+                             ImmutableString("atan"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("atan(4f;"),
+                             EOpAtan,
+                             false);
+constexpr const TFunction kFunction_sinh_f(TSymbolUniqueId(37),
+                             ImmutableString("sinh"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("sinh(f;"),
+                             EOpSinh,
+                             false);
+constexpr const TFunction kFunction_sinh_2f(TSymbolUniqueId(38),
+                             ImmutableString("sinh"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("sinh(2f;"),
+                             EOpSinh,
+                             false);
+constexpr const TFunction kFunction_sinh_3f(TSymbolUniqueId(39),
+                             ImmutableString("sinh"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("sinh(3f;"),
+                             EOpSinh,
+                             false);
+constexpr const TFunction kFunction_sinh_4f(TSymbolUniqueId(40),
+                             ImmutableString("sinh"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("sinh(4f;"),
+                             EOpSinh,
+                             false);
+constexpr const TFunction kFunction_cosh_f(TSymbolUniqueId(41),
+                             ImmutableString("cosh"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("cosh(f;"),
+                             EOpCosh,
+                             false);
+constexpr const TFunction kFunction_cosh_2f(TSymbolUniqueId(42),
+                             ImmutableString("cosh"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("cosh(2f;"),
+                             EOpCosh,
+                             false);
+constexpr const TFunction kFunction_cosh_3f(TSymbolUniqueId(43),
+                             ImmutableString("cosh"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("cosh(3f;"),
+                             EOpCosh,
+                             false);
+constexpr const TFunction kFunction_cosh_4f(TSymbolUniqueId(44),
+                             ImmutableString("cosh"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("cosh(4f;"),
+                             EOpCosh,
+                             false);
+constexpr const TFunction kFunction_tanh_f(TSymbolUniqueId(45),
+                             ImmutableString("tanh"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("tanh(f;"),
+                             EOpTanh,
+                             false);
+constexpr const TFunction kFunction_tanh_2f(TSymbolUniqueId(46),
+                             ImmutableString("tanh"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("tanh(2f;"),
+                             EOpTanh,
+                             false);
+constexpr const TFunction kFunction_tanh_3f(TSymbolUniqueId(47),
+                             ImmutableString("tanh"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("tanh(3f;"),
+                             EOpTanh,
+                             false);
+constexpr const TFunction kFunction_tanh_4f(TSymbolUniqueId(48),
+                             ImmutableString("tanh"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("tanh(4f;"),
+                             EOpTanh,
+                             false);
+constexpr const TFunction kFunction_asinh_f(TSymbolUniqueId(49),
+                             ImmutableString("asinh"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("asinh(f;"),
+                             EOpAsinh,
+                             false);
+constexpr const TFunction kFunction_asinh_2f(TSymbolUniqueId(50),
+                             ImmutableString("asinh"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("asinh(2f;"),
+                             EOpAsinh,
+                             false);
+constexpr const TFunction kFunction_asinh_3f(TSymbolUniqueId(51),
+                             ImmutableString("asinh"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("asinh(3f;"),
+                             EOpAsinh,
+                             false);
+constexpr const TFunction kFunction_asinh_4f(TSymbolUniqueId(52),
+                             ImmutableString("asinh"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("asinh(4f;"),
+                             EOpAsinh,
+                             false);
+constexpr const TFunction kFunction_acosh_f(TSymbolUniqueId(53),
+                             ImmutableString("acosh"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("acosh(f;"),
+                             EOpAcosh,
+                             false);
+constexpr const TFunction kFunction_acosh_2f(TSymbolUniqueId(54),
+                             ImmutableString("acosh"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("acosh(2f;"),
+                             EOpAcosh,
+                             false);
+constexpr const TFunction kFunction_acosh_3f(TSymbolUniqueId(55),
+                             ImmutableString("acosh"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("acosh(3f;"),
+                             EOpAcosh,
+                             false);
+constexpr const TFunction kFunction_acosh_4f(TSymbolUniqueId(56),
+                             ImmutableString("acosh"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("acosh(4f;"),
+                             EOpAcosh,
+                             false);
+constexpr const TFunction kFunction_atanh_f(TSymbolUniqueId(57),
+                             ImmutableString("atanh"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("atanh(f;"),
+                             EOpAtanh,
+                             false);
+constexpr const TFunction kFunction_atanh_2f(TSymbolUniqueId(58),
+                             ImmutableString("atanh"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("atanh(2f;"),
+                             EOpAtanh,
+                             false);
+constexpr const TFunction kFunction_atanh_3f(TSymbolUniqueId(59),
+                             ImmutableString("atanh"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("atanh(3f;"),
+                             EOpAtanh,
+                             false);
+constexpr const TFunction kFunction_atanh_4f(TSymbolUniqueId(60),
+                             ImmutableString("atanh"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("atanh(4f;"),
+                             EOpAtanh,
+                             false);
+constexpr const TFunction kFunction_pow_ff(TSymbolUniqueId(61),
+                             ImmutableString("pow"),
+                             TExtension::UNDEFINED,
+                             kParams_f_f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("pow(f;f;"),
+                             EOpPow,
+                             false);
+constexpr const TFunction kFunction_pow_2f2f(TSymbolUniqueId(62),
+                             ImmutableString("pow"),
+                             TExtension::UNDEFINED,
+                             kParams_2f_2f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("pow(2f;2f;"),
+                             EOpPow,
+                             false);
+constexpr const TFunction kFunction_pow_3f3f(TSymbolUniqueId(63),
+                             ImmutableString("pow"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_3f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("pow(3f;3f;"),
+                             EOpPow,
+                             false);
+constexpr const TFunction kFunction_pow_4f4f(TSymbolUniqueId(64),
+                             ImmutableString("pow"),
+                             TExtension::UNDEFINED,
+                             kParams_4f_4f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("pow(4f;4f;"),
+                             EOpPow,
+                             false);
+constexpr const TFunction kFunction_exp_f(TSymbolUniqueId(65),
+                             ImmutableString("exp"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("exp(f;"),
+                             EOpExp,
+                             false);
+constexpr const TFunction kFunction_exp_2f(TSymbolUniqueId(66),
+                             ImmutableString("exp"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("exp(2f;"),
+                             EOpExp,
+                             false);
+constexpr const TFunction kFunction_exp_3f(TSymbolUniqueId(67),
+                             ImmutableString("exp"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("exp(3f;"),
+                             EOpExp,
+                             false);
+constexpr const TFunction kFunction_exp_4f(TSymbolUniqueId(68),
+                             ImmutableString("exp"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("exp(4f;"),
+                             EOpExp,
+                             false);
+constexpr const TFunction kFunction_log_f(TSymbolUniqueId(69),
+                             ImmutableString("log"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("log(f;"),
+                             EOpLog,
+                             false);
+constexpr const TFunction kFunction_log_2f(TSymbolUniqueId(70),
+                             ImmutableString("log"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("log(2f;"),
+                             EOpLog,
+                             false);
+constexpr const TFunction kFunction_log_3f(TSymbolUniqueId(71),
+                             ImmutableString("log"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("log(3f;"),
+                             EOpLog,
+                             false);
+constexpr const TFunction kFunction_log_4f(TSymbolUniqueId(72),
+                             ImmutableString("log"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("log(4f;"),
+                             EOpLog,
+                             false);
+constexpr const TFunction kFunction_exp2_f(TSymbolUniqueId(73),
+                             ImmutableString("exp2"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("exp2(f;"),
+                             EOpExp2,
+                             false);
+constexpr const TFunction kFunction_exp2_2f(TSymbolUniqueId(74),
+                             ImmutableString("exp2"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("exp2(2f;"),
+                             EOpExp2,
+                             false);
+constexpr const TFunction kFunction_exp2_3f(TSymbolUniqueId(75),
+                             ImmutableString("exp2"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("exp2(3f;"),
+                             EOpExp2,
+                             false);
+constexpr const TFunction kFunction_exp2_4f(TSymbolUniqueId(76),
+                             ImmutableString("exp2"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("exp2(4f;"),
+                             EOpExp2,
+                             false);
+constexpr const TFunction kFunction_log2_f(TSymbolUniqueId(77),
+                             ImmutableString("log2"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("log2(f;"),
+                             EOpLog2,
+                             false);
+constexpr const TFunction kFunction_log2_2f(TSymbolUniqueId(78),
+                             ImmutableString("log2"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("log2(2f;"),
+                             EOpLog2,
+                             false);
+constexpr const TFunction kFunction_log2_3f(TSymbolUniqueId(79),
+                             ImmutableString("log2"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("log2(3f;"),
+                             EOpLog2,
+                             false);
+constexpr const TFunction kFunction_log2_4f(TSymbolUniqueId(80),
+                             ImmutableString("log2"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("log2(4f;"),
+                             EOpLog2,
+                             false);
+constexpr const TFunction kFunction_sqrt_f(TSymbolUniqueId(81),
+                             ImmutableString("sqrt"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("sqrt(f;"),
+                             EOpSqrt,
+                             false);
+constexpr const TFunction kFunction_sqrt_2f(TSymbolUniqueId(82),
+                             ImmutableString("sqrt"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("sqrt(2f;"),
+                             EOpSqrt,
+                             false);
+constexpr const TFunction kFunction_sqrt_3f(TSymbolUniqueId(83),
+                             ImmutableString("sqrt"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("sqrt(3f;"),
+                             EOpSqrt,
+                             false);
+constexpr const TFunction kFunction_sqrt_4f(TSymbolUniqueId(84),
+                             ImmutableString("sqrt"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("sqrt(4f;"),
+                             EOpSqrt,
+                             false);
+constexpr const TFunction kFunction_inversesqrt_f(TSymbolUniqueId(85),
+                             ImmutableString("inversesqrt"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("inversesqrt(f;"),
+                             EOpInversesqrt,
+                             false);
+constexpr const TFunction kFunction_inversesqrt_2f(TSymbolUniqueId(86),
+                             ImmutableString("inversesqrt"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("inversesqrt(2f;"),
+                             EOpInversesqrt,
+                             false);
+constexpr const TFunction kFunction_inversesqrt_3f(TSymbolUniqueId(87),
+                             ImmutableString("inversesqrt"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("inversesqrt(3f;"),
+                             EOpInversesqrt,
+                             false);
+constexpr const TFunction kFunction_inversesqrt_4f(TSymbolUniqueId(88),
+                             ImmutableString("inversesqrt"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("inversesqrt(4f;"),
+                             EOpInversesqrt,
+                             false);
+constexpr const TFunction kFunction_abs_f(TSymbolUniqueId(89),
+                             ImmutableString("abs"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("abs(f;"),
+                             EOpAbs,
+                             false);
+constexpr const TFunction kFunction_abs_2f(TSymbolUniqueId(90),
+                             ImmutableString("abs"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("abs(2f;"),
+                             EOpAbs,
+                             false);
+constexpr const TFunction kFunction_abs_3f(TSymbolUniqueId(91),
+                             ImmutableString("abs"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("abs(3f;"),
+                             EOpAbs,
+                             false);
+constexpr const TFunction kFunction_abs_4f(TSymbolUniqueId(92),
+                             ImmutableString("abs"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("abs(4f;"),
+                             EOpAbs,
+                             false);
+constexpr const TFunction kFunction_abs_i(TSymbolUniqueId(93),
+                             ImmutableString("abs"),
+                             TExtension::UNDEFINED,
+                             kParams_i,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("abs(i;"),
+                             EOpAbs,
+                             false);
+constexpr const TFunction kFunction_abs_2i(TSymbolUniqueId(94),
+                             ImmutableString("abs"),
+                             TExtension::UNDEFINED,
+                             kParams_2i,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("abs(2i;"),
+                             EOpAbs,
+                             false);
+constexpr const TFunction kFunction_abs_3i(TSymbolUniqueId(95),
+                             ImmutableString("abs"),
+                             TExtension::UNDEFINED,
+                             kParams_3i,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("abs(3i;"),
+                             EOpAbs,
+                             false);
+constexpr const TFunction kFunction_abs_4i(TSymbolUniqueId(96),
+                             ImmutableString("abs"),
+                             TExtension::UNDEFINED,
+                             kParams_4i,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("abs(4i;"),
+                             EOpAbs,
+                             false);
+constexpr const TFunction kFunction_sign_f(TSymbolUniqueId(97),
+                             ImmutableString("sign"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("sign(f;"),
+                             EOpSign,
+                             false);
+constexpr const TFunction kFunction_sign_2f(TSymbolUniqueId(98),
+                             ImmutableString("sign"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("sign(2f;"),
+                             EOpSign,
+                             false);
+constexpr const TFunction kFunction_sign_3f(TSymbolUniqueId(99),
+                             ImmutableString("sign"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("sign(3f;"),
+                             EOpSign,
+                             false);
+constexpr const TFunction kFunction_sign_4f(TSymbolUniqueId(100),
+                             ImmutableString("sign"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("sign(4f;"),
+                             EOpSign,
+                             false);
+constexpr const TFunction kFunction_sign_i(TSymbolUniqueId(101),
+                             ImmutableString("sign"),
+                             TExtension::UNDEFINED,
+                             kParams_i,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("sign(i;"),
+                             EOpSign,
+                             false);
+constexpr const TFunction kFunction_sign_2i(TSymbolUniqueId(102),
+                             ImmutableString("sign"),
+                             TExtension::UNDEFINED,
+                             kParams_2i,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("sign(2i;"),
+                             EOpSign,
+                             false);
+constexpr const TFunction kFunction_sign_3i(TSymbolUniqueId(103),
+                             ImmutableString("sign"),
+                             TExtension::UNDEFINED,
+                             kParams_3i,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("sign(3i;"),
+                             EOpSign,
+                             false);
+constexpr const TFunction kFunction_sign_4i(TSymbolUniqueId(104),
+                             ImmutableString("sign"),
+                             TExtension::UNDEFINED,
+                             kParams_4i,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("sign(4i;"),
+                             EOpSign,
+                             false);
+constexpr const TFunction kFunction_floor_f(TSymbolUniqueId(105),
+                             ImmutableString("floor"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("floor(f;"),
+                             EOpFloor,
+                             false);
+constexpr const TFunction kFunction_floor_2f(TSymbolUniqueId(106),
+                             ImmutableString("floor"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("floor(2f;"),
+                             EOpFloor,
+                             false);
+constexpr const TFunction kFunction_floor_3f(TSymbolUniqueId(107),
+                             ImmutableString("floor"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("floor(3f;"),
+                             EOpFloor,
+                             false);
+constexpr const TFunction kFunction_floor_4f(TSymbolUniqueId(108),
+                             ImmutableString("floor"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("floor(4f;"),
+                             EOpFloor,
+                             false);
+constexpr const TFunction kFunction_trunc_f(TSymbolUniqueId(109),
+                             ImmutableString("trunc"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("trunc(f;"),
+                             EOpTrunc,
+                             false);
+constexpr const TFunction kFunction_trunc_2f(TSymbolUniqueId(110),
+                             ImmutableString("trunc"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("trunc(2f;"),
+                             EOpTrunc,
+                             false);
+constexpr const TFunction kFunction_trunc_3f(TSymbolUniqueId(111),
+                             ImmutableString("trunc"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("trunc(3f;"),
+                             EOpTrunc,
+                             false);
+constexpr const TFunction kFunction_trunc_4f(TSymbolUniqueId(112),
+                             ImmutableString("trunc"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("trunc(4f;"),
+                             EOpTrunc,
+                             false);
+constexpr const TFunction kFunction_round_f(TSymbolUniqueId(113),
+                             ImmutableString("round"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("round(f;"),
+                             EOpRound,
+                             false);
+constexpr const TFunction kFunction_round_2f(TSymbolUniqueId(114),
+                             ImmutableString("round"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("round(2f;"),
+                             EOpRound,
+                             false);
+constexpr const TFunction kFunction_round_3f(TSymbolUniqueId(115),
+                             ImmutableString("round"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("round(3f;"),
+                             EOpRound,
+                             false);
+constexpr const TFunction kFunction_round_4f(TSymbolUniqueId(116),
+                             ImmutableString("round"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("round(4f;"),
+                             EOpRound,
+                             false);
+constexpr const TFunction kFunction_roundEven_f(TSymbolUniqueId(117),
+                             ImmutableString("roundEven"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("roundEven(f;"),
+                             EOpRoundEven,
+                             false);
+constexpr const TFunction kFunction_roundEven_2f(TSymbolUniqueId(118),
+                             ImmutableString("roundEven"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("roundEven(2f;"),
+                             EOpRoundEven,
+                             false);
+constexpr const TFunction kFunction_roundEven_3f(TSymbolUniqueId(119),
+                             ImmutableString("roundEven"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("roundEven(3f;"),
+                             EOpRoundEven,
+                             false);
+constexpr const TFunction kFunction_roundEven_4f(TSymbolUniqueId(120),
+                             ImmutableString("roundEven"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("roundEven(4f;"),
+                             EOpRoundEven,
+                             false);
+constexpr const TFunction kFunction_ceil_f(TSymbolUniqueId(121),
+                             ImmutableString("ceil"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("ceil(f;"),
+                             EOpCeil,
+                             false);
+constexpr const TFunction kFunction_ceil_2f(TSymbolUniqueId(122),
+                             ImmutableString("ceil"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("ceil(2f;"),
+                             EOpCeil,
+                             false);
+constexpr const TFunction kFunction_ceil_3f(TSymbolUniqueId(123),
+                             ImmutableString("ceil"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("ceil(3f;"),
+                             EOpCeil,
+                             false);
+constexpr const TFunction kFunction_ceil_4f(TSymbolUniqueId(124),
+                             ImmutableString("ceil"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("ceil(4f;"),
+                             EOpCeil,
+                             false);
+constexpr const TFunction kFunction_fract_f(TSymbolUniqueId(125),
+                             ImmutableString("fract"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("fract(f;"),
+                             EOpFract,
+                             false);
+constexpr const TFunction kFunction_fract_2f(TSymbolUniqueId(126),
+                             ImmutableString("fract"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("fract(2f;"),
+                             EOpFract,
+                             false);
+constexpr const TFunction kFunction_fract_3f(TSymbolUniqueId(127),
+                             ImmutableString("fract"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("fract(3f;"),
+                             EOpFract,
+                             false);
+constexpr const TFunction kFunction_fract_4f(TSymbolUniqueId(128),
+                             ImmutableString("fract"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("fract(4f;"),
+                             EOpFract,
+                             false);
+constexpr const TFunction kFunction_mod_ff(TSymbolUniqueId(129),
+                             ImmutableString("mod"),
+                             TExtension::UNDEFINED,
+                             kParams_f_f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("mod(f;f;"),
+                             EOpMod,
+                             false);
+constexpr const TFunction kFunction_mod_2ff(TSymbolUniqueId(130),
+                             ImmutableString("mod"),
+                             TExtension::UNDEFINED,
+                             kParams_2f_f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("mod(2f;f;"),
+                             EOpMod,
+                             false);
+constexpr const TFunction kFunction_mod_3ff(TSymbolUniqueId(131),
+                             ImmutableString("mod"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("mod(3f;f;"),
+                             EOpMod,
+                             false);
+constexpr const TFunction kFunction_mod_4ff(TSymbolUniqueId(132),
+                             ImmutableString("mod"),
+                             TExtension::UNDEFINED,
+                             kParams_4f_f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("mod(4f;f;"),
+                             EOpMod,
+                             false);
+constexpr const TFunction kFunction_mod_2f2f(TSymbolUniqueId(133),
+                             ImmutableString("mod"),
+                             TExtension::UNDEFINED,
+                             kParams_2f_2f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("mod(2f;2f;"),
+                             EOpMod,
+                             false);
+constexpr const TFunction kFunction_mod_3f3f(TSymbolUniqueId(134),
+                             ImmutableString("mod"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_3f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("mod(3f;3f;"),
+                             EOpMod,
+                             false);
+constexpr const TFunction kFunction_mod_4f4f(TSymbolUniqueId(135),
+                             ImmutableString("mod"),
+                             TExtension::UNDEFINED,
+                             kParams_4f_4f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("mod(4f;4f;"),
+                             EOpMod,
+                             false);
+constexpr const TFunction kFunction_min_ff(TSymbolUniqueId(136),
+                             ImmutableString("min"),
+                             TExtension::UNDEFINED,
+                             kParams_f_f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("min(f;f;"),
+                             EOpMin,
+                             false);
+constexpr const TFunction kFunction_min_2ff(TSymbolUniqueId(137),
+                             ImmutableString("min"),
+                             TExtension::UNDEFINED,
+                             kParams_2f_f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("min(2f;f;"),
+                             EOpMin,
+                             false);
+constexpr const TFunction kFunction_min_3ff(TSymbolUniqueId(138),
+                             ImmutableString("min"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("min(3f;f;"),
+                             EOpMin,
+                             false);
+constexpr const TFunction kFunction_min_4ff(TSymbolUniqueId(139),
+                             ImmutableString("min"),
+                             TExtension::UNDEFINED,
+                             kParams_4f_f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("min(4f;f;"),
+                             EOpMin,
+                             false);
+constexpr const TFunction kFunction_min_2f2f(TSymbolUniqueId(140),
+                             ImmutableString("min"),
+                             TExtension::UNDEFINED,
+                             kParams_2f_2f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("min(2f;2f;"),
+                             EOpMin,
+                             false);
+constexpr const TFunction kFunction_min_3f3f(TSymbolUniqueId(141),
+                             ImmutableString("min"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_3f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("min(3f;3f;"),
+                             EOpMin,
+                             false);
+constexpr const TFunction kFunction_min_4f4f(TSymbolUniqueId(142),
+                             ImmutableString("min"),
+                             TExtension::UNDEFINED,
+                             kParams_4f_4f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("min(4f;4f;"),
+                             EOpMin,
+                             false);
+constexpr const TFunction kFunction_min_ii(TSymbolUniqueId(143),
+                             ImmutableString("min"),
+                             TExtension::UNDEFINED,
+                             kParams_i_i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("min(i;i;"),
+                             EOpMin,
+                             false);
+constexpr const TFunction kFunction_min_2i2i(TSymbolUniqueId(144),
+                             ImmutableString("min"),
+                             TExtension::UNDEFINED,
+                             kParams_2i_2i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("min(2i;2i;"),
+                             EOpMin,
+                             false);
+constexpr const TFunction kFunction_min_3i3i(TSymbolUniqueId(145),
+                             ImmutableString("min"),
+                             TExtension::UNDEFINED,
+                             kParams_3i_3i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("min(3i;3i;"),
+                             EOpMin,
+                             false);
+constexpr const TFunction kFunction_min_4i4i(TSymbolUniqueId(146),
+                             ImmutableString("min"),
+                             TExtension::UNDEFINED,
+                             kParams_4i_4i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("min(4i;4i;"),
+                             EOpMin,
+                             false);
+constexpr const TFunction kFunction_min_2ii(TSymbolUniqueId(147),
+                             ImmutableString("min"),
+                             TExtension::UNDEFINED,
+                             kParams_2i_i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("min(2i;i;"),
+                             EOpMin,
+                             false);
+constexpr const TFunction kFunction_min_3ii(TSymbolUniqueId(148),
+                             ImmutableString("min"),
+                             TExtension::UNDEFINED,
+                             kParams_3i_i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("min(3i;i;"),
+                             EOpMin,
+                             false);
+constexpr const TFunction kFunction_min_4ii(TSymbolUniqueId(149),
+                             ImmutableString("min"),
+                             TExtension::UNDEFINED,
+                             kParams_4i_i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("min(4i;i;"),
+                             EOpMin,
+                             false);
+constexpr const TFunction kFunction_min_uu(TSymbolUniqueId(150),
+                             ImmutableString("min"),
+                             TExtension::UNDEFINED,
+                             kParams_u_u,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("min(u;u;"),
+                             EOpMin,
+                             false);
+constexpr const TFunction kFunction_min_2u2u(TSymbolUniqueId(151),
+                             ImmutableString("min"),
+                             TExtension::UNDEFINED,
+                             kParams_2u_2u,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("min(2u;2u;"),
+                             EOpMin,
+                             false);
+constexpr const TFunction kFunction_min_3u3u(TSymbolUniqueId(152),
+                             ImmutableString("min"),
+                             TExtension::UNDEFINED,
+                             kParams_3u_3u,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("min(3u;3u;"),
+                             EOpMin,
+                             false);
+constexpr const TFunction kFunction_min_4u4u(TSymbolUniqueId(153),
+                             ImmutableString("min"),
+                             TExtension::UNDEFINED,
+                             kParams_4u_4u,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("min(4u;4u;"),
+                             EOpMin,
+                             false);
+constexpr const TFunction kFunction_min_2uu(TSymbolUniqueId(154),
+                             ImmutableString("min"),
+                             TExtension::UNDEFINED,
+                             kParams_2u_u,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("min(2u;u;"),
+                             EOpMin,
+                             false);
+constexpr const TFunction kFunction_min_3uu(TSymbolUniqueId(155),
+                             ImmutableString("min"),
+                             TExtension::UNDEFINED,
+                             kParams_3u_u,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("min(3u;u;"),
+                             EOpMin,
+                             false);
+constexpr const TFunction kFunction_min_4uu(TSymbolUniqueId(156),
+                             ImmutableString("min"),
+                             TExtension::UNDEFINED,
+                             kParams_4u_u,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("min(4u;u;"),
+                             EOpMin,
+                             false);
+constexpr const TFunction kFunction_max_ff(TSymbolUniqueId(157),
+                             ImmutableString("max"),
+                             TExtension::UNDEFINED,
+                             kParams_f_f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("max(f;f;"),
+                             EOpMax,
+                             false);
+constexpr const TFunction kFunction_max_2ff(TSymbolUniqueId(158),
+                             ImmutableString("max"),
+                             TExtension::UNDEFINED,
+                             kParams_2f_f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("max(2f;f;"),
+                             EOpMax,
+                             false);
+constexpr const TFunction kFunction_max_3ff(TSymbolUniqueId(159),
+                             ImmutableString("max"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("max(3f;f;"),
+                             EOpMax,
+                             false);
+constexpr const TFunction kFunction_max_4ff(TSymbolUniqueId(160),
+                             ImmutableString("max"),
+                             TExtension::UNDEFINED,
+                             kParams_4f_f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("max(4f;f;"),
+                             EOpMax,
+                             false);
+constexpr const TFunction kFunction_max_2f2f(TSymbolUniqueId(161),
+                             ImmutableString("max"),
+                             TExtension::UNDEFINED,
+                             kParams_2f_2f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("max(2f;2f;"),
+                             EOpMax,
+                             false);
+constexpr const TFunction kFunction_max_3f3f(TSymbolUniqueId(162),
+                             ImmutableString("max"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_3f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("max(3f;3f;"),
+                             EOpMax,
+                             false);
+constexpr const TFunction kFunction_max_4f4f(TSymbolUniqueId(163),
+                             ImmutableString("max"),
+                             TExtension::UNDEFINED,
+                             kParams_4f_4f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("max(4f;4f;"),
+                             EOpMax,
+                             false);
+constexpr const TFunction kFunction_max_ii(TSymbolUniqueId(164),
+                             ImmutableString("max"),
+                             TExtension::UNDEFINED,
+                             kParams_i_i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("max(i;i;"),
+                             EOpMax,
+                             false);
+constexpr const TFunction kFunction_max_2i2i(TSymbolUniqueId(165),
+                             ImmutableString("max"),
+                             TExtension::UNDEFINED,
+                             kParams_2i_2i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("max(2i;2i;"),
+                             EOpMax,
+                             false);
+constexpr const TFunction kFunction_max_3i3i(TSymbolUniqueId(166),
+                             ImmutableString("max"),
+                             TExtension::UNDEFINED,
+                             kParams_3i_3i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("max(3i;3i;"),
+                             EOpMax,
+                             false);
+constexpr const TFunction kFunction_max_4i4i(TSymbolUniqueId(167),
+                             ImmutableString("max"),
+                             TExtension::UNDEFINED,
+                             kParams_4i_4i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("max(4i;4i;"),
+                             EOpMax,
+                             false);
+constexpr const TFunction kFunction_max_2ii(TSymbolUniqueId(168),
+                             ImmutableString("max"),
+                             TExtension::UNDEFINED,
+                             kParams_2i_i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("max(2i;i;"),
+                             EOpMax,
+                             false);
+constexpr const TFunction kFunction_max_3ii(TSymbolUniqueId(169),
+                             ImmutableString("max"),
+                             TExtension::UNDEFINED,
+                             kParams_3i_i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("max(3i;i;"),
+                             EOpMax,
+                             false);
+constexpr const TFunction kFunction_max_4ii(TSymbolUniqueId(170),
+                             ImmutableString("max"),
+                             TExtension::UNDEFINED,
+                             kParams_4i_i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("max(4i;i;"),
+                             EOpMax,
+                             false);
+constexpr const TFunction kFunction_max_uu(TSymbolUniqueId(171),
+                             ImmutableString("max"),
+                             TExtension::UNDEFINED,
+                             kParams_u_u,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("max(u;u;"),
+                             EOpMax,
+                             false);
+constexpr const TFunction kFunction_max_2u2u(TSymbolUniqueId(172),
+                             ImmutableString("max"),
+                             TExtension::UNDEFINED,
+                             kParams_2u_2u,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("max(2u;2u;"),
+                             EOpMax,
+                             false);
+constexpr const TFunction kFunction_max_3u3u(TSymbolUniqueId(173),
+                             ImmutableString("max"),
+                             TExtension::UNDEFINED,
+                             kParams_3u_3u,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("max(3u;3u;"),
+                             EOpMax,
+                             false);
+constexpr const TFunction kFunction_max_4u4u(TSymbolUniqueId(174),
+                             ImmutableString("max"),
+                             TExtension::UNDEFINED,
+                             kParams_4u_4u,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("max(4u;4u;"),
+                             EOpMax,
+                             false);
+constexpr const TFunction kFunction_max_2uu(TSymbolUniqueId(175),
+                             ImmutableString("max"),
+                             TExtension::UNDEFINED,
+                             kParams_2u_u,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("max(2u;u;"),
+                             EOpMax,
+                             false);
+constexpr const TFunction kFunction_max_3uu(TSymbolUniqueId(176),
+                             ImmutableString("max"),
+                             TExtension::UNDEFINED,
+                             kParams_3u_u,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("max(3u;u;"),
+                             EOpMax,
+                             false);
+constexpr const TFunction kFunction_max_4uu(TSymbolUniqueId(177),
+                             ImmutableString("max"),
+                             TExtension::UNDEFINED,
+                             kParams_4u_u,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("max(4u;u;"),
+                             EOpMax,
+                             false);
+constexpr const TFunction kFunction_clamp_fff(TSymbolUniqueId(178),
+                             ImmutableString("clamp"),
+                             TExtension::UNDEFINED,
+                             kParams_f_f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("clamp(f;f;f;"),
+                             EOpClamp,
+                             false);
+constexpr const TFunction kFunction_clamp_2fff(TSymbolUniqueId(179),
+                             ImmutableString("clamp"),
+                             TExtension::UNDEFINED,
+                             kParams_2f_f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("clamp(2f;f;f;"),
+                             EOpClamp,
+                             false);
+constexpr const TFunction kFunction_clamp_3fff(TSymbolUniqueId(180),
+                             ImmutableString("clamp"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("clamp(3f;f;f;"),
+                             EOpClamp,
+                             false);
+constexpr const TFunction kFunction_clamp_4fff(TSymbolUniqueId(181),
+                             ImmutableString("clamp"),
+                             TExtension::UNDEFINED,
+                             kParams_4f_f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("clamp(4f;f;f;"),
+                             EOpClamp,
+                             false);
+constexpr const TFunction kFunction_clamp_2f2f2f(TSymbolUniqueId(182),
+                             ImmutableString("clamp"),
+                             TExtension::UNDEFINED,
+                             kParams_2f_2f_2f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("clamp(2f;2f;2f;"),
+                             EOpClamp,
+                             false);
+constexpr const TFunction kFunction_clamp_3f3f3f(TSymbolUniqueId(183),
+                             ImmutableString("clamp"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_3f_3f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("clamp(3f;3f;3f;"),
+                             EOpClamp,
+                             false);
+constexpr const TFunction kFunction_clamp_4f4f4f(TSymbolUniqueId(184),
+                             ImmutableString("clamp"),
+                             TExtension::UNDEFINED,
+                             kParams_4f_4f_4f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("clamp(4f;4f;4f;"),
+                             EOpClamp,
+                             false);
+constexpr const TFunction kFunction_clamp_iii(TSymbolUniqueId(185),
+                             ImmutableString("clamp"),
+                             TExtension::UNDEFINED,
+                             kParams_i_i_i,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("clamp(i;i;i;"),
+                             EOpClamp,
+                             false);
+constexpr const TFunction kFunction_clamp_2iii(TSymbolUniqueId(186),
+                             ImmutableString("clamp"),
+                             TExtension::UNDEFINED,
+                             kParams_2i_i_i,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("clamp(2i;i;i;"),
+                             EOpClamp,
+                             false);
+constexpr const TFunction kFunction_clamp_3iii(TSymbolUniqueId(187),
+                             ImmutableString("clamp"),
+                             TExtension::UNDEFINED,
+                             kParams_3i_i_i,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("clamp(3i;i;i;"),
+                             EOpClamp,
+                             false);
+constexpr const TFunction kFunction_clamp_4iii(TSymbolUniqueId(188),
+                             ImmutableString("clamp"),
+                             TExtension::UNDEFINED,
+                             kParams_4i_i_i,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("clamp(4i;i;i;"),
+                             EOpClamp,
+                             false);
+constexpr const TFunction kFunction_clamp_2i2i2i(TSymbolUniqueId(189),
+                             ImmutableString("clamp"),
+                             TExtension::UNDEFINED,
+                             kParams_2i_2i_2i,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("clamp(2i;2i;2i;"),
+                             EOpClamp,
+                             false);
+constexpr const TFunction kFunction_clamp_3i3i3i(TSymbolUniqueId(190),
+                             ImmutableString("clamp"),
+                             TExtension::UNDEFINED,
+                             kParams_3i_3i_3i,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("clamp(3i;3i;3i;"),
+                             EOpClamp,
+                             false);
+constexpr const TFunction kFunction_clamp_4i4i4i(TSymbolUniqueId(191),
+                             ImmutableString("clamp"),
+                             TExtension::UNDEFINED,
+                             kParams_4i_4i_4i,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("clamp(4i;4i;4i;"),
+                             EOpClamp,
+                             false);
+constexpr const TFunction kFunction_clamp_uuu(TSymbolUniqueId(192),
+                             ImmutableString("clamp"),
+                             TExtension::UNDEFINED,
+                             kParams_u_u_u,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("clamp(u;u;u;"),
+                             EOpClamp,
+                             false);
+constexpr const TFunction kFunction_clamp_2uuu(TSymbolUniqueId(193),
+                             ImmutableString("clamp"),
+                             TExtension::UNDEFINED,
+                             kParams_2u_u_u,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("clamp(2u;u;u;"),
+                             EOpClamp,
+                             false);
+constexpr const TFunction kFunction_clamp_3uuu(TSymbolUniqueId(194),
+                             ImmutableString("clamp"),
+                             TExtension::UNDEFINED,
+                             kParams_3u_u_u,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("clamp(3u;u;u;"),
+                             EOpClamp,
+                             false);
+constexpr const TFunction kFunction_clamp_4uuu(TSymbolUniqueId(195),
+                             ImmutableString("clamp"),
+                             TExtension::UNDEFINED,
+                             kParams_4u_u_u,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("clamp(4u;u;u;"),
+                             EOpClamp,
+                             false);
+constexpr const TFunction kFunction_clamp_2u2u2u(TSymbolUniqueId(196),
+                             ImmutableString("clamp"),
+                             TExtension::UNDEFINED,
+                             kParams_2u_2u_2u,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("clamp(2u;2u;2u;"),
+                             EOpClamp,
+                             false);
+constexpr const TFunction kFunction_clamp_3u3u3u(TSymbolUniqueId(197),
+                             ImmutableString("clamp"),
+                             TExtension::UNDEFINED,
+                             kParams_3u_3u_3u,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("clamp(3u;3u;3u;"),
+                             EOpClamp,
+                             false);
+constexpr const TFunction kFunction_clamp_4u4u4u(TSymbolUniqueId(198),
+                             ImmutableString("clamp"),
+                             TExtension::UNDEFINED,
+                             kParams_4u_4u_4u,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("clamp(4u;4u;4u;"),
+                             EOpClamp,
+                             false);
+constexpr const TFunction kFunction_mix_fff(TSymbolUniqueId(199),
+                             ImmutableString("mix"),
+                             TExtension::UNDEFINED,
+                             kParams_f_f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("mix(f;f;f;"),
+                             EOpMix,
+                             false);
+constexpr const TFunction kFunction_mix_2f2ff(TSymbolUniqueId(200),
+                             ImmutableString("mix"),
+                             TExtension::UNDEFINED,
+                             kParams_2f_2f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("mix(2f;2f;f;"),
+                             EOpMix,
+                             false);
+constexpr const TFunction kFunction_mix_3f3ff(TSymbolUniqueId(201),
+                             ImmutableString("mix"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_3f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("mix(3f;3f;f;"),
+                             EOpMix,
+                             false);
+constexpr const TFunction kFunction_mix_4f4ff(TSymbolUniqueId(202),
+                             ImmutableString("mix"),
+                             TExtension::UNDEFINED,
+                             kParams_4f_4f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("mix(4f;4f;f;"),
+                             EOpMix,
+                             false);
+constexpr const TFunction kFunction_mix_2f2f2f(TSymbolUniqueId(203),
+                             ImmutableString("mix"),
+                             TExtension::UNDEFINED,
+                             kParams_2f_2f_2f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("mix(2f;2f;2f;"),
+                             EOpMix,
+                             false);
+constexpr const TFunction kFunction_mix_3f3f3f(TSymbolUniqueId(204),
+                             ImmutableString("mix"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_3f_3f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("mix(3f;3f;3f;"),
+                             EOpMix,
+                             false);
+constexpr const TFunction kFunction_mix_4f4f4f(TSymbolUniqueId(205),
+                             ImmutableString("mix"),
+                             TExtension::UNDEFINED,
+                             kParams_4f_4f_4f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("mix(4f;4f;4f;"),
+                             EOpMix,
+                             false);
+constexpr const TFunction kFunction_mix_ffb(TSymbolUniqueId(206),
+                             ImmutableString("mix"),
+                             TExtension::UNDEFINED,
+                             kParams_f_f_b,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("mix(f;f;b;"),
+                             EOpMix,
+                             false);
+constexpr const TFunction kFunction_mix_2f2f2b(TSymbolUniqueId(207),
+                             ImmutableString("mix"),
+                             TExtension::UNDEFINED,
+                             kParams_2f_2f_2b,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("mix(2f;2f;2b;"),
+                             EOpMix,
+                             false);
+constexpr const TFunction kFunction_mix_3f3f3b(TSymbolUniqueId(208),
+                             ImmutableString("mix"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_3f_3b,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("mix(3f;3f;3b;"),
+                             EOpMix,
+                             false);
+constexpr const TFunction kFunction_mix_4f4f4b(TSymbolUniqueId(209),
+                             ImmutableString("mix"),
+                             TExtension::UNDEFINED,
+                             kParams_4f_4f_4b,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("mix(4f;4f;4b;"),
+                             EOpMix,
+                             false);
+constexpr const TFunction kFunction_step_ff(TSymbolUniqueId(210),
+                             ImmutableString("step"),
+                             TExtension::UNDEFINED,
+                             kParams_f_f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("step(f;f;"),
+                             EOpStep,
+                             false);
+constexpr const TFunction kFunction_step_2f2f(TSymbolUniqueId(211),
+                             ImmutableString("step"),
+                             TExtension::UNDEFINED,
+                             kParams_2f_2f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("step(2f;2f;"),
+                             EOpStep,
+                             false);
+constexpr const TFunction kFunction_step_3f3f(TSymbolUniqueId(212),
+                             ImmutableString("step"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_3f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("step(3f;3f;"),
+                             EOpStep,
+                             false);
+constexpr const TFunction kFunction_step_4f4f(TSymbolUniqueId(213),
+                             ImmutableString("step"),
+                             TExtension::UNDEFINED,
+                             kParams_4f_4f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("step(4f;4f;"),
+                             EOpStep,
+                             false);
+constexpr const TFunction kFunction_step_f2f(TSymbolUniqueId(214),
+                             ImmutableString("step"),
+                             TExtension::UNDEFINED,
+                             kParams_f_2f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("step(f;2f;"),
+                             EOpStep,
+                             false);
+constexpr const TFunction kFunction_step_f3f(TSymbolUniqueId(215),
+                             ImmutableString("step"),
+                             TExtension::UNDEFINED,
+                             kParams_f_3f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("step(f;3f;"),
+                             EOpStep,
+                             false);
+constexpr const TFunction kFunction_step_f4f(TSymbolUniqueId(216),
+                             ImmutableString("step"),
+                             TExtension::UNDEFINED,
+                             kParams_f_4f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("step(f;4f;"),
+                             EOpStep,
+                             false);
+constexpr const TFunction kFunction_smoothstep_fff(TSymbolUniqueId(217),
+                             ImmutableString("smoothstep"),
+                             TExtension::UNDEFINED,
+                             kParams_f_f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("smoothstep(f;f;f;"),
+                             EOpSmoothstep,
+                             false);
+constexpr const TFunction kFunction_smoothstep_2f2f2f(TSymbolUniqueId(218),
+                             ImmutableString("smoothstep"),
+                             TExtension::UNDEFINED,
+                             kParams_2f_2f_2f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("smoothstep(2f;2f;2f;"),
+                             EOpSmoothstep,
+                             false);
+constexpr const TFunction kFunction_smoothstep_3f3f3f(TSymbolUniqueId(219),
+                             ImmutableString("smoothstep"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_3f_3f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("smoothstep(3f;3f;3f;"),
+                             EOpSmoothstep,
+                             false);
+constexpr const TFunction kFunction_smoothstep_4f4f4f(TSymbolUniqueId(220),
+                             ImmutableString("smoothstep"),
+                             TExtension::UNDEFINED,
+                             kParams_4f_4f_4f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("smoothstep(4f;4f;4f;"),
+                             EOpSmoothstep,
+                             false);
+constexpr const TFunction kFunction_smoothstep_ff2f(TSymbolUniqueId(221),
+                             ImmutableString("smoothstep"),
+                             TExtension::UNDEFINED,
+                             kParams_f_f_2f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("smoothstep(f;f;2f;"),
+                             EOpSmoothstep,
+                             false);
+constexpr const TFunction kFunction_smoothstep_ff3f(TSymbolUniqueId(222),
+                             ImmutableString("smoothstep"),
+                             TExtension::UNDEFINED,
+                             kParams_f_f_3f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("smoothstep(f;f;3f;"),
+                             EOpSmoothstep,
+                             false);
+constexpr const TFunction kFunction_smoothstep_ff4f(TSymbolUniqueId(223),
+                             ImmutableString("smoothstep"),
+                             TExtension::UNDEFINED,
+                             kParams_f_f_4f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("smoothstep(f;f;4f;"),
+                             EOpSmoothstep,
+                             false);
+constexpr const TFunction kFunction_modf_ff(TSymbolUniqueId(224),
+                             ImmutableString("modf"),
+                             TExtension::UNDEFINED,
+                             kParams_f_of,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("modf(f;f;"),
+                             EOpModf,
+                             false);
+constexpr const TFunction kFunction_modf_2f2f(TSymbolUniqueId(225),
+                             ImmutableString("modf"),
+                             TExtension::UNDEFINED,
+                             kParams_2f_o2f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("modf(2f;2f;"),
+                             EOpModf,
+                             false);
+constexpr const TFunction kFunction_modf_3f3f(TSymbolUniqueId(226),
+                             ImmutableString("modf"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_o3f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("modf(3f;3f;"),
+                             EOpModf,
+                             false);
+constexpr const TFunction kFunction_modf_4f4f(TSymbolUniqueId(227),
+                             ImmutableString("modf"),
+                             TExtension::UNDEFINED,
+                             kParams_4f_o4f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("modf(4f;4f;"),
+                             EOpModf,
+                             false);
+constexpr const TFunction kFunction_isnan_f(TSymbolUniqueId(228),
+                             ImmutableString("isnan"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("isnan(f;"),
+                             EOpIsnan,
+                             false);
+constexpr const TFunction kFunction_isnan_2f(TSymbolUniqueId(229),
+                             ImmutableString("isnan"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("isnan(2f;"),
+                             EOpIsnan,
+                             false);
+constexpr const TFunction kFunction_isnan_3f(TSymbolUniqueId(230),
+                             ImmutableString("isnan"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("isnan(3f;"),
+                             EOpIsnan,
+                             false);
+constexpr const TFunction kFunction_isnan_4f(TSymbolUniqueId(231),
+                             ImmutableString("isnan"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("isnan(4f;"),
+                             EOpIsnan,
+                             false);
+constexpr const TFunction kFunction_isinf_f(TSymbolUniqueId(232),
+                             ImmutableString("isinf"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("isinf(f;"),
+                             EOpIsinf,
+                             false);
+constexpr const TFunction kFunction_isinf_2f(TSymbolUniqueId(233),
+                             ImmutableString("isinf"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("isinf(2f;"),
+                             EOpIsinf,
+                             false);
+constexpr const TFunction kFunction_isinf_3f(TSymbolUniqueId(234),
+                             ImmutableString("isinf"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("isinf(3f;"),
+                             EOpIsinf,
+                             false);
+constexpr const TFunction kFunction_isinf_4f(TSymbolUniqueId(235),
+                             ImmutableString("isinf"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("isinf(4f;"),
+                             EOpIsinf,
+                             false);
+constexpr const TFunction kFunction_floatBitsToInt_f(TSymbolUniqueId(236),
+                             ImmutableString("floatBitsToInt"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("floatBitsToInt(f;"),
+                             EOpFloatBitsToInt,
+                             false);
+constexpr const TFunction kFunction_floatBitsToInt_2f(TSymbolUniqueId(237),
+                             ImmutableString("floatBitsToInt"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("floatBitsToInt(2f;"),
+                             EOpFloatBitsToInt,
+                             false);
+constexpr const TFunction kFunction_floatBitsToInt_3f(TSymbolUniqueId(238),
+                             ImmutableString("floatBitsToInt"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("floatBitsToInt(3f;"),
+                             EOpFloatBitsToInt,
+                             false);
+constexpr const TFunction kFunction_floatBitsToInt_4f(TSymbolUniqueId(239),
+                             ImmutableString("floatBitsToInt"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("floatBitsToInt(4f;"),
+                             EOpFloatBitsToInt,
+                             false);
+constexpr const TFunction kFunction_floatBitsToUint_f(TSymbolUniqueId(240),
+                             ImmutableString("floatBitsToUint"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("floatBitsToUint(f;"),
+                             EOpFloatBitsToUint,
+                             false);
+constexpr const TFunction kFunction_floatBitsToUint_2f(TSymbolUniqueId(241),
+                             ImmutableString("floatBitsToUint"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("floatBitsToUint(2f;"),
+                             EOpFloatBitsToUint,
+                             false);
+constexpr const TFunction kFunction_floatBitsToUint_3f(TSymbolUniqueId(242),
+                             ImmutableString("floatBitsToUint"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("floatBitsToUint(3f;"),
+                             EOpFloatBitsToUint,
+                             false);
+constexpr const TFunction kFunction_floatBitsToUint_4f(TSymbolUniqueId(243),
+                             ImmutableString("floatBitsToUint"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("floatBitsToUint(4f;"),
+                             EOpFloatBitsToUint,
+                             false);
+constexpr const TFunction kFunction_intBitsToFloat_i(TSymbolUniqueId(244),
+                             ImmutableString("intBitsToFloat"),
+                             TExtension::UNDEFINED,
+                             kParams_i,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("intBitsToFloat(i;"),
+                             EOpIntBitsToFloat,
+                             false);
+constexpr const TFunction kFunction_intBitsToFloat_2i(TSymbolUniqueId(245),
+                             ImmutableString("intBitsToFloat"),
+                             TExtension::UNDEFINED,
+                             kParams_2i,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("intBitsToFloat(2i;"),
+                             EOpIntBitsToFloat,
+                             false);
+constexpr const TFunction kFunction_intBitsToFloat_3i(TSymbolUniqueId(246),
+                             ImmutableString("intBitsToFloat"),
+                             TExtension::UNDEFINED,
+                             kParams_3i,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("intBitsToFloat(3i;"),
+                             EOpIntBitsToFloat,
+                             false);
+constexpr const TFunction kFunction_intBitsToFloat_4i(TSymbolUniqueId(247),
+                             ImmutableString("intBitsToFloat"),
+                             TExtension::UNDEFINED,
+                             kParams_4i,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("intBitsToFloat(4i;"),
+                             EOpIntBitsToFloat,
+                             false);
+constexpr const TFunction kFunction_uintBitsToFloat_u(TSymbolUniqueId(248),
+                             ImmutableString("uintBitsToFloat"),
+                             TExtension::UNDEFINED,
+                             kParams_u,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("uintBitsToFloat(u;"),
+                             EOpUintBitsToFloat,
+                             false);
+constexpr const TFunction kFunction_uintBitsToFloat_2u(TSymbolUniqueId(249),
+                             ImmutableString("uintBitsToFloat"),
+                             TExtension::UNDEFINED,
+                             kParams_2u,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("uintBitsToFloat(2u;"),
+                             EOpUintBitsToFloat,
+                             false);
+constexpr const TFunction kFunction_uintBitsToFloat_3u(TSymbolUniqueId(250),
+                             ImmutableString("uintBitsToFloat"),
+                             TExtension::UNDEFINED,
+                             kParams_3u,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("uintBitsToFloat(3u;"),
+                             EOpUintBitsToFloat,
+                             false);
+constexpr const TFunction kFunction_uintBitsToFloat_4u(TSymbolUniqueId(251),
+                             ImmutableString("uintBitsToFloat"),
+                             TExtension::UNDEFINED,
+                             kParams_4u,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("uintBitsToFloat(4u;"),
+                             EOpUintBitsToFloat,
+                             false);
+constexpr const TFunction kFunction_frexp_fi(TSymbolUniqueId(252),
+                             ImmutableString("frexp"),
+                             TExtension::UNDEFINED,
+                             kParams_f_oi,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("frexp(f;i;"),
+                             EOpFrexp,
+                             false);
+constexpr const TFunction kFunction_frexp_2f2i(TSymbolUniqueId(253),
+                             ImmutableString("frexp"),
+                             TExtension::UNDEFINED,
+                             kParams_2f_o2i,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("frexp(2f;2i;"),
+                             EOpFrexp,
+                             false);
+constexpr const TFunction kFunction_frexp_3f3i(TSymbolUniqueId(254),
+                             ImmutableString("frexp"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_o3i,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("frexp(3f;3i;"),
+                             EOpFrexp,
+                             false);
+constexpr const TFunction kFunction_frexp_4f4i(TSymbolUniqueId(255),
+                             ImmutableString("frexp"),
+                             TExtension::UNDEFINED,
+                             kParams_4f_o4i,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("frexp(4f;4i;"),
+                             EOpFrexp,
+                             false);
+constexpr const TFunction kFunction_ldexp_fi(TSymbolUniqueId(256),
+                             ImmutableString("ldexp"),
+                             TExtension::UNDEFINED,
+                             kParams_f_i,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("ldexp(f;i;"),
+                             EOpLdexp,
+                             false);
+constexpr const TFunction kFunction_ldexp_2f2i(TSymbolUniqueId(257),
+                             ImmutableString("ldexp"),
+                             TExtension::UNDEFINED,
+                             kParams_2f_2i,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("ldexp(2f;2i;"),
+                             EOpLdexp,
+                             false);
+constexpr const TFunction kFunction_ldexp_3f3i(TSymbolUniqueId(258),
+                             ImmutableString("ldexp"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_3i,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("ldexp(3f;3i;"),
+                             EOpLdexp,
+                             false);
+constexpr const TFunction kFunction_ldexp_4f4i(TSymbolUniqueId(259),
+                             ImmutableString("ldexp"),
+                             TExtension::UNDEFINED,
+                             kParams_4f_4i,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("ldexp(4f;4i;"),
+                             EOpLdexp,
+                             false);
+constexpr const TFunction kFunction_packSnorm2x16_2f(TSymbolUniqueId(260),
+                             ImmutableString("packSnorm2x16"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("packSnorm2x16(2f;"),
+                             EOpPackSnorm2x16,
+                             false);
+constexpr const TFunction kFunction_packUnorm2x16_2f(TSymbolUniqueId(261),
+                             ImmutableString("packUnorm2x16"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("packUnorm2x16(2f;"),
+                             EOpPackUnorm2x16,
+                             false);
+constexpr const TFunction kFunction_packHalf2x16_2f(TSymbolUniqueId(262),
+                             ImmutableString("packHalf2x16"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("packHalf2x16(2f;"),
+                             EOpPackHalf2x16,
+                             false);
+constexpr const TFunction kFunction_unpackSnorm2x16_u(TSymbolUniqueId(263),
+                             ImmutableString("unpackSnorm2x16"),
+                             TExtension::UNDEFINED,
+                             kParams_u,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("unpackSnorm2x16(u;"),
+                             EOpUnpackSnorm2x16,
+                             false);
+constexpr const TFunction kFunction_unpackUnorm2x16_u(TSymbolUniqueId(264),
+                             ImmutableString("unpackUnorm2x16"),
+                             TExtension::UNDEFINED,
+                             kParams_u,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("unpackUnorm2x16(u;"),
+                             EOpUnpackUnorm2x16,
+                             false);
+constexpr const TFunction kFunction_unpackHalf2x16_u(TSymbolUniqueId(265),
+                             ImmutableString("unpackHalf2x16"),
+                             TExtension::UNDEFINED,
+                             kParams_u,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("unpackHalf2x16(u;"),
+                             EOpUnpackHalf2x16,
+                             false);
+constexpr const TFunction kFunction_packUnorm4x8_4f(TSymbolUniqueId(266),
+                             ImmutableString("packUnorm4x8"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("packUnorm4x8(4f;"),
+                             EOpPackUnorm4x8,
+                             false);
+constexpr const TFunction kFunction_packSnorm4x8_4f(TSymbolUniqueId(267),
+                             ImmutableString("packSnorm4x8"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("packSnorm4x8(4f;"),
+                             EOpPackSnorm4x8,
+                             false);
+constexpr const TFunction kFunction_unpackUnorm4x8_u(TSymbolUniqueId(268),
+                             ImmutableString("unpackUnorm4x8"),
+                             TExtension::UNDEFINED,
+                             kParams_u,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("unpackUnorm4x8(u;"),
+                             EOpUnpackUnorm4x8,
+                             false);
+constexpr const TFunction kFunction_unpackSnorm4x8_u(TSymbolUniqueId(269),
+                             ImmutableString("unpackSnorm4x8"),
+                             TExtension::UNDEFINED,
+                             kParams_u,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("unpackSnorm4x8(u;"),
+                             EOpUnpackSnorm4x8,
+                             false);
+constexpr const TFunction kFunction_length_f(TSymbolUniqueId(270),
+                             ImmutableString("length"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("length(f;"),
+                             EOpLength,
+                             false);
+constexpr const TFunction kFunction_length_2f(TSymbolUniqueId(271),
+                             ImmutableString("length"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("length(2f;"),
+                             EOpLength,
+                             false);
+constexpr const TFunction kFunction_length_3f(TSymbolUniqueId(272),
+                             ImmutableString("length"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("length(3f;"),
+                             EOpLength,
+                             false);
+constexpr const TFunction kFunction_length_4f(TSymbolUniqueId(273),
+                             ImmutableString("length"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("length(4f;"),
+                             EOpLength,
+                             false);
+constexpr const TFunction kFunction_distance_ff(TSymbolUniqueId(274),
+                             ImmutableString("distance"),
+                             TExtension::UNDEFINED,
+                             kParams_f_f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("distance(f;f;"),
+                             EOpDistance,
+                             false);
+constexpr const TFunction kFunction_distance_2f2f(TSymbolUniqueId(275),
+                             ImmutableString("distance"),
+                             TExtension::UNDEFINED,
+                             kParams_2f_2f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("distance(2f;2f;"),
+                             EOpDistance,
+                             false);
+constexpr const TFunction kFunction_distance_3f3f(TSymbolUniqueId(276),
+                             ImmutableString("distance"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_3f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("distance(3f;3f;"),
+                             EOpDistance,
+                             false);
+constexpr const TFunction kFunction_distance_4f4f(TSymbolUniqueId(277),
+                             ImmutableString("distance"),
+                             TExtension::UNDEFINED,
+                             kParams_4f_4f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("distance(4f;4f;"),
+                             EOpDistance,
+                             false);
+constexpr const TFunction kFunction_dot_ff(TSymbolUniqueId(278),
+                             ImmutableString("dot"),
+                             TExtension::UNDEFINED,
+                             kParams_f_f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("dot(f;f;"),
+                             EOpDot,
+                             false);
+constexpr const TFunction kFunction_dot_2f2f(TSymbolUniqueId(279),
+                             ImmutableString("dot"),
+                             TExtension::UNDEFINED,
+                             kParams_2f_2f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("dot(2f;2f;"),
+                             EOpDot,
+                             false);
+constexpr const TFunction kFunction_dot_3f3f(TSymbolUniqueId(280),
+                             ImmutableString("dot"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_3f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("dot(3f;3f;"),
+                             EOpDot,
+                             false);
+constexpr const TFunction kFunction_dot_4f4f(TSymbolUniqueId(281),
+                             ImmutableString("dot"),
+                             TExtension::UNDEFINED,
+                             kParams_4f_4f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("dot(4f;4f;"),
+                             EOpDot,
+                             false);
+constexpr const TFunction kFunction_cross_3f3f(TSymbolUniqueId(282),
+                             ImmutableString("cross"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_3f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("cross(3f;3f;"),
+                             EOpCross,
+                             false);
+constexpr const TFunction kFunction_normalize_f(TSymbolUniqueId(283),
+                             ImmutableString("normalize"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("normalize(f;"),
+                             EOpNormalize,
+                             false);
+constexpr const TFunction kFunction_normalize_2f(TSymbolUniqueId(284),
+                             ImmutableString("normalize"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("normalize(2f;"),
+                             EOpNormalize,
+                             false);
+constexpr const TFunction kFunction_normalize_3f(TSymbolUniqueId(285),
+                             ImmutableString("normalize"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("normalize(3f;"),
+                             EOpNormalize,
+                             false);
+constexpr const TFunction kFunction_normalize_4f(TSymbolUniqueId(286),
+                             ImmutableString("normalize"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("normalize(4f;"),
+                             EOpNormalize,
+                             false);
+constexpr const TFunction kFunction_faceforward_fff(TSymbolUniqueId(287),
+                             ImmutableString("faceforward"),
+                             TExtension::UNDEFINED,
+                             kParams_f_f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("faceforward(f;f;f;"),
+                             EOpFaceforward,
+                             false);
+constexpr const TFunction kFunction_faceforward_2f2f2f(TSymbolUniqueId(288),
+                             ImmutableString("faceforward"),
+                             TExtension::UNDEFINED,
+                             kParams_2f_2f_2f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("faceforward(2f;2f;2f;"),
+                             EOpFaceforward,
+                             false);
+constexpr const TFunction kFunction_faceforward_3f3f3f(TSymbolUniqueId(289),
+                             ImmutableString("faceforward"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_3f_3f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("faceforward(3f;3f;3f;"),
+                             EOpFaceforward,
+                             false);
+constexpr const TFunction kFunction_faceforward_4f4f4f(TSymbolUniqueId(290),
+                             ImmutableString("faceforward"),
+                             TExtension::UNDEFINED,
+                             kParams_4f_4f_4f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("faceforward(4f;4f;4f;"),
+                             EOpFaceforward,
+                             false);
+constexpr const TFunction kFunction_reflect_ff(TSymbolUniqueId(291),
+                             ImmutableString("reflect"),
+                             TExtension::UNDEFINED,
+                             kParams_f_f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("reflect(f;f;"),
+                             EOpReflect,
+                             false);
+constexpr const TFunction kFunction_reflect_2f2f(TSymbolUniqueId(292),
+                             ImmutableString("reflect"),
+                             TExtension::UNDEFINED,
+                             kParams_2f_2f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("reflect(2f;2f;"),
+                             EOpReflect,
+                             false);
+constexpr const TFunction kFunction_reflect_3f3f(TSymbolUniqueId(293),
+                             ImmutableString("reflect"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_3f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("reflect(3f;3f;"),
+                             EOpReflect,
+                             false);
+constexpr const TFunction kFunction_reflect_4f4f(TSymbolUniqueId(294),
+                             ImmutableString("reflect"),
+                             TExtension::UNDEFINED,
+                             kParams_4f_4f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("reflect(4f;4f;"),
+                             EOpReflect,
+                             false);
+constexpr const TFunction kFunction_refract_fff(TSymbolUniqueId(295),
+                             ImmutableString("refract"),
+                             TExtension::UNDEFINED,
+                             kParams_f_f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("refract(f;f;f;"),
+                             EOpRefract,
+                             false);
+constexpr const TFunction kFunction_refract_2f2ff(TSymbolUniqueId(296),
+                             ImmutableString("refract"),
+                             TExtension::UNDEFINED,
+                             kParams_2f_2f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("refract(2f;2f;f;"),
+                             EOpRefract,
+                             false);
+constexpr const TFunction kFunction_refract_3f3ff(TSymbolUniqueId(297),
+                             ImmutableString("refract"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_3f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("refract(3f;3f;f;"),
+                             EOpRefract,
+                             false);
+constexpr const TFunction kFunction_refract_4f4ff(TSymbolUniqueId(298),
+                             ImmutableString("refract"),
+                             TExtension::UNDEFINED,
+                             kParams_4f_4f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("refract(4f;4f;f;"),
+                             EOpRefract,
+                             false);
+constexpr const TFunction kFunction_matrixCompMult_22f22f(TSymbolUniqueId(299),
+                             ImmutableString("matrixCompMult"),
+                             TExtension::UNDEFINED,
+                             kParams_22f_22f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 2>(),
+                             ImmutableString("matrixCompMult(22f;22f;"),
+                             EOpMulMatrixComponentWise,
+                             false);
+constexpr const TFunction kFunction_matrixCompMult_33f33f(TSymbolUniqueId(300),
+                             ImmutableString("matrixCompMult"),
+                             TExtension::UNDEFINED,
+                             kParams_33f_33f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 3>(),
+                             ImmutableString("matrixCompMult(33f;33f;"),
+                             EOpMulMatrixComponentWise,
+                             false);
+constexpr const TFunction kFunction_matrixCompMult_44f44f(TSymbolUniqueId(301),
+                             ImmutableString("matrixCompMult"),
+                             TExtension::UNDEFINED,
+                             kParams_44f_44f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 4>(),
+                             ImmutableString("matrixCompMult(44f;44f;"),
+                             EOpMulMatrixComponentWise,
+                             false);
+constexpr const TFunction kFunction_matrixCompMult_23f23f(TSymbolUniqueId(302),
+                             ImmutableString("matrixCompMult"),
+                             TExtension::UNDEFINED,
+                             kParams_23f_23f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 3>(),
+                             ImmutableString("matrixCompMult(23f;23f;"),
+                             EOpMulMatrixComponentWise,
+                             false);
+constexpr const TFunction kFunction_matrixCompMult_32f32f(TSymbolUniqueId(303),
+                             ImmutableString("matrixCompMult"),
+                             TExtension::UNDEFINED,
+                             kParams_32f_32f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 2>(),
+                             ImmutableString("matrixCompMult(32f;32f;"),
+                             EOpMulMatrixComponentWise,
+                             false);
+constexpr const TFunction kFunction_matrixCompMult_24f24f(TSymbolUniqueId(304),
+                             ImmutableString("matrixCompMult"),
+                             TExtension::UNDEFINED,
+                             kParams_24f_24f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 4>(),
+                             ImmutableString("matrixCompMult(24f;24f;"),
+                             EOpMulMatrixComponentWise,
+                             false);
+constexpr const TFunction kFunction_matrixCompMult_42f42f(TSymbolUniqueId(305),
+                             ImmutableString("matrixCompMult"),
+                             TExtension::UNDEFINED,
+                             kParams_42f_42f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 2>(),
+                             ImmutableString("matrixCompMult(42f;42f;"),
+                             EOpMulMatrixComponentWise,
+                             false);
+constexpr const TFunction kFunction_matrixCompMult_34f34f(TSymbolUniqueId(306),
+                             ImmutableString("matrixCompMult"),
+                             TExtension::UNDEFINED,
+                             kParams_34f_34f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 4>(),
+                             ImmutableString("matrixCompMult(34f;34f;"),
+                             EOpMulMatrixComponentWise,
+                             false);
+constexpr const TFunction kFunction_matrixCompMult_43f43f(TSymbolUniqueId(307),
+                             ImmutableString("matrixCompMult"),
+                             TExtension::UNDEFINED,
+                             kParams_43f_43f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 3>(),
+                             ImmutableString("matrixCompMult(43f;43f;"),
+                             EOpMulMatrixComponentWise,
+                             false);
+constexpr const TFunction kFunction_outerProduct_2f2f(TSymbolUniqueId(308),
+                             ImmutableString("outerProduct"),
+                             TExtension::UNDEFINED,
+                             kParams_2f_2f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 2>(),
+                             ImmutableString("outerProduct(2f;2f;"),
+                             EOpOuterProduct,
+                             false);
+constexpr const TFunction kFunction_outerProduct_3f3f(TSymbolUniqueId(309),
+                             ImmutableString("outerProduct"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_3f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 3>(),
+                             ImmutableString("outerProduct(3f;3f;"),
+                             EOpOuterProduct,
+                             false);
+constexpr const TFunction kFunction_outerProduct_4f4f(TSymbolUniqueId(310),
+                             ImmutableString("outerProduct"),
+                             TExtension::UNDEFINED,
+                             kParams_4f_4f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 4>(),
+                             ImmutableString("outerProduct(4f;4f;"),
+                             EOpOuterProduct,
+                             false);
+constexpr const TFunction kFunction_outerProduct_3f2f(TSymbolUniqueId(311),
+                             ImmutableString("outerProduct"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_2f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 3>(),
+                             ImmutableString("outerProduct(3f;2f;"),
+                             EOpOuterProduct,
+                             false);
+constexpr const TFunction kFunction_outerProduct_2f3f(TSymbolUniqueId(312),
+                             ImmutableString("outerProduct"),
+                             TExtension::UNDEFINED,
+                             kParams_2f_3f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 2>(),
+                             ImmutableString("outerProduct(2f;3f;"),
+                             EOpOuterProduct,
+                             false);
+constexpr const TFunction kFunction_outerProduct_4f2f(TSymbolUniqueId(313),
+                             ImmutableString("outerProduct"),
+                             TExtension::UNDEFINED,
+                             kParams_4f_2f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 4>(),
+                             ImmutableString("outerProduct(4f;2f;"),
+                             EOpOuterProduct,
+                             false);
+constexpr const TFunction kFunction_outerProduct_2f4f(TSymbolUniqueId(314),
+                             ImmutableString("outerProduct"),
+                             TExtension::UNDEFINED,
+                             kParams_2f_4f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 2>(),
+                             ImmutableString("outerProduct(2f;4f;"),
+                             EOpOuterProduct,
+                             false);
+constexpr const TFunction kFunction_outerProduct_4f3f(TSymbolUniqueId(315),
+                             ImmutableString("outerProduct"),
+                             TExtension::UNDEFINED,
+                             kParams_4f_3f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 4>(),
+                             ImmutableString("outerProduct(4f;3f;"),
+                             EOpOuterProduct,
+                             false);
+constexpr const TFunction kFunction_outerProduct_3f4f(TSymbolUniqueId(316),
+                             ImmutableString("outerProduct"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_4f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 3>(),
+                             ImmutableString("outerProduct(3f;4f;"),
+                             EOpOuterProduct,
+                             false);
+constexpr const TFunction kFunction_transpose_22f(TSymbolUniqueId(317),
+                             ImmutableString("transpose"),
+                             TExtension::UNDEFINED,
+                             kParams_22f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 2>(),
+                             ImmutableString("transpose(22f;"),
+                             EOpTranspose,
+                             false);
+constexpr const TFunction kFunction_transpose_33f(TSymbolUniqueId(318),
+                             ImmutableString("transpose"),
+                             TExtension::UNDEFINED,
+                             kParams_33f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 3>(),
+                             ImmutableString("transpose(33f;"),
+                             EOpTranspose,
+                             false);
+constexpr const TFunction kFunction_transpose_44f(TSymbolUniqueId(319),
+                             ImmutableString("transpose"),
+                             TExtension::UNDEFINED,
+                             kParams_44f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 4>(),
+                             ImmutableString("transpose(44f;"),
+                             EOpTranspose,
+                             false);
+constexpr const TFunction kFunction_transpose_32f(TSymbolUniqueId(320),
+                             ImmutableString("transpose"),
+                             TExtension::UNDEFINED,
+                             kParams_32f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 3>(),
+                             ImmutableString("transpose(32f;"),
+                             EOpTranspose,
+                             false);
+constexpr const TFunction kFunction_transpose_23f(TSymbolUniqueId(321),
+                             ImmutableString("transpose"),
+                             TExtension::UNDEFINED,
+                             kParams_23f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 2>(),
+                             ImmutableString("transpose(23f;"),
+                             EOpTranspose,
+                             false);
+constexpr const TFunction kFunction_transpose_42f(TSymbolUniqueId(322),
+                             ImmutableString("transpose"),
+                             TExtension::UNDEFINED,
+                             kParams_42f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 4>(),
+                             ImmutableString("transpose(42f;"),
+                             EOpTranspose,
+                             false);
+constexpr const TFunction kFunction_transpose_24f(TSymbolUniqueId(323),
+                             ImmutableString("transpose"),
+                             TExtension::UNDEFINED,
+                             kParams_24f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 2>(),
+                             ImmutableString("transpose(24f;"),
+                             EOpTranspose,
+                             false);
+constexpr const TFunction kFunction_transpose_43f(TSymbolUniqueId(324),
+                             ImmutableString("transpose"),
+                             TExtension::UNDEFINED,
+                             kParams_43f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 4>(),
+                             ImmutableString("transpose(43f;"),
+                             EOpTranspose,
+                             false);
+constexpr const TFunction kFunction_transpose_34f(TSymbolUniqueId(325),
+                             ImmutableString("transpose"),
+                             TExtension::UNDEFINED,
+                             kParams_34f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 3>(),
+                             ImmutableString("transpose(34f;"),
+                             EOpTranspose,
+                             false);
+constexpr const TFunction kFunction_determinant_22f(TSymbolUniqueId(326),
+                             ImmutableString("determinant"),
+                             TExtension::UNDEFINED,
+                             kParams_22f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("determinant(22f;"),
+                             EOpDeterminant,
+                             false);
+constexpr const TFunction kFunction_determinant_33f(TSymbolUniqueId(327),
+                             ImmutableString("determinant"),
+                             TExtension::UNDEFINED,
+                             kParams_33f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("determinant(33f;"),
+                             EOpDeterminant,
+                             false);
+constexpr const TFunction kFunction_determinant_44f(TSymbolUniqueId(328),
+                             ImmutableString("determinant"),
+                             TExtension::UNDEFINED,
+                             kParams_44f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("determinant(44f;"),
+                             EOpDeterminant,
+                             false);
+constexpr const TFunction kFunction_inverse_22f(TSymbolUniqueId(329),
+                             ImmutableString("inverse"),
+                             TExtension::UNDEFINED,
+                             kParams_22f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 2>(),
+                             ImmutableString("inverse(22f;"),
+                             EOpInverse,
+                             false);
+constexpr const TFunction kFunction_inverse_33f(TSymbolUniqueId(330),
+                             ImmutableString("inverse"),
+                             TExtension::UNDEFINED,
+                             kParams_33f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 3>(),
+                             ImmutableString("inverse(33f;"),
+                             EOpInverse,
+                             false);
+constexpr const TFunction kFunction_inverse_44f(TSymbolUniqueId(331),
+                             ImmutableString("inverse"),
+                             TExtension::UNDEFINED,
+                             kParams_44f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 4>(),
+                             ImmutableString("inverse(44f;"),
+                             EOpInverse,
+                             false);
+constexpr const TFunction kFunction_lessThan_2f2f(TSymbolUniqueId(332),
+                             ImmutableString("lessThan"),
+                             TExtension::UNDEFINED,
+                             kParams_2f_2f,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("lessThan(2f;2f;"),
+                             EOpLessThanComponentWise,
+                             false);
+constexpr const TFunction kFunction_lessThan_3f3f(TSymbolUniqueId(333),
+                             ImmutableString("lessThan"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_3f,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("lessThan(3f;3f;"),
+                             EOpLessThanComponentWise,
+                             false);
+constexpr const TFunction kFunction_lessThan_4f4f(TSymbolUniqueId(334),
+                             ImmutableString("lessThan"),
+                             TExtension::UNDEFINED,
+                             kParams_4f_4f,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("lessThan(4f;4f;"),
+                             EOpLessThanComponentWise,
+                             false);
+constexpr const TFunction kFunction_lessThan_2i2i(TSymbolUniqueId(335),
+                             ImmutableString("lessThan"),
+                             TExtension::UNDEFINED,
+                             kParams_2i_2i,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("lessThan(2i;2i;"),
+                             EOpLessThanComponentWise,
+                             false);
+constexpr const TFunction kFunction_lessThan_3i3i(TSymbolUniqueId(336),
+                             ImmutableString("lessThan"),
+                             TExtension::UNDEFINED,
+                             kParams_3i_3i,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("lessThan(3i;3i;"),
+                             EOpLessThanComponentWise,
+                             false);
+constexpr const TFunction kFunction_lessThan_4i4i(TSymbolUniqueId(337),
+                             ImmutableString("lessThan"),
+                             TExtension::UNDEFINED,
+                             kParams_4i_4i,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("lessThan(4i;4i;"),
+                             EOpLessThanComponentWise,
+                             false);
+constexpr const TFunction kFunction_lessThan_2u2u(TSymbolUniqueId(338),
+                             ImmutableString("lessThan"),
+                             TExtension::UNDEFINED,
+                             kParams_2u_2u,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("lessThan(2u;2u;"),
+                             EOpLessThanComponentWise,
+                             false);
+constexpr const TFunction kFunction_lessThan_3u3u(TSymbolUniqueId(339),
+                             ImmutableString("lessThan"),
+                             TExtension::UNDEFINED,
+                             kParams_3u_3u,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("lessThan(3u;3u;"),
+                             EOpLessThanComponentWise,
+                             false);
+constexpr const TFunction kFunction_lessThan_4u4u(TSymbolUniqueId(340),
+                             ImmutableString("lessThan"),
+                             TExtension::UNDEFINED,
+                             kParams_4u_4u,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("lessThan(4u;4u;"),
+                             EOpLessThanComponentWise,
+                             false);
+constexpr const TFunction kFunction_lessThanEqual_2f2f(TSymbolUniqueId(341),
+                             ImmutableString("lessThanEqual"),
+                             TExtension::UNDEFINED,
+                             kParams_2f_2f,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("lessThanEqual(2f;2f;"),
+                             EOpLessThanEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_lessThanEqual_3f3f(TSymbolUniqueId(342),
+                             ImmutableString("lessThanEqual"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_3f,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("lessThanEqual(3f;3f;"),
+                             EOpLessThanEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_lessThanEqual_4f4f(TSymbolUniqueId(343),
+                             ImmutableString("lessThanEqual"),
+                             TExtension::UNDEFINED,
+                             kParams_4f_4f,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("lessThanEqual(4f;4f;"),
+                             EOpLessThanEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_lessThanEqual_2i2i(TSymbolUniqueId(344),
+                             ImmutableString("lessThanEqual"),
+                             TExtension::UNDEFINED,
+                             kParams_2i_2i,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("lessThanEqual(2i;2i;"),
+                             EOpLessThanEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_lessThanEqual_3i3i(TSymbolUniqueId(345),
+                             ImmutableString("lessThanEqual"),
+                             TExtension::UNDEFINED,
+                             kParams_3i_3i,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("lessThanEqual(3i;3i;"),
+                             EOpLessThanEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_lessThanEqual_4i4i(TSymbolUniqueId(346),
+                             ImmutableString("lessThanEqual"),
+                             TExtension::UNDEFINED,
+                             kParams_4i_4i,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("lessThanEqual(4i;4i;"),
+                             EOpLessThanEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_lessThanEqual_2u2u(TSymbolUniqueId(347),
+                             ImmutableString("lessThanEqual"),
+                             TExtension::UNDEFINED,
+                             kParams_2u_2u,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("lessThanEqual(2u;2u;"),
+                             EOpLessThanEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_lessThanEqual_3u3u(TSymbolUniqueId(348),
+                             ImmutableString("lessThanEqual"),
+                             TExtension::UNDEFINED,
+                             kParams_3u_3u,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("lessThanEqual(3u;3u;"),
+                             EOpLessThanEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_lessThanEqual_4u4u(TSymbolUniqueId(349),
+                             ImmutableString("lessThanEqual"),
+                             TExtension::UNDEFINED,
+                             kParams_4u_4u,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("lessThanEqual(4u;4u;"),
+                             EOpLessThanEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_greaterThan_2f2f(TSymbolUniqueId(350),
+                             ImmutableString("greaterThan"),
+                             TExtension::UNDEFINED,
+                             kParams_2f_2f,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("greaterThan(2f;2f;"),
+                             EOpGreaterThanComponentWise,
+                             false);
+constexpr const TFunction kFunction_greaterThan_3f3f(TSymbolUniqueId(351),
+                             ImmutableString("greaterThan"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_3f,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("greaterThan(3f;3f;"),
+                             EOpGreaterThanComponentWise,
+                             false);
+constexpr const TFunction kFunction_greaterThan_4f4f(TSymbolUniqueId(352),
+                             ImmutableString("greaterThan"),
+                             TExtension::UNDEFINED,
+                             kParams_4f_4f,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("greaterThan(4f;4f;"),
+                             EOpGreaterThanComponentWise,
+                             false);
+constexpr const TFunction kFunction_greaterThan_2i2i(TSymbolUniqueId(353),
+                             ImmutableString("greaterThan"),
+                             TExtension::UNDEFINED,
+                             kParams_2i_2i,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("greaterThan(2i;2i;"),
+                             EOpGreaterThanComponentWise,
+                             false);
+constexpr const TFunction kFunction_greaterThan_3i3i(TSymbolUniqueId(354),
+                             ImmutableString("greaterThan"),
+                             TExtension::UNDEFINED,
+                             kParams_3i_3i,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("greaterThan(3i;3i;"),
+                             EOpGreaterThanComponentWise,
+                             false);
+constexpr const TFunction kFunction_greaterThan_4i4i(TSymbolUniqueId(355),
+                             ImmutableString("greaterThan"),
+                             TExtension::UNDEFINED,
+                             kParams_4i_4i,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("greaterThan(4i;4i;"),
+                             EOpGreaterThanComponentWise,
+                             false);
+constexpr const TFunction kFunction_greaterThan_2u2u(TSymbolUniqueId(356),
+                             ImmutableString("greaterThan"),
+                             TExtension::UNDEFINED,
+                             kParams_2u_2u,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("greaterThan(2u;2u;"),
+                             EOpGreaterThanComponentWise,
+                             false);
+constexpr const TFunction kFunction_greaterThan_3u3u(TSymbolUniqueId(357),
+                             ImmutableString("greaterThan"),
+                             TExtension::UNDEFINED,
+                             kParams_3u_3u,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("greaterThan(3u;3u;"),
+                             EOpGreaterThanComponentWise,
+                             false);
+constexpr const TFunction kFunction_greaterThan_4u4u(TSymbolUniqueId(358),
+                             ImmutableString("greaterThan"),
+                             TExtension::UNDEFINED,
+                             kParams_4u_4u,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("greaterThan(4u;4u;"),
+                             EOpGreaterThanComponentWise,
+                             false);
+constexpr const TFunction kFunction_greaterThanEqual_2f2f(TSymbolUniqueId(359),
+                             ImmutableString("greaterThanEqual"),
+                             TExtension::UNDEFINED,
+                             kParams_2f_2f,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("greaterThanEqual(2f;2f;"),
+                             EOpGreaterThanEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_greaterThanEqual_3f3f(TSymbolUniqueId(360),
+                             ImmutableString("greaterThanEqual"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_3f,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("greaterThanEqual(3f;3f;"),
+                             EOpGreaterThanEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_greaterThanEqual_4f4f(TSymbolUniqueId(361),
+                             ImmutableString("greaterThanEqual"),
+                             TExtension::UNDEFINED,
+                             kParams_4f_4f,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("greaterThanEqual(4f;4f;"),
+                             EOpGreaterThanEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_greaterThanEqual_2i2i(TSymbolUniqueId(362),
+                             ImmutableString("greaterThanEqual"),
+                             TExtension::UNDEFINED,
+                             kParams_2i_2i,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("greaterThanEqual(2i;2i;"),
+                             EOpGreaterThanEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_greaterThanEqual_3i3i(TSymbolUniqueId(363),
+                             ImmutableString("greaterThanEqual"),
+                             TExtension::UNDEFINED,
+                             kParams_3i_3i,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("greaterThanEqual(3i;3i;"),
+                             EOpGreaterThanEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_greaterThanEqual_4i4i(TSymbolUniqueId(364),
+                             ImmutableString("greaterThanEqual"),
+                             TExtension::UNDEFINED,
+                             kParams_4i_4i,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("greaterThanEqual(4i;4i;"),
+                             EOpGreaterThanEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_greaterThanEqual_2u2u(TSymbolUniqueId(365),
+                             ImmutableString("greaterThanEqual"),
+                             TExtension::UNDEFINED,
+                             kParams_2u_2u,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("greaterThanEqual(2u;2u;"),
+                             EOpGreaterThanEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_greaterThanEqual_3u3u(TSymbolUniqueId(366),
+                             ImmutableString("greaterThanEqual"),
+                             TExtension::UNDEFINED,
+                             kParams_3u_3u,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("greaterThanEqual(3u;3u;"),
+                             EOpGreaterThanEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_greaterThanEqual_4u4u(TSymbolUniqueId(367),
+                             ImmutableString("greaterThanEqual"),
+                             TExtension::UNDEFINED,
+                             kParams_4u_4u,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("greaterThanEqual(4u;4u;"),
+                             EOpGreaterThanEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_equal_2f2f(TSymbolUniqueId(368),
+                             ImmutableString("equal"),
+                             TExtension::UNDEFINED,
+                             kParams_2f_2f,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("equal(2f;2f;"),
+                             EOpEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_equal_3f3f(TSymbolUniqueId(369),
+                             ImmutableString("equal"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_3f,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("equal(3f;3f;"),
+                             EOpEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_equal_4f4f(TSymbolUniqueId(370),
+                             ImmutableString("equal"),
+                             TExtension::UNDEFINED,
+                             kParams_4f_4f,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("equal(4f;4f;"),
+                             EOpEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_equal_2i2i(TSymbolUniqueId(371),
+                             ImmutableString("equal"),
+                             TExtension::UNDEFINED,
+                             kParams_2i_2i,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("equal(2i;2i;"),
+                             EOpEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_equal_3i3i(TSymbolUniqueId(372),
+                             ImmutableString("equal"),
+                             TExtension::UNDEFINED,
+                             kParams_3i_3i,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("equal(3i;3i;"),
+                             EOpEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_equal_4i4i(TSymbolUniqueId(373),
+                             ImmutableString("equal"),
+                             TExtension::UNDEFINED,
+                             kParams_4i_4i,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("equal(4i;4i;"),
+                             EOpEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_equal_2u2u(TSymbolUniqueId(374),
+                             ImmutableString("equal"),
+                             TExtension::UNDEFINED,
+                             kParams_2u_2u,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("equal(2u;2u;"),
+                             EOpEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_equal_3u3u(TSymbolUniqueId(375),
+                             ImmutableString("equal"),
+                             TExtension::UNDEFINED,
+                             kParams_3u_3u,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("equal(3u;3u;"),
+                             EOpEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_equal_4u4u(TSymbolUniqueId(376),
+                             ImmutableString("equal"),
+                             TExtension::UNDEFINED,
+                             kParams_4u_4u,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("equal(4u;4u;"),
+                             EOpEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_equal_2b2b(TSymbolUniqueId(377),
+                             ImmutableString("equal"),
+                             TExtension::UNDEFINED,
+                             kParams_2b_2b,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("equal(2b;2b;"),
+                             EOpEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_equal_3b3b(TSymbolUniqueId(378),
+                             ImmutableString("equal"),
+                             TExtension::UNDEFINED,
+                             kParams_3b_3b,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("equal(3b;3b;"),
+                             EOpEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_equal_4b4b(TSymbolUniqueId(379),
+                             ImmutableString("equal"),
+                             TExtension::UNDEFINED,
+                             kParams_4b_4b,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("equal(4b;4b;"),
+                             EOpEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_notEqual_2f2f(TSymbolUniqueId(380),
+                             ImmutableString("notEqual"),
+                             TExtension::UNDEFINED,
+                             kParams_2f_2f,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("notEqual(2f;2f;"),
+                             EOpNotEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_notEqual_3f3f(TSymbolUniqueId(381),
+                             ImmutableString("notEqual"),
+                             TExtension::UNDEFINED,
+                             kParams_3f_3f,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("notEqual(3f;3f;"),
+                             EOpNotEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_notEqual_4f4f(TSymbolUniqueId(382),
+                             ImmutableString("notEqual"),
+                             TExtension::UNDEFINED,
+                             kParams_4f_4f,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("notEqual(4f;4f;"),
+                             EOpNotEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_notEqual_2i2i(TSymbolUniqueId(383),
+                             ImmutableString("notEqual"),
+                             TExtension::UNDEFINED,
+                             kParams_2i_2i,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("notEqual(2i;2i;"),
+                             EOpNotEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_notEqual_3i3i(TSymbolUniqueId(384),
+                             ImmutableString("notEqual"),
+                             TExtension::UNDEFINED,
+                             kParams_3i_3i,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("notEqual(3i;3i;"),
+                             EOpNotEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_notEqual_4i4i(TSymbolUniqueId(385),
+                             ImmutableString("notEqual"),
+                             TExtension::UNDEFINED,
+                             kParams_4i_4i,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("notEqual(4i;4i;"),
+                             EOpNotEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_notEqual_2u2u(TSymbolUniqueId(386),
+                             ImmutableString("notEqual"),
+                             TExtension::UNDEFINED,
+                             kParams_2u_2u,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("notEqual(2u;2u;"),
+                             EOpNotEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_notEqual_3u3u(TSymbolUniqueId(387),
+                             ImmutableString("notEqual"),
+                             TExtension::UNDEFINED,
+                             kParams_3u_3u,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("notEqual(3u;3u;"),
+                             EOpNotEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_notEqual_4u4u(TSymbolUniqueId(388),
+                             ImmutableString("notEqual"),
+                             TExtension::UNDEFINED,
+                             kParams_4u_4u,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("notEqual(4u;4u;"),
+                             EOpNotEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_notEqual_2b2b(TSymbolUniqueId(389),
+                             ImmutableString("notEqual"),
+                             TExtension::UNDEFINED,
+                             kParams_2b_2b,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("notEqual(2b;2b;"),
+                             EOpNotEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_notEqual_3b3b(TSymbolUniqueId(390),
+                             ImmutableString("notEqual"),
+                             TExtension::UNDEFINED,
+                             kParams_3b_3b,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("notEqual(3b;3b;"),
+                             EOpNotEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_notEqual_4b4b(TSymbolUniqueId(391),
+                             ImmutableString("notEqual"),
+                             TExtension::UNDEFINED,
+                             kParams_4b_4b,
+                             2,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("notEqual(4b;4b;"),
+                             EOpNotEqualComponentWise,
+                             false);
+constexpr const TFunction kFunction_any_2b(TSymbolUniqueId(392),
+                             ImmutableString("any"),
+                             TExtension::UNDEFINED,
+                             kParams_2b,
+                             1,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("any(2b;"),
+                             EOpAny,
+                             false);
+constexpr const TFunction kFunction_any_3b(TSymbolUniqueId(393),
+                             ImmutableString("any"),
+                             TExtension::UNDEFINED,
+                             kParams_3b,
+                             1,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("any(3b;"),
+                             EOpAny,
+                             false);
+constexpr const TFunction kFunction_any_4b(TSymbolUniqueId(394),
+                             ImmutableString("any"),
+                             TExtension::UNDEFINED,
+                             kParams_4b,
+                             1,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("any(4b;"),
+                             EOpAny,
+                             false);
+constexpr const TFunction kFunction_all_2b(TSymbolUniqueId(395),
+                             ImmutableString("all"),
+                             TExtension::UNDEFINED,
+                             kParams_2b,
+                             1,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("all(2b;"),
+                             EOpAll,
+                             false);
+constexpr const TFunction kFunction_all_3b(TSymbolUniqueId(396),
+                             ImmutableString("all"),
+                             TExtension::UNDEFINED,
+                             kParams_3b,
+                             1,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("all(3b;"),
+                             EOpAll,
+                             false);
+constexpr const TFunction kFunction_all_4b(TSymbolUniqueId(397),
+                             ImmutableString("all"),
+                             TExtension::UNDEFINED,
+                             kParams_4b,
+                             1,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("all(4b;"),
+                             EOpAll,
+                             false);
+constexpr const TFunction kFunction_not_2b(TSymbolUniqueId(398),
+                             ImmutableString("not"),
+                             TExtension::UNDEFINED,
+                             kParams_2b,
+                             1,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("not(2b;"),
+                             EOpLogicalNotComponentWise,
+                             false);
+constexpr const TFunction kFunction_not_3b(TSymbolUniqueId(399),
+                             ImmutableString("not"),
+                             TExtension::UNDEFINED,
+                             kParams_3b,
+                             1,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("not(3b;"),
+                             EOpLogicalNotComponentWise,
+                             false);
+constexpr const TFunction kFunction_not_4b(TSymbolUniqueId(400),
+                             ImmutableString("not"),
+                             TExtension::UNDEFINED,
+                             kParams_4b,
+                             1,
+                             StaticType::Get<EbtBool, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("not(4b;"),
+                             EOpLogicalNotComponentWise,
+                             false);
+constexpr const TFunction kFunction_bitfieldExtract_iii(TSymbolUniqueId(401),
+                             ImmutableString("bitfieldExtract"),
+                             TExtension::UNDEFINED,
+                             kParams_i_i_i,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("bitfieldExtract(i;i;i;"),
+                             EOpBitfieldExtract,
+                             false);
+constexpr const TFunction kFunction_bitfieldExtract_2iii(TSymbolUniqueId(402),
+                             ImmutableString("bitfieldExtract"),
+                             TExtension::UNDEFINED,
+                             kParams_2i_i_i,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("bitfieldExtract(2i;i;i;"),
+                             EOpBitfieldExtract,
+                             false);
+constexpr const TFunction kFunction_bitfieldExtract_3iii(TSymbolUniqueId(403),
+                             ImmutableString("bitfieldExtract"),
+                             TExtension::UNDEFINED,
+                             kParams_3i_i_i,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("bitfieldExtract(3i;i;i;"),
+                             EOpBitfieldExtract,
+                             false);
+constexpr const TFunction kFunction_bitfieldExtract_4iii(TSymbolUniqueId(404),
+                             ImmutableString("bitfieldExtract"),
+                             TExtension::UNDEFINED,
+                             kParams_4i_i_i,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("bitfieldExtract(4i;i;i;"),
+                             EOpBitfieldExtract,
+                             false);
+constexpr const TFunction kFunction_bitfieldExtract_uii(TSymbolUniqueId(405),
+                             ImmutableString("bitfieldExtract"),
+                             TExtension::UNDEFINED,
+                             kParams_u_i_i,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("bitfieldExtract(u;i;i;"),
+                             EOpBitfieldExtract,
+                             false);
+constexpr const TFunction kFunction_bitfieldExtract_2uii(TSymbolUniqueId(406),
+                             ImmutableString("bitfieldExtract"),
+                             TExtension::UNDEFINED,
+                             kParams_2u_i_i,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("bitfieldExtract(2u;i;i;"),
+                             EOpBitfieldExtract,
+                             false);
+constexpr const TFunction kFunction_bitfieldExtract_3uii(TSymbolUniqueId(407),
+                             ImmutableString("bitfieldExtract"),
+                             TExtension::UNDEFINED,
+                             kParams_3u_i_i,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("bitfieldExtract(3u;i;i;"),
+                             EOpBitfieldExtract,
+                             false);
+constexpr const TFunction kFunction_bitfieldExtract_4uii(TSymbolUniqueId(408),
+                             ImmutableString("bitfieldExtract"),
+                             TExtension::UNDEFINED,
+                             kParams_4u_i_i,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("bitfieldExtract(4u;i;i;"),
+                             EOpBitfieldExtract,
+                             false);
+constexpr const TFunction kFunction_bitfieldInsert_iiii(TSymbolUniqueId(409),
+                             ImmutableString("bitfieldInsert"),
+                             TExtension::UNDEFINED,
+                             kParams_i_i_i_i,
+                             4,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("bitfieldInsert(i;i;i;i;"),
+                             EOpBitfieldInsert,
+                             false);
+constexpr const TFunction kFunction_bitfieldInsert_2i2iii(TSymbolUniqueId(410),
+                             ImmutableString("bitfieldInsert"),
+                             TExtension::UNDEFINED,
+                             kParams_2i_2i_i_i,
+                             4,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("bitfieldInsert(2i;2i;i;i;"),
+                             EOpBitfieldInsert,
+                             false);
+constexpr const TFunction kFunction_bitfieldInsert_3i3iii(TSymbolUniqueId(411),
+                             ImmutableString("bitfieldInsert"),
+                             TExtension::UNDEFINED,
+                             kParams_3i_3i_i_i,
+                             4,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("bitfieldInsert(3i;3i;i;i;"),
+                             EOpBitfieldInsert,
+                             false);
+constexpr const TFunction kFunction_bitfieldInsert_4i4iii(TSymbolUniqueId(412),
+                             ImmutableString("bitfieldInsert"),
+                             TExtension::UNDEFINED,
+                             kParams_4i_4i_i_i,
+                             4,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("bitfieldInsert(4i;4i;i;i;"),
+                             EOpBitfieldInsert,
+                             false);
+constexpr const TFunction kFunction_bitfieldInsert_uuii(TSymbolUniqueId(413),
+                             ImmutableString("bitfieldInsert"),
+                             TExtension::UNDEFINED,
+                             kParams_u_u_i_i,
+                             4,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("bitfieldInsert(u;u;i;i;"),
+                             EOpBitfieldInsert,
+                             false);
+constexpr const TFunction kFunction_bitfieldInsert_2u2uii(TSymbolUniqueId(414),
+                             ImmutableString("bitfieldInsert"),
+                             TExtension::UNDEFINED,
+                             kParams_2u_2u_i_i,
+                             4,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("bitfieldInsert(2u;2u;i;i;"),
+                             EOpBitfieldInsert,
+                             false);
+constexpr const TFunction kFunction_bitfieldInsert_3u3uii(TSymbolUniqueId(415),
+                             ImmutableString("bitfieldInsert"),
+                             TExtension::UNDEFINED,
+                             kParams_3u_3u_i_i,
+                             4,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("bitfieldInsert(3u;3u;i;i;"),
+                             EOpBitfieldInsert,
+                             false);
+constexpr const TFunction kFunction_bitfieldInsert_4u4uii(TSymbolUniqueId(416),
+                             ImmutableString("bitfieldInsert"),
+                             TExtension::UNDEFINED,
+                             kParams_4u_4u_i_i,
+                             4,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("bitfieldInsert(4u;4u;i;i;"),
+                             EOpBitfieldInsert,
+                             false);
+constexpr const TFunction kFunction_bitfieldReverse_i(TSymbolUniqueId(417),
+                             ImmutableString("bitfieldReverse"),
+                             TExtension::UNDEFINED,
+                             kParams_i,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("bitfieldReverse(i;"),
+                             EOpBitfieldReverse,
+                             false);
+constexpr const TFunction kFunction_bitfieldReverse_2i(TSymbolUniqueId(418),
+                             ImmutableString("bitfieldReverse"),
+                             TExtension::UNDEFINED,
+                             kParams_2i,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("bitfieldReverse(2i;"),
+                             EOpBitfieldReverse,
+                             false);
+constexpr const TFunction kFunction_bitfieldReverse_3i(TSymbolUniqueId(419),
+                             ImmutableString("bitfieldReverse"),
+                             TExtension::UNDEFINED,
+                             kParams_3i,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("bitfieldReverse(3i;"),
+                             EOpBitfieldReverse,
+                             false);
+constexpr const TFunction kFunction_bitfieldReverse_4i(TSymbolUniqueId(420),
+                             ImmutableString("bitfieldReverse"),
+                             TExtension::UNDEFINED,
+                             kParams_4i,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("bitfieldReverse(4i;"),
+                             EOpBitfieldReverse,
+                             false);
+constexpr const TFunction kFunction_bitfieldReverse_u(TSymbolUniqueId(421),
+                             ImmutableString("bitfieldReverse"),
+                             TExtension::UNDEFINED,
+                             kParams_u,
+                             1,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("bitfieldReverse(u;"),
+                             EOpBitfieldReverse,
+                             false);
+constexpr const TFunction kFunction_bitfieldReverse_2u(TSymbolUniqueId(422),
+                             ImmutableString("bitfieldReverse"),
+                             TExtension::UNDEFINED,
+                             kParams_2u,
+                             1,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("bitfieldReverse(2u;"),
+                             EOpBitfieldReverse,
+                             false);
+constexpr const TFunction kFunction_bitfieldReverse_3u(TSymbolUniqueId(423),
+                             ImmutableString("bitfieldReverse"),
+                             TExtension::UNDEFINED,
+                             kParams_3u,
+                             1,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("bitfieldReverse(3u;"),
+                             EOpBitfieldReverse,
+                             false);
+constexpr const TFunction kFunction_bitfieldReverse_4u(TSymbolUniqueId(424),
+                             ImmutableString("bitfieldReverse"),
+                             TExtension::UNDEFINED,
+                             kParams_4u,
+                             1,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("bitfieldReverse(4u;"),
+                             EOpBitfieldReverse,
+                             false);
+constexpr const TFunction kFunction_bitCount_i(TSymbolUniqueId(425),
+                             ImmutableString("bitCount"),
+                             TExtension::UNDEFINED,
+                             kParams_i,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("bitCount(i;"),
+                             EOpBitCount,
+                             false);
+constexpr const TFunction kFunction_bitCount_2i(TSymbolUniqueId(426),
+                             ImmutableString("bitCount"),
+                             TExtension::UNDEFINED,
+                             kParams_2i,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("bitCount(2i;"),
+                             EOpBitCount,
+                             false);
+constexpr const TFunction kFunction_bitCount_3i(TSymbolUniqueId(427),
+                             ImmutableString("bitCount"),
+                             TExtension::UNDEFINED,
+                             kParams_3i,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("bitCount(3i;"),
+                             EOpBitCount,
+                             false);
+constexpr const TFunction kFunction_bitCount_4i(TSymbolUniqueId(428),
+                             ImmutableString("bitCount"),
+                             TExtension::UNDEFINED,
+                             kParams_4i,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("bitCount(4i;"),
+                             EOpBitCount,
+                             false);
+constexpr const TFunction kFunction_bitCount_u(TSymbolUniqueId(429),
+                             ImmutableString("bitCount"),
+                             TExtension::UNDEFINED,
+                             kParams_u,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("bitCount(u;"),
+                             EOpBitCount,
+                             false);
+constexpr const TFunction kFunction_bitCount_2u(TSymbolUniqueId(430),
+                             ImmutableString("bitCount"),
+                             TExtension::UNDEFINED,
+                             kParams_2u,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("bitCount(2u;"),
+                             EOpBitCount,
+                             false);
+constexpr const TFunction kFunction_bitCount_3u(TSymbolUniqueId(431),
+                             ImmutableString("bitCount"),
+                             TExtension::UNDEFINED,
+                             kParams_3u,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("bitCount(3u;"),
+                             EOpBitCount,
+                             false);
+constexpr const TFunction kFunction_bitCount_4u(TSymbolUniqueId(432),
+                             ImmutableString("bitCount"),
+                             TExtension::UNDEFINED,
+                             kParams_4u,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("bitCount(4u;"),
+                             EOpBitCount,
+                             false);
+constexpr const TFunction kFunction_findLSB_i(TSymbolUniqueId(433),
+                             ImmutableString("findLSB"),
+                             TExtension::UNDEFINED,
+                             kParams_i,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("findLSB(i;"),
+                             EOpFindLSB,
+                             false);
+constexpr const TFunction kFunction_findLSB_2i(TSymbolUniqueId(434),
+                             ImmutableString("findLSB"),
+                             TExtension::UNDEFINED,
+                             kParams_2i,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("findLSB(2i;"),
+                             EOpFindLSB,
+                             false);
+constexpr const TFunction kFunction_findLSB_3i(TSymbolUniqueId(435),
+                             ImmutableString("findLSB"),
+                             TExtension::UNDEFINED,
+                             kParams_3i,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("findLSB(3i;"),
+                             EOpFindLSB,
+                             false);
+constexpr const TFunction kFunction_findLSB_4i(TSymbolUniqueId(436),
+                             ImmutableString("findLSB"),
+                             TExtension::UNDEFINED,
+                             kParams_4i,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("findLSB(4i;"),
+                             EOpFindLSB,
+                             false);
+constexpr const TFunction kFunction_findLSB_u(TSymbolUniqueId(437),
+                             ImmutableString("findLSB"),
+                             TExtension::UNDEFINED,
+                             kParams_u,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("findLSB(u;"),
+                             EOpFindLSB,
+                             false);
+constexpr const TFunction kFunction_findLSB_2u(TSymbolUniqueId(438),
+                             ImmutableString("findLSB"),
+                             TExtension::UNDEFINED,
+                             kParams_2u,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("findLSB(2u;"),
+                             EOpFindLSB,
+                             false);
+constexpr const TFunction kFunction_findLSB_3u(TSymbolUniqueId(439),
+                             ImmutableString("findLSB"),
+                             TExtension::UNDEFINED,
+                             kParams_3u,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("findLSB(3u;"),
+                             EOpFindLSB,
+                             false);
+constexpr const TFunction kFunction_findLSB_4u(TSymbolUniqueId(440),
+                             ImmutableString("findLSB"),
+                             TExtension::UNDEFINED,
+                             kParams_4u,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("findLSB(4u;"),
+                             EOpFindLSB,
+                             false);
+constexpr const TFunction kFunction_findMSB_i(TSymbolUniqueId(441),
+                             ImmutableString("findMSB"),
+                             TExtension::UNDEFINED,
+                             kParams_i,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("findMSB(i;"),
+                             EOpFindMSB,
+                             false);
+constexpr const TFunction kFunction_findMSB_2i(TSymbolUniqueId(442),
+                             ImmutableString("findMSB"),
+                             TExtension::UNDEFINED,
+                             kParams_2i,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("findMSB(2i;"),
+                             EOpFindMSB,
+                             false);
+constexpr const TFunction kFunction_findMSB_3i(TSymbolUniqueId(443),
+                             ImmutableString("findMSB"),
+                             TExtension::UNDEFINED,
+                             kParams_3i,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("findMSB(3i;"),
+                             EOpFindMSB,
+                             false);
+constexpr const TFunction kFunction_findMSB_4i(TSymbolUniqueId(444),
+                             ImmutableString("findMSB"),
+                             TExtension::UNDEFINED,
+                             kParams_4i,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("findMSB(4i;"),
+                             EOpFindMSB,
+                             false);
+constexpr const TFunction kFunction_findMSB_u(TSymbolUniqueId(445),
+                             ImmutableString("findMSB"),
+                             TExtension::UNDEFINED,
+                             kParams_u,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("findMSB(u;"),
+                             EOpFindMSB,
+                             false);
+constexpr const TFunction kFunction_findMSB_2u(TSymbolUniqueId(446),
+                             ImmutableString("findMSB"),
+                             TExtension::UNDEFINED,
+                             kParams_2u,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("findMSB(2u;"),
+                             EOpFindMSB,
+                             false);
+constexpr const TFunction kFunction_findMSB_3u(TSymbolUniqueId(447),
+                             ImmutableString("findMSB"),
+                             TExtension::UNDEFINED,
+                             kParams_3u,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("findMSB(3u;"),
+                             EOpFindMSB,
+                             false);
+constexpr const TFunction kFunction_findMSB_4u(TSymbolUniqueId(448),
+                             ImmutableString("findMSB"),
+                             TExtension::UNDEFINED,
+                             kParams_4u,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("findMSB(4u;"),
+                             EOpFindMSB,
+                             false);
+constexpr const TFunction kFunction_uaddCarry_uuu(TSymbolUniqueId(449),
+                             ImmutableString("uaddCarry"),
+                             TExtension::UNDEFINED,
+                             kParams_u_u_ou,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("uaddCarry(u;u;u;"),
+                             EOpUaddCarry,
+                             false);
+constexpr const TFunction kFunction_uaddCarry_2u2u2u(TSymbolUniqueId(450),
+                             ImmutableString("uaddCarry"),
+                             TExtension::UNDEFINED,
+                             kParams_2u_2u_o2u,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("uaddCarry(2u;2u;2u;"),
+                             EOpUaddCarry,
+                             false);
+constexpr const TFunction kFunction_uaddCarry_3u3u3u(TSymbolUniqueId(451),
+                             ImmutableString("uaddCarry"),
+                             TExtension::UNDEFINED,
+                             kParams_3u_3u_o3u,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("uaddCarry(3u;3u;3u;"),
+                             EOpUaddCarry,
+                             false);
+constexpr const TFunction kFunction_uaddCarry_4u4u4u(TSymbolUniqueId(452),
+                             ImmutableString("uaddCarry"),
+                             TExtension::UNDEFINED,
+                             kParams_4u_4u_o4u,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("uaddCarry(4u;4u;4u;"),
+                             EOpUaddCarry,
+                             false);
+constexpr const TFunction kFunction_usubBorrow_uuu(TSymbolUniqueId(453),
+                             ImmutableString("usubBorrow"),
+                             TExtension::UNDEFINED,
+                             kParams_u_u_ou,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("usubBorrow(u;u;u;"),
+                             EOpUsubBorrow,
+                             false);
+constexpr const TFunction kFunction_usubBorrow_2u2u2u(TSymbolUniqueId(454),
+                             ImmutableString("usubBorrow"),
+                             TExtension::UNDEFINED,
+                             kParams_2u_2u_o2u,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("usubBorrow(2u;2u;2u;"),
+                             EOpUsubBorrow,
+                             false);
+constexpr const TFunction kFunction_usubBorrow_3u3u3u(TSymbolUniqueId(455),
+                             ImmutableString("usubBorrow"),
+                             TExtension::UNDEFINED,
+                             kParams_3u_3u_o3u,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("usubBorrow(3u;3u;3u;"),
+                             EOpUsubBorrow,
+                             false);
+constexpr const TFunction kFunction_usubBorrow_4u4u4u(TSymbolUniqueId(456),
+                             ImmutableString("usubBorrow"),
+                             TExtension::UNDEFINED,
+                             kParams_4u_4u_o4u,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("usubBorrow(4u;4u;4u;"),
+                             EOpUsubBorrow,
+                             false);
+constexpr const TFunction kFunction_umulExtended_uuuu(TSymbolUniqueId(457),
+                             ImmutableString("umulExtended"),
+                             TExtension::UNDEFINED,
+                             kParams_u_u_ou_ou,
+                             4,
+                             StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("umulExtended(u;u;u;u;"),
+                             EOpUmulExtended,
+                             false);
+constexpr const TFunction kFunction_umulExtended_2u2u2u2u(TSymbolUniqueId(458),
+                             ImmutableString("umulExtended"),
+                             TExtension::UNDEFINED,
+                             kParams_2u_2u_o2u_o2u,
+                             4,
+                             StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("umulExtended(2u;2u;2u;2u;"),
+                             EOpUmulExtended,
+                             false);
+constexpr const TFunction kFunction_umulExtended_3u3u3u3u(TSymbolUniqueId(459),
+                             ImmutableString("umulExtended"),
+                             TExtension::UNDEFINED,
+                             kParams_3u_3u_o3u_o3u,
+                             4,
+                             StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("umulExtended(3u;3u;3u;3u;"),
+                             EOpUmulExtended,
+                             false);
+constexpr const TFunction kFunction_umulExtended_4u4u4u4u(TSymbolUniqueId(460),
+                             ImmutableString("umulExtended"),
+                             TExtension::UNDEFINED,
+                             kParams_4u_4u_o4u_o4u,
+                             4,
+                             StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("umulExtended(4u;4u;4u;4u;"),
+                             EOpUmulExtended,
+                             false);
+constexpr const TFunction kFunction_imulExtended_iiii(TSymbolUniqueId(461),
+                             ImmutableString("imulExtended"),
+                             TExtension::UNDEFINED,
+                             kParams_i_i_oi_oi,
+                             4,
+                             StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("imulExtended(i;i;i;i;"),
+                             EOpImulExtended,
+                             false);
+constexpr const TFunction kFunction_imulExtended_2i2i2i2i(TSymbolUniqueId(462),
+                             ImmutableString("imulExtended"),
+                             TExtension::UNDEFINED,
+                             kParams_2i_2i_o2i_o2i,
+                             4,
+                             StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("imulExtended(2i;2i;2i;2i;"),
+                             EOpImulExtended,
+                             false);
+constexpr const TFunction kFunction_imulExtended_3i3i3i3i(TSymbolUniqueId(463),
+                             ImmutableString("imulExtended"),
+                             TExtension::UNDEFINED,
+                             kParams_3i_3i_o3i_o3i,
+                             4,
+                             StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("imulExtended(3i;3i;3i;3i;"),
+                             EOpImulExtended,
+                             false);
+constexpr const TFunction kFunction_imulExtended_4i4i4i4i(TSymbolUniqueId(464),
+                             ImmutableString("imulExtended"),
+                             TExtension::UNDEFINED,
+                             kParams_4i_4i_o4i_o4i,
+                             4,
+                             StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("imulExtended(4i;4i;4i;4i;"),
+                             EOpImulExtended,
+                             false);
+constexpr const TFunction kFunction_texture2D_s22f(TSymbolUniqueId(465),
+                             ImmutableString("texture2D"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_2f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture2D(s2;2f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture2DProj_s23f(TSymbolUniqueId(466),
+                             ImmutableString("texture2DProj"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_3f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture2DProj(s2;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture2DProj_s24f(TSymbolUniqueId(467),
+                             ImmutableString("texture2DProj"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_4f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture2DProj(s2;4f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureCube_sC3f(TSymbolUniqueId(468),
+                             ImmutableString("textureCube"),
+                             TExtension::UNDEFINED,
+                             kParams_sC_3f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureCube(sC;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture2D_sX2f(TSymbolUniqueId(469),
+                             ImmutableString("texture2D"),
+                             TExtension::UNDEFINED,
+                             kParams_sX_2f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture2D(sX;2f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture2DProj_sX3f(TSymbolUniqueId(470),
+                             ImmutableString("texture2DProj"),
+                             TExtension::UNDEFINED,
+                             kParams_sX_3f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture2DProj(sX;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture2DProj_sX4f(TSymbolUniqueId(471),
+                             ImmutableString("texture2DProj"),
+                             TExtension::UNDEFINED,
+                             kParams_sX_4f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture2DProj(sX;4f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture2DRect_sR2f(TSymbolUniqueId(472),
+                             ImmutableString("texture2DRect"),
+                             TExtension::ARB_texture_rectangle,
+                             kParams_sR_2f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture2DRect(sR;2f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture2DRectProj_sR3f(TSymbolUniqueId(473),
+                             ImmutableString("texture2DRectProj"),
+                             TExtension::ARB_texture_rectangle,
+                             kParams_sR_3f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture2DRectProj(sR;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture2DRectProj_sR4f(TSymbolUniqueId(474),
+                             ImmutableString("texture2DRectProj"),
+                             TExtension::ARB_texture_rectangle,
+                             kParams_sR_4f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture2DRectProj(sR;4f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture2DGradEXT_s22f2f2f(TSymbolUniqueId(475),
+                             ImmutableString("texture2DGradEXT"),
+                             TExtension::EXT_shader_texture_lod,
+                             kParams_s2_2f_2f_2f,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture2DGradEXT(s2;2f;2f;2f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture2DProjGradEXT_s23f2f2f(TSymbolUniqueId(476),
+                             ImmutableString("texture2DProjGradEXT"),
+                             TExtension::EXT_shader_texture_lod,
+                             kParams_s2_3f_2f_2f,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture2DProjGradEXT(s2;3f;2f;2f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture2DProjGradEXT_s24f2f2f(TSymbolUniqueId(477),
+                             ImmutableString("texture2DProjGradEXT"),
+                             TExtension::EXT_shader_texture_lod,
+                             kParams_s2_4f_2f_2f,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture2DProjGradEXT(s2;4f;2f;2f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureCubeGradEXT_sC3f3f3f(TSymbolUniqueId(478),
+                             ImmutableString("textureCubeGradEXT"),
+                             TExtension::EXT_shader_texture_lod,
+                             kParams_sC_3f_3f_3f,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureCubeGradEXT(sC;3f;3f;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture2D_s22ff(TSymbolUniqueId(479),
+                             ImmutableString("texture2D"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_2f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture2D(s2;2f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture2DProj_s23ff(TSymbolUniqueId(480),
+                             ImmutableString("texture2DProj"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_3f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture2DProj(s2;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture2DProj_s24ff(TSymbolUniqueId(481),
+                             ImmutableString("texture2DProj"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_4f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture2DProj(s2;4f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureCube_sC3ff(TSymbolUniqueId(482),
+                             ImmutableString("textureCube"),
+                             TExtension::UNDEFINED,
+                             kParams_sC_3f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureCube(sC;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_dFdx_f(TSymbolUniqueId(483),
+                             ImmutableString("dFdx"),
+                             TExtension::OES_standard_derivatives,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("dFdx(f;"),
+                             EOpDFdx,
+                             false);
+constexpr const TFunction kFunction_dFdx_2f(TSymbolUniqueId(484),
+                             ImmutableString("dFdx"),
+                             TExtension::OES_standard_derivatives,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("dFdx(2f;"),
+                             EOpDFdx,
+                             false);
+constexpr const TFunction kFunction_dFdx_3f(TSymbolUniqueId(485),
+                             ImmutableString("dFdx"),
+                             TExtension::OES_standard_derivatives,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("dFdx(3f;"),
+                             EOpDFdx,
+                             false);
+constexpr const TFunction kFunction_dFdx_4f(TSymbolUniqueId(486),
+                             ImmutableString("dFdx"),
+                             TExtension::OES_standard_derivatives,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("dFdx(4f;"),
+                             EOpDFdx,
+                             false);
+constexpr const TFunction kFunction_dFdy_f(TSymbolUniqueId(487),
+                             ImmutableString("dFdy"),
+                             TExtension::OES_standard_derivatives,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("dFdy(f;"),
+                             EOpDFdy,
+                             false);
+constexpr const TFunction kFunction_dFdy_2f(TSymbolUniqueId(488),
+                             ImmutableString("dFdy"),
+                             TExtension::OES_standard_derivatives,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("dFdy(2f;"),
+                             EOpDFdy,
+                             false);
+constexpr const TFunction kFunction_dFdy_3f(TSymbolUniqueId(489),
+                             ImmutableString("dFdy"),
+                             TExtension::OES_standard_derivatives,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("dFdy(3f;"),
+                             EOpDFdy,
+                             false);
+constexpr const TFunction kFunction_dFdy_4f(TSymbolUniqueId(490),
+                             ImmutableString("dFdy"),
+                             TExtension::OES_standard_derivatives,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("dFdy(4f;"),
+                             EOpDFdy,
+                             false);
+constexpr const TFunction kFunction_fwidth_f(TSymbolUniqueId(491),
+                             ImmutableString("fwidth"),
+                             TExtension::OES_standard_derivatives,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("fwidth(f;"),
+                             EOpFwidth,
+                             false);
+constexpr const TFunction kFunction_fwidth_2f(TSymbolUniqueId(492),
+                             ImmutableString("fwidth"),
+                             TExtension::OES_standard_derivatives,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("fwidth(2f;"),
+                             EOpFwidth,
+                             false);
+constexpr const TFunction kFunction_fwidth_3f(TSymbolUniqueId(493),
+                             ImmutableString("fwidth"),
+                             TExtension::OES_standard_derivatives,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("fwidth(3f;"),
+                             EOpFwidth,
+                             false);
+constexpr const TFunction kFunction_fwidth_4f(TSymbolUniqueId(494),
+                             ImmutableString("fwidth"),
+                             TExtension::OES_standard_derivatives,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("fwidth(4f;"),
+                             EOpFwidth,
+                             false);
+constexpr const TFunction kFunction_texture2DLodEXT_s22ff(TSymbolUniqueId(495),
+                             ImmutableString("texture2DLodEXT"),
+                             TExtension::EXT_shader_texture_lod,
+                             kParams_s2_2f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture2DLodEXT(s2;2f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture2DProjLodEXT_s23ff(TSymbolUniqueId(496),
+                             ImmutableString("texture2DProjLodEXT"),
+                             TExtension::EXT_shader_texture_lod,
+                             kParams_s2_3f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture2DProjLodEXT(s2;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture2DProjLodEXT_s24ff(TSymbolUniqueId(497),
+                             ImmutableString("texture2DProjLodEXT"),
+                             TExtension::EXT_shader_texture_lod,
+                             kParams_s2_4f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture2DProjLodEXT(s2;4f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureCubeLodEXT_sC3ff(TSymbolUniqueId(498),
+                             ImmutableString("textureCubeLodEXT"),
+                             TExtension::EXT_shader_texture_lod,
+                             kParams_sC_3f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureCubeLodEXT(sC;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture2DLod_s22ff(TSymbolUniqueId(499),
+                             ImmutableString("texture2DLod"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_2f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture2DLod(s2;2f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture2DProjLod_s23ff(TSymbolUniqueId(500),
+                             ImmutableString("texture2DProjLod"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_3f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture2DProjLod(s2;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture2DProjLod_s24ff(TSymbolUniqueId(501),
+                             ImmutableString("texture2DProjLod"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_4f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture2DProjLod(s2;4f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureCubeLod_sC3ff(TSymbolUniqueId(502),
+                             ImmutableString("textureCubeLod"),
+                             TExtension::UNDEFINED,
+                             kParams_sC_3f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureCubeLod(sC;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_s22f(TSymbolUniqueId(503),
+                             ImmutableString("texture"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_2f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture(s2;2f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_is22f(TSymbolUniqueId(504),
+                             ImmutableString("texture"),
+                             TExtension::UNDEFINED,
+                             kParams_is2_2f,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture(is2;2f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_us22f(TSymbolUniqueId(505),
+                             ImmutableString("texture"),
+                             TExtension::UNDEFINED,
+                             kParams_us2_2f,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture(us2;2f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_s33f(TSymbolUniqueId(506),
+                             ImmutableString("texture"),
+                             TExtension::UNDEFINED,
+                             kParams_s3_3f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture(s3;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_is33f(TSymbolUniqueId(507),
+                             ImmutableString("texture"),
+                             TExtension::UNDEFINED,
+                             kParams_is3_3f,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture(is3;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_us33f(TSymbolUniqueId(508),
+                             ImmutableString("texture"),
+                             TExtension::UNDEFINED,
+                             kParams_us3_3f,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture(us3;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_sC3f(TSymbolUniqueId(509),
+                             ImmutableString("texture"),
+                             TExtension::UNDEFINED,
+                             kParams_sC_3f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture(sC;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_isC3f(TSymbolUniqueId(510),
+                             ImmutableString("texture"),
+                             TExtension::UNDEFINED,
+                             kParams_isC_3f,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture(isC;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_usC3f(TSymbolUniqueId(511),
+                             ImmutableString("texture"),
+                             TExtension::UNDEFINED,
+                             kParams_usC_3f,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture(usC;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_sA3f(TSymbolUniqueId(512),
+                             ImmutableString("texture"),
+                             TExtension::UNDEFINED,
+                             kParams_sA_3f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture(sA;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_isA3f(TSymbolUniqueId(513),
+                             ImmutableString("texture"),
+                             TExtension::UNDEFINED,
+                             kParams_isA_3f,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture(isA;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_usA3f(TSymbolUniqueId(514),
+                             ImmutableString("texture"),
+                             TExtension::UNDEFINED,
+                             kParams_usA_3f,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture(usA;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProj_s23f(TSymbolUniqueId(515),
+                             ImmutableString("textureProj"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_3f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProj(s2;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProj_is23f(TSymbolUniqueId(516),
+                             ImmutableString("textureProj"),
+                             TExtension::UNDEFINED,
+                             kParams_is2_3f,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProj(is2;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProj_us23f(TSymbolUniqueId(517),
+                             ImmutableString("textureProj"),
+                             TExtension::UNDEFINED,
+                             kParams_us2_3f,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProj(us2;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProj_s24f(TSymbolUniqueId(518),
+                             ImmutableString("textureProj"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_4f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProj(s2;4f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProj_is24f(TSymbolUniqueId(519),
+                             ImmutableString("textureProj"),
+                             TExtension::UNDEFINED,
+                             kParams_is2_4f,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProj(is2;4f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProj_us24f(TSymbolUniqueId(520),
+                             ImmutableString("textureProj"),
+                             TExtension::UNDEFINED,
+                             kParams_us2_4f,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProj(us2;4f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProj_s34f(TSymbolUniqueId(521),
+                             ImmutableString("textureProj"),
+                             TExtension::UNDEFINED,
+                             kParams_s3_4f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProj(s3;4f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProj_is34f(TSymbolUniqueId(522),
+                             ImmutableString("textureProj"),
+                             TExtension::UNDEFINED,
+                             kParams_is3_4f,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProj(is3;4f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProj_us34f(TSymbolUniqueId(523),
+                             ImmutableString("textureProj"),
+                             TExtension::UNDEFINED,
+                             kParams_us3_4f,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProj(us3;4f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureLod_s22ff(TSymbolUniqueId(524),
+                             ImmutableString("textureLod"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_2f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureLod(s2;2f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureLod_is22ff(TSymbolUniqueId(525),
+                             ImmutableString("textureLod"),
+                             TExtension::UNDEFINED,
+                             kParams_is2_2f_f,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureLod(is2;2f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureLod_us22ff(TSymbolUniqueId(526),
+                             ImmutableString("textureLod"),
+                             TExtension::UNDEFINED,
+                             kParams_us2_2f_f,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureLod(us2;2f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureLod_s33ff(TSymbolUniqueId(527),
+                             ImmutableString("textureLod"),
+                             TExtension::UNDEFINED,
+                             kParams_s3_3f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureLod(s3;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureLod_is33ff(TSymbolUniqueId(528),
+                             ImmutableString("textureLod"),
+                             TExtension::UNDEFINED,
+                             kParams_is3_3f_f,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureLod(is3;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureLod_us33ff(TSymbolUniqueId(529),
+                             ImmutableString("textureLod"),
+                             TExtension::UNDEFINED,
+                             kParams_us3_3f_f,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureLod(us3;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureLod_sC3ff(TSymbolUniqueId(530),
+                             ImmutableString("textureLod"),
+                             TExtension::UNDEFINED,
+                             kParams_sC_3f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureLod(sC;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureLod_isC3ff(TSymbolUniqueId(531),
+                             ImmutableString("textureLod"),
+                             TExtension::UNDEFINED,
+                             kParams_isC_3f_f,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureLod(isC;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureLod_usC3ff(TSymbolUniqueId(532),
+                             ImmutableString("textureLod"),
+                             TExtension::UNDEFINED,
+                             kParams_usC_3f_f,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureLod(usC;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureLod_sA3ff(TSymbolUniqueId(533),
+                             ImmutableString("textureLod"),
+                             TExtension::UNDEFINED,
+                             kParams_sA_3f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureLod(sA;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureLod_isA3ff(TSymbolUniqueId(534),
+                             ImmutableString("textureLod"),
+                             TExtension::UNDEFINED,
+                             kParams_isA_3f_f,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureLod(isA;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureLod_usA3ff(TSymbolUniqueId(535),
+                             ImmutableString("textureLod"),
+                             TExtension::UNDEFINED,
+                             kParams_usA_3f_f,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureLod(usA;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_sX2f(TSymbolUniqueId(536),
+                             ImmutableString("texture"),
+                             TExtension::OES_EGL_image_external_essl3,
+                             kParams_sX_2f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture(sX;2f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProj_sX3f(TSymbolUniqueId(537),
+                             ImmutableString("textureProj"),
+                             TExtension::OES_EGL_image_external_essl3,
+                             kParams_sX_3f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProj(sX;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProj_sX4f(TSymbolUniqueId(538),
+                             ImmutableString("textureProj"),
+                             TExtension::OES_EGL_image_external_essl3,
+                             kParams_sX_4f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProj(sX;4f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_sY2f(TSymbolUniqueId(539),
+                             ImmutableString("texture"),
+                             TExtension::EXT_YUV_target,
+                             kParams_sY_2f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture(sY;2f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProj_sY3f(TSymbolUniqueId(540),
+                             ImmutableString("textureProj"),
+                             TExtension::EXT_YUV_target,
+                             kParams_sY_3f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProj(sY;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProj_sY4f(TSymbolUniqueId(541),
+                             ImmutableString("textureProj"),
+                             TExtension::EXT_YUV_target,
+                             kParams_sY_4f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProj(sY;4f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_rgb_2_yuv_3fy(TSymbolUniqueId(542),
+                             ImmutableString("rgb_2_yuv"),
+                             TExtension::EXT_YUV_target,
+                             kParams_3f_y,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("rgb_2_yuv(3f;y;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_yuv_2_rgb_3fy(TSymbolUniqueId(543),
+                             ImmutableString("yuv_2_rgb"),
+                             TExtension::EXT_YUV_target,
+                             kParams_3f_y,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("yuv_2_rgb(3f;y;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_s22ff(TSymbolUniqueId(544),
+                             ImmutableString("texture"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_2f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture(s2;2f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_is22ff(TSymbolUniqueId(545),
+                             ImmutableString("texture"),
+                             TExtension::UNDEFINED,
+                             kParams_is2_2f_f,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture(is2;2f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_us22ff(TSymbolUniqueId(546),
+                             ImmutableString("texture"),
+                             TExtension::UNDEFINED,
+                             kParams_us2_2f_f,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture(us2;2f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_s33ff(TSymbolUniqueId(547),
+                             ImmutableString("texture"),
+                             TExtension::UNDEFINED,
+                             kParams_s3_3f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture(s3;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_is33ff(TSymbolUniqueId(548),
+                             ImmutableString("texture"),
+                             TExtension::UNDEFINED,
+                             kParams_is3_3f_f,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture(is3;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_us33ff(TSymbolUniqueId(549),
+                             ImmutableString("texture"),
+                             TExtension::UNDEFINED,
+                             kParams_us3_3f_f,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture(us3;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_sC3ff(TSymbolUniqueId(550),
+                             ImmutableString("texture"),
+                             TExtension::UNDEFINED,
+                             kParams_sC_3f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture(sC;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_isC3ff(TSymbolUniqueId(551),
+                             ImmutableString("texture"),
+                             TExtension::UNDEFINED,
+                             kParams_isC_3f_f,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture(isC;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_usC3ff(TSymbolUniqueId(552),
+                             ImmutableString("texture"),
+                             TExtension::UNDEFINED,
+                             kParams_usC_3f_f,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture(usC;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_sA3ff(TSymbolUniqueId(553),
+                             ImmutableString("texture"),
+                             TExtension::UNDEFINED,
+                             kParams_sA_3f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture(sA;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_isA3ff(TSymbolUniqueId(554),
+                             ImmutableString("texture"),
+                             TExtension::UNDEFINED,
+                             kParams_isA_3f_f,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture(isA;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_usA3ff(TSymbolUniqueId(555),
+                             ImmutableString("texture"),
+                             TExtension::UNDEFINED,
+                             kParams_usA_3f_f,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture(usA;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProj_s23ff(TSymbolUniqueId(556),
+                             ImmutableString("textureProj"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_3f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProj(s2;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProj_is23ff(TSymbolUniqueId(557),
+                             ImmutableString("textureProj"),
+                             TExtension::UNDEFINED,
+                             kParams_is2_3f_f,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProj(is2;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProj_us23ff(TSymbolUniqueId(558),
+                             ImmutableString("textureProj"),
+                             TExtension::UNDEFINED,
+                             kParams_us2_3f_f,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProj(us2;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProj_s24ff(TSymbolUniqueId(559),
+                             ImmutableString("textureProj"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_4f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProj(s2;4f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProj_is24ff(TSymbolUniqueId(560),
+                             ImmutableString("textureProj"),
+                             TExtension::UNDEFINED,
+                             kParams_is2_4f_f,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProj(is2;4f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProj_us24ff(TSymbolUniqueId(561),
+                             ImmutableString("textureProj"),
+                             TExtension::UNDEFINED,
+                             kParams_us2_4f_f,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProj(us2;4f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProj_s34ff(TSymbolUniqueId(562),
+                             ImmutableString("textureProj"),
+                             TExtension::UNDEFINED,
+                             kParams_s3_4f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProj(s3;4f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProj_is34ff(TSymbolUniqueId(563),
+                             ImmutableString("textureProj"),
+                             TExtension::UNDEFINED,
+                             kParams_is3_4f_f,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProj(is3;4f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProj_us34ff(TSymbolUniqueId(564),
+                             ImmutableString("textureProj"),
+                             TExtension::UNDEFINED,
+                             kParams_us3_4f_f,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProj(us3;4f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_sX2ff(TSymbolUniqueId(565),
+                             ImmutableString("texture"),
+                             TExtension::OES_EGL_image_external_essl3,
+                             kParams_sX_2f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture(sX;2f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProj_sX3ff(TSymbolUniqueId(566),
+                             ImmutableString("textureProj"),
+                             TExtension::OES_EGL_image_external_essl3,
+                             kParams_sX_3f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProj(sX;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProj_sX4ff(TSymbolUniqueId(567),
+                             ImmutableString("textureProj"),
+                             TExtension::OES_EGL_image_external_essl3,
+                             kParams_sX_4f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProj(sX;4f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_sY2ff(TSymbolUniqueId(568),
+                             ImmutableString("texture"),
+                             TExtension::EXT_YUV_target,
+                             kParams_sY_2f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texture(sY;2f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProj_sY3ff(TSymbolUniqueId(569),
+                             ImmutableString("textureProj"),
+                             TExtension::EXT_YUV_target,
+                             kParams_sY_3f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProj(sY;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProj_sY4ff(TSymbolUniqueId(570),
+                             ImmutableString("textureProj"),
+                             TExtension::EXT_YUV_target,
+                             kParams_sY_4f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProj(sY;4f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_s2s3f(TSymbolUniqueId(571),
+                             ImmutableString("texture"),
+                             TExtension::UNDEFINED,
+                             kParams_s2s_3f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("texture(s2s;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_sCs4f(TSymbolUniqueId(572),
+                             ImmutableString("texture"),
+                             TExtension::UNDEFINED,
+                             kParams_sCs_4f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("texture(sCs;4f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_sAs4f(TSymbolUniqueId(573),
+                             ImmutableString("texture"),
+                             TExtension::UNDEFINED,
+                             kParams_sAs_4f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("texture(sAs;4f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProj_s2s4f(TSymbolUniqueId(574),
+                             ImmutableString("textureProj"),
+                             TExtension::UNDEFINED,
+                             kParams_s2s_4f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("textureProj(s2s;4f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureLod_s2s3ff(TSymbolUniqueId(575),
+                             ImmutableString("textureLod"),
+                             TExtension::UNDEFINED,
+                             kParams_s2s_3f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("textureLod(s2s;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_s2s3ff(TSymbolUniqueId(576),
+                             ImmutableString("texture"),
+                             TExtension::UNDEFINED,
+                             kParams_s2s_3f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("texture(s2s;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texture_sCs4ff(TSymbolUniqueId(577),
+                             ImmutableString("texture"),
+                             TExtension::UNDEFINED,
+                             kParams_sCs_4f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("texture(sCs;4f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProj_s2s4ff(TSymbolUniqueId(578),
+                             ImmutableString("textureProj"),
+                             TExtension::UNDEFINED,
+                             kParams_s2s_4f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("textureProj(s2s;4f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureSize_s2i(TSymbolUniqueId(579),
+                             ImmutableString("textureSize"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("textureSize(s2;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureSize_is2i(TSymbolUniqueId(580),
+                             ImmutableString("textureSize"),
+                             TExtension::UNDEFINED,
+                             kParams_is2_i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("textureSize(is2;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureSize_us2i(TSymbolUniqueId(581),
+                             ImmutableString("textureSize"),
+                             TExtension::UNDEFINED,
+                             kParams_us2_i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("textureSize(us2;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureSize_s3i(TSymbolUniqueId(582),
+                             ImmutableString("textureSize"),
+                             TExtension::UNDEFINED,
+                             kParams_s3_i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("textureSize(s3;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureSize_is3i(TSymbolUniqueId(583),
+                             ImmutableString("textureSize"),
+                             TExtension::UNDEFINED,
+                             kParams_is3_i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("textureSize(is3;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureSize_us3i(TSymbolUniqueId(584),
+                             ImmutableString("textureSize"),
+                             TExtension::UNDEFINED,
+                             kParams_us3_i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("textureSize(us3;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureSize_sCi(TSymbolUniqueId(585),
+                             ImmutableString("textureSize"),
+                             TExtension::UNDEFINED,
+                             kParams_sC_i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("textureSize(sC;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureSize_isCi(TSymbolUniqueId(586),
+                             ImmutableString("textureSize"),
+                             TExtension::UNDEFINED,
+                             kParams_isC_i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("textureSize(isC;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureSize_usCi(TSymbolUniqueId(587),
+                             ImmutableString("textureSize"),
+                             TExtension::UNDEFINED,
+                             kParams_usC_i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("textureSize(usC;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureSize_sAi(TSymbolUniqueId(588),
+                             ImmutableString("textureSize"),
+                             TExtension::UNDEFINED,
+                             kParams_sA_i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("textureSize(sA;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureSize_isAi(TSymbolUniqueId(589),
+                             ImmutableString("textureSize"),
+                             TExtension::UNDEFINED,
+                             kParams_isA_i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("textureSize(isA;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureSize_usAi(TSymbolUniqueId(590),
+                             ImmutableString("textureSize"),
+                             TExtension::UNDEFINED,
+                             kParams_usA_i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("textureSize(usA;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureSize_s2si(TSymbolUniqueId(591),
+                             ImmutableString("textureSize"),
+                             TExtension::UNDEFINED,
+                             kParams_s2s_i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("textureSize(s2s;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureSize_sCsi(TSymbolUniqueId(592),
+                             ImmutableString("textureSize"),
+                             TExtension::UNDEFINED,
+                             kParams_sCs_i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("textureSize(sCs;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureSize_sAsi(TSymbolUniqueId(593),
+                             ImmutableString("textureSize"),
+                             TExtension::UNDEFINED,
+                             kParams_sAs_i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("textureSize(sAs;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureSize_sM(TSymbolUniqueId(594),
+                             ImmutableString("textureSize"),
+                             TExtension::UNDEFINED,
+                             kParams_sM,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("textureSize(sM;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureSize_isM(TSymbolUniqueId(595),
+                             ImmutableString("textureSize"),
+                             TExtension::UNDEFINED,
+                             kParams_isM,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("textureSize(isM;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureSize_usM(TSymbolUniqueId(596),
+                             ImmutableString("textureSize"),
+                             TExtension::UNDEFINED,
+                             kParams_usM,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("textureSize(usM;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureSize_sXi(TSymbolUniqueId(597),
+                             ImmutableString("textureSize"),
+                             TExtension::OES_EGL_image_external_essl3,
+                             kParams_sX_i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("textureSize(sX;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureSize_sYi(TSymbolUniqueId(598),
+                             ImmutableString("textureSize"),
+                             TExtension::EXT_YUV_target,
+                             kParams_sY_i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("textureSize(sY;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_dFdx_f_ESSL3(TSymbolUniqueId(599),
+                             ImmutableString("dFdx"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("dFdx(f;"),
+                             EOpDFdx,
+                             false);
+constexpr const TFunction kFunction_dFdx_2f_ESSL3(TSymbolUniqueId(600),
+                             ImmutableString("dFdx"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("dFdx(2f;"),
+                             EOpDFdx,
+                             false);
+constexpr const TFunction kFunction_dFdx_3f_ESSL3(TSymbolUniqueId(601),
+                             ImmutableString("dFdx"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("dFdx(3f;"),
+                             EOpDFdx,
+                             false);
+constexpr const TFunction kFunction_dFdx_4f_ESSL3(TSymbolUniqueId(602),
+                             ImmutableString("dFdx"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("dFdx(4f;"),
+                             EOpDFdx,
+                             false);
+constexpr const TFunction kFunction_dFdy_f_ESSL3(TSymbolUniqueId(603),
+                             ImmutableString("dFdy"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("dFdy(f;"),
+                             EOpDFdy,
+                             false);
+constexpr const TFunction kFunction_dFdy_2f_ESSL3(TSymbolUniqueId(604),
+                             ImmutableString("dFdy"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("dFdy(2f;"),
+                             EOpDFdy,
+                             false);
+constexpr const TFunction kFunction_dFdy_3f_ESSL3(TSymbolUniqueId(605),
+                             ImmutableString("dFdy"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("dFdy(3f;"),
+                             EOpDFdy,
+                             false);
+constexpr const TFunction kFunction_dFdy_4f_ESSL3(TSymbolUniqueId(606),
+                             ImmutableString("dFdy"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("dFdy(4f;"),
+                             EOpDFdy,
+                             false);
+constexpr const TFunction kFunction_fwidth_f_ESSL3(TSymbolUniqueId(607),
+                             ImmutableString("fwidth"),
+                             TExtension::UNDEFINED,
+                             kParams_f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("fwidth(f;"),
+                             EOpFwidth,
+                             false);
+constexpr const TFunction kFunction_fwidth_2f_ESSL3(TSymbolUniqueId(608),
+                             ImmutableString("fwidth"),
+                             TExtension::UNDEFINED,
+                             kParams_2f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("fwidth(2f;"),
+                             EOpFwidth,
+                             false);
+constexpr const TFunction kFunction_fwidth_3f_ESSL3(TSymbolUniqueId(609),
+                             ImmutableString("fwidth"),
+                             TExtension::UNDEFINED,
+                             kParams_3f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("fwidth(3f;"),
+                             EOpFwidth,
+                             false);
+constexpr const TFunction kFunction_fwidth_4f_ESSL3(TSymbolUniqueId(610),
+                             ImmutableString("fwidth"),
+                             TExtension::UNDEFINED,
+                             kParams_4f,
+                             1,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("fwidth(4f;"),
+                             EOpFwidth,
+                             false);
+constexpr const TFunction kFunction_textureOffset_s22f2i(TSymbolUniqueId(611),
+                             ImmutableString("textureOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_2f_2i,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureOffset(s2;2f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureOffset_is22f2i(TSymbolUniqueId(612),
+                             ImmutableString("textureOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_is2_2f_2i,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureOffset(is2;2f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureOffset_us22f2i(TSymbolUniqueId(613),
+                             ImmutableString("textureOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_us2_2f_2i,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureOffset(us2;2f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureOffset_s33f3i(TSymbolUniqueId(614),
+                             ImmutableString("textureOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s3_3f_3i,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureOffset(s3;3f;3i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureOffset_is33f3i(TSymbolUniqueId(615),
+                             ImmutableString("textureOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_is3_3f_3i,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureOffset(is3;3f;3i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureOffset_us33f3i(TSymbolUniqueId(616),
+                             ImmutableString("textureOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_us3_3f_3i,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureOffset(us3;3f;3i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureOffset_s2s3f2i(TSymbolUniqueId(617),
+                             ImmutableString("textureOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s2s_3f_2i,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("textureOffset(s2s;3f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureOffset_sA3f2i(TSymbolUniqueId(618),
+                             ImmutableString("textureOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_sA_3f_2i,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureOffset(sA;3f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureOffset_isA3f2i(TSymbolUniqueId(619),
+                             ImmutableString("textureOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_isA_3f_2i,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureOffset(isA;3f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureOffset_usA3f2i(TSymbolUniqueId(620),
+                             ImmutableString("textureOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_usA_3f_2i,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureOffset(usA;3f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureOffset_s22f2if(TSymbolUniqueId(621),
+                             ImmutableString("textureOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_2f_2i_f,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureOffset(s2;2f;2i;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureOffset_is22f2if(TSymbolUniqueId(622),
+                             ImmutableString("textureOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_is2_2f_2i_f,
+                             4,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureOffset(is2;2f;2i;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureOffset_us22f2if(TSymbolUniqueId(623),
+                             ImmutableString("textureOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_us2_2f_2i_f,
+                             4,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureOffset(us2;2f;2i;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureOffset_s33f3if(TSymbolUniqueId(624),
+                             ImmutableString("textureOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s3_3f_3i_f,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureOffset(s3;3f;3i;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureOffset_is33f3if(TSymbolUniqueId(625),
+                             ImmutableString("textureOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_is3_3f_3i_f,
+                             4,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureOffset(is3;3f;3i;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureOffset_us33f3if(TSymbolUniqueId(626),
+                             ImmutableString("textureOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_us3_3f_3i_f,
+                             4,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureOffset(us3;3f;3i;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureOffset_s2s3f2if(TSymbolUniqueId(627),
+                             ImmutableString("textureOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s2s_3f_2i_f,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("textureOffset(s2s;3f;2i;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureOffset_sA3f2if(TSymbolUniqueId(628),
+                             ImmutableString("textureOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_sA_3f_2i_f,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureOffset(sA;3f;2i;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureOffset_isA3f2if(TSymbolUniqueId(629),
+                             ImmutableString("textureOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_isA_3f_2i_f,
+                             4,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureOffset(isA;3f;2i;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureOffset_usA3f2if(TSymbolUniqueId(630),
+                             ImmutableString("textureOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_usA_3f_2i_f,
+                             4,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureOffset(usA;3f;2i;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjOffset_s23f2i(TSymbolUniqueId(631),
+                             ImmutableString("textureProjOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_3f_2i,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjOffset(s2;3f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjOffset_is23f2i(TSymbolUniqueId(632),
+                             ImmutableString("textureProjOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_is2_3f_2i,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjOffset(is2;3f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjOffset_us23f2i(TSymbolUniqueId(633),
+                             ImmutableString("textureProjOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_us2_3f_2i,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjOffset(us2;3f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjOffset_s24f2i(TSymbolUniqueId(634),
+                             ImmutableString("textureProjOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_4f_2i,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjOffset(s2;4f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjOffset_is24f2i(TSymbolUniqueId(635),
+                             ImmutableString("textureProjOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_is2_4f_2i,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjOffset(is2;4f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjOffset_us24f2i(TSymbolUniqueId(636),
+                             ImmutableString("textureProjOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_us2_4f_2i,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjOffset(us2;4f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjOffset_s34f3i(TSymbolUniqueId(637),
+                             ImmutableString("textureProjOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s3_4f_3i,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjOffset(s3;4f;3i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjOffset_is34f3i(TSymbolUniqueId(638),
+                             ImmutableString("textureProjOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_is3_4f_3i,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjOffset(is3;4f;3i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjOffset_us34f3i(TSymbolUniqueId(639),
+                             ImmutableString("textureProjOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_us3_4f_3i,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjOffset(us3;4f;3i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjOffset_s2s4f2i(TSymbolUniqueId(640),
+                             ImmutableString("textureProjOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s2s_4f_2i,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("textureProjOffset(s2s;4f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjOffset_s23f2if(TSymbolUniqueId(641),
+                             ImmutableString("textureProjOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_3f_2i_f,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjOffset(s2;3f;2i;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjOffset_is23f2if(TSymbolUniqueId(642),
+                             ImmutableString("textureProjOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_is2_3f_2i_f,
+                             4,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjOffset(is2;3f;2i;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjOffset_us23f2if(TSymbolUniqueId(643),
+                             ImmutableString("textureProjOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_us2_3f_2i_f,
+                             4,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjOffset(us2;3f;2i;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjOffset_s24f2if(TSymbolUniqueId(644),
+                             ImmutableString("textureProjOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_4f_2i_f,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjOffset(s2;4f;2i;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjOffset_is24f2if(TSymbolUniqueId(645),
+                             ImmutableString("textureProjOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_is2_4f_2i_f,
+                             4,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjOffset(is2;4f;2i;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjOffset_us24f2if(TSymbolUniqueId(646),
+                             ImmutableString("textureProjOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_us2_4f_2i_f,
+                             4,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjOffset(us2;4f;2i;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjOffset_s34f3if(TSymbolUniqueId(647),
+                             ImmutableString("textureProjOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s3_4f_3i_f,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjOffset(s3;4f;3i;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjOffset_is34f3if(TSymbolUniqueId(648),
+                             ImmutableString("textureProjOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_is3_4f_3i_f,
+                             4,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjOffset(is3;4f;3i;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjOffset_us34f3if(TSymbolUniqueId(649),
+                             ImmutableString("textureProjOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_us3_4f_3i_f,
+                             4,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjOffset(us3;4f;3i;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjOffset_s2s4f2if(TSymbolUniqueId(650),
+                             ImmutableString("textureProjOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s2s_4f_2i_f,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("textureProjOffset(s2s;4f;2i;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureLodOffset_s22ff2i(TSymbolUniqueId(651),
+                             ImmutableString("textureLodOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_2f_f_2i,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureLodOffset(s2;2f;f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureLodOffset_is22ff2i(TSymbolUniqueId(652),
+                             ImmutableString("textureLodOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_is2_2f_f_2i,
+                             4,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureLodOffset(is2;2f;f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureLodOffset_us22ff2i(TSymbolUniqueId(653),
+                             ImmutableString("textureLodOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_us2_2f_f_2i,
+                             4,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureLodOffset(us2;2f;f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureLodOffset_s33ff3i(TSymbolUniqueId(654),
+                             ImmutableString("textureLodOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s3_3f_f_3i,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureLodOffset(s3;3f;f;3i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureLodOffset_is33ff3i(TSymbolUniqueId(655),
+                             ImmutableString("textureLodOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_is3_3f_f_3i,
+                             4,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureLodOffset(is3;3f;f;3i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureLodOffset_us33ff3i(TSymbolUniqueId(656),
+                             ImmutableString("textureLodOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_us3_3f_f_3i,
+                             4,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureLodOffset(us3;3f;f;3i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureLodOffset_s2s3ff2i(TSymbolUniqueId(657),
+                             ImmutableString("textureLodOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s2s_3f_f_2i,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("textureLodOffset(s2s;3f;f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureLodOffset_sA3ff2i(TSymbolUniqueId(658),
+                             ImmutableString("textureLodOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_sA_3f_f_2i,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureLodOffset(sA;3f;f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureLodOffset_isA3ff2i(TSymbolUniqueId(659),
+                             ImmutableString("textureLodOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_isA_3f_f_2i,
+                             4,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureLodOffset(isA;3f;f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureLodOffset_usA3ff2i(TSymbolUniqueId(660),
+                             ImmutableString("textureLodOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_usA_3f_f_2i,
+                             4,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureLodOffset(usA;3f;f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjLod_s23ff(TSymbolUniqueId(661),
+                             ImmutableString("textureProjLod"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_3f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjLod(s2;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjLod_is23ff(TSymbolUniqueId(662),
+                             ImmutableString("textureProjLod"),
+                             TExtension::UNDEFINED,
+                             kParams_is2_3f_f,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjLod(is2;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjLod_us23ff(TSymbolUniqueId(663),
+                             ImmutableString("textureProjLod"),
+                             TExtension::UNDEFINED,
+                             kParams_us2_3f_f,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjLod(us2;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjLod_s24ff(TSymbolUniqueId(664),
+                             ImmutableString("textureProjLod"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_4f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjLod(s2;4f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjLod_is24ff(TSymbolUniqueId(665),
+                             ImmutableString("textureProjLod"),
+                             TExtension::UNDEFINED,
+                             kParams_is2_4f_f,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjLod(is2;4f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjLod_us24ff(TSymbolUniqueId(666),
+                             ImmutableString("textureProjLod"),
+                             TExtension::UNDEFINED,
+                             kParams_us2_4f_f,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjLod(us2;4f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjLod_s34ff(TSymbolUniqueId(667),
+                             ImmutableString("textureProjLod"),
+                             TExtension::UNDEFINED,
+                             kParams_s3_4f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjLod(s3;4f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjLod_is34ff(TSymbolUniqueId(668),
+                             ImmutableString("textureProjLod"),
+                             TExtension::UNDEFINED,
+                             kParams_is3_4f_f,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjLod(is3;4f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjLod_us34ff(TSymbolUniqueId(669),
+                             ImmutableString("textureProjLod"),
+                             TExtension::UNDEFINED,
+                             kParams_us3_4f_f,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjLod(us3;4f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjLod_s2s4ff(TSymbolUniqueId(670),
+                             ImmutableString("textureProjLod"),
+                             TExtension::UNDEFINED,
+                             kParams_s2s_4f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("textureProjLod(s2s;4f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjLodOffset_s23ff2i(TSymbolUniqueId(671),
+                             ImmutableString("textureProjLodOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_3f_f_2i,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjLodOffset(s2;3f;f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjLodOffset_is23ff2i(TSymbolUniqueId(672),
+                             ImmutableString("textureProjLodOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_is2_3f_f_2i,
+                             4,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjLodOffset(is2;3f;f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjLodOffset_us23ff2i(TSymbolUniqueId(673),
+                             ImmutableString("textureProjLodOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_us2_3f_f_2i,
+                             4,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjLodOffset(us2;3f;f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjLodOffset_s24ff2i(TSymbolUniqueId(674),
+                             ImmutableString("textureProjLodOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_4f_f_2i,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjLodOffset(s2;4f;f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjLodOffset_is24ff2i(TSymbolUniqueId(675),
+                             ImmutableString("textureProjLodOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_is2_4f_f_2i,
+                             4,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjLodOffset(is2;4f;f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjLodOffset_us24ff2i(TSymbolUniqueId(676),
+                             ImmutableString("textureProjLodOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_us2_4f_f_2i,
+                             4,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjLodOffset(us2;4f;f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjLodOffset_s34ff3i(TSymbolUniqueId(677),
+                             ImmutableString("textureProjLodOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s3_4f_f_3i,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjLodOffset(s3;4f;f;3i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjLodOffset_is34ff3i(TSymbolUniqueId(678),
+                             ImmutableString("textureProjLodOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_is3_4f_f_3i,
+                             4,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjLodOffset(is3;4f;f;3i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjLodOffset_us34ff3i(TSymbolUniqueId(679),
+                             ImmutableString("textureProjLodOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_us3_4f_f_3i,
+                             4,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjLodOffset(us3;4f;f;3i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjLodOffset_s2s4ff2i(TSymbolUniqueId(680),
+                             ImmutableString("textureProjLodOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s2s_4f_f_2i,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("textureProjLodOffset(s2s;4f;f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texelFetch_s22ii(TSymbolUniqueId(681),
+                             ImmutableString("texelFetch"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_2i_i,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texelFetch(s2;2i;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texelFetch_is22ii(TSymbolUniqueId(682),
+                             ImmutableString("texelFetch"),
+                             TExtension::UNDEFINED,
+                             kParams_is2_2i_i,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texelFetch(is2;2i;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texelFetch_us22ii(TSymbolUniqueId(683),
+                             ImmutableString("texelFetch"),
+                             TExtension::UNDEFINED,
+                             kParams_us2_2i_i,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texelFetch(us2;2i;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texelFetch_s33ii(TSymbolUniqueId(684),
+                             ImmutableString("texelFetch"),
+                             TExtension::UNDEFINED,
+                             kParams_s3_3i_i,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texelFetch(s3;3i;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texelFetch_is33ii(TSymbolUniqueId(685),
+                             ImmutableString("texelFetch"),
+                             TExtension::UNDEFINED,
+                             kParams_is3_3i_i,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texelFetch(is3;3i;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texelFetch_us33ii(TSymbolUniqueId(686),
+                             ImmutableString("texelFetch"),
+                             TExtension::UNDEFINED,
+                             kParams_us3_3i_i,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texelFetch(us3;3i;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texelFetch_sA3ii(TSymbolUniqueId(687),
+                             ImmutableString("texelFetch"),
+                             TExtension::UNDEFINED,
+                             kParams_sA_3i_i,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texelFetch(sA;3i;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texelFetch_isA3ii(TSymbolUniqueId(688),
+                             ImmutableString("texelFetch"),
+                             TExtension::UNDEFINED,
+                             kParams_isA_3i_i,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texelFetch(isA;3i;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texelFetch_usA3ii(TSymbolUniqueId(689),
+                             ImmutableString("texelFetch"),
+                             TExtension::UNDEFINED,
+                             kParams_usA_3i_i,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texelFetch(usA;3i;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texelFetch_sX2ii(TSymbolUniqueId(690),
+                             ImmutableString("texelFetch"),
+                             TExtension::OES_EGL_image_external_essl3,
+                             kParams_sX_2i_i,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texelFetch(sX;2i;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texelFetch_sY2ii(TSymbolUniqueId(691),
+                             ImmutableString("texelFetch"),
+                             TExtension::EXT_YUV_target,
+                             kParams_sY_2i_i,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texelFetch(sY;2i;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texelFetchOffset_s22ii2i(TSymbolUniqueId(692),
+                             ImmutableString("texelFetchOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_2i_i_2i,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texelFetchOffset(s2;2i;i;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texelFetchOffset_is22ii2i(TSymbolUniqueId(693),
+                             ImmutableString("texelFetchOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_is2_2i_i_2i,
+                             4,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texelFetchOffset(is2;2i;i;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texelFetchOffset_us22ii2i(TSymbolUniqueId(694),
+                             ImmutableString("texelFetchOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_us2_2i_i_2i,
+                             4,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texelFetchOffset(us2;2i;i;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texelFetchOffset_s33ii3i(TSymbolUniqueId(695),
+                             ImmutableString("texelFetchOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s3_3i_i_3i,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texelFetchOffset(s3;3i;i;3i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texelFetchOffset_is33ii3i(TSymbolUniqueId(696),
+                             ImmutableString("texelFetchOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_is3_3i_i_3i,
+                             4,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texelFetchOffset(is3;3i;i;3i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texelFetchOffset_us33ii3i(TSymbolUniqueId(697),
+                             ImmutableString("texelFetchOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_us3_3i_i_3i,
+                             4,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texelFetchOffset(us3;3i;i;3i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texelFetchOffset_sA3ii2i(TSymbolUniqueId(698),
+                             ImmutableString("texelFetchOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_sA_3i_i_2i,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texelFetchOffset(sA;3i;i;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texelFetchOffset_isA3ii2i(TSymbolUniqueId(699),
+                             ImmutableString("texelFetchOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_isA_3i_i_2i,
+                             4,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texelFetchOffset(isA;3i;i;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texelFetchOffset_usA3ii2i(TSymbolUniqueId(700),
+                             ImmutableString("texelFetchOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_usA_3i_i_2i,
+                             4,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texelFetchOffset(usA;3i;i;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGrad_s22f2f2f(TSymbolUniqueId(701),
+                             ImmutableString("textureGrad"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_2f_2f_2f,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGrad(s2;2f;2f;2f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGrad_is22f2f2f(TSymbolUniqueId(702),
+                             ImmutableString("textureGrad"),
+                             TExtension::UNDEFINED,
+                             kParams_is2_2f_2f_2f,
+                             4,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGrad(is2;2f;2f;2f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGrad_us22f2f2f(TSymbolUniqueId(703),
+                             ImmutableString("textureGrad"),
+                             TExtension::UNDEFINED,
+                             kParams_us2_2f_2f_2f,
+                             4,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGrad(us2;2f;2f;2f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGrad_s33f3f3f(TSymbolUniqueId(704),
+                             ImmutableString("textureGrad"),
+                             TExtension::UNDEFINED,
+                             kParams_s3_3f_3f_3f,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGrad(s3;3f;3f;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGrad_is33f3f3f(TSymbolUniqueId(705),
+                             ImmutableString("textureGrad"),
+                             TExtension::UNDEFINED,
+                             kParams_is3_3f_3f_3f,
+                             4,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGrad(is3;3f;3f;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGrad_us33f3f3f(TSymbolUniqueId(706),
+                             ImmutableString("textureGrad"),
+                             TExtension::UNDEFINED,
+                             kParams_us3_3f_3f_3f,
+                             4,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGrad(us3;3f;3f;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGrad_sC3f3f3f(TSymbolUniqueId(707),
+                             ImmutableString("textureGrad"),
+                             TExtension::UNDEFINED,
+                             kParams_sC_3f_3f_3f,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGrad(sC;3f;3f;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGrad_isC3f3f3f(TSymbolUniqueId(708),
+                             ImmutableString("textureGrad"),
+                             TExtension::UNDEFINED,
+                             kParams_isC_3f_3f_3f,
+                             4,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGrad(isC;3f;3f;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGrad_usC3f3f3f(TSymbolUniqueId(709),
+                             ImmutableString("textureGrad"),
+                             TExtension::UNDEFINED,
+                             kParams_usC_3f_3f_3f,
+                             4,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGrad(usC;3f;3f;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGrad_s2s3f2f2f(TSymbolUniqueId(710),
+                             ImmutableString("textureGrad"),
+                             TExtension::UNDEFINED,
+                             kParams_s2s_3f_2f_2f,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("textureGrad(s2s;3f;2f;2f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGrad_sCs4f3f3f(TSymbolUniqueId(711),
+                             ImmutableString("textureGrad"),
+                             TExtension::UNDEFINED,
+                             kParams_sCs_4f_3f_3f,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("textureGrad(sCs;4f;3f;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGrad_sA3f2f2f(TSymbolUniqueId(712),
+                             ImmutableString("textureGrad"),
+                             TExtension::UNDEFINED,
+                             kParams_sA_3f_2f_2f,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGrad(sA;3f;2f;2f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGrad_isA3f2f2f(TSymbolUniqueId(713),
+                             ImmutableString("textureGrad"),
+                             TExtension::UNDEFINED,
+                             kParams_isA_3f_2f_2f,
+                             4,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGrad(isA;3f;2f;2f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGrad_usA3f2f2f(TSymbolUniqueId(714),
+                             ImmutableString("textureGrad"),
+                             TExtension::UNDEFINED,
+                             kParams_usA_3f_2f_2f,
+                             4,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGrad(usA;3f;2f;2f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGrad_sAs4f2f2f(TSymbolUniqueId(715),
+                             ImmutableString("textureGrad"),
+                             TExtension::UNDEFINED,
+                             kParams_sAs_4f_2f_2f,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("textureGrad(sAs;4f;2f;2f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGradOffset_s22f2f2f2i(TSymbolUniqueId(716),
+                             ImmutableString("textureGradOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_2f_2f_2f_2i,
+                             5,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGradOffset(s2;2f;2f;2f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGradOffset_is22f2f2f2i(TSymbolUniqueId(717),
+                             ImmutableString("textureGradOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_is2_2f_2f_2f_2i,
+                             5,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGradOffset(is2;2f;2f;2f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGradOffset_us22f2f2f2i(TSymbolUniqueId(718),
+                             ImmutableString("textureGradOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_us2_2f_2f_2f_2i,
+                             5,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGradOffset(us2;2f;2f;2f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGradOffset_s33f3f3f3i(TSymbolUniqueId(719),
+                             ImmutableString("textureGradOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s3_3f_3f_3f_3i,
+                             5,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGradOffset(s3;3f;3f;3f;3i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGradOffset_is33f3f3f3i(TSymbolUniqueId(720),
+                             ImmutableString("textureGradOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_is3_3f_3f_3f_3i,
+                             5,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGradOffset(is3;3f;3f;3f;3i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGradOffset_us33f3f3f3i(TSymbolUniqueId(721),
+                             ImmutableString("textureGradOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_us3_3f_3f_3f_3i,
+                             5,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGradOffset(us3;3f;3f;3f;3i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGradOffset_s2s3f2f2f2i(TSymbolUniqueId(722),
+                             ImmutableString("textureGradOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s2s_3f_2f_2f_2i,
+                             5,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("textureGradOffset(s2s;3f;2f;2f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGradOffset_sA3f2f2f2i(TSymbolUniqueId(723),
+                             ImmutableString("textureGradOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_sA_3f_2f_2f_2i,
+                             5,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGradOffset(sA;3f;2f;2f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGradOffset_isA3f2f2f2i(TSymbolUniqueId(724),
+                             ImmutableString("textureGradOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_isA_3f_2f_2f_2i,
+                             5,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGradOffset(isA;3f;2f;2f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGradOffset_usA3f2f2f2i(TSymbolUniqueId(725),
+                             ImmutableString("textureGradOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_usA_3f_2f_2f_2i,
+                             5,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGradOffset(usA;3f;2f;2f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGradOffset_sAs4f2f2f2i(TSymbolUniqueId(726),
+                             ImmutableString("textureGradOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_sAs_4f_2f_2f_2i,
+                             5,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("textureGradOffset(sAs;4f;2f;2f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjGrad_s23f2f2f(TSymbolUniqueId(727),
+                             ImmutableString("textureProjGrad"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_3f_2f_2f,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjGrad(s2;3f;2f;2f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjGrad_is23f2f2f(TSymbolUniqueId(728),
+                             ImmutableString("textureProjGrad"),
+                             TExtension::UNDEFINED,
+                             kParams_is2_3f_2f_2f,
+                             4,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjGrad(is2;3f;2f;2f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjGrad_us23f2f2f(TSymbolUniqueId(729),
+                             ImmutableString("textureProjGrad"),
+                             TExtension::UNDEFINED,
+                             kParams_us2_3f_2f_2f,
+                             4,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjGrad(us2;3f;2f;2f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjGrad_s24f2f2f(TSymbolUniqueId(730),
+                             ImmutableString("textureProjGrad"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_4f_2f_2f,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjGrad(s2;4f;2f;2f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjGrad_is24f2f2f(TSymbolUniqueId(731),
+                             ImmutableString("textureProjGrad"),
+                             TExtension::UNDEFINED,
+                             kParams_is2_4f_2f_2f,
+                             4,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjGrad(is2;4f;2f;2f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjGrad_us24f2f2f(TSymbolUniqueId(732),
+                             ImmutableString("textureProjGrad"),
+                             TExtension::UNDEFINED,
+                             kParams_us2_4f_2f_2f,
+                             4,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjGrad(us2;4f;2f;2f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjGrad_s34f3f3f(TSymbolUniqueId(733),
+                             ImmutableString("textureProjGrad"),
+                             TExtension::UNDEFINED,
+                             kParams_s3_4f_3f_3f,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjGrad(s3;4f;3f;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjGrad_is34f3f3f(TSymbolUniqueId(734),
+                             ImmutableString("textureProjGrad"),
+                             TExtension::UNDEFINED,
+                             kParams_is3_4f_3f_3f,
+                             4,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjGrad(is3;4f;3f;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjGrad_us34f3f3f(TSymbolUniqueId(735),
+                             ImmutableString("textureProjGrad"),
+                             TExtension::UNDEFINED,
+                             kParams_us3_4f_3f_3f,
+                             4,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjGrad(us3;4f;3f;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjGrad_s2s4f2f2f(TSymbolUniqueId(736),
+                             ImmutableString("textureProjGrad"),
+                             TExtension::UNDEFINED,
+                             kParams_s2s_4f_2f_2f,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("textureProjGrad(s2s;4f;2f;2f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjGradOffset_s23f2f2f2i(TSymbolUniqueId(737),
+                             ImmutableString("textureProjGradOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_3f_2f_2f_2i,
+                             5,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjGradOffset(s2;3f;2f;2f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjGradOffset_is23f2f2f2i(TSymbolUniqueId(738),
+                             ImmutableString("textureProjGradOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_is2_3f_2f_2f_2i,
+                             5,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjGradOffset(is2;3f;2f;2f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjGradOffset_us23f2f2f2i(TSymbolUniqueId(739),
+                             ImmutableString("textureProjGradOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_us2_3f_2f_2f_2i,
+                             5,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjGradOffset(us2;3f;2f;2f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjGradOffset_s24f2f2f2i(TSymbolUniqueId(740),
+                             ImmutableString("textureProjGradOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_4f_2f_2f_2i,
+                             5,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjGradOffset(s2;4f;2f;2f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjGradOffset_is24f2f2f2i(TSymbolUniqueId(741),
+                             ImmutableString("textureProjGradOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_is2_4f_2f_2f_2i,
+                             5,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjGradOffset(is2;4f;2f;2f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjGradOffset_us24f2f2f2i(TSymbolUniqueId(742),
+                             ImmutableString("textureProjGradOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_us2_4f_2f_2f_2i,
+                             5,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjGradOffset(us2;4f;2f;2f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjGradOffset_s34f3f3f3i(TSymbolUniqueId(743),
+                             ImmutableString("textureProjGradOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s3_4f_3f_3f_3i,
+                             5,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjGradOffset(s3;4f;3f;3f;3i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjGradOffset_is34f3f3f3i(TSymbolUniqueId(744),
+                             ImmutableString("textureProjGradOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_is3_4f_3f_3f_3i,
+                             5,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjGradOffset(is3;4f;3f;3f;3i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjGradOffset_us34f3f3f3i(TSymbolUniqueId(745),
+                             ImmutableString("textureProjGradOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_us3_4f_3f_3f_3i,
+                             5,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureProjGradOffset(us3;4f;3f;3f;3i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureProjGradOffset_s2s4f2f2f2i(TSymbolUniqueId(746),
+                             ImmutableString("textureProjGradOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s2s_4f_2f_2f_2i,
+                             5,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("textureProjGradOffset(s2s;4f;2f;2f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_atomicCounter_a(TSymbolUniqueId(747),
+                             ImmutableString("atomicCounter"),
+                             TExtension::UNDEFINED,
+                             kParams_a,
+                             1,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("atomicCounter(a;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_atomicCounterIncrement_a(TSymbolUniqueId(748),
+                             ImmutableString("atomicCounterIncrement"),
+                             TExtension::UNDEFINED,
+                             kParams_a,
+                             1,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("atomicCounterIncrement(a;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_atomicCounterDecrement_a(TSymbolUniqueId(749),
+                             ImmutableString("atomicCounterDecrement"),
+                             TExtension::UNDEFINED,
+                             kParams_a,
+                             1,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("atomicCounterDecrement(a;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_atomicAdd_uu(TSymbolUniqueId(750),
+                             ImmutableString("atomicAdd"),
+                             TExtension::UNDEFINED,
+                             kParams_iou_u,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("atomicAdd(u;u;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_atomicAdd_ii(TSymbolUniqueId(751),
+                             ImmutableString("atomicAdd"),
+                             TExtension::UNDEFINED,
+                             kParams_ioi_i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("atomicAdd(i;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_atomicMin_uu(TSymbolUniqueId(752),
+                             ImmutableString("atomicMin"),
+                             TExtension::UNDEFINED,
+                             kParams_iou_u,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("atomicMin(u;u;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_atomicMin_ii(TSymbolUniqueId(753),
+                             ImmutableString("atomicMin"),
+                             TExtension::UNDEFINED,
+                             kParams_ioi_i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("atomicMin(i;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_atomicMax_uu(TSymbolUniqueId(754),
+                             ImmutableString("atomicMax"),
+                             TExtension::UNDEFINED,
+                             kParams_iou_u,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("atomicMax(u;u;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_atomicMax_ii(TSymbolUniqueId(755),
+                             ImmutableString("atomicMax"),
+                             TExtension::UNDEFINED,
+                             kParams_ioi_i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("atomicMax(i;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_atomicAnd_uu(TSymbolUniqueId(756),
+                             ImmutableString("atomicAnd"),
+                             TExtension::UNDEFINED,
+                             kParams_iou_u,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("atomicAnd(u;u;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_atomicAnd_ii(TSymbolUniqueId(757),
+                             ImmutableString("atomicAnd"),
+                             TExtension::UNDEFINED,
+                             kParams_ioi_i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("atomicAnd(i;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_atomicOr_uu(TSymbolUniqueId(758),
+                             ImmutableString("atomicOr"),
+                             TExtension::UNDEFINED,
+                             kParams_iou_u,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("atomicOr(u;u;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_atomicOr_ii(TSymbolUniqueId(759),
+                             ImmutableString("atomicOr"),
+                             TExtension::UNDEFINED,
+                             kParams_ioi_i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("atomicOr(i;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_atomicXor_uu(TSymbolUniqueId(760),
+                             ImmutableString("atomicXor"),
+                             TExtension::UNDEFINED,
+                             kParams_iou_u,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("atomicXor(u;u;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_atomicXor_ii(TSymbolUniqueId(761),
+                             ImmutableString("atomicXor"),
+                             TExtension::UNDEFINED,
+                             kParams_ioi_i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("atomicXor(i;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_atomicExchange_uu(TSymbolUniqueId(762),
+                             ImmutableString("atomicExchange"),
+                             TExtension::UNDEFINED,
+                             kParams_iou_u,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("atomicExchange(u;u;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_atomicExchange_ii(TSymbolUniqueId(763),
+                             ImmutableString("atomicExchange"),
+                             TExtension::UNDEFINED,
+                             kParams_ioi_i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("atomicExchange(i;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_atomicCompSwap_uuu(TSymbolUniqueId(764),
+                             ImmutableString("atomicCompSwap"),
+                             TExtension::UNDEFINED,
+                             kParams_iou_u_u,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("atomicCompSwap(u;u;u;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_atomicCompSwap_iii(TSymbolUniqueId(765),
+                             ImmutableString("atomicCompSwap"),
+                             TExtension::UNDEFINED,
+                             kParams_ioi_i_i,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("atomicCompSwap(i;i;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageStore_I22i4f(TSymbolUniqueId(766),
+                             ImmutableString("imageStore"),
+                             TExtension::UNDEFINED,
+                             kParams_I2_2i_4f,
+                             3,
+                             StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("imageStore(I2;2i;4f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageStore_iI22i4i(TSymbolUniqueId(767),
+                             ImmutableString("imageStore"),
+                             TExtension::UNDEFINED,
+                             kParams_iI2_2i_4i,
+                             3,
+                             StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("imageStore(iI2;2i;4i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageStore_uI22i4u(TSymbolUniqueId(768),
+                             ImmutableString("imageStore"),
+                             TExtension::UNDEFINED,
+                             kParams_uI2_2i_4u,
+                             3,
+                             StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("imageStore(uI2;2i;4u;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageStore_I33i4f(TSymbolUniqueId(769),
+                             ImmutableString("imageStore"),
+                             TExtension::UNDEFINED,
+                             kParams_I3_3i_4f,
+                             3,
+                             StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("imageStore(I3;3i;4f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageStore_iI33i4i(TSymbolUniqueId(770),
+                             ImmutableString("imageStore"),
+                             TExtension::UNDEFINED,
+                             kParams_iI3_3i_4i,
+                             3,
+                             StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("imageStore(iI3;3i;4i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageStore_uI33i4u(TSymbolUniqueId(771),
+                             ImmutableString("imageStore"),
+                             TExtension::UNDEFINED,
+                             kParams_uI3_3i_4u,
+                             3,
+                             StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("imageStore(uI3;3i;4u;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageStore_IA3i4f(TSymbolUniqueId(772),
+                             ImmutableString("imageStore"),
+                             TExtension::UNDEFINED,
+                             kParams_IA_3i_4f,
+                             3,
+                             StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("imageStore(IA;3i;4f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageStore_iIA3i4i(TSymbolUniqueId(773),
+                             ImmutableString("imageStore"),
+                             TExtension::UNDEFINED,
+                             kParams_iIA_3i_4i,
+                             3,
+                             StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("imageStore(iIA;3i;4i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageStore_uIA3i4u(TSymbolUniqueId(774),
+                             ImmutableString("imageStore"),
+                             TExtension::UNDEFINED,
+                             kParams_uIA_3i_4u,
+                             3,
+                             StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("imageStore(uIA;3i;4u;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageStore_Ic3i4f(TSymbolUniqueId(775),
+                             ImmutableString("imageStore"),
+                             TExtension::UNDEFINED,
+                             kParams_Ic_3i_4f,
+                             3,
+                             StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("imageStore(Ic;3i;4f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageStore_iIc3i4i(TSymbolUniqueId(776),
+                             ImmutableString("imageStore"),
+                             TExtension::UNDEFINED,
+                             kParams_iIc_3i_4i,
+                             3,
+                             StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("imageStore(iIc;3i;4i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageStore_uIc3i4u(TSymbolUniqueId(777),
+                             ImmutableString("imageStore"),
+                             TExtension::UNDEFINED,
+                             kParams_uIc_3i_4u,
+                             3,
+                             StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("imageStore(uIc;3i;4u;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageLoad_I22i(TSymbolUniqueId(778),
+                             ImmutableString("imageLoad"),
+                             TExtension::UNDEFINED,
+                             kParams_I2_2i,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("imageLoad(I2;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageLoad_iI22i(TSymbolUniqueId(779),
+                             ImmutableString("imageLoad"),
+                             TExtension::UNDEFINED,
+                             kParams_iI2_2i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("imageLoad(iI2;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageLoad_uI22i(TSymbolUniqueId(780),
+                             ImmutableString("imageLoad"),
+                             TExtension::UNDEFINED,
+                             kParams_uI2_2i,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("imageLoad(uI2;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageLoad_I33i(TSymbolUniqueId(781),
+                             ImmutableString("imageLoad"),
+                             TExtension::UNDEFINED,
+                             kParams_I3_3i,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("imageLoad(I3;3i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageLoad_iI33i(TSymbolUniqueId(782),
+                             ImmutableString("imageLoad"),
+                             TExtension::UNDEFINED,
+                             kParams_iI3_3i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("imageLoad(iI3;3i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageLoad_uI33i(TSymbolUniqueId(783),
+                             ImmutableString("imageLoad"),
+                             TExtension::UNDEFINED,
+                             kParams_uI3_3i,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("imageLoad(uI3;3i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageLoad_IA3i(TSymbolUniqueId(784),
+                             ImmutableString("imageLoad"),
+                             TExtension::UNDEFINED,
+                             kParams_IA_3i,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("imageLoad(IA;3i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageLoad_iIA3i(TSymbolUniqueId(785),
+                             ImmutableString("imageLoad"),
+                             TExtension::UNDEFINED,
+                             kParams_iIA_3i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("imageLoad(iIA;3i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageLoad_uIA3i(TSymbolUniqueId(786),
+                             ImmutableString("imageLoad"),
+                             TExtension::UNDEFINED,
+                             kParams_uIA_3i,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("imageLoad(uIA;3i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageLoad_Ic3i(TSymbolUniqueId(787),
+                             ImmutableString("imageLoad"),
+                             TExtension::UNDEFINED,
+                             kParams_Ic_3i,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("imageLoad(Ic;3i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageLoad_iIc3i(TSymbolUniqueId(788),
+                             ImmutableString("imageLoad"),
+                             TExtension::UNDEFINED,
+                             kParams_iIc_3i,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("imageLoad(iIc;3i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageLoad_uIc3i(TSymbolUniqueId(789),
+                             ImmutableString("imageLoad"),
+                             TExtension::UNDEFINED,
+                             kParams_uIc_3i,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("imageLoad(uIc;3i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageSize_I2(TSymbolUniqueId(790),
+                             ImmutableString("imageSize"),
+                             TExtension::UNDEFINED,
+                             kParams_I2,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("imageSize(I2;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageSize_iI2(TSymbolUniqueId(791),
+                             ImmutableString("imageSize"),
+                             TExtension::UNDEFINED,
+                             kParams_iI2,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("imageSize(iI2;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageSize_uI2(TSymbolUniqueId(792),
+                             ImmutableString("imageSize"),
+                             TExtension::UNDEFINED,
+                             kParams_uI2,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("imageSize(uI2;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageSize_I3(TSymbolUniqueId(793),
+                             ImmutableString("imageSize"),
+                             TExtension::UNDEFINED,
+                             kParams_I3,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("imageSize(I3;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageSize_iI3(TSymbolUniqueId(794),
+                             ImmutableString("imageSize"),
+                             TExtension::UNDEFINED,
+                             kParams_iI3,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("imageSize(iI3;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageSize_uI3(TSymbolUniqueId(795),
+                             ImmutableString("imageSize"),
+                             TExtension::UNDEFINED,
+                             kParams_uI3,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("imageSize(uI3;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageSize_IA(TSymbolUniqueId(796),
+                             ImmutableString("imageSize"),
+                             TExtension::UNDEFINED,
+                             kParams_IA,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("imageSize(IA;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageSize_iIA(TSymbolUniqueId(797),
+                             ImmutableString("imageSize"),
+                             TExtension::UNDEFINED,
+                             kParams_iIA,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("imageSize(iIA;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageSize_uIA(TSymbolUniqueId(798),
+                             ImmutableString("imageSize"),
+                             TExtension::UNDEFINED,
+                             kParams_uIA,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 3, 1>(),
+                             ImmutableString("imageSize(uIA;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageSize_Ic(TSymbolUniqueId(799),
+                             ImmutableString("imageSize"),
+                             TExtension::UNDEFINED,
+                             kParams_Ic,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("imageSize(Ic;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageSize_iIc(TSymbolUniqueId(800),
+                             ImmutableString("imageSize"),
+                             TExtension::UNDEFINED,
+                             kParams_iIc,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("imageSize(iIc;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_imageSize_uIc(TSymbolUniqueId(801),
+                             ImmutableString("imageSize"),
+                             TExtension::UNDEFINED,
+                             kParams_uIc,
+                             1,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 2, 1>(),
+                             ImmutableString("imageSize(uIc;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_memoryBarrier(TSymbolUniqueId(802),
+                             ImmutableString("memoryBarrier"),
+                             TExtension::UNDEFINED,
+                             nullptr,
+                             0,
+                             StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("memoryBarrier("),
+                             EOpMemoryBarrier,
+                             false);
+constexpr const TFunction kFunction_memoryBarrierAtomicCounter(TSymbolUniqueId(803),
+                             ImmutableString("memoryBarrierAtomicCounter"),
+                             TExtension::UNDEFINED,
+                             nullptr,
+                             0,
+                             StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("memoryBarrierAtomicCounter("),
+                             EOpMemoryBarrierAtomicCounter,
+                             false);
+constexpr const TFunction kFunction_memoryBarrierBuffer(TSymbolUniqueId(804),
+                             ImmutableString("memoryBarrierBuffer"),
+                             TExtension::UNDEFINED,
+                             nullptr,
+                             0,
+                             StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("memoryBarrierBuffer("),
+                             EOpMemoryBarrierBuffer,
+                             false);
+constexpr const TFunction kFunction_memoryBarrierImage(TSymbolUniqueId(805),
+                             ImmutableString("memoryBarrierImage"),
+                             TExtension::UNDEFINED,
+                             nullptr,
+                             0,
+                             StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("memoryBarrierImage("),
+                             EOpMemoryBarrierImage,
+                             false);
+constexpr const TFunction kFunction_texelFetch_sM2ii(TSymbolUniqueId(806),
+                             ImmutableString("texelFetch"),
+                             TExtension::UNDEFINED,
+                             kParams_sM_2i_i,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texelFetch(sM;2i;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texelFetch_isM2ii(TSymbolUniqueId(807),
+                             ImmutableString("texelFetch"),
+                             TExtension::UNDEFINED,
+                             kParams_isM_2i_i,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texelFetch(isM;2i;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_texelFetch_usM2ii(TSymbolUniqueId(808),
+                             ImmutableString("texelFetch"),
+                             TExtension::UNDEFINED,
+                             kParams_usM_2i_i,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("texelFetch(usM;2i;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGather_s22f(TSymbolUniqueId(809),
+                             ImmutableString("textureGather"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_2f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGather(s2;2f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGather_is22f(TSymbolUniqueId(810),
+                             ImmutableString("textureGather"),
+                             TExtension::UNDEFINED,
+                             kParams_is2_2f,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGather(is2;2f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGather_us22f(TSymbolUniqueId(811),
+                             ImmutableString("textureGather"),
+                             TExtension::UNDEFINED,
+                             kParams_us2_2f,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGather(us2;2f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGather_s22fi(TSymbolUniqueId(812),
+                             ImmutableString("textureGather"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_2f_i,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGather(s2;2f;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGather_is22fi(TSymbolUniqueId(813),
+                             ImmutableString("textureGather"),
+                             TExtension::UNDEFINED,
+                             kParams_is2_2f_i,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGather(is2;2f;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGather_us22fi(TSymbolUniqueId(814),
+                             ImmutableString("textureGather"),
+                             TExtension::UNDEFINED,
+                             kParams_us2_2f_i,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGather(us2;2f;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGather_sA3f(TSymbolUniqueId(815),
+                             ImmutableString("textureGather"),
+                             TExtension::UNDEFINED,
+                             kParams_sA_3f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGather(sA;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGather_isA3f(TSymbolUniqueId(816),
+                             ImmutableString("textureGather"),
+                             TExtension::UNDEFINED,
+                             kParams_isA_3f,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGather(isA;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGather_usA3f(TSymbolUniqueId(817),
+                             ImmutableString("textureGather"),
+                             TExtension::UNDEFINED,
+                             kParams_usA_3f,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGather(usA;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGather_sA3fi(TSymbolUniqueId(818),
+                             ImmutableString("textureGather"),
+                             TExtension::UNDEFINED,
+                             kParams_sA_3f_i,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGather(sA;3f;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGather_isA3fi(TSymbolUniqueId(819),
+                             ImmutableString("textureGather"),
+                             TExtension::UNDEFINED,
+                             kParams_isA_3f_i,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGather(isA;3f;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGather_usA3fi(TSymbolUniqueId(820),
+                             ImmutableString("textureGather"),
+                             TExtension::UNDEFINED,
+                             kParams_usA_3f_i,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGather(usA;3f;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGather_sC3f(TSymbolUniqueId(821),
+                             ImmutableString("textureGather"),
+                             TExtension::UNDEFINED,
+                             kParams_sC_3f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGather(sC;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGather_isC3f(TSymbolUniqueId(822),
+                             ImmutableString("textureGather"),
+                             TExtension::UNDEFINED,
+                             kParams_isC_3f,
+                             2,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGather(isC;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGather_usC3f(TSymbolUniqueId(823),
+                             ImmutableString("textureGather"),
+                             TExtension::UNDEFINED,
+                             kParams_usC_3f,
+                             2,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGather(usC;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGather_sC3fi(TSymbolUniqueId(824),
+                             ImmutableString("textureGather"),
+                             TExtension::UNDEFINED,
+                             kParams_sC_3f_i,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGather(sC;3f;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGather_isC3fi(TSymbolUniqueId(825),
+                             ImmutableString("textureGather"),
+                             TExtension::UNDEFINED,
+                             kParams_isC_3f_i,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGather(isC;3f;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGather_usC3fi(TSymbolUniqueId(826),
+                             ImmutableString("textureGather"),
+                             TExtension::UNDEFINED,
+                             kParams_usC_3f_i,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGather(usC;3f;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGather_s2s2f(TSymbolUniqueId(827),
+                             ImmutableString("textureGather"),
+                             TExtension::UNDEFINED,
+                             kParams_s2s_2f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGather(s2s;2f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGather_s2s2ff(TSymbolUniqueId(828),
+                             ImmutableString("textureGather"),
+                             TExtension::UNDEFINED,
+                             kParams_s2s_2f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGather(s2s;2f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGather_sAs3f(TSymbolUniqueId(829),
+                             ImmutableString("textureGather"),
+                             TExtension::UNDEFINED,
+                             kParams_sAs_3f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGather(sAs;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGather_sAs3ff(TSymbolUniqueId(830),
+                             ImmutableString("textureGather"),
+                             TExtension::UNDEFINED,
+                             kParams_sAs_3f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGather(sAs;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGather_sCs3f(TSymbolUniqueId(831),
+                             ImmutableString("textureGather"),
+                             TExtension::UNDEFINED,
+                             kParams_sCs_3f,
+                             2,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGather(sCs;3f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGather_sCs3ff(TSymbolUniqueId(832),
+                             ImmutableString("textureGather"),
+                             TExtension::UNDEFINED,
+                             kParams_sCs_3f_f,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGather(sCs;3f;f;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGatherOffset_s22f2i(TSymbolUniqueId(833),
+                             ImmutableString("textureGatherOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_2f_2i,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGatherOffset(s2;2f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGatherOffset_is22f2i(TSymbolUniqueId(834),
+                             ImmutableString("textureGatherOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_is2_2f_2i,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGatherOffset(is2;2f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGatherOffset_us22f2i(TSymbolUniqueId(835),
+                             ImmutableString("textureGatherOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_us2_2f_2i,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGatherOffset(us2;2f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGatherOffset_s22f2ii(TSymbolUniqueId(836),
+                             ImmutableString("textureGatherOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s2_2f_2i_i,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGatherOffset(s2;2f;2i;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGatherOffset_is22f2ii(TSymbolUniqueId(837),
+                             ImmutableString("textureGatherOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_is2_2f_2i_i,
+                             4,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGatherOffset(is2;2f;2i;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGatherOffset_us22f2ii(TSymbolUniqueId(838),
+                             ImmutableString("textureGatherOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_us2_2f_2i_i,
+                             4,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGatherOffset(us2;2f;2i;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGatherOffset_sA3f2i(TSymbolUniqueId(839),
+                             ImmutableString("textureGatherOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_sA_3f_2i,
+                             3,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGatherOffset(sA;3f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGatherOffset_isA3f2i(TSymbolUniqueId(840),
+                             ImmutableString("textureGatherOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_isA_3f_2i,
+                             3,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGatherOffset(isA;3f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGatherOffset_usA3f2i(TSymbolUniqueId(841),
+                             ImmutableString("textureGatherOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_usA_3f_2i,
+                             3,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGatherOffset(usA;3f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGatherOffset_sA3f2ii(TSymbolUniqueId(842),
+                             ImmutableString("textureGatherOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_sA_3f_2i_i,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGatherOffset(sA;3f;2i;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGatherOffset_isA3f2ii(TSymbolUniqueId(843),
+                             ImmutableString("textureGatherOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_isA_3f_2i_i,
+                             4,
+                             StaticType::Get<EbtInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGatherOffset(isA;3f;2i;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGatherOffset_usA3f2ii(TSymbolUniqueId(844),
+                             ImmutableString("textureGatherOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_usA_3f_2i_i,
+                             4,
+                             StaticType::Get<EbtUInt, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGatherOffset(usA;3f;2i;i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGatherOffset_s2s2ff2i(TSymbolUniqueId(845),
+                             ImmutableString("textureGatherOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_s2s_2f_f_2i,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGatherOffset(s2s;2f;f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_textureGatherOffset_sAs3ff2i(TSymbolUniqueId(846),
+                             ImmutableString("textureGatherOffset"),
+                             TExtension::UNDEFINED,
+                             kParams_sAs_3f_f_2i,
+                             4,
+                             StaticType::Get<EbtFloat, EbpUndefined, EvqGlobal, 4, 1>(),
+                             ImmutableString("textureGatherOffset(sAs;3f;f;2i;"),
+                             EOpCallBuiltInFunction,
+                             false);
+constexpr const TFunction kFunction_barrier(TSymbolUniqueId(847),
+                             ImmutableString("barrier"),
+                             TExtension::UNDEFINED,
+                             nullptr,
+                             0,
+                             StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("barrier("),
+                             EOpBarrier,
+                             false);
+constexpr const TFunction kFunction_memoryBarrierShared(TSymbolUniqueId(848),
+                             ImmutableString("memoryBarrierShared"),
+                             TExtension::UNDEFINED,
+                             nullptr,
+                             0,
+                             StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("memoryBarrierShared("),
+                             EOpMemoryBarrierShared,
+                             false);
+constexpr const TFunction kFunction_groupMemoryBarrier(TSymbolUniqueId(849),
+                             ImmutableString("groupMemoryBarrier"),
+                             TExtension::UNDEFINED,
+                             nullptr,
+                             0,
+                             StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("groupMemoryBarrier("),
+                             EOpGroupMemoryBarrier,
+                             false);
+constexpr const TFunction kFunction_EmitVertex(TSymbolUniqueId(850),
+                             ImmutableString("EmitVertex"),
+                             TExtension::EXT_geometry_shader,
+                             nullptr,
+                             0,
+                             StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("EmitVertex("),
+                             EOpEmitVertex,
+                             false);
+constexpr const TFunction kFunction_EndPrimitive(TSymbolUniqueId(851),
+                             ImmutableString("EndPrimitive"),
+                             TExtension::EXT_geometry_shader,
+                             nullptr,
+                             0,
+                             StaticType::Get<EbtVoid, EbpUndefined, EvqGlobal, 1, 1>(),
+                             ImmutableString("EndPrimitive("),
+                             EOpEndPrimitive,
+                             false);
+
+constexpr BuiltInFunctionEntry kMangledEntries[] = {
+    {&kFunction_radians_f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_radians_2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_radians_3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_radians_4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_degrees_f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_degrees_2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_degrees_3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_degrees_4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_sin_f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_sin_2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_sin_3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_sin_4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_cos_f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_cos_2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_cos_3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_cos_4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_tan_f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_tan_2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_tan_3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_tan_4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_asin_f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_asin_2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_asin_3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_asin_4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_acos_f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_acos_2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_acos_3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_acos_4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_atan_ff, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_atan_2f2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_atan_3f3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_atan_4f4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_atan_f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_atan_2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_atan_3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_atan_4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_sinh_f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_sinh_2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_sinh_3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_sinh_4f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_cosh_f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_cosh_2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_cosh_3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_cosh_4f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_tanh_f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_tanh_2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_tanh_3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_tanh_4f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_asinh_f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_asinh_2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_asinh_3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_asinh_4f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_acosh_f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_acosh_2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_acosh_3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_acosh_4f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_atanh_f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_atanh_2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_atanh_3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_atanh_4f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_pow_ff, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_pow_2f2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_pow_3f3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_pow_4f4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_exp_f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_exp_2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_exp_3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_exp_4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_log_f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_log_2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_log_3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_log_4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_exp2_f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_exp2_2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_exp2_3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_exp2_4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_log2_f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_log2_2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_log2_3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_log2_4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_sqrt_f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_sqrt_2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_sqrt_3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_sqrt_4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_inversesqrt_f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_inversesqrt_2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_inversesqrt_3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_inversesqrt_4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_abs_f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_abs_2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_abs_3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_abs_4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_abs_i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_abs_2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_abs_3i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_abs_4i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_sign_f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_sign_2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_sign_3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_sign_4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_sign_i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_sign_2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_sign_3i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_sign_4i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_floor_f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_floor_2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_floor_3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_floor_4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_trunc_f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_trunc_2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_trunc_3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_trunc_4f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_round_f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_round_2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_round_3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_round_4f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_roundEven_f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_roundEven_2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_roundEven_3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_roundEven_4f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_ceil_f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_ceil_2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_ceil_3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_ceil_4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_fract_f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_fract_2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_fract_3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_fract_4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_mod_ff, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_mod_2ff, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_mod_3ff, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_mod_4ff, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_mod_2f2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_mod_3f3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_mod_4f4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_min_ff, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_min_2ff, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_min_3ff, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_min_4ff, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_min_2f2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_min_3f3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_min_4f4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_min_ii, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_min_2i2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_min_3i3i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_min_4i4i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_min_2ii, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_min_3ii, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_min_4ii, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_min_uu, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_min_2u2u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_min_3u3u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_min_4u4u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_min_2uu, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_min_3uu, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_min_4uu, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_max_ff, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_max_2ff, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_max_3ff, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_max_4ff, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_max_2f2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_max_3f3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_max_4f4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_max_ii, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_max_2i2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_max_3i3i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_max_4i4i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_max_2ii, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_max_3ii, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_max_4ii, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_max_uu, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_max_2u2u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_max_3u3u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_max_4u4u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_max_2uu, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_max_3uu, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_max_4uu, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_clamp_fff, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_clamp_2fff, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_clamp_3fff, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_clamp_4fff, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_clamp_2f2f2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_clamp_3f3f3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_clamp_4f4f4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_clamp_iii, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_clamp_2iii, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_clamp_3iii, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_clamp_4iii, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_clamp_2i2i2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_clamp_3i3i3i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_clamp_4i4i4i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_clamp_uuu, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_clamp_2uuu, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_clamp_3uuu, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_clamp_4uuu, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_clamp_2u2u2u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_clamp_3u3u3u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_clamp_4u4u4u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_mix_fff, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_mix_2f2ff, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_mix_3f3ff, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_mix_4f4ff, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_mix_2f2f2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_mix_3f3f3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_mix_4f4f4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_mix_ffb, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_mix_2f2f2b, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_mix_3f3f3b, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_mix_4f4f4b, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_step_ff, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_step_2f2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_step_3f3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_step_4f4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_step_f2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_step_f3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_step_f4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_smoothstep_fff, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_smoothstep_2f2f2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_smoothstep_3f3f3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_smoothstep_4f4f4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_smoothstep_ff2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_smoothstep_ff3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_smoothstep_ff4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_modf_ff, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_modf_2f2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_modf_3f3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_modf_4f4f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_isnan_f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_isnan_2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_isnan_3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_isnan_4f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_isinf_f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_isinf_2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_isinf_3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_isinf_4f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_floatBitsToInt_f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_floatBitsToInt_2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_floatBitsToInt_3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_floatBitsToInt_4f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_floatBitsToUint_f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_floatBitsToUint_2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_floatBitsToUint_3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_floatBitsToUint_4f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_intBitsToFloat_i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_intBitsToFloat_2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_intBitsToFloat_3i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_intBitsToFloat_4i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_uintBitsToFloat_u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_uintBitsToFloat_2u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_uintBitsToFloat_3u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_uintBitsToFloat_4u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_frexp_fi, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_frexp_2f2i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_frexp_3f3i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_frexp_4f4i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_ldexp_fi, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_ldexp_2f2i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_ldexp_3f3i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_ldexp_4f4i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_packSnorm2x16_2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_packUnorm2x16_2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_packHalf2x16_2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_unpackSnorm2x16_u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_unpackUnorm2x16_u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_unpackHalf2x16_u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_packUnorm4x8_4f, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_packSnorm4x8_4f, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_unpackUnorm4x8_u, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_unpackSnorm4x8_u, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_length_f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_length_2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_length_3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_length_4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_distance_ff, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_distance_2f2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_distance_3f3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_distance_4f4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_dot_ff, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_dot_2f2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_dot_3f3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_dot_4f4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_cross_3f3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_normalize_f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_normalize_2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_normalize_3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_normalize_4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_faceforward_fff, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_faceforward_2f2f2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_faceforward_3f3f3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_faceforward_4f4f4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_reflect_ff, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_reflect_2f2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_reflect_3f3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_reflect_4f4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_refract_fff, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_refract_2f2ff, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_refract_3f3ff, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_refract_4f4ff, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_matrixCompMult_22f22f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_matrixCompMult_33f33f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_matrixCompMult_44f44f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_matrixCompMult_23f23f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_matrixCompMult_32f32f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_matrixCompMult_24f24f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_matrixCompMult_42f42f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_matrixCompMult_34f34f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_matrixCompMult_43f43f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_outerProduct_2f2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_outerProduct_3f3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_outerProduct_4f4f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_outerProduct_3f2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_outerProduct_2f3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_outerProduct_4f2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_outerProduct_2f4f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_outerProduct_4f3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_outerProduct_3f4f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_transpose_22f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_transpose_33f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_transpose_44f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_transpose_32f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_transpose_23f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_transpose_42f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_transpose_24f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_transpose_43f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_transpose_34f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_determinant_22f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_determinant_33f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_determinant_44f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_inverse_22f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_inverse_33f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_inverse_44f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_lessThan_2f2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_lessThan_3f3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_lessThan_4f4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_lessThan_2i2i, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_lessThan_3i3i, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_lessThan_4i4i, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_lessThan_2u2u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_lessThan_3u3u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_lessThan_4u4u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_lessThanEqual_2f2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_lessThanEqual_3f3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_lessThanEqual_4f4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_lessThanEqual_2i2i, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_lessThanEqual_3i3i, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_lessThanEqual_4i4i, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_lessThanEqual_2u2u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_lessThanEqual_3u3u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_lessThanEqual_4u4u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_greaterThan_2f2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_greaterThan_3f3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_greaterThan_4f4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_greaterThan_2i2i, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_greaterThan_3i3i, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_greaterThan_4i4i, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_greaterThan_2u2u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_greaterThan_3u3u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_greaterThan_4u4u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_greaterThanEqual_2f2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_greaterThanEqual_3f3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_greaterThanEqual_4f4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_greaterThanEqual_2i2i, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_greaterThanEqual_3i3i, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_greaterThanEqual_4i4i, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_greaterThanEqual_2u2u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_greaterThanEqual_3u3u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_greaterThanEqual_4u4u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_equal_2f2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_equal_3f3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_equal_4f4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_equal_2i2i, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_equal_3i3i, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_equal_4i4i, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_equal_2u2u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_equal_3u3u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_equal_4u4u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_equal_2b2b, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_equal_3b3b, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_equal_4b4b, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_notEqual_2f2f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_notEqual_3f3f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_notEqual_4f4f, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_notEqual_2i2i, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_notEqual_3i3i, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_notEqual_4i4i, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_notEqual_2u2u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_notEqual_3u3u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_notEqual_4u4u, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_notEqual_2b2b, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_notEqual_3b3b, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_notEqual_4b4b, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_any_2b, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_any_3b, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_any_4b, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_all_2b, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_all_3b, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_all_4b, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_not_2b, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_not_3b, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_not_4b, COMMON_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_bitfieldExtract_iii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_bitfieldExtract_2iii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_bitfieldExtract_3iii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_bitfieldExtract_4iii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_bitfieldExtract_uii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_bitfieldExtract_2uii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_bitfieldExtract_3uii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_bitfieldExtract_4uii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_bitfieldInsert_iiii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_bitfieldInsert_2i2iii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_bitfieldInsert_3i3iii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_bitfieldInsert_4i4iii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_bitfieldInsert_uuii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_bitfieldInsert_2u2uii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_bitfieldInsert_3u3uii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_bitfieldInsert_4u4uii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_bitfieldReverse_i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_bitfieldReverse_2i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_bitfieldReverse_3i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_bitfieldReverse_4i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_bitfieldReverse_u, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_bitfieldReverse_2u, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_bitfieldReverse_3u, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_bitfieldReverse_4u, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_bitCount_i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_bitCount_2i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_bitCount_3i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_bitCount_4i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_bitCount_u, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_bitCount_2u, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_bitCount_3u, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_bitCount_4u, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_findLSB_i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_findLSB_2i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_findLSB_3i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_findLSB_4i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_findLSB_u, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_findLSB_2u, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_findLSB_3u, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_findLSB_4u, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_findMSB_i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_findMSB_2i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_findMSB_3i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_findMSB_4i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_findMSB_u, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_findMSB_2u, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_findMSB_3u, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_findMSB_4u, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_uaddCarry_uuu, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_uaddCarry_2u2u2u, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_uaddCarry_3u3u3u, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_uaddCarry_4u4u4u, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_usubBorrow_uuu, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_usubBorrow_2u2u2u, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_usubBorrow_3u3u3u, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_usubBorrow_4u4u4u, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_umulExtended_uuuu, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_umulExtended_2u2u2u2u, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_umulExtended_3u3u3u3u, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_umulExtended_4u4u4u4u, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imulExtended_iiii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imulExtended_2i2i2i2i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imulExtended_3i3i3i3i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imulExtended_4i4i4i4i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texture2D_s22f, ESSL1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texture2DProj_s23f, ESSL1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texture2DProj_s24f, ESSL1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureCube_sC3f, ESSL1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texture2D_sX2f, ESSL1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texture2DProj_sX3f, ESSL1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texture2DProj_sX4f, ESSL1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texture2DRect_sR2f, ESSL1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texture2DRectProj_sR3f, ESSL1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texture2DRectProj_sR4f, ESSL1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texture2DGradEXT_s22f2f2f, ESSL1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texture2DProjGradEXT_s23f2f2f, ESSL1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texture2DProjGradEXT_s24f2f2f, ESSL1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureCubeGradEXT_sC3f3f3f, ESSL1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texture2D_s22ff, ESSL1_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_texture2DProj_s23ff, ESSL1_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_texture2DProj_s24ff, ESSL1_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureCube_sC3ff, ESSL1_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_dFdx_f_ESSL3, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_dFdx_f, ESSL1_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_dFdx_2f_ESSL3, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_dFdx_2f, ESSL1_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_dFdx_3f_ESSL3, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_dFdx_3f, ESSL1_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_dFdx_4f_ESSL3, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_dFdx_4f, ESSL1_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_dFdy_f_ESSL3, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_dFdy_f, ESSL1_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_dFdy_2f_ESSL3, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_dFdy_2f, ESSL1_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_dFdy_3f_ESSL3, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_dFdy_3f, ESSL1_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_dFdy_4f_ESSL3, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_dFdy_4f, ESSL1_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_fwidth_f_ESSL3, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_fwidth_f, ESSL1_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_fwidth_2f_ESSL3, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_fwidth_2f, ESSL1_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_fwidth_3f_ESSL3, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_fwidth_3f, ESSL1_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_fwidth_4f_ESSL3, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_fwidth_4f, ESSL1_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_texture2DLodEXT_s22ff, ESSL1_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_texture2DProjLodEXT_s23ff, ESSL1_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_texture2DProjLodEXT_s24ff, ESSL1_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureCubeLodEXT_sC3ff, ESSL1_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_texture2DLod_s22ff, ESSL1_BUILTINS, kBuiltInVertexShader},
+    {&kFunction_texture2DProjLod_s23ff, ESSL1_BUILTINS, kBuiltInVertexShader},
+    {&kFunction_texture2DProjLod_s24ff, ESSL1_BUILTINS, kBuiltInVertexShader},
+    {&kFunction_textureCubeLod_sC3ff, ESSL1_BUILTINS, kBuiltInVertexShader},
+    {&kFunction_texture_s22f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texture_is22f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texture_us22f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texture_s33f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texture_is33f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texture_us33f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texture_sC3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texture_isC3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texture_usC3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texture_sA3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texture_isA3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texture_usA3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProj_s23f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProj_is23f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProj_us23f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProj_s24f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProj_is24f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProj_us24f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProj_s34f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProj_is34f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProj_us34f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureLod_s22ff, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureLod_is22ff, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureLod_us22ff, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureLod_s33ff, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureLod_is33ff, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureLod_us33ff, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureLod_sC3ff, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureLod_isC3ff, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureLod_usC3ff, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureLod_sA3ff, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureLod_isA3ff, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureLod_usA3ff, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texture_sX2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProj_sX3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProj_sX4f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texture_sY2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProj_sY3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProj_sY4f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_rgb_2_yuv_3fy, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_yuv_2_rgb_3fy, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texture_s22ff, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_texture_is22ff, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_texture_us22ff, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_texture_s33ff, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_texture_is33ff, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_texture_us33ff, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_texture_sC3ff, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_texture_isC3ff, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_texture_usC3ff, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_texture_sA3ff, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_texture_isA3ff, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_texture_usA3ff, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureProj_s23ff, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureProj_is23ff, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureProj_us23ff, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureProj_s24ff, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureProj_is24ff, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureProj_us24ff, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureProj_s34ff, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureProj_is34ff, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureProj_us34ff, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_texture_sX2ff, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureProj_sX3ff, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureProj_sX4ff, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_texture_sY2ff, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureProj_sY3ff, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureProj_sY4ff, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_texture_s2s3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texture_sCs4f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texture_sAs4f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProj_s2s4f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureLod_s2s3ff, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texture_s2s3ff, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_texture_sCs4ff, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureProj_s2s4ff, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureSize_s2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureSize_is2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureSize_us2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureSize_s3i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureSize_is3i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureSize_us3i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureSize_sCi, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureSize_isCi, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureSize_usCi, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureSize_sAi, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureSize_isAi, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureSize_usAi, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureSize_s2si, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureSize_sCsi, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureSize_sAsi, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureSize_sM, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureSize_isM, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureSize_usM, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureSize_sXi, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureSize_sYi, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureOffset_s22f2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureOffset_is22f2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureOffset_us22f2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureOffset_s33f3i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureOffset_is33f3i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureOffset_us33f3i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureOffset_s2s3f2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureOffset_sA3f2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureOffset_isA3f2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureOffset_usA3f2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureOffset_s22f2if, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureOffset_is22f2if, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureOffset_us22f2if, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureOffset_s33f3if, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureOffset_is33f3if, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureOffset_us33f3if, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureOffset_s2s3f2if, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureOffset_sA3f2if, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureOffset_isA3f2if, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureOffset_usA3f2if, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureProjOffset_s23f2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjOffset_is23f2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjOffset_us23f2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjOffset_s24f2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjOffset_is24f2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjOffset_us24f2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjOffset_s34f3i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjOffset_is34f3i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjOffset_us34f3i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjOffset_s2s4f2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjOffset_s23f2if, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureProjOffset_is23f2if, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureProjOffset_us23f2if, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureProjOffset_s24f2if, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureProjOffset_is24f2if, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureProjOffset_us24f2if, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureProjOffset_s34f3if, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureProjOffset_is34f3if, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureProjOffset_us34f3if, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureProjOffset_s2s4f2if, ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {&kFunction_textureLodOffset_s22ff2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureLodOffset_is22ff2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureLodOffset_us22ff2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureLodOffset_s33ff3i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureLodOffset_is33ff3i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureLodOffset_us33ff3i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureLodOffset_s2s3ff2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureLodOffset_sA3ff2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureLodOffset_isA3ff2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureLodOffset_usA3ff2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjLod_s23ff, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjLod_is23ff, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjLod_us23ff, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjLod_s24ff, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjLod_is24ff, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjLod_us24ff, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjLod_s34ff, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjLod_is34ff, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjLod_us34ff, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjLod_s2s4ff, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjLodOffset_s23ff2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjLodOffset_is23ff2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjLodOffset_us23ff2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjLodOffset_s24ff2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjLodOffset_is24ff2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjLodOffset_us24ff2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjLodOffset_s34ff3i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjLodOffset_is34ff3i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjLodOffset_us34ff3i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjLodOffset_s2s4ff2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texelFetch_s22ii, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texelFetch_is22ii, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texelFetch_us22ii, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texelFetch_s33ii, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texelFetch_is33ii, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texelFetch_us33ii, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texelFetch_sA3ii, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texelFetch_isA3ii, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texelFetch_usA3ii, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texelFetch_sX2ii, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texelFetch_sY2ii, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texelFetchOffset_s22ii2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texelFetchOffset_is22ii2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texelFetchOffset_us22ii2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texelFetchOffset_s33ii3i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texelFetchOffset_is33ii3i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texelFetchOffset_us33ii3i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texelFetchOffset_sA3ii2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texelFetchOffset_isA3ii2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texelFetchOffset_usA3ii2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGrad_s22f2f2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGrad_is22f2f2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGrad_us22f2f2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGrad_s33f3f3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGrad_is33f3f3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGrad_us33f3f3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGrad_sC3f3f3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGrad_isC3f3f3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGrad_usC3f3f3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGrad_s2s3f2f2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGrad_sCs4f3f3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGrad_sA3f2f2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGrad_isA3f2f2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGrad_usA3f2f2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGrad_sAs4f2f2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGradOffset_s22f2f2f2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGradOffset_is22f2f2f2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGradOffset_us22f2f2f2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGradOffset_s33f3f3f3i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGradOffset_is33f3f3f3i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGradOffset_us33f3f3f3i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGradOffset_s2s3f2f2f2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGradOffset_sA3f2f2f2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGradOffset_isA3f2f2f2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGradOffset_usA3f2f2f2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGradOffset_sAs4f2f2f2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjGrad_s23f2f2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjGrad_is23f2f2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjGrad_us23f2f2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjGrad_s24f2f2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjGrad_is24f2f2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjGrad_us24f2f2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjGrad_s34f3f3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjGrad_is34f3f3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjGrad_us34f3f3f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjGrad_s2s4f2f2f, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjGradOffset_s23f2f2f2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjGradOffset_is23f2f2f2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjGradOffset_us23f2f2f2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjGradOffset_s24f2f2f2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjGradOffset_is24f2f2f2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjGradOffset_us24f2f2f2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjGradOffset_s34f3f3f3i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjGradOffset_is34f3f3f3i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjGradOffset_us34f3f3f3i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureProjGradOffset_s2s4f2f2f2i, ESSL3_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_atomicCounter_a, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_atomicCounterIncrement_a, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_atomicCounterDecrement_a, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_atomicAdd_uu, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_atomicAdd_ii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_atomicMin_uu, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_atomicMin_ii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_atomicMax_uu, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_atomicMax_ii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_atomicAnd_uu, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_atomicAnd_ii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_atomicOr_uu, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_atomicOr_ii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_atomicXor_uu, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_atomicXor_ii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_atomicExchange_uu, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_atomicExchange_ii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_atomicCompSwap_uuu, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_atomicCompSwap_iii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageStore_I22i4f, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageStore_iI22i4i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageStore_uI22i4u, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageStore_I33i4f, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageStore_iI33i4i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageStore_uI33i4u, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageStore_IA3i4f, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageStore_iIA3i4i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageStore_uIA3i4u, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageStore_Ic3i4f, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageStore_iIc3i4i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageStore_uIc3i4u, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageLoad_I22i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageLoad_iI22i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageLoad_uI22i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageLoad_I33i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageLoad_iI33i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageLoad_uI33i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageLoad_IA3i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageLoad_iIA3i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageLoad_uIA3i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageLoad_Ic3i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageLoad_iIc3i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageLoad_uIc3i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageSize_I2, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageSize_iI2, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageSize_uI2, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageSize_I3, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageSize_iI3, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageSize_uI3, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageSize_IA, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageSize_iIA, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageSize_uIA, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageSize_Ic, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageSize_iIc, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_imageSize_uIc, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_memoryBarrier, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_memoryBarrierAtomicCounter, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_memoryBarrierBuffer, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_memoryBarrierImage, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texelFetch_sM2ii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texelFetch_isM2ii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_texelFetch_usM2ii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGather_s22f, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGather_is22f, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGather_us22f, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGather_s22fi, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGather_is22fi, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGather_us22fi, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGather_sA3f, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGather_isA3f, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGather_usA3f, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGather_sA3fi, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGather_isA3fi, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGather_usA3fi, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGather_sC3f, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGather_isC3f, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGather_usC3f, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGather_sC3fi, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGather_isC3fi, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGather_usC3fi, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGather_s2s2f, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGather_s2s2ff, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGather_sAs3f, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGather_sAs3ff, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGather_sCs3f, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGather_sCs3ff, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGatherOffset_s22f2i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGatherOffset_is22f2i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGatherOffset_us22f2i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGatherOffset_s22f2ii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGatherOffset_is22f2ii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGatherOffset_us22f2ii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGatherOffset_sA3f2i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGatherOffset_isA3f2i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGatherOffset_usA3f2i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGatherOffset_sA3f2ii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGatherOffset_isA3f2ii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGatherOffset_usA3f2ii, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGatherOffset_s2s2ff2i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_textureGatherOffset_sAs3ff2i, ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {&kFunction_barrier, ESSL3_1_BUILTINS, kBuiltInComputeShader},
+    {&kFunction_memoryBarrierShared, ESSL3_1_BUILTINS, kBuiltInComputeShader},
+    {&kFunction_groupMemoryBarrier, ESSL3_1_BUILTINS, kBuiltInComputeShader},
+    {&kFunction_EmitVertex, ESSL3_1_BUILTINS, kBuiltInGeometryShaderEXT},
+    {&kFunction_EndPrimitive, ESSL3_1_BUILTINS, kBuiltInGeometryShaderEXT},
+};
+
+constexpr unsigned short kMangledDisplacements[] = {
+    13, 2, 2, 3, 9, 2, 0, 2, 1, 2, 1, 0,
+    1, 2, 1, 2, 8, 2, 4, 0, 4, 10, 6, 2,
+    2, 3, 6, 2, 3, 2, 9, 1, 4, 3, 4, 5,
+    2, 4, 2, 4, 3, 1, 4, 1, 1, 11, 5, 0,
+    1, 0, 6, 0, 6, 1, 2, 0, 1, 0, 4, 1,
+    0, 2, 1, 3, 1, 1, 1, 1, 1, 0, 1, 0,
+    1, 2, 6, 2, 1, 5, 0, 2, 0, 1, 2, 1,
+    3, 0, 1, 0, 11, 3, 1, 2, 3, 0, 10, 4,
+    4, 2, 7, 1, 3, 2, 4, 2, 2, 6, 1, 4,
+    6, 0, 8, 10, 0, 1, 2, 1, 2, 1, 1, 3,
+    6, 1, 6, 15, 5, 4, 2, 4, 8, 3, 1, 1,
+    0, 3, 4, 2, 7, 3, 2, 8, 5, 3, 10, 4,
+    4, 8, 1, 1, 1, 9, 0, 0, 2, 2, 2, 2,
+    1, 2, 3, 9, 2, 2, 1, 14, 0, 1, 2, 2,
+    1, 1, 5, 5, 4, 0, 9, 13, 1, 8, 1, 1,
+    6, 3, 10, 0, 6, 8, 5, 1, 7, 3, 4, 4,
+    3, 0, 5, 1, 4, 3, 8, 15, 6, 2, 6, 0,
+    0, 3, 4, 1, 1, 4, 11, 15, 10, 1, 3, 1,
+    4, 3, 1, 4, 1, 2, 1, 1, 3, 0, 13, 1,
+    3, 3, 3, 1, 0, 1, 4, 1, 5, 3, 0, 1,
+    4, 5, 1, 1, 1, 4, 1, 1, 1, 3, 4, 1,
+    2, 3, 1, 5, 0, 1, 1, 4, 5, 1, 1, 7,
+    2, 0, 2, 7, 3, 7, 0, 3, 0, 2, 1, 1,
+    17, 14, 1, 6, 4, 7, 1, 6, 5, 7, 2, 6,
+    1, 24, 14, 9, 1, 2, 2, 2, 13, 15, 1, 1,
+    5, 13, 2, 7, 5, 2, 0, 8, 8, 3, 3, 10,
+    0, 0, 2, 11, 6, 1, 11, 5, 0, 6, 4, 11,
+    0, 1, 2, 12, 16, 3, 2, 1, 1, 0, 4, 14,
+    8, 0, 3, 1, 13, 8, 5, 2, 5, 3, 3, 1,
+    3, 5, 1, 20, 3, 3, 15, 3, 9, 6, 3, 10,
+    0, 0, 3, 9, 4, 12, 2, 5, 5, 8, 0, 0,
+    9, 7, 0, 14, 0, 1, 4, 3, 14, 8, 6, 42,
+    3, 11, 6, 3, 3, 1, 33, 2, 1, 0, 2, 11,
+    0, 0, 27, 8, 3, 26, 0, 2, 7, 5, 1, 4,
+    0, 4, 1, 17, 10, 1, 4, 3, 2, 3, 13,
+};
+
+constexpr BuiltInHashSlot kMangledSlots[] = {
+    {"textureGather(us2;2f;", 810, 1},
+    {nullptr, 0, 0},
+    {"textureGather(isA;3f;", 815, 1},
+    {"findMSB(4i;", 443, 1},
+    {"floor(2f;", 105, 1},
+    {"textureProj(is2;4f;f;", 571, 1},
+    {"distance(2f;2f;", 274, 1},
+    {"notEqual(4i;4i;", 384, 1},
+    {"textureGather(isC;3f;", 821, 1},
+    {"textureProjOffset(is2;3f;2i;f;", 641, 1},
+    {"texture(sX;2f;f;", 576, 1},
+    {nullptr, 0, 0},
+    {"floor(4f;", 107, 1},
+    {"findMSB(3i;", 442, 1},
+    {"textureLodOffset(sA;3f;f;2i;", 657, 1},
+    {"textureOffset(s2s;3f;2i;", 616, 1},
+    {"modf(4f;4f;", 226, 1},
+    {"unpackSnorm2x16(u;", 262, 1},
+    {nullptr, 0, 0},
+    {"step(f;f;", 209, 1},
+    {"mod(f;f;", 128, 1},
+    {"textureGather(sAs;3f;f;", 829, 1},
+    {"textureOffset(s2s;3f;2i;f;", 626, 1},
+    {"clamp(4u;u;u;", 194, 1},
+    {"findMSB(2i;", 441, 1},
+    {"textureGrad(s3;3f;3f;3f;", 703, 1},
+    {"notEqual(3i;3i;", 383, 1},
+    {"lessThan(2i;2i;", 334, 1},
+    {"textureProj(us2;4f;", 531, 1},
+    {"textureGatherOffset(usA;3f;2i;", 840, 1},
+    {"tan(2f;", 17, 1},
+    {nullptr, 0, 0},
+    {"degrees(3f;", 6, 1},
+    {"findMSB(u;", 444, 1},
+    {"atomicCounter(a;", 746, 1},
+    {"outerProduct(2f;3f;", 311, 1},
+    {"textureProjLodOffset(us2;4f;f;2i;", 675, 1},
+    {"findLSB(4i;", 435, 1},
+    {"sinh(3f;", 38, 1},
+    {nullptr, 0, 0},
+    {"textureOffset(usA;3f;2i;", 619, 1},
+    {"packUnorm2x16(2f;", 260, 1},
+    {"matrixCompMult(33f;33f;", 299, 1},
+    {"smoothstep(f;f;f;", 216, 1},
+    {"sign(3i;", 102, 1},
+    {nullptr, 0, 0},
+    {"dFdx(3f;", 486, 2},
+    {"unpackHalf2x16(u;", 264, 1},
+    {"bitCount(3i;", 426, 1},
+    {"exp2(3f;", 74, 1},
+    {"greaterThanEqual(4i;4i;", 363, 1},
+    {"notEqual(3f;3f;", 380, 1},
+    {"clamp(2i;i;i;", 185, 1},
+    {"mix(4f;4f;4f;", 204, 1},
+    {"all(2b;", 394, 1},
+    {nullptr, 0, 0},
+    {"textureGradOffset(s2;2f;2f;2f;2i;", 715, 1},
+    {"textureGradOffset(s2s;3f;2f;2f;2i;", 721, 1},
+    {"textureSize(is2;i;", 591, 1},
+    {nullptr, 0, 0},
+    {"textureGather(s2s;2f;", 826, 1},
+    {"bitfieldExtract(i;i;i;", 400, 1},
+    {"dFdy(4f;", 496, 2},
+    {"lessThanEqual(4f;4f;", 342, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"texture(sCs;4f;f;", 588, 1},
+    {"texture(us2;2f;", 516, 1},
+    {"not(2b;", 397, 1},
+    {nullptr, 0, 0},
+    {"textureProjGradOffset(s2s;4f;2f;2f;2i;", 745, 1},
+    {"lessThan(4f;4f;", 333, 1},
+    {"ceil(4f;", 123, 1},
+    {"textureProjOffset(s3;4f;3i;f;", 646, 1},
+    {"bitfieldInsert(i;i;i;i;", 408, 1},
+    {nullptr, 0, 0},
+    {"textureProj(us3;4f;f;", 575, 1},
+    {"texelFetchOffset(us3;3i;i;3i;", 696, 1},
+    {"acosh(2f;", 53, 1},
+    {"texelFetch(us3;3i;i;", 685, 1},
+    {"min(4u;4u;", 152, 1},
+    {"clamp(f;f;f;", 177, 1},
+    {nullptr, 0, 0},
+    {"isinf(f;", 231, 1},
+    {"exp2(f;", 72, 1},
+    {"lessThanEqual(3i;3i;", 344, 1},
+    {"mix(3f;3f;3f;", 203, 1},
+    {"clamp(2u;2u;2u;", 195, 1},
+    {nullptr, 0, 0},
+    {"texture(sC;3f;", 520, 1},
+    {"max(4i;4i;", 166, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"atan(4f;", 35, 1},
+    {"normalize(4f;", 285, 1},
+    {"textureProjOffset(us2;3f;2i;f;", 642, 1},
+    {"yuv_2_rgb(3f;y;", 554, 1},
+    {"lessThan(2u;2u;", 337, 1},
+    {"atomicAdd(u;u;", 749, 1},
+    {"uaddCarry(4u;4u;4u;", 451, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"textureSize(usC;i;", 598, 1},
+    {"textureGather(s2s;2f;f;", 827, 1},
+    {"abs(f;", 88, 1},
+    {"textureProjLod(is2;4f;f;", 664, 1},
+    {"textureGatherOffset(us2;2f;2i;", 834, 1},
+    {"cos(2f;", 13, 1},
+    {"smoothstep(4f;4f;4f;", 219, 1},
+    {"imageLoad(uI3;3i;", 782, 1},
+    {"imageSize(iIc;", 799, 1},
+    {"lessThanEqual(4u;4u;", 348, 1},
+    {"textureProjOffset(us3;4f;3i;f;", 648, 1},
+    {"modf(3f;3f;", 225, 1},
+    {"acos(4f;", 27, 1},
+    {"greaterThan(4u;4u;", 357, 1},
+    {"sqrt(2f;", 81, 1},
+    {"textureGather(s2;2f;i;", 811, 1},
+    {"sinh(2f;", 37, 1},
+    {"transpose(32f;", 319, 1},
+    {"length(4f;", 272, 1},
+    {nullptr, 0, 0},
+    {"matrixCompMult(24f;24f;", 303, 1},
+    {"textureProj(s2;4f;f;", 570, 1},
+    {"inverse(33f;", 329, 1},
+    {"texture(is2;2f;f;", 556, 1},
+    {"uintBitsToFloat(2u;", 248, 1},
+    {"texelFetch(s3;3i;i;", 683, 1},
+    {"texture(usA;3f;", 525, 1},
+    {"texture2DProjGradEXT(s2;3f;2f;2f;", 475, 1},
+    {"equal(4i;4i;", 372, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"notEqual(3u;3u;", 386, 1},
+    {"max(2f;f;", 157, 1},
+    {"min(4f;4f;", 141, 1},
+    {"textureSize(s2;i;", 590, 1},
+    {"max(3i;i;", 168, 1},
+    {"mod(3f;3f;", 133, 1},
+    {"texelFetch(isM;2i;i;", 806, 1},
+    {nullptr, 0, 0},
+    {"greaterThanEqual(3u;3u;", 365, 1},
+    {"mix(2f;2f;2f;", 202, 1},
+    {nullptr, 0, 0},
+    {"textureGather(isA;3f;i;", 818, 1},
+    {"frexp(2f;2i;", 252, 1},
+    {"sqrt(4f;", 83, 1},
+    {"textureProjOffset(us2;4f;2i;", 635, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"textureProjLodOffset(s2;4f;f;2i;", 673, 1},
+    {"findLSB(3u;", 438, 1},
+    {"min(2f;f;", 136, 1},
+    {"clamp(4i;i;i;", 187, 1},
+    {"dFdx(f;", 482, 2},
+    {"textureOffset(is2;2f;2i;", 611, 1},
+    {nullptr, 0, 0},
+    {"mix(f;f;f;", 198, 1},
+    {"textureGrad(s2;2f;2f;2f;", 700, 1},
+    {"texture(us2;2f;f;", 557, 1},
+    {"radians(4f;", 3, 1},
+    {"cos(3f;", 14, 1},
+    {"determinant(33f;", 326, 1},
+    {"texture2DProjLod(s2;3f;f;", 511, 1},
+    {"normalize(f;", 282, 1},
+    {nullptr, 0, 0},
+    {"memoryBarrierShared(", 847, 1},
+    {"textureGrad(sC;3f;3f;3f;", 706, 1},
+    {"textureProjOffset(s2s;4f;2i;f;", 649, 1},
+    {"equal(3f;3f;", 368, 1},
+    {nullptr, 0, 0},
+    {"reflect(2f;2f;", 291, 1},
+    {"sign(i;", 100, 1},
+    {"min(4i;4i;", 145, 1},
+    {"sign(4f;", 99, 1},
+    {"textureGradOffset(us2;2f;2f;2f;2i;", 717, 1},
+    {"textureProjGradOffset(us3;4f;3f;3f;3i;", 744, 1},
+    {"texture2DProjLodEXT(s2;3f;f;", 507, 1},
+    {"bitfieldInsert(2u;2u;i;i;", 413, 1},
+    {nullptr, 0, 0},
+    {"textureSize(sA;i;", 599, 1},
+    {"trunc(2f;", 109, 1},
+    {"clamp(4u;4u;4u;", 197, 1},
+    {"textureGradOffset(s3;3f;3f;3f;3i;", 718, 1},
+    {"textureGather(usC;3f;i;", 825, 1},
+    {nullptr, 0, 0},
+    {"min(4u;u;", 155, 1},
+    {"refract(f;f;f;", 294, 1},
+    {nullptr, 0, 0},
+    {"textureSize(sAs;i;", 604, 1},
+    {"texture(sCs;4f;", 583, 1},
+    {"textureProjGrad(us2;3f;2f;2f;", 728, 1},
+    {"min(3u;3u;", 151, 1},
+    {"texture(isC;3f;", 521, 1},
+    {"log(3f;", 70, 1},
+    {"texelFetch(usM;2i;i;", 807, 1},
+    {"textureProjLodOffset(s3;4f;f;3i;", 676, 1},
+    {"uaddCarry(u;u;u;", 448, 1},
+    {"bitfieldInsert(2i;2i;i;i;", 409, 1},
+    {"textureProjLodOffset(is2;4f;f;2i;", 674, 1},
+    {"packHalf2x16(2f;", 261, 1},
+    {"sin(4f;", 11, 1},
+    {"smoothstep(2f;2f;2f;", 217, 1},
+    {"clamp(u;u;u;", 191, 1},
+    {nullptr, 0, 0},
+    {"textureOffset(s2;2f;2i;f;", 620, 1},
+    {"textureProj(s2;3f;f;", 567, 1},
+    {"lessThan(3u;3u;", 338, 1},
+    {"texelFetch(sX;2i;i;", 689, 1},
+    {"uaddCarry(2u;2u;2u;", 449, 1},
+    {"texture2DProj(s2;4f;f;", 480, 1},
+    {"tanh(4f;", 47, 1},
+    {"bitCount(2i;", 425, 1},
+    {"max(4f;4f;", 162, 1},
+    {"reflect(f;f;", 290, 1},
+    {"mix(2f;2f;f;", 199, 1},
+    {"textureGradOffset(us3;3f;3f;3f;3i;", 720, 1},
+    {"tanh(2f;", 45, 1},
+    {"barrier(", 846, 1},
+    {"acos(f;", 24, 1},
+    {"max(2u;2u;", 171, 1},
+    {"imageStore(I2;2i;4f;", 765, 1},
+    {"max(2f;2f;", 160, 1},
+    {"floatBitsToUint(3f;", 241, 1},
+    {"outerProduct(3f;4f;", 315, 1},
+    {"textureProjGrad(us3;4f;3f;3f;", 734, 1},
+    {"sinh(f;", 36, 1},
+    {"faceforward(4f;4f;4f;", 289, 1},
+    {"textureLod(s3;3f;f;", 538, 1},
+    {"transpose(24f;", 322, 1},
+    {"imageSize(I2;", 789, 1},
+    {"min(3i;i;", 147, 1},
+    {nullptr, 0, 0},
+    {"textureOffset(sA;3f;2i;", 617, 1},
+    {"bitfieldExtract(2i;i;i;", 401, 1},
+    {"textureProjGradOffset(is3;4f;3f;3f;3i;", 743, 1},
+    {"log(f;", 68, 1},
+    {"textureProjLod(s2;4f;f;", 663, 1},
+    {"exp(4f;", 67, 1},
+    {"textureSize(sC;i;", 596, 1},
+    {nullptr, 0, 0},
+    {"notEqual(2u;2u;", 385, 1},
+    {nullptr, 0, 0},
+    {"ceil(2f;", 121, 1},
+    {"modf(2f;2f;", 224, 1},
+    {"greaterThanEqual(4f;4f;", 360, 1},
+    {"equal(3b;3b;", 377, 1},
+    {"imageSize(uI2;", 791, 1},
+    {"umulExtended(3u;3u;3u;3u;", 458, 1},
+    {"texture2DGradEXT(s2;2f;2f;2f;", 474, 1},
+    {nullptr, 0, 0},
+    {"textureGatherOffset(s2;2f;2i;i;", 835, 1},
+    {"textureProj(s2s;4f;", 585, 1},
+    {"textureGather(sC;3f;i;", 823, 1},
+    {"mod(2f;f;", 129, 1},
+    {nullptr, 0, 0},
+    {"uintBitsToFloat(4u;", 250, 1},
+    {"textureLodOffset(usA;3f;f;2i;", 659, 1},
+    {"step(f;4f;", 215, 1},
+    {"imageLoad(I3;3i;", 780, 1},
+    {"lessThanEqual(2f;2f;", 340, 1},
+    {"any(3b;", 392, 1},
+    {"texelFetch(usA;3i;i;", 688, 1},
+    {"imageLoad(uI2;2i;", 779, 1},
+    {"textureProj(s3;4f;f;", 573, 1},
+    {"texture(s2;2f;f;", 555, 1},
+    {"greaterThanEqual(3i;3i;", 362, 1},
+    {"textureLodOffset(s2;2f;f;2i;", 650, 1},
+    {"imageSize(uIA;", 797, 1},
+    {"notEqual(2b;2b;", 388, 1},
+    {"imageSize(uI3;", 794, 1},
+    {"findMSB(4u;", 447, 1},
+    {"textureGradOffset(usA;3f;2f;2f;2i;", 724, 1},
+    {"not(3b;", 398, 1},
+    {nullptr, 0, 0},
+    {"cos(4f;", 15, 1},
+    {"bitfieldReverse(2u;", 421, 1},
+    {"sin(f;", 8, 1},
+    {"textureLod(is3;3f;f;", 539, 1},
+    {"texture2DRectProj(sR;4f;", 473, 1},
+    {"textureLod(us2;2f;f;", 537, 1},
+    {"tanh(3f;", 46, 1},
+    {"step(2f;2f;", 210, 1},
+    {"imageLoad(iI3;3i;", 781, 1},
+    {nullptr, 0, 0},
+    {"atomicCompSwap(u;u;u;", 763, 1},
+    {"fwidth(2f;", 500, 2},
+    {"greaterThan(4f;4f;", 351, 1},
+    {"tanh(f;", 44, 1},
+    {"textureGather(sCs;3f;", 830, 1},
+    {"texture(sAs;4f;", 584, 1},
+    {nullptr, 0, 0},
+    {"bitCount(4i;", 427, 1},
+    {nullptr, 0, 0},
+    {"cosh(3f;", 42, 1},
+    {"floatBitsToInt(3f;", 237, 1},
+    {"bitfieldReverse(3u;", 422, 1},
+    {"frexp(f;i;", 251, 1},
+    {nullptr, 0, 0},
+    {"textureGather(sAs;3f;", 828, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"bitfieldExtract(3u;i;i;", 406, 1},
+    {nullptr, 0, 0},
+    {"imageLoad(iI2;2i;", 778, 1},
+    {"intBitsToFloat(4i;", 246, 1},
+    {"imageSize(iIA;", 796, 1},
+    {"textureProjGradOffset(us2;4f;2f;2f;2i;", 741, 1},
+    {"bitfieldExtract(2u;i;i;", 405, 1},
+    {"unpackSnorm4x8(u;", 268, 1},
+    {"packSnorm4x8(4f;", 266, 1},
+    {"textureGrad(isA;3f;2f;2f;", 712, 1},
+    {"sqrt(f;", 80, 1},
+    {"atanh(3f;", 58, 1},
+    {nullptr, 0, 0},
+    {"findMSB(i;", 440, 1},
+    {"texelFetch(is2;2i;i;", 681, 1},
+    {"textureLodOffset(is3;3f;f;3i;", 654, 1},
+    {"min(3i;3i;", 144, 1},
+    {"max(2i;i;", 167, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"isnan(2f;", 228, 1},
+    {"fwidth(3f;", 502, 2},
+    {"umulExtended(2u;2u;2u;2u;", 457, 1},
+    {"textureProj(sX;4f;f;", 578, 1},
+    {"asin(2f;", 21, 1},
+    {"matrixCompMult(43f;43f;", 306, 1},
+    {"textureGatherOffset(sAs;3f;f;2i;", 845, 1},
+    {"textureProj(sX;4f;", 549, 1},
+    {"textureProjOffset(s3;4f;3i;", 636, 1},
+    {"textureProj(sY;3f;", 551, 1},
+    {"max(4u;4u;", 173, 1},
+    {"texture2DProjLod(s2;4f;f;", 512, 1},
+    {nullptr, 0, 0},
+    {"bitfieldReverse(3i;", 418, 1},
+    {"max(3i;3i;", 165, 1},
+    {nullptr, 0, 0},
+    {"tan(4f;", 19, 1},
+    {"texture2DProjGradEXT(s2;4f;2f;2f;", 476, 1},
+    {"floatBitsToUint(4f;", 242, 1},
+    {"textureGradOffset(sAs;4f;2f;2f;2i;", 725, 1},
+    {"textureLodOffset(is2;2f;f;2i;", 651, 1},
+    {nullptr, 0, 0},
+    {"matrixCompMult(22f;22f;", 298, 1},
+    {"textureOffset(isA;3f;2i;f;", 628, 1},
+    {"texture(is3;3f;f;", 559, 1},
+    {"textureOffset(sA;3f;2i;f;", 627, 1},
+    {nullptr, 0, 0},
+    {"textureGatherOffset(sA;3f;2i;", 838, 1},
+    {"min(2u;u;", 153, 1},
+    {"bitfieldInsert(4i;4i;i;i;", 411, 1},
+    {"refract(2f;2f;f;", 295, 1},
+    {"textureGather(sC;3f;", 820, 1},
+    {nullptr, 0, 0},
+    {"greaterThanEqual(4u;4u;", 366, 1},
+    {"dFdy(f;", 490, 2},
+    {"floatBitsToInt(f;", 235, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"intBitsToFloat(3i;", 245, 1},
+    {nullptr, 0, 0},
+    {"texture2DProj(sX;3f;", 469, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"textureProj(is2;4f;", 530, 1},
+    {"imulExtended(4i;4i;4i;4i;", 463, 1},
+    {"textureGrad(usA;3f;2f;2f;", 713, 1},
+    {"textureProj(is2;3f;", 527, 1},
+    {"textureGrad(usC;3f;3f;3f;", 708, 1},
+    {nullptr, 0, 0},
+    {"textureLod(s2s;3f;f;", 586, 1},
+    {"textureProjOffset(s2s;4f;2i;", 639, 1},
+    {nullptr, 0, 0},
+    {"textureOffset(isA;3f;2i;", 618, 1},
+    {nullptr, 0, 0},
+    {"exp(f;", 64, 1},
+    {"atomicXor(i;i;", 760, 1},
+    {"notEqual(2f;2f;", 379, 1},
+    {"atanh(f;", 56, 1},
+    {"greaterThan(4i;4i;", 354, 1},
+    {nullptr, 0, 0},
+    {"lessThan(3i;3i;", 335, 1},
+    {"textureSize(sCs;i;", 603, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"greaterThan(2i;2i;", 352, 1},
+    {"textureLodOffset(us3;3f;f;3i;", 655, 1},
+    {"round(3f;", 114, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"mix(3f;3f;3b;", 207, 1},
+    {"imageStore(iIA;3i;4i;", 772, 1},
+    {"imageLoad(IA;3i;", 783, 1},
+    {"bitfieldReverse(4i;", 419, 1},
+    {"log(4f;", 71, 1},
+    {"textureProjLodOffset(is2;3f;f;2i;", 671, 1},
+    {"notEqual(4b;4b;", 390, 1},
+    {"textureGrad(us3;3f;3f;3f;", 705, 1},
+    {nullptr, 0, 0},
+    {"textureGrad(isC;3f;3f;3f;", 707, 1},
+    {"log(2f;", 69, 1},
+    {"max(f;f;", 156, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"textureProjOffset(is3;4f;3i;", 637, 1},
+    {"textureProjOffset(us3;4f;3i;", 638, 1},
+    {nullptr, 0, 0},
+    {"log2(4f;", 79, 1},
+    {nullptr, 0, 0},
+    {"ldexp(4f;4i;", 258, 1},
+    {"max(2i;2i;", 164, 1},
+    {"textureSize(usA;i;", 601, 1},
+    {"step(f;3f;", 214, 1},
+    {"ldexp(2f;2i;", 256, 1},
+    {"packSnorm2x16(2f;", 259, 1},
+    {"atomicExchange(i;i;", 762, 1},
+    {"findLSB(4u;", 439, 1},
+    {"textureProj(us2;4f;f;", 572, 1},
+    {"step(4f;4f;", 212, 1},
+    {"clamp(i;i;i;", 184, 1},
+    {"textureGatherOffset(is2;2f;2i;", 833, 1},
+    {"umulExtended(4u;4u;4u;4u;", 459, 1},
+    {"textureProj(s2;4f;", 529, 1},
+    {"pow(f;f;", 60, 1},
+    {"texelFetch(sA;3i;i;", 686, 1},
+    {"texture(isA;3f;", 524, 1},
+    {"smoothstep(f;f;2f;", 220, 1},
+    {"textureGradOffset(is3;3f;3f;3f;3i;", 719, 1},
+    {"distance(3f;3f;", 275, 1},
+    {nullptr, 0, 0},
+    {"radians(f;", 0, 1},
+    {"textureProjLod(is2;3f;f;", 661, 1},
+    {"equal(2f;2f;", 367, 1},
+    {"umulExtended(u;u;u;u;", 456, 1},
+    {nullptr, 0, 0},
+    {"textureProj(s2s;4f;f;", 589, 1},
+    {"lessThan(4u;4u;", 339, 1},
+    {"trunc(3f;", 110, 1},
+    {nullptr, 0, 0},
+    {"imageStore(uIA;3i;4u;", 773, 1},
+    {nullptr, 0, 0},
+    {"isinf(2f;", 232, 1},
+    {nullptr, 0, 0},
+    {"cos(f;", 12, 1},
+    {"ceil(3f;", 122, 1},
+    {nullptr, 0, 0},
+    {"textureGather(s2;2f;", 808, 1},
+    {"findLSB(2u;", 437, 1},
+    {nullptr, 0, 0},
+    {"matrixCompMult(32f;32f;", 302, 1},
+    {"textureProjLod(is3;4f;f;", 667, 1},
+    {"atomicMin(i;i;", 752, 1},
+    {"imageSize(iI3;", 793, 1},
+    {"texture(sX;2f;", 547, 1},
+    {"textureCube(sC;3f;f;", 481, 1},
+    {"imulExtended(2i;2i;2i;2i;", 461, 1},
+    {nullptr, 0, 0},
+    {"textureProjLod(s3;4f;f;", 666, 1},
+    {"bitfieldInsert(u;u;i;i;", 412, 1},
+    {"imulExtended(3i;3i;3i;3i;", 462, 1},
+    {"findMSB(2u;", 445, 1},
+    {nullptr, 0, 0},
+    {"unpackUnorm2x16(u;", 263, 1},
+    {"textureLod(sA;3f;f;", 544, 1},
+    {nullptr, 0, 0},
+    {"textureProjGrad(s2;3f;2f;2f;", 726, 1},
+    {"textureProj(sX;3f;", 548, 1},
+    {"imageSize(I3;", 792, 1},
+    {"usubBorrow(3u;3u;3u;", 454, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"abs(i;", 92, 1},
+    {nullptr, 0, 0},
+    {"textureLod(usC;3f;f;", 543, 1},
+    {"outerProduct(2f;4f;", 313, 1},
+    {"radians(2f;", 1, 1},
+    {"outerProduct(4f;4f;", 309, 1},
+    {"textureOffset(is2;2f;2i;f;", 621, 1},
+    {"textureGather(sCs;3f;f;", 831, 1},
+    {"imageStore(iI2;2i;4i;", 766, 1},
+    {"asin(f;", 20, 1},
+    {"textureProj(us2;3f;", 528, 1},
+    {"texelFetchOffset(is2;2i;i;2i;", 692, 1},
+    {nullptr, 0, 0},
+    {"textureSize(sX;i;", 608, 1},
+    {"frexp(4f;4i;", 254, 1},
+    {"EmitVertex(", 849, 1},
+    {"textureSize(sM;", 605, 1},
+    {"texelFetch(s2;2i;i;", 680, 1},
+    {"asinh(f;", 48, 1},
+    {"textureSize(isA;i;", 600, 1},
+    {nullptr, 0, 0},
+    {"isnan(4f;", 230, 1},
+    {"textureProjLod(us3;4f;f;", 668, 1},
+    {"textureOffset(us2;2f;2i;", 612, 1},
+    {"matrixCompMult(34f;34f;", 305, 1},
+    {"notEqual(4f;4f;", 381, 1},
+    {"exp2(2f;", 73, 1},
+    {"textureProjOffset(is2;4f;2i;f;", 644, 1},
+    {"degrees(f;", 4, 1},
+    {"textureProjOffset(us2;4f;2i;f;", 645, 1},
+    {"memoryBarrierImage(", 804, 1},
+    {"frexp(3f;3i;", 253, 1},
+    {"memoryBarrierAtomicCounter(", 802, 1},
+    {"matrixCompMult(44f;44f;", 300, 1},
+    {"texture2DProj(s2;4f;", 466, 1},
+    {"texelFetchOffset(s2;2i;i;2i;", 691, 1},
+    {"textureLodOffset(isA;3f;f;2i;", 658, 1},
+    {"textureProj(sX;3f;f;", 577, 1},
+    {"min(2f;2f;", 139, 1},
+    {"atomicAnd(i;i;", 756, 1},
+    {"equal(2u;2u;", 373, 1},
+    {"textureOffset(usA;3f;2i;f;", 629, 1},
+    {"textureSize(usM;", 607, 1},
+    {"trunc(f;", 108, 1},
+    {"fract(2f;", 125, 1},
+    {"abs(3f;", 90, 1},
+    {"cosh(f;", 40, 1},
+    {"memoryBarrier(", 801, 1},
+    {"findLSB(2i;", 433, 1},
+    {"max(3f;3f;", 161, 1},
+    {"inversesqrt(f;", 84, 1},
+    {"step(f;2f;", 213, 1},
+    {nullptr, 0, 0},
+    {"max(i;i;", 163, 1},
+    {"inversesqrt(3f;", 86, 1},
+    {"any(2b;", 391, 1},
+    {"packUnorm4x8(4f;", 265, 1},
+    {"roundEven(2f;", 117, 1},
+    {nullptr, 0, 0},
+    {"normalize(2f;", 283, 1},
+    {"textureProjGrad(s3;4f;3f;3f;", 732, 1},
+    {"round(f;", 112, 1},
+    {"textureLod(us3;3f;f;", 540, 1},
+    {"atomicAnd(u;u;", 755, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"equal(3i;3i;", 371, 1},
+    {"atan(f;f;", 28, 1},
+    {"atomicMax(u;u;", 753, 1},
+    {"clamp(3u;3u;3u;", 196, 1},
+    {"textureSize(us2;i;", 592, 1},
+    {"intBitsToFloat(i;", 243, 1},
+    {"max(4u;u;", 176, 1},
+    {nullptr, 0, 0},
+    {"lessThan(2f;2f;", 331, 1},
+    {"textureProj(us2;3f;f;", 569, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"outerProduct(2f;2f;", 307, 1},
+    {nullptr, 0, 0},
+    {"texture(isA;3f;f;", 565, 1},
+    {"floatBitsToUint(2f;", 240, 1},
+    {"acosh(3f;", 54, 1},
+    {"equal(2i;2i;", 370, 1},
+    {nullptr, 0, 0},
+    {"texture(sA;3f;", 523, 1},
+    {"faceforward(2f;2f;2f;", 287, 1},
+    {"textureSize(sY;i;", 609, 1},
+    {nullptr, 0, 0},
+    {"clamp(3f;f;f;", 179, 1},
+    {nullptr, 0, 0},
+    {"textureLod(is2;2f;f;", 536, 1},
+    {"textureProjOffset(s2;3f;2i;f;", 640, 1},
+    {"isinf(3f;", 233, 1},
+    {nullptr, 0, 0},
+    {"textureSize(isM;", 606, 1},
+    {"textureProjOffset(s2;4f;2i;f;", 643, 1},
+    {nullptr, 0, 0},
+    {"texture(us3;3f;", 519, 1},
+    {"mod(4f;f;", 131, 1},
+    {"greaterThan(2f;2f;", 349, 1},
+    {nullptr, 0, 0},
+    {"bitfieldExtract(4u;i;i;", 407, 1},
+    {nullptr, 0, 0},
+    {"texture2D(sX;2f;", 468, 1},
+    {"textureOffset(us2;2f;2i;f;", 622, 1},
+    {"abs(2i;", 93, 1},
+    {"textureProj(sY;4f;f;", 581, 1},
+    {"clamp(3f;3f;3f;", 182, 1},
+    {"textureGatherOffset(s2s;2f;f;2i;", 844, 1},
+    {"lessThanEqual(2i;2i;", 343, 1},
+    {"textureGatherOffset(is2;2f;2i;i;", 836, 1},
+    {"textureGrad(s2s;3f;2f;2f;", 709, 1},
+    {nullptr, 0, 0},
+    {"textureProj(s3;4f;", 532, 1},
+    {"imulExtended(i;i;i;i;", 460, 1},
+    {"exp2(4f;", 75, 1},
+    {"imageLoad(I2;2i;", 777, 1},
+    {"textureOffset(s3;3f;3i;f;", 623, 1},
+    {"textureProjOffset(is2;3f;2i;", 631, 1},
+    {"imageLoad(iIA;3i;", 784, 1},
+    {nullptr, 0, 0},
+    {"outerProduct(4f;3f;", 314, 1},
+    {"roundEven(4f;", 119, 1},
+    {"asin(4f;", 23, 1},
+    {"transpose(43f;", 323, 1},
+    {"clamp(2i;2i;2i;", 188, 1},
+    {"clamp(2f;f;f;", 178, 1},
+    {"greaterThanEqual(2i;2i;", 361, 1},
+    {"all(4b;", 396, 1},
+    {"imageStore(IA;3i;4f;", 771, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"imageLoad(uIc;3i;", 788, 1},
+    {"outerProduct(4f;2f;", 312, 1},
+    {"min(i;i;", 142, 1},
+    {"atomicAdd(i;i;", 750, 1},
+    {nullptr, 0, 0},
+    {"reflect(4f;4f;", 293, 1},
+    {"degrees(4f;", 7, 1},
+    {"imageStore(uI3;3i;4u;", 770, 1},
+    {"imageStore(uIc;3i;4u;", 776, 1},
+    {"textureProjLodOffset(us2;3f;f;2i;", 672, 1},
+    {"sin(2f;", 9, 1},
+    {"textureProjGrad(us2;4f;2f;2f;", 731, 1},
+    {"greaterThan(3i;3i;", 353, 1},
+    {"clamp(3u;u;u;", 193, 1},
+    {nullptr, 0, 0},
+    {"textureProj(is2;3f;f;", 568, 1},
+    {"bitfieldReverse(u;", 420, 1},
+    {"bitCount(u;", 428, 1},
+    {"greaterThan(3f;3f;", 350, 1},
+    {"textureGatherOffset(s2;2f;2i;", 832, 1},
+    {"textureOffset(is3;3f;3i;", 614, 1},
+    {nullptr, 0, 0},
+    {"textureProjLodOffset(is3;4f;f;3i;", 677, 1},
+    {"findLSB(i;", 432, 1},
+    {"texture(s2s;3f;", 582, 1},
+    {"exp(3f;", 66, 1},
+    {"textureGrad(sCs;4f;3f;3f;", 710, 1},
+    {"textureGrad(us2;2f;2f;2f;", 702, 1},
+    {"min(4i;i;", 148, 1},
+    {"intBitsToFloat(2i;", 244, 1},
+    {"max(2u;u;", 174, 1},
+    {"dot(f;f;", 277, 1},
+    {"isnan(3f;", 229, 1},
+    {nullptr, 0, 0},
+    {"dFdy(3f;", 494, 2},
+    {"texelFetch(isA;3i;i;", 687, 1},
+    {nullptr, 0, 0},
+    {"texture(isC;3f;f;", 562, 1},
+    {"texture(sY;2f;", 550, 1},
+    {nullptr, 0, 0},
+    {"min(4f;f;", 138, 1},
+    {"textureOffset(us3;3f;3i;f;", 625, 1},
+    {"uaddCarry(3u;3u;3u;", 450, 1},
+    {"bitfieldExtract(4i;i;i;", 403, 1},
+    {"imageSize(iI2;", 790, 1},
+    {"textureProjLodOffset(s2s;4f;f;2i;", 679, 1},
+    {nullptr, 0, 0},
+    {"textureSize(us3;i;", 595, 1},
+    {"bitfieldInsert(3u;3u;i;i;", 414, 1},
+    {"lessThanEqual(4i;4i;", 345, 1},
+    {"textureProjLodOffset(s2;3f;f;2i;", 670, 1},
+    {"textureSize(is3;i;", 594, 1},
+    {"textureSize(isC;i;", 597, 1},
+    {"texelFetchOffset(usA;3i;i;2i;", 699, 1},
+    {"dot(4f;4f;", 280, 1},
+    {"degrees(2f;", 5, 1},
+    {"sign(2f;", 97, 1},
+    {"findMSB(3u;", 446, 1},
+    {"round(2f;", 113, 1},
+    {"usubBorrow(2u;2u;2u;", 453, 1},
+    {"lessThan(4i;4i;", 336, 1},
+    {"textureGrad(sA;3f;2f;2f;", 711, 1},
+    {nullptr, 0, 0},
+    {"texture(s3;3f;f;", 558, 1},
+    {"outerProduct(3f;2f;", 310, 1},
+    {"atomicCounterIncrement(a;", 747, 1},
+    {"distance(4f;4f;", 276, 1},
+    {"bitCount(2u;", 429, 1},
+    {"texelFetch(sY;2i;i;", 690, 1},
+    {"notEqual(4u;4u;", 387, 1},
+    {"textureGatherOffset(us2;2f;2i;i;", 837, 1},
+    {"normalize(3f;", 284, 1},
+    {"all(3b;", 395, 1},
+    {"max(3u;u;", 175, 1},
+    {"findLSB(3i;", 434, 1},
+    {nullptr, 0, 0},
+    {"textureGather(sA;3f;i;", 817, 1},
+    {"min(2i;i;", 146, 1},
+    {"bitfieldExtract(3i;i;i;", 402, 1},
+    {"textureProjLod(us2;3f;f;", 662, 1},
+    {nullptr, 0, 0},
+    {"mod(2f;2f;", 132, 1},
+    {"groupMemoryBarrier(", 848, 1},
+    {"clamp(2u;u;u;", 192, 1},
+    {"pow(3f;3f;", 62, 1},
+    {"textureProjGrad(s2s;4f;2f;2f;", 735, 1},
+    {"atomicOr(i;i;", 758, 1},
+    {"notEqual(2i;2i;", 382, 1},
+    {"textureLodOffset(s3;3f;f;3i;", 653, 1},
+    {"radians(3f;", 2, 1},
+    {"mix(4f;4f;f;", 201, 1},
+    {nullptr, 0, 0},
+    {"imageSize(Ic;", 798, 1},
+    {"atomicMin(u;u;", 751, 1},
+    {"abs(2f;", 89, 1},
+    {"imageSize(uIc;", 800, 1},
+    {nullptr, 0, 0},
+    {"max(4f;f;", 159, 1},
+    {"notEqual(3b;3b;", 389, 1},
+    {"textureLod(isA;3f;f;", 545, 1},
+    {"texture(usC;3f;f;", 563, 1},
+    {"textureLodOffset(s2s;3f;f;2i;", 656, 1},
+    {"greaterThanEqual(2u;2u;", 364, 1},
+    {"greaterThan(2u;2u;", 355, 1},
+    {"tan(f;", 16, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"length(3f;", 271, 1},
+    {"texture(sY;2f;f;", 579, 1},
+    {"greaterThanEqual(3f;3f;", 359, 1},
+    {"findLSB(u;", 436, 1},
+    {"atomicXor(u;u;", 759, 1},
+    {"textureOffset(s3;3f;3i;", 613, 1},
+    {"texelFetchOffset(sA;3i;i;2i;", 697, 1},
+    {nullptr, 0, 0},
+    {"imageStore(iI3;3i;4i;", 769, 1},
+    {"atomicCompSwap(i;i;i;", 764, 1},
+    {"texture2DProj(s2;3f;f;", 479, 1},
+    {nullptr, 0, 0},
+    {"textureProj(s2;3f;", 526, 1},
+    {"textureGatherOffset(usA;3f;2i;i;", 843, 1},
+    {"rgb_2_yuv(3f;y;", 553, 1},
+    {"texelFetchOffset(us2;2i;i;2i;", 693, 1},
+    {"log2(2f;", 77, 1},
+    {"not(4b;", 399, 1},
+    {"textureGradOffset(sA;3f;2f;2f;2i;", 722, 1},
+    {nullptr, 0, 0},
+    {"texture(s2;2f;", 514, 1},
+    {"clamp(3i;i;i;", 186, 1},
+    {nullptr, 0, 0},
+    {"atomicMax(i;i;", 754, 1},
+    {"textureCube(sC;3f;", 467, 1},
+    {"asinh(2f;", 49, 1},
+    {"min(f;f;", 135, 1},
+    {"cosh(2f;", 41, 1},
+    {"imageLoad(iIc;3i;", 787, 1},
+    {"textureProjOffset(is2;4f;2i;", 634, 1},
+    {"bitfieldInsert(3i;3i;i;i;", 410, 1},
+    {"lessThanEqual(3u;3u;", 347, 1},
+    {nullptr, 0, 0},
+    {"min(3u;u;", 154, 1},
+    {"dot(3f;3f;", 279, 1},
+    {"min(2i;2i;", 143, 1},
+    {"roundEven(f;", 116, 1},
+    {"textureGather(isC;3f;i;", 824, 1},
+    {nullptr, 0, 0},
+    {"dFdy(2f;", 492, 2},
+    {"floor(f;", 104, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"atan(4f;4f;", 31, 1},
+    {"distance(f;f;", 273, 1},
+    {"clamp(3i;3i;3i;", 189, 1},
+    {"equal(3u;3u;", 374, 1},
+    {"texture(s3;3f;", 517, 1},
+    {nullptr, 0, 0},
+    {"textureGather(is2;2f;i;", 812, 1},
+    {"imageLoad(Ic;3i;", 786, 1},
+    {"textureGradOffset(is2;2f;2f;2f;2i;", 716, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"textureProj(is3;4f;f;", 574, 1},
+    {"textureGrad(is3;3f;3f;3f;", 704, 1},
+    {"abs(4i;", 95, 1},
+    {"cosh(4f;", 43, 1},
+    {"faceforward(f;f;f;", 286, 1},
+    {"min(u;u;", 149, 1},
+    {"lessThanEqual(3f;3f;", 341, 1},
+    {"bitfieldExtract(u;i;i;", 404, 1},
+    {"textureProjGradOffset(s3;4f;3f;3f;3i;", 742, 1},
+    {"inverse(22f;", 328, 1},
+    {nullptr, 0, 0},
+    {"acosh(f;", 52, 1},
+    {"fract(3f;", 126, 1},
+    {nullptr, 0, 0},
+    {"textureLod(usA;3f;f;", 546, 1},
+    {nullptr, 0, 0},
+    {"max(4i;i;", 169, 1},
+    {"textureProjGrad(is3;4f;3f;3f;", 733, 1},
+    {"step(3f;3f;", 211, 1},
+    {"fwidth(f;", 498, 2},
+    {"atomicCounterDecrement(a;", 748, 1},
+    {"atan(f;", 32, 1},
+    {"smoothstep(f;f;4f;", 222, 1},
+    {"tan(3f;", 18, 1},
+    {nullptr, 0, 0},
+    {"texture(is3;3f;", 518, 1},
+    {"mix(4f;4f;4b;", 208, 1},
+    {"textureSize(s3;i;", 593, 1},
+    {"refract(3f;3f;f;", 296, 1},
+    {"textureGatherOffset(isA;3f;2i;i;", 842, 1},
+    {"texture(s2s;3f;f;", 587, 1},
+    {nullptr, 0, 0},
+    {"equal(4f;4f;", 369, 1},
+    {"uintBitsToFloat(u;", 247, 1},
+    {"texture(sA;3f;f;", 564, 1},
+    {"texture2DProjLodEXT(s2;4f;f;", 508, 1},
+    {nullptr, 0, 0},
+    {"texture2D(s2;2f;f;", 478, 1},
+    {"atan(3f;3f;", 30, 1},
+    {nullptr, 0, 0},
+    {"texture2DProj(s2;3f;", 465, 1},
+    {"textureProjGrad(s2;4f;2f;2f;", 729, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"clamp(4f;4f;4f;", 183, 1},
+    {"textureGrad(is2;2f;2f;2f;", 701, 1},
+    {"textureProjGradOffset(is2;3f;2f;2f;2i;", 737, 1},
+    {"texture2DProj(sX;4f;", 470, 1},
+    {"bitCount(i;", 424, 1},
+    {nullptr, 0, 0},
+    {"texture2DRectProj(sR;3f;", 472, 1},
+    {nullptr, 0, 0},
+    {"lessThanEqual(2u;2u;", 346, 1},
+    {"texture(sC;3f;f;", 561, 1},
+    {nullptr, 0, 0},
+    {"clamp(2f;2f;2f;", 181, 1},
+    {"textureProj(sY;3f;f;", 580, 1},
+    {"EndPrimitive(", 850, 1},
+    {"uintBitsToFloat(3u;", 249, 1},
+    {nullptr, 0, 0},
+    {"matrixCompMult(42f;42f;", 304, 1},
+    {"log2(3f;", 78, 1},
+    {nullptr, 0, 0},
+    {"fwidth(4f;", 504, 2},
+    {"textureGrad(sAs;4f;2f;2f;", 714, 1},
+    {"imageSize(IA;", 795, 1},
+    {"memoryBarrierBuffer(", 803, 1},
+    {"textureProjGradOffset(s2;3f;2f;2f;2i;", 736, 1},
+    {"textureOffset(s2;2f;2i;", 610, 1},
+    {"texture2DLodEXT(s2;2f;f;", 506, 1},
+    {"mod(3f;f;", 130, 1},
+    {"textureProjGrad(is2;3f;2f;2f;", 727, 1},
+    {"texture(us3;3f;f;", 560, 1},
+    {"textureLod(sC;3f;f;", 541, 1},
+    {"textureGather(us2;2f;i;", 813, 1},
+    {"clamp(4f;f;f;", 180, 1},
+    {"bitfieldInsert(4u;4u;i;i;", 415, 1},
+    {"textureCubeLod(sC;3f;f;", 513, 1},
+    {"inversesqrt(2f;", 85, 1},
+    {"bitfieldReverse(i;", 416, 1},
+    {"equal(2b;2b;", 376, 1},
+    {nullptr, 0, 0},
+    {"texelFetchOffset(is3;3i;i;3i;", 695, 1},
+    {"mix(f;f;b;", 205, 1},
+    {"texelFetch(us2;2i;i;", 682, 1},
+    {"min(2u;2u;", 150, 1},
+    {"refract(4f;4f;f;", 297, 1},
+    {"usubBorrow(u;u;u;", 452, 1},
+    {"mix(3f;3f;f;", 200, 1},
+    {"bitfieldReverse(2i;", 417, 1},
+    {nullptr, 0, 0},
+    {"atomicExchange(u;u;", 761, 1},
+    {"transpose(22f;", 316, 1},
+    {"textureGatherOffset(isA;3f;2i;", 839, 1},
+    {"textureOffset(is3;3f;3i;f;", 624, 1},
+    {"smoothstep(3f;3f;3f;", 218, 1},
+    {"equal(4b;4b;", 378, 1},
+    {"texture(usC;3f;", 522, 1},
+    {"pow(2f;2f;", 61, 1},
+    {"imageStore(iIc;3i;4i;", 775, 1},
+    {"floatBitsToInt(4f;", 238, 1},
+    {"greaterThanEqual(2f;2f;", 358, 1},
+    {"min(3f;3f;", 140, 1},
+    {"equal(4u;4u;", 375, 1},
+    {"smoothstep(f;f;3f;", 221, 1},
+    {"texelFetch(sM;2i;i;", 805, 1},
+    {nullptr, 0, 0},
+    {"sinh(4f;", 39, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"textureOffset(us3;3f;3i;", 615, 1},
+    {"lessThan(3f;3f;", 332, 1},
+    {nullptr, 0, 0},
+    {"transpose(33f;", 317, 1},
+    {"transpose(44f;", 318, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"exp(2f;", 65, 1},
+    {nullptr, 0, 0},
+    {"dFdx(4f;", 488, 2},
+    {"texture(is2;2f;", 515, 1},
+    {nullptr, 0, 0},
+    {"atan(2f;", 33, 1},
+    {"transpose(23f;", 320, 1},
+    {"asinh(3f;", 50, 1},
+    {"textureCubeGradEXT(sC;3f;3f;3f;", 477, 1},
+    {"textureProj(sY;4f;", 552, 1},
+    {"textureProjGrad(is2;4f;2f;2f;", 730, 1},
+    {"round(4f;", 115, 1},
+    {"asin(3f;", 22, 1},
+    {"sign(f;", 96, 1},
+    {"textureGather(is2;2f;", 809, 1},
+    {"floatBitsToUint(f;", 239, 1},
+    {nullptr, 0, 0},
+    {"inversesqrt(4f;", 87, 1},
+    {"any(4b;", 393, 1},
+    {"textureLod(s2;2f;f;", 535, 1},
+    {"acos(3f;", 26, 1},
+    {nullptr, 0, 0},
+    {"sign(3f;", 98, 1},
+    {"max(3f;f;", 158, 1},
+    {"atomicOr(u;u;", 757, 1},
+    {nullptr, 0, 0},
+    {"floatBitsToInt(2f;", 236, 1},
+    {"clamp(4i;4i;4i;", 190, 1},
+    {"atanh(4f;", 59, 1},
+    {"textureGather(usA;3f;", 816, 1},
+    {"trunc(4f;", 111, 1},
+    {"textureGather(sA;3f;", 814, 1},
+    {"max(3u;3u;", 172, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"determinant(22f;", 325, 1},
+    {"mix(2f;2f;2b;", 206, 1},
+    {"textureProjLod(s2s;4f;f;", 669, 1},
+    {"acosh(4f;", 55, 1},
+    {"length(f;", 269, 1},
+    {"textureProjGradOffset(is2;4f;2f;2f;2i;", 740, 1},
+    {"textureProj(us3;4f;", 534, 1},
+    {"fract(4f;", 127, 1},
+    {"textureProjLod(s2;3f;f;", 660, 1},
+    {"pow(4f;4f;", 63, 1},
+    {"floor(3f;", 106, 1},
+    {"imageStore(Ic;3i;4f;", 774, 1},
+    {nullptr, 0, 0},
+    {"dFdx(2f;", 484, 2},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"textureGather(usA;3f;i;", 819, 1},
+    {nullptr, 0, 0},
+    {"dot(2f;2f;", 278, 1},
+    {"isinf(4f;", 234, 1},
+    {"texture(usA;3f;f;", 566, 1},
+    {"bitCount(3u;", 430, 1},
+    {"determinant(44f;", 327, 1},
+    {"min(3f;f;", 137, 1},
+    {"sqrt(3f;", 82, 1},
+    {"textureLod(isC;3f;f;", 542, 1},
+    {"faceforward(3f;3f;3f;", 288, 1},
+    {nullptr, 0, 0},
+    {"texelFetchOffset(s3;3i;i;3i;", 694, 1},
+    {"ldexp(f;i;", 255, 1},
+    {"transpose(34f;", 324, 1},
+    {"cross(3f;3f;", 281, 1},
+    {nullptr, 0, 0},
+    {"asinh(4f;", 51, 1},
+    {"textureProjGradOffset(us2;3f;2f;2f;2i;", 738, 1},
+    {"bitfieldReverse(4u;", 423, 1},
+    {"bitCount(4u;", 431, 1},
+    {"log2(f;", 76, 1},
+    {nullptr, 0, 0},
+    {"textureProjOffset(s2;3f;2i;", 630, 1},
+    {"length(2f;", 270, 1},
+    {"sign(2i;", 101, 1},
+    {"ldexp(3f;3i;", 257, 1},
+    {"greaterThan(3u;3u;", 356, 1},
+    {"mod(4f;4f;", 134, 1},
+    {"inverse(44f;", 330, 1},
+    {"atan(3f;", 34, 1},
+    {"texelFetch(is3;3i;i;", 684, 1},
+    {nullptr, 0, 0},
+    {"textureProjOffset(is3;4f;3i;f;", 647, 1},
+    {"textureGather(usC;3f;", 822, 1},
+    {"textureCubeLodEXT(sC;3f;f;", 509, 1},
+    {"atan(2f;2f;", 29, 1},
+    {"acos(2f;", 25, 1},
+    {"texture2D(s2;2f;", 464, 1},
+    {"ceil(f;", 120, 1},
+    {"unpackUnorm4x8(u;", 267, 1},
+    {"textureProj(is3;4f;", 533, 1},
+    {"sign(4i;", 103, 1},
+    {nullptr, 0, 0},
+    {"roundEven(3f;", 118, 1},
+    {"sin(3f;", 10, 1},
+    {"textureLodOffset(us2;2f;f;2i;", 652, 1},
+    {"textureGatherOffset(sA;3f;2i;i;", 841, 1},
+    {"usubBorrow(4u;4u;4u;", 455, 1},
+    {"modf(f;f;", 223, 1},
+    {"textureProjLod(us2;4f;f;", 665, 1},
+    {"transpose(42f;", 321, 1},
+    {"textureProjOffset(s2;4f;2i;", 633, 1},
+    {"imageLoad(uIA;3i;", 785, 1},
+    {"fract(f;", 124, 1},
+    {"abs(3i;", 94, 1},
+    {nullptr, 0, 0},
+    {"outerProduct(3f;3f;", 308, 1},
+    {nullptr, 0, 0},
+    {"abs(4f;", 91, 1},
+    {"reflect(3f;3f;", 292, 1},
+    {"imageStore(uI2;2i;4u;", 767, 1},
+    {"textureProjLodOffset(us3;4f;f;3i;", 678, 1},
+    {"texelFetchOffset(isA;3i;i;2i;", 698, 1},
+    {nullptr, 0, 0},
+    {"texture2DLod(s2;2f;f;", 510, 1},
+    {"matrixCompMult(23f;23f;", 301, 1},
+    {nullptr, 0, 0},
+    {"textureSize(s2s;i;", 602, 1},
+    {"atanh(2f;", 57, 1},
+    {"max(u;u;", 170, 1},
+    {"textureProjOffset(us2;3f;2i;", 632, 1},
+    {nullptr, 0, 0},
+    {"textureProjGradOffset(s2;4f;2f;2f;2i;", 739, 1},
+    {nullptr, 0, 0},
+    {"imageStore(I3;3i;4f;", 768, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"textureGradOffset(isA;3f;2f;2f;2i;", 723, 1},
+    {"texture2DRect(sR;2f;", 471, 1},
+    {"isnan(f;", 227, 1},
+};
+
+constexpr UnmangledBuiltInEntry kUnmangledEntries[] = {
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), COMMON_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::ARB_texture_rectangle), ESSL1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::ARB_texture_rectangle), ESSL1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::EXT_shader_texture_lod), ESSL1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::EXT_shader_texture_lod), ESSL1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::EXT_shader_texture_lod), ESSL1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {UnmangledBuiltIn(TExtension::OES_standard_derivatives), ESSL1_BUILTINS, kBuiltInFragmentShader},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {UnmangledBuiltIn(TExtension::OES_standard_derivatives), ESSL1_BUILTINS, kBuiltInFragmentShader},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInFragmentShader},
+    {UnmangledBuiltIn(TExtension::OES_standard_derivatives), ESSL1_BUILTINS, kBuiltInFragmentShader},
+    {UnmangledBuiltIn(TExtension::EXT_shader_texture_lod), ESSL1_BUILTINS, kBuiltInFragmentShader},
+    {UnmangledBuiltIn(TExtension::EXT_shader_texture_lod), ESSL1_BUILTINS, kBuiltInFragmentShader},
+    {UnmangledBuiltIn(TExtension::EXT_shader_texture_lod), ESSL1_BUILTINS, kBuiltInFragmentShader},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL1_BUILTINS, kBuiltInVertexShader},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL1_BUILTINS, kBuiltInVertexShader},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL1_BUILTINS, kBuiltInVertexShader},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::EXT_YUV_target), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::EXT_YUV_target), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInAllShaders},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInComputeShader},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInComputeShader},
+    {UnmangledBuiltIn(TExtension::UNDEFINED), ESSL3_1_BUILTINS, kBuiltInComputeShader},
+    {UnmangledBuiltIn(TExtension::EXT_geometry_shader), ESSL3_1_BUILTINS, kBuiltInGeometryShaderEXT},
+    {UnmangledBuiltIn(TExtension::EXT_geometry_shader), ESSL3_1_BUILTINS, kBuiltInGeometryShaderEXT},
+};
+
+constexpr unsigned short kUnmangledDisplacements[] = {
+    1, 1, 1, 1, 0, 0, 1, 2, 1, 1, 1, 1,
+    1, 0, 0, 1, 4, 1, 1, 2, 5, 1, 2, 1,
+    4, 0, 1, 1, 1, 3, 1, 1, 0, 2, 1, 4,
+    1, 2, 3, 1, 3, 0, 2, 1, 1, 0, 4, 1,
+    1, 3, 3, 1, 1, 2, 1, 1, 2, 1, 2, 2,
+    1, 2, 0, 5, 0, 3, 10, 1, 6, 4, 2, 1,
+    2,
+};
+
+constexpr BuiltInHashSlot kUnmangledSlots[] = {
+    {"imageSize", 151, 1},
+    {nullptr, 0, 0},
+    {"textureCubeGradEXT", 107, 1},
+    {nullptr, 0, 0},
+    {"textureOffset", 126, 1},
+    {"textureProj", 121, 1},
+    {"texture2DRect", 103, 1},
+    {"outerProduct", 71, 1},
+    {"memoryBarrierImage", 155, 1},
+    {"reflect", 67, 1},
+    {"equal", 83, 2},
+    {nullptr, 0, 0},
+    {"unpackUnorm4x8", 59, 1},
+    {"bitCount", 93, 1},
+    {"any", 87, 1},
+    {"normalize", 65, 1},
+    {nullptr, 0, 0},
+    {"intBitsToFloat", 47, 1},
+    {nullptr, 0, 0},
+    {"greaterThanEqual", 81, 2},
+    {"inversesqrt", 20, 1},
+    {"unpackSnorm4x8", 60, 1},
+    {"log", 16, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"acosh", 12, 1},
+    {"asin", 5, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"exp", 15, 1},
+    {"texture", 120, 1},
+    {nullptr, 0, 0},
+    {"fract", 30, 1},
+    {nullptr, 0, 0},
+    {"textureCube", 102, 1},
+    {"atomicMax", 143, 1},
+    {nullptr, 0, 0},
+    {"lessThanEqual", 77, 2},
+    {nullptr, 0, 0},
+    {"atomicAnd", 144, 1},
+    {"yuv_2_rgb", 124, 1},
+    {"textureProjOffset", 127, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"atomicCounterDecrement", 140, 1},
+    {"textureCubeLod", 119, 1},
+    {"fwidth", 112, 2},
+    {"atomicCounter", 138, 1},
+    {"textureGather", 156, 1},
+    {nullptr, 0, 0},
+    {"unpackUnorm2x16", 55, 1},
+    {"cos", 3, 1},
+    {"atan", 7, 1},
+    {"bitfieldReverse", 92, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"isinf", 44, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"findMSB", 95, 1},
+    {nullptr, 0, 0},
+    {"textureGatherOffset", 157, 1},
+    {"abs", 21, 2},
+    {"groupMemoryBarrier", 160, 1},
+    {nullptr, 0, 0},
+    {"max", 34, 2},
+    {"ldexp", 50, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"dFdx", 108, 2},
+    {nullptr, 0, 0},
+    {"dot", 63, 1},
+    {"bitfieldInsert", 91, 1},
+    {"atomicCompSwap", 148, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"packUnorm2x16", 52, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"rgb_2_yuv", 123, 1},
+    {nullptr, 0, 0},
+    {"textureProjGradOffset", 137, 1},
+    {"textureGradOffset", 135, 1},
+    {nullptr, 0, 0},
+    {"usubBorrow", 97, 1},
+    {"clamp", 36, 2},
+    {"findLSB", 94, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"asinh", 11, 1},
+    {"atomicCounterIncrement", 139, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"texture2DLodEXT", 114, 1},
+    {"floatBitsToInt", 45, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"unpackSnorm2x16", 54, 1},
+    {"texture2D", 100, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"textureProjGrad", 136, 1},
+    {"distance", 62, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"acos", 6, 1},
+    {nullptr, 0, 0},
+    {"unpackHalf2x16", 56, 1},
+    {"texelFetchOffset", 133, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"textureCubeLodEXT", 116, 1},
+    {"cross", 64, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"lessThan", 75, 2},
+    {"textureProjLodOffset", 130, 1},
+    {"packHalf2x16", 53, 1},
+    {"smoothstep", 41, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"imageStore", 149, 1},
+    {nullptr, 0, 0},
+    {"atomicMin", 142, 1},
+    {"texture2DRectProj", 104, 1},
+    {"texture2DProjGradEXT", 106, 1},
+    {"faceforward", 66, 1},
+    {"memoryBarrierShared", 159, 1},
+    {"texture2DGradEXT", 105, 1},
+    {"imageLoad", 150, 1},
+    {"trunc", 26, 1},
+    {nullptr, 0, 0},
+    {"atomicExchange", 147, 1},
+    {"memoryBarrier", 152, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"sin", 2, 1},
+    {nullptr, 0, 0},
+    {"textureGrad", 134, 1},
+    {nullptr, 0, 0},
+    {"mod", 31, 1},
+    {nullptr, 0, 0},
+    {"frexp", 49, 1},
+    {"textureSize", 125, 1},
+    {"textureLod", 122, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"all", 88, 1},
+    {nullptr, 0, 0},
+    {"dFdy", 110, 2},
+    {"tan", 4, 1},
+    {nullptr, 0, 0},
+    {"atomicAdd", 141, 1},
+    {"uintBitsToFloat", 48, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"packSnorm4x8", 58, 1},
+    {"pow", 14, 1},
+    {"bitfieldExtract", 90, 1},
+    {nullptr, 0, 0},
+    {"log2", 18, 1},
+    {"imulExtended", 99, 1},
+    {"atomicXor", 146, 1},
+    {nullptr, 0, 0},
+    {"uaddCarry", 96, 1},
+    {"texture2DProjLod", 118, 1},
+    {"sinh", 8, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"matrixCompMult", 69, 2},
+    {"length", 61, 1},
+    {"radians", 0, 1},
+    {"floor", 25, 1},
+    {nullptr, 0, 0},
+    {"degrees", 1, 1},
+    {"texelFetch", 131, 2},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"inverse", 74, 1},
+    {"EndPrimitive", 162, 1},
+    {"floatBitsToUint", 46, 1},
+    {nullptr, 0, 0},
+    {"textureLodOffset", 128, 1},
+    {nullptr, 0, 0},
+    {"refract", 68, 1},
+    {"not", 89, 1},
+    {"memoryBarrierBuffer", 154, 1},
+    {"sqrt", 19, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"mix", 38, 2},
+    {"memoryBarrierAtomicCounter", 153, 1},
+    {"texture2DProj", 101, 1},
+    {"exp2", 17, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"step", 40, 1},
+    {"determinant", 73, 1},
+    {nullptr, 0, 0},
+    {"EmitVertex", 161, 1},
+    {"modf", 42, 1},
+    {nullptr, 0, 0},
+    {"packUnorm4x8", 57, 1},
+    {"texture2DProjLodEXT", 115, 1},
+    {nullptr, 0, 0},
+    {"notEqual", 85, 2},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"cosh", 9, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"ceil", 29, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"packSnorm2x16", 51, 1},
+    {"umulExtended", 98, 1},
+    {nullptr, 0, 0},
+    {"isnan", 43, 1},
+    {"round", 27, 1},
+    {nullptr, 0, 0},
+    {"transpose", 72, 1},
+    {"atanh", 13, 1},
+    {"sign", 23, 2},
+    {nullptr, 0, 0},
+    {"textureProjLod", 129, 1},
+    {"atomicOr", 145, 1},
+    {nullptr, 0, 0},
+    {nullptr, 0, 0},
+    {"barrier", 158, 1},
+    {"min", 32, 2},
+    {"greaterThan", 79, 2},
+    {"roundEven", 28, 1},
+    {nullptr, 0, 0},
+    {"texture2DLod", 117, 1},
+    {nullptr, 0, 0},
+    {"tanh", 10, 1},
+    {nullptr, 0, 0},
+};
+
+}  // anonymous namespace
+
+const BuiltInFunctionEntry *FindMangledBuiltInFunctions(const ImmutableString &mangledName,
+                                                        size_t *countOut)
+{
+    const BuiltInHashSlot *slot = FindSlot(mangledName, kMangledDisplacements, kMangledSlots);
+    if (slot == nullptr)
+    {
+        *countOut = 0u;
+        return nullptr;
+    }
+    *countOut = slot->entryCount;
+    return &kMangledEntries[slot->firstEntry];
+}
+
+const UnmangledBuiltInEntry *FindUnmangledBuiltIns(const ImmutableString &name, size_t *countOut)
+{
+    const BuiltInHashSlot *slot = FindSlot(name, kUnmangledDisplacements, kUnmangledSlots);
+    if (slot == nullptr)
+    {
+        *countOut = 0u;
+        return nullptr;
+    }
+    *countOut = slot->entryCount;
+    return &kUnmangledEntries[slot->firstEntry];
+}
+
+}  // namespace sh
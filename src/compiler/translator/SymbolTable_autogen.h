@@ -0,0 +1,57 @@
+// GENERATED FILE - DO NOT EDIT.
+// Generated by gen_builtin_symbols.py using data from builtin_function_declarations.txt.
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// SymbolTable_autogen.h:
+//   Perfect hash tables of the statically allocated built-in function symbols.
+
+#ifndef COMPILER_TRANSLATOR_SYMBOLTABLE_AUTOGEN_H_
+#define COMPILER_TRANSLATOR_SYMBOLTABLE_AUTOGEN_H_
+
+#include "compiler/translator/SymbolTable.h"
+
+namespace sh
+{
+
+// Shader types a built-in function is available in.
+enum BuiltInShaderTypeBits : unsigned char
+{
+    kBuiltInVertexShader      = 0x1,
+    kBuiltInFragmentShader    = 0x2,
+    kBuiltInComputeShader     = 0x4,
+    kBuiltInGeometryShaderEXT = 0x8,
+    kBuiltInAllShaders        = 0xF,
+};
+
+// One overload of a built-in function at a specific symbol table level.
+struct BuiltInFunctionEntry
+{
+    const TFunction *function;
+    unsigned char level;
+    unsigned char shaderTypes;
+};
+
+// An unmangled built-in function name at a specific symbol table level.
+struct UnmangledBuiltInEntry
+{
+    UnmangledBuiltIn builtIn;
+    unsigned char level;
+    unsigned char shaderTypes;
+};
+
+// Symbol ids up to and including this one are reserved for the statically allocated built-ins.
+constexpr int kLastStaticBuiltInId = 851;
+
+// Both lookups return the entries with the given name sorted from the highest symbol table level to
+// the lowest, or nullptr if there are none. The number of entries is written to countOut.
+const BuiltInFunctionEntry *FindMangledBuiltInFunctions(const ImmutableString &mangledName,
+                                                        size_t *countOut);
+const UnmangledBuiltInEntry *FindUnmangledBuiltIns(const ImmutableString &name,
+                                                   size_t *countOut);
+
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_SYMBOLTABLE_AUTOGEN_H_
@@ -28,9 +28,10 @@ class TSymbolUniqueId
 
     int get() const;
 
-  private:
-    constexpr TSymbolUniqueId(int staticId) : mId(staticId) {}
+    // Used for statically allocated built-ins, see SymbolTable_autogen.cpp.
+    explicit constexpr TSymbolUniqueId(int staticId) : mId(staticId) {}
 
+  private:
     int mId;
 };
 
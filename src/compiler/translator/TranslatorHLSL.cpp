@@ -44,23 +44,29 @@ void TranslatorHLSL::translate(TIntermBlock *root,
 
     sh::AddDefaultReturnStatements(root);
 
-    // Note that SimplifyLoopConditions needs to be run before any other AST transformations that
-    // may need to generate new statements from loop conditions or loop expressions.
-    // Note that SeparateDeclarations has already been run in TCompiler::compileTreeImpl().
-    SimplifyLoopConditions(root,
-                           IntermNodePatternMatcher::kExpressionReturningArray |
-                               IntermNodePatternMatcher::kUnfoldedShortCircuitExpression |
-                               IntermNodePatternMatcher::kDynamicIndexingOfVectorOrMatrixInLValue,
-                           &getSymbolTable());
-
-    SplitSequenceOperator(root,
-                          IntermNodePatternMatcher::kExpressionReturningArray |
-                              IntermNodePatternMatcher::kUnfoldedShortCircuitExpression |
-                              IntermNodePatternMatcher::kDynamicIndexingOfVectorOrMatrixInLValue,
-                          &getSymbolTable());
-
-    // Note that SeparateDeclarations needs to be run before UnfoldShortCircuitToIf.
-    UnfoldShortCircuitToIf(root, &getSymbolTable());
+    // These only rewrite statements within a function, so they can be run on each function
+    // separately.
+    runFunctionLocalTransforms(root, compileOptions, [this](TIntermBlock *block) {
+        // Note that SimplifyLoopConditions needs to be run before any other AST transformations
+        // that may need to generate new statements from loop conditions or loop expressions.
+        // Note that SeparateDeclarations has already been run in TCompiler::compileTreeImpl().
+        SimplifyLoopConditions(
+            block,
+            IntermNodePatternMatcher::kExpressionReturningArray |
+                IntermNodePatternMatcher::kUnfoldedShortCircuitExpression |
+                IntermNodePatternMatcher::kDynamicIndexingOfVectorOrMatrixInLValue,
+            &getSymbolTable());
+
+        SplitSequenceOperator(
+            block,
+            IntermNodePatternMatcher::kExpressionReturningArray |
+                IntermNodePatternMatcher::kUnfoldedShortCircuitExpression |
+                IntermNodePatternMatcher::kDynamicIndexingOfVectorOrMatrixInLValue,
+            &getSymbolTable());
+
+        // Note that SeparateDeclarations needs to be run before UnfoldShortCircuitToIf.
+        UnfoldShortCircuitToIf(block, &getSymbolTable());
+    });
 
     SeparateArrayConstructorStatements(root);
 
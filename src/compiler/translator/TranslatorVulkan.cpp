@@ -13,6 +13,7 @@
 
 #include "angle_gl.h"
 #include "common/utilities.h"
+#include "compiler/translator/OutputSPIRV.h"
 #include "compiler/translator/OutputVulkanGLSL.h"
 #include "compiler/translator/util.h"
 
@@ -90,8 +91,8 @@ class DeclareDefaultUniformsTraverser : public TIntermTraverser
     bool mInDefaultUniform;
 };
 
-TranslatorVulkan::TranslatorVulkan(sh::GLenum type, ShShaderSpec spec)
-    : TCompiler(type, spec, SH_GLSL_450_CORE_OUTPUT)
+TranslatorVulkan::TranslatorVulkan(sh::GLenum type, ShShaderSpec spec, ShShaderOutput output)
+    : TCompiler(type, spec, SH_GLSL_450_CORE_OUTPUT), mOutputSPIRV(output == SH_SPIRV_VULKAN_OUTPUT)
 {
 }
 
@@ -101,6 +102,17 @@ void TranslatorVulkan::translate(TIntermBlock *root,
 {
     TInfoSinkBase &sink = getInfoSink().obj;
 
+    // The SPIR-V is generated from the tree before it is changed for the GLSL output below. The
+    // GLSL is still written, in case the SPIR-V can't be used. Invariance of all outputs is left
+    // to the #pragma in the GLSL.
+    if (mOutputSPIRV && !getPragma().stdgl.invariantAll)
+    {
+        if (!OutputSPIRV(root, getShaderType(), getShaderVersion(), getUniforms(), &mObjectBinary))
+        {
+            mObjectBinary.clear();
+        }
+    }
+
     sink << "#version 450 core\n";
 
     // Write out default uniforms into a uniform block assigned to a specific set/binding.
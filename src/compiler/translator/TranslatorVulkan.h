@@ -5,7 +5,8 @@
 //
 // TranslatorVulkan:
 //   A GLSL-based translator that outputs shaders that fit GL_KHR_vulkan_glsl.
-//   The shaders are then fed into glslang to spit out SPIR-V (libANGLE-side).
+//   The shaders are then fed into glslang to spit out SPIR-V (libANGLE-side), unless the output
+//   type is SH_SPIRV_VULKAN_OUTPUT and the SPIR-V could be generated directly.
 //   See: https://www.khronos.org/registry/vulkan/specs/misc/GL_KHR_vulkan_glsl.txt
 //
 
@@ -20,13 +21,16 @@ namespace sh
 class TranslatorVulkan : public TCompiler
 {
   public:
-    TranslatorVulkan(sh::GLenum type, ShShaderSpec spec);
+    TranslatorVulkan(sh::GLenum type, ShShaderSpec spec, ShShaderOutput output);
 
   protected:
     void translate(TIntermBlock *root,
                    ShCompileOptions compileOptions,
                    PerformanceDiagnostics *perfDiagnostics) override;
     bool shouldFlattenPragmaStdglInvariantAll() override;
+
+  private:
+    bool mOutputSPIRV;
 };
 
 }  // namespace sh
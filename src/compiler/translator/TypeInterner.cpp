@@ -0,0 +1,83 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// TypeInterner.cpp: Table that makes structurally identical types share one immutable, pool
+// allocated TType.
+//
+
+#include "compiler/translator/TypeInterner.h"
+
+namespace sh
+{
+
+namespace
+{
+
+size_t HashCombine(size_t seed, size_t value)
+{
+    return seed ^ (value + 0x9e3779b9u + (seed << 6) + (seed >> 2));
+}
+
+}  // anonymous namespace
+
+TTypeInterner::TTypeInterner()
+{
+}
+
+const TType *TTypeInterner::intern(const TType &type)
+{
+    if (!type.getLayoutQualifier().isEmpty() || !type.getMemoryQualifier().isEmpty())
+    {
+        TType *copy = new TType(type);
+        copy->realize();
+        return copy;
+    }
+
+    TVector<const TType *> &bucket = mTypes[GetHash(type)];
+    for (const TType *internedType : bucket)
+    {
+        if (IsIdentical(*internedType, type))
+        {
+            return internedType;
+        }
+    }
+
+    TType *internedType = new TType(type);
+    internedType->realize();
+    bucket.push_back(internedType);
+    return internedType;
+}
+
+// static
+size_t TTypeInterner::GetHash(const TType &type)
+{
+    size_t hash = static_cast<size_t>(type.getBasicType());
+    hash        = HashCombine(hash, static_cast<size_t>(type.getPrecision()));
+    hash        = HashCombine(hash, static_cast<size_t>(type.getQualifier()));
+    hash        = HashCombine(hash, static_cast<size_t>(type.getNominalSize()));
+    hash        = HashCombine(hash, static_cast<size_t>(type.getSecondarySize()));
+    hash        = HashCombine(hash, reinterpret_cast<size_t>(type.getStruct()));
+    hash        = HashCombine(hash, reinterpret_cast<size_t>(type.getInterfaceBlock()));
+    if (type.isArray())
+    {
+        for (unsigned int arraySize : *type.getArraySizes())
+        {
+            hash = HashCombine(hash, arraySize);
+        }
+    }
+    return hash;
+}
+
+// static
+bool TTypeInterner::IsIdentical(const TType &a, const TType &b)
+{
+    return a == b && a.getPrecision() == b.getPrecision() &&
+           a.getQualifier() == b.getQualifier() && a.isInvariant() == b.isInvariant() &&
+           a.getInterfaceBlock() == b.getInterfaceBlock() &&
+           a.isStructSpecifier() == b.isStructSpecifier() &&
+           a.getLayoutQualifier().isEmpty() && a.getMemoryQualifier().isEmpty();
+}
+
+}  // namespace sh
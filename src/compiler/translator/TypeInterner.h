@@ -0,0 +1,45 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// TypeInterner.h: Table that makes structurally identical types share one immutable, pool
+// allocated TType. The shared types have their mangled names built already. Types with layout or
+// memory qualifiers are copied instead of shared, so equal pointers imply identical types, but
+// identical types with such qualifiers can have different pointers. Comparisons that may see those
+// types must still compare the types themselves when the pointers differ.
+//
+
+#ifndef COMPILER_TRANSLATOR_TYPEINTERNER_H_
+#define COMPILER_TRANSLATOR_TYPEINTERNER_H_
+
+#include "compiler/translator/Common.h"
+#include "compiler/translator/Types.h"
+
+namespace sh
+{
+
+class TTypeInterner : angle::NonCopyable
+{
+  public:
+    POOL_ALLOCATOR_NEW_DELETE();
+    TTypeInterner();
+
+    // Returns the shared instance of |type|. It must not be modified. Types with layout or memory
+    // qualifiers are not shared, and get a new copy each time.
+    const TType *intern(const TType &type);
+
+    // Hash of all the fields that make up the identity of |type|. Unlike the mangled name, this
+    // includes the precision and the qualifiers.
+    static size_t GetHash(const TType &type);
+
+  private:
+    static bool IsIdentical(const TType &a, const TType &b);
+
+    // Keyed by GetHash(). Types with colliding hashes share a bucket.
+    TUnorderedMap<size_t, TVector<const TType *>> mTypes;
+};
+
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_TYPEINTERNER_H_
@@ -12,6 +12,7 @@
 #include "compiler/translator/ImmutableString.h"
 #include "compiler/translator/InfoSink.h"
 #include "compiler/translator/IntermNode.h"
+#include "compiler/translator/StaticType.h"
 #include "compiler/translator/SymbolTable.h"
 
 #include <algorithm>
@@ -114,6 +115,48 @@ const char *getBasicString(TBasicType t)
     }
 }
 
+namespace
+{
+
+// Mangled names of all the types that are not arrays, structs or interface blocks, so that they
+// never need to be built and allocated.
+struct StaticMangledNameTable
+{
+    StaticType::Helpers::StaticMangledName names[EbtLast][4][4];
+};
+
+constexpr StaticMangledNameTable BuildStaticMangledNameTable()
+{
+    StaticMangledNameTable table = {};
+    for (int basicType = 0; basicType < EbtLast; ++basicType)
+    {
+        if (GetBasicMangledName(static_cast<TBasicType>(basicType)) == nullptr)
+        {
+            continue;
+        }
+        for (unsigned char primarySize = 1; primarySize <= 4; ++primarySize)
+        {
+            for (unsigned char secondarySize = 1; secondarySize <= 4; ++secondarySize)
+            {
+                // Only float matrices exist, and the mangled names of the others don't fit.
+                if (secondarySize > 1 && basicType != EbtFloat)
+                {
+                    continue;
+                }
+                table.names[basicType][primarySize - 1][secondarySize - 1] =
+                    StaticType::Helpers::BuildStaticMangledName(
+                        static_cast<TBasicType>(basicType), EbpUndefined, EvqGlobal, primarySize,
+                        secondarySize);
+            }
+        }
+    }
+    return table;
+}
+
+constexpr StaticMangledNameTable kStaticMangledNames = BuildStaticMangledNameTable();
+
+}  // anonymous namespace
+
 // TType implementation.
 TType::TType()
     : type(EbtVoid),
@@ -479,6 +522,17 @@ bool TType::canReplaceWithConstantUnion() const
 //
 const char *TType::buildMangledName() const
 {
+    if (!isArray() && GetBasicMangledName(type) != nullptr && primarySize >= 1 &&
+        secondarySize >= 1)
+    {
+        const char *staticMangledName =
+            kStaticMangledNames.names[type][primarySize - 1][secondarySize - 1].name;
+        if (staticMangledName[0] != '\0')
+        {
+            return staticMangledName;
+        }
+    }
+
     TString mangledName;
 
     if (isMatrix())
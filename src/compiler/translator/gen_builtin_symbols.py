@@ -0,0 +1,616 @@
+#!/usr/bin/python
+# Copyright 2018 The ANGLE Project Authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+#
+# gen_builtin_symbols.py:
+#  Code generation for the built-in function symbol tables. The built-in functions are declared in
+#  builtin_function_declarations.txt. The generated code contains a statically allocated TFunction
+#  for each built-in overload and two perfect hash tables, one keyed by mangled name and one keyed
+#  by unmangled name, so that looking up a built-in function doesn't require building any runtime
+#  data structures.
+
+import json
+import os
+import re
+import sys
+
+template_symboltable_autogen_h = """// GENERATED FILE - DO NOT EDIT.
+// Generated by {script_name} using data from {data_source_name}.
+//
+// Copyright {copyright_year} The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// SymbolTable_autogen.h:
+//   Perfect hash tables of the statically allocated built-in function symbols.
+
+#ifndef COMPILER_TRANSLATOR_SYMBOLTABLE_AUTOGEN_H_
+#define COMPILER_TRANSLATOR_SYMBOLTABLE_AUTOGEN_H_
+
+#include "compiler/translator/SymbolTable.h"
+
+namespace sh
+{{
+
+// Shader types a built-in function is available in.
+enum BuiltInShaderTypeBits : unsigned char
+{{
+    kBuiltInVertexShader      = 0x1,
+    kBuiltInFragmentShader    = 0x2,
+    kBuiltInComputeShader     = 0x4,
+    kBuiltInGeometryShaderEXT = 0x8,
+    kBuiltInAllShaders        = 0xF,
+}};
+
+// One overload of a built-in function at a specific symbol table level.
+struct BuiltInFunctionEntry
+{{
+    const TFunction *function;
+    unsigned char level;
+    unsigned char shaderTypes;
+}};
+
+// An unmangled built-in function name at a specific symbol table level.
+struct UnmangledBuiltInEntry
+{{
+    UnmangledBuiltIn builtIn;
+    unsigned char level;
+    unsigned char shaderTypes;
+}};
+
+// Symbol ids up to and including this one are reserved for the statically allocated built-ins.
+constexpr int kLastStaticBuiltInId = {last_static_builtin_id};
+
+// Both lookups return the entries with the given name sorted from the highest symbol table level to
+// the lowest, or nullptr if there are none. The number of entries is written to countOut.
+const BuiltInFunctionEntry *FindMangledBuiltInFunctions(const ImmutableString &mangledName,
+                                                        size_t *countOut);
+const UnmangledBuiltInEntry *FindUnmangledBuiltIns(const ImmutableString &name,
+                                                   size_t *countOut);
+
+}}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_SYMBOLTABLE_AUTOGEN_H_
+"""
+
+template_symboltable_autogen_cpp = """// GENERATED FILE - DO NOT EDIT.
+// Generated by {script_name} using data from {data_source_name}.
+//
+// Copyright {copyright_year} The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// SymbolTable_autogen.cpp:
+//   Statically allocated built-in function symbols and the perfect hash tables used to look them
+//   up. {function_count} functions, {mangled_name_count} mangled names, {unmangled_name_count} unmangled names.
+
+#include "compiler/translator/SymbolTable_autogen.h"
+
+#include "compiler/translator/StaticType.h"
+#include "compiler/translator/Symbol.h"
+
+namespace sh
+{{
+
+namespace
+{{
+
+// FNV-1a over the characters of the name, starting from a seed specific to the hash table slot
+// computation. gen_builtin_symbols.py computes the same hash when building the tables.
+uint32_t HashBuiltInName(const ImmutableString &name, uint32_t seed)
+{{
+    uint32_t hash = 2166136261u ^ seed;
+    for (size_t i = 0u; i < name.length(); ++i)
+    {{
+        hash ^= static_cast<unsigned char>(name.data()[i]);
+        hash *= 16777619u;
+    }}
+    return hash;
+}}
+
+struct BuiltInHashSlot
+{{
+    const char *name;
+    unsigned short firstEntry;
+    unsigned short entryCount;
+}};
+
+// Hash and displace: the first hash selects a displacement that is used as the seed of the second
+// hash. The displacements are chosen by the generator so that no two names map to the same slot.
+template <size_t kDisplacementCount, size_t kSlotCount>
+const BuiltInHashSlot *FindSlot(const ImmutableString &name,
+                                const unsigned short (&displacements)[kDisplacementCount],
+                                const BuiltInHashSlot (&slots)[kSlotCount])
+{{
+    static_assert((kSlotCount & (kSlotCount - 1)) == 0, "slot count must be a power of two");
+    uint32_t displacement = displacements[HashBuiltInName(name, 0u) % kDisplacementCount];
+    const BuiltInHashSlot &slot = slots[HashBuiltInName(name, displacement) & (kSlotCount - 1)];
+    if (slot.name == nullptr || name != slot.name)
+    {{
+        return nullptr;
+    }}
+    return &slot;
+}}
+
+// Parameter lists shared between the built-in functions.
+{parameter_declarations}
+
+// Built-in functions.
+{function_declarations}
+
+constexpr BuiltInFunctionEntry kMangledEntries[] = {{
+{mangled_entries}}};
+
+constexpr unsigned short kMangledDisplacements[] = {{
+{mangled_displacements}}};
+
+constexpr BuiltInHashSlot kMangledSlots[] = {{
+{mangled_slots}}};
+
+constexpr UnmangledBuiltInEntry kUnmangledEntries[] = {{
+{unmangled_entries}}};
+
+constexpr unsigned short kUnmangledDisplacements[] = {{
+{unmangled_displacements}}};
+
+constexpr BuiltInHashSlot kUnmangledSlots[] = {{
+{unmangled_slots}}};
+
+}}  // anonymous namespace
+
+const BuiltInFunctionEntry *FindMangledBuiltInFunctions(const ImmutableString &mangledName,
+                                                        size_t *countOut)
+{{
+    const BuiltInHashSlot *slot = FindSlot(mangledName, kMangledDisplacements, kMangledSlots);
+    if (slot == nullptr)
+    {{
+        *countOut = 0u;
+        return nullptr;
+    }}
+    *countOut = slot->entryCount;
+    return &kMangledEntries[slot->firstEntry];
+}}
+
+const UnmangledBuiltInEntry *FindUnmangledBuiltIns(const ImmutableString &name, size_t *countOut)
+{{
+    const BuiltInHashSlot *slot = FindSlot(name, kUnmangledDisplacements, kUnmangledSlots);
+    if (slot == nullptr)
+    {{
+        *countOut = 0u;
+        return nullptr;
+    }}
+    *countOut = slot->entryCount;
+    return &kUnmangledEntries[slot->firstEntry];
+}}
+
+}}  // namespace sh
+"""
+
+levels = ['COMMON_BUILTINS', 'ESSL1_BUILTINS', 'ESSL3_BUILTINS', 'ESSL3_1_BUILTINS', 'GLSL_BUILTINS']
+
+shader_type_bits = {
+    'VERTEX': 'kBuiltInVertexShader',
+    'FRAGMENT': 'kBuiltInFragmentShader',
+    'COMPUTE': 'kBuiltInComputeShader',
+    'GEOMETRY_EXT': 'kBuiltInGeometryShaderEXT',
+}
+shader_type_order = ['VERTEX', 'FRAGMENT', 'COMPUTE', 'GEOMETRY_EXT']
+
+basic_types = {
+    'float': ('EbtFloat', 'f'),
+    'int': ('EbtInt', 'i'),
+    'uint': ('EbtUInt', 'u'),
+    'bool': ('EbtBool', 'b'),
+    'void': ('EbtVoid', None),
+    'yuvCscStandardEXT': ('EbtYuvCscStandardEXT', 'y'),
+    'sampler2D': ('EbtSampler2D', 's2'),
+    'sampler3D': ('EbtSampler3D', 's3'),
+    'samplerCube': ('EbtSamplerCube', 'sC'),
+    'sampler2DArray': ('EbtSampler2DArray', 'sA'),
+    'samplerExternalOES': ('EbtSamplerExternalOES', 'sX'),
+    '__samplerExternal2DY2YEXT': ('EbtSamplerExternal2DY2YEXT', 'sY'),
+    'sampler2DRect': ('EbtSampler2DRect', 'sR'),
+    'sampler2DMS': ('EbtSampler2DMS', 'sM'),
+    'isampler2D': ('EbtISampler2D', 'is2'),
+    'isampler3D': ('EbtISampler3D', 'is3'),
+    'isamplerCube': ('EbtISamplerCube', 'isC'),
+    'isampler2DArray': ('EbtISampler2DArray', 'isA'),
+    'isampler2DMS': ('EbtISampler2DMS', 'isM'),
+    'usampler2D': ('EbtUSampler2D', 'us2'),
+    'usampler3D': ('EbtUSampler3D', 'us3'),
+    'usamplerCube': ('EbtUSamplerCube', 'usC'),
+    'usampler2DArray': ('EbtUSampler2DArray', 'usA'),
+    'usampler2DMS': ('EbtUSampler2DMS', 'usM'),
+    'sampler2DShadow': ('EbtSampler2DShadow', 's2s'),
+    'samplerCubeShadow': ('EbtSamplerCubeShadow', 'sCs'),
+    'sampler2DArrayShadow': ('EbtSampler2DArrayShadow', 'sAs'),
+    'image2D': ('EbtImage2D', 'I2'),
+    'iimage2D': ('EbtIImage2D', 'iI2'),
+    'uimage2D': ('EbtUImage2D', 'uI2'),
+    'image3D': ('EbtImage3D', 'I3'),
+    'iimage3D': ('EbtIImage3D', 'iI3'),
+    'uimage3D': ('EbtUImage3D', 'uI3'),
+    'image2DArray': ('EbtImage2DArray', 'IA'),
+    'iimage2DArray': ('EbtIImage2DArray', 'iIA'),
+    'uimage2DArray': ('EbtUImage2DArray', 'uIA'),
+    'imageCube': ('EbtImageCube', 'Ic'),
+    'iimageCube': ('EbtIImageCube', 'iIc'),
+    'uimageCube': ('EbtUImageCube', 'uIc'),
+    'atomic_uint': ('EbtAtomicCounter', 'a'),
+}
+
+vector_prefixes = {'vec': 'float', 'ivec': 'int', 'uvec': 'uint', 'bvec': 'bool'}
+gen_types = {'genType': 'float', 'genIType': 'int', 'genUType': 'uint', 'genBType': 'bool'}
+generic_vec_types = {'vec': 'float', 'ivec': 'int', 'uvec': 'uint', 'bvec': 'bool'}
+qualifiers = {'in': 'EvqGlobal', 'out': 'EvqOut', 'inout': 'EvqInOut'}
+
+
+class TType:
+
+    def __init__(self, basic, qualifier='EvqGlobal', primary=1, secondary=1):
+        self.basic = basic
+        self.qualifier = qualifier
+        self.primary = primary
+        self.secondary = secondary
+
+    def with_basic(self, basic):
+        return TType(basic, self.qualifier, self.primary, self.secondary)
+
+    def with_size(self, basic, primary):
+        return TType(basic, self.qualifier, primary, 1)
+
+    def mangled_name(self):
+        name = ''
+        if self.primary > 1:
+            name += str(self.primary)
+        if self.primary > 1 and self.secondary > 1:
+            name += str(self.secondary)
+        return name + basic_types[self.basic][1] + ';'
+
+    def cpp(self):
+        return 'StaticType::Get<%s, EbpUndefined, %s, %d, %d>()' % (
+            basic_types[self.basic][0], self.qualifier, self.primary, self.secondary)
+
+    def key(self):
+        return (self.basic, self.qualifier, self.primary, self.secondary)
+
+
+def parse_type(text):
+    """Returns (generic kind, TType or None). Generic types are returned by name."""
+    parts = text.split()
+    qualifier = 'EvqGlobal'
+    if len(parts) == 2:
+        qualifier = qualifiers[parts[0]]
+    name = parts[-1]
+    if name in gen_types or name in generic_vec_types or name == 'gvec4' or name.startswith(
+            'gsampler') or name.startswith('gimage'):
+        return (name, qualifier)
+    if name in basic_types:
+        return TType(name, qualifier)
+    m = re.match(r'^(vec|ivec|uvec|bvec)([234])$', name)
+    if m:
+        return TType(vector_prefixes[m.group(1)], qualifier, int(m.group(2)))
+    m = re.match(r'^mat([234])(x([234]))?$', name)
+    if m:
+        cols = int(m.group(1))
+        rows = int(m.group(3)) if m.group(3) else cols
+        return TType('float', qualifier, cols, rows)
+    raise Exception('Unknown type ' + text)
+
+
+def is_generic(t, kinds):
+    return isinstance(t, tuple) and any(t[0] == k or t[0].startswith(k) for k in kinds)
+
+
+def specialize(t, kind_map, size):
+    if isinstance(t, tuple) and t[0] in kind_map:
+        return TType(kind_map[t[0]], t[1], size)
+    return t
+
+
+def expand(ret, params):
+    """Expands generic types the same way as the GLSL specification. Returns a list of
+    (return type, parameter types) tuples without any generic types."""
+    if params and is_generic(params[0], ['gsampler']):
+        sampler = params[0][0][1:]
+        result = []
+        for prefix, vec_basic in [('', 'float'), ('i', 'int'), ('u', 'uint')]:
+            r = TType(vec_basic, 'EvqGlobal', 4) if is_generic(ret, ['gvec4']) else ret
+            result.append((r, [TType(prefix + sampler)] + params[1:]))
+        return result
+    if params and is_generic(params[0], ['gimage']):
+        image = params[0][0][1:]
+        result = []
+        for prefix, vec_basic in [('', 'float'), ('i', 'int'), ('u', 'uint')]:
+            vec4 = TType(vec_basic, 'EvqGlobal', 4)
+            r = vec4 if is_generic(ret, ['gvec4']) else ret
+            p = [vec4 if is_generic(param, ['gvec4']) else param for param in params[1:]]
+            result.append((r, [TType(prefix + image)] + p))
+        return result
+    if any(is_generic(t, gen_types.keys()) for t in [ret] + params):
+        return [(specialize(ret, gen_types, size), [specialize(p, gen_types, size) for p in params])
+                for size in range(1, 5)]
+    if any(is_generic(t, generic_vec_types.keys()) for t in [ret] + params):
+        return [(specialize(ret, generic_vec_types, size),
+                 [specialize(p, generic_vec_types, size) for p in params]) for size in range(2, 5)]
+    return [(ret, params)]
+
+
+def parse_declarations(path):
+    """Returns a list of (name, metadata, return type, parameter types) in declaration order."""
+    functions = []
+    group_stack = [{}]
+    with open(path) as f:
+        for line_number, raw_line in enumerate(f, 1):
+            line = raw_line.strip()
+            if not line or line.startswith('//'):
+                continue
+            m = re.match(r'^GROUP BEGIN (\w+)\s*(\{.*\})?$', line)
+            if m:
+                metadata = dict(group_stack[-1])
+                if m.group(2):
+                    metadata.update(json.loads(m.group(2)))
+                group_stack.append(metadata)
+                continue
+            if re.match(r'^GROUP END \w+$', line):
+                group_stack.pop()
+                continue
+            m = re.match(r'^(\{.*\})?\s*([\w ]+?)\s+(\w+)\((.*)\);$', line)
+            if not m:
+                raise Exception('%s:%d: syntax error' % (path, line_number))
+            metadata = dict(group_stack[-1])
+            if m.group(1):
+                metadata.update(json.loads(m.group(1)))
+            if 'level' not in metadata or metadata['level'] not in levels:
+                raise Exception('%s:%d: missing or invalid level' % (path, line_number))
+            ret = parse_type(m.group(2))
+            params = [parse_type(p.strip()) for p in m.group(4).split(',') if p.strip()]
+            functions.append((m.group(3), metadata, ret, params))
+    if len(group_stack) != 1:
+        raise Exception('%s: unterminated group' % path)
+    return functions
+
+
+def get_op(name, metadata):
+    op = metadata.get('op')
+    if op is None:
+        return 'EOpCallBuiltInFunction'
+    if op == 'auto':
+        return 'EOp' + name[0].upper() + name[1:]
+    return 'EOp' + op
+
+
+def hash_name(name, seed):
+    h = (2166136261 ^ seed) & 0xFFFFFFFF
+    for c in name:
+        h ^= ord(c)
+        h = (h * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def build_perfect_hash(names):
+    """Returns (displacements, slots) where slots maps slot index to name."""
+    slot_count = 1
+    while slot_count < len(names):
+        slot_count *= 2
+    displacement_count = max(1, len(names) // 2)
+    buckets = [[] for _ in range(displacement_count)]
+    for name in names:
+        buckets[hash_name(name, 0) % displacement_count].append(name)
+    displacements = [0] * displacement_count
+    slots = [None] * slot_count
+    for bucket_index in sorted(range(displacement_count), key=lambda i: -len(buckets[i])):
+        bucket = buckets[bucket_index]
+        if not bucket:
+            continue
+        for displacement in range(1, 65536):
+            candidate = [hash_name(name, displacement) & (slot_count - 1) for name in bucket]
+            if len(set(candidate)) == len(candidate) and all(slots[c] is None for c in candidate):
+                break
+        else:
+            raise Exception('Could not find a perfect hash displacement')
+        displacements[bucket_index] = displacement
+        for name, slot in zip(bucket, candidate):
+            slots[slot] = name
+    return displacements, slots
+
+
+def shader_types_cpp(types):
+    if len(types) == len(shader_type_order):
+        return 'kBuiltInAllShaders'
+    return ' | '.join(shader_type_bits[t] for t in shader_type_order if t in types)
+
+
+def format_list(items, per_line):
+    lines = []
+    for i in range(0, len(items), per_line):
+        lines.append('    ' + ', '.join(items[i:i + per_line]) + ',\n')
+    return ''.join(lines)
+
+
+def format_slots(slots, name_to_entries):
+    lines = []
+    for name in slots:
+        if name is None:
+            lines.append('    {nullptr, 0, 0},\n')
+        else:
+            first, count = name_to_entries[name]
+            lines.append('    {"%s", %d, %d},\n' % (name, first, count))
+    return ''.join(lines)
+
+
+def identifier(mangled_name):
+    return re.sub(r'[^A-Za-z0-9_]', '_', mangled_name.replace(';', '')).rstrip('_')
+
+
+def main():
+    data_source_name = 'builtin_function_declarations.txt'
+    declarations = parse_declarations(data_source_name)
+
+    # Expand all declarations to specific overloads.
+    overloads = []  # (name, mangled name, level, extension, op, return type, params, shader types)
+    for name, metadata, ret, params in declarations:
+        shader_types = [metadata['shader_type']] if 'shader_type' in metadata else shader_type_order
+        extension = metadata.get('extension', 'UNDEFINED')
+        for specific_ret, specific_params in expand(ret, params):
+            mangled_name = name + '(' + ''.join(p.mangled_name() for p in specific_params)
+            overloads.append((name, mangled_name, metadata['level'], extension,
+                              get_op(name, metadata), specific_ret, specific_params, shader_types))
+
+    # Create one symbol per distinct (mangled name, level) and merge the shader types.
+    functions = {}
+    function_order = []
+    for name, mangled_name, level, extension, op, ret, params, shader_types in overloads:
+        key = (mangled_name, level)
+        if key in functions:
+            # Generic types may expand to an overload that is already declared, for example
+            # mod(genType, float) and mod(genType, genType) both declare mod(float, float). The
+            # first declaration wins like it does when inserting symbols into a symbol table.
+            existing = functions[key]
+            for t in shader_types:
+                if t not in existing['shader_types']:
+                    existing['shader_types'].append(t)
+            continue
+        functions[key] = {
+            'name': name,
+            'extension': extension,
+            'op': op,
+            'ret': ret,
+            'params': params,
+            'shader_types': list(shader_types)
+        }
+        function_order.append(key)
+
+    # Unmangled names. A name is conditional on an extension at a level only if all of the
+    # overloads at that level are. Otherwise the first declared extension is used.
+    unmangled = {}
+    unmangled_order = []
+    for name, mangled_name, level, extension, op, ret, params, shader_types in overloads:
+        for shader_type in shader_types:
+            key = (name, level, shader_type)
+            if key not in unmangled:
+                unmangled[key] = extension
+                unmangled_order.append(key)
+            elif extension == 'UNDEFINED':
+                unmangled[key] = 'UNDEFINED'
+
+    mangled_names = []
+    for mangled_name, level in function_order:
+        if mangled_name not in mangled_names:
+            mangled_names.append(mangled_name)
+
+    # Parameter lists and function symbols.
+    parameter_lists = {}
+    parameter_declarations = []
+    function_declarations = []
+    function_variables = {}
+    used_identifiers = set()
+    for symbol_id, key in enumerate(function_order, 1):
+        mangled_name, level = key
+        function = functions[key]
+        params = function['params']
+        params_id = 'nullptr'
+        if params:
+            params_key = tuple(p.key() for p in params)
+            if params_key not in parameter_lists:
+                params_name = 'kParams_' + '_'.join(
+                    '%s%s' % ({'EvqOut': 'o', 'EvqInOut': 'io'}.get(p.qualifier, ''),
+                              identifier(p.mangled_name())) for p in params)
+                parameter_lists[params_key] = params_name
+                parameter_declarations.append(
+                    'constexpr const TConstParameter %s[%d] = {\n%s};' %
+                    (params_name, len(params), ''.join(
+                        '    TConstParameter(%s),\n' % p.cpp() for p in params)))
+            params_id = parameter_lists[params_key]
+        variable = 'kFunction_' + identifier(mangled_name)
+        if variable in used_identifiers:
+            variable += '_' + level.replace('_BUILTINS', '')
+        used_identifiers.add(variable)
+        function_variables[key] = variable
+        function_declarations.append(
+            'constexpr const TFunction %s(TSymbolUniqueId(%d),\n'
+            '                             ImmutableString("%s"),\n'
+            '                             TExtension::%s,\n'
+            '                             %s,\n'
+            '                             %d,\n'
+            '                             %s,\n'
+            '                             ImmutableString("%s"),\n'
+            '                             %s,\n'
+            '                             false);' %
+            (variable, symbol_id, function['name'], function['extension'], params_id, len(params),
+             function['ret'].cpp(), mangled_name, function['op']))
+
+    # Mangled name hash table. Entries of a name are sorted from the highest level to the lowest.
+    mangled_entries = []
+    mangled_name_to_entries = {}
+    for mangled_name in mangled_names:
+        keys = sorted([k for k in function_order if k[0] == mangled_name],
+                      key=lambda k: -levels.index(k[1]))
+        mangled_name_to_entries[mangled_name] = (len(mangled_entries), len(keys))
+        for key in keys:
+            mangled_entries.append('    {&%s, %s, %s},\n' %
+                                   (function_variables[key], key[1],
+                                    shader_types_cpp(functions[key]['shader_types'])))
+    mangled_displacements, mangled_slots = build_perfect_hash(mangled_names)
+
+    # Unmangled name hash table. Shader types that share the same extension are merged.
+    unmangled_names = []
+    for name, level, shader_type in unmangled_order:
+        if name not in unmangled_names:
+            unmangled_names.append(name)
+    unmangled_entries = []
+    unmangled_name_to_entries = {}
+    for name in unmangled_names:
+        first = len(unmangled_entries)
+        for level in reversed(levels):
+            merged = []
+            for shader_type in shader_type_order:
+                key = (name, level, shader_type)
+                if key not in unmangled:
+                    continue
+                for entry in merged:
+                    if entry[0] == unmangled[key]:
+                        entry[1].append(shader_type)
+                        break
+                else:
+                    merged.append((unmangled[key], [shader_type]))
+            for extension, shader_types in merged:
+                unmangled_entries.append('    {UnmangledBuiltIn(TExtension::%s), %s, %s},\n' %
+                                         (extension, level, shader_types_cpp(shader_types)))
+        unmangled_name_to_entries[name] = (first, len(unmangled_entries) - first)
+    unmangled_displacements, unmangled_slots = build_perfect_hash(unmangled_names)
+
+    script_name = os.path.basename(__file__)
+    # A fixed year, so that regenerating the files doesn't change them.
+    copyright_year = 2018
+    with open('SymbolTable_autogen.h', 'wt') as out_file:
+        out_file.write(
+            template_symboltable_autogen_h.format(
+                script_name=script_name,
+                data_source_name=data_source_name,
+                copyright_year=copyright_year,
+                last_static_builtin_id=len(function_order)))
+    with open('SymbolTable_autogen.cpp', 'wt') as out_file:
+        out_file.write(
+            template_symboltable_autogen_cpp.format(
+                script_name=script_name,
+                data_source_name=data_source_name,
+                copyright_year=copyright_year,
+                function_count=len(function_order),
+                mangled_name_count=len(mangled_names),
+                unmangled_name_count=len(unmangled_names),
+                parameter_declarations='\n'.join(parameter_declarations),
+                function_declarations='\n'.join(function_declarations),
+                mangled_entries=''.join(mangled_entries),
+                mangled_displacements=format_list([str(d) for d in mangled_displacements], 12),
+                mangled_slots=format_slots(mangled_slots, mangled_name_to_entries),
+                unmangled_entries=''.join(unmangled_entries),
+                unmangled_displacements=format_list([str(d) for d in unmangled_displacements],
+                                                    12),
+                unmangled_slots=format_slots(unmangled_slots, unmangled_name_to_entries)))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -3782,7 +3782,7 @@ void yyfree (void * ptr , yyscan_t yyscanner)
 
 yy_size_t string_input(char* buf, yy_size_t max_size, yyscan_t yyscanner) {
     pp::Token token;
-    yyget_extra(yyscanner)->getPreprocessor().lex(&token);
+    yyget_extra(yyscanner)->lexPreprocessorToken(&token);
     yy_size_t len = token.type == pp::Token::LAST ? 0 : token.text.size();
     if (len < max_size)
         memcpy(buf, token.text.c_str(), len);
@@ -736,7 +736,7 @@ bool IsOutputHLSL(ShShaderOutput output)
 }
 bool IsOutputVulkan(ShShaderOutput output)
 {
-    return output == SH_GLSL_VULKAN_OUTPUT;
+    return output == SH_GLSL_VULKAN_OUTPUT || output == SH_SPIRV_VULKAN_OUTPUT;
 }
 
 }  // namespace sh
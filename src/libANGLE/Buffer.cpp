@@ -84,7 +84,12 @@ Error Buffer::bufferData(const Context *context,
 
     mIndexRangeCache.clear();
     mState.mUsage = usage;
-    mState.mSize  = size;
+
+    if (mState.mSize != size)
+    {
+        mState.mSize = size;
+        onStateChange(context, angle::SubjectMessage::STATE_CHANGE);
+    }
 
     return NoError();
 }
@@ -132,6 +137,7 @@ Error Buffer::map(const Context *context, GLenum access)
     mState.mAccessFlags = GL_MAP_WRITE_BIT;
     mIndexRangeCache.clear();
 
+    onStateChange(context, angle::SubjectMessage::STATE_CHANGE);
     return NoError();
 }
 
@@ -162,6 +168,7 @@ Error Buffer::mapRange(const Context *context,
         mIndexRangeCache.invalidateRange(static_cast<unsigned int>(offset), static_cast<unsigned int>(length));
     }
 
+    onStateChange(context, angle::SubjectMessage::STATE_CHANGE);
     return NoError();
 }
 
@@ -179,6 +186,7 @@ Error Buffer::unmap(const Context *context, GLboolean *result)
     mState.mAccess      = GL_WRITE_ONLY_OES;
     mState.mAccessFlags = 0;
 
+    onStateChange(context, angle::SubjectMessage::STATE_CHANGE);
     return NoError();
 }
 
@@ -199,17 +207,8 @@ Error Buffer::getIndexRange(const gl::Context *context,
                             bool primitiveRestartEnabled,
                             IndexRange *outRange) const
 {
-    if (mIndexRangeCache.findRange(type, offset, count, primitiveRestartEnabled, outRange))
-    {
-        return NoError();
-    }
-
-    ANGLE_TRY(
-        mImpl->getIndexRange(context, type, offset, count, primitiveRestartEnabled, outRange));
-
-    mIndexRangeCache.addRange(type, offset, count, primitiveRestartEnabled, *outRange);
-
-    return NoError();
+    return mIndexRangeCache.getRange(context, mImpl, type, offset, count, primitiveRestartEnabled,
+                                     static_cast<size_t>(mState.mSize), outRange);
 }
 
 }  // namespace gl
@@ -17,6 +17,7 @@
 #include "libANGLE/IndexRangeCache.h"
 #include "libANGLE/PackedGLEnums.h"
 #include "libANGLE/RefCountObject.h"
+#include "libANGLE/signal_utils.h"
 
 namespace rx
 {
@@ -61,7 +62,8 @@ class BufferState final : angle::NonCopyable
     GLint64 mMapLength;
 };
 
-class Buffer final : public RefCountObject, public LabeledObject
+// Notifies its observers when its size changes and when it is mapped or unmapped.
+class Buffer final : public RefCountObject, public LabeledObject, public angle::Subject
 {
   public:
     Buffer(rx::GLImplFactory *factory, GLuint id);
@@ -205,6 +205,7 @@ Extensions::Extensions()
       maxDebugGroupStackDepth(0),
       maxLabelLength(0),
       noError(false),
+      parallelShaderCompile(false),
       lossyETCDecode(false),
       bindUniformLocation(false),
       syncQuery(false),
@@ -675,6 +676,7 @@ const ExtensionInfoMap &GetExtensionInfoMap()
         map["GL_KHR_debug"] = esOnlyExtension(&Extensions::debug);
         // TODO(jmadill): Enable this when complete.
         //map["GL_KHR_no_error"] = esOnlyExtension(&Extensions::noError);
+        map["GL_KHR_parallel_shader_compile"] = esOnlyExtension(&Extensions::parallelShaderCompile);
         map["GL_ANGLE_lossy_etc_decode"] = enableableExtension(&Extensions::lossyETCDecode);
         map["GL_CHROMIUM_bind_uniform_location"] = esOnlyExtension(&Extensions::bindUniformLocation);
         map["GL_CHROMIUM_sync_query"] = enableableExtension(&Extensions::syncQuery);
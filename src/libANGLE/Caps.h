@@ -298,6 +298,9 @@ struct Extensions
     // KHR_no_error
     bool noError;
 
+    // GL_KHR_parallel_shader_compile
+    bool parallelShaderCompile;
+
     // GL_ANGLE_lossy_etc_decode
     bool lossyETCDecode;
 
@@ -9,6 +9,7 @@
 #include "libANGLE/Compiler.h"
 
 #include "common/debug.h"
+#include "libANGLE/Constants.h"
 #include "libANGLE/ContextState.h"
 #include "libANGLE/renderer/CompilerImpl.h"
 #include "libANGLE/renderer/GLImplFactory.h"
@@ -23,6 +24,14 @@ namespace
 // sh::Finalize.
 size_t activeCompilerHandles = 0;
 
+void DestroyCompilerHandle(ShHandle handle)
+{
+    sh::Destruct(handle);
+
+    ASSERT(activeCompilerHandles > 0);
+    activeCompilerHandles--;
+}
+
 ShShaderSpec SelectShaderSpec(GLint majorVersion, GLint minorVersion, bool isWebGL)
 {
     if (majorVersion >= 3)
@@ -151,39 +160,38 @@ Compiler::~Compiler()
 {
     if (mFragmentCompiler)
     {
-        sh::Destruct(mFragmentCompiler);
+        DestroyCompilerHandle(mFragmentCompiler);
         mFragmentCompiler = nullptr;
-
-        ASSERT(activeCompilerHandles > 0);
-        activeCompilerHandles--;
     }
 
     if (mVertexCompiler)
     {
-        sh::Destruct(mVertexCompiler);
+        DestroyCompilerHandle(mVertexCompiler);
         mVertexCompiler = nullptr;
-
-        ASSERT(activeCompilerHandles > 0);
-        activeCompilerHandles--;
     }
 
     if (mComputeCompiler)
     {
-        sh::Destruct(mComputeCompiler);
+        DestroyCompilerHandle(mComputeCompiler);
         mComputeCompiler = nullptr;
-
-        ASSERT(activeCompilerHandles > 0);
-        activeCompilerHandles--;
     }
 
     if (mGeometryCompiler)
     {
-        sh::Destruct(mGeometryCompiler);
+        DestroyCompilerHandle(mGeometryCompiler);
         mGeometryCompiler = nullptr;
+    }
 
-        ASSERT(activeCompilerHandles > 0);
-        activeCompilerHandles--;
+    for (auto &workerHandles : mWorkerCompilerHandles)
+    {
+        ASSERT(workerHandles.second.pendingCompileCount == 0);
+        ASSERT(workerHandles.second.idleHandles.size() == workerHandles.second.handleCount);
+        for (ShHandle handle : workerHandles.second.idleHandles)
+        {
+            DestroyCompilerHandle(handle);
+        }
     }
+    mWorkerCompilerHandles.clear();
 
     if (activeCompilerHandles == 0)
     {
@@ -218,17 +226,82 @@ ShHandle Compiler::getCompilerHandle(GLenum type)
 
     if (!(*compiler))
     {
-        if (activeCompilerHandles == 0)
+        *compiler = constructCompilerHandle(type);
+    }
+
+    return *compiler;
+}
+
+void Compiler::prepareWorkerCompilerHandle(GLenum type)
+{
+    bool constructHandle = false;
+    {
+        std::lock_guard<std::mutex> lock(mWorkerCompilerHandlesMutex);
+        WorkerCompilerHandles &workerHandles = mWorkerCompilerHandles[type];
+        workerHandles.pendingCompileCount++;
+
+        // The worker pool doesn't run more compiles at once than it has threads, so more handles
+        // would only sit idle.
+        if (workerHandles.handleCount < workerHandles.pendingCompileCount &&
+            workerHandles.handleCount < kDefaultMaxWorkerThreads)
+        {
+            workerHandles.handleCount++;
+            constructHandle = true;
+        }
+    }
+
+    // Handles are only constructed on the GL thread, which keeps the sh::Initialize bookkeeping
+    // single threaded.
+    if (constructHandle)
+    {
+        ShHandle handle = constructCompilerHandle(type);
         {
-            sh::Initialize();
+            std::lock_guard<std::mutex> lock(mWorkerCompilerHandlesMutex);
+            mWorkerCompilerHandles[type].idleHandles.push_back(handle);
         }
+        mWorkerCompilerHandleReleased.notify_all();
+    }
+}
+
+ShHandle Compiler::acquireCompilerHandle(GLenum type)
+{
+    std::unique_lock<std::mutex> lock(mWorkerCompilerHandlesMutex);
+    WorkerCompilerHandles &workerHandles = mWorkerCompilerHandles[type];
+    ASSERT(workerHandles.pendingCompileCount > 0);
+
+    mWorkerCompilerHandleReleased.wait(
+        lock, [&workerHandles] { return !workerHandles.idleHandles.empty(); });
+
+    ShHandle handle = workerHandles.idleHandles.back();
+    workerHandles.idleHandles.pop_back();
+    return handle;
+}
 
-        *compiler = sh::ConstructCompiler(type, mSpec, mOutputType, &mResources);
-        ASSERT(*compiler);
-        activeCompilerHandles++;
+void Compiler::releaseCompilerHandle(GLenum type, ShHandle handle)
+{
+    ASSERT(handle);
+    {
+        std::lock_guard<std::mutex> lock(mWorkerCompilerHandlesMutex);
+        WorkerCompilerHandles &workerHandles = mWorkerCompilerHandles[type];
+        ASSERT(workerHandles.pendingCompileCount > 0);
+        workerHandles.pendingCompileCount--;
+        workerHandles.idleHandles.push_back(handle);
     }
+    mWorkerCompilerHandleReleased.notify_all();
+}
 
-    return *compiler;
+ShHandle Compiler::constructCompilerHandle(GLenum type)
+{
+    if (activeCompilerHandles == 0)
+    {
+        sh::Initialize();
+    }
+
+    ShHandle handle = sh::ConstructCompiler(type, mSpec, mOutputType, &mResources);
+    ASSERT(handle);
+    activeCompilerHandles++;
+
+    return handle;
 }
 
 const std::string &Compiler::getBuiltinResourcesString(GLenum type)
@@ -10,6 +10,11 @@
 #ifndef LIBANGLE_COMPILER_H_
 #define LIBANGLE_COMPILER_H_
 
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <vector>
+
 #include "GLSLANG/ShaderLang.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/RefCountObject.h"
@@ -30,11 +35,23 @@ class Compiler final : public RefCountObjectNoID
     Compiler(rx::GLImplFactory *implFactory, const ContextState &data);
 
     ShHandle getCompilerHandle(GLenum type);
+    ShShaderSpec getShaderSpec() const { return mSpec; }
     ShShaderOutput getShaderOutputType() const { return mOutputType; }
     const std::string &getBuiltinResourcesString(GLenum type);
 
+    // Compiles on worker threads use their own compiler handles. prepareWorkerCompilerHandle is
+    // called on the GL thread for each compile posted to a worker, and constructs a handle for it
+    // unless kDefaultMaxWorkerThreads handles of that type already exist. On the worker,
+    // acquireCompilerHandle waits for one of them to be idle, and releaseCompilerHandle gives it
+    // back once the compile is done.
+    void prepareWorkerCompilerHandle(GLenum type);
+    ShHandle acquireCompilerHandle(GLenum type);
+    void releaseCompilerHandle(GLenum type, ShHandle handle);
+
   private:
     ~Compiler() override;
+    ShHandle constructCompilerHandle(GLenum type);
+
     std::unique_ptr<rx::CompilerImpl> mImplementation;
     ShShaderSpec mSpec;
     ShShaderOutput mOutputType;
@@ -44,6 +61,19 @@ class Compiler final : public RefCountObjectNoID
     ShHandle mVertexCompiler;
     ShHandle mComputeCompiler;
     ShHandle mGeometryCompiler;
+
+    struct WorkerCompilerHandles
+    {
+        std::vector<ShHandle> idleHandles;
+        size_t handleCount = 0;
+        // Compiles that were prepared and haven't released their handle yet.
+        size_t pendingCompileCount = 0;
+    };
+
+    // The handles used by compiles on worker threads, by shader type.
+    std::mutex mWorkerCompilerHandlesMutex;
+    std::condition_variable mWorkerCompilerHandleReleased;
+    std::map<GLenum, WorkerCompilerHandles> mWorkerCompilerHandles;
 };
 
 }  // namespace gl
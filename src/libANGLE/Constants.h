@@ -17,6 +17,13 @@ namespace gl
 // The binary cache is currently left disable by default, and the application can enable it.
 const size_t kDefaultMaxProgramCacheMemoryBytes = 0;
 
+// The shader translation cache is enabled by default since it doesn't change any observable
+// behavior.
+const size_t kDefaultMaxShaderCacheMemoryBytes = 4 * 1024 * 1024;
+
+// Number of threads the frontend worker pool uses for shader translation.
+const size_t kDefaultMaxWorkerThreads = 4;
+
 enum
 {
     // Implementation upper limits, real maximums depend on the hardware
@@ -11,6 +11,7 @@
 
 #include <string.h>
 #include <iterator>
+#include <limits>
 #include <sstream>
 #include <vector>
 
@@ -262,6 +263,8 @@ Context::Context(rx::EGLImplFactory *implFactory,
                  const Context *shareContext,
                  TextureManager *shareTextures,
                  MemoryProgramCache *memoryProgramCache,
+                 MemoryShaderCache *memoryShaderCache,
+                 angle::WorkerThreadPool *workerThreadPool,
                  const egl::AttributeMap &attribs,
                  const egl::DisplayExtensions &displayExtensions)
 
@@ -289,6 +292,9 @@ Context::Context(rx::EGLImplFactory *implFactory,
       mSurfacelessFramebuffer(nullptr),
       mWebGLContext(GetWebGLContext(attribs)),
       mMemoryProgramCache(memoryProgramCache),
+      mMemoryShaderCache(memoryShaderCache),
+      mWorkerThreadPool(workerThreadPool),
+      mMaxShaderCompilerThreads(std::numeric_limits<GLuint>::max()),
       mScratchBuffer(1000u),
       mZeroFilledBuffer(1000u)
 {
@@ -424,6 +430,9 @@ Context::Context(rx::EGLImplFactory *implFactory,
 
 egl::Error Context::onDestroy(const egl::Display *display)
 {
+    // Background links keep using the context that started them until they are resolved.
+    mState.mShaderPrograms->resolvePendingLinks(this);
+
     for (auto fence : mFenceNVMap)
     {
         SafeDelete(fence.second);
@@ -1411,6 +1420,11 @@ void Context::getIntegervImpl(GLenum pname, GLint *params)
             *params = mExtensions.maxViews;
             break;
 
+        // GL_KHR_parallel_shader_compile
+        case GL_MAX_SHADER_COMPILER_THREADS_KHR:
+            *params = static_cast<GLint>(mMaxShaderCompilerThreads);
+            break;
+
         // GL_EXT_disjoint_timer_query
         case GL_GPU_DISJOINT_EXT:
             *params = mImplementation->getGPUDisjoint();
@@ -2221,11 +2235,6 @@ void Context::markContextLost()
     mContextLost = true;
 }
 
-bool Context::isContextLost()
-{
-    return mContextLost;
-}
-
 GLenum Context::getGraphicsResetStatus()
 {
     // Even if the application doesn't want to know about resets, we want to know
@@ -2436,7 +2445,7 @@ void Context::samplerParameteri(GLuint sampler, GLenum pname, GLint param)
     Sampler *samplerObject =
         mState.mSamplers->checkSamplerAllocation(mImplementation.get(), sampler);
     SetSamplerParameteri(samplerObject, pname, param);
-    mGLState.setObjectDirty(GL_SAMPLER);
+    mGLState.onSamplerChange(samplerObject);
 }
 
 void Context::samplerParameteriv(GLuint sampler, GLenum pname, const GLint *param)
@@ -2444,7 +2453,7 @@ void Context::samplerParameteriv(GLuint sampler, GLenum pname, const GLint *para
     Sampler *samplerObject =
         mState.mSamplers->checkSamplerAllocation(mImplementation.get(), sampler);
     SetSamplerParameteriv(samplerObject, pname, param);
-    mGLState.setObjectDirty(GL_SAMPLER);
+    mGLState.onSamplerChange(samplerObject);
 }
 
 void Context::samplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
@@ -2452,7 +2461,7 @@ void Context::samplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
     Sampler *samplerObject =
         mState.mSamplers->checkSamplerAllocation(mImplementation.get(), sampler);
     SetSamplerParameterf(samplerObject, pname, param);
-    mGLState.setObjectDirty(GL_SAMPLER);
+    mGLState.onSamplerChange(samplerObject);
 }
 
 void Context::samplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param)
@@ -2460,7 +2469,7 @@ void Context::samplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *pa
     Sampler *samplerObject =
         mState.mSamplers->checkSamplerAllocation(mImplementation.get(), sampler);
     SetSamplerParameterfv(samplerObject, pname, param);
-    mGLState.setObjectDirty(GL_SAMPLER);
+    mGLState.onSamplerChange(samplerObject);
 }
 
 void Context::getSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params)
@@ -2468,7 +2477,6 @@ void Context::getSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params)
     const Sampler *samplerObject =
         mState.mSamplers->checkSamplerAllocation(mImplementation.get(), sampler);
     QuerySamplerParameteriv(samplerObject, pname, params);
-    mGLState.setObjectDirty(GL_SAMPLER);
 }
 
 void Context::getSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params)
@@ -2476,7 +2484,6 @@ void Context::getSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *param
     const Sampler *samplerObject =
         mState.mSamplers->checkSamplerAllocation(mImplementation.get(), sampler);
     QuerySamplerParameterfv(samplerObject, pname, params);
-    mGLState.setObjectDirty(GL_SAMPLER);
 }
 
 void Context::programParameteri(GLuint program, GLenum pname, GLint value)
@@ -2639,6 +2646,13 @@ size_t Context::getRequestableExtensionStringCount() const
     return mRequestableExtensionStrings.size();
 }
 
+void Context::maxShaderCompilerThreads(GLuint count)
+{
+    // The worker pool is shared by the display, so any other count is only a hint. Zero compiles
+    // and links on the calling thread.
+    mMaxShaderCompilerThreads = count;
+}
+
 void Context::beginTransformFeedback(GLenum primitiveMode)
 {
     TransformFeedback *transformFeedback = mGLState.getCurrentTransformFeedback();
@@ -2724,6 +2738,10 @@ void Context::initCaps(const egl::DisplayExtensions &displayExtensions, bool rob
     // Enable the cache control query unconditionally.
     mExtensions.programCacheControl = true;
 
+    // Links and compiles can finish on the worker threads, and the completion status query never
+    // waits for them.
+    mExtensions.parallelShaderCompile = true;
+
     // Apply implementation limits
     LimitCap(&mCaps.maxVertexAttributes, MAX_VERTEX_ATTRIBS);
 
@@ -2893,6 +2911,9 @@ Error Context::prepareForDraw()
 {
     syncRendererState();
 
+    // The draw call was validated with these changes to the state.
+    mGLState.resetDirtyBitsSinceLastDraw();
+
     if (isRobustResourceInitEnabled())
     {
         ANGLE_TRY(mGLState.clearUnclearedActiveTextures(this));
@@ -3123,6 +3144,7 @@ void Context::framebufferTexture2D(GLenum target,
         framebuffer->resetAttachment(this, attachment);
     }
 
+    mGLState.onFramebufferAttachmentsChange(framebuffer);
     mGLState.setObjectDirty(target);
 }
 
@@ -3146,6 +3168,7 @@ void Context::framebufferRenderbuffer(GLenum target,
         framebuffer->resetAttachment(this, attachment);
     }
 
+    mGLState.onFramebufferAttachmentsChange(framebuffer);
     mGLState.setObjectDirty(target);
 }
 
@@ -3181,6 +3204,7 @@ void Context::framebufferTextureLayer(GLenum target,
         framebuffer->resetAttachment(this, attachment);
     }
 
+    mGLState.onFramebufferAttachmentsChange(framebuffer);
     mGLState.setObjectDirty(target);
 }
 
@@ -3207,6 +3231,7 @@ void Context::framebufferTextureMultiviewLayeredANGLE(GLenum target,
         framebuffer->resetAttachment(this, attachment);
     }
 
+    mGLState.onFramebufferAttachmentsChange(framebuffer);
     mGLState.setObjectDirty(target);
 }
 
@@ -3233,6 +3258,7 @@ void Context::framebufferTextureMultiviewSideBySideANGLE(GLenum target,
         framebuffer->resetAttachment(this, attachment);
     }
 
+    mGLState.onFramebufferAttachmentsChange(framebuffer);
     mGLState.setObjectDirty(target);
 }
 
@@ -4545,7 +4571,9 @@ void Context::getIntegerv(GLenum pname, GLint *params)
 
 void Context::getProgramiv(GLuint program, GLenum pname, GLint *params)
 {
-    Program *programObject = getProgram(program);
+    Program *programObject = (pname == GL_COMPLETION_STATUS_KHR)
+                                 ? getProgramNoResolveLink(program)
+                                 : getProgram(program);
     ASSERT(programObject);
     QueryProgramiv(this, programObject, pname, params);
 }
@@ -5680,9 +5708,7 @@ void Context::programUniformMatrix4x3fv(GLuint program,
 
 void Context::onTextureChange(const Texture *texture)
 {
-    // Conservatively assume all textures are dirty.
-    // TODO(jmadill): More fine-grained update.
-    mGLState.setObjectDirty(GL_TEXTURE);
+    mGLState.onTextureChange(texture);
 }
 
 void Context::genProgramPipelines(GLsizei count, GLuint *pipelines)
@@ -15,6 +15,7 @@
 
 #include "angle_gl.h"
 #include "common/MemoryBuffer.h"
+#include "common/WorkerThread.h"
 #include "common/angleutils.h"
 #include "libANGLE/Caps.h"
 #include "libANGLE/Constants.h"
@@ -50,6 +51,7 @@ class FenceNV;
 class Sync;
 class Framebuffer;
 class MemoryProgramCache;
+class MemoryShaderCache;
 class Program;
 class Query;
 class Renderbuffer;
@@ -69,6 +71,8 @@ class Context final : public ValidationContext
             const Context *shareContext,
             TextureManager *shareTextures,
             MemoryProgramCache *memoryProgramCache,
+            MemoryShaderCache *memoryShaderCache,
+            angle::WorkerThreadPool *workerThreadPool,
             const egl::AttributeMap &attribs,
             const egl::DisplayExtensions &displayExtensions);
 
@@ -1125,7 +1129,7 @@ class Context final : public ValidationContext
 
     GLenum getError();
     void markContextLost();
-    bool isContextLost();
+    bool isContextLost() const { return mContextLost; }
     GLenum getGraphicsResetStatus();
     bool isResetNotificationEnabled();
 
@@ -1142,6 +1146,9 @@ class Context final : public ValidationContext
     void requestExtension(const char *name);
     size_t getRequestableExtensionStringCount() const;
 
+    // GL_KHR_parallel_shader_compile
+    void maxShaderCompilerThreads(GLuint count);
+
     rx::ContextImpl *getImplementation() const { return mImplementation.get(); }
     const Workarounds &getWorkarounds() const;
 
@@ -1151,6 +1158,12 @@ class Context final : public ValidationContext
     Error prepareForDispatch();
 
     MemoryProgramCache *getMemoryProgramCache() const { return mMemoryProgramCache; }
+    MemoryShaderCache *getMemoryShaderCache() const { return mMemoryShaderCache; }
+    // Returns nullptr if the app asked for no shader compiler threads.
+    angle::WorkerThreadPool *getWorkerThreadPool() const
+    {
+        return mMaxShaderCompilerThreads > 0 ? mWorkerThreadPool : nullptr;
+    }
 
     template <EntryPoint EP, typename... ParamsT>
     void gatherParams(ParamsT &&... params);
@@ -1249,6 +1262,9 @@ class Context final : public ValidationContext
     Framebuffer *mSurfacelessFramebuffer;
     bool mWebGLContext;
     MemoryProgramCache *mMemoryProgramCache;
+    MemoryShaderCache *mMemoryShaderCache;
+    angle::WorkerThreadPool *mWorkerThreadPool;
+    GLuint mMaxShaderCompilerThreads;
 
     State::DirtyBits mTexImageDirtyBits;
     State::DirtyObjects mTexImageDirtyObjects;
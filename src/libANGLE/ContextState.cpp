@@ -8,8 +8,11 @@
 
 #include "libANGLE/ContextState.h"
 
+#include "libANGLE/Buffer.h"
 #include "libANGLE/Framebuffer.h"
+#include "libANGLE/Program.h"
 #include "libANGLE/ResourceManager.h"
+#include "libANGLE/VertexArray.h"
 
 namespace gl
 {
@@ -17,6 +20,10 @@ namespace gl
 namespace
 {
 
+constexpr angle::SubjectIndex kDrawFramebufferSubjectIndex = 0;
+constexpr angle::SubjectIndex kProgramSubjectIndex         = 1;
+constexpr angle::SubjectIndex kVertexBufferSubjectIndex    = 2;
+
 template <typename T>
 using ContextStateMember = T *(ContextState::*);
 
@@ -132,8 +139,37 @@ ValidationContext::ValidationContext(const ValidationContext *shareContext,
              extensions,
              limitations),
       mSkipValidation(skipValidation),
-      mDisplayTextureShareGroup(shareTextures != nullptr)
+      mDisplayTextureShareGroup(shareTextures != nullptr),
+      mDrawStatesValidated(false),
+      mCachedNonInstancedVertexElementLimit(-1),
+      mCachedInstancedVertexElementLimit(-1),
+      mDrawFramebufferObserverBinding(this, kDrawFramebufferSubjectIndex),
+      mProgramObserverBinding(this, kProgramSubjectIndex)
 {
+    mDrawStatesDirtyBits.set(State::DIRTY_BIT_STENCIL_FUNCS_FRONT);
+    mDrawStatesDirtyBits.set(State::DIRTY_BIT_STENCIL_FUNCS_BACK);
+    mDrawStatesDirtyBits.set(State::DIRTY_BIT_STENCIL_WRITEMASK_FRONT);
+    mDrawStatesDirtyBits.set(State::DIRTY_BIT_STENCIL_WRITEMASK_BACK);
+    mDrawStatesDirtyBits.set(State::DIRTY_BIT_DRAW_FRAMEBUFFER_BINDING);
+    mDrawStatesDirtyBits.set(State::DIRTY_BIT_VERTEX_ARRAY_BINDING);
+    mDrawStatesDirtyBits.set(State::DIRTY_BIT_PROGRAM_BINDING);
+    mDrawStatesDirtyBits.set(State::DIRTY_BIT_PROGRAM_EXECUTABLE);
+    mDrawStatesDirtyObjects.set(State::DIRTY_OBJECT_DRAW_FRAMEBUFFER);
+    mDrawStatesDirtyObjects.set(State::DIRTY_OBJECT_VERTEX_ARRAY);
+
+    // WebGL also checks for feedback loops and for the types of the attributes and outputs.
+    mWebGLDrawStatesDirtyBits = mDrawStatesDirtyBits;
+    mWebGLDrawStatesDirtyBits.set(State::DIRTY_BIT_TEXTURE_BINDINGS);
+    mWebGLDrawStatesDirtyBits.set(State::DIRTY_BIT_SAMPLER_BINDINGS);
+    mWebGLDrawStatesDirtyBits.set(State::DIRTY_BIT_CURRENT_VALUES);
+    mWebGLDrawStatesDirtyObjects = mDrawStatesDirtyObjects;
+    mWebGLDrawStatesDirtyObjects.set(State::DIRTY_OBJECT_PROGRAM_TEXTURES);
+
+    mVertexBufferObserverBindings.reserve(MAX_VERTEX_ATTRIB_BINDINGS);
+    for (size_t bindingIndex = 0; bindingIndex < MAX_VERTEX_ATTRIB_BINDINGS; ++bindingIndex)
+    {
+        mVertexBufferObserverBindings.emplace_back(this, kVertexBufferSubjectIndex + bindingIndex);
+    }
 }
 
 ValidationContext::~ValidationContext()
@@ -363,6 +399,14 @@ bool ValidationContext::getQueryParameterInfo(GLenum pname, GLenum *type, unsign
             *type      = GL_INT;
             *numParams = 1;
             return true;
+        case GL_MAX_SHADER_COMPILER_THREADS_KHR:
+            if (!getExtensions().parallelShaderCompile)
+            {
+                return false;
+            }
+            *type      = GL_INT;
+            *numParams = 1;
+            return true;
     }
 
     if (getExtensions().debug)
@@ -826,6 +870,16 @@ bool ValidationContext::getIndexedQueryParameterInfo(GLenum target,
 }
 
 Program *ValidationContext::getProgram(GLuint handle) const
+{
+    Program *program = mState.mShaderPrograms->getProgram(handle);
+    if (program)
+    {
+        program->resolveLink();
+    }
+    return program;
+}
+
+Program *ValidationContext::getProgramNoResolveLink(GLuint handle) const
 {
     return mState.mShaderPrograms->getProgram(handle);
 }
@@ -873,4 +927,68 @@ GLenum ValidationContext::getConvertedRenderbufferFormat(GLenum internalformat)
                : internalformat;
 }
 
+bool ValidationContext::needsDrawStatesValidation() const
+{
+    if (!mDrawStatesValidated)
+    {
+        return true;
+    }
+
+    bool webglCompatibility = mState.mExtensions.webglCompatibility;
+    const State::DirtyBits &dirtyBitsMask =
+        webglCompatibility ? mWebGLDrawStatesDirtyBits : mDrawStatesDirtyBits;
+    const State::DirtyObjects &dirtyObjectsMask =
+        webglCompatibility ? mWebGLDrawStatesDirtyObjects : mDrawStatesDirtyObjects;
+
+    const State &state = getGLState();
+    return (state.getDirtyBitsSinceLastDraw() & dirtyBitsMask).any() ||
+           (state.getDirtyObjectsSinceLastDraw() & dirtyObjectsMask).any();
+}
+
+void ValidationContext::onDrawStatesValidated(GLint64 nonInstancedVertexElementLimit,
+                                              GLint64 instancedVertexElementLimit)
+{
+    const State &state = getGLState();
+    mDrawFramebufferObserverBinding.bind(state.getDrawFramebuffer());
+    mProgramObserverBinding.bind(state.getProgram());
+
+    // Only the buffers of the enabled attributes are observed, the others don't matter until the
+    // vertex array changes.
+    const VertexArray *vao = state.getVertexArray();
+    angle::BitSet<MAX_VERTEX_ATTRIB_BINDINGS> enabledBindings;
+    for (size_t attribIndex : vao->getEnabledAttributesMask())
+    {
+        enabledBindings.set(vao->getVertexAttribute(attribIndex).bindingIndex);
+    }
+
+    for (size_t bindingIndex = 0; bindingIndex < mVertexBufferObserverBindings.size();
+         ++bindingIndex)
+    {
+        Buffer *buffer = nullptr;
+        if (enabledBindings[bindingIndex])
+        {
+            buffer = vao->getVertexBinding(bindingIndex).getBuffer().get();
+        }
+        mVertexBufferObserverBindings[bindingIndex].bind(buffer);
+    }
+
+    mDrawStatesValidated                  = true;
+    mCachedNonInstancedVertexElementLimit = nonInstancedVertexElementLimit;
+    mCachedInstancedVertexElementLimit    = instancedVertexElementLimit;
+}
+
+void ValidationContext::invalidateDrawStates()
+{
+    mDrawStatesValidated                  = false;
+    mCachedNonInstancedVertexElementLimit = -1;
+    mCachedInstancedVertexElementLimit    = -1;
+}
+
+void ValidationContext::onSubjectStateChange(const Context *context,
+                                             angle::SubjectIndex index,
+                                             angle::SubjectMessage message)
+{
+    invalidateDrawStates();
+}
+
 }  // namespace gl
@@ -89,7 +89,7 @@ class ContextState final : angle::NonCopyable
     ProgramPipelineManager *mPipelines;
 };
 
-class ValidationContext : angle::NonCopyable
+class ValidationContext : public angle::ObserverInterface, angle::NonCopyable
 {
   public:
     ValidationContext(const ValidationContext *shareContext,
@@ -121,6 +121,8 @@ class ValidationContext : angle::NonCopyable
     bool getIndexedQueryParameterInfo(GLenum target, GLenum *type, unsigned int *numParams);
 
     Program *getProgram(GLuint handle) const;
+    // Doesn't finish a link that runs in the background.
+    Program *getProgramNoResolveLink(GLuint handle) const;
     Shader *getShader(GLuint handle) const;
 
     bool isTextureGenerated(GLuint texture) const;
@@ -142,6 +144,28 @@ class ValidationContext : angle::NonCopyable
 
     bool isValidBufferBinding(BufferBinding binding) const { return mValidBufferBindings[binding]; }
 
+    // Draw call validation caches the checks that only depend on the state, until the state they
+    // depend on changes. The cache is invalidated by the dirty bits and objects of the state, and
+    // by the state changes of the draw framebuffer, the program and the vertex buffers.
+    bool needsDrawStatesValidation() const;
+    bool hasValidatedDrawStates() const { return mDrawStatesValidated; }
+    void onDrawStatesValidated(GLint64 nonInstancedVertexElementLimit,
+                               GLint64 instancedVertexElementLimit);
+    void invalidateDrawStates();
+
+    // The largest vertex and instance that the vertex buffers of the active attributes have data
+    // for, when the draw states are validated.
+    GLint64 getNonInstancedVertexElementLimit() const
+    {
+        return mCachedNonInstancedVertexElementLimit;
+    }
+    GLint64 getInstancedVertexElementLimit() const { return mCachedInstancedVertexElementLimit; }
+
+    // Observer implementation.
+    void onSubjectStateChange(const Context *context,
+                              angle::SubjectIndex index,
+                              angle::SubjectMessage message) override;
+
   protected:
     ContextState mState;
     bool mSkipValidation;
@@ -154,6 +178,18 @@ class ValidationContext : angle::NonCopyable
     mutable const ParamTypeInfo *mSavedArgsType;
     static constexpr size_t kParamsBufferSize = 64u;
     mutable std::array<uint8_t, kParamsBufferSize> mParamsBuffer;
+
+    // Draw states validation cache.
+    bool mDrawStatesValidated;
+    GLint64 mCachedNonInstancedVertexElementLimit;
+    GLint64 mCachedInstancedVertexElementLimit;
+    State::DirtyBits mDrawStatesDirtyBits;
+    State::DirtyBits mWebGLDrawStatesDirtyBits;
+    State::DirtyObjects mDrawStatesDirtyObjects;
+    State::DirtyObjects mWebGLDrawStatesDirtyObjects;
+    angle::ObserverBinding mDrawFramebufferObserverBinding;
+    angle::ObserverBinding mProgramObserverBinding;
+    std::vector<angle::ObserverBinding> mVertexBufferObserverBindings;
 };
 
 template <typename T>
@@ -0,0 +1,142 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DiskCache: Stores binary blobs as files in a directory, one file per SHA-1 hash, so that the
+//   caches of compilation results persist between runs. Used by the shader translation cache and
+//   the SPIR-V cache of the Vulkan back-end.
+
+#include "libANGLE/DiskCache.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <sstream>
+
+#include "common/debug.h"
+#include "common/system_utils.h"
+
+namespace gl
+{
+
+namespace
+{
+constexpr unsigned int kWarningLimit = 3;
+}  // anonymous namespace
+
+DiskCache::DiskCache(const char *extension, const char *description)
+    : mExtension(extension), mDescription(description), mIssuedWarnings(0)
+{
+}
+
+DiskCache::~DiskCache()
+{
+}
+
+void DiskCache::setDirectory(const std::string &directory)
+{
+    mDirectory = directory;
+}
+
+bool DiskCache::load(const ProgramHash &hash, angle::MemoryBuffer *binaryOut) const
+{
+    if (!isEnabled())
+    {
+        return false;
+    }
+
+    std::ifstream file(getPath(hash), std::ios::in | std::ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+
+    file.seekg(0, std::ios::end);
+    std::streamoff fileSize = file.tellg();
+    file.seekg(0, std::ios::beg);
+    if (fileSize <= 0 || !binaryOut->resize(static_cast<size_t>(fileSize)))
+    {
+        return false;
+    }
+
+    file.read(reinterpret_cast<char *>(binaryOut->data()), fileSize);
+    return file.good();
+}
+
+void DiskCache::store(const ProgramHash &hash, const angle::MemoryBuffer &binary)
+{
+    if (!isEnabled())
+    {
+        return;
+    }
+
+    std::string path = getPath(hash);
+    if (!StoreFile(path, binary))
+    {
+        reportFailedStore(path);
+    }
+}
+
+// static
+bool DiskCache::StoreFile(const std::string &path, const angle::MemoryBuffer &binary)
+{
+    std::ostringstream tempPath;
+    tempPath << path << "." << std::hex << std::random_device()() << ".tmp";
+
+    bool stored = false;
+    {
+        std::ofstream file(tempPath.str(), std::ios::out | std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char *>(binary.data()), binary.size());
+        file.close();
+        stored = file.good();
+    }
+    stored = stored && angle::RenameFile(tempPath.str().c_str(), path.c_str());
+
+    if (!stored)
+    {
+        std::remove(tempPath.str().c_str());
+    }
+    return stored;
+}
+
+void DiskCache::reportFailedStore(const std::string &path)
+{
+    if (shouldWarn())
+    {
+        WARN() << "Failed to store " << mDescription << " in disk cache at " << path;
+    }
+}
+
+void DiskCache::reportCorruptEntry(const ProgramHash &hash)
+{
+    if (shouldWarn())
+    {
+        WARN() << "Failed to load " << mDescription << " from disk cache at " << getPath(hash);
+    }
+}
+
+void DiskCache::resetWarnings()
+{
+    mIssuedWarnings = 0;
+}
+
+std::string DiskCache::getPath(const ProgramHash &hash) const
+{
+    std::ostringstream path;
+    path << mDirectory << "/" << std::hex << std::setfill('0');
+    for (uint8_t byte : hash)
+    {
+        path << std::setw(2) << static_cast<unsigned int>(byte);
+    }
+    path << mExtension;
+    return path.str();
+}
+
+bool DiskCache::shouldWarn()
+{
+    return mIssuedWarnings++ < kWarningLimit;
+}
+
+}  // namespace gl
@@ -0,0 +1,66 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DiskCache: Stores binary blobs as files in a directory, one file per SHA-1 hash, so that the
+//   caches of compilation results persist between runs. Used by the shader translation cache and
+//   the SPIR-V cache of the Vulkan back-end.
+
+#ifndef LIBANGLE_DISK_CACHE_H_
+#define LIBANGLE_DISK_CACHE_H_
+
+#include <string>
+
+#include "common/MemoryBuffer.h"
+#include "libANGLE/MemoryProgramCache.h"
+
+namespace gl
+{
+
+class DiskCache final : angle::NonCopyable
+{
+  public:
+    // The file of each entry is named after the hash followed by |extension|. Warnings describe
+    // the entries as |description|.
+    DiskCache(const char *extension, const char *description);
+    ~DiskCache();
+
+    // Entries are stored in the given directory. An empty path disables the cache.
+    void setDirectory(const std::string &directory);
+    bool isEnabled() const { return !mDirectory.empty(); }
+
+    // Returns false if the cache is disabled or the entry can't be read.
+    bool load(const ProgramHash &hash, angle::MemoryBuffer *binaryOut) const;
+
+    // Writes the entry to a file of its own and then renames it into place, so that a crash or
+    // another process storing the same entry never leaves a truncated entry behind.
+    void store(const ProgramHash &hash, const angle::MemoryBuffer &binary);
+
+    // The file writing half of store(), which touches no state of the cache so that callers can
+    // do it without holding their lock. Returns false, leaving no file behind, on failure.
+    static bool StoreFile(const std::string &path, const angle::MemoryBuffer &binary);
+
+    // Warns about an entry that StoreFile() failed to write to |path|.
+    void reportFailedStore(const std::string &path);
+
+    // Warns about an entry that was loaded but couldn't be used, which is then treated as a miss.
+    void reportCorruptEntry(const ProgramHash &hash);
+
+    // Warnings are only issued for the first few failures, until this is called.
+    void resetWarnings();
+
+    std::string getPath(const ProgramHash &hash) const;
+
+  private:
+    bool shouldWarn();
+
+    std::string mDirectory;
+    const char *mExtension;
+    const char *mDescription;
+    unsigned int mIssuedWarnings;
+};
+
+}  // namespace gl
+
+#endif  // LIBANGLE_DISK_CACHE_H_
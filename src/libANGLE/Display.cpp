@@ -22,6 +22,7 @@
 #include "common/debug.h"
 #include "common/mathutil.h"
 #include "common/platform.h"
+#include "common/system_utils.h"
 #include "common/utilities.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Device.h"
@@ -386,6 +387,8 @@ Display::Display(EGLenum platform, EGLNativeDisplayType displayId, Device *eglDe
       mPlatform(platform),
       mTextureManager(nullptr),
       mMemoryProgramCache(gl::kDefaultMaxProgramCacheMemoryBytes),
+      mMemoryShaderCache(gl::kDefaultMaxShaderCacheMemoryBytes),
+      mWorkerThreadPool(gl::kDefaultMaxWorkerThreads),
       mGlobalTextureShareGroupUsers(0),
       mProxyContext(this)
 {
@@ -453,6 +456,9 @@ Error Display::initialize()
 
     gl::InitializeDebugAnnotations(&mAnnotator);
 
+    // Translated shaders can persist between runs if a cache directory is given.
+    mMemoryShaderCache.setDiskCacheDirectory(angle::GetEnvironmentVar("ANGLE_SHADER_CACHE_DIR"));
+
     SCOPED_ANGLE_HISTOGRAM_TIMER("GPU.ANGLE.DisplayInitializeMS");
     TRACE_EVENT0("gpu.angle", "egl::Display::initialize");
 
@@ -515,8 +521,9 @@ Error Display::initialize()
     }
 
     mProxyContext.reset(nullptr);
-    gl::Context *proxyContext = new gl::Context(mImplementation, nullptr, nullptr, nullptr, nullptr,
-                                                egl::AttributeMap(), mDisplayExtensions);
+    gl::Context *proxyContext =
+        new gl::Context(mImplementation, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+                        egl::AttributeMap(), mDisplayExtensions);
     mProxyContext.reset(proxyContext);
 
     mInitialized = true;
@@ -529,6 +536,7 @@ Error Display::terminate()
     ANGLE_TRY(makeCurrent(nullptr, nullptr, nullptr));
 
     mMemoryProgramCache.clear();
+    mMemoryShaderCache.clear();
 
     mProxyContext.reset(nullptr);
 
@@ -780,7 +788,7 @@ Error Display::createContext(const Config *configuration,
 
     gl::Context *context =
         new gl::Context(mImplementation, configuration, shareContext, shareTextures, cachePointer,
-                        attribs, mDisplayExtensions);
+                        &mMemoryShaderCache, &mWorkerThreadPool, attribs, mDisplayExtensions);
 
     ASSERT(context != nullptr);
     mContextSet.insert(context);
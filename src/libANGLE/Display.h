@@ -14,12 +14,14 @@
 #include <set>
 #include <vector>
 
+#include "common/WorkerThread.h"
 #include "libANGLE/AttributeMap.h"
 #include "libANGLE/Caps.h"
 #include "libANGLE/Config.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/LoggingAnnotator.h"
 #include "libANGLE/MemoryProgramCache.h"
+#include "libANGLE/MemoryShaderCache.h"
 #include "libANGLE/Version.h"
 
 namespace gl
@@ -206,6 +208,8 @@ class Display final : angle::NonCopyable
 
     gl::TextureManager *mTextureManager;
     gl::MemoryProgramCache mMemoryProgramCache;
+    gl::MemoryShaderCache mMemoryShaderCache;
+    angle::WorkerThreadPool mWorkerThreadPool;
     size_t mGlobalTextureShareGroupUsers;
 
     // This gl::Context is a simple proxy to the Display for the GL back-end entry points
@@ -133,7 +133,11 @@ class FramebufferState final : angle::NonCopyable
     angle::BitSet<IMPLEMENTATION_MAX_FRAMEBUFFER_ATTACHMENTS + 2> mResourceNeedsInit;
 };
 
-class Framebuffer final : public LabeledObject, public angle::ObserverInterface
+// Forwards the state changes of its attachments to its own observers. Its other state changes are
+// made by the context that it belongs to, which marks it dirty in the gl::State.
+class Framebuffer final : public LabeledObject,
+                          public angle::ObserverInterface,
+                          public angle::Subject
 {
   public:
     // Constructor to build application-defined framebuffers
@@ -0,0 +1,186 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// FreeListHandleAllocator.cpp: Implements the gl::FreeListHandleAllocator class, which allocates,
+// releases and reserves GL handles in constant time.
+
+#include "libANGLE/FreeListHandleAllocator.h"
+
+#include <limits>
+
+namespace gl
+{
+
+FreeListHandleAllocator::FreeListHandleAllocator()
+    : FreeListHandleAllocator(std::numeric_limits<GLuint>::max())
+{
+}
+
+FreeListHandleAllocator::FreeListHandleAllocator(GLuint maximumHandleValue)
+    : mBaseValue(1), mMaxValue(maximumHandleValue), mNextValue(1), mLoggingEnabled(false)
+{
+}
+
+FreeListHandleAllocator::~FreeListHandleAllocator()
+{
+}
+
+void FreeListHandleAllocator::setBaseHandle(GLuint value)
+{
+    ASSERT(mNextValue == mBaseValue && mReservedAboveNextValue.empty());
+    mBaseValue = value;
+    mNextValue = value;
+}
+
+GLuint FreeListHandleAllocator::allocate()
+{
+    // Reuse the most recently released handle, skipping the ones that were reserved since.
+    while (!mReleasedList.empty())
+    {
+        GLuint reusedHandle = mReleasedList.back();
+        mReleasedList.pop_back();
+
+        size_t index           = reusedHandle - mBaseValue;
+        mInReleasedList[index] = false;
+        if (!mAllocated[index])
+        {
+            mAllocated[index] = true;
+
+            if (mLoggingEnabled)
+            {
+                WARN() << "FreeListHandleAllocator::allocate reusing " << reusedHandle
+                       << std::endl;
+            }
+
+            return reusedHandle;
+        }
+    }
+
+    // Allocate a new handle, skipping the ones that were reserved ahead of it.
+    GLuint newHandle = allocateNextValue();
+    while (!mReservedAboveNextValue.empty() && mReservedAboveNextValue.erase(newHandle) > 0)
+    {
+        newHandle = allocateNextValue();
+    }
+
+    if (mLoggingEnabled)
+    {
+        WARN() << "FreeListHandleAllocator::allocate allocating " << newHandle << std::endl;
+    }
+
+    return newHandle;
+}
+
+void FreeListHandleAllocator::release(GLuint handle)
+{
+    if (mLoggingEnabled)
+    {
+        WARN() << "FreeListHandleAllocator::release releasing " << handle << std::endl;
+    }
+
+    if (!isBelowNextValue(handle))
+    {
+        size_t erasedCount = mReservedAboveNextValue.erase(handle);
+        ASSERT(erasedCount == 1);
+        UNUSED_VARIABLE(erasedCount);
+        return;
+    }
+
+    size_t index = handle - mBaseValue;
+    ASSERT(mAllocated[index]);
+    mAllocated[index] = false;
+
+    // The handle is still in the released list if it was reserved since it was last released.
+    if (!mInReleasedList[index])
+    {
+        mInReleasedList[index] = true;
+        mReleasedList.push_back(handle);
+        ASSERT(mReleasedList.size() <= mAllocated.size());
+    }
+
+#if defined(ANGLE_ENABLE_ASSERTS)
+    mGenerations[index]++;
+#endif  // defined(ANGLE_ENABLE_ASSERTS)
+}
+
+void FreeListHandleAllocator::reserve(GLuint handle)
+{
+    if (mLoggingEnabled)
+    {
+        WARN() << "FreeListHandleAllocator::reserve reserving " << handle << std::endl;
+    }
+
+    ASSERT(handle >= mBaseValue && handle <= mMaxValue);
+
+    if (isBelowNextValue(handle))
+    {
+        // The handle may be in the released list, allocate() skips it there.
+        size_t index = handle - mBaseValue;
+        ASSERT(!mAllocated[index]);
+        mAllocated[index] = true;
+    }
+    else if (handle == mNextValue)
+    {
+        allocateNextValue();
+    }
+    else
+    {
+        bool inserted = mReservedAboveNextValue.insert(handle).second;
+        ASSERT(inserted);
+        UNUSED_VARIABLE(inserted);
+    }
+}
+
+void FreeListHandleAllocator::reset()
+{
+    mNextValue = mBaseValue;
+    mAllocated.clear();
+    mInReleasedList.clear();
+    mReleasedList.clear();
+    mReservedAboveNextValue.clear();
+
+#if defined(ANGLE_ENABLE_ASSERTS)
+    mGenerations.clear();
+#endif  // defined(ANGLE_ENABLE_ASSERTS)
+}
+
+void FreeListHandleAllocator::enableLogging(bool enabled)
+{
+    mLoggingEnabled = enabled;
+}
+
+unsigned int FreeListHandleAllocator::getGeneration(GLuint handle) const
+{
+#if defined(ANGLE_ENABLE_ASSERTS)
+    if (isBelowNextValue(handle))
+    {
+        return mGenerations[handle - mBaseValue];
+    }
+#endif  // defined(ANGLE_ENABLE_ASSERTS)
+    return 0;
+}
+
+bool FreeListHandleAllocator::isBelowNextValue(GLuint handle) const
+{
+    ASSERT(handle >= mBaseValue);
+    return handle < mNextValue;
+}
+
+GLuint FreeListHandleAllocator::allocateNextValue()
+{
+    ASSERT(mNextValue <= mMaxValue);
+    GLuint handle = static_cast<GLuint>(mNextValue++);
+    mAllocated.push_back(true);
+    mInReleasedList.push_back(false);
+
+#if defined(ANGLE_ENABLE_ASSERTS)
+    mGenerations.push_back(0);
+#endif  // defined(ANGLE_ENABLE_ASSERTS)
+
+    return handle;
+}
+
+}  // namespace gl
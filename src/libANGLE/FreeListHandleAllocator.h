@@ -0,0 +1,83 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// FreeListHandleAllocator.h: Defines the gl::FreeListHandleAllocator class, which allocates,
+// releases and reserves GL handles in constant time.
+
+#ifndef LIBANGLE_FREELISTHANDLEALLOCATOR_H_
+#define LIBANGLE_FREELISTHANDLEALLOCATOR_H_
+
+#include <unordered_set>
+#include <vector>
+
+#include "angle_gl.h"
+#include "common/angleutils.h"
+#include "common/debug.h"
+
+namespace gl
+{
+
+// Has the same interface as HandleAllocator. The handles below the next never allocated one are
+// tracked by a bitmap, and the released ones are reused from a free list, most recently released
+// first. HandleAllocator reuses the smallest released handle first instead, which takes a heap and
+// isn't constant time. GL doesn't specify which unused name glGen* returns. Reserving a handle
+// only sets its bit, so the free list can hold handles that were reserved since they were
+// released, which allocate() skips. A handle is in the free list at most once, so the list never
+// holds more entries than there are handles below the next one.
+class FreeListHandleAllocator final : angle::NonCopyable
+{
+  public:
+    // Maximum handle = MAX_UINT
+    FreeListHandleAllocator();
+    // Specify maximum handle value. Used for testing.
+    FreeListHandleAllocator(GLuint maximumHandleValue);
+
+    ~FreeListHandleAllocator();
+
+    void setBaseHandle(GLuint value);
+
+    GLuint allocate();
+    void release(GLuint handle);
+    void reserve(GLuint handle);
+    void reset();
+
+    void enableLogging(bool enabled);
+
+    // The generation of a handle changes each time it is released, so that code which keeps a
+    // handle can check that it wasn't released and allocated again. Generations are only tracked
+    // when asserts are enabled, and are always 0 otherwise.
+    unsigned int getGeneration(GLuint handle) const;
+
+  private:
+    bool isBelowNextValue(GLuint handle) const;
+    GLuint allocateNextValue();
+
+    GLuint mBaseValue;
+    GLuint mMaxValue;
+
+    // 64 bits, so that the maximum handle can be allocated.
+    uint64_t mNextValue;
+
+    // Whether each handle in [mBaseValue, mNextValue) is allocated, and whether it is in
+    // mReleasedList.
+    std::vector<bool> mAllocated;
+    std::vector<bool> mInReleasedList;
+    std::vector<GLuint> mReleasedList;
+
+    // Handles at or above mNextValue that were reserved. They are moved to mAllocated when the
+    // next value reaches them.
+    std::unordered_set<GLuint> mReservedAboveNextValue;
+
+#if defined(ANGLE_ENABLE_ASSERTS)
+    std::vector<unsigned int> mGenerations;
+#endif  // defined(ANGLE_ENABLE_ASSERTS)
+
+    bool mLoggingEnabled;
+};
+
+}  // namespace gl
+
+#endif  // LIBANGLE_FREELISTHANDLEALLOCATOR_H_
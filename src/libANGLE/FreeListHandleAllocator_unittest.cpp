@@ -0,0 +1,269 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Unit tests for FreeListHandleAllocator.
+//
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <random>
+#include <set>
+
+#include "libANGLE/FreeListHandleAllocator.h"
+
+namespace
+{
+
+TEST(FreeListHandleAllocatorTest, ReservationsWithGaps)
+{
+    gl::FreeListHandleAllocator allocator;
+
+    std::set<GLuint> allocationList;
+    for (GLuint id = 2; id < 50; id += 2)
+    {
+        allocationList.insert(id);
+    }
+
+    for (GLuint id : allocationList)
+    {
+        allocator.reserve(id);
+    }
+
+    std::set<GLuint> allocatedList;
+    for (size_t allocationNum = 0; allocationNum < allocationList.size() * 2; ++allocationNum)
+    {
+        GLuint handle = allocator.allocate();
+        EXPECT_EQ(0u, allocationList.count(handle));
+        EXPECT_EQ(0u, allocatedList.count(handle));
+        allocatedList.insert(handle);
+    }
+}
+
+// Tests a random sequence of allocations, reservations and releases.
+TEST(FreeListHandleAllocatorTest, Random)
+{
+    gl::FreeListHandleAllocator allocator;
+    std::mt19937 random(1);
+
+    std::set<GLuint> allocationList;
+    for (size_t iterationCount = 0; iterationCount < 1000; ++iterationCount)
+    {
+        GLuint randomHandle = (random() % 1000) + 1;
+        switch (random() % 3)
+        {
+            case 0:
+                if (allocationList.count(randomHandle) == 0)
+                {
+                    allocator.reserve(randomHandle);
+                    allocationList.insert(randomHandle);
+                }
+                break;
+            case 1:
+                if (allocationList.count(randomHandle) != 0)
+                {
+                    allocator.release(randomHandle);
+                    allocationList.erase(randomHandle);
+                }
+                break;
+            default:
+            {
+                GLuint normalHandle = allocator.allocate();
+                EXPECT_EQ(0u, allocationList.count(normalHandle));
+                allocationList.insert(normalHandle);
+                break;
+            }
+        }
+    }
+}
+
+TEST(FreeListHandleAllocatorTest, Reallocation)
+{
+    gl::FreeListHandleAllocator limitedAllocator(10);
+
+    for (GLuint count = 1; count < 10; count++)
+    {
+        GLuint result = limitedAllocator.allocate();
+        EXPECT_EQ(count, result);
+    }
+
+    for (GLuint count = 1; count < 10; count++)
+    {
+        limitedAllocator.release(count);
+    }
+
+    for (GLuint count = 2; count < 10; count++)
+    {
+        limitedAllocator.reserve(count);
+    }
+
+    GLuint finalResult = limitedAllocator.allocate();
+    EXPECT_EQ(1u, finalResult);
+}
+
+// Tests that the most recently released handle is reused first. HandleAllocator would reuse 2
+// first, the smallest released handle.
+TEST(FreeListHandleAllocatorTest, ReuseReleasedHandle)
+{
+    gl::FreeListHandleAllocator allocator;
+
+    for (GLuint count = 1; count <= 5; count++)
+    {
+        EXPECT_EQ(count, allocator.allocate());
+    }
+
+    allocator.release(2);
+    allocator.release(4);
+    EXPECT_EQ(4u, allocator.allocate());
+    EXPECT_EQ(2u, allocator.allocate());
+    EXPECT_EQ(6u, allocator.allocate());
+
+    // Handles released in increasing order come back in decreasing order.
+    allocator.release(1);
+    allocator.release(3);
+    allocator.release(5);
+    EXPECT_EQ(5u, allocator.allocate());
+    EXPECT_EQ(3u, allocator.allocate());
+    EXPECT_EQ(1u, allocator.allocate());
+    EXPECT_EQ(7u, allocator.allocate());
+}
+
+// Tests reserving the largest handles, and allocating past reserved handles.
+TEST(FreeListHandleAllocatorTest, ReserveAboveNextHandle)
+{
+    gl::FreeListHandleAllocator allocator;
+
+    GLuint maxUintHandle = std::numeric_limits<GLuint>::max();
+    allocator.reserve(maxUintHandle - 1);
+    allocator.reserve(maxUintHandle);
+    allocator.reserve(2);
+    allocator.reserve(3);
+
+    EXPECT_EQ(1u, allocator.allocate());
+    EXPECT_EQ(4u, allocator.allocate());
+
+    allocator.release(maxUintHandle);
+    allocator.release(3);
+    EXPECT_EQ(3u, allocator.allocate());
+    EXPECT_EQ(5u, allocator.allocate());
+}
+
+// Tests that a released handle which is reserved again isn't allocated.
+TEST(FreeListHandleAllocatorTest, ReserveAfterRelease)
+{
+    gl::FreeListHandleAllocator allocator;
+
+    for (GLuint count = 1; count <= 16; count++)
+    {
+        allocator.allocate();
+    }
+
+    for (GLuint count = 1; count <= 16; count++)
+    {
+        allocator.release(count);
+    }
+
+    allocator.reserve(16);
+    allocator.reserve(1);
+
+    std::set<GLuint> allocatedList;
+    for (GLuint count = 0; count < 20; count++)
+    {
+        GLuint handle = allocator.allocate();
+        EXPECT_NE(1u, handle);
+        EXPECT_NE(16u, handle);
+        EXPECT_EQ(0u, allocatedList.count(handle));
+        allocatedList.insert(handle);
+    }
+}
+
+// Tests the reset method.
+TEST(FreeListHandleAllocatorTest, Reset)
+{
+    gl::FreeListHandleAllocator allocator;
+
+    for (int iteration = 0; iteration < 2; ++iteration)
+    {
+        allocator.reserve(3);
+        allocator.reserve(100);
+        EXPECT_EQ(1u, allocator.allocate());
+        EXPECT_EQ(2u, allocator.allocate());
+        EXPECT_EQ(4u, allocator.allocate());
+        allocator.reset();
+    }
+}
+
+// Tests allocating from a base handle of zero.
+TEST(FreeListHandleAllocatorTest, BaseHandle)
+{
+    gl::FreeListHandleAllocator allocator;
+    allocator.setBaseHandle(0);
+
+    EXPECT_EQ(0u, allocator.allocate());
+    EXPECT_EQ(1u, allocator.allocate());
+}
+
+// Tests reserving and releasing the same released handles many times, which must not add them
+// to the free list again.
+TEST(FreeListHandleAllocatorTest, ReserveReleaseChurn)
+{
+    gl::FreeListHandleAllocator allocator;
+
+    for (GLuint count = 1; count <= 4; count++)
+    {
+        EXPECT_EQ(count, allocator.allocate());
+    }
+    allocator.release(1);
+    allocator.release(3);
+
+    for (int iteration = 0; iteration < 1000000; ++iteration)
+    {
+        allocator.reserve(1);
+        allocator.release(1);
+        allocator.reserve(3);
+        allocator.release(3);
+    }
+
+    // Each released handle is reused once.
+    EXPECT_EQ(3u, allocator.allocate());
+    EXPECT_EQ(1u, allocator.allocate());
+    EXPECT_EQ(5u, allocator.allocate());
+
+    allocator.release(3);
+    allocator.reserve(3);
+    EXPECT_EQ(6u, allocator.allocate());
+}
+
+#if defined(ANGLE_ENABLE_ASSERTS)
+// Tests that a handle kept across a release is seen to be stale once the handle is allocated or
+// reserved again.
+TEST(FreeListHandleAllocatorTest, StaleHandle)
+{
+    gl::FreeListHandleAllocator allocator;
+
+    GLuint handle                = allocator.allocate();
+    GLuint otherHandle           = allocator.allocate();
+    unsigned int generation      = allocator.getGeneration(handle);
+    unsigned int otherGeneration = allocator.getGeneration(otherHandle);
+
+    allocator.release(handle);
+    EXPECT_EQ(handle, allocator.allocate());
+    EXPECT_NE(generation, allocator.getGeneration(handle));
+    EXPECT_EQ(otherGeneration, allocator.getGeneration(otherHandle));
+
+    generation = allocator.getGeneration(handle);
+    allocator.release(handle);
+    allocator.reserve(handle);
+    EXPECT_NE(generation, allocator.getGeneration(handle));
+
+    // Releasing a handle that is still in the free list changes its generation too.
+    generation = allocator.getGeneration(handle);
+    allocator.release(handle);
+    allocator.reserve(handle);
+    EXPECT_NE(generation, allocator.getGeneration(handle));
+}
+#endif  // defined(ANGLE_ENABLE_ASSERTS)
+
+}  // anonymous namespace
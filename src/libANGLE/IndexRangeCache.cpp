@@ -9,52 +9,110 @@
 
 #include "libANGLE/IndexRangeCache.h"
 
+#include <algorithm>
+#include <tuple>
+
 #include "common/debug.h"
-#include "libANGLE/formatutils.h"
+#include "common/utilities.h"
+#include "libANGLE/renderer/BufferImpl.h"
 
 namespace gl
 {
 
-IndexRangeCache::IndexRangeCache()
+namespace
+{
+
+size_t PyramidIndex(GLenum type)
 {
+    return ElementTypeSize(type) / 2;
 }
 
-IndexRangeCache::~IndexRangeCache()
+}  // anonymous namespace
+
+constexpr size_t IndexRangeCache::kIndicesPerBlock;
+constexpr size_t IndexRangeCache::kMaxScannedRanges;
+
+IndexRangeCache::IndexRangeCache() : mMaxScannedRangeBytes(0)
 {
 }
 
-void IndexRangeCache::addRange(GLenum type,
-                               size_t offset,
-                               size_t count,
-                               bool primitiveRestartEnabled,
-                               const IndexRange &range)
+IndexRangeCache::~IndexRangeCache()
 {
-    mIndexRangeCache[IndexRangeKey(type, offset, count, primitiveRestartEnabled)] = range;
 }
 
-bool IndexRangeCache::findRange(GLenum type,
+Error IndexRangeCache::getRange(const Context *context,
+                                rx::BufferImpl *bufferImpl,
+                                GLenum type,
                                 size_t offset,
                                 size_t count,
                                 bool primitiveRestartEnabled,
-                                IndexRange *outRange) const
+                                size_t bufferSize,
+                                IndexRange *outRange)
 {
-    auto i = mIndexRangeCache.find(IndexRangeKey(type, offset, count, primitiveRestartEnabled));
-    if (i != mIndexRangeCache.end())
+    size_t indexBytes = ElementTypeSize(type);
+    size_t firstIndex = offset / indexBytes;
+    size_t endIndex   = firstIndex + count;
+    size_t firstBlock = (firstIndex + kIndicesPerBlock - 1) / kIndicesPerBlock;
+    size_t endBlock   = endIndex / kIndicesPerBlock;
+
+    // Short draws are scanned directly, they would mostly be made of the partial blocks at their
+    // ends anyway.
+    if (offset % indexBytes != 0 || endBlock < firstBlock + 2)
     {
-        if (outRange)
-        {
-            *outRange = i->second;
-        }
-        return true;
+        return scanRange(context, bufferImpl, type, offset, count, primitiveRestartEnabled,
+                         outRange);
     }
-    else
+
+    Pyramid *pyramid = &mPyramids[PyramidIndex(type)];
+    ANGLE_TRY(updatePyramid(context, bufferImpl, type, bufferSize, pyramid));
+    ASSERT(endBlock <= pyramid->levels[0].size());
+
+    BlockRange range = {0, 0, 0};
+
+    size_t headCount = firstBlock * kIndicesPerBlock - firstIndex;
+    size_t tailCount = endIndex - endBlock * kIndicesPerBlock;
+    IndexRange edgeRange;
+    if (headCount > 0)
+    {
+        ANGLE_TRY(scanRange(context, bufferImpl, type, offset, headCount, true, &edgeRange));
+        range.merge({static_cast<GLuint>(edgeRange.start), static_cast<GLuint>(edgeRange.end),
+                     edgeRange.vertexIndexCount});
+    }
+    if (tailCount > 0)
     {
-        if (outRange)
+        ANGLE_TRY(scanRange(context, bufferImpl, type, endBlock * kIndicesPerBlock * indexBytes,
+                            tailCount, true, &edgeRange));
+        range.merge({static_cast<GLuint>(edgeRange.start), static_cast<GLuint>(edgeRange.end),
+                     edgeRange.vertexIndexCount});
+    }
+
+    // Walk up the pyramid, taking the ranges at the ends of [begin, end) that don't share a
+    // parent with the rest.
+    for (size_t level = 0, begin = firstBlock, end = endBlock; begin < end;
+         ++level, begin /= 2, end /= 2)
+    {
+        const std::vector<BlockRange> &ranges = pyramid->levels[level];
+        if (begin % 2 != 0)
+        {
+            range.merge(ranges[begin++]);
+        }
+        if (end % 2 != 0)
         {
-            *outRange = IndexRange();
+            range.merge(ranges[--end]);
         }
-        return false;
     }
+
+    if (range.vertexIndexCount == count || primitiveRestartEnabled)
+    {
+        *outRange = IndexRange(range.start, range.end, range.vertexIndexCount);
+        return NoError();
+    }
+
+    // Without primitive restart, the restart indices are regular indices, and the largest ones.
+    GLuint restartIndex = GetPrimitiveRestartIndex(type);
+    GLuint start        = range.vertexIndexCount > 0 ? range.start : restartIndex;
+    *outRange           = IndexRange(start, restartIndex, count);
+    return NoError();
 }
 
 void IndexRangeCache::invalidateRange(size_t offset, size_t size)
@@ -62,60 +120,193 @@ void IndexRangeCache::invalidateRange(size_t offset, size_t size)
     size_t invalidateStart = offset;
     size_t invalidateEnd   = offset + size;
 
-    auto i = mIndexRangeCache.begin();
-    while (i != mIndexRangeCache.end())
+    // Only the ranges that start in [invalidateStart - mMaxScannedRangeBytes, invalidateEnd) can
+    // overlap the write.
+    size_t searchStart =
+        invalidateStart > mMaxScannedRangeBytes ? invalidateStart - mMaxScannedRangeBytes : 0;
+    auto scannedRange = mScannedRanges.lower_bound(IndexRangeKey(searchStart, 0, 0, false));
+    auto searchEnd    = mScannedRanges.lower_bound(IndexRangeKey(invalidateEnd, 0, 0, false));
+    while (scannedRange != searchEnd)
     {
-        size_t rangeStart = i->first.offset;
-        size_t rangeEnd   = i->first.offset + (GetTypeInfo(i->first.type).bytes * i->first.count);
+        const IndexRangeKey &key = scannedRange->first;
+        size_t rangeEnd          = key.offset + ElementTypeSize(key.type) * key.count;
 
-        if (invalidateEnd < rangeStart || invalidateStart > rangeEnd)
+        if (invalidateStart >= rangeEnd)
         {
-            ++i;
+            ++scannedRange;
         }
         else
         {
-            mIndexRangeCache.erase(i++);
+            scannedRange = mScannedRanges.erase(scannedRange);
         }
     }
+
+    for (size_t pyramidIndex = 0; pyramidIndex < ArraySize(mPyramids); ++pyramidIndex)
+    {
+        Pyramid &pyramid = mPyramids[pyramidIndex];
+        if (pyramid.levels.empty())
+        {
+            continue;
+        }
+
+        size_t indexBytes = std::max<size_t>(pyramidIndex * 2, 1);
+        size_t blockBytes = kIndicesPerBlock * indexBytes;
+        size_t blockCount = pyramid.levels[0].size();
+        size_t begin      = offset / blockBytes;
+        size_t end        = std::min((offset + size + blockBytes - 1) / blockBytes, blockCount);
+        if (begin >= end)
+        {
+            continue;
+        }
+
+        if (pyramid.dirtyBegin < pyramid.dirtyEnd)
+        {
+            begin = std::min(begin, pyramid.dirtyBegin);
+            end   = std::max(end, pyramid.dirtyEnd);
+        }
+        pyramid.dirtyBegin = begin;
+        pyramid.dirtyEnd   = end;
+    }
 }
 
 void IndexRangeCache::clear()
 {
-    mIndexRangeCache.clear();
-}
+    mScannedRanges.clear();
+    mMaxScannedRangeBytes = 0;
 
-IndexRangeCache::IndexRangeKey::IndexRangeKey()
-    : IndexRangeCache::IndexRangeKey(GL_NONE, 0, 0, false)
-{
+    for (Pyramid &pyramid : mPyramids)
+    {
+        pyramid.dirtyBegin = 0;
+        pyramid.dirtyEnd   = pyramid.levels.empty() ? 0 : pyramid.levels[0].size();
+    }
 }
 
-IndexRangeCache::IndexRangeKey::IndexRangeKey(GLenum type_,
-                                              size_t offset_,
-                                              size_t count_,
-                                              bool primitiveRestartEnabled_)
-    : type(type_), offset(offset_), count(count_), primitiveRestartEnabled(primitiveRestartEnabled_)
+Error IndexRangeCache::scanRange(const Context *context,
+                                 rx::BufferImpl *bufferImpl,
+                                 GLenum type,
+                                 size_t offset,
+                                 size_t count,
+                                 bool primitiveRestartEnabled,
+                                 IndexRange *outRange)
 {
+    IndexRangeKey key(offset, type, count, primitiveRestartEnabled);
+    auto scannedRange = mScannedRanges.find(key);
+    if (scannedRange != mScannedRanges.end())
+    {
+        *outRange = scannedRange->second;
+        return NoError();
+    }
+
+    ANGLE_TRY(bufferImpl->getIndexRange(context, type, offset, count, primitiveRestartEnabled,
+                                        outRange));
+
+    // Apps that draw many different short ranges would grow the map without bound, so it starts
+    // over once it is full.
+    if (mScannedRanges.size() >= kMaxScannedRanges)
+    {
+        mScannedRanges.clear();
+        mMaxScannedRangeBytes = 0;
+    }
+    mScannedRanges[key]   = *outRange;
+    mMaxScannedRangeBytes = std::max(mMaxScannedRangeBytes, ElementTypeSize(type) * count);
+    return NoError();
 }
 
-bool IndexRangeCache::IndexRangeKey::operator<(const IndexRangeKey &rhs) const
+Error IndexRangeCache::updatePyramid(const Context *context,
+                                     rx::BufferImpl *bufferImpl,
+                                     GLenum type,
+                                     size_t bufferSize,
+                                     Pyramid *pyramid)
 {
-    if (type != rhs.type)
+    size_t indexBytes = ElementTypeSize(type);
+    size_t blockCount = bufferSize / (kIndicesPerBlock * indexBytes);
+
+    if (pyramid->levels.empty() || pyramid->levels[0].size() != blockCount)
     {
-        return type < rhs.type;
+        pyramid->levels.clear();
+        for (size_t levelSize = blockCount;; levelSize = (levelSize + 1) / 2)
+        {
+            pyramid->levels.emplace_back(levelSize);
+            if (levelSize <= 1)
+            {
+                break;
+            }
+        }
+        pyramid->dirtyBegin = 0;
+        pyramid->dirtyEnd   = blockCount;
     }
-    if (offset != rhs.offset)
+
+    size_t begin = pyramid->dirtyBegin;
+    size_t end   = pyramid->dirtyEnd;
+    if (begin >= end)
     {
-        return offset < rhs.offset;
+        return NoError();
     }
-    if (count != rhs.count)
+
+    mBlockRanges.resize(end - begin);
+    ANGLE_TRY(bufferImpl->getIndexBlockRanges(context, type, begin * kIndicesPerBlock * indexBytes,
+                                              (end - begin) * kIndicesPerBlock, kIndicesPerBlock,
+                                              mBlockRanges.data()));
+
+    std::vector<BlockRange> &blocks = pyramid->levels[0];
+    for (size_t block = begin; block < end; ++block)
     {
-        return count < rhs.count;
+        const IndexRange &blockRange = mBlockRanges[block - begin];
+        blocks[block] = {static_cast<GLuint>(blockRange.start), static_cast<GLuint>(blockRange.end),
+                         blockRange.vertexIndexCount};
     }
-    if (primitiveRestartEnabled != rhs.primitiveRestartEnabled)
+
+    for (size_t level = 1; level < pyramid->levels.size(); ++level)
     {
-        return primitiveRestartEnabled;
+        const std::vector<BlockRange> &children = pyramid->levels[level - 1];
+        std::vector<BlockRange> &parents        = pyramid->levels[level];
+
+        begin /= 2;
+        end = (end + 1) / 2;
+        for (size_t parent = begin; parent < end; ++parent)
+        {
+            parents[parent] = children[parent * 2];
+            if (parent * 2 + 1 < children.size())
+            {
+                parents[parent].merge(children[parent * 2 + 1]);
+            }
+        }
+    }
+
+    pyramid->dirtyBegin = 0;
+    pyramid->dirtyEnd   = 0;
+    return NoError();
+}
+
+void IndexRangeCache::BlockRange::merge(const BlockRange &other)
+{
+    if (other.vertexIndexCount == 0)
+    {
+        return;
+    }
+    if (vertexIndexCount == 0)
+    {
+        *this = other;
+        return;
     }
-    return false;
+
+    start = std::min(start, other.start);
+    end   = std::max(end, other.end);
+    vertexIndexCount += other.vertexIndexCount;
 }
 
+IndexRangeCache::IndexRangeKey::IndexRangeKey(size_t offset_,
+                                              GLenum type_,
+                                              size_t count_,
+                                              bool primitiveRestartEnabled_)
+    : offset(offset_), type(type_), count(count_), primitiveRestartEnabled(primitiveRestartEnabled_)
+{
 }
+
+bool IndexRangeCache::IndexRangeKey::operator<(const IndexRangeKey &rhs) const
+{
+    return std::tie(offset, type, count, primitiveRestartEnabled) <
+           std::tie(rhs.offset, rhs.type, rhs.count, rhs.primitiveRestartEnabled);
+}
+
+}  // namespace gl
@@ -12,52 +12,111 @@
 
 #include "common/angleutils.h"
 #include "common/mathutil.h"
+#include "libANGLE/Error.h"
 
 #include "angle_gl.h"
 
 #include <map>
+#include <vector>
+
+namespace rx
+{
+class BufferImpl;
+}
 
 namespace gl
 {
+class Context;
 
-class IndexRangeCache
+// Keeps, for each index type, the range of every block of kIndicesPerBlock indices in the buffer
+// and of every run of 2, 4, 8... blocks, so that the range of a long draw is made of O(log n)
+// cached ranges plus the indices before its first and after its last whole block. The pyramids
+// are built on the first draw with each index type, and only the blocks that were written to are
+// read again afterwards. The draws that are too short or misaligned for the pyramids, and the
+// partial blocks at the ends of the others, are scanned once and then cached by their exact
+// offset, type and count. At most kMaxScannedRanges of them are kept.
+class IndexRangeCache final : angle::NonCopyable
 {
   public:
+    static constexpr size_t kIndicesPerBlock  = 128;
+    static constexpr size_t kMaxScannedRanges = 1024;
+
     IndexRangeCache();
     ~IndexRangeCache();
 
-    void addRange(GLenum type,
-                  size_t offset,
-                  size_t count,
-                  bool primitiveRestartEnabled,
-                  const IndexRange &range);
-    bool findRange(GLenum type,
+    // |bufferSize| is the size of the buffer that |bufferImpl| implements.
+    Error getRange(const Context *context,
+                   rx::BufferImpl *bufferImpl,
+                   GLenum type,
                    size_t offset,
                    size_t count,
                    bool primitiveRestartEnabled,
-                   IndexRange *outRange) const;
+                   size_t bufferSize,
+                   IndexRange *outRange);
 
     void invalidateRange(size_t offset, size_t size);
     void clear();
 
   private:
+    // The range of the indices that aren't primitive restart indices, which are counted in
+    // vertexIndexCount.
+    struct BlockRange
+    {
+        void merge(const BlockRange &other);
+
+        GLuint start;
+        GLuint end;
+        size_t vertexIndexCount;
+    };
+
+    struct Pyramid
+    {
+        // levels[0] has a range per block, and each range in levels[n + 1] covers two ranges of
+        // levels[n], except for the last one if levels[n] has an odd size.
+        std::vector<std::vector<BlockRange>> levels;
+
+        // The blocks in [dirtyBegin, dirtyEnd) need to be read again.
+        size_t dirtyBegin = 0;
+        size_t dirtyEnd   = 0;
+    };
+
+    // Ordered by offset first, so that the ranges a write overlaps are found by their offset.
     struct IndexRangeKey
     {
-        IndexRangeKey();
-        IndexRangeKey(GLenum type, size_t offset, size_t count, bool primitiveRestart);
+        IndexRangeKey(size_t offset, GLenum type, size_t count, bool primitiveRestartEnabled);
 
         bool operator<(const IndexRangeKey &rhs) const;
 
-        GLenum type;
         size_t offset;
+        GLenum type;
         size_t count;
         bool primitiveRestartEnabled;
     };
 
-    typedef std::map<IndexRangeKey, IndexRange> IndexRangeMap;
-    IndexRangeMap mIndexRangeCache;
+    Error scanRange(const Context *context,
+                    rx::BufferImpl *bufferImpl,
+                    GLenum type,
+                    size_t offset,
+                    size_t count,
+                    bool primitiveRestartEnabled,
+                    IndexRange *outRange);
+
+    Error updatePyramid(const Context *context,
+                        rx::BufferImpl *bufferImpl,
+                        GLenum type,
+                        size_t bufferSize,
+                        Pyramid *pyramid);
+
+    // Indexed by ElementTypeSize / 2: GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT and GL_UNSIGNED_INT.
+    Pyramid mPyramids[3];
+    std::vector<IndexRange> mBlockRanges;
+
+    std::map<IndexRangeKey, IndexRange> mScannedRanges;
+    // The largest size in bytes of the indices of a range in mScannedRanges. A write can only
+    // overlap ranges that start less than this before it.
+    size_t mMaxScannedRangeBytes;
 };
 
-}
+}  // namespace gl
 
 #endif // LIBANGLE_INDEXRANGECACHE_H_
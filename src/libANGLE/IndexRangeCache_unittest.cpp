@@ -0,0 +1,294 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// IndexRangeCache_unittest.cpp: Unit tests for the index range pyramids of buffers.
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "common/utilities.h"
+#include "libANGLE/Buffer.h"
+#include "libANGLE/IndexRangeCache.h"
+#include "libANGLE/renderer/BufferImpl.h"
+
+namespace
+{
+
+// Keeps the data in memory and counts the indices that are read.
+class FakeBufferImpl : public rx::BufferImpl
+{
+  public:
+    FakeBufferImpl(const std::vector<uint8_t> &data) : BufferImpl(mState), mData(data) {}
+
+    gl::Error setData(const gl::Context *context,
+                      gl::BufferBinding target,
+                      const void *data,
+                      size_t size,
+                      gl::BufferUsage usage) override
+    {
+        return gl::NoError();
+    }
+    gl::Error setSubData(const gl::Context *context,
+                         gl::BufferBinding target,
+                         const void *data,
+                         size_t size,
+                         size_t offset) override
+    {
+        return gl::NoError();
+    }
+    gl::Error copySubData(const gl::Context *context,
+                          BufferImpl *source,
+                          GLintptr sourceOffset,
+                          GLintptr destOffset,
+                          GLsizeiptr size) override
+    {
+        return gl::NoError();
+    }
+    gl::Error map(const gl::Context *context, GLenum access, void **mapPtr) override
+    {
+        return gl::NoError();
+    }
+    gl::Error mapRange(const gl::Context *context,
+                       size_t offset,
+                       size_t length,
+                       GLbitfield access,
+                       void **mapPtr) override
+    {
+        return gl::NoError();
+    }
+    gl::Error unmap(const gl::Context *context, GLboolean *result) override
+    {
+        return gl::NoError();
+    }
+
+    gl::Error getIndexRange(const gl::Context *context,
+                            GLenum type,
+                            size_t offset,
+                            size_t count,
+                            bool primitiveRestartEnabled,
+                            gl::IndexRange *outRange) override
+    {
+        mIndicesRead += count;
+        *outRange = gl::ComputeIndexRange(type, mData.data() + offset, count,
+                                          primitiveRestartEnabled);
+        return gl::NoError();
+    }
+    gl::Error getIndexBlockRanges(const gl::Context *context,
+                                  GLenum type,
+                                  size_t offset,
+                                  size_t count,
+                                  size_t indicesPerBlock,
+                                  gl::IndexRange *outRanges) override
+    {
+        mIndicesRead += count;
+        gl::ComputeIndexBlockRanges(type, mData.data() + offset, count, indicesPerBlock,
+                                    outRanges);
+        return gl::NoError();
+    }
+
+    size_t getIndicesRead() const { return mIndicesRead; }
+
+  private:
+    gl::BufferState mState;
+    const std::vector<uint8_t> &mData;
+    size_t mIndicesRead = 0;
+};
+
+class IndexRangeCacheTest : public testing::Test
+{
+  protected:
+    static constexpr size_t kIndexCount = 10000;
+
+    IndexRangeCacheTest() : mData(kIndexCount * sizeof(GLushort)), mBufferImpl(mData), mRandom(1)
+    {
+        for (size_t index = 0; index < kIndexCount; ++index)
+        {
+            setIndex(index, randomIndex());
+        }
+    }
+
+    void setIndex(size_t index, GLushort value)
+    {
+        memcpy(mData.data() + index * sizeof(GLushort), &value, sizeof(GLushort));
+    }
+
+    // Some of the indices are primitive restart indices.
+    GLushort randomIndex()
+    {
+        return mRandom() % 16 == 0 ? 0xFFFF : static_cast<GLushort>(mRandom() % 5000);
+    }
+
+    void checkRange(size_t first, size_t count, bool primitiveRestartEnabled)
+    {
+        gl::IndexRange range;
+        ASSERT_FALSE(mCache
+                         .getRange(nullptr, &mBufferImpl, GL_UNSIGNED_SHORT,
+                                   first * sizeof(GLushort), count, primitiveRestartEnabled,
+                                   mData.size(), &range)
+                         .isError());
+
+        gl::IndexRange expected =
+            gl::ComputeIndexRange(GL_UNSIGNED_SHORT, mData.data() + first * sizeof(GLushort),
+                                  count, primitiveRestartEnabled);
+        EXPECT_EQ(expected.start, range.start) << first << " " << count;
+        EXPECT_EQ(expected.end, range.end) << first << " " << count;
+        EXPECT_EQ(expected.vertexIndexCount, range.vertexIndexCount) << first << " " << count;
+    }
+
+    void checkRandomRanges()
+    {
+        for (int iteration = 0; iteration < 200; ++iteration)
+        {
+            size_t first = mRandom() % kIndexCount;
+            size_t count = 1 + mRandom() % (kIndexCount - first);
+            checkRange(first, count, true);
+            checkRange(first, count, false);
+        }
+    }
+
+    std::vector<uint8_t> mData;
+    FakeBufferImpl mBufferImpl;
+    gl::IndexRangeCache mCache;
+    std::mt19937 mRandom;
+};
+
+constexpr size_t IndexRangeCacheTest::kIndexCount;
+
+// Test that the ranges of arbitrary draws match a scan of their indices.
+TEST_F(IndexRangeCacheTest, MatchesScan)
+{
+    checkRange(0, kIndexCount, true);
+    checkRange(0, kIndexCount, false);
+    checkRandomRanges();
+}
+
+// Test ranges that have no indices but primitive restart indices.
+TEST_F(IndexRangeCacheTest, OnlyRestartIndices)
+{
+    for (size_t index = 1000; index < 2000; ++index)
+    {
+        setIndex(index, 0xFFFF);
+    }
+    mCache.invalidateRange(1000 * sizeof(GLushort), 1000 * sizeof(GLushort));
+
+    checkRange(1000, 1000, true);
+    checkRange(1000, 1000, false);
+    checkRange(900, 1100, true);
+    checkRange(900, 1100, false);
+}
+
+// Test that the blocks written to are read again, and only those.
+TEST_F(IndexRangeCacheTest, InvalidateRange)
+{
+    checkRange(0, kIndexCount, true);
+
+    for (int iteration = 0; iteration < 20; ++iteration)
+    {
+        size_t first = mRandom() % kIndexCount;
+        size_t count = 1 + mRandom() % std::min<size_t>(100, kIndexCount - first);
+        for (size_t index = first; index < first + count; ++index)
+        {
+            setIndex(index, randomIndex());
+        }
+        mCache.invalidateRange(first * sizeof(GLushort), count * sizeof(GLushort));
+
+        size_t indicesRead = mBufferImpl.getIndicesRead();
+        checkRange(0, kIndexCount, true);
+        EXPECT_LE(mBufferImpl.getIndicesRead() - indicesRead,
+                  count + 3 * gl::IndexRangeCache::kIndicesPerBlock);
+    }
+
+    checkRandomRanges();
+}
+
+// Test that short and misaligned draws and the partial blocks at the ends of long draws are only
+// scanned once, until the indices they cover are written to.
+TEST_F(IndexRangeCacheTest, ScannedRangesAreCached)
+{
+    checkRange(5, 50, true);
+    checkRange(5, 50, false);
+    checkRange(5, 1000, true);
+    gl::IndexRange misalignedRange;
+    ASSERT_FALSE(mCache
+                     .getRange(nullptr, &mBufferImpl, GL_UNSIGNED_SHORT, 2001, 1000, true,
+                               mData.size(), &misalignedRange)
+                     .isError());
+
+    size_t indicesRead = mBufferImpl.getIndicesRead();
+    checkRange(5, 50, true);
+    checkRange(5, 50, false);
+    checkRange(5, 1000, true);
+    checkRange(5, 1000, false);
+    ASSERT_FALSE(mCache
+                     .getRange(nullptr, &mBufferImpl, GL_UNSIGNED_SHORT, 2001, 1000, true,
+                               mData.size(), &misalignedRange)
+                     .isError());
+    EXPECT_EQ(indicesRead, mBufferImpl.getIndicesRead());
+
+    // Writing past the end of the draws keeps their ranges. Only the pyramid block that was
+    // written to is read again.
+    mCache.invalidateRange(5000 * sizeof(GLushort), 10 * sizeof(GLushort));
+    checkRange(5, 50, true);
+    checkRange(5, 1000, true);
+    EXPECT_EQ(indicesRead + gl::IndexRangeCache::kIndicesPerBlock, mBufferImpl.getIndicesRead());
+    indicesRead = mBufferImpl.getIndicesRead();
+
+    // Writing into the short draw and the head block of the long one scans them again.
+    setIndex(20, 4999);
+    mCache.invalidateRange(20 * sizeof(GLushort), sizeof(GLushort));
+    checkRange(5, 50, true);
+    checkRange(5, 50, false);
+    checkRange(5, 1000, true);
+    EXPECT_LT(indicesRead, mBufferImpl.getIndicesRead());
+}
+
+// Test that a write near the end of a long misaligned draw scans it again, and that drawing more
+// short ranges than the cache keeps still gives the right ranges.
+TEST_F(IndexRangeCacheTest, ScannedRangesAreBounded)
+{
+    const uint8_t *misalignedData = mData.data() + 2001;
+    gl::IndexRange range;
+    ASSERT_FALSE(mCache
+                     .getRange(nullptr, &mBufferImpl, GL_UNSIGNED_SHORT, 2001, 1000, false,
+                               mData.size(), &range)
+                     .isError());
+
+    mData[3999] = 0x7F;
+    mData[4000] = 0x7F;
+    mCache.invalidateRange(3999, 2);
+    ASSERT_FALSE(mCache
+                     .getRange(nullptr, &mBufferImpl, GL_UNSIGNED_SHORT, 2001, 1000, false,
+                               mData.size(), &range)
+                     .isError());
+    gl::IndexRange expected = gl::ComputeIndexRange(GL_UNSIGNED_SHORT, misalignedData, 1000, false);
+    EXPECT_EQ(expected.start, range.start);
+    EXPECT_EQ(expected.end, range.end);
+
+    for (size_t first = 0; first < gl::IndexRangeCache::kMaxScannedRanges + 100; ++first)
+    {
+        checkRange(first, 10, true);
+    }
+    for (size_t first = 0; first < 100; ++first)
+    {
+        checkRange(first, 10, true);
+    }
+}
+
+// Test that clearing the cache reads the whole buffer again.
+TEST_F(IndexRangeCacheTest, Clear)
+{
+    checkRange(0, kIndexCount, false);
+
+    for (size_t index = 0; index < kIndexCount; ++index)
+    {
+        setIndex(index, randomIndex());
+    }
+    mCache.clear();
+
+    checkRandomRanges();
+}
+
+}  // anonymous namespace
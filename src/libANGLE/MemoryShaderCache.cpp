@@ -0,0 +1,437 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MemoryShaderCache: Stores the results of shader translation in memory so that the same shader
+//   doesn't have to be translated again. Can optionally also store them in a directory on disk
+//   so that the translations persist between runs.
+
+#include "libANGLE/MemoryShaderCache.h"
+
+#include <GLSLANG/ShaderVars.h>
+#include <anglebase/sha1.h>
+
+#include "common/version.h"
+#include "libANGLE/BinaryStream.h"
+#include "libANGLE/Compiler.h"
+#include "libANGLE/Shader.h"
+#include "libANGLE/histogram_macros.h"
+
+namespace gl
+{
+
+namespace
+{
+enum CacheResult
+{
+    kCacheMiss,
+    kCacheHitMemory,
+    kCacheHitDisk,
+    kCacheResultMax,
+};
+
+void WriteShaderVariable(BinaryOutputStream *stream, const sh::ShaderVariable &var)
+{
+    stream->writeInt(var.type);
+    stream->writeInt(var.precision);
+    stream->writeString(var.name);
+    stream->writeString(var.mappedName);
+    stream->writeIntVector(var.arraySizes);
+    stream->writeInt(var.flattenedOffsetInParentArrays);
+    stream->writeInt(var.staticUse);
+    stream->writeString(var.structName);
+
+    stream->writeInt(var.fields.size());
+    for (const sh::ShaderVariable &field : var.fields)
+    {
+        WriteShaderVariable(stream, field);
+    }
+}
+
+void LoadShaderVariable(BinaryInputStream *stream, sh::ShaderVariable *var)
+{
+    var->type       = stream->readInt<GLenum>();
+    var->precision  = stream->readInt<GLenum>();
+    var->name       = stream->readString();
+    var->mappedName = stream->readString();
+    stream->readIntVector<unsigned int>(&var->arraySizes);
+    var->flattenedOffsetInParentArrays = stream->readInt<unsigned int>();
+    var->staticUse                     = stream->readBool();
+    var->structName                    = stream->readString();
+
+    size_t fieldCount = stream->readInt<size_t>();
+    for (size_t fieldIndex = 0; fieldIndex < fieldCount && !stream->error(); ++fieldIndex)
+    {
+        sh::ShaderVariable field;
+        LoadShaderVariable(stream, &field);
+        var->fields.push_back(field);
+    }
+}
+
+void WriteVariableWithLocation(BinaryOutputStream *stream, const sh::VariableWithLocation &var)
+{
+    WriteShaderVariable(stream, var);
+    stream->writeInt(var.location);
+}
+
+void LoadVariableWithLocation(BinaryInputStream *stream, sh::VariableWithLocation *var)
+{
+    LoadShaderVariable(stream, var);
+    var->location = stream->readInt<int>();
+}
+
+void WriteShaderVariable(BinaryOutputStream *stream, const sh::Uniform &var)
+{
+    WriteVariableWithLocation(stream, var);
+    stream->writeInt(var.binding);
+    stream->writeInt(var.offset);
+    stream->writeInt(var.readonly);
+    stream->writeInt(var.writeonly);
+}
+
+void LoadShaderVariable(BinaryInputStream *stream, sh::Uniform *var)
+{
+    LoadVariableWithLocation(stream, var);
+    var->binding   = stream->readInt<int>();
+    var->offset    = stream->readInt<int>();
+    var->readonly  = stream->readBool();
+    var->writeonly = stream->readBool();
+}
+
+void WriteShaderVariable(BinaryOutputStream *stream, const sh::Attribute &var)
+{
+    WriteVariableWithLocation(stream, var);
+}
+
+void LoadShaderVariable(BinaryInputStream *stream, sh::Attribute *var)
+{
+    LoadVariableWithLocation(stream, var);
+}
+
+void WriteShaderVariable(BinaryOutputStream *stream, const sh::OutputVariable &var)
+{
+    WriteVariableWithLocation(stream, var);
+}
+
+void LoadShaderVariable(BinaryInputStream *stream, sh::OutputVariable *var)
+{
+    LoadVariableWithLocation(stream, var);
+}
+
+void WriteShaderVariable(BinaryOutputStream *stream, const sh::Varying &var)
+{
+    WriteVariableWithLocation(stream, var);
+    stream->writeInt(static_cast<int>(var.interpolation));
+    stream->writeInt(var.isInvariant);
+}
+
+void LoadShaderVariable(BinaryInputStream *stream, sh::Varying *var)
+{
+    LoadVariableWithLocation(stream, var);
+    var->interpolation = stream->readInt<sh::InterpolationType>();
+    var->isInvariant   = stream->readBool();
+}
+
+void WriteShaderVariable(BinaryOutputStream *stream, const sh::InterfaceBlock &block)
+{
+    stream->writeString(block.name);
+    stream->writeString(block.mappedName);
+    stream->writeString(block.instanceName);
+    stream->writeInt(block.arraySize);
+    stream->writeInt(static_cast<int>(block.layout));
+    stream->writeInt(block.isRowMajorLayout);
+    stream->writeInt(block.binding);
+    stream->writeInt(block.staticUse);
+    stream->writeInt(static_cast<int>(block.blockType));
+
+    stream->writeInt(block.fields.size());
+    for (const sh::InterfaceBlockField &field : block.fields)
+    {
+        WriteShaderVariable(stream, field);
+        stream->writeInt(field.isRowMajorLayout);
+    }
+}
+
+void LoadShaderVariable(BinaryInputStream *stream, sh::InterfaceBlock *block)
+{
+    block->name             = stream->readString();
+    block->mappedName       = stream->readString();
+    block->instanceName     = stream->readString();
+    block->arraySize        = stream->readInt<unsigned int>();
+    block->layout           = stream->readInt<sh::BlockLayoutType>();
+    block->isRowMajorLayout = stream->readBool();
+    block->binding          = stream->readInt<int>();
+    block->staticUse        = stream->readBool();
+    block->blockType        = stream->readInt<sh::BlockType>();
+
+    size_t fieldCount = stream->readInt<size_t>();
+    for (size_t fieldIndex = 0; fieldIndex < fieldCount && !stream->error(); ++fieldIndex)
+    {
+        sh::InterfaceBlockField field;
+        LoadShaderVariable(stream, &field);
+        field.isRowMajorLayout = stream->readBool();
+        block->fields.push_back(field);
+    }
+}
+
+template <typename VarT>
+void WriteShaderVariables(BinaryOutputStream *stream, const std::vector<VarT> &variables)
+{
+    stream->writeInt(variables.size());
+    for (const VarT &var : variables)
+    {
+        WriteShaderVariable(stream, var);
+    }
+}
+
+template <typename VarT>
+void LoadShaderVariables(BinaryInputStream *stream, std::vector<VarT> *variables)
+{
+    variables->clear();
+    size_t count = stream->readInt<size_t>();
+    for (size_t index = 0; index < count && !stream->error(); ++index)
+    {
+        VarT var;
+        LoadShaderVariable(stream, &var);
+        variables->push_back(var);
+    }
+}
+
+template <typename T>
+void WriteOptional(BinaryOutputStream *stream, const Optional<T> &value)
+{
+    stream->writeInt(value.valid());
+    stream->writeInt(value.valid() ? value.value() : 0);
+}
+
+template <typename T>
+void LoadOptional(BinaryInputStream *stream, Optional<T> *value)
+{
+    bool valid   = stream->readBool();
+    T innerValue = stream->readInt<T>();
+    if (valid)
+    {
+        *value = innerValue;
+    }
+    else
+    {
+        value->reset();
+    }
+}
+
+}  // anonymous namespace
+
+MemoryShaderCache::MemoryShaderCache(size_t maxCacheSizeBytes)
+    : mShaderCache(maxCacheSizeBytes),
+      mDiskCache(".shader", "translated shader"),
+      mMemoryHitCount(0),
+      mDiskHitCount(0),
+      mMissCount(0)
+{
+}
+
+MemoryShaderCache::~MemoryShaderCache()
+{
+}
+
+// static
+void MemoryShaderCache::Serialize(const ShaderState &state, angle::MemoryBuffer *binaryOut)
+{
+    BinaryOutputStream stream;
+
+    // Translations from a different version of ANGLE are rejected when loaded from disk.
+    stream.writeBytes(reinterpret_cast<const unsigned char *>(ANGLE_COMMIT_HASH),
+                      ANGLE_COMMIT_HASH_SIZE);
+
+    stream.writeInt(state.mShaderType);
+    stream.writeInt(state.mShaderVersion);
+    stream.writeString(state.mTranslatedSource);
+    stream.writeInt(state.mTranslatedBinary.size());
+    stream.writeBytes(reinterpret_cast<const unsigned char *>(state.mTranslatedBinary.data()),
+                      state.mTranslatedBinary.size() * sizeof(uint32_t));
+
+    for (int localSize : state.mLocalSize.localSizeQualifiers)
+    {
+        stream.writeInt(localSize);
+    }
+
+    WriteShaderVariables(&stream, state.mInputVaryings);
+    WriteShaderVariables(&stream, state.mOutputVaryings);
+    WriteShaderVariables(&stream, state.mUniforms);
+    WriteShaderVariables(&stream, state.mUniformBlocks);
+    WriteShaderVariables(&stream, state.mShaderStorageBlocks);
+    WriteShaderVariables(&stream, state.mActiveAttributes);
+    WriteShaderVariables(&stream, state.mActiveOutputVariables);
+
+    stream.writeInt(state.mNumViews);
+
+    WriteOptional(&stream, state.mGeometryShaderInputPrimitiveType);
+    WriteOptional(&stream, state.mGeometryShaderOutputPrimitiveType);
+    WriteOptional(&stream, state.mGeometryShaderMaxVertices);
+    stream.writeInt(state.mGeometryShaderInvocations);
+
+    ASSERT(binaryOut);
+    binaryOut->resize(stream.length());
+    memcpy(binaryOut->data(), stream.data(), stream.length());
+}
+
+// static
+bool MemoryShaderCache::Deserialize(const uint8_t *binary, size_t length, ShaderState *state)
+{
+    BinaryInputStream stream(binary, length);
+
+    unsigned char commitString[ANGLE_COMMIT_HASH_SIZE];
+    stream.readBytes(commitString, ANGLE_COMMIT_HASH_SIZE);
+    if (stream.error() ||
+        memcmp(commitString, ANGLE_COMMIT_HASH, sizeof(unsigned char) * ANGLE_COMMIT_HASH_SIZE) !=
+            0)
+    {
+        return false;
+    }
+
+    if (stream.readInt<GLenum>() != state->mShaderType)
+    {
+        return false;
+    }
+
+    state->mShaderVersion    = stream.readInt<int>();
+    state->mTranslatedSource = stream.readString();
+
+    size_t binarySize = stream.readInt<size_t>();
+    if (stream.error() || binarySize > (length - stream.offset()) / sizeof(uint32_t))
+    {
+        return false;
+    }
+    state->mTranslatedBinary.resize(binarySize);
+    stream.readBytes(reinterpret_cast<unsigned char *>(state->mTranslatedBinary.data()),
+                     binarySize * sizeof(uint32_t));
+
+    for (int &localSize : state->mLocalSize.localSizeQualifiers)
+    {
+        localSize = stream.readInt<int>();
+    }
+
+    LoadShaderVariables(&stream, &state->mInputVaryings);
+    LoadShaderVariables(&stream, &state->mOutputVaryings);
+    LoadShaderVariables(&stream, &state->mUniforms);
+    LoadShaderVariables(&stream, &state->mUniformBlocks);
+    LoadShaderVariables(&stream, &state->mShaderStorageBlocks);
+    LoadShaderVariables(&stream, &state->mActiveAttributes);
+    LoadShaderVariables(&stream, &state->mActiveOutputVariables);
+
+    state->mNumViews = stream.readInt<int>();
+
+    LoadOptional(&stream, &state->mGeometryShaderInputPrimitiveType);
+    LoadOptional(&stream, &state->mGeometryShaderOutputPrimitiveType);
+    LoadOptional(&stream, &state->mGeometryShaderMaxVertices);
+    state->mGeometryShaderInvocations = stream.readInt<int>();
+
+    return !stream.error() && stream.endOfStream() && !state->mTranslatedSource.empty();
+}
+
+// static
+void MemoryShaderCache::ComputeHash(Compiler *compiler,
+                                    GLenum shaderType,
+                                    ShCompileOptions compileOptions,
+                                    const std::string &sourcePath,
+                                    const std::string &source,
+                                    ShaderHash *hashOut)
+{
+    std::ostringstream hashStream;
+    hashStream << ANGLE_COMMIT_HASH << ":" << shaderType << ":" << compiler->getShaderSpec() << ":"
+               << compiler->getShaderOutputType() << ":" << compileOptions << ":"
+               << compiler->getBuiltinResourcesString(shaderType) << ":" << sourcePath.length()
+               << ":" << sourcePath << ":" << source.length() << ":" << source;
+
+    const std::string &shaderKey = hashStream.str();
+    angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(shaderKey.c_str()),
+                               shaderKey.length(), hashOut->data());
+}
+
+bool MemoryShaderCache::getShader(const ShaderHash &shaderHash, ShaderState *state)
+{
+    const angle::MemoryBuffer *binary = nullptr;
+    if (mShaderCache.get(shaderHash, &binary))
+    {
+        if (Deserialize(binary->data(), binary->size(), state))
+        {
+            ANGLE_HISTOGRAM_ENUMERATION("GPU.ANGLE.ShaderCache.CacheResult", kCacheHitMemory,
+                                        kCacheResultMax);
+            mMemoryHitCount++;
+            return true;
+        }
+
+        // Cache load failed, evict.
+        mShaderCache.eraseByKey(shaderHash);
+    }
+
+    angle::MemoryBuffer diskBinary;
+    if (mDiskCache.load(shaderHash, &diskBinary))
+    {
+        if (Deserialize(diskBinary.data(), diskBinary.size(), state))
+        {
+            ANGLE_HISTOGRAM_ENUMERATION("GPU.ANGLE.ShaderCache.CacheResult", kCacheHitDisk,
+                                        kCacheResultMax);
+            mDiskHitCount++;
+
+            size_t binarySize = diskBinary.size();
+            mShaderCache.put(shaderHash, std::move(diskBinary), binarySize);
+            return true;
+        }
+
+        mDiskCache.reportCorruptEntry(shaderHash);
+    }
+
+    ANGLE_HISTOGRAM_ENUMERATION("GPU.ANGLE.ShaderCache.CacheResult", kCacheMiss, kCacheResultMax);
+    mMissCount++;
+    return false;
+}
+
+void MemoryShaderCache::putShader(const ShaderHash &shaderHash, const ShaderState &state)
+{
+    angle::MemoryBuffer binary;
+    Serialize(state, &binary);
+
+    ANGLE_HISTOGRAM_COUNTS("GPU.ANGLE.ShaderCache.ShaderBinarySizeBytes",
+                           static_cast<int>(binary.size()));
+
+    mDiskCache.store(shaderHash, binary);
+
+    size_t binarySize = binary.size();
+    if (!mShaderCache.put(shaderHash, std::move(binary), binarySize))
+    {
+        ERR() << "Failed to store translated shader in memory cache, shader is too large.";
+    }
+}
+
+void MemoryShaderCache::setDiskCacheDirectory(const std::string &directory)
+{
+    mDiskCache.setDirectory(directory);
+}
+
+void MemoryShaderCache::clear()
+{
+    mShaderCache.clear();
+    mMemoryHitCount = 0;
+    mDiskHitCount   = 0;
+    mMissCount      = 0;
+    mDiskCache.resetWarnings();
+}
+
+size_t MemoryShaderCache::entryCount() const
+{
+    return mShaderCache.entryCount();
+}
+
+size_t MemoryShaderCache::size() const
+{
+    return mShaderCache.size();
+}
+
+size_t MemoryShaderCache::maxSize() const
+{
+    return mShaderCache.maxSize();
+}
+
+}  // namespace gl
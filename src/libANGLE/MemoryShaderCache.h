@@ -0,0 +1,90 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MemoryShaderCache: Stores the results of shader translation in memory so that the same shader
+//   doesn't have to be translated again. Can optionally also store them in a directory on disk
+//   so that the translations persist between runs.
+
+#ifndef LIBANGLE_MEMORY_SHADER_CACHE_H_
+#define LIBANGLE_MEMORY_SHADER_CACHE_H_
+
+#include <GLSLANG/ShaderLang.h>
+
+#include "common/MemoryBuffer.h"
+#include "libANGLE/DiskCache.h"
+#include "libANGLE/MemoryProgramCache.h"
+#include "libANGLE/SizedMRUCache.h"
+
+namespace gl
+{
+// Shader translations use the same kind of SHA-1 hash key as the program cache.
+using ShaderHash = ProgramHash;
+
+class Compiler;
+class ShaderState;
+
+class MemoryShaderCache final : angle::NonCopyable
+{
+  public:
+    MemoryShaderCache(size_t maxCacheSizeBytes);
+    ~MemoryShaderCache();
+
+    // Writes the translation results of a shader to the output memory buffer.
+    static void Serialize(const ShaderState &state, angle::MemoryBuffer *binaryOut);
+
+    // Loads the translation results from the specified binary blob. Returns false if the blob is
+    // invalid or was written by a different version of ANGLE.
+    static bool Deserialize(const uint8_t *binary, size_t length, ShaderState *state);
+
+    // The hash covers everything that affects the translation: the source, the compile options and
+    // the translator configuration.
+    static void ComputeHash(Compiler *compiler,
+                            GLenum shaderType,
+                            ShCompileOptions compileOptions,
+                            const std::string &sourcePath,
+                            const std::string &source,
+                            ShaderHash *hashOut);
+
+    // Check the memory cache and then the disk cache for a translation matching the hash, and load
+    // it into the shader state if found. Translations loaded from disk are added to the memory
+    // cache.
+    bool getShader(const ShaderHash &shaderHash, ShaderState *state);
+
+    // Serializes the translation results of a shader into the memory cache, and into the disk
+    // cache if it's enabled.
+    void putShader(const ShaderHash &shaderHash, const ShaderState &state);
+
+    // Enables storing translations on disk in the given directory. An empty path disables it.
+    void setDiskCacheDirectory(const std::string &directory);
+
+    // Counters for measuring the effectiveness of the cache.
+    size_t getMemoryHitCount() const { return mMemoryHitCount; }
+    size_t getDiskHitCount() const { return mDiskHitCount; }
+    size_t getMissCount() const { return mMissCount; }
+
+    // Empty the memory cache and reset the counters. Doesn't touch the disk cache.
+    void clear();
+
+    // Returns the number of entries in the memory cache.
+    size_t entryCount() const;
+
+    // Returns the current memory cache size in bytes.
+    size_t size() const;
+
+    // Returns the maximum memory cache size in bytes.
+    size_t maxSize() const;
+
+  private:
+    angle::SizedMRUCache<ShaderHash, angle::MemoryBuffer> mShaderCache;
+    DiskCache mDiskCache;
+
+    size_t mMemoryHitCount;
+    size_t mDiskHitCount;
+    size_t mMissCount;
+};
+
+}  // namespace gl
+
+#endif  // LIBANGLE_MEMORY_SHADER_CACHE_H_
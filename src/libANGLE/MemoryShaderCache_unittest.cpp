@@ -0,0 +1,292 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MemoryShaderCache_unittest.cpp: Unit tests for the memory and disk caches of translated shaders.
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <random>
+
+#include "libANGLE/MemoryShaderCache.h"
+#include "libANGLE/Shader.h"
+
+namespace gl
+{
+
+class MemoryShaderCacheTest : public testing::Test
+{
+  protected:
+    // Fills in a translation with a bit of everything the cache stores.
+    static void FillState(ShaderState *state, const std::string &translatedSource)
+    {
+        state->mShaderVersion    = 300;
+        state->mTranslatedSource = translatedSource;
+        state->mTranslatedBinary = {0x07230203u, 0x00010000u, 42u};
+
+        sh::ShaderVariable field;
+        field.type       = GL_FLOAT_VEC3;
+        field.precision  = GL_HIGH_FLOAT;
+        field.name       = "position";
+        field.mappedName = "_uposition";
+        field.arraySizes = {2u};
+
+        sh::Uniform uniform;
+        uniform.type       = GL_FLOAT_MAT4;
+        uniform.name       = "transforms";
+        uniform.mappedName = "_utransforms";
+        uniform.arraySizes = {4u};
+        uniform.staticUse  = true;
+        uniform.location   = 3;
+        uniform.binding    = 1;
+        uniform.fields.push_back(field);
+        state->mUniforms.push_back(uniform);
+
+        sh::Varying varying;
+        varying.type          = GL_FLOAT_VEC4;
+        varying.name          = "color";
+        varying.mappedName    = "_ucolor";
+        varying.interpolation = sh::INTERPOLATION_FLAT;
+        varying.isInvariant   = true;
+        state->mOutputVaryings.push_back(varying);
+
+        sh::InterfaceBlock block;
+        block.name         = "Lights";
+        block.mappedName   = "_uLights";
+        block.instanceName = "lights";
+        block.arraySize    = 2u;
+        block.layout       = sh::BLOCKLAYOUT_STD140;
+        block.binding      = 5;
+        block.staticUse    = true;
+        sh::InterfaceBlockField blockField;
+        blockField.type             = GL_FLOAT_VEC4;
+        blockField.name             = "direction";
+        blockField.isRowMajorLayout = true;
+        block.fields.push_back(blockField);
+        state->mUniformBlocks.push_back(block);
+
+        sh::Attribute attribute;
+        attribute.type     = GL_FLOAT_VEC4;
+        attribute.name     = "vertex";
+        attribute.location = 2;
+        state->mActiveAttributes.push_back(attribute);
+
+        state->mNumViews                         = 2;
+        state->mGeometryShaderInputPrimitiveType = static_cast<GLenum>(GL_TRIANGLES);
+        state->mGeometryShaderMaxVertices        = 16;
+        state->mGeometryShaderInvocations        = 3;
+    }
+
+    static void ExpectSameState(const ShaderState &expected, const ShaderState &actual)
+    {
+        EXPECT_EQ(expected.mShaderVersion, actual.mShaderVersion);
+        EXPECT_EQ(expected.mTranslatedSource, actual.mTranslatedSource);
+        EXPECT_EQ(expected.mTranslatedBinary, actual.mTranslatedBinary);
+
+        ASSERT_EQ(expected.mUniforms.size(), actual.mUniforms.size());
+        EXPECT_TRUE(expected.mUniforms[0].isSameUniformAtLinkTime(actual.mUniforms[0]));
+        EXPECT_EQ(expected.mUniforms[0].mappedName, actual.mUniforms[0].mappedName);
+        EXPECT_EQ(expected.mUniforms[0].staticUse, actual.mUniforms[0].staticUse);
+
+        ASSERT_EQ(expected.mOutputVaryings.size(), actual.mOutputVaryings.size());
+        EXPECT_EQ(expected.mOutputVaryings[0], actual.mOutputVaryings[0]);
+
+        ASSERT_EQ(expected.mUniformBlocks.size(), actual.mUniformBlocks.size());
+        EXPECT_TRUE(
+            expected.mUniformBlocks[0].isSameInterfaceBlockAtLinkTime(actual.mUniformBlocks[0]));
+        EXPECT_EQ(expected.mUniformBlocks[0].instanceName, actual.mUniformBlocks[0].instanceName);
+
+        ASSERT_EQ(expected.mActiveAttributes.size(), actual.mActiveAttributes.size());
+        EXPECT_EQ(expected.mActiveAttributes[0], actual.mActiveAttributes[0]);
+
+        EXPECT_TRUE(actual.mInputVaryings.empty());
+        EXPECT_TRUE(actual.mShaderStorageBlocks.empty());
+        EXPECT_TRUE(actual.mActiveOutputVariables.empty());
+
+        EXPECT_EQ(expected.mNumViews, actual.mNumViews);
+        EXPECT_EQ(expected.mGeometryShaderInputPrimitiveType,
+                  actual.mGeometryShaderInputPrimitiveType);
+        EXPECT_FALSE(actual.mGeometryShaderOutputPrimitiveType.valid());
+        EXPECT_EQ(expected.mGeometryShaderMaxVertices, actual.mGeometryShaderMaxVertices);
+        EXPECT_EQ(expected.mGeometryShaderInvocations, actual.mGeometryShaderInvocations);
+    }
+
+    // Each test run uses hashes of its own, so that the disk cache doesn't see entries of earlier
+    // runs.
+    static ShaderHash MakeHash(uint8_t index)
+    {
+        static std::mt19937 generator(std::random_device{}());
+        ShaderHash hash;
+        for (uint8_t &byte : hash)
+        {
+            byte = static_cast<uint8_t>(generator());
+        }
+        hash[0] = index;
+        return hash;
+    }
+
+    static std::string DiskCachePath(const std::string &directory, const ShaderHash &hash)
+    {
+        std::string path = directory + "/";
+        for (uint8_t byte : hash)
+        {
+            const char *digits = "0123456789abcdef";
+            path += digits[byte >> 4];
+            path += digits[byte & 0xF];
+        }
+        return path + ".shader";
+    }
+};
+
+// Test that a translation comes back the same after serializing it.
+TEST_F(MemoryShaderCacheTest, SerializeRoundTrip)
+{
+    ShaderState state(GL_VERTEX_SHADER);
+    FillState(&state, "void main() {}");
+
+    angle::MemoryBuffer binary;
+    MemoryShaderCache::Serialize(state, &binary);
+
+    ShaderState loaded(GL_VERTEX_SHADER);
+    ASSERT_TRUE(MemoryShaderCache::Deserialize(binary.data(), binary.size(), &loaded));
+    ExpectSameState(state, loaded);
+}
+
+// Test that translations of another shader type and truncated blobs are rejected.
+TEST_F(MemoryShaderCacheTest, DeserializeRejectsMismatches)
+{
+    ShaderState state(GL_VERTEX_SHADER);
+    FillState(&state, "void main() {}");
+
+    angle::MemoryBuffer binary;
+    MemoryShaderCache::Serialize(state, &binary);
+
+    ShaderState fragmentState(GL_FRAGMENT_SHADER);
+    EXPECT_FALSE(MemoryShaderCache::Deserialize(binary.data(), binary.size(), &fragmentState));
+
+    for (size_t length : {size_t(0), size_t(4), binary.size() / 2, binary.size() - 1})
+    {
+        ShaderState truncatedState(GL_VERTEX_SHADER);
+        EXPECT_FALSE(MemoryShaderCache::Deserialize(binary.data(), length, &truncatedState))
+            << "length " << length;
+    }
+}
+
+// Test that the counters track memory hits and misses, and that clear() resets them.
+TEST_F(MemoryShaderCacheTest, HitAndMissCounters)
+{
+    MemoryShaderCache cache(1024 * 1024);
+    ShaderHash hash = MakeHash(0);
+
+    ShaderState state(GL_FRAGMENT_SHADER);
+    FillState(&state, "void main() { gl_FragColor = vec4(1); }");
+
+    ShaderState loaded(GL_FRAGMENT_SHADER);
+    EXPECT_FALSE(cache.getShader(hash, &loaded));
+    EXPECT_EQ(1u, cache.getMissCount());
+
+    cache.putShader(hash, state);
+    EXPECT_EQ(1u, cache.entryCount());
+
+    EXPECT_TRUE(cache.getShader(hash, &loaded));
+    EXPECT_TRUE(cache.getShader(hash, &loaded));
+    ExpectSameState(state, loaded);
+    EXPECT_EQ(2u, cache.getMemoryHitCount());
+    EXPECT_EQ(0u, cache.getDiskHitCount());
+    EXPECT_EQ(1u, cache.getMissCount());
+
+    cache.clear();
+    EXPECT_EQ(0u, cache.entryCount());
+    EXPECT_EQ(0u, cache.getMemoryHitCount());
+    EXPECT_EQ(0u, cache.getMissCount());
+    EXPECT_FALSE(cache.getShader(hash, &loaded));
+}
+
+// Test that the least recently used translations are evicted when the cache is full.
+TEST_F(MemoryShaderCacheTest, Eviction)
+{
+    ShaderState state(GL_VERTEX_SHADER);
+    FillState(&state, std::string(1000, 'a'));
+    angle::MemoryBuffer binary;
+    MemoryShaderCache::Serialize(state, &binary);
+
+    // Room for two entries.
+    MemoryShaderCache cache(binary.size() * 2 + binary.size() / 2);
+    ShaderHash first  = MakeHash(0);
+    ShaderHash second = MakeHash(1);
+    ShaderHash third  = MakeHash(2);
+
+    cache.putShader(first, state);
+    cache.putShader(second, state);
+    EXPECT_EQ(2u, cache.entryCount());
+
+    // Using the first entry makes the second one the least recently used.
+    ShaderState loaded(GL_VERTEX_SHADER);
+    EXPECT_TRUE(cache.getShader(first, &loaded));
+
+    cache.putShader(third, state);
+    EXPECT_EQ(2u, cache.entryCount());
+    EXPECT_LE(cache.size(), cache.maxSize());
+
+    EXPECT_TRUE(cache.getShader(first, &loaded));
+    EXPECT_FALSE(cache.getShader(second, &loaded));
+    EXPECT_TRUE(cache.getShader(third, &loaded));
+}
+
+// Test that translations stored on disk are found after the memory cache is emptied, and that
+// corrupt entries on disk are treated as misses.
+TEST_F(MemoryShaderCacheTest, DiskCache)
+{
+    std::string directory = testing::TempDir();
+    if (!directory.empty() && (directory.back() == '/' || directory.back() == '\\'))
+    {
+        directory.pop_back();
+    }
+
+    MemoryShaderCache cache(1024 * 1024);
+    cache.setDiskCacheDirectory(directory);
+
+    ShaderHash hash        = MakeHash(0);
+    ShaderHash corruptHash = MakeHash(1);
+    std::string path        = DiskCachePath(directory, hash);
+    std::string corruptPath = DiskCachePath(directory, corruptHash);
+
+    ShaderState state(GL_VERTEX_SHADER);
+    FillState(&state, "void main() { gl_Position = vec4(0); }");
+    cache.putShader(hash, state);
+    cache.putShader(corruptHash, state);
+    EXPECT_TRUE(std::ifstream(path).good());
+
+    // A cache that never saw the translation, as in a later run, loads it from disk and keeps it
+    // in memory afterwards.
+    MemoryShaderCache laterCache(1024 * 1024);
+    laterCache.setDiskCacheDirectory(directory);
+    ShaderState loaded(GL_VERTEX_SHADER);
+    EXPECT_TRUE(laterCache.getShader(hash, &loaded));
+    ExpectSameState(state, loaded);
+    EXPECT_EQ(1u, laterCache.getDiskHitCount());
+    EXPECT_TRUE(laterCache.getShader(hash, &loaded));
+    EXPECT_EQ(1u, laterCache.getMemoryHitCount());
+
+    // Overwrite the other entry with garbage.
+    {
+        std::ofstream corruptFile(corruptPath, std::ios::out | std::ios::binary | std::ios::trunc);
+        corruptFile << "not a translated shader";
+    }
+    ShaderState corruptLoaded(GL_VERTEX_SHADER);
+    EXPECT_FALSE(laterCache.getShader(corruptHash, &corruptLoaded));
+    EXPECT_EQ(1u, laterCache.getDiskHitCount());
+    EXPECT_EQ(1u, laterCache.getMissCount());
+
+    // Without a directory, nothing is read from disk.
+    MemoryShaderCache memoryOnlyCache(1024 * 1024);
+    EXPECT_FALSE(memoryOnlyCache.getShader(hash, &loaded));
+
+    std::remove(path.c_str());
+    std::remove(corruptPath.c_str());
+}
+
+}  // namespace gl
@@ -11,6 +11,7 @@
 
 #include <algorithm>
 
+#include "common/WorkerThread.h"
 #include "common/bitset_utils.h"
 #include "common/debug.h"
 #include "common/platform.h"
@@ -680,6 +681,9 @@ Program::~Program()
 
 void Program::onDestroy(const Context *context)
 {
+    // The results of a link that is still running are discarded.
+    takePendingLink();
+
     if (mState.mAttachedVertexShader != nullptr)
     {
         mState.mAttachedVertexShader->release(context);
@@ -725,6 +729,7 @@ const std::string &Program::getLabel() const
 
 void Program::attachShader(Shader *shader)
 {
+    resolveLink();
     switch (shader->getType())
     {
         case GL_VERTEX_SHADER:
@@ -762,6 +767,7 @@ void Program::attachShader(Shader *shader)
 
 void Program::detachShader(const Context *context, Shader *shader)
 {
+    resolveLink();
     switch (shader->getType())
     {
         case GL_VERTEX_SHADER:
@@ -805,16 +811,19 @@ int Program::getAttachedShadersCount() const
 
 void Program::bindAttributeLocation(GLuint index, const char *name)
 {
+    resolveLink();
     mAttributeBindings.bindLocation(index, name);
 }
 
 void Program::bindUniformLocation(GLuint index, const char *name)
 {
+    resolveLink();
     mUniformLocationBindings.bindLocation(index, name);
 }
 
 void Program::bindFragmentInputLocation(GLint index, const char *name)
 {
+    resolveLink();
     mFragmentInputBindings.bindLocation(index, name);
 }
 
@@ -876,6 +885,7 @@ void Program::pathFragmentInputGen(const Context *context,
                                    GLint components,
                                    const GLfloat *coeffs)
 {
+    resolveLink();
     // If the location is -1 then the command is silently ignored
     if (index == -1)
         return;
@@ -891,17 +901,58 @@ void Program::pathFragmentInputGen(const Context *context,
     mProgram->setPathFragmentInputGen(binding.name, genMode, components, coeffs);
 }
 
+// A link that runs in the background. Validating the shader interfaces and packing the varyings
+// happen on a worker thread, as does the back-end link if the back-end supports it. The rest of
+// the link is finished on the GL thread when the program is first used.
+struct Program::PendingLink final : public angle::Closure
+{
+    PendingLink(Program *programIn, const Context *contextIn)
+        : program(programIn),
+          context(contextIn),
+          startTime(0.0),
+          linkedResources(false),
+          linkedBackEnd(false),
+          backEndResult(false)
+    {
+    }
+
+    void operator()() override
+    {
+        linkedResources = program->linkResources(this);
+        if (linkedResources && program->mProgram->supportsAsyncLink())
+        {
+            backEndResult = program->mProgram->link(context, *resources, program->mInfoLog);
+            linkedBackEnd = true;
+        }
+    }
+
+    Program *program;
+    const Context *context;
+    ProgramHash programHash;
+    double startTime;
+
+    bool linkedResources;
+    std::unique_ptr<ProgramLinkedResources> resources;
+    ProgramMergedVaryings mergedVaryings;
+
+    bool linkedBackEnd;
+    LinkResult backEndResult;
+
+    angle::WaitableEvent event;
+};
+
 // The attached shaders are checked for linking errors by matching up their variables.
 // Uniform, input and output variables get collected.
 // The code gets compiled into binaries.
 Error Program::link(const gl::Context *context)
 {
-    const auto &data = context->getContextState();
+    resolveLink();
 
     auto *platform   = ANGLEPlatformCurrent();
     double startTime = platform->currentTime(platform);
 
     unlink();
+    onStateChange(context, angle::SubjectMessage::STATE_CHANGE);
 
     ProgramHash programHash;
     auto *cache = context->getMemoryProgramCache();
@@ -923,66 +974,99 @@ Error Program::link(const gl::Context *context)
     unlink();
     mInfoLog.reset();
 
-    if (!linkValidateShaders(context, mInfoLog))
+    // A program that is in use is needed by the next draw call anyway, so it isn't linked in the
+    // background. The reference count covers the bindings of every context in the share group,
+    // not only the current program of |context|.
+    bool linkInBackground = getRefCount() == 0;
+
+    mPendingLink.reset(new PendingLink(this, context));
+    mPendingLink->programHash = programHash;
+    mPendingLink->startTime   = startTime;
+
+    for (Shader *shader : getAttachedShaderList())
     {
+        if (shader)
+        {
+            // Shaders finish compiling on the GL thread, so do that before linking elsewhere.
+            shader->isCompiled(context);
+            shader->addPendingLink(this);
+        }
+    }
+
+#if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+    angle::WorkerThreadPool *workerPool = context->getWorkerThreadPool();
+    if (workerPool && linkInBackground)
+    {
+        mPendingLink->event = workerPool->postWorkerTask(mPendingLink.get());
         return NoError();
     }
+#endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+
+    (*mPendingLink)();
+    return finishLink();
+}
+
+bool Program::linkResources(PendingLink *pendingLink)
+{
+    const Context *context = pendingLink->context;
+    const auto &data       = context->getContextState();
+
+    if (!linkValidateShaders(context, mInfoLog))
+    {
+        return false;
+    }
 
     if (mState.mAttachedComputeShader)
     {
         if (!linkUniforms(context, mInfoLog, mUniformLocationBindings))
         {
-            return NoError();
+            return false;
         }
 
         if (!linkInterfaceBlocks(context, mInfoLog))
         {
-            return NoError();
+            return false;
         }
 
-        ProgramLinkedResources resources = {
+        pendingLink->resources.reset(new ProgramLinkedResources{
             {0, PackMode::ANGLE_RELAXED},
             {&mState.mUniformBlocks, &mState.mUniforms},
             {&mState.mShaderStorageBlocks, &mState.mBufferVariables},
-            {&mState.mAtomicCounterBuffers}};
-
-        InitUniformBlockLinker(context, mState, &resources.uniformBlockLinker);
-        InitShaderStorageBlockLinker(context, mState, &resources.shaderStorageBlockLinker);
+            {&mState.mAtomicCounterBuffers}});
 
-        ANGLE_TRY_RESULT(mProgram->link(context, resources, mInfoLog), mLinked);
-        if (!mLinked)
-        {
-            return NoError();
-        }
+        InitUniformBlockLinker(context, mState, &pendingLink->resources->uniformBlockLinker);
+        InitShaderStorageBlockLinker(context, mState,
+                                     &pendingLink->resources->shaderStorageBlockLinker);
     }
     else
     {
         if (!linkAttributes(context, mInfoLog))
         {
-            return NoError();
+            return false;
         }
 
         if (!linkVaryings(context, mInfoLog))
         {
-            return NoError();
+            return false;
         }
 
         if (!linkUniforms(context, mInfoLog, mUniformLocationBindings))
         {
-            return NoError();
+            return false;
         }
 
         if (!linkInterfaceBlocks(context, mInfoLog))
         {
-            return NoError();
+            return false;
         }
 
         if (!linkValidateGlobalNames(context, mInfoLog))
         {
-            return NoError();
+            return false;
         }
 
-        const auto &mergedVaryings = getMergedVaryings(context);
+        pendingLink->mergedVaryings = getMergedVaryings(context);
+        const auto &mergedVaryings  = pendingLink->mergedVaryings;
 
         ASSERT(mState.mAttachedVertexShader);
         mState.mNumViews = mState.mAttachedVertexShader->getNumViews(context);
@@ -1002,33 +1086,97 @@ Error Program::link(const gl::Context *context)
             packMode = PackMode::WEBGL_STRICT;
         }
 
-        ProgramLinkedResources resources = {
+        pendingLink->resources.reset(new ProgramLinkedResources{
             {data.getCaps().maxVaryingVectors, packMode},
             {&mState.mUniformBlocks, &mState.mUniforms},
             {&mState.mShaderStorageBlocks, &mState.mBufferVariables},
-            {&mState.mAtomicCounterBuffers}};
+            {&mState.mAtomicCounterBuffers}});
 
-        InitUniformBlockLinker(context, mState, &resources.uniformBlockLinker);
-        InitShaderStorageBlockLinker(context, mState, &resources.shaderStorageBlockLinker);
+        InitUniformBlockLinker(context, mState, &pendingLink->resources->uniformBlockLinker);
+        InitShaderStorageBlockLinker(context, mState,
+                                     &pendingLink->resources->shaderStorageBlockLinker);
 
         if (!linkValidateTransformFeedback(context, mInfoLog, mergedVaryings, context->getCaps()))
         {
-            return NoError();
+            return false;
         }
 
-        if (!resources.varyingPacking.collectAndPackUserVaryings(
+        if (!pendingLink->resources->varyingPacking.collectAndPackUserVaryings(
                 mInfoLog, mergedVaryings, mState.getTransformFeedbackVaryingNames()))
         {
-            return NoError();
+            return false;
         }
+    }
+
+    return true;
+}
+
+void Program::resolveLinkImpl()
+{
+    // Errors can't be returned from the first use of the program, so they only fail the link.
+    ANGLE_SWALLOW_ERR(finishLink());
+}
+
+void Program::resolveLinkStartedBy(const Context *context)
+{
+    if (mPendingLink && mPendingLink->context == context)
+    {
+        resolveLinkImpl();
+    }
+}
+
+bool Program::isLinking() const
+{
+    return mPendingLink && !mPendingLink->event.isReady();
+}
 
-        ANGLE_TRY_RESULT(mProgram->link(context, resources, mInfoLog), mLinked);
-        if (!mLinked)
+std::unique_ptr<Program::PendingLink> Program::takePendingLink()
+{
+    std::unique_ptr<PendingLink> pendingLink = std::move(mPendingLink);
+    if (pendingLink)
+    {
+        pendingLink->event.wait();
+
+        for (Shader *shader : getAttachedShaderList())
         {
-            return NoError();
+            if (shader)
+            {
+                shader->removePendingLink(this);
+            }
         }
+    }
+    return pendingLink;
+}
+
+Error Program::finishLink()
+{
+    std::unique_ptr<PendingLink> pendingLink = takePendingLink();
+    ASSERT(pendingLink);
 
-        gatherTransformFeedbackVaryings(mergedVaryings);
+    // The observers may have looked at the program while it was linking.
+    onStateChange(pendingLink->context, angle::SubjectMessage::STATE_CHANGE);
+
+    if (!pendingLink->linkedResources)
+    {
+        return NoError();
+    }
+
+    const Context *context = pendingLink->context;
+    if (!pendingLink->linkedBackEnd)
+    {
+        pendingLink->backEndResult =
+            mProgram->link(context, *pendingLink->resources, mInfoLog);
+    }
+
+    ANGLE_TRY_RESULT(pendingLink->backEndResult, mLinked);
+    if (!mLinked)
+    {
+        return NoError();
+    }
+
+    if (!mState.mAttachedComputeShader)
+    {
+        gatherTransformFeedbackVaryings(pendingLink->mergedVaryings);
     }
 
     initInterfaceBlockBindings();
@@ -1044,19 +1192,27 @@ Error Program::link(const gl::Context *context)
     mProgram->markUnusedUniformLocations(&mState.mUniformLocations, &mState.mSamplerBindings);
 
     // Save to the program cache.
+    auto *cache = context->getMemoryProgramCache();
     if (cache && (mState.mLinkedTransformFeedbackVaryings.empty() ||
                   !context->getWorkarounds().disableProgramCachingForTransformFeedback))
     {
-        cache->putProgram(programHash, context, this);
+        cache->putProgram(pendingLink->programHash, context, this);
     }
 
-    double delta = platform->currentTime(platform) - startTime;
-    int us       = static_cast<int>(delta * 1000000.0);
+    auto *platform = ANGLEPlatformCurrent();
+    double delta   = platform->currentTime(platform) - pendingLink->startTime;
+    int us         = static_cast<int>(delta * 1000000.0);
     ANGLE_HISTOGRAM_COUNTS("GPU.ANGLE.ProgramCache.ProgramCacheMissTimeUS", us);
 
     return NoError();
 }
 
+std::array<Shader *, 4> Program::getAttachedShaderList() const
+{
+    return {{mState.mAttachedVertexShader, mState.mAttachedFragmentShader,
+             mState.mAttachedComputeShader, mState.mAttachedGeometryShader}};
+}
+
 void Program::updateLinkedShaderStages()
 {
     mState.mLinkedShaderStages.reset();
@@ -1117,6 +1273,7 @@ void Program::unlink()
 
 bool Program::isLinked() const
 {
+    ASSERT(!mPendingLink);
     return mLinked;
 }
 
@@ -1125,7 +1282,9 @@ Error Program::loadBinary(const Context *context,
                           const void *binary,
                           GLsizei length)
 {
+    resolveLink();
     unlink();
+    onStateChange(context, angle::SubjectMessage::STATE_CHANGE);
 
 #if ANGLE_PROGRAM_BINARY_LOAD != ANGLE_ENABLED
     return NoError();
@@ -1210,6 +1369,7 @@ GLint Program::getBinaryLength(const Context *context) const
 
 void Program::setBinaryRetrievableHint(bool retrievable)
 {
+    resolveLink();
     // TODO(jmadill) : replace with dirty bits
     mProgram->setBinaryRetrievableHint(retrievable);
     mState.mBinaryRetrieveableHint = retrievable;
@@ -1222,6 +1382,7 @@ bool Program::getBinaryRetrievableHint() const
 
 void Program::setSeparable(bool separable)
 {
+    resolveLink();
     // TODO(yunchao) : replace with dirty bits
     if (mState.mSeparable != separable)
     {
@@ -1606,6 +1767,7 @@ GLuint Program::getUniformIndex(const std::string &name) const
 
 void Program::setUniform1fv(GLint location, GLsizei count, const GLfloat *v)
 {
+    resolveLink();
     const VariableLocation &locationInfo = mState.mUniformLocations[location];
     GLsizei clampedCount                 = clampUniformCount(locationInfo, count, 1, v);
     mProgram->setUniform1fv(location, clampedCount, v);
@@ -1613,6 +1775,7 @@ void Program::setUniform1fv(GLint location, GLsizei count, const GLfloat *v)
 
 void Program::setUniform2fv(GLint location, GLsizei count, const GLfloat *v)
 {
+    resolveLink();
     const VariableLocation &locationInfo = mState.mUniformLocations[location];
     GLsizei clampedCount                 = clampUniformCount(locationInfo, count, 2, v);
     mProgram->setUniform2fv(location, clampedCount, v);
@@ -1620,6 +1783,7 @@ void Program::setUniform2fv(GLint location, GLsizei count, const GLfloat *v)
 
 void Program::setUniform3fv(GLint location, GLsizei count, const GLfloat *v)
 {
+    resolveLink();
     const VariableLocation &locationInfo = mState.mUniformLocations[location];
     GLsizei clampedCount                 = clampUniformCount(locationInfo, count, 3, v);
     mProgram->setUniform3fv(location, clampedCount, v);
@@ -1627,6 +1791,7 @@ void Program::setUniform3fv(GLint location, GLsizei count, const GLfloat *v)
 
 void Program::setUniform4fv(GLint location, GLsizei count, const GLfloat *v)
 {
+    resolveLink();
     const VariableLocation &locationInfo = mState.mUniformLocations[location];
     GLsizei clampedCount                 = clampUniformCount(locationInfo, count, 4, v);
     mProgram->setUniform4fv(location, clampedCount, v);
@@ -1634,6 +1799,7 @@ void Program::setUniform4fv(GLint location, GLsizei count, const GLfloat *v)
 
 Program::SetUniformResult Program::setUniform1iv(GLint location, GLsizei count, const GLint *v)
 {
+    resolveLink();
     const VariableLocation &locationInfo = mState.mUniformLocations[location];
     GLsizei clampedCount                 = clampUniformCount(locationInfo, count, 1, v);
 
@@ -1650,6 +1816,7 @@ Program::SetUniformResult Program::setUniform1iv(GLint location, GLsizei count,
 
 void Program::setUniform2iv(GLint location, GLsizei count, const GLint *v)
 {
+    resolveLink();
     const VariableLocation &locationInfo = mState.mUniformLocations[location];
     GLsizei clampedCount                 = clampUniformCount(locationInfo, count, 2, v);
     mProgram->setUniform2iv(location, clampedCount, v);
@@ -1657,6 +1824,7 @@ void Program::setUniform2iv(GLint location, GLsizei count, const GLint *v)
 
 void Program::setUniform3iv(GLint location, GLsizei count, const GLint *v)
 {
+    resolveLink();
     const VariableLocation &locationInfo = mState.mUniformLocations[location];
     GLsizei clampedCount                 = clampUniformCount(locationInfo, count, 3, v);
     mProgram->setUniform3iv(location, clampedCount, v);
@@ -1664,6 +1832,7 @@ void Program::setUniform3iv(GLint location, GLsizei count, const GLint *v)
 
 void Program::setUniform4iv(GLint location, GLsizei count, const GLint *v)
 {
+    resolveLink();
     const VariableLocation &locationInfo = mState.mUniformLocations[location];
     GLsizei clampedCount                 = clampUniformCount(locationInfo, count, 4, v);
     mProgram->setUniform4iv(location, clampedCount, v);
@@ -1671,6 +1840,7 @@ void Program::setUniform4iv(GLint location, GLsizei count, const GLint *v)
 
 void Program::setUniform1uiv(GLint location, GLsizei count, const GLuint *v)
 {
+    resolveLink();
     const VariableLocation &locationInfo = mState.mUniformLocations[location];
     GLsizei clampedCount                 = clampUniformCount(locationInfo, count, 1, v);
     mProgram->setUniform1uiv(location, clampedCount, v);
@@ -1678,6 +1848,7 @@ void Program::setUniform1uiv(GLint location, GLsizei count, const GLuint *v)
 
 void Program::setUniform2uiv(GLint location, GLsizei count, const GLuint *v)
 {
+    resolveLink();
     const VariableLocation &locationInfo = mState.mUniformLocations[location];
     GLsizei clampedCount                 = clampUniformCount(locationInfo, count, 2, v);
     mProgram->setUniform2uiv(location, clampedCount, v);
@@ -1685,6 +1856,7 @@ void Program::setUniform2uiv(GLint location, GLsizei count, const GLuint *v)
 
 void Program::setUniform3uiv(GLint location, GLsizei count, const GLuint *v)
 {
+    resolveLink();
     const VariableLocation &locationInfo = mState.mUniformLocations[location];
     GLsizei clampedCount                 = clampUniformCount(locationInfo, count, 3, v);
     mProgram->setUniform3uiv(location, clampedCount, v);
@@ -1692,6 +1864,7 @@ void Program::setUniform3uiv(GLint location, GLsizei count, const GLuint *v)
 
 void Program::setUniform4uiv(GLint location, GLsizei count, const GLuint *v)
 {
+    resolveLink();
     const VariableLocation &locationInfo = mState.mUniformLocations[location];
     GLsizei clampedCount                 = clampUniformCount(locationInfo, count, 4, v);
     mProgram->setUniform4uiv(location, clampedCount, v);
@@ -1699,54 +1872,63 @@ void Program::setUniform4uiv(GLint location, GLsizei count, const GLuint *v)
 
 void Program::setUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *v)
 {
+    resolveLink();
     GLsizei clampedCount = clampMatrixUniformCount<2, 2>(location, count, transpose, v);
     mProgram->setUniformMatrix2fv(location, clampedCount, transpose, v);
 }
 
 void Program::setUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *v)
 {
+    resolveLink();
     GLsizei clampedCount = clampMatrixUniformCount<3, 3>(location, count, transpose, v);
     mProgram->setUniformMatrix3fv(location, clampedCount, transpose, v);
 }
 
 void Program::setUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *v)
 {
+    resolveLink();
     GLsizei clampedCount = clampMatrixUniformCount<4, 4>(location, count, transpose, v);
     mProgram->setUniformMatrix4fv(location, clampedCount, transpose, v);
 }
 
 void Program::setUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *v)
 {
+    resolveLink();
     GLsizei clampedCount = clampMatrixUniformCount<2, 3>(location, count, transpose, v);
     mProgram->setUniformMatrix2x3fv(location, clampedCount, transpose, v);
 }
 
 void Program::setUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *v)
 {
+    resolveLink();
     GLsizei clampedCount = clampMatrixUniformCount<2, 4>(location, count, transpose, v);
     mProgram->setUniformMatrix2x4fv(location, clampedCount, transpose, v);
 }
 
 void Program::setUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *v)
 {
+    resolveLink();
     GLsizei clampedCount = clampMatrixUniformCount<3, 2>(location, count, transpose, v);
     mProgram->setUniformMatrix3x2fv(location, clampedCount, transpose, v);
 }
 
 void Program::setUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *v)
 {
+    resolveLink();
     GLsizei clampedCount = clampMatrixUniformCount<3, 4>(location, count, transpose, v);
     mProgram->setUniformMatrix3x4fv(location, clampedCount, transpose, v);
 }
 
 void Program::setUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *v)
 {
+    resolveLink();
     GLsizei clampedCount = clampMatrixUniformCount<4, 2>(location, count, transpose, v);
     mProgram->setUniformMatrix4x2fv(location, clampedCount, transpose, v);
 }
 
 void Program::setUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *v)
 {
+    resolveLink();
     GLsizei clampedCount = clampMatrixUniformCount<4, 3>(location, count, transpose, v);
     mProgram->setUniformMatrix4x3fv(location, clampedCount, transpose, v);
 }
@@ -1814,6 +1996,7 @@ bool Program::isFlaggedForDeletion() const
 
 void Program::validate(const Caps &caps)
 {
+    resolveLink();
     mInfoLog.reset();
 
     if (mLinked)
@@ -1986,6 +2169,7 @@ const InterfaceBlock &Program::getShaderStorageBlockByIndex(GLuint index) const
 
 void Program::bindUniformBlock(GLuint uniformBlockIndex, GLuint uniformBlockBinding)
 {
+    resolveLink();
     mState.mUniformBlocks[uniformBlockIndex].binding = uniformBlockBinding;
     mState.mActiveUniformBlockBindings.set(uniformBlockIndex, uniformBlockBinding != 0);
     mProgram->setUniformBlockBinding(uniformBlockIndex, uniformBlockBinding);
@@ -2003,6 +2187,7 @@ GLuint Program::getShaderStorageBlockBinding(GLuint shaderStorageBlockIndex) con
 
 void Program::setTransformFeedbackVaryings(GLsizei count, const GLchar *const *varyings, GLenum bufferMode)
 {
+    resolveLink();
     mState.mTransformFeedbackVaryingNames.resize(count);
     for (GLsizei i = 0; i < count; i++)
     {
@@ -3280,6 +3465,7 @@ void Program::linkOutputVariables(const Context *context)
 
 void Program::setUniformValuesFromBindingQualifiers()
 {
+    resolveLink();
     for (unsigned int samplerIndex : mState.mSamplerUniformRange)
     {
         const auto &samplerUniform = mState.mUniforms[samplerIndex];
@@ -15,6 +15,7 @@
 
 #include <array>
 #include <map>
+#include <memory>
 #include <set>
 #include <sstream>
 #include <string>
@@ -29,6 +30,7 @@
 #include "libANGLE/Error.h"
 #include "libANGLE/RefCountObject.h"
 #include "libANGLE/Uniform.h"
+#include "libANGLE/signal_utils.h"
 #include "libANGLE/angletypes.h"
 
 namespace rx
@@ -461,7 +463,9 @@ struct ProgramVaryingRef
 
 using ProgramMergedVaryings = std::map<std::string, ProgramVaryingRef>;
 
-class Program final : angle::NonCopyable, public LabeledObject
+// Notifies its observers when it is linked, since the link replaces its attributes, outputs and
+// interface blocks.
+class Program final : public angle::Subject, public LabeledObject
 {
   public:
     Program(rx::GLImplFactory *factory, ShaderProgramManager *manager, GLuint handle);
@@ -497,6 +501,20 @@ class Program final : angle::NonCopyable, public LabeledObject
 
     Error link(const gl::Context *context);
     bool isLinked() const;
+    // Finishes a link that runs in the background. Every use of the program resolves the link
+    // first, so the results are only waited for when they are needed. The methods that change the
+    // program resolve it themselves, since the link reads the program state on the worker.
+    void resolveLink()
+    {
+        if (mPendingLink)
+        {
+            resolveLinkImpl();
+        }
+    }
+    // Finishes a link that runs in the background only if |context| started it.
+    void resolveLinkStartedBy(const Context *context);
+    // Returns true while a link is still running on a worker thread. Doesn't wait for it.
+    bool isLinking() const;
 
     bool hasLinkedVertexShader() const { return mState.mLinkedShaderStages[SHADER_VERTEX]; }
     bool hasLinkedFragmentShader() const { return mState.mLinkedShaderStages[SHADER_FRAGMENT]; }
@@ -695,8 +713,19 @@ class Program final : angle::NonCopyable, public LabeledObject
   private:
     ~Program() override;
 
+    struct PendingLink;
+
     void unlink();
 
+    // Runs the steps of a link that only depend on the shaders and the program state. Can be
+    // called on a worker thread.
+    bool linkResources(PendingLink *pendingLink);
+    void resolveLinkImpl();
+    Error finishLink();
+    // Waits for the link running in the background to be done and detaches it from the program.
+    std::unique_ptr<PendingLink> takePendingLink();
+    std::array<Shader *, 4> getAttachedShaderList() const;
+
     bool linkValidateShaders(const Context *context, InfoLog &infoLog);
     bool linkAttributes(const Context *context, InfoLog &infoLog);
     static bool ValidateGraphicsInterfaceBlocks(
@@ -811,6 +840,9 @@ class Program final : angle::NonCopyable, public LabeledObject
     // Cache for sampler validation
     Optional<bool> mCachedValidateSamplersResult;
     std::vector<GLenum> mTextureUnitTypesCache;
+
+    // Set between a link call and the first use of the program.
+    std::unique_ptr<PendingLink> mPendingLink;
 };
 }  // namespace gl
 
@@ -9,6 +9,7 @@
 
 #include "libANGLE/ResourceManager.h"
 
+#include "common/system_utils.h"
 #include "libANGLE/Buffer.h"
 #include "libANGLE/Fence.h"
 #include "libANGLE/Path.h"
@@ -26,8 +27,9 @@ namespace gl
 namespace
 {
 
-template <typename ResourceType>
-GLuint AllocateEmptyObject(HandleAllocator *handleAllocator, ResourceMap<ResourceType> *objectMap)
+template <typename ResourceType, typename HandleAllocatorType>
+GLuint AllocateEmptyObject(HandleAllocatorType *handleAllocator,
+                           ResourceMap<ResourceType> *objectMap)
 {
     GLuint handle = handleAllocator->allocate();
     objectMap->assign(handle, nullptr);
@@ -36,6 +38,27 @@ GLuint AllocateEmptyObject(HandleAllocator *handleAllocator, ResourceMap<Resourc
 
 }  // anonymous namespace
 
+ObjectHandleAllocator::ObjectHandleAllocator()
+    : mUseFreeList(angle::GetEnvironmentVar("ANGLE_FREE_LIST_HANDLE_ALLOCATOR") == "1")
+{
+}
+
+ObjectHandleAllocator::~ObjectHandleAllocator()
+{
+}
+
+void ObjectHandleAllocator::reset()
+{
+    mAllocator.reset();
+    mFreeListAllocator.reset();
+}
+
+void ObjectHandleAllocator::enableLogging(bool enabled)
+{
+    mAllocator.enableLogging(enabled);
+    mFreeListAllocator.enableLogging(enabled);
+}
+
 template <typename HandleAllocatorType>
 ResourceManagerBase<HandleAllocatorType>::ResourceManagerBase() : mRefCount(1)
 {
@@ -98,10 +121,11 @@ void TypedResourceManager<ResourceType, HandleAllocatorType, ImplT>::deleteObjec
 }
 
 template class ResourceManagerBase<HandleAllocator>;
+template class ResourceManagerBase<ObjectHandleAllocator>;
 template class ResourceManagerBase<HandleRangeAllocator>;
-template class TypedResourceManager<Buffer, HandleAllocator, BufferManager>;
-template class TypedResourceManager<Texture, HandleAllocator, TextureManager>;
-template class TypedResourceManager<Renderbuffer, HandleAllocator, RenderbufferManager>;
+template class TypedResourceManager<Buffer, ObjectHandleAllocator, BufferManager>;
+template class TypedResourceManager<Texture, ObjectHandleAllocator, TextureManager>;
+template class TypedResourceManager<Renderbuffer, ObjectHandleAllocator, RenderbufferManager>;
 template class TypedResourceManager<Sampler, HandleAllocator, SamplerManager>;
 template class TypedResourceManager<Sync, HandleAllocator, SyncManager>;
 template class TypedResourceManager<Framebuffer, HandleAllocator, FramebufferManager>;
@@ -197,6 +221,17 @@ Program *ShaderProgramManager::getProgram(GLuint handle) const
     return mPrograms.query(handle);
 }
 
+void ShaderProgramManager::resolvePendingLinks(const Context *context) const
+{
+    for (const auto &program : mPrograms)
+    {
+        if (program.second)
+        {
+            program.second->resolveLinkStartedBy(context);
+        }
+    }
+}
+
 template <typename ObjectType>
 void ShaderProgramManager::deleteObject(const Context *context,
                                         ResourceMap<ObjectType> *objectMap,
@@ -13,6 +13,7 @@
 #include "angle_gl.h"
 #include "common/angleutils.h"
 #include "libANGLE/Error.h"
+#include "libANGLE/FreeListHandleAllocator.h"
 #include "libANGLE/HandleAllocator.h"
 #include "libANGLE/HandleRangeAllocator.h"
 #include "libANGLE/ResourceMap.h"
@@ -38,6 +39,54 @@ class Sampler;
 class Shader;
 class Texture;
 
+// Allocates the handles of the objects that apps often create with their own IDs. It uses
+// HandleAllocator, unless ANGLE_FREE_LIST_HANDLE_ALLOCATOR=1 is set in the environment when the
+// manager is created. FreeListHandleAllocator reserves IDs in constant time, but reuses the most
+// recently released handle first instead of the smallest one.
+class ObjectHandleAllocator final : angle::NonCopyable
+{
+  public:
+    ObjectHandleAllocator();
+    ~ObjectHandleAllocator();
+
+    GLuint allocate()
+    {
+        return mUseFreeList ? mFreeListAllocator.allocate() : mAllocator.allocate();
+    }
+
+    void release(GLuint handle)
+    {
+        if (mUseFreeList)
+        {
+            mFreeListAllocator.release(handle);
+        }
+        else
+        {
+            mAllocator.release(handle);
+        }
+    }
+
+    void reserve(GLuint handle)
+    {
+        if (mUseFreeList)
+        {
+            mFreeListAllocator.reserve(handle);
+        }
+        else
+        {
+            mAllocator.reserve(handle);
+        }
+    }
+
+    void reset();
+    void enableLogging(bool enabled);
+
+  private:
+    bool mUseFreeList;
+    HandleAllocator mAllocator;
+    FreeListHandleAllocator mFreeListAllocator;
+};
+
 template <typename HandleAllocatorType>
 class ResourceManagerBase : angle::NonCopyable
 {
@@ -104,7 +153,8 @@ class TypedResourceManager : public ResourceManagerBase<HandleAllocatorType>
     ResourceMap<ResourceType> mObjectMap;
 };
 
-class BufferManager : public TypedResourceManager<Buffer, HandleAllocator, BufferManager>
+class BufferManager
+    : public TypedResourceManager<Buffer, ObjectHandleAllocator, BufferManager>
 {
   public:
     GLuint createBuffer();
@@ -138,6 +188,10 @@ class ShaderProgramManager : public ResourceManagerBase<HandleAllocator>
     void deleteProgram(const Context *context, GLuint program);
     Program *getProgram(GLuint handle) const;
 
+    // Finishes the links running in the background that |context| started, before it goes away.
+    // The links started by the other contexts that share the programs are left running.
+    void resolvePendingLinks(const Context *context) const;
+
   protected:
     ~ShaderProgramManager() override;
 
@@ -151,7 +205,8 @@ class ShaderProgramManager : public ResourceManagerBase<HandleAllocator>
     ResourceMap<Program> mPrograms;
 };
 
-class TextureManager : public TypedResourceManager<Texture, HandleAllocator, TextureManager>
+class TextureManager
+    : public TypedResourceManager<Texture, ObjectHandleAllocator, TextureManager>
 {
   public:
     GLuint createTexture();
@@ -174,7 +229,7 @@ class TextureManager : public TypedResourceManager<Texture, HandleAllocator, Tex
 };
 
 class RenderbufferManager
-    : public TypedResourceManager<Renderbuffer, HandleAllocator, RenderbufferManager>
+    : public TypedResourceManager<Renderbuffer, ObjectHandleAllocator, RenderbufferManager>
 {
   public:
     GLuint createRenderbuffer();
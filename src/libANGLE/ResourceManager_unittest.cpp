@@ -9,6 +9,10 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <map>
+#include <random>
+
+#include "common/system_utils.h"
 #include "libANGLE/ResourceManager.h"
 #include "tests/angle_unittests_utils.h"
 
@@ -70,4 +74,167 @@ TEST_F(ResourceManagerTest, ReallocateBoundRenderbuffer)
     EXPECT_NE(1u, newRenderbuffer);
 }
 
+// Test that released buffer names are reused smallest first by default, and most recently
+// released first with the free list handle allocator.
+TEST_F(ResourceManagerTest, HandleAllocatorMode)
+{
+    GLuint buffers[3];
+    for (GLuint &buffer : buffers)
+    {
+        buffer = mBufferManager->createBuffer();
+    }
+    mBufferManager->deleteObject(nullptr, buffers[0]);
+    mBufferManager->deleteObject(nullptr, buffers[1]);
+    EXPECT_EQ(buffers[0], mBufferManager->createBuffer());
+
+    ASSERT_TRUE(angle::SetEnvironmentVar("ANGLE_FREE_LIST_HANDLE_ALLOCATOR", "1"));
+    BufferManager *freeListBufferManager = new BufferManager();
+    ASSERT_TRUE(angle::SetEnvironmentVar("ANGLE_FREE_LIST_HANDLE_ALLOCATOR", ""));
+
+    for (GLuint &buffer : buffers)
+    {
+        buffer = freeListBufferManager->createBuffer();
+    }
+    freeListBufferManager->deleteObject(nullptr, buffers[0]);
+    freeListBufferManager->deleteObject(nullptr, buffers[1]);
+    EXPECT_EQ(buffers[1], freeListBufferManager->createBuffer());
+    EXPECT_EQ(buffers[0], freeListBufferManager->createBuffer());
+
+    freeListBufferManager->release(nullptr);
+}
+
+class ResourceMapTest : public testing::Test
+{
+  protected:
+    static constexpr size_t kResourceCount = 64;
+
+    ResourceMapTest() : mResources(kResourceCount) {}
+
+    void TearDown() override
+    {
+        std::vector<GLuint> handles;
+        for (const auto &resource : mMap)
+        {
+            handles.push_back(resource.first);
+        }
+        for (GLuint handle : handles)
+        {
+            int *resource = nullptr;
+            EXPECT_TRUE(mMap.erase(handle, &resource));
+        }
+        EXPECT_TRUE(mMap.empty());
+    }
+
+    // Checks the map against the expected resources, through lookups and iteration.
+    void checkResources(const std::map<GLuint, int *> &expected)
+    {
+        for (const auto &resource : expected)
+        {
+            EXPECT_TRUE(mMap.contains(resource.first));
+            EXPECT_EQ(resource.second, mMap.query(resource.first));
+        }
+
+        std::map<GLuint, int *> iterated;
+        for (const auto &resource : mMap)
+        {
+            EXPECT_TRUE(iterated.insert(resource).second) << resource.first;
+        }
+        EXPECT_EQ(expected, iterated);
+    }
+
+    std::vector<int> mResources;
+    ResourceMap<int> mMap;
+};
+
+constexpr size_t ResourceMapTest::kResourceCount;
+
+// Tests handles above the flat array, up to the largest handle.
+TEST_F(ResourceMapTest, LargeHandles)
+{
+    std::map<GLuint, int *> expected;
+    const GLuint handles[] = {1, 0x4000, 0x10000, 0x7FFFFFFF, 0x80000000, 0xFFFFFFFE, 0xFFFFFFFF};
+    for (size_t index = 0; index < ArraySize(handles); ++index)
+    {
+        EXPECT_FALSE(mMap.contains(handles[index]));
+        mMap.assign(handles[index], &mResources[index]);
+        expected[handles[index]] = &mResources[index];
+    }
+    checkResources(expected);
+
+    // Reserved handles have no resource.
+    mMap.assign(0x12345678, nullptr);
+    expected[0x12345678] = nullptr;
+    checkResources(expected);
+
+    int *resource = nullptr;
+    EXPECT_TRUE(mMap.erase(0x80000000, &resource));
+    EXPECT_EQ(expected[0x80000000], resource);
+    EXPECT_FALSE(mMap.erase(0x80000000, &resource));
+    expected.erase(0x80000000);
+    checkResources(expected);
+
+    EXPECT_TRUE(mMap.find(0xFFFFFFFF) != mMap.end());
+    EXPECT_EQ(0xFFFFFFFFu, mMap.find(0xFFFFFFFF)->first);
+    EXPECT_TRUE(mMap.find(0x80000000) == mMap.end());
+}
+
+// Tests a random sequence of assignments and erasures, like the objects of a long session.
+TEST_F(ResourceMapTest, Churn)
+{
+    std::mt19937 random(1);
+    std::map<GLuint, int *> expected;
+    GLuint nextHandle = 1;
+
+    for (int iteration = 0; iteration < 20000; ++iteration)
+    {
+        if (expected.size() < kResourceCount && random() % 2 == 0)
+        {
+            // Mostly increasing handles, with some explicit ones anywhere.
+            GLuint handle = random() % 8 == 0 ? static_cast<GLuint>(random()) : nextHandle++;
+            int *resource = &mResources[random() % kResourceCount];
+            mMap.assign(handle, resource);
+            expected[handle] = resource;
+        }
+        else if (!expected.empty())
+        {
+            auto it = expected.begin();
+            std::advance(it, random() % expected.size());
+
+            int *resource = nullptr;
+            EXPECT_TRUE(mMap.erase(it->first, &resource));
+            EXPECT_EQ(it->second, resource);
+            EXPECT_FALSE(mMap.contains(it->first));
+            expected.erase(it);
+        }
+
+        if (iteration % 1000 == 0)
+        {
+            checkResources(expected);
+        }
+    }
+
+    checkResources(expected);
+}
+
+// Tests that erasing resources while iterating over the map visits all of them.
+TEST_F(ResourceMapTest, EraseWhileIterating)
+{
+    for (GLuint index = 0; index < kResourceCount; ++index)
+    {
+        mMap.assign(index * 0x1000, &mResources[index]);
+    }
+
+    size_t erasedCount = 0;
+    for (auto it = mMap.begin(); it != mMap.end(); ++it)
+    {
+        int *resource = nullptr;
+        EXPECT_TRUE(mMap.erase(it->first, &resource));
+        EXPECT_EQ(it->second, resource);
+        erasedCount++;
+    }
+
+    EXPECT_EQ(kResourceCount, erasedCount);
+    EXPECT_TRUE(mMap.empty());
+}
+
 }  // anonymous namespace
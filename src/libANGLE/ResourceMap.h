@@ -5,7 +5,8 @@
 //
 // ResourceMap:
 //   An optimized resource map which packs the first set of allocated objects into a
-//   flat array, and then falls back to an unordered map for the higher handle values.
+//   flat array, and then falls back to an open addressing hash table for the higher handle
+//   values.
 //
 
 #ifndef LIBANGLE_RESOURCE_MAP_H_
@@ -37,7 +38,6 @@ class ResourceMap final : angle::NonCopyable
     void clear();
 
     using IndexAndResource = std::pair<GLuint, ResourceType *>;
-    using HashMap          = std::unordered_map<GLuint, ResourceType *>;
 
     class Iterator final
     {
@@ -50,14 +50,12 @@ class ResourceMap final : angle::NonCopyable
 
       private:
         friend class ResourceMap;
-        Iterator(const ResourceMap &origin,
-                 GLuint flatIndex,
-                 typename HashMap::const_iterator hashIndex);
+        Iterator(const ResourceMap &origin, GLuint flatIndex, size_t hashIndex);
         void updateValue();
 
         const ResourceMap &mOrigin;
         GLuint mFlatIndex;
-        typename HashMap::const_iterator mHashIndex;
+        size_t mHashIndex;
         IndexAndResource mValue;
     };
 
@@ -74,6 +72,21 @@ class ResourceMap final : angle::NonCopyable
 
     GLuint nextNonNullResource(size_t flatIndex) const;
 
+    // The handles above the flat array are kept in a linear probing hash table. Erased slots are
+    // only reused by later insertions, so erasing doesn't move the other resources and iterators
+    // stay valid.
+    struct HashedResource
+    {
+        GLuint handle;
+        ResourceType *resource;
+    };
+
+    size_t nextHashedResource(size_t hashIndex) const;
+    size_t findHashedResource(GLuint handle) const;
+    void insertHashedResource(GLuint handle, ResourceType *resource);
+    void rehash(size_t capacity);
+    size_t hashHandle(GLuint handle) const;
+
     // constexpr methods cannot contain reinterpret_cast, so we need a static method.
     static ResourceType *InvalidPointer();
     static constexpr intptr_t kInvalidPointer = static_cast<intptr_t>(-1);
@@ -84,15 +97,31 @@ class ResourceMap final : angle::NonCopyable
     // Experimental testing suggests that 16k is a reasonable upper limit.
     static constexpr size_t kFlatResourcesLimit = 0x4000;
 
+    // Handles below the flat resources limit are never hashed, so they mark the empty and erased
+    // slots of the hash table.
+    static constexpr GLuint kEmptyHandle  = 0;
+    static constexpr GLuint kErasedHandle = 1;
+    static_assert(kErasedHandle < kFlatResourcesLimit, "Hashed handles are never special");
+
+    static constexpr size_t kInitialHashedResourcesSize = 0x40;
+    static constexpr unsigned int kHashedRunBits        = 4;
+
     std::vector<ResourceType *> mFlatResources;
 
-    // A map of GL objects indexed by object ID.
-    HashMap mHashedResources;
+    // A table of GL objects indexed by a hash of the object ID, with a power-of-two size.
+    std::vector<HashedResource> mHashedResources;
+    size_t mHashedResourcesCount;
+    size_t mErasedHashedResourcesCount;
+    unsigned int mHashBits;
 };
 
 template <typename ResourceType>
 ResourceMap<ResourceType>::ResourceMap()
-    : mFlatResources(kInitialFlatResourcesSize, InvalidPointer()), mHashedResources()
+    : mFlatResources(kInitialFlatResourcesSize, InvalidPointer()),
+      mHashedResources(),
+      mHashedResourcesCount(0),
+      mErasedHashedResourcesCount(0),
+      mHashBits(0)
 {
 }
 
@@ -110,8 +139,8 @@ ResourceType *ResourceMap<ResourceType>::query(GLuint handle) const
         auto value = mFlatResources[handle];
         return (value == InvalidPointer() ? nullptr : value);
     }
-    auto it = mHashedResources.find(handle);
-    return (it == mHashedResources.end() ? nullptr : it->second);
+    size_t hashIndex = findHashedResource(handle);
+    return (hashIndex == mHashedResources.size() ? nullptr : mHashedResources[hashIndex].resource);
 }
 
 template <typename ResourceType>
@@ -121,7 +150,7 @@ bool ResourceMap<ResourceType>::contains(GLuint handle) const
     {
         return (mFlatResources[handle] != InvalidPointer());
     }
-    return (mHashedResources.find(handle) != mHashedResources.end());
+    return (findHashedResource(handle) != mHashedResources.size());
 }
 
 template <typename ResourceType>
@@ -139,13 +168,17 @@ bool ResourceMap<ResourceType>::erase(GLuint handle, ResourceType **resourceOut)
     }
     else
     {
-        auto it = mHashedResources.find(handle);
-        if (it == mHashedResources.end())
+        size_t hashIndex = findHashedResource(handle);
+        if (hashIndex == mHashedResources.size())
         {
             return false;
         }
-        *resourceOut = it->second;
-        mHashedResources.erase(it);
+        HashedResource &slot = mHashedResources[hashIndex];
+        *resourceOut         = slot.resource;
+        slot.handle          = kErasedHandle;
+        slot.resource        = nullptr;
+        mHashedResourcesCount--;
+        mErasedHashedResourcesCount++;
     }
     return true;
 }
@@ -170,20 +203,20 @@ void ResourceMap<ResourceType>::assign(GLuint handle, ResourceType *resource)
     }
     else
     {
-        mHashedResources[handle] = resource;
+        insertHashedResource(handle, resource);
     }
 }
 
 template <typename ResourceType>
 typename ResourceMap<ResourceType>::Iterator ResourceMap<ResourceType>::begin() const
 {
-    return Iterator(*this, nextNonNullResource(0), mHashedResources.begin());
+    return Iterator(*this, nextNonNullResource(0), nextHashedResource(0));
 }
 
 template <typename ResourceType>
 typename ResourceMap<ResourceType>::Iterator ResourceMap<ResourceType>::end() const
 {
-    return Iterator(*this, static_cast<GLuint>(mFlatResources.size()), mHashedResources.end());
+    return Iterator(*this, static_cast<GLuint>(mFlatResources.size()), mHashedResources.size());
 }
 
 template <typename ResourceType>
@@ -192,12 +225,13 @@ typename ResourceMap<ResourceType>::Iterator ResourceMap<ResourceType>::find(GLu
     if (handle < mFlatResources.size())
     {
         return (mFlatResources[handle] != InvalidPointer()
-                    ? Iterator(handle, mHashedResources.begin())
+                    ? Iterator(*this, handle, nextHashedResource(0))
                     : end());
     }
     else
     {
-        return mHashedResources.find(handle);
+        return Iterator(*this, static_cast<GLuint>(mFlatResources.size()),
+                        findHashedResource(handle));
     }
 }
 
@@ -212,6 +246,9 @@ void ResourceMap<ResourceType>::clear()
 {
     mFlatResources.assign(kInitialFlatResourcesSize, InvalidPointer());
     mHashedResources.clear();
+    mHashedResourcesCount       = 0;
+    mErasedHashedResourcesCount = 0;
+    mHashBits                   = 0;
 }
 
 template <typename ResourceType>
@@ -227,6 +264,129 @@ GLuint ResourceMap<ResourceType>::nextNonNullResource(size_t flatIndex) const
     return static_cast<GLuint>(mFlatResources.size());
 }
 
+template <typename ResourceType>
+size_t ResourceMap<ResourceType>::nextHashedResource(size_t hashIndex) const
+{
+    for (size_t index = hashIndex; index < mHashedResources.size(); index++)
+    {
+        if (mHashedResources[index].handle > kErasedHandle)
+        {
+            return index;
+        }
+    }
+    return mHashedResources.size();
+}
+
+template <typename ResourceType>
+size_t ResourceMap<ResourceType>::findHashedResource(GLuint handle) const
+{
+    if (mHashedResources.empty())
+    {
+        return 0;
+    }
+
+    size_t mask = mHashedResources.size() - 1;
+    for (size_t index = hashHandle(handle);; index = (index + 1) & mask)
+    {
+        const HashedResource &slot = mHashedResources[index];
+        if (slot.handle == handle)
+        {
+            return index;
+        }
+        if (slot.handle == kEmptyHandle)
+        {
+            return mHashedResources.size();
+        }
+    }
+}
+
+template <typename ResourceType>
+void ResourceMap<ResourceType>::insertHashedResource(GLuint handle, ResourceType *resource)
+{
+    ASSERT(handle >= kFlatResourcesLimit);
+
+    // Rehash once more than three quarters of the slots hold resources or erased markers. At least
+    // a quarter of the slots stay empty, so that the probes stay short.
+    size_t usedCount = mHashedResourcesCount + mErasedHashedResourcesCount + 1;
+    if (usedCount * 4 > mHashedResources.size() * 3)
+    {
+        // Only grow if the erased slots don't make enough room.
+        size_t capacity =
+            mHashedResources.empty() ? kInitialHashedResourcesSize : mHashedResources.size();
+        while ((mHashedResourcesCount + 1) * 2 > capacity)
+        {
+            capacity *= 2;
+        }
+        rehash(capacity);
+    }
+
+    size_t mask        = mHashedResources.size() - 1;
+    size_t erasedIndex = mHashedResources.size();
+    for (size_t index = hashHandle(handle);; index = (index + 1) & mask)
+    {
+        HashedResource &slot = mHashedResources[index];
+        if (slot.handle == handle)
+        {
+            slot.resource = resource;
+            return;
+        }
+        if (slot.handle == kErasedHandle && erasedIndex == mHashedResources.size())
+        {
+            erasedIndex = index;
+        }
+        if (slot.handle == kEmptyHandle)
+        {
+            if (erasedIndex != mHashedResources.size())
+            {
+                mErasedHashedResourcesCount--;
+                index = erasedIndex;
+            }
+            mHashedResources[index] = {handle, resource};
+            mHashedResourcesCount++;
+            return;
+        }
+    }
+}
+
+template <typename ResourceType>
+void ResourceMap<ResourceType>::rehash(size_t capacity)
+{
+    ASSERT(gl::isPow2(capacity));
+
+    std::vector<HashedResource> oldResources(capacity, HashedResource{kEmptyHandle, nullptr});
+    mHashedResources.swap(oldResources);
+    mHashBits = gl::log2(static_cast<int>(capacity));
+
+    size_t mask = capacity - 1;
+    for (const HashedResource &oldSlot : oldResources)
+    {
+        if (oldSlot.handle <= kErasedHandle)
+        {
+            continue;
+        }
+
+        size_t index = hashHandle(oldSlot.handle);
+        while (mHashedResources[index].handle != kEmptyHandle)
+        {
+            index = (index + 1) & mask;
+        }
+        mHashedResources[index] = oldSlot;
+    }
+
+    mErasedHashedResourcesCount = 0;
+}
+
+template <typename ResourceType>
+size_t ResourceMap<ResourceType>::hashHandle(GLuint handle) const
+{
+    // GL handles are mostly allocated in sequence, so runs of sequential handles are kept in
+    // neighbouring slots. The runs are spread with Fibonacci hashing, whose top bits depend on
+    // all of the bits of the handle.
+    uint64_t run = static_cast<uint64_t>(handle >> kHashedRunBits) * 0x9E3779B97F4A7C15ull;
+    size_t runIndex = static_cast<size_t>(run >> (64 - mHashBits + kHashedRunBits));
+    return (runIndex << kHashedRunBits) | (handle & ((1u << kHashedRunBits) - 1));
+}
+
 template <typename ResourceType>
 // static
 ResourceType *ResourceMap<ResourceType>::InvalidPointer()
@@ -235,10 +395,9 @@ ResourceType *ResourceMap<ResourceType>::InvalidPointer()
 }
 
 template <typename ResourceType>
-ResourceMap<ResourceType>::Iterator::Iterator(
-    const ResourceMap &origin,
-    GLuint flatIndex,
-    typename ResourceMap<ResourceType>::HashMap::const_iterator hashIndex)
+ResourceMap<ResourceType>::Iterator::Iterator(const ResourceMap &origin,
+                                              GLuint flatIndex,
+                                              size_t hashIndex)
     : mOrigin(origin), mFlatIndex(flatIndex), mHashIndex(hashIndex), mValue()
 {
     updateValue();
@@ -265,7 +424,7 @@ typename ResourceMap<ResourceType>::Iterator &ResourceMap<ResourceType>::Iterato
     }
     else
     {
-        mHashIndex++;
+        mHashIndex = mOrigin.nextHashedResource(mHashIndex + 1);
     }
     updateValue();
     return *this;
@@ -293,10 +452,10 @@ void ResourceMap<ResourceType>::Iterator::updateValue()
         mValue.first  = mFlatIndex;
         mValue.second = mOrigin.mFlatResources[mFlatIndex];
     }
-    else if (mHashIndex != mOrigin.mHashedResources.end())
+    else if (mHashIndex < mOrigin.mHashedResources.size())
     {
-        mValue.first  = mHashIndex->first;
-        mValue.second = mHashIndex->second;
+        mValue.first  = mOrigin.mHashedResources[mHashIndex].handle;
+        mValue.second = mOrigin.mHashedResources[mHashIndex].resource;
     }
 }
 
@@ -12,11 +12,14 @@
 
 #include <sstream>
 
+#include "common/WorkerThread.h"
 #include "common/utilities.h"
 #include "GLSLANG/ShaderLang.h"
 #include "libANGLE/Caps.h"
 #include "libANGLE/Compiler.h"
 #include "libANGLE/Constants.h"
+#include "libANGLE/MemoryShaderCache.h"
+#include "libANGLE/Program.h"
 #include "libANGLE/renderer/GLImplFactory.h"
 #include "libANGLE/renderer/ShaderImpl.h"
 #include "libANGLE/ResourceManager.h"
@@ -96,6 +99,37 @@ const char *GetShaderTypeString(GLenum type)
     }
 }
 
+// A translation requested by a compile call. It runs on a worker thread if the backend allows it,
+// and otherwise on the GL thread once its results are needed.
+struct Shader::PendingTranslation final : public angle::Closure
+{
+    PendingTranslation(Shader *shaderIn)
+        : shader(shaderIn),
+          loadedFromCache(false),
+          runningOnWorker(false),
+          compiler(nullptr),
+          result(false)
+    {
+    }
+
+    void operator()() override
+    {
+        GLenum shaderType       = shader->getType();
+        ShHandle compilerHandle = compiler->acquireCompilerHandle(shaderType);
+        result                  = shader->translate(compilerHandle);
+        compiler->releaseCompilerHandle(shaderType, compilerHandle);
+    }
+
+    Shader *shader;
+    ShaderHash shaderHash;
+    bool loadedFromCache;
+
+    bool runningOnWorker;
+    Compiler *compiler;
+    angle::WaitableEvent event;
+    bool result;
+};
+
 ShaderState::ShaderState(GLenum shaderType)
     : mLabel(),
       mShaderType(shaderType),
@@ -130,6 +164,9 @@ Shader::Shader(ShaderProgramManager *manager,
 
 void Shader::onDestroy(const gl::Context *context)
 {
+    waitForWorkerTranslation();
+    mPendingTranslation.reset();
+
     mBoundCompiler.set(context, nullptr);
     mImplementation.reset(nullptr);
     delete this;
@@ -276,6 +313,12 @@ const std::string &Shader::getTranslatedSource(const Context *context)
     return mState.mTranslatedSource;
 }
 
+const std::vector<uint32_t> &Shader::getTranslatedBinary(const Context *context)
+{
+    resolveCompile(context);
+    return mState.mTranslatedBinary;
+}
+
 void Shader::getTranslatedSourceWithDebugInfo(const Context *context,
                                               GLsizei bufSize,
                                               GLsizei *length,
@@ -286,9 +329,10 @@ void Shader::getTranslatedSourceWithDebugInfo(const Context *context,
     GetSourceImpl(debugInfo, bufSize, length, buffer);
 }
 
-void Shader::compile(const Context *context)
+void Shader::clearCompileResults()
 {
     mState.mTranslatedSource.clear();
+    mState.mTranslatedBinary.clear();
     mInfoLog.clear();
     mState.mShaderVersion = 100;
     mState.mInputVaryings.clear();
@@ -303,6 +347,21 @@ void Shader::compile(const Context *context)
     mState.mGeometryShaderOutputPrimitiveType.reset();
     mState.mGeometryShaderMaxVertices.reset();
     mState.mGeometryShaderInvocations = 1;
+}
+
+void Shader::compile(const Context *context)
+{
+    // Links running in the background may still be reading the previous compile results.
+    while (!mPendingLinks.empty())
+    {
+        mPendingLinks.back()->resolveLink();
+    }
+
+    // The results of a translation still running for a previous compile call are discarded.
+    waitForWorkerTranslation();
+    mPendingTranslation.reset();
+
+    clearCompileResults();
 
     mState.mCompileStatus = CompileStatus::COMPILE_REQUESTED;
     mBoundCompiler.set(context, context->getCompiler());
@@ -333,36 +392,92 @@ void Shader::compile(const Context *context)
     {
         mLastCompileOptions |= SH_VALIDATE_LOOP_INDEXING;
     }
+
+    mPendingTranslation.reset(new PendingTranslation(this));
+
+    MemoryShaderCache *shaderCache = context->getMemoryShaderCache();
+    if (shaderCache && mImplementation->supportsTranslationCache())
+    {
+        MemoryShaderCache::ComputeHash(mBoundCompiler.get(), mState.mShaderType,
+                                       mLastCompileOptions, mLastCompiledSourcePath,
+                                       mLastCompiledSource, &mPendingTranslation->shaderHash);
+        if (shaderCache->getShader(mPendingTranslation->shaderHash, &mState))
+        {
+            mPendingTranslation->loadedFromCache = true;
+            return;
+        }
+
+        // A failed cache load may have left partial results behind.
+        clearCompileResults();
+    }
+
+#if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+    // Start translating right away, so that the translation overlaps with whatever the application
+    // does until it needs the results.
+    angle::WorkerThreadPool *workerPool = context->getWorkerThreadPool();
+    if (workerPool && mImplementation->supportsAsyncTranslation())
+    {
+        mBoundCompiler->prepareWorkerCompilerHandle(mState.mShaderType);
+        mPendingTranslation->compiler        = mBoundCompiler.get();
+        mPendingTranslation->runningOnWorker = true;
+        mPendingTranslation->event = workerPool->postWorkerTask(mPendingTranslation.get());
+    }
+#endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
 }
 
-void Shader::resolveCompile(const Context *context)
+bool Shader::finishTranslation()
 {
-    if (!mState.compilePending())
+    ASSERT(mPendingTranslation);
+
+    if (mPendingTranslation->loadedFromCache)
     {
-        return;
+        return true;
     }
 
-    ASSERT(mBoundCompiler.get());
-    ShHandle compilerHandle = mBoundCompiler->getCompilerHandle(mState.mShaderType);
+    if (mPendingTranslation->runningOnWorker)
+    {
+        waitForWorkerTranslation();
+        return mPendingTranslation->result;
+    }
 
-    std::vector<const char *> srcStrings;
+    return translate(mBoundCompiler->getCompilerHandle(mState.mShaderType));
+}
 
-    if (!mLastCompiledSourcePath.empty())
+void Shader::waitForWorkerTranslation()
+{
+    if (!mPendingTranslation || !mPendingTranslation->runningOnWorker)
     {
-        srcStrings.push_back(mLastCompiledSourcePath.c_str());
+        return;
     }
 
-    srcStrings.push_back(mLastCompiledSource.c_str());
+    mPendingTranslation->event.wait();
+}
 
-    if (!sh::Compile(compilerHandle, &srcStrings[0], srcStrings.size(), mLastCompileOptions))
+void Shader::resolveCompile(const Context *context)
+{
+    if (!mState.compilePending())
+    {
+        return;
+    }
+
+    ASSERT(mBoundCompiler.get());
+
+    bool translated = finishTranslation();
+    std::unique_ptr<PendingTranslation> translation = std::move(mPendingTranslation);
+
+    if (!translated)
     {
-        mInfoLog = sh::GetInfoLog(compilerHandle);
         WARN() << std::endl << mInfoLog;
         mState.mCompileStatus = CompileStatus::NOT_COMPILED;
         return;
     }
 
-    mState.mTranslatedSource = sh::GetObjectCode(compilerHandle);
+    MemoryShaderCache *shaderCache = context->getMemoryShaderCache();
+    if (!translation->loadedFromCache && shaderCache &&
+        mImplementation->supportsTranslationCache())
+    {
+        shaderCache->putShader(translation->shaderHash, mState);
+    }
 
 #if !defined(NDEBUG)
     // Prefix translated shader with commented out un-translated shader.
@@ -385,6 +500,32 @@ void Shader::resolveCompile(const Context *context)
     mState.mTranslatedSource = shaderStream.str();
 #endif  // !defined(NDEBUG)
 
+    ASSERT(!mState.mTranslatedSource.empty());
+
+    bool success = mImplementation->postTranslateCompile(mBoundCompiler.get(), &mInfoLog);
+    mState.mCompileStatus = success ? CompileStatus::COMPILED : CompileStatus::NOT_COMPILED;
+}
+
+bool Shader::translate(ShHandle compilerHandle)
+{
+    std::vector<const char *> srcStrings;
+
+    if (!mLastCompiledSourcePath.empty())
+    {
+        srcStrings.push_back(mLastCompiledSourcePath.c_str());
+    }
+
+    srcStrings.push_back(mLastCompiledSource.c_str());
+
+    if (!sh::Compile(compilerHandle, &srcStrings[0], srcStrings.size(), mLastCompileOptions))
+    {
+        mInfoLog = sh::GetInfoLog(compilerHandle);
+        return false;
+    }
+
+    mState.mTranslatedSource = sh::GetObjectCode(compilerHandle);
+    mState.mTranslatedBinary = sh::GetObjectBinary(compilerHandle);
+
     // Gather the shader information
     mState.mShaderVersion = sh::GetShaderVersion(compilerHandle);
 
@@ -445,10 +586,7 @@ void Shader::resolveCompile(const Context *context)
             UNREACHABLE();
     }
 
-    ASSERT(!mState.mTranslatedSource.empty());
-
-    bool success = mImplementation->postTranslateCompile(mBoundCompiler.get(), &mInfoLog);
-    mState.mCompileStatus = success ? CompileStatus::COMPILED : CompileStatus::NOT_COMPILED;
+    return true;
 }
 
 void Shader::addRef()
@@ -487,6 +625,24 @@ bool Shader::isCompiled(const Context *context)
     return mState.mCompileStatus == CompileStatus::COMPILED;
 }
 
+bool Shader::isCompiling()
+{
+    return mPendingTranslation && mPendingTranslation->runningOnWorker &&
+           !mPendingTranslation->event.isReady();
+}
+
+void Shader::addPendingLink(Program *program)
+{
+    mPendingLinks.push_back(program);
+}
+
+void Shader::removePendingLink(Program *program)
+{
+    auto iter = std::find(mPendingLinks.begin(), mPendingLinks.end(), program);
+    ASSERT(iter != mPendingLinks.end());
+    mPendingLinks.erase(iter);
+}
+
 int Shader::getShaderVersion(const Context *context)
 {
     resolveCompile(context);
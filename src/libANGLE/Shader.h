@@ -36,6 +36,8 @@ namespace gl
 {
 class Compiler;
 class ContextState;
+class MemoryShaderCache;
+class Program;
 struct Limitations;
 class ShaderProgramManager;
 class Context;
@@ -58,6 +60,7 @@ class ShaderState final : angle::NonCopyable
 
     const std::string &getSource() const { return mSource; }
     const std::string &getTranslatedSource() const { return mTranslatedSource; }
+    const std::vector<uint32_t> &getTranslatedBinary() const { return mTranslatedBinary; }
 
     GLenum getShaderType() const { return mShaderType; }
     int getShaderVersion() const { return mShaderVersion; }
@@ -80,12 +83,15 @@ class ShaderState final : angle::NonCopyable
 
   private:
     friend class Shader;
+    friend class MemoryShaderCache;
+    friend class MemoryShaderCacheTest;
 
     std::string mLabel;
 
     GLenum mShaderType;
     int mShaderVersion;
     std::string mTranslatedSource;
+    std::vector<uint32_t> mTranslatedBinary;
     std::string mSource;
 
     sh::WorkGroupSize mLocalSize;
@@ -139,6 +145,8 @@ class Shader final : angle::NonCopyable, public LabeledObject
     int getTranslatedSourceLength(const Context *context);
     int getTranslatedSourceWithDebugInfoLength(const Context *context);
     const std::string &getTranslatedSource(const Context *context);
+    // SPIR-V output of the translator, empty unless the compiler outputs SPIR-V.
+    const std::vector<uint32_t> &getTranslatedBinary(const Context *context);
     void getTranslatedSource(const Context *context,
                              GLsizei bufSize,
                              GLsizei *length,
@@ -150,6 +158,13 @@ class Shader final : angle::NonCopyable, public LabeledObject
 
     void compile(const Context *context);
     bool isCompiled(const Context *context);
+    // Returns true while a translation is still running on a worker thread. Doesn't wait for it.
+    bool isCompiling();
+
+    // Programs that link in the background read the compile results of their shaders, so their
+    // links are finished before the shader is compiled again.
+    void addPendingLink(Program *program);
+    void removePendingLink(Program *program);
 
     void addRef();
     void release(const Context *context);
@@ -191,7 +206,18 @@ class Shader final : angle::NonCopyable, public LabeledObject
                               GLsizei *length,
                               char *buffer);
 
+    struct PendingTranslation;
+
+    void clearCompileResults();
     void resolveCompile(const Context *context);
+    // Runs the translator and gathers its results into the shader state. Returns false if the
+    // translation fails. Can be called on a worker thread.
+    bool translate(ShHandle compilerHandle);
+    // Returns the results of the pending translation, running it first if it wasn't started on a
+    // worker thread.
+    bool finishTranslation();
+    // Waits until a translation running on a worker thread is done.
+    void waitForWorkerTranslation();
 
     ShaderState mState;
     std::string mLastCompiledSource;
@@ -208,6 +234,11 @@ class Shader final : angle::NonCopyable, public LabeledObject
     // We keep a reference to the translator in order to defer compiles while preserving settings.
     BindingPointer<Compiler> mBoundCompiler;
 
+    // Set between a compile call and resolving its results.
+    std::unique_ptr<PendingTranslation> mPendingTranslation;
+
+    std::vector<Program *> mPendingLinks;
+
     ShaderProgramManager *mResourceManager;
 };
 
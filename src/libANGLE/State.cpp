@@ -63,6 +63,7 @@ State::State()
       mProgram(nullptr),
       mVertexArray(nullptr),
       mActiveSampler(0),
+      mActiveTextureTypesDirty(false),
       mPrimitiveRestart(false),
       mMultiSampling(false),
       mSampleAlphaToOne(false),
@@ -177,6 +178,7 @@ void State::initialize(const Context *context,
     mCompleteTextureCache.resize(caps.maxCombinedTextureImageUnits, nullptr);
     mCompleteTextureBindings.reserve(caps.maxCombinedTextureImageUnits);
     mCachedTexturesInitState = InitState::MayNeedInit;
+    mActiveTextureTypes.fill(GL_NONE);
     for (uint32_t textureIndex = 0; textureIndex < caps.maxCombinedTextureImageUnits;
          ++textureIndex)
     {
@@ -807,7 +809,7 @@ void State::setSamplerTexture(const Context *context, GLenum type, Texture *text
 {
     mSamplerTextures[type][mActiveSampler].set(context, texture);
     mDirtyBits.set(DIRTY_BIT_TEXTURE_BINDINGS);
-    mDirtyObjects.set(DIRTY_OBJECT_PROGRAM_TEXTURES);
+    setTextureUnitDirty(mActiveSampler);
 }
 
 Texture *State::getTargetTexture(GLenum target) const
@@ -846,8 +848,9 @@ void State::detachTexture(const Context *context, const TextureMap &zeroTextures
     {
         GLenum textureType = bindingVec.first;
         TextureBindingVector &textureVector = bindingVec.second;
-        for (BindingPointer<Texture> &binding : textureVector)
+        for (size_t textureUnit = 0; textureUnit < textureVector.size(); ++textureUnit)
         {
+            BindingPointer<Texture> &binding = textureVector[textureUnit];
             if (binding.id() == texture)
             {
                 auto it = zeroTextures.find(textureType);
@@ -855,6 +858,7 @@ void State::detachTexture(const Context *context, const TextureMap &zeroTextures
                 // Zero textures are the "default" textures instead of NULL
                 binding.set(context, it->second.get());
                 mDirtyBits.set(DIRTY_BIT_TEXTURE_BINDINGS);
+                setTextureUnitDirty(textureUnit);
             }
         }
     }
@@ -906,7 +910,7 @@ void State::setSamplerBinding(const Context *context, GLuint textureUnit, Sample
 {
     mSamplers[textureUnit].set(context, sampler);
     mDirtyBits.set(DIRTY_BIT_SAMPLER_BINDINGS);
-    mDirtyObjects.set(DIRTY_OBJECT_PROGRAM_TEXTURES);
+    setTextureUnitDirty(textureUnit);
 }
 
 GLuint State::getSamplerId(GLuint textureUnit) const
@@ -926,12 +930,14 @@ void State::detachSampler(const Context *context, GLuint sampler)
     // If a sampler object that is currently bound to one or more texture units is
     // deleted, it is as though BindSampler is called once for each texture unit to
     // which the sampler is bound, with unit set to the texture unit and sampler set to zero.
-    for (BindingPointer<Sampler> &samplerBinding : mSamplers)
+    for (size_t textureUnit = 0; textureUnit < mSamplers.size(); ++textureUnit)
     {
+        BindingPointer<Sampler> &samplerBinding = mSamplers[textureUnit];
         if (samplerBinding.id() == sampler)
         {
             samplerBinding.set(context, nullptr);
             mDirtyBits.set(DIRTY_BIT_SAMPLER_BINDINGS);
+            setTextureUnitDirty(textureUnit);
         }
     }
 }
@@ -1008,12 +1014,23 @@ void State::setDrawFramebufferBinding(Framebuffer *framebuffer)
     mDrawFramebuffer = framebuffer;
     mDirtyBits.set(DIRTY_BIT_DRAW_FRAMEBUFFER_BINDING);
 
+    // Textures that are attached to the draw framebuffer aren't complete for sampling.
+    setActiveTextureUnitsDirty();
+
     if (mDrawFramebuffer && mDrawFramebuffer->hasAnyDirtyBit())
     {
         mDirtyObjects.set(DIRTY_OBJECT_DRAW_FRAMEBUFFER);
     }
 }
 
+void State::onFramebufferAttachmentsChange(const Framebuffer *framebuffer)
+{
+    if (framebuffer == mDrawFramebuffer)
+    {
+        setActiveTextureUnitsDirty();
+    }
+}
+
 Framebuffer *State::getTargetFramebuffer(GLenum target) const
 {
     switch (target)
@@ -1146,8 +1163,11 @@ void State::setProgram(const Context *context, Program *newProgram)
 
         if (mProgram)
         {
+            // The draw path reads the program state directly, so a link that is still running on
+            // a worker thread is finished before the program can be used.
+            newProgram->resolveLink();
             newProgram->addRef();
-            mDirtyObjects.set(DIRTY_OBJECT_PROGRAM_TEXTURES);
+            setActiveTextureTypesDirty();
         }
         mDirtyBits.set(DIRTY_BIT_PROGRAM_EXECUTABLE);
         mDirtyBits.set(DIRTY_BIT_PROGRAM_BINDING);
@@ -1156,6 +1176,10 @@ void State::setProgram(const Context *context, Program *newProgram)
 
 Program *State::getProgram() const
 {
+    if (mProgram)
+    {
+        mProgram->resolveLink();
+    }
     return mProgram;
 }
 
@@ -1363,6 +1387,7 @@ void State::detachBuffer(const Context *context, GLuint bufferName)
     }
 
     getVertexArray()->detachBuffer(context, bufferName);
+    mDirtyObjects.set(DIRTY_OBJECT_VERTEX_ARRAY);
 }
 
 void State::setEnableVertexAttribArray(unsigned int attribNum, bool enabled)
@@ -2271,80 +2296,152 @@ void State::syncDirtyObjects(const Context *context, const DirtyObjects &bitset)
         }
     }
 
+    mDirtyObjectsClearedSinceLastDraw |= (mDirtyObjects & bitset);
     mDirtyObjects &= ~bitset;
 }
 
 void State::syncProgramTextures(const Context *context)
 {
-    // TODO(jmadill): Fine-grained updates.
     if (!mProgram)
     {
         return;
     }
 
     ASSERT(mDirtyObjects[DIRTY_OBJECT_PROGRAM_TEXTURES]);
+
+    if (mActiveTextureTypesDirty)
+    {
+        updateActiveTextureTypes();
+    }
+
+    ActiveTextureMask dirtyTextureUnits = mDirtyTextureUnits & mActiveTexturesMask;
+    mDirtyTextureUnits.reset();
+    if (dirtyTextureUnits.none())
+    {
+        return;
+    }
+
     mDirtyBits.set(DIRTY_BIT_TEXTURE_BINDINGS);
 
-    ActiveTextureMask newActiveTextures;
+    for (size_t textureUnitIndex : dirtyTextureUnits)
+    {
+        GLuint textureUnit = static_cast<GLuint>(textureUnitIndex);
+        Texture *texture   = getSamplerTexture(textureUnit, mActiveTextureTypes[textureUnit]);
+        Sampler *sampler   = getSampler(textureUnit);
+        ASSERT(textureUnitIndex < mCompleteTextureCache.size());
 
-    // Initialize to the 'Initialized' state and set to 'MayNeedInit' if any texture is not
-    // initialized.
-    mCachedTexturesInitState = InitState::Initialized;
+        ASSERT(texture);
+
+        if (texture->isSamplerComplete(context, sampler) &&
+            !mDrawFramebuffer->hasTextureAttachment(texture))
+        {
+            texture->syncState();
+            mCompleteTextureCache[textureUnitIndex] = texture;
+        }
+        else
+        {
+            mCompleteTextureCache[textureUnitIndex] = nullptr;
+        }
+
+        // Bind the texture unconditionally, to recieve completeness change notifications.
+        mCompleteTextureBindings[textureUnitIndex].bind(texture);
+
+        if (sampler != nullptr)
+        {
+            sampler->syncState(context);
+        }
+
+        // Only clearUnclearedActiveTextures knows when all of the textures are initialized.
+        if (texture->initState() == InitState::MayNeedInit)
+        {
+            mCachedTexturesInitState = InitState::MayNeedInit;
+        }
+    }
+}
+
+void State::updateActiveTextureTypes()
+{
+    ActiveTextureMask newActiveTextures;
 
     for (const SamplerBinding &samplerBinding : mProgram->getSamplerBindings())
     {
         if (samplerBinding.unreferenced)
             continue;
 
-        GLenum textureType = samplerBinding.textureType;
         for (GLuint textureUnitIndex : samplerBinding.boundTextureUnits)
         {
-            Texture *texture = getSamplerTexture(textureUnitIndex, textureType);
-            Sampler *sampler = getSampler(textureUnitIndex);
-            ASSERT(static_cast<size_t>(textureUnitIndex) < mCompleteTextureCache.size());
             ASSERT(static_cast<size_t>(textureUnitIndex) < newActiveTextures.size());
+            mActiveTextureTypes[textureUnitIndex] = samplerBinding.textureType;
+            newActiveTextures.set(textureUnitIndex);
+        }
+    }
+
+    // Unset now missing textures.
+    ActiveTextureMask negativeMask = mActiveTexturesMask & ~newActiveTextures;
+    for (size_t textureIndex : negativeMask)
+    {
+        mCompleteTextureBindings[textureIndex].reset();
+        mCompleteTextureCache[textureIndex] = nullptr;
+        mActiveTextureTypes[textureIndex]   = GL_NONE;
+    }
 
-            ASSERT(texture);
+    // The texture type of a unit may have changed, check all of them.
+    mDirtyTextureUnits |= newActiveTextures;
 
-            // Mark the texture binding bit as dirty if the texture completeness changes.
-            // TODO(jmadill): Use specific dirty bit for completeness change.
-            if (texture->isSamplerComplete(context, sampler) &&
-                !mDrawFramebuffer->hasTextureAttachment(texture))
-            {
-                texture->syncState();
-                mCompleteTextureCache[textureUnitIndex] = texture;
-            }
-            else
-            {
-                mCompleteTextureCache[textureUnitIndex] = nullptr;
-            }
+    mActiveTexturesMask      = newActiveTextures;
+    mActiveTextureTypesDirty = false;
+}
 
-            // Bind the texture unconditionally, to recieve completeness change notifications.
-            mCompleteTextureBindings[textureUnitIndex].bind(texture);
-            mActiveTexturesMask.set(textureUnitIndex);
-            newActiveTextures.set(textureUnitIndex);
+void State::setTextureUnitDirty(size_t textureUnit)
+{
+    mDirtyTextureUnits.set(textureUnit);
+    mDirtyObjects.set(DIRTY_OBJECT_PROGRAM_TEXTURES);
+}
 
-            if (sampler != nullptr)
-            {
-                sampler->syncState(context);
-            }
+void State::setActiveTextureUnitsDirty()
+{
+    if (mActiveTexturesMask.any())
+    {
+        mDirtyTextureUnits |= mActiveTexturesMask;
+        mDirtyObjects.set(DIRTY_OBJECT_PROGRAM_TEXTURES);
+    }
+}
 
-            if (texture->initState() == InitState::MayNeedInit)
-            {
-                mCachedTexturesInitState = InitState::MayNeedInit;
-            }
+void State::setActiveTextureTypesDirty()
+{
+    mActiveTextureTypesDirty = true;
+    mDirtyObjects.set(DIRTY_OBJECT_PROGRAM_TEXTURES);
+}
+
+void State::onTextureChange(const Texture *texture)
+{
+    if (mActiveTextureTypesDirty)
+    {
+        return;
+    }
+
+    for (size_t textureUnit : mActiveTexturesMask)
+    {
+        if (getSamplerTexture(static_cast<unsigned int>(textureUnit),
+                              mActiveTextureTypes[textureUnit]) == texture)
+        {
+            setTextureUnitDirty(textureUnit);
         }
     }
+}
 
-    // Unset now missing textures.
-    ActiveTextureMask negativeMask = mActiveTexturesMask & ~newActiveTextures;
-    if (negativeMask.any())
+void State::onSamplerChange(const Sampler *sampler)
+{
+    if (mActiveTextureTypesDirty)
     {
-        for (auto textureIndex : negativeMask)
+        return;
+    }
+
+    for (size_t textureUnit : mActiveTexturesMask)
+    {
+        if (mSamplers[textureUnit].get() == sampler)
         {
-            mCompleteTextureBindings[textureIndex].reset();
-            mCompleteTextureCache[textureIndex] = nullptr;
-            mActiveTexturesMask.reset(textureIndex);
+            setTextureUnitDirty(textureUnit);
         }
     }
 }
@@ -2398,7 +2495,7 @@ void State::setObjectDirty(GLenum target)
         case GL_TEXTURE:
         case GL_SAMPLER:
         case GL_PROGRAM:
-            mDirtyObjects.set(DIRTY_OBJECT_PROGRAM_TEXTURES);
+            setActiveTextureTypesDirty();
             mDirtyBits.set(DIRTY_BIT_TEXTURE_BINDINGS);
             break;
     }
@@ -2410,10 +2507,10 @@ void State::onProgramExecutableChange(Program *program)
     // "If LinkProgram or ProgramBinary successfully re-links a program object
     //  that was already in use as a result of a previous call to UseProgram, then the
     //  generated executable code will be installed as part of the current rendering state."
-    if (program->isLinked() && mProgram == program)
+    if (mProgram == program && program->isLinked())
     {
         mDirtyBits.set(DIRTY_BIT_PROGRAM_EXECUTABLE);
-        mDirtyObjects.set(DIRTY_OBJECT_PROGRAM_TEXTURES);
+        setActiveTextureTypesDirty();
     }
 }
 
@@ -2444,9 +2541,8 @@ void State::onSubjectStateChange(const Context *context,
                                  angle::SubjectIndex index,
                                  angle::SubjectMessage message)
 {
-    // Conservatively assume all textures are dirty.
-    // TODO(jmadill): More fine-grained update.
-    mDirtyObjects.set(DIRTY_OBJECT_PROGRAM_TEXTURES);
+    // The subject index is the texture unit.
+    setTextureUnitDirty(index);
 
     if (!mCompleteTextureCache[index] ||
         mCompleteTextureCache[index]->initState() == InitState::MayNeedInit)
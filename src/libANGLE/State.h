@@ -187,6 +187,10 @@ class State : public angle::ObserverInterface, angle::NonCopyable
     Sampler *getSampler(GLuint textureUnit) const;
     void detachSampler(const Context *context, GLuint sampler);
 
+    // Marks the active texture units that use the texture or sampler for a completeness check.
+    void onTextureChange(const Texture *texture);
+    void onSamplerChange(const Sampler *sampler);
+
     // Renderbuffer binding manipulation
     void setRenderbufferBinding(const Context *context, Renderbuffer *renderbuffer);
     GLuint getRenderbufferId() const;
@@ -201,6 +205,8 @@ class State : public angle::ObserverInterface, angle::NonCopyable
     Framebuffer *getDrawFramebuffer() const;
     bool removeReadFramebufferBinding(GLuint framebuffer);
     bool removeDrawFramebufferBinding(GLuint framebuffer);
+    // Checks the active texture units again if |framebuffer| is the draw framebuffer.
+    void onFramebufferAttachmentsChange(const Framebuffer *framebuffer);
 
     // Vertex array object binding manipulation
     void setVertexArrayBinding(VertexArray *vertexArray);
@@ -433,13 +439,46 @@ class State : public angle::ObserverInterface, angle::NonCopyable
 
     using DirtyBits = angle::BitSet<DIRTY_BIT_MAX>;
     const DirtyBits &getDirtyBits() const { return mDirtyBits; }
-    void clearDirtyBits() { mDirtyBits.reset(); }
-    void clearDirtyBits(const DirtyBits &bitset) { mDirtyBits &= ~bitset; }
+    void clearDirtyBits()
+    {
+        mDirtyBitsClearedSinceLastDraw |= mDirtyBits;
+        mDirtyBits.reset();
+    }
+    void clearDirtyBits(const DirtyBits &bitset)
+    {
+        mDirtyBitsClearedSinceLastDraw |= (mDirtyBits & bitset);
+        mDirtyBits &= ~bitset;
+    }
     void setAllDirtyBits() { mDirtyBits.set(); }
 
     using DirtyObjects = angle::BitSet<DIRTY_OBJECT_MAX>;
-    void clearDirtyObjects() { mDirtyObjects.reset(); }
-    void setAllDirtyObjects() { mDirtyObjects.set(); }
+    void clearDirtyObjects()
+    {
+        mDirtyObjectsClearedSinceLastDraw |= mDirtyObjects;
+        mDirtyObjects.reset();
+    }
+    void setAllDirtyObjects()
+    {
+        mDirtyObjects.set();
+        mActiveTextureTypesDirty = true;
+    }
+
+    // Non-draw calls also sync and clear some of the dirty bits and objects. Draw call validation
+    // caches its results until the state changes, so it needs all of the changes since the last
+    // draw call, which resets them once it has synced the state.
+    DirtyBits getDirtyBitsSinceLastDraw() const
+    {
+        return mDirtyBits | mDirtyBitsClearedSinceLastDraw;
+    }
+    DirtyObjects getDirtyObjectsSinceLastDraw() const
+    {
+        return mDirtyObjects | mDirtyObjectsClearedSinceLastDraw;
+    }
+    void resetDirtyBitsSinceLastDraw()
+    {
+        mDirtyBitsClearedSinceLastDraw.reset();
+        mDirtyObjectsClearedSinceLastDraw.reset();
+    }
     void syncDirtyObjects(const Context *context);
     void syncDirtyObjects(const Context *context, const DirtyObjects &bitset);
     void syncDirtyObject(const Context *context, GLenum target);
@@ -471,6 +510,10 @@ class State : public angle::ObserverInterface, angle::NonCopyable
 
   private:
     void syncProgramTextures(const Context *context);
+    void updateActiveTextureTypes();
+    void setTextureUnitDirty(size_t textureUnit);
+    void setActiveTextureUnitsDirty();
+    void setActiveTextureTypesDirty();
 
     // Cached values from Context's caps
     GLuint mMaxDrawBuffers;
@@ -532,11 +575,16 @@ class State : public angle::ObserverInterface, angle::NonCopyable
     // The texture completeness cache uses dirty bits to avoid having to scan the list of textures
     // each draw call. This gl::State class implements angle::Observer interface. When subject
     // Textures have state changes, messages reach 'State' (also any observing Framebuffers) via the
-    // onSubjectStateChange method (above). This then invalidates the completeness cache.
+    // onSubjectStateChange method (above). This then invalidates the completeness cache of the
+    // texture unit that the Texture is bound to.
     //
     // Note this requires that we also invalidate the completeness cache manually on events like
     // re-binding textures/samplers or a change in the program. For more information see the
     // signal_utils.h header and the design doc linked there.
+    //
+    // Only the units in mDirtyTextureUnits are checked again when the cache is synced. A change in
+    // the program or its sampler uniforms updates the list of active units and their texture
+    // types first, which checks all of them.
 
     // A cache of complete textures. nullptr indicates unbound or incomplete.
     // Don't use BindingPointer because this cache is only valid within a draw call.
@@ -546,6 +594,9 @@ class State : public angle::ObserverInterface, angle::NonCopyable
     InitState mCachedTexturesInitState;
     using ActiveTextureMask = angle::BitSet<IMPLEMENTATION_MAX_ACTIVE_TEXTURES>;
     ActiveTextureMask mActiveTexturesMask;
+    ActiveTextureMask mDirtyTextureUnits;
+    std::array<GLenum, IMPLEMENTATION_MAX_ACTIVE_TEXTURES> mActiveTextureTypes;
+    bool mActiveTextureTypesDirty;
 
     typedef std::vector<BindingPointer<Sampler>> SamplerBindingVector;
     SamplerBindingVector mSamplers;
@@ -602,6 +653,8 @@ class State : public angle::ObserverInterface, angle::NonCopyable
 
     DirtyBits mDirtyBits;
     DirtyObjects mDirtyObjects;
+    DirtyBits mDirtyBitsClearedSinceLastDraw;
+    DirtyObjects mDirtyObjectsClearedSinceLastDraw;
     mutable AttributesMask mDirtyCurrentValues;
 };
 
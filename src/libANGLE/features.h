@@ -9,9 +9,6 @@
 
 #include "common/platform.h"
 
-#define ANGLE_DISABLED 0
-#define ANGLE_ENABLED 1
-
 // Feature defaults
 
 // Direct3D9EX
@@ -52,14 +49,4 @@
 #define ANGLE_PROGRAM_LINK_VALIDATE_UNIFORM_PRECISION ANGLE_ENABLED
 #endif
 
-// Controls if our threading code uses std::async or falls back to single-threaded operations.
-// TODO(jmadill): Enable on Linux once STL chrono headers are updated.
-#if !defined(ANGLE_STD_ASYNC_WORKERS)
-#if defined(ANGLE_PLATFORM_WINDOWS)
-#define ANGLE_STD_ASYNC_WORKERS ANGLE_ENABLED
-#else
-#define ANGLE_STD_ASYNC_WORKERS ANGLE_DISABLED
-#endif  // defined(ANGLE_PLATFORM_WINDOWS)
-#endif  // !defined(ANGLE_STD_ASYNC_WORKERS)
-
 #endif // LIBANGLE_FEATURES_H_
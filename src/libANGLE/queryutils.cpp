@@ -952,6 +952,9 @@ void QueryProgramiv(const Context *context, const Program *program, GLenum pname
         case GL_LINK_STATUS:
             *params = program->isLinked();
             return;
+        case GL_COMPLETION_STATUS_KHR:
+            *params = program->isLinking() ? GL_FALSE : GL_TRUE;
+            return;
         case GL_VALIDATE_STATUS:
             *params = program->isValidated();
             return;
@@ -1083,6 +1086,9 @@ void QueryShaderiv(const Context *context, Shader *shader, GLenum pname, GLint *
         case GL_COMPILE_STATUS:
             *params = shader->isCompiled(context) ? GL_TRUE : GL_FALSE;
             return;
+        case GL_COMPLETION_STATUS_KHR:
+            *params = shader->isCompiling() ? GL_FALSE : GL_TRUE;
+            return;
         case GL_INFO_LOG_LENGTH:
             *params = shader->getInfoLogLength(context);
             return;
@@ -11,9 +11,11 @@
 
 #include "common/angleutils.h"
 #include "common/mathutil.h"
+#include "common/utilities.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/PackedGLEnums.h"
 
+#include <algorithm>
 #include <stdint.h>
 
 namespace gl
@@ -61,6 +63,26 @@ class BufferImpl : angle::NonCopyable
                                     bool primitiveRestartEnabled,
                                     gl::IndexRange *outRange) = 0;
 
+    // Fills |outRanges| with the range of each run of |indicesPerBlock| indices starting at
+    // |offset|, with primitive restart enabled. The last block is shorter if |count| isn't a
+    // multiple of |indicesPerBlock|. Backends should override this to read the data only once.
+    virtual gl::Error getIndexBlockRanges(const gl::Context *context,
+                                          GLenum type,
+                                          size_t offset,
+                                          size_t count,
+                                          size_t indicesPerBlock,
+                                          gl::IndexRange *outRanges)
+    {
+        size_t blockBytes = indicesPerBlock * gl::ElementTypeSize(type);
+        for (size_t first = 0; first < count; first += indicesPerBlock)
+        {
+            ANGLE_TRY(getIndexRange(context, type, offset, std::min(indicesPerBlock, count - first),
+                                    true, outRanges++));
+            offset += blockBytes;
+        }
+        return gl::NoError();
+    }
+
   protected:
     const gl::BufferState &mState;
 };
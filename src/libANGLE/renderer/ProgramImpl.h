@@ -49,6 +49,10 @@ class ProgramImpl : angle::NonCopyable
                                 gl::InfoLog &infoLog)                      = 0;
     virtual GLboolean validate(const gl::Caps &caps, gl::InfoLog *infoLog) = 0;
 
+    // Returns true if link can be called on a worker thread. Otherwise the front-end calls it on
+    // the GL thread when the program is first used.
+    virtual bool supportsAsyncLink() const { return false; }
+
     virtual void setUniform1fv(GLint location, GLsizei count, const GLfloat *v) = 0;
     virtual void setUniform2fv(GLint location, GLsizei count, const GLfloat *v) = 0;
     virtual void setUniform3fv(GLint location, GLsizei count, const GLfloat *v) = 0;
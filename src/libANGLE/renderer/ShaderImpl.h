@@ -29,6 +29,14 @@ class ShaderImpl : angle::NonCopyable
 
     virtual std::string getDebugInfo() const = 0;
 
+    // Returns true if postTranslateCompile only depends on the shader state, so the translation
+    // results can be loaded from the shader cache instead of running the translator.
+    virtual bool supportsTranslationCache() const { return true; }
+
+    // Returns true if postTranslateCompile doesn't need the compiler handle that ran the
+    // translation, so the translation can run on a worker thread with a handle of its own.
+    virtual bool supportsAsyncTranslation() const { return true; }
+
     const gl::ShaderState &getData() const { return mData; }
 
   protected:
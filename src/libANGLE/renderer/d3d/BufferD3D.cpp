@@ -187,4 +187,18 @@ gl::Error BufferD3D::getIndexRange(const gl::Context *context,
     return gl::NoError();
 }
 
+gl::Error BufferD3D::getIndexBlockRanges(const gl::Context *context,
+                                         GLenum type,
+                                         size_t offset,
+                                         size_t count,
+                                         size_t indicesPerBlock,
+                                         gl::IndexRange *outRanges)
+{
+    const uint8_t *data = nullptr;
+    ANGLE_TRY(getData(context, &data));
+
+    gl::ComputeIndexBlockRanges(type, data + offset, count, indicesPerBlock, outRanges);
+    return gl::NoError();
+}
+
 }  // namespace rx
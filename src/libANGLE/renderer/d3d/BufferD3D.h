@@ -63,6 +63,12 @@ class BufferD3D : public BufferImpl
                             size_t count,
                             bool primitiveRestartEnabled,
                             gl::IndexRange *outRange) override;
+    gl::Error getIndexBlockRanges(const gl::Context *context,
+                                  GLenum type,
+                                  size_t offset,
+                                  size_t count,
+                                  size_t indicesPerBlock,
+                                  gl::IndexRange *outRanges) override;
 
     BufferFactoryD3D *getFactory() const { return mFactory; }
     D3DBufferUsage getUsage() const { return mUsage; }
@@ -13,11 +13,11 @@
 
 #include "common/Color.h"
 #include "common/MemoryBuffer.h"
+#include "common/WorkerThread.h"
 #include "common/debug.h"
 #include "libANGLE/ContextState.h"
 #include "libANGLE/Device.h"
 #include "libANGLE/Version.h"
-#include "libANGLE/WorkerThread.h"
 #include "libANGLE/angletypes.h"
 #include "libANGLE/formatutils.h"
 #include "libANGLE/renderer/d3d/VertexDataManager.h"
@@ -43,6 +43,9 @@ class ShaderD3D : public ShaderImpl
                                                    std::string *sourcePath) override;
     bool postTranslateCompile(gl::Compiler *compiler, std::string *infoLog) override;
     std::string getDebugInfo() const override;
+    // The uniform register assignments are queried from the translator after translation.
+    bool supportsTranslationCache() const override { return false; }
+    bool supportsAsyncTranslation() const override { return false; }
 
     // D3D-specific methods
     void uncompile();
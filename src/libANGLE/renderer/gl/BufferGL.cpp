@@ -224,6 +224,35 @@ gl::Error BufferGL::getIndexRange(const gl::Context *context,
     return gl::NoError();
 }
 
+gl::Error BufferGL::getIndexBlockRanges(const gl::Context *context,
+                                        GLenum type,
+                                        size_t offset,
+                                        size_t count,
+                                        size_t indicesPerBlock,
+                                        gl::IndexRange *outRanges)
+{
+    ASSERT(!mIsMapped);
+
+    if (mShadowBufferData)
+    {
+        gl::ComputeIndexBlockRanges(type, mShadowCopy.data() + offset, count, indicesPerBlock,
+                                    outRanges);
+    }
+    else
+    {
+        mStateManager->bindBuffer(DestBufferOperationTarget, mBufferID);
+
+        const gl::Type &typeInfo  = gl::GetTypeInfo(type);
+        const uint8_t *bufferData =
+            MapBufferRangeWithFallback(mFunctions, gl::ToGLenum(DestBufferOperationTarget), offset,
+                                       count * typeInfo.bytes, GL_MAP_READ_BIT);
+        gl::ComputeIndexBlockRanges(type, bufferData, count, indicesPerBlock, outRanges);
+        mFunctions->unmapBuffer(gl::ToGLenum(DestBufferOperationTarget));
+    }
+
+    return gl::NoError();
+}
+
 GLuint BufferGL::getBufferID() const
 {
     return mBufferID;
@@ -55,6 +55,12 @@ class BufferGL : public BufferImpl
                             size_t count,
                             bool primitiveRestartEnabled,
                             gl::IndexRange *outRange) override;
+    gl::Error getIndexBlockRanges(const gl::Context *context,
+                                  GLenum type,
+                                  size_t offset,
+                                  size_t count,
+                                  size_t indicesPerBlock,
+                                  gl::IndexRange *outRanges) override;
 
     GLuint getBufferID() const;
 
@@ -108,6 +108,17 @@ gl::Error BufferNULL::getIndexRange(const gl::Context *context,
     return gl::NoError();
 }
 
+gl::Error BufferNULL::getIndexBlockRanges(const gl::Context *context,
+                                          GLenum type,
+                                          size_t offset,
+                                          size_t count,
+                                          size_t indicesPerBlock,
+                                          gl::IndexRange *outRanges)
+{
+    gl::ComputeIndexBlockRanges(type, mData.data() + offset, count, indicesPerBlock, outRanges);
+    return gl::NoError();
+}
+
 uint8_t *BufferNULL::getDataPtr()
 {
     return mData.data();
@@ -52,6 +52,12 @@ class BufferNULL : public BufferImpl
                             size_t count,
                             bool primitiveRestartEnabled,
                             gl::IndexRange *outRange) override;
+    gl::Error getIndexBlockRanges(const gl::Context *context,
+                                  GLenum type,
+                                  size_t offset,
+                                  size_t count,
+                                  size_t indicesPerBlock,
+                                  gl::IndexRange *outRanges) override;
 
     uint8_t *getDataPtr();
     const uint8_t *getDataPtr() const;
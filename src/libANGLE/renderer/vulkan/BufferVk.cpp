@@ -176,6 +176,28 @@ gl::Error BufferVk::getIndexRange(const gl::Context *context,
     return gl::NoError();
 }
 
+gl::Error BufferVk::getIndexBlockRanges(const gl::Context *context,
+                                        GLenum type,
+                                        size_t offset,
+                                        size_t count,
+                                        size_t indicesPerBlock,
+                                        gl::IndexRange *outRanges)
+{
+    VkDevice device = vk::GetImpl(context)->getDevice();
+
+    ASSERT(mBuffer.valid());
+
+    const gl::Type &typeInfo = gl::GetTypeInfo(type);
+
+    uint8_t *mapPointer = nullptr;
+    ANGLE_TRY(mBufferMemory.map(device, offset, typeInfo.bytes * count, 0, &mapPointer));
+
+    gl::ComputeIndexBlockRanges(type, mapPointer, count, indicesPerBlock, outRanges);
+
+    mBufferMemory.unmap(device);
+    return gl::NoError();
+}
+
 vk::Error BufferVk::setDataImpl(ContextVk *contextVk,
                                 const uint8_t *data,
                                 size_t size,
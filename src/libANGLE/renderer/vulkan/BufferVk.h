@@ -53,6 +53,12 @@ class BufferVk : public BufferImpl, public ResourceVk
                             size_t count,
                             bool primitiveRestartEnabled,
                             gl::IndexRange *outRange) override;
+    gl::Error getIndexBlockRanges(const gl::Context *context,
+                                  GLenum type,
+                                  size_t offset,
+                                  size_t count,
+                                  size_t indicesPerBlock,
+                                  gl::IndexRange *outRanges) override;
 
     const vk::Buffer &getVkBuffer() const;
 
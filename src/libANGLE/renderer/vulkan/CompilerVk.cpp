@@ -10,12 +10,19 @@
 #include "libANGLE/renderer/vulkan/CompilerVk.h"
 
 #include "common/debug.h"
+#include "common/system_utils.h"
 
 namespace rx
 {
 
-CompilerVk::CompilerVk() : CompilerImpl()
+CompilerVk::CompilerVk() : CompilerImpl(), mOutputType(SH_GLSL_VULKAN_OUTPUT)
 {
+    // The SPIR-V output covers a subset of the language and hasn't been validated widely yet, so
+    // it is only used if asked for.
+    if (angle::GetEnvironmentVar("ANGLE_VULKAN_SPIRV_OUTPUT") == "1")
+    {
+        mOutputType = SH_SPIRV_VULKAN_OUTPUT;
+    }
 }
 
 CompilerVk::~CompilerVk()
@@ -29,7 +36,7 @@ gl::Error CompilerVk::release()
 
 ShShaderOutput CompilerVk::getTranslatorOutputType() const
 {
-    return SH_GLSL_VULKAN_OUTPUT;
+    return mOutputType;
 }
 
 }  // namespace rx
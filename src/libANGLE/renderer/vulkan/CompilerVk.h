@@ -25,6 +25,9 @@ class CompilerVk : public CompilerImpl
 
     // TODO(jmadill): Expose translator built-in resources init method.
     ShShaderOutput getTranslatorOutputType() const override;
+
+  private:
+    ShShaderOutput mOutputType;
 };
 
 }  // namespace rx
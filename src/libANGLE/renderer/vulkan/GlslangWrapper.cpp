@@ -16,10 +16,17 @@
 #include <StandAlone/ResourceLimits.h>
 #include <SPIRV/GlslangToSpv.h>
 
+#include <anglebase/sha1.h>
+
 #include <array>
+#include <map>
+#include <sstream>
 
 #include "common/string_utils.h"
+#include "common/system_utils.h"
 #include "common/utilities.h"
+#include "common/version.h"
+#include "libANGLE/BinaryStream.h"
 #include "libANGLE/ProgramLinkedResources.h"
 
 namespace rx
@@ -28,6 +35,77 @@ namespace rx
 namespace
 {
 
+// Large enough for the SPIR-V of a few hundred typical programs.
+constexpr size_t kMaxSpirvCacheMemoryBytes = 8 * 1024 * 1024;
+
+// Settings for parsing GLSL with SPIR-V and Vulkan rules.
+constexpr int kGlslangVersion          = 450;
+constexpr EProfile kGlslangProfile     = ECoreProfile;
+constexpr EShMessages kGlslangMessages =
+    static_cast<EShMessages>(EShMsgSpvRules | EShMsgVulkanRules);
+
+void WriteSpirv(gl::BinaryOutputStream *stream, const std::vector<uint32_t> &code)
+{
+    stream->writeInt(code.size());
+    stream->writeBytes(reinterpret_cast<const unsigned char *>(code.data()),
+                       code.size() * sizeof(uint32_t));
+}
+
+void LoadSpirv(gl::BinaryInputStream *stream, size_t length, std::vector<uint32_t> *code)
+{
+    // Check the size against the binary before allocating, in case a disk file is corrupt.
+    size_t wordCount = stream->readInt<size_t>();
+    if (stream->error() || wordCount > (length - stream->offset()) / sizeof(uint32_t))
+    {
+        code->clear();
+        return;
+    }
+
+    code->resize(wordCount);
+    stream->readBytes(reinterpret_cast<unsigned char *>(code->data()),
+                      wordCount * sizeof(uint32_t));
+}
+
+void SerializeSpirv(const std::vector<uint32_t> &vertexCode,
+                    const std::vector<uint32_t> &fragmentCode,
+                    angle::MemoryBuffer *binaryOut)
+{
+    gl::BinaryOutputStream stream;
+
+    // SPIR-V from a different version of ANGLE is rejected when loaded from disk.
+    stream.writeBytes(reinterpret_cast<const unsigned char *>(ANGLE_COMMIT_HASH),
+                      ANGLE_COMMIT_HASH_SIZE);
+    WriteSpirv(&stream, vertexCode);
+    WriteSpirv(&stream, fragmentCode);
+
+    ASSERT(binaryOut);
+    binaryOut->resize(stream.length());
+    memcpy(binaryOut->data(), stream.data(), stream.length());
+}
+
+bool DeserializeSpirv(const uint8_t *binary,
+                      size_t length,
+                      std::vector<uint32_t> *vertexCodeOut,
+                      std::vector<uint32_t> *fragmentCodeOut)
+{
+    gl::BinaryInputStream stream(binary, length);
+
+    unsigned char commitString[ANGLE_COMMIT_HASH_SIZE];
+    stream.readBytes(commitString, ANGLE_COMMIT_HASH_SIZE);
+    if (stream.error() ||
+        memcmp(commitString, ANGLE_COMMIT_HASH, sizeof(unsigned char) * ANGLE_COMMIT_HASH_SIZE) !=
+            0)
+    {
+        return false;
+    }
+
+    LoadSpirv(&stream, length, vertexCodeOut);
+    LoadSpirv(&stream, length, fragmentCodeOut);
+
+    return !stream.error() && stream.endOfStream() && !vertexCodeOut->empty() &&
+           !fragmentCodeOut->empty();
+}
+
 void InsertLayoutSpecifierString(std::string *shaderString,
                                  const std::string &variableName,
                                  const std::string &layoutString)
@@ -39,6 +117,94 @@ void InsertLayoutSpecifierString(std::string *shaderString,
     angle::ReplaceSubstring(shaderString, searchString, layoutString);
 }
 
+// The locations, sets and bindings assigned to the interface variables of one stage, by name.
+// These are the layout qualifiers that are filled into the GLSL output, for the SPIR-V output.
+struct SpirvLayout
+{
+    std::map<std::string, uint32_t> locations;
+    std::map<std::string, std::pair<uint32_t, uint32_t>> setBindings;
+};
+
+// Replaces the placeholder Location, DescriptorSet and Binding decorations of the translator's
+// SPIR-V output, whose variables are named after their GLSL names. See corresponding code in
+// OutputSPIRV.cpp. Returns false if a decorated variable isn't assigned anything, in which case
+// the SPIR-V can't be used. The outputs of fragment shaders keep their locations, as in the GLSL.
+bool PatchSpirvLayout(const SpirvLayout &layout, bool isFragmentStage, std::vector<uint32_t> *spirv)
+{
+    constexpr size_t kHeaderWordCount      = 5;
+    constexpr uint32_t kOpName             = 5;
+    constexpr uint32_t kOpVariable         = 59;
+    constexpr uint32_t kOpDecorate         = 71;
+    constexpr uint32_t kDecorationLocation = 30;
+    constexpr uint32_t kDecorationBinding  = 33;
+    constexpr uint32_t kDecorationSet      = 34;
+    constexpr uint32_t kStorageClassOutput = 3;
+
+    std::vector<uint32_t> &code = *spirv;
+    std::map<uint32_t, std::string> names;
+    std::map<uint32_t, uint32_t> storageClasses;
+    std::vector<size_t> decorations;
+
+    for (size_t offset = kHeaderWordCount; offset < code.size();)
+    {
+        size_t wordCount = code[offset] >> 16;
+        uint32_t opcode  = code[offset] & 0xFFFF;
+        if (wordCount == 0 || offset + wordCount > code.size())
+        {
+            return false;
+        }
+
+        if (opcode == kOpName && wordCount > 2 && names.count(code[offset + 1]) == 0)
+        {
+            const char *name        = reinterpret_cast<const char *>(&code[offset + 2]);
+            names[code[offset + 1]] = std::string(name, strnlen(name, (wordCount - 2) * 4));
+        }
+        else if (opcode == kOpVariable && wordCount > 3)
+        {
+            storageClasses[code[offset + 2]] = code[offset + 3];
+        }
+        else if (opcode == kOpDecorate && wordCount == 4)
+        {
+            decorations.push_back(offset);
+        }
+
+        offset += wordCount;
+    }
+
+    // The variables are declared after their decorations, so these are patched afterwards.
+    for (size_t offset : decorations)
+    {
+        uint32_t target         = code[offset + 1];
+        uint32_t decoration     = code[offset + 2];
+        const std::string &name = names[target];
+
+        if (decoration == kDecorationLocation)
+        {
+            auto location = layout.locations.find(name);
+            if (location != layout.locations.end())
+            {
+                code[offset + 3] = location->second;
+            }
+            else if (!isFragmentStage || storageClasses[target] != kStorageClassOutput)
+            {
+                return false;
+            }
+        }
+        else if (decoration == kDecorationSet || decoration == kDecorationBinding)
+        {
+            auto setBinding = layout.setBindings.find(name);
+            if (setBinding == layout.setBindings.end())
+            {
+                return false;
+            }
+            code[offset + 3] = decoration == kDecorationSet ? setBinding->second.first
+                                                            : setBinding->second.second;
+        }
+    }
+
+    return true;
+}
+
 }  // anonymous namespace
 
 // static
@@ -72,9 +238,17 @@ void GlslangWrapper::ReleaseReference()
 }
 
 GlslangWrapper::GlslangWrapper()
+    : mSpirvCache(kMaxSpirvCacheMemoryBytes),
+      mDiskCache(".spv", "SPIR-V"),
+      mMemoryHitCount(0),
+      mDiskHitCount(0),
+      mMissCount(0)
 {
     int result = ShInitialize();
     ASSERT(result != 0);
+
+    // SPIR-V can persist between runs if a cache directory is given.
+    setSpirvCacheDirectory(angle::GetEnvironmentVar("ANGLE_SPIRV_CACHE_DIR"));
 }
 
 GlslangWrapper::~GlslangWrapper()
@@ -95,6 +269,10 @@ gl::LinkResult GlslangWrapper::linkProgram(const gl::Context *glContext,
     std::string vertexSource   = glVertexShader->getTranslatedSource(glContext);
     std::string fragmentSource = glFragmentShader->getTranslatedSource(glContext);
 
+    // The same layout is assigned to the SPIR-V output of the translator, if there is one.
+    SpirvLayout vertexLayout;
+    SpirvLayout fragmentLayout;
+
     // Parse attribute locations and replace them in the vertex shader.
     // See corresponding code in OutputVulkanGLSL.cpp.
     // TODO(jmadill): Also do the same for ESSL 3 fragment outputs.
@@ -105,6 +283,7 @@ gl::LinkResult GlslangWrapper::linkProgram(const gl::Context *glContext,
 
         std::string locationString = "location = " + Str(attribute.location);
         InsertLayoutSpecifierString(&vertexSource, attribute.name, locationString);
+        vertexLayout.locations[attribute.name] = attribute.location;
     }
 
     // Assign varying locations.
@@ -115,6 +294,8 @@ gl::LinkResult GlslangWrapper::linkProgram(const gl::Context *glContext,
         std::string locationString = "location = " + Str(varyingReg.registerRow);
         InsertLayoutSpecifierString(&vertexSource, varying.varying->name, locationString);
         InsertLayoutSpecifierString(&fragmentSource, varying.varying->name, locationString);
+        vertexLayout.locations[varying.varying->name]   = varyingReg.registerRow;
+        fragmentLayout.locations[varying.varying->name] = varyingReg.registerRow;
     }
 
     // Bind the default uniforms for vertex and fragment shaders.
@@ -128,6 +309,8 @@ gl::LinkResult GlslangWrapper::linkProgram(const gl::Context *glContext,
 
     angle::ReplaceSubstring(&vertexSource, searchString, vertexDefaultUniformsBinding);
     angle::ReplaceSubstring(&fragmentSource, searchString, fragmentDefaultUniformsBinding);
+    vertexLayout.setBindings["defaultUniforms"]   = std::make_pair(0u, 0u);
+    fragmentLayout.setBindings["defaultUniforms"] = std::make_pair(0u, 1u);
 
     // Assign textures to a descriptor set and binding.
     int textureCount     = 0;
@@ -137,34 +320,66 @@ gl::LinkResult GlslangWrapper::linkProgram(const gl::Context *glContext,
         const gl::LinkedUniform &samplerUniform = uniforms[uniformIndex];
 
         std::string setBindingString = "set = 1, binding = " + Str(textureCount);
+        auto setBinding              = std::make_pair(1u, static_cast<uint32_t>(textureCount));
 
         ASSERT(samplerUniform.vertexStaticUse || samplerUniform.fragmentStaticUse);
         if (samplerUniform.vertexStaticUse)
         {
             InsertLayoutSpecifierString(&vertexSource, samplerUniform.name, setBindingString);
+            vertexLayout.setBindings[samplerUniform.name] = setBinding;
         }
 
         if (samplerUniform.fragmentStaticUse)
         {
             InsertLayoutSpecifierString(&fragmentSource, samplerUniform.name, setBindingString);
+            fragmentLayout.setBindings[samplerUniform.name] = setBinding;
         }
 
         textureCount += samplerUniform.getBasicTypeElementCount();
     }
 
+    // SPIR-V generated by the translator skips glslang entirely.
+    const std::vector<uint32_t> &vertexBinary   = glVertexShader->getTranslatedBinary(glContext);
+    const std::vector<uint32_t> &fragmentBinary = glFragmentShader->getTranslatedBinary(glContext);
+    if (!vertexBinary.empty() && !fragmentBinary.empty())
+    {
+        *vertexCodeOut   = vertexBinary;
+        *fragmentCodeOut = fragmentBinary;
+        if (PatchSpirvLayout(vertexLayout, false, vertexCodeOut) &&
+            PatchSpirvLayout(fragmentLayout, true, fragmentCodeOut))
+        {
+            return true;
+        }
+    }
+
+    return compileToSpirv(vertexSource, fragmentSource, vertexCodeOut, fragmentCodeOut);
+}
+
+gl::LinkResult GlslangWrapper::compileToSpirv(const std::string &vertexSource,
+                                              const std::string &fragmentSource,
+                                              std::vector<uint32_t> *vertexCodeOut,
+                                              std::vector<uint32_t> *fragmentCodeOut)
+{
+    // The layout qualifiers are part of the sources, so the patched sources identify the SPIR-V.
+    SpirvHash spirvHash;
+    ComputeSpirvHash(vertexSource, fragmentSource, &spirvHash);
+    if (getSpirv(spirvHash, vertexCodeOut, fragmentCodeOut))
+    {
+        return true;
+    }
+
     std::array<const char *, 2> strings = {{vertexSource.c_str(), fragmentSource.c_str()}};
 
     std::array<int, 2> lengths = {
         {static_cast<int>(vertexSource.length()), static_cast<int>(fragmentSource.length())}};
 
-    // Enable SPIR-V and Vulkan rules when parsing GLSL
-    EShMessages messages = static_cast<EShMessages>(EShMsgSpvRules | EShMsgVulkanRules);
+    EShMessages messages = kGlslangMessages;
 
     glslang::TShader vertexShader(EShLangVertex);
     vertexShader.setStringsWithLengths(&strings[0], &lengths[0], 1);
     vertexShader.setEntryPoint("main");
-    bool vertexResult = vertexShader.parse(&glslang::DefaultTBuiltInResource, 450, ECoreProfile,
-                                           false, false, messages);
+    bool vertexResult = vertexShader.parse(&glslang::DefaultTBuiltInResource, kGlslangVersion,
+                                           kGlslangProfile, false, false, messages);
     if (!vertexResult)
     {
         return gl::InternalError() << "Internal error parsing Vulkan vertex shader:\n"
@@ -175,8 +390,8 @@ gl::LinkResult GlslangWrapper::linkProgram(const gl::Context *glContext,
     glslang::TShader fragmentShader(EShLangFragment);
     fragmentShader.setStringsWithLengths(&strings[1], &lengths[1], 1);
     fragmentShader.setEntryPoint("main");
-    bool fragmentResult = fragmentShader.parse(&glslang::DefaultTBuiltInResource, 450, ECoreProfile,
-                                               false, false, messages);
+    bool fragmentResult = fragmentShader.parse(&glslang::DefaultTBuiltInResource, kGlslangVersion,
+                                               kGlslangProfile, false, false, messages);
     if (!fragmentResult)
     {
         return gl::InternalError() << "Internal error parsing Vulkan fragment shader:\n"
@@ -199,7 +414,125 @@ gl::LinkResult GlslangWrapper::linkProgram(const gl::Context *glContext,
     glslang::GlslangToSpv(*vertexStage, *vertexCodeOut);
     glslang::GlslangToSpv(*fragmentStage, *fragmentCodeOut);
 
+    // Only successful compiles are cached, so errors are reported every time.
+    putSpirv(spirvHash, *vertexCodeOut, *fragmentCodeOut);
+
     return true;
 }
 
+// static
+void GlslangWrapper::ComputeSpirvHash(const std::string &vertexSource,
+                                      const std::string &fragmentSource,
+                                      SpirvHash *hashOut)
+{
+    // SPIR-V generated by a different version of ANGLE, and so of glslang, isn't reused. The
+    // sources are hashed where they are and only their digests are combined with the version.
+    std::array<unsigned char, angle::base::kSHA1Length> vertexDigest;
+    std::array<unsigned char, angle::base::kSHA1Length> fragmentDigest;
+    angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(vertexSource.c_str()),
+                               vertexSource.length(), vertexDigest.data());
+    angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(fragmentSource.c_str()),
+                               fragmentSource.length(), fragmentDigest.data());
+
+    std::ostringstream hashStream;
+    hashStream << ANGLE_COMMIT_HASH << ":" << kGlslangVersion << ":" << kGlslangProfile << ":"
+               << kGlslangMessages << ":";
+
+    std::string spirvKey = hashStream.str();
+    spirvKey.append(vertexDigest.begin(), vertexDigest.end());
+    spirvKey.append(fragmentDigest.begin(), fragmentDigest.end());
+    angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(spirvKey.c_str()),
+                               spirvKey.length(), hashOut->data());
+}
+
+void GlslangWrapper::setSpirvCacheDirectory(const std::string &directory)
+{
+    std::lock_guard<std::mutex> lock(mSpirvCacheMutex);
+    mDiskCache.setDirectory(directory);
+}
+
+void GlslangWrapper::clearSpirvCache()
+{
+    std::lock_guard<std::mutex> lock(mSpirvCacheMutex);
+    mSpirvCache.clear();
+    mMemoryHitCount = 0;
+    mDiskHitCount   = 0;
+    mMissCount      = 0;
+    mDiskCache.resetWarnings();
+}
+
+bool GlslangWrapper::getSpirv(const SpirvHash &spirvHash,
+                              std::vector<uint32_t> *vertexCodeOut,
+                              std::vector<uint32_t> *fragmentCodeOut)
+{
+    std::lock_guard<std::mutex> lock(mSpirvCacheMutex);
+
+    const angle::MemoryBuffer *binary = nullptr;
+    if (mSpirvCache.get(spirvHash, &binary))
+    {
+        if (DeserializeSpirv(binary->data(), binary->size(), vertexCodeOut, fragmentCodeOut))
+        {
+            mMemoryHitCount++;
+            return true;
+        }
+
+        // Cache load failed, evict.
+        mSpirvCache.eraseByKey(spirvHash);
+    }
+
+    angle::MemoryBuffer diskBinary;
+    if (mDiskCache.load(spirvHash, &diskBinary))
+    {
+        if (DeserializeSpirv(diskBinary.data(), diskBinary.size(), vertexCodeOut,
+                             fragmentCodeOut))
+        {
+            mDiskHitCount++;
+
+            size_t binarySize = diskBinary.size();
+            mSpirvCache.put(spirvHash, std::move(diskBinary), binarySize);
+            return true;
+        }
+
+        mDiskCache.reportCorruptEntry(spirvHash);
+    }
+
+    vertexCodeOut->clear();
+    fragmentCodeOut->clear();
+    mMissCount++;
+    return false;
+}
+
+void GlslangWrapper::putSpirv(const SpirvHash &spirvHash,
+                              const std::vector<uint32_t> &vertexCode,
+                              const std::vector<uint32_t> &fragmentCode)
+{
+    angle::MemoryBuffer binary;
+    SerializeSpirv(vertexCode, fragmentCode, &binary);
+
+    std::string diskPath;
+    {
+        std::lock_guard<std::mutex> lock(mSpirvCacheMutex);
+        if (mDiskCache.isEnabled())
+        {
+            diskPath = mDiskCache.getPath(spirvHash);
+        }
+    }
+
+    // Writing the file can be slow, so other threads aren't kept waiting on the cache meanwhile.
+    bool diskStored = diskPath.empty() || gl::DiskCache::StoreFile(diskPath, binary);
+
+    std::lock_guard<std::mutex> lock(mSpirvCacheMutex);
+
+    if (!diskStored)
+    {
+        mDiskCache.reportFailedStore(diskPath);
+    }
+
+    size_t binarySize = binary.size();
+    if (!mSpirvCache.put(spirvHash, std::move(binary), binarySize))
+    {
+        ERR() << "Failed to store SPIR-V in memory cache, program is too large.";
+    }
+}
+
 }  // namespace rx
@@ -9,7 +9,13 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_GLSLANG_WRAPPER_H_
 #define LIBANGLE_RENDERER_VULKAN_GLSLANG_WRAPPER_H_
 
+#include <mutex>
+
+#include "common/MemoryBuffer.h"
+#include "libANGLE/DiskCache.h"
+#include "libANGLE/MemoryProgramCache.h"
 #include "libANGLE/RefCountObject.h"
+#include "libANGLE/SizedMRUCache.h"
 #include "libANGLE/renderer/ProgramImpl.h"
 
 namespace rx
@@ -29,11 +35,56 @@ class GlslangWrapper : public gl::RefCountObjectNoID
                                std::vector<uint32_t> *vertexCodeOut,
                                std::vector<uint32_t> *fragmentCodeOut);
 
+    // Compiles Vulkan GLSL shaders, with their layout qualifiers already filled in, to SPIR-V.
+    // The results are cached by the content of the sources, so linking the same program again in
+    // any context costs only a lookup.
+    gl::LinkResult compileToSpirv(const std::string &vertexSource,
+                                  const std::string &fragmentSource,
+                                  std::vector<uint32_t> *vertexCodeOut,
+                                  std::vector<uint32_t> *fragmentCodeOut);
+
+    // Enables storing SPIR-V on disk in the given directory, so it persists between runs. An empty
+    // path disables it.
+    void setSpirvCacheDirectory(const std::string &directory);
+
+    // Empty the memory cache and reset the counters. Doesn't touch the disk cache.
+    void clearSpirvCache();
+
+    // Counters for measuring the effectiveness of the cache.
+    size_t getSpirvCacheMemoryHitCount() const { return mMemoryHitCount; }
+    size_t getSpirvCacheDiskHitCount() const { return mDiskHitCount; }
+    size_t getSpirvCacheMissCount() const { return mMissCount; }
+
   private:
+    friend class GlslangWrapperTest;
+
     GlslangWrapper();
     ~GlslangWrapper() override;
 
+    using SpirvHash = gl::ProgramHash;
+
+    static void ComputeSpirvHash(const std::string &vertexSource,
+                                 const std::string &fragmentSource,
+                                 SpirvHash *hashOut);
+
+    bool getSpirv(const SpirvHash &spirvHash,
+                  std::vector<uint32_t> *vertexCodeOut,
+                  std::vector<uint32_t> *fragmentCodeOut);
+    void putSpirv(const SpirvHash &spirvHash,
+                  const std::vector<uint32_t> &vertexCode,
+                  const std::vector<uint32_t> &fragmentCode);
+
     static GlslangWrapper *mInstance;
+
+    // The wrapper is shared by all the renderers in the process, which may link on different
+    // threads.
+    std::mutex mSpirvCacheMutex;
+    angle::SizedMRUCache<SpirvHash, angle::MemoryBuffer> mSpirvCache;
+    gl::DiskCache mDiskCache;
+
+    size_t mMemoryHitCount;
+    size_t mDiskHitCount;
+    size_t mMissCount;
 };
 
 }  // namespace rx
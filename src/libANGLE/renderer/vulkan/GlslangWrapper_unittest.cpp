@@ -0,0 +1,173 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// GlslangWrapper_unittest.cpp: Unit tests for the memory and disk caches of the SPIR-V that
+//   GlslangWrapper compiles.
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <sstream>
+
+#include "libANGLE/renderer/vulkan/GlslangWrapper.h"
+
+namespace rx
+{
+
+namespace
+{
+
+const char *kVertexSource = R"(#version 450 core
+layout(location = 0) in vec4 position;
+void main()
+{
+    gl_Position = position;
+})";
+
+const char *kFragmentSource = R"(#version 450 core
+layout(location = 0) out vec4 color;
+void main()
+{
+    color = vec4(0.0, 1.0, 0.0, 1.0);
+})";
+
+}  // anonymous namespace
+
+class GlslangWrapperTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        mGlslangWrapper = GlslangWrapper::GetReference();
+
+        // Start from an empty memory cache, whatever ANGLE_SPIRV_CACHE_DIR is set to.
+        mGlslangWrapper->setSpirvCacheDirectory("");
+        mGlslangWrapper->clearSpirvCache();
+
+        // Each test run uses sources of its own, so that the disk cache doesn't see entries of
+        // earlier runs.
+        std::ostringstream sourceSuffix;
+        sourceSuffix << "\n// " << std::random_device()() << "\n";
+        mVertexSource   = std::string(kVertexSource) + sourceSuffix.str();
+        mFragmentSource = std::string(kFragmentSource) + sourceSuffix.str();
+    }
+
+    void TearDown() override
+    {
+        mGlslangWrapper->setSpirvCacheDirectory("");
+        mGlslangWrapper->clearSpirvCache();
+        GlslangWrapper::ReleaseReference();
+    }
+
+    bool compile(std::vector<uint32_t> *vertexCodeOut, std::vector<uint32_t> *fragmentCodeOut)
+    {
+        gl::LinkResult result = mGlslangWrapper->compileToSpirv(mVertexSource, mFragmentSource,
+                                                                vertexCodeOut, fragmentCodeOut);
+        return !result.isError() && result.getResult();
+    }
+
+    std::string getDiskCachePath() const
+    {
+        GlslangWrapper::SpirvHash spirvHash;
+        GlslangWrapper::ComputeSpirvHash(mVertexSource, mFragmentSource, &spirvHash);
+        return mGlslangWrapper->mDiskCache.getPath(spirvHash);
+    }
+
+    GlslangWrapper *mGlslangWrapper;
+    std::string mVertexSource;
+    std::string mFragmentSource;
+};
+
+// Test that the second compile of the same sources is a memory hit that gives the same SPIR-V, and
+// that clearing the cache resets the counters.
+TEST_F(GlslangWrapperTest, MemoryHitsAndMisses)
+{
+    std::vector<uint32_t> vertexCode;
+    std::vector<uint32_t> fragmentCode;
+    ASSERT_TRUE(compile(&vertexCode, &fragmentCode));
+    EXPECT_FALSE(vertexCode.empty());
+    EXPECT_FALSE(fragmentCode.empty());
+    EXPECT_EQ(0u, mGlslangWrapper->getSpirvCacheMemoryHitCount());
+    EXPECT_EQ(1u, mGlslangWrapper->getSpirvCacheMissCount());
+
+    std::vector<uint32_t> cachedVertexCode;
+    std::vector<uint32_t> cachedFragmentCode;
+    ASSERT_TRUE(compile(&cachedVertexCode, &cachedFragmentCode));
+    EXPECT_EQ(vertexCode, cachedVertexCode);
+    EXPECT_EQ(fragmentCode, cachedFragmentCode);
+    EXPECT_EQ(1u, mGlslangWrapper->getSpirvCacheMemoryHitCount());
+    EXPECT_EQ(0u, mGlslangWrapper->getSpirvCacheDiskHitCount());
+    EXPECT_EQ(1u, mGlslangWrapper->getSpirvCacheMissCount());
+
+    mGlslangWrapper->clearSpirvCache();
+    EXPECT_EQ(0u, mGlslangWrapper->getSpirvCacheMemoryHitCount());
+    EXPECT_EQ(0u, mGlslangWrapper->getSpirvCacheMissCount());
+    ASSERT_TRUE(compile(&cachedVertexCode, &cachedFragmentCode));
+    EXPECT_EQ(1u, mGlslangWrapper->getSpirvCacheMissCount());
+}
+
+// Test that failed compiles aren't cached.
+TEST_F(GlslangWrapperTest, ErrorsAreNotCached)
+{
+    mFragmentSource = "#version 450 core\nvoid main() { undefined = 1; }";
+
+    std::vector<uint32_t> vertexCode;
+    std::vector<uint32_t> fragmentCode;
+    EXPECT_FALSE(compile(&vertexCode, &fragmentCode));
+    EXPECT_FALSE(compile(&vertexCode, &fragmentCode));
+    EXPECT_EQ(0u, mGlslangWrapper->getSpirvCacheMemoryHitCount());
+    EXPECT_EQ(2u, mGlslangWrapper->getSpirvCacheMissCount());
+}
+
+// Test that SPIR-V stored on disk is found after the memory cache is emptied, and that corrupt
+// entries on disk are treated as misses and replaced.
+TEST_F(GlslangWrapperTest, DiskCache)
+{
+    std::string directory = testing::TempDir();
+    if (!directory.empty() && (directory.back() == '/' || directory.back() == '\\'))
+    {
+        directory.pop_back();
+    }
+    mGlslangWrapper->setSpirvCacheDirectory(directory);
+    std::string path = getDiskCachePath();
+
+    std::vector<uint32_t> vertexCode;
+    std::vector<uint32_t> fragmentCode;
+    ASSERT_TRUE(compile(&vertexCode, &fragmentCode));
+    EXPECT_TRUE(std::ifstream(path).good());
+
+    // Emptying the memory cache, as in a later run, loads the SPIR-V from disk.
+    mGlslangWrapper->clearSpirvCache();
+    std::vector<uint32_t> cachedVertexCode;
+    std::vector<uint32_t> cachedFragmentCode;
+    ASSERT_TRUE(compile(&cachedVertexCode, &cachedFragmentCode));
+    EXPECT_EQ(vertexCode, cachedVertexCode);
+    EXPECT_EQ(fragmentCode, cachedFragmentCode);
+    EXPECT_EQ(1u, mGlslangWrapper->getSpirvCacheDiskHitCount());
+    EXPECT_EQ(0u, mGlslangWrapper->getSpirvCacheMissCount());
+
+    // Overwrite the entry with garbage.
+    {
+        std::ofstream corruptFile(path, std::ios::out | std::ios::binary | std::ios::trunc);
+        corruptFile << "not SPIR-V";
+    }
+    mGlslangWrapper->clearSpirvCache();
+    ASSERT_TRUE(compile(&cachedVertexCode, &cachedFragmentCode));
+    EXPECT_EQ(vertexCode, cachedVertexCode);
+    EXPECT_EQ(fragmentCode, cachedFragmentCode);
+    EXPECT_EQ(0u, mGlslangWrapper->getSpirvCacheDiskHitCount());
+    EXPECT_EQ(1u, mGlslangWrapper->getSpirvCacheMissCount());
+
+    // The compile stored a valid entry again.
+    mGlslangWrapper->clearSpirvCache();
+    ASSERT_TRUE(compile(&cachedVertexCode, &cachedFragmentCode));
+    EXPECT_EQ(1u, mGlslangWrapper->getSpirvCacheDiskHitCount());
+
+    std::remove(path.c_str());
+}
+
+}  // namespace rx
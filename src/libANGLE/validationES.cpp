@@ -72,6 +72,24 @@ bool ValidateDrawAttribs(ValidationContext *context,
                          GLint maxVertex,
                          GLint vertexCount)
 {
+    // ValidateDrawBase has validated the states of the attributes and computed the largest vertex
+    // and instance that they have data for. The attributes are only looked at again to find which
+    // one has too little data.
+    if (context->hasValidatedDrawStates())
+    {
+        // If we're drawing zero vertices, we have enough data.
+        if (vertexCount <= 0 || primcount <= 0)
+        {
+            return true;
+        }
+
+        if (maxVertex <= context->getNonInstancedVertexElementLimit() &&
+            primcount - 1 <= context->getInstancedVertexElementLimit())
+        {
+            return true;
+        }
+    }
+
     const gl::State &state     = context->getGLState();
     const gl::Program *program = state.getProgram();
 
@@ -493,6 +511,278 @@ bool ValidateVertexShaderAttributeTypeMatch(ValidationContext *context)
     return true;
 }
 
+// The checks of ValidateDrawBase that depend on the state in ways that don't reach the draw states
+// cache, like the bindings of the uniform buffers and the active queries. They are cheap.
+bool ValidateUncachedDrawStates(ValidationContext *context)
+{
+    const State &state           = context->getGLState();
+    const Extensions &extensions = context->getExtensions();
+    Framebuffer *framebuffer     = state.getDrawFramebuffer();
+
+    if (framebuffer->checkStatus(context) != GL_FRAMEBUFFER_COMPLETE)
+    {
+        context->handleError(InvalidFramebufferOperation());
+        return false;
+    }
+
+    gl::Program *program = state.getProgram();
+    if (!program)
+    {
+        ANGLE_VALIDATION_ERR(context, InvalidOperation(), ProgramNotBound);
+        return false;
+    }
+
+    // In OpenGL ES spec for UseProgram at section 7.3, trying to render without
+    // vertex shader stage or fragment shader stage is a undefined behaviour.
+    // But ANGLE should clearly generate an INVALID_OPERATION error instead of
+    // produce undefined result.
+    if (!program->hasLinkedVertexShader() || !program->hasLinkedFragmentShader())
+    {
+        context->handleError(InvalidOperation() << "It is a undefined behaviour to render without "
+                                                   "vertex shader stage or fragment shader stage.");
+        return false;
+    }
+
+    if (!program->validateSamplers(nullptr, context->getCaps()))
+    {
+        context->handleError(InvalidOperation());
+        return false;
+    }
+
+    if (extensions.multiview)
+    {
+        const int programNumViews     = program->usesMultiview() ? program->getNumViews() : 1;
+        const int framebufferNumViews = framebuffer->getNumViews();
+        if (framebufferNumViews != programNumViews)
+        {
+            context->handleError(InvalidOperation() << "The number of views in the active program "
+                                                       "and draw framebuffer does not match.");
+            return false;
+        }
+
+        const TransformFeedback *transformFeedbackObject = state.getCurrentTransformFeedback();
+        if (transformFeedbackObject != nullptr && transformFeedbackObject->isActive() &&
+            framebufferNumViews > 1)
+        {
+            context->handleError(InvalidOperation()
+                                 << "There is an active transform feedback object "
+                                    "when the number of views in the active draw "
+                                    "framebuffer is greater than 1.");
+            return false;
+        }
+
+        if (extensions.disjointTimerQuery && framebufferNumViews > 1 &&
+            state.isQueryActive(GL_TIME_ELAPSED_EXT))
+        {
+            context->handleError(InvalidOperation() << "There is an active query for target "
+                                                       "GL_TIME_ELAPSED_EXT when the number of "
+                                                       "views in the active draw framebuffer is "
+                                                       "greater than 1.");
+            return false;
+        }
+    }
+
+    // Uniform buffer validation
+    for (unsigned int uniformBlockIndex = 0;
+         uniformBlockIndex < program->getActiveUniformBlockCount(); uniformBlockIndex++)
+    {
+        const gl::InterfaceBlock &uniformBlock = program->getUniformBlockByIndex(uniformBlockIndex);
+        GLuint blockBinding                  = program->getUniformBlockBinding(uniformBlockIndex);
+        const OffsetBindingPointer<Buffer> &uniformBuffer =
+            state.getIndexedUniformBuffer(blockBinding);
+
+        if (uniformBuffer.get() == nullptr)
+        {
+            // undefined behaviour
+            context->handleError(
+                InvalidOperation()
+                << "It is undefined behaviour to have a used but unbound uniform buffer.");
+            return false;
+        }
+
+        size_t uniformBufferSize = uniformBuffer.getSize();
+        if (uniformBufferSize == 0)
+        {
+            // Bind the whole buffer.
+            uniformBufferSize = static_cast<size_t>(uniformBuffer->getSize());
+        }
+
+        if (uniformBufferSize < uniformBlock.dataSize)
+        {
+            // undefined behaviour
+            context->handleError(
+                InvalidOperation()
+                << "It is undefined behaviour to use a uniform buffer that is too small.");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// All of the checks of ValidateDrawBase that don't depend on the draw call parameters.
+bool ValidateDrawStates(ValidationContext *context)
+{
+    const State &state           = context->getGLState();
+    const Extensions &extensions = context->getExtensions();
+    Framebuffer *framebuffer     = state.getDrawFramebuffer();
+
+    // WebGL buffers cannot be mapped/unmapped because the MapBufferRange, FlushMappedBufferRange,
+    // and UnmapBuffer entry points are removed from the WebGL 2.0 API.
+    // https://www.khronos.org/registry/webgl/specs/latest/2.0/#5.14
+    if (!extensions.webglCompatibility)
+    {
+        // Check for mapped buffers
+        // TODO(jmadill): Optimize this check for non - WebGL contexts.
+        if (state.hasMappedBuffer(BufferBinding::Array))
+        {
+            context->handleError(InvalidOperation());
+            return false;
+        }
+    }
+
+    // Note: these separate values are not supported in WebGL, due to D3D's limitations. See
+    // Section 6.10 of the WebGL 1.0 spec.
+    if (context->getLimitations().noSeparateStencilRefsAndMasks || extensions.webglCompatibility)
+    {
+        const FramebufferAttachment *dsAttachment =
+            framebuffer->getStencilOrDepthStencilAttachment();
+        GLuint stencilBits                = dsAttachment ? dsAttachment->getStencilSize() : 0;
+        GLuint minimumRequiredStencilMask = (1 << stencilBits) - 1;
+        const DepthStencilState &depthStencilState = state.getDepthStencilState();
+
+        bool differentRefs = state.getStencilRef() != state.getStencilBackRef();
+        bool differentWritemasks =
+            (depthStencilState.stencilWritemask & minimumRequiredStencilMask) !=
+            (depthStencilState.stencilBackWritemask & minimumRequiredStencilMask);
+        bool differentMasks = (depthStencilState.stencilMask & minimumRequiredStencilMask) !=
+                              (depthStencilState.stencilBackMask & minimumRequiredStencilMask);
+
+        if (differentRefs || differentWritemasks || differentMasks)
+        {
+            if (!extensions.webglCompatibility)
+            {
+                ERR() << "This ANGLE implementation does not support separate front/back stencil "
+                         "writemasks, reference values, or stencil mask values.";
+            }
+            ANGLE_VALIDATION_ERR(context, InvalidOperation(), StencilReferenceMaskOrMismatch);
+            return false;
+        }
+    }
+
+    if (!ValidateUncachedDrawStates(context))
+    {
+        return false;
+    }
+
+    // Do some additonal WebGL-specific validation
+    if (extensions.webglCompatibility)
+    {
+        // Detect rendering feedback loops for WebGL.
+        if (framebuffer->formsRenderingFeedbackLoopWith(state))
+        {
+            ANGLE_VALIDATION_ERR(context, InvalidOperation(), FeedbackLoop);
+            return false;
+        }
+
+        // Detect that the vertex shader input types match the attribute types
+        if (!ValidateVertexShaderAttributeTypeMatch(context))
+        {
+            return false;
+        }
+
+        // Detect that the color buffer types match the fragment shader output types
+        if (!ValidateFragmentShaderColorBufferTypeMatch(context))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Computes the largest vertex and instance that the vertex buffers of the active attributes have
+// data for, so that ValidateDrawAttribs only needs to compare them with the vertex and instance
+// counts. Returns false when an enabled attribute has neither a buffer nor a client array, which
+// ValidateDrawAttribs reports for every draw call.
+bool ComputeVertexElementLimits(const ValidationContext *context,
+                                GLint64 *nonInstancedLimitOut,
+                                GLint64 *instancedLimitOut)
+{
+    constexpr GLint64 kInt64Max = std::numeric_limits<GLint64>::max();
+
+    const State &state     = context->getGLState();
+    const Program *program = state.getProgram();
+
+    bool webglCompatibility = context->getExtensions().webglCompatibility;
+
+    *nonInstancedLimitOut = kInt64Max;
+    *instancedLimitOut    = kInt64Max;
+
+    const VertexArray *vao     = state.getVertexArray();
+    const auto &vertexAttribs  = vao->getVertexAttributes();
+    const auto &vertexBindings = vao->getVertexBindings();
+    for (size_t attributeIndex : vao->getEnabledAttributesMask())
+    {
+        const VertexAttribute &attrib = vertexAttribs[attributeIndex];
+        if (!attrib.enabled)
+        {
+            continue;
+        }
+
+        const VertexBinding &binding = vertexBindings[attrib.bindingIndex];
+        const Buffer *buffer         = binding.getBuffer().get();
+        if (!buffer)
+        {
+            if (webglCompatibility || !state.areClientArraysEnabled() || attrib.pointer == nullptr)
+            {
+                return false;
+            }
+            continue;
+        }
+
+        if (!program->isAttribLocationActive(attributeIndex))
+        {
+            continue;
+        }
+
+        // The last element doesn't take the full stride.
+        uint64_t attribStride = ComputeVertexAttributeStride(attrib, binding);
+        uint64_t attribSize   = ComputeVertexAttributeTypeSize(attrib);
+        uint64_t attribOffset = ComputeVertexAttributeOffset(attrib, binding);
+        uint64_t bufferSize   = static_cast<uint64_t>(buffer->getSize());
+
+        GLint64 elementLimit = -1;
+        if (attribOffset <= bufferSize && attribSize <= bufferSize - attribOffset)
+        {
+            uint64_t lastElementOffset = bufferSize - attribOffset - attribSize;
+            elementLimit               = kInt64Max;
+            if (attribStride > 0)
+            {
+                elementLimit = static_cast<GLint64>(lastElementOffset / attribStride);
+            }
+        }
+
+        GLuint divisor = binding.getDivisor();
+        if (divisor == 0)
+        {
+            *nonInstancedLimitOut = std::min(*nonInstancedLimitOut, elementLimit);
+        }
+        else
+        {
+            // Instances [e * divisor, (e + 1) * divisor) read the element e.
+            GLint64 instanceLimit = kInt64Max;
+            if (elementLimit < kInt64Max / divisor)
+            {
+                instanceLimit = (elementLimit + 1) * divisor - 1;
+            }
+            *instancedLimitOut = std::min(*instancedLimitOut, instanceLimit);
+        }
+    }
+
+    return true;
+}
+
 }  // anonymous namespace
 
 bool IsETC2EACFormat(const GLenum format)
@@ -1013,13 +1303,23 @@ bool ValidateWebGLVertexAttribPointer(ValidationContext *context,
 }
 
 Program *GetValidProgram(ValidationContext *context, GLuint id)
+{
+    Program *validProgram = GetValidProgramNoResolveLink(context, id);
+    if (validProgram)
+    {
+        validProgram->resolveLink();
+    }
+    return validProgram;
+}
+
+Program *GetValidProgramNoResolveLink(ValidationContext *context, GLuint id)
 {
     // ES3 spec (section 2.11.1) -- "Commands that accept shader or program object names will
     // generate the error INVALID_VALUE if the provided name is not the name of either a shader
     // or program object and INVALID_OPERATION if the provided name identifies an object
     // that is not the expected type."
 
-    Program *validProgram = context->getProgram(id);
+    Program *validProgram = context->getProgramNoResolveLink(id);
 
     if (!validProgram)
     {
@@ -2476,173 +2776,24 @@ bool ValidateDrawBase(ValidationContext *context, GLenum mode, GLsizei count)
         return false;
     }
 
-    const State &state = context->getGLState();
-
-    const Extensions &extensions = context->getExtensions();
-
-    // WebGL buffers cannot be mapped/unmapped because the MapBufferRange, FlushMappedBufferRange,
-    // and UnmapBuffer entry points are removed from the WebGL 2.0 API.
-    // https://www.khronos.org/registry/webgl/specs/latest/2.0/#5.14
-    if (!extensions.webglCompatibility)
+    // The checks that only depend on the state are cached until the state changes.
+    if (!context->needsDrawStatesValidation())
     {
-        // Check for mapped buffers
-        // TODO(jmadill): Optimize this check for non - WebGL contexts.
-        if (state.hasMappedBuffer(BufferBinding::Array))
-        {
-            context->handleError(InvalidOperation());
-            return false;
-        }
-    }
-
-    // Note: these separate values are not supported in WebGL, due to D3D's limitations. See
-    // Section 6.10 of the WebGL 1.0 spec.
-    Framebuffer *framebuffer = state.getDrawFramebuffer();
-    if (context->getLimitations().noSeparateStencilRefsAndMasks || extensions.webglCompatibility)
-    {
-        const FramebufferAttachment *dsAttachment =
-            framebuffer->getStencilOrDepthStencilAttachment();
-        GLuint stencilBits                = dsAttachment ? dsAttachment->getStencilSize() : 0;
-        GLuint minimumRequiredStencilMask = (1 << stencilBits) - 1;
-        const DepthStencilState &depthStencilState = state.getDepthStencilState();
-
-        bool differentRefs = state.getStencilRef() != state.getStencilBackRef();
-        bool differentWritemasks =
-            (depthStencilState.stencilWritemask & minimumRequiredStencilMask) !=
-            (depthStencilState.stencilBackWritemask & minimumRequiredStencilMask);
-        bool differentMasks = (depthStencilState.stencilMask & minimumRequiredStencilMask) !=
-                              (depthStencilState.stencilBackMask & minimumRequiredStencilMask);
-
-        if (differentRefs || differentWritemasks || differentMasks)
-        {
-            if (!extensions.webglCompatibility)
-            {
-                ERR() << "This ANGLE implementation does not support separate front/back stencil "
-                         "writemasks, reference values, or stencil mask values.";
-            }
-            ANGLE_VALIDATION_ERR(context, InvalidOperation(), StencilReferenceMaskOrMismatch);
-            return false;
-        }
-    }
-
-    if (framebuffer->checkStatus(context) != GL_FRAMEBUFFER_COMPLETE)
-    {
-        context->handleError(InvalidFramebufferOperation());
-        return false;
-    }
-
-    gl::Program *program = state.getProgram();
-    if (!program)
-    {
-        ANGLE_VALIDATION_ERR(context, InvalidOperation(), ProgramNotBound);
-        return false;
-    }
-
-    // In OpenGL ES spec for UseProgram at section 7.3, trying to render without
-    // vertex shader stage or fragment shader stage is a undefined behaviour.
-    // But ANGLE should clearly generate an INVALID_OPERATION error instead of
-    // produce undefined result.
-    if (!program->hasLinkedVertexShader() || !program->hasLinkedFragmentShader())
-    {
-        context->handleError(InvalidOperation() << "It is a undefined behaviour to render without "
-                                                   "vertex shader stage or fragment shader stage.");
-        return false;
+        return ValidateUncachedDrawStates(context);
     }
 
-    if (!program->validateSamplers(nullptr, context->getCaps()))
+    context->invalidateDrawStates();
+    if (!ValidateDrawStates(context))
     {
-        context->handleError(InvalidOperation());
         return false;
     }
 
-    if (extensions.multiview)
+    GLint64 nonInstancedVertexElementLimit = 0;
+    GLint64 instancedVertexElementLimit    = 0;
+    if (ComputeVertexElementLimits(context, &nonInstancedVertexElementLimit,
+                                   &instancedVertexElementLimit))
     {
-        const int programNumViews     = program->usesMultiview() ? program->getNumViews() : 1;
-        const int framebufferNumViews = framebuffer->getNumViews();
-        if (framebufferNumViews != programNumViews)
-        {
-            context->handleError(InvalidOperation() << "The number of views in the active program "
-                                                       "and draw framebuffer does not match.");
-            return false;
-        }
-
-        const TransformFeedback *transformFeedbackObject = state.getCurrentTransformFeedback();
-        if (transformFeedbackObject != nullptr && transformFeedbackObject->isActive() &&
-            framebufferNumViews > 1)
-        {
-            context->handleError(InvalidOperation()
-                                 << "There is an active transform feedback object "
-                                    "when the number of views in the active draw "
-                                    "framebuffer is greater than 1.");
-            return false;
-        }
-
-        if (extensions.disjointTimerQuery && framebufferNumViews > 1 &&
-            state.isQueryActive(GL_TIME_ELAPSED_EXT))
-        {
-            context->handleError(InvalidOperation() << "There is an active query for target "
-                                                       "GL_TIME_ELAPSED_EXT when the number of "
-                                                       "views in the active draw framebuffer is "
-                                                       "greater than 1.");
-            return false;
-        }
-    }
-
-    // Uniform buffer validation
-    for (unsigned int uniformBlockIndex = 0;
-         uniformBlockIndex < program->getActiveUniformBlockCount(); uniformBlockIndex++)
-    {
-        const gl::InterfaceBlock &uniformBlock = program->getUniformBlockByIndex(uniformBlockIndex);
-        GLuint blockBinding                  = program->getUniformBlockBinding(uniformBlockIndex);
-        const OffsetBindingPointer<Buffer> &uniformBuffer =
-            state.getIndexedUniformBuffer(blockBinding);
-
-        if (uniformBuffer.get() == nullptr)
-        {
-            // undefined behaviour
-            context->handleError(
-                InvalidOperation()
-                << "It is undefined behaviour to have a used but unbound uniform buffer.");
-            return false;
-        }
-
-        size_t uniformBufferSize = uniformBuffer.getSize();
-        if (uniformBufferSize == 0)
-        {
-            // Bind the whole buffer.
-            uniformBufferSize = static_cast<size_t>(uniformBuffer->getSize());
-        }
-
-        if (uniformBufferSize < uniformBlock.dataSize)
-        {
-            // undefined behaviour
-            context->handleError(
-                InvalidOperation()
-                << "It is undefined behaviour to use a uniform buffer that is too small.");
-            return false;
-        }
-    }
-
-    // Do some additonal WebGL-specific validation
-    if (extensions.webglCompatibility)
-    {
-        // Detect rendering feedback loops for WebGL.
-        if (framebuffer->formsRenderingFeedbackLoopWith(state))
-        {
-            ANGLE_VALIDATION_ERR(context, InvalidOperation(), FeedbackLoop);
-            return false;
-        }
-
-        // Detect that the vertex shader input types match the attribute types
-        if (!ValidateVertexShaderAttributeTypeMatch(context))
-        {
-            return false;
-        }
-
-        // Detect that the color buffer types match the fragment shader output types
-        if (!ValidateFragmentShaderColorBufferTypeMatch(context))
-        {
-            return false;
-        }
+        context->onDrawStatesValidated(nonInstancedVertexElementLimit, instancedVertexElementLimit);
     }
 
     return true;
@@ -4118,7 +4269,10 @@ bool ValidateGetProgramivBase(ValidationContext *context,
         *numParams = 1;
     }
 
-    Program *programObject = GetValidProgram(context, program);
+    // Asking whether the link has finished mustn't wait for it.
+    Program *programObject = (pname == GL_COMPLETION_STATUS_KHR)
+                                 ? GetValidProgramNoResolveLink(context, program)
+                                 : GetValidProgram(context, program);
     if (!programObject)
     {
         return false;
@@ -4137,6 +4291,14 @@ bool ValidateGetProgramivBase(ValidationContext *context,
         case GL_ACTIVE_UNIFORM_MAX_LENGTH:
             break;
 
+        case GL_COMPLETION_STATUS_KHR:
+            if (!context->getExtensions().parallelShaderCompile)
+            {
+                ANGLE_VALIDATION_ERR(context, InvalidEnum(), ExtensionNotEnabled);
+                return false;
+            }
+            break;
+
         case GL_PROGRAM_BINARY_LENGTH:
             if (context->getClientMajorVersion() < 3 && !context->getExtensions().getProgramBinary)
             {
@@ -4911,6 +5073,14 @@ bool ValidateGetShaderivBase(Context *context, GLuint shader, GLenum pname, GLsi
         case GL_SHADER_SOURCE_LENGTH:
             break;
 
+        case GL_COMPLETION_STATUS_KHR:
+            if (!context->getExtensions().parallelShaderCompile)
+            {
+                ANGLE_VALIDATION_ERR(context, InvalidEnum(), ExtensionNotEnabled);
+                return false;
+            }
+            break;
+
         case GL_TRANSLATED_SHADER_SOURCE_LENGTH_ANGLE:
             if (!context->getExtensions().translatedShaderSource)
             {
@@ -114,7 +114,7 @@ EGLBoolean EGLAPIENTRY Terminate(EGLDisplay dpy)
 
     if (display->isValidContext(thread->getContext()))
     {
-        thread->setCurrent(nullptr);
+        SetContextCurrent(thread, nullptr);
     }
 
     Error error = display->terminate();
@@ -467,7 +467,7 @@ EGLBoolean EGLAPIENTRY DestroyContext(EGLDisplay dpy, EGLContext ctx)
 
     if (context == thread->getContext())
     {
-        thread->setCurrent(nullptr);
+        SetContextCurrent(thread, nullptr);
     }
 
     error = display->destroyContext(context);
@@ -509,7 +509,7 @@ EGLBoolean EGLAPIENTRY MakeCurrent(EGLDisplay dpy, EGLSurface draw, EGLSurface r
     }
 
     gl::Context *previousContext = thread->getContext();
-    thread->setCurrent(context);
+    SetContextCurrent(thread, context);
 
     // Release the surface from the previously-current context, to allow
     // destroyed surfaces to delete themselves.
@@ -701,6 +701,22 @@ ANGLE_EXPORT void GL_APIENTRY RequestExtensionANGLE(const GLchar *name)
     }
 }
 
+ANGLE_EXPORT void GL_APIENTRY MaxShaderCompilerThreadsKHR(GLuint count)
+{
+    EVENT("(GLuint count = %u)", count);
+
+    Context *context = GetValidGlobalContext();
+    if (context)
+    {
+        if (!context->skipValidation() && !ValidateMaxShaderCompilerThreadsKHR(context, count))
+        {
+            return;
+        }
+
+        context->maxShaderCompilerThreads(count);
+    }
+}
+
 ANGLE_EXPORT void GL_APIENTRY GetBooleanvRobustANGLE(GLenum pname,
                                                      GLsizei bufSize,
                                                      GLsizei *length,
@@ -12,19 +12,55 @@
 #include "common/platform.h"
 #include "common/tls.h"
 
+#include "libANGLE/Context.h"
 #include "libANGLE/Thread.h"
 
+#if defined(ANGLE_PLATFORM_POSIX)
+namespace
+{
+
+// The initial-exec model reads the variable at a fixed offset from the thread pointer instead of
+// calling __tls_get_addr. glibc keeps some static TLS space for libraries loaded with dlopen, but
+// Android doesn't allow this model in them.
+#if defined(ANGLE_PLATFORM_LINUX) && defined(__GLIBC__)
+#define ANGLE_INITIAL_EXEC_TLS __attribute__((tls_model("initial-exec")))
+#else
+#define ANGLE_INITIAL_EXEC_TLS
+#endif
+
+// The context of the egl::Thread of the calling thread, so that the GL entry points don't need to
+// look the egl::Thread up through pthread_getspecific.
+ANGLE_INITIAL_EXEC_TLS thread_local gl::Context *gCurrentContext = nullptr;
+
+#undef ANGLE_INITIAL_EXEC_TLS
+
+}  // anonymous namespace
+#endif  // defined(ANGLE_PLATFORM_POSIX)
+
 namespace gl
 {
 
 Context *GetGlobalContext()
 {
+#if defined(ANGLE_PLATFORM_POSIX)
+    return gCurrentContext;
+#else
     egl::Thread *thread = egl::GetCurrentThread();
     return thread->getContext();
+#endif  // defined(ANGLE_PLATFORM_POSIX)
 }
 
 Context *GetValidGlobalContext()
 {
+#if defined(ANGLE_PLATFORM_POSIX)
+    // A lost context can't be cached as invalid, since contexts may be lost from any thread.
+    Context *context = gCurrentContext;
+    if (context == nullptr || !context->isContextLost())
+    {
+        return context;
+    }
+#endif  // defined(ANGLE_PLATFORM_POSIX)
+
     egl::Thread *thread = egl::GetCurrentThread();
     return thread->getValidContext();
 }
@@ -39,6 +75,11 @@ namespace
 
 static TLSIndex threadTLS = TLS_INVALID_INDEX;
 
+void DeallocateThread(void *thread)
+{
+    delete static_cast<Thread *>(thread);
+}
+
 Thread *AllocateCurrentThread()
 {
     ASSERT(threadTLS != TLS_INVALID_INDEX);
@@ -64,7 +105,7 @@ Thread *GetCurrentThread()
     // Create a TLS index if one has not been created for this DLL
     if (threadTLS == TLS_INVALID_INDEX)
     {
-        threadTLS = CreateTLSIndex();
+        threadTLS = CreateTLSIndex(DeallocateThread);
     }
 
     Thread *current = static_cast<Thread *>(GetTLSValue(threadTLS));
@@ -74,6 +115,15 @@ Thread *GetCurrentThread()
     return (current ? current : AllocateCurrentThread());
 }
 
+void SetContextCurrent(Thread *thread, gl::Context *context)
+{
+    ASSERT(thread == GetCurrentThread());
+    thread->setCurrent(context);
+#if defined(ANGLE_PLATFORM_POSIX)
+    gCurrentContext = context;
+#endif  // defined(ANGLE_PLATFORM_POSIX)
+}
+
 }  // namespace egl
 
 #ifdef ANGLE_PLATFORM_WINDOWS
@@ -92,7 +142,7 @@ bool DeallocateCurrentThread()
 
 bool InitializeProcess()
 {
-    threadTLS = CreateTLSIndex();
+    threadTLS = CreateTLSIndex(DeallocateThread);
     if (threadTLS == TLS_INVALID_INDEX)
     {
         return false;
@@ -24,6 +24,10 @@ class Thread;
 
 Thread *GetCurrentThread();
 
+// |thread| must be the Thread of the calling thread. Use this rather than Thread::setCurrent, so
+// that the GL entry points find the new context.
+void SetContextCurrent(Thread *thread, gl::Context *context);
+
 }  // namespace egl
 
 #endif // LIBGLESV2_GLOBALSTATE_H_
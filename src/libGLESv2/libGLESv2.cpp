@@ -2576,4 +2576,9 @@ void GL_APIENTRY glRequestExtensionANGLE(const GLchar *name)
     gl::RequestExtensionANGLE(name);
 }
 
+void GL_APIENTRY glMaxShaderCompilerThreadsKHR(GLuint count)
+{
+    gl::MaxShaderCompilerThreadsKHR(count);
+}
+
 }  // extern "C"
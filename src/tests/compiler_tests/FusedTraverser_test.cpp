@@ -0,0 +1,281 @@
+//
+// Copyright (c) 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FusedTraverser_test.cpp:
+//   Tests that traversers fused into a single traversal see the same visits as when they're run
+//   separately, and that the tree updates they queue are all applied.
+//
+
+#include <sstream>
+
+#include "GLSLANG/ShaderLang.h"
+#include "angle_gl.h"
+#include "compiler/translator/FusedTraverser.h"
+#include "compiler/translator/IntermNode_util.h"
+#include "gtest/gtest.h"
+#include "tests/test_utils/ShaderCompileTreeTest.h"
+
+using namespace sh;
+
+namespace
+{
+
+// Decides which visits a recording traverser returns false from.
+enum class StopPolicy
+{
+    Never,
+    PreVisitAssignments,
+    InVisitBlocks,
+    PreVisitIfElse
+};
+
+class VisitRecordingTraverser : public TIntermTraverser
+{
+  public:
+    VisitRecordingTraverser(bool preVisit,
+                            bool inVisit,
+                            bool postVisit,
+                            StopPolicy policy,
+                            std::vector<std::string> *log)
+        : TIntermTraverser(preVisit, inVisit, postVisit), mPolicy(policy), mLog(log)
+    {
+    }
+
+    void visitSymbol(TIntermSymbol *node) override { record(PreVisit, "symbol"); }
+    void visitConstantUnion(TIntermConstantUnion *node) override { record(PreVisit, "constant"); }
+    bool visitSwizzle(Visit visit, TIntermSwizzle *node) override
+    {
+        return record(visit, "swizzle");
+    }
+    bool visitBinary(Visit visit, TIntermBinary *node) override
+    {
+        return record(visit, "binary") &&
+               !(mPolicy == StopPolicy::PreVisitAssignments && visit == PreVisit &&
+                 node->isAssignment());
+    }
+    bool visitUnary(Visit visit, TIntermUnary *node) override { return record(visit, "unary"); }
+    bool visitTernary(Visit visit, TIntermTernary *node) override
+    {
+        return record(visit, "ternary");
+    }
+    bool visitIfElse(Visit visit, TIntermIfElse *node) override
+    {
+        return record(visit, "ifelse") &&
+               !(mPolicy == StopPolicy::PreVisitIfElse && visit == PreVisit);
+    }
+    bool visitSwitch(Visit visit, TIntermSwitch *node) override { return record(visit, "switch"); }
+    bool visitCase(Visit visit, TIntermCase *node) override { return record(visit, "case"); }
+    bool visitFunctionPrototype(Visit visit, TIntermFunctionPrototype *node) override
+    {
+        return record(visit, "prototype");
+    }
+    bool visitFunctionDefinition(Visit visit, TIntermFunctionDefinition *node) override
+    {
+        return record(visit, "function");
+    }
+    bool visitAggregate(Visit visit, TIntermAggregate *node) override
+    {
+        return record(visit, "aggregate");
+    }
+    bool visitBlock(Visit visit, TIntermBlock *node) override
+    {
+        return record(visit, "block") &&
+               !(mPolicy == StopPolicy::InVisitBlocks && visit == InVisit);
+    }
+    bool visitDeclaration(Visit visit, TIntermDeclaration *node) override
+    {
+        return record(visit, "declaration");
+    }
+    bool visitLoop(Visit visit, TIntermLoop *node) override { return record(visit, "loop"); }
+    bool visitBranch(Visit visit, TIntermBranch *node) override { return record(visit, "branch"); }
+
+  private:
+    bool record(Visit visit, const char *nodeKind)
+    {
+        std::stringstream entry;
+        entry << visit << " " << nodeKind << " depth " << mDepth << " parent " << getParentNode()
+              << (mInGlobalScope ? " global" : " local");
+        mLog->push_back(entry.str());
+        return true;
+    }
+
+    StopPolicy mPolicy;
+    std::vector<std::string> *mLog;
+};
+
+// Replaces the int constant "from" with the constant "to".
+class ReplaceIntConstantTraverser : public TIntermTraverser
+{
+  public:
+    ReplaceIntConstantTraverser(int from, int to)
+        : TIntermTraverser(true, false, false), mFrom(from), mTo(to)
+    {
+    }
+
+    void visitConstantUnion(TIntermConstantUnion *node) override
+    {
+        if (node->getBasicType() == EbtInt && node->getIConst(0) == mFrom)
+        {
+            queueReplacement(CreateIndexNode(mTo), OriginalNode::IS_DROPPED);
+        }
+    }
+
+  private:
+    int mFrom;
+    int mTo;
+};
+
+class FindIntConstantTraverser : public TIntermTraverser
+{
+  public:
+    FindIntConstantTraverser(int value)
+        : TIntermTraverser(true, false, false), mValue(value), mFound(false)
+    {
+    }
+
+    void visitConstantUnion(TIntermConstantUnion *node) override
+    {
+        if (node->getBasicType() == EbtInt && node->getIConst(0) == mValue)
+        {
+            mFound = true;
+        }
+    }
+
+    bool isFound() const { return mFound; }
+
+  private:
+    int mValue;
+    bool mFound;
+};
+
+class FusedTraverserTest : public ShaderCompileTreeTest
+{
+  public:
+    FusedTraverserTest() {}
+
+  protected:
+    ::GLenum getShaderType() const override { return GL_FRAGMENT_SHADER; }
+    ShShaderSpec getShaderSpec() const override { return SH_GLES3_SPEC; }
+
+    bool containsIntConstant(int value)
+    {
+        FindIntConstantTraverser finder(value);
+        mASTRoot->traverse(&finder);
+        return finder.isFound();
+    }
+};
+
+// Test that each fused traverser sees exactly the same visits as when it's run on its own, also
+// when traversers stop visiting parts of the tree at different points.
+TEST_F(FusedTraverserTest, VisitsMatchSeparateTraversals)
+{
+    const std::string &shaderString =
+        R"(#version 300 es
+        precision mediump float;
+        uniform int u;
+        out vec4 my_FragColor;
+        float f(float a)
+        {
+            return a > 0.5 ? -a : a * 2.0;
+        }
+        void main()
+        {
+            vec4 v = vec4(u);
+            switch (u)
+            {
+                case 0:
+                    v.x = f(v.y);
+                    break;
+                default:
+                    v.yz += vec2(1.0);
+            }
+            for (int i = 0; i < u; ++i)
+            {
+                if (v.x > 0.0)
+                {
+                    v.x -= 1.0;
+                }
+                else
+                {
+                    continue;
+                }
+            }
+            my_FragColor = v;
+        })";
+    compileAssumeSuccess(shaderString);
+
+    struct TraverserParams
+    {
+        bool preVisit;
+        bool inVisit;
+        bool postVisit;
+        StopPolicy policy;
+    };
+    const TraverserParams kParams[] = {
+        {true, true, true, StopPolicy::Never},
+        {true, false, false, StopPolicy::PreVisitAssignments},
+        {true, true, true, StopPolicy::InVisitBlocks},
+        {false, true, true, StopPolicy::PreVisitIfElse},
+        {true, false, true, StopPolicy::PreVisitIfElse},
+    };
+    const size_t kNumTraversers = ArraySize(kParams);
+
+    std::vector<std::vector<std::string>> separateLogs(kNumTraversers);
+    for (size_t i = 0; i < kNumTraversers; ++i)
+    {
+        VisitRecordingTraverser traverser(kParams[i].preVisit, kParams[i].inVisit,
+                                          kParams[i].postVisit, kParams[i].policy,
+                                          &separateLogs[i]);
+        mASTRoot->traverse(&traverser);
+    }
+
+    std::vector<std::vector<std::string>> fusedLogs(kNumTraversers);
+    TFusedTraverser fusedTraverser;
+    for (size_t i = 0; i < kNumTraversers; ++i)
+    {
+        fusedTraverser.addTraverser(std::unique_ptr<TIntermTraverser>(new VisitRecordingTraverser(
+            kParams[i].preVisit, kParams[i].inVisit, kParams[i].postVisit, kParams[i].policy,
+            &fusedLogs[i])));
+    }
+    fusedTraverser.traverseAndUpdateTree(mASTRoot);
+
+    for (size_t i = 0; i < kNumTraversers; ++i)
+    {
+        EXPECT_FALSE(separateLogs[i].empty());
+        EXPECT_EQ(separateLogs[i], fusedLogs[i]) << "traverser " << i;
+    }
+}
+
+// Test that the tree updates queued by all the fused traversers are applied.
+TEST_F(FusedTraverserTest, QueuedUpdatesFromAllTraversersAreApplied)
+{
+    const std::string &shaderString =
+        R"(#version 300 es
+        precision mediump float;
+        uniform int u;
+        out vec4 my_FragColor;
+        void main()
+        {
+            my_FragColor = vec4(u + 1, u + 3, 0, 0);
+        })";
+    compileAssumeSuccess(shaderString);
+    ASSERT_TRUE(containsIntConstant(1));
+    ASSERT_TRUE(containsIntConstant(3));
+
+    TFusedTraverser fusedTraverser;
+    fusedTraverser.addTraverser(
+        std::unique_ptr<TIntermTraverser>(new ReplaceIntConstantTraverser(1, 2)));
+    fusedTraverser.addTraverser(
+        std::unique_ptr<TIntermTraverser>(new ReplaceIntConstantTraverser(3, 4)));
+    fusedTraverser.traverseAndUpdateTree(mASTRoot);
+
+    EXPECT_TRUE(fusedTraverser.empty());
+    EXPECT_FALSE(containsIntConstant(1));
+    EXPECT_TRUE(containsIntConstant(2));
+    EXPECT_FALSE(containsIntConstant(3));
+    EXPECT_TRUE(containsIntConstant(4));
+}
+
+}  // anonymous namespace
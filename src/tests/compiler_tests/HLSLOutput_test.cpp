@@ -7,6 +7,8 @@
 //   Tests for HLSL output.
 //
 
+#include <regex>
+
 #include "GLSLANG/ShaderLang.h"
 #include "angle_gl.h"
 #include "gtest/gtest.h"
@@ -156,3 +158,72 @@ TEST_F(HLSLOutputTest, ArrayReturnValue)
         })";
     compile(shaderString);
 }
+
+// Test that transforming the functions on several threads gives the same output every time, and
+// that the functions are rewritten like without threads.
+TEST_F(HLSLOutputTest, ParallelFunctionTransforms)
+{
+    const std::string &shaderString =
+        R"(#version 300 es
+        precision mediump float;
+        uniform float u;
+        uniform int i;
+        out vec4 outColor;
+
+        float f1(float f)
+        {
+            bool b = (f > 0.5 && u < f) || f == 0.0;
+            return b ? f : -f;
+        }
+
+        float f2(float f)
+        {
+            float g = 0.0;
+            for (int j = 0; j < 4 && f > float(j) || g < u; ++j)
+            {
+                g += f;
+            }
+            return g;
+        }
+
+        float f3(float f)
+        {
+            float g = (f += u, f * 2.0);
+            return g > 1.0 && (f > u || g > u) ? g : f;
+        }
+
+        void main()
+        {
+            outColor = vec4(f1(u), f2(u), f3(u), 1.0);
+        })";
+
+    std::string serialCode;
+    std::string infoLog;
+    ASSERT_TRUE(compileTestShader(GL_FRAGMENT_SHADER, SH_GLES3_SPEC, SH_HLSL_4_1_OUTPUT,
+                                  shaderString, SH_OBJECT_CODE, &serialCode, &infoLog))
+        << infoLog;
+
+    std::string parallelCode;
+    ASSERT_TRUE(compileTestShader(GL_FRAGMENT_SHADER, SH_GLES3_SPEC, SH_HLSL_4_1_OUTPUT,
+                                  shaderString,
+                                  SH_OBJECT_CODE | SH_PARALLELIZE_FUNCTION_TRANSFORMS,
+                                  &parallelCode, &infoLog))
+        << infoLog;
+
+    for (int i = 0; i < 8; ++i)
+    {
+        std::string code;
+        ASSERT_TRUE(compileTestShader(GL_FRAGMENT_SHADER, SH_GLES3_SPEC, SH_HLSL_4_1_OUTPUT,
+                                      shaderString,
+                                      SH_OBJECT_CODE | SH_PARALLELIZE_FUNCTION_TRANSFORMS, &code,
+                                      &infoLog))
+            << infoLog;
+        EXPECT_EQ(parallelCode, code);
+    }
+
+    // Temporary variables are named after their unique ids, which come from a different range
+    // for each function when running on several threads.
+    const std::regex temporaryName("\\bs[0-9k-p]+\\b");
+    EXPECT_EQ(std::regex_replace(serialCode, temporaryName, "s_"),
+              std::regex_replace(parallelCode, temporaryName, "s_"));
+}
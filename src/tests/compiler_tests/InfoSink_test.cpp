@@ -0,0 +1,118 @@
+//
+// Copyright (c) 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// InfoSink_test.cpp:
+//   Tests that TInfoSinkBase formats numbers the same way as a string stream, which is how it used
+//   to format them.
+//
+
+#include <limits>
+#include <sstream>
+
+#include "compiler/translator/InfoSink.h"
+#include "gtest/gtest.h"
+
+using namespace sh;
+
+namespace
+{
+
+template <typename T>
+std::string FormatWithStream(T value)
+{
+    std::ostringstream stream;
+    stream << value;
+    return stream.str();
+}
+
+std::string FormatFloatWithStream(float value)
+{
+    std::ostringstream stream;
+    if (fractionalPart(value) == 0.0f)
+    {
+        stream.precision(1);
+        stream << std::showpoint << std::fixed << value;
+    }
+    else
+    {
+        stream.precision(8);
+        stream << value;
+    }
+    return stream.str();
+}
+
+template <typename T>
+void CheckIntegers()
+{
+    const T kValues[] = {0,
+                         1,
+                         9,
+                         10,
+                         static_cast<T>(12345),
+                         std::numeric_limits<T>::max(),
+                         std::numeric_limits<T>::min(),
+                         static_cast<T>(std::numeric_limits<T>::min() + 1)};
+    for (T value : kValues)
+    {
+        TInfoSinkBase sink;
+        sink << value;
+        EXPECT_EQ(FormatWithStream(value), sink.str());
+    }
+}
+
+// Test that integers of all sizes are formatted like a stream formats them, including the limits.
+TEST(InfoSinkTest, Integers)
+{
+    CheckIntegers<int>();
+    CheckIntegers<unsigned int>();
+    CheckIntegers<long>();
+    CheckIntegers<unsigned long>();
+    CheckIntegers<long long>();
+    CheckIntegers<unsigned long long>();
+
+    TInfoSinkBase sink;
+    sink << -1 << ' ' << 2u << ' ' << static_cast<size_t>(3);
+    EXPECT_EQ("-1 2 3", sink.str());
+}
+
+// Test that floats are formatted like a stream formats them, both the whole numbers that are
+// written as integers and the ones that aren't.
+TEST(InfoSinkTest, Floats)
+{
+    const float kValues[] = {0.0f,
+                             -0.0f,
+                             1.0f,
+                             -2.0f,
+                             0.5f,
+                             -0.125f,
+                             3.14159265f,
+                             1.0e-7f,
+                             16777216.0f,
+                             1.0e17f,
+                             -1.0e18f,
+                             std::numeric_limits<float>::max(),
+                             -std::numeric_limits<float>::max(),
+                             std::numeric_limits<float>::min(),
+                             std::numeric_limits<float>::infinity()};
+    for (float value : kValues)
+    {
+        TInfoSinkBase sink;
+        sink << value;
+        EXPECT_EQ(FormatFloatWithStream(value), sink.str()) << value;
+    }
+}
+
+// Test that the formatting state used for floats doesn't leak into other values formatted with a
+// stream.
+TEST(InfoSinkTest, StreamStateIsReset)
+{
+    TInfoSinkBase sink;
+    sink << 0.25f << ' ' << 1.5e20f << ' ' << 0.1 << ' ' << static_cast<short>(-7);
+    EXPECT_EQ(FormatFloatWithStream(0.25f) + " " + FormatFloatWithStream(1.5e20f) + " " +
+                  FormatWithStream(0.1) + " -7",
+              sink.str());
+}
+
+}  // anonymous namespace
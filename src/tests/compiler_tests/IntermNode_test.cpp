@@ -10,6 +10,7 @@
 #include "compiler/translator/IntermNode.h"
 #include "angle_gl.h"
 #include "compiler/translator/InfoSink.h"
+#include "compiler/translator/IntermTraverse.h"
 #include "compiler/translator/PoolAlloc.h"
 #include "compiler/translator/StaticType.h"
 #include "compiler/translator/SymbolTable.h"
@@ -260,3 +261,56 @@ TEST_F(IntermNodeTest, DeepCopyTernaryNode)
     checkSymbolCopy(original->getFalseExpression(), copy->getFalseExpression());
 }
 
+// Check that the class checks match the classes of the nodes, including the intermediate classes.
+TEST_F(IntermNodeTest, GetAsMatchesNodeClass)
+{
+    TIntermBinary *binary = new TIntermBinary(EOpAdd, createTestSymbol(), createTestSymbol());
+    TIntermNode *binaryNode = binary;
+    EXPECT_EQ(NodeKind::Binary, binaryNode->getKind());
+    EXPECT_EQ(binary, binaryNode->getAsBinaryNode());
+    EXPECT_EQ(binary, binaryNode->getAsTyped());
+    EXPECT_EQ(nullptr, binaryNode->getAsUnaryNode());
+    EXPECT_EQ(nullptr, binaryNode->getAsAggregate());
+
+    TIntermBlock *block = new TIntermBlock();
+    block->appendStatement(binary);
+    TIntermNode *blockNode = block;
+    EXPECT_EQ(NodeKind::Block, blockNode->getKind());
+    EXPECT_EQ(block, blockNode->getAsBlock());
+    EXPECT_EQ(nullptr, blockNode->getAsTyped());
+
+    TIntermDeclaration *declaration = new TIntermDeclaration();
+    TIntermNode *declarationNode    = declaration;
+    EXPECT_EQ(declaration, declarationNode->getAsDeclarationNode());
+    EXPECT_EQ(nullptr, declarationNode->getAsBlock());
+}
+
+namespace
+{
+
+class CountSymbolsTraverser : public TIntermPreOrderTraverser<CountSymbolsTraverser>
+{
+  public:
+    CountSymbolsTraverser() : symbolCount(0) {}
+
+    void visitSymbol(TIntermSymbol *node) { ++symbolCount; }
+    bool visitUnary(Visit visit, TIntermUnary *node) { return false; }
+
+    int symbolCount;
+};
+
+}  // anonymous namespace
+
+// Check that the statically dispatched traverser visits all the children, unless a visit skips
+// the subtree.
+TEST_F(IntermNodeTest, PreOrderTraverserVisitsChildren)
+{
+    TIntermBlock *block = new TIntermBlock();
+    block->appendStatement(new TIntermBinary(EOpAdd, createTestSymbol(), createTestSymbol()));
+    block->appendStatement(new TIntermUnary(EOpNegative, createTestSymbol()));
+    block->appendStatement(createTestSymbol());
+
+    CountSymbolsTraverser traverser;
+    traverser.traverse(block);
+    EXPECT_EQ(3, traverser.symbolCount);
+}
@@ -0,0 +1,160 @@
+//
+// Copyright (c) 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PoolAlloc_test.cpp:
+//   Tests for the memory statistics, node counters and block recycling of TPoolAllocator.
+//
+
+#include <vector>
+
+#include "compiler/translator/PoolAlloc.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+
+#if !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
+
+// Verify that the high-water mark keeps the peak after the pool is popped, and that resetting it
+// brings it down to the memory that's still in use.
+TEST(PoolAllocTest, HighWaterMark)
+{
+    TPoolAllocator allocator;
+    allocator.push();
+    allocator.allocate(100);
+    size_t baseBytes = allocator.getBytesInUse();
+    EXPECT_GT(baseBytes, 0u);
+
+    allocator.push();
+    for (int i = 0; i < 100; ++i)
+    {
+        allocator.allocate(1000);
+    }
+    size_t peakBytes = allocator.getBytesInUse();
+    EXPECT_GE(peakBytes, baseBytes + 100 * 1000);
+    EXPECT_EQ(peakBytes, allocator.getHighWaterMark());
+
+    allocator.pop();
+    EXPECT_EQ(baseBytes, allocator.getBytesInUse());
+    EXPECT_EQ(peakBytes, allocator.getHighWaterMark());
+
+    allocator.resetHighWaterMark();
+    EXPECT_EQ(baseBytes, allocator.getHighWaterMark());
+
+    allocator.popAll();
+    EXPECT_EQ(0u, allocator.getBytesInUse());
+}
+
+// Verify that nodes are only counted while statistics are enabled.
+TEST(PoolAllocTest, NodesCountedWithStatisticsOnly)
+{
+    TPoolAllocator allocator;
+    allocator.countNodeAllocation();
+    EXPECT_EQ(nullptr, allocator.getNodeVisitCounter());
+    EXPECT_EQ(0u, allocator.getNumNodesAllocated());
+
+    allocator.setStatisticsEnabled(true);
+    allocator.countNodeAllocation();
+    size_t *visitCounter = allocator.getNodeVisitCounter();
+    ASSERT_NE(nullptr, visitCounter);
+    ++*visitCounter;
+    EXPECT_EQ(1u, allocator.getNumNodesAllocated());
+    EXPECT_EQ(1u, allocator.getNumNodesVisited());
+
+    allocator.setStatisticsEnabled(false);
+    allocator.countNodeAllocation();
+    EXPECT_EQ(1u, allocator.getNumNodesAllocated());
+}
+
+#if !defined(GUARD_BLOCKS)
+
+// Verify that blocks given back while recycling is enabled are reused for allocations of the same
+// size only.
+TEST(PoolAllocTest, DeallocatedBlocksAreRecycled)
+{
+    TPoolAllocator allocator;
+    allocator.push();
+    allocator.setRecyclingEnabled(true);
+
+    void *block = allocator.allocate(48);
+    allocator.deallocate(block, 48);
+    EXPECT_NE(block, allocator.allocate(64));
+    EXPECT_EQ(block, allocator.allocate(48));
+    EXPECT_NE(block, allocator.allocate(48));
+
+    allocator.setRecyclingEnabled(false);
+    allocator.popAll();
+}
+
+// Verify that blocks aren't reused when recycling is disabled, and that disabling recycling or
+// popping the pool forgets the blocks given back so far.
+TEST(PoolAllocTest, RecycledBlocksAreForgotten)
+{
+    TPoolAllocator allocator;
+    allocator.push();
+
+    void *block = allocator.allocate(32);
+    allocator.deallocate(block, 32);
+    EXPECT_NE(block, allocator.allocate(32));
+
+    allocator.setRecyclingEnabled(true);
+    block = allocator.allocate(32);
+    allocator.deallocate(block, 32);
+    allocator.setRecyclingEnabled(false);
+    allocator.setRecyclingEnabled(true);
+    EXPECT_NE(block, allocator.allocate(32));
+
+    allocator.push();
+    block = allocator.allocate(32);
+    allocator.deallocate(block, 32);
+    allocator.pop();
+    EXPECT_NE(block, allocator.allocate(32));
+
+    allocator.setRecyclingEnabled(false);
+    allocator.popAll();
+}
+
+// Verify that a container gives the memory it outgrows back to the pool it was created in, even if
+// another pool has become the global one since.
+TEST(PoolAllocTest, ContainersDeallocateIntoTheirOwnPool)
+{
+    TPoolAllocator ownerPool;
+    TPoolAllocator otherPool;
+    ownerPool.push();
+    otherPool.push();
+    ownerPool.setRecyclingEnabled(true);
+    otherPool.setRecyclingEnabled(true);
+
+    TPoolAllocator *previousPool = GetGlobalPoolAllocator();
+    SetGlobalPoolAllocator(&ownerPool);
+    {
+        std::vector<int, pool_allocator<int>> values(4, 0);
+        const void *firstStorage = values.data();
+
+        SetGlobalPoolAllocator(&otherPool);
+        std::vector<int, pool_allocator<int>> otherValues(4, 0);
+        EXPECT_TRUE(values.get_allocator() != otherValues.get_allocator());
+
+        values.resize(64);
+        EXPECT_NE(firstStorage, otherPool.allocate(4 * sizeof(int)));
+        EXPECT_EQ(firstStorage, ownerPool.allocate(4 * sizeof(int)));
+
+        // Copies are made in the current global pool.
+        std::vector<int, pool_allocator<int>> copiedValues(values);
+        EXPECT_TRUE(copiedValues.get_allocator() == otherValues.get_allocator());
+    }
+    SetGlobalPoolAllocator(previousPool);
+
+    ownerPool.setRecyclingEnabled(false);
+    otherPool.setRecyclingEnabled(false);
+    ownerPool.popAll();
+    otherPool.popAll();
+}
+
+#endif  // !defined(GUARD_BLOCKS)
+
+#endif  // !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
+
+}  // anonymous namespace
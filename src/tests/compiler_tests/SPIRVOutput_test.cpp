@@ -0,0 +1,427 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// SPIRVOutput_test.cpp:
+//   Tests for the SPIR-V that the Vulkan translator generates directly from the AST.
+//
+
+#include <map>
+#include <set>
+#include <string>
+
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+#include "GLSLANG/ShaderLang.h"
+#include "spirv-tools/libspirv.hpp"
+
+namespace
+{
+
+constexpr uint32_t kMagicNumber = 0x07230203;
+constexpr size_t kHeaderSize    = 5;
+
+// Opcodes and enums used by the tests.
+constexpr uint32_t kOpName            = 5;
+constexpr uint32_t kOpMemberName      = 6;
+constexpr uint32_t kOpEntryPoint      = 15;
+constexpr uint32_t kOpFunction        = 54;
+constexpr uint32_t kOpFunctionEnd     = 56;
+constexpr uint32_t kOpDecorate        = 71;
+constexpr uint32_t kOpMemberDecorate  = 72;
+constexpr uint32_t kOpLabel           = 248;
+constexpr uint32_t kOpBranch          = 249;
+constexpr uint32_t kOpBranchCondition = 250;
+constexpr uint32_t kOpKill            = 252;
+constexpr uint32_t kOpReturn          = 253;
+constexpr uint32_t kOpReturnValue     = 254;
+constexpr uint32_t kOpUnreachable     = 255;
+
+constexpr uint32_t kDecorationLocation      = 30;
+constexpr uint32_t kDecorationBinding       = 33;
+constexpr uint32_t kDecorationDescriptorSet = 34;
+constexpr uint32_t kDecorationOffset        = 35;
+constexpr uint32_t kDecorationMatrixStride  = 7;
+
+struct Instruction
+{
+    uint32_t opcode;
+    std::vector<uint32_t> operands;
+};
+
+std::string GetString(const std::vector<uint32_t> &words, size_t start)
+{
+    std::string result;
+    for (size_t index = start; index < words.size(); ++index)
+    {
+        for (int byte = 0; byte < 4; ++byte)
+        {
+            char c = static_cast<char>((words[index] >> (byte * 8)) & 0xFF);
+            if (c == '\0')
+            {
+                return result;
+            }
+            result += c;
+        }
+    }
+    return result;
+}
+
+bool IsTerminator(uint32_t opcode)
+{
+    return opcode == kOpBranch || opcode == kOpBranchCondition || opcode == kOpKill ||
+           opcode == kOpReturn || opcode == kOpReturnValue || opcode == kOpUnreachable;
+}
+
+class SPIRVOutputTest : public testing::Test
+{
+  public:
+    SPIRVOutputTest() : mCompiler(nullptr) {}
+
+  protected:
+    void TearDown() override
+    {
+        if (mCompiler)
+        {
+            sh::Destruct(mCompiler);
+        }
+    }
+
+    void compile(::GLenum shaderType, const std::string &shaderString, ShShaderOutput output)
+    {
+        ShBuiltInResources resources;
+        sh::InitBuiltInResources(&resources);
+
+        mCompiler = sh::ConstructCompiler(shaderType, SH_GLES3_SPEC, output, &resources);
+        ASSERT_NE(nullptr, mCompiler);
+
+        const char *shaderStrings[] = {shaderString.c_str()};
+        ASSERT_TRUE(sh::Compile(mCompiler, shaderStrings, 1, SH_OBJECT_CODE | SH_VARIABLES))
+            << sh::GetInfoLog(mCompiler);
+
+        mBinary = sh::GetObjectBinary(mCompiler);
+        parse();
+    }
+
+    void compile(::GLenum shaderType, const std::string &shaderString)
+    {
+        compile(shaderType, shaderString, SH_SPIRV_VULKAN_OUTPUT);
+    }
+
+    void parse()
+    {
+        mInstructions.clear();
+        if (mBinary.size() < kHeaderSize)
+        {
+            return;
+        }
+
+        for (size_t offset = kHeaderSize; offset < mBinary.size();)
+        {
+            uint32_t wordCount = mBinary[offset] >> 16;
+            ASSERT_NE(0u, wordCount);
+            ASSERT_LE(offset + wordCount, mBinary.size());
+
+            Instruction instruction;
+            instruction.opcode = mBinary[offset] & 0xFFFF;
+            instruction.operands.assign(mBinary.begin() + offset + 1,
+                                        mBinary.begin() + offset + wordCount);
+            mInstructions.push_back(instruction);
+            offset += wordCount;
+        }
+    }
+
+    std::vector<uint32_t> getNamedIds(const std::string &name) const
+    {
+        std::vector<uint32_t> ids;
+        for (const Instruction &instruction : mInstructions)
+        {
+            if (instruction.opcode == kOpName && GetString(instruction.operands, 1) == name)
+            {
+                ids.push_back(instruction.operands[0]);
+            }
+        }
+        return ids;
+    }
+
+    uint32_t getNamedId(const std::string &name) const
+    {
+        std::vector<uint32_t> ids = getNamedIds(name);
+        return ids.empty() ? 0 : ids[0];
+    }
+
+    bool hasDecoration(uint32_t id, uint32_t decoration, uint32_t *operandOut) const
+    {
+        for (const Instruction &instruction : mInstructions)
+        {
+            if (instruction.opcode == kOpDecorate && instruction.operands[0] == id &&
+                instruction.operands[1] == decoration)
+            {
+                if (operandOut)
+                {
+                    *operandOut = instruction.operands.size() > 2 ? instruction.operands[2] : 0;
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // The value of a decoration of each member of a struct, by member name.
+    std::map<std::string, uint32_t> getMemberDecorations(uint32_t structId,
+                                                         uint32_t decoration) const
+    {
+        std::map<uint32_t, std::string> memberNames;
+        for (const Instruction &instruction : mInstructions)
+        {
+            if (instruction.opcode == kOpMemberName && instruction.operands[0] == structId)
+            {
+                memberNames[instruction.operands[1]] = GetString(instruction.operands, 2);
+            }
+        }
+
+        std::map<std::string, uint32_t> values;
+        for (const Instruction &instruction : mInstructions)
+        {
+            if (instruction.opcode == kOpMemberDecorate && instruction.operands[0] == structId &&
+                instruction.operands[2] == decoration)
+            {
+                values[memberNames[instruction.operands[1]]] = instruction.operands[3];
+            }
+        }
+        return values;
+    }
+
+    // Runs the module through spirv-val, then checks the header and that every function is made of
+    // uniquely labelled blocks that each end in a terminator, which gives more precise failures.
+    void checkStructure() const
+    {
+        std::string messages;
+        spvtools::SpirvTools tools(SPV_ENV_VULKAN_1_0);
+        tools.SetMessageConsumer([&messages](spv_message_level_t, const char *,
+                                             const spv_position_t &position, const char *message) {
+            messages += "word " + std::to_string(position.index) + ": " + message + "\n";
+        });
+        EXPECT_TRUE(tools.Validate(mBinary)) << messages;
+
+        ASSERT_GE(mBinary.size(), kHeaderSize);
+        EXPECT_EQ(kMagicNumber, mBinary[0]);
+        uint32_t bound = mBinary[3];
+
+        std::set<uint32_t> labels;
+        bool inFunction = false;
+        bool inBlock    = false;
+        for (const Instruction &instruction : mInstructions)
+        {
+            switch (instruction.opcode)
+            {
+                case kOpFunction:
+                    EXPECT_FALSE(inFunction);
+                    inFunction = true;
+                    break;
+                case kOpFunctionEnd:
+                    EXPECT_TRUE(inFunction);
+                    EXPECT_FALSE(inBlock);
+                    inFunction = false;
+                    break;
+                case kOpLabel:
+                    EXPECT_TRUE(inFunction);
+                    EXPECT_FALSE(inBlock);
+                    EXPECT_LT(instruction.operands[0], bound);
+                    EXPECT_TRUE(labels.insert(instruction.operands[0]).second);
+                    inBlock = true;
+                    break;
+                default:
+                    if (IsTerminator(instruction.opcode))
+                    {
+                        EXPECT_TRUE(inBlock);
+                        inBlock = false;
+                    }
+                    break;
+            }
+        }
+        EXPECT_FALSE(inFunction);
+    }
+
+    ShHandle mCompiler;
+    std::vector<uint32_t> mBinary;
+    std::vector<Instruction> mInstructions;
+};
+
+// Test that a simple vertex shader is output with a main entry point and its interface.
+TEST_F(SPIRVOutputTest, VertexShaderEntryPoint)
+{
+    const std::string &shaderString =
+        R"(#version 300 es
+        in vec4 position;
+        out vec2 texCoord;
+        void main()
+        {
+            texCoord = position.xy * 0.5 + 0.5;
+            gl_Position = position;
+        })";
+    compile(GL_VERTEX_SHADER, shaderString);
+    ASSERT_FALSE(mBinary.empty());
+    checkStructure();
+
+    bool foundEntryPoint = false;
+    for (const Instruction &instruction : mInstructions)
+    {
+        if (instruction.opcode == kOpEntryPoint)
+        {
+            EXPECT_EQ("main", GetString(instruction.operands, 2));
+            foundEntryPoint = true;
+        }
+    }
+    EXPECT_TRUE(foundEntryPoint);
+
+    // The interface variables are named after their GLSL names, with a placeholder location.
+    uint32_t location = 1;
+    EXPECT_TRUE(hasDecoration(getNamedId("position"), kDecorationLocation, &location));
+    EXPECT_EQ(0u, location);
+    EXPECT_TRUE(hasDecoration(getNamedId("texCoord"), kDecorationLocation, &location));
+    EXPECT_EQ(0u, location);
+}
+
+// Test that the default uniform block is laid out like the one the Vulkan back-end fills in.
+TEST_F(SPIRVOutputTest, DefaultUniformsLayout)
+{
+    const std::string &shaderString =
+        R"(#version 300 es
+        precision mediump float;
+        uniform float scale;
+        uniform vec3 offset;
+        uniform mat4 transform;
+        uniform vec2 weights[3];
+        uniform bool enabled;
+        uniform sampler2D tex;
+        in vec2 texCoord;
+        out vec4 color;
+        void main()
+        {
+            vec4 sum = texture(tex, texCoord) * scale;
+            sum.xyz += offset;
+            for (int i = 0; i < 3; ++i)
+            {
+                sum.xy += weights[i];
+            }
+            color = enabled ? transform * sum : sum;
+        })";
+    compile(GL_FRAGMENT_SHADER, shaderString);
+    ASSERT_FALSE(mBinary.empty());
+    checkStructure();
+
+    // The struct type and the variable are both named like the block of the GLSL output. Only the
+    // variable has a set and binding.
+    std::vector<uint32_t> blockIds = getNamedIds("defaultUniforms");
+    ASSERT_EQ(2u, blockIds.size());
+    uint32_t blockType     = blockIds[0];
+    uint32_t blockVariable = blockIds[1];
+    if (hasDecoration(blockType, kDecorationDescriptorSet, nullptr))
+    {
+        std::swap(blockType, blockVariable);
+    }
+    EXPECT_TRUE(hasDecoration(blockVariable, kDecorationDescriptorSet, nullptr));
+    EXPECT_TRUE(hasDecoration(blockVariable, kDecorationBinding, nullptr));
+
+    std::map<std::string, uint32_t> offsets =
+        getMemberDecorations(blockType, kDecorationOffset);
+    EXPECT_EQ(0u, offsets["scale"]);
+    EXPECT_EQ(16u, offsets["offset"]);
+    EXPECT_EQ(32u, offsets["transform"]);
+    EXPECT_EQ(96u, offsets["weights"]);
+    EXPECT_EQ(144u, offsets["enabled"]);
+    EXPECT_EQ(0u, offsets.count("tex"));
+
+    std::map<std::string, uint32_t> matrixStrides =
+        getMemberDecorations(blockType, kDecorationMatrixStride);
+    EXPECT_EQ(16u, matrixStrides["transform"]);
+
+    // Samplers are separate variables.
+    EXPECT_TRUE(hasDecoration(getNamedId("tex"), kDecorationDescriptorSet, nullptr));
+}
+
+// Test that control flow is output as structured blocks.
+TEST_F(SPIRVOutputTest, ControlFlow)
+{
+    const std::string &shaderString =
+        R"(#version 300 es
+        precision mediump float;
+        uniform int count;
+        in float value;
+        out vec4 color;
+        float f(float x)
+        {
+            if (x > 1.0)
+            {
+                return x;
+            }
+            return -x;
+        }
+        void main()
+        {
+            float sum = 0.0;
+            int i = 0;
+            do
+            {
+                if (i == 2)
+                {
+                    continue;
+                }
+                sum += f(value) + float(i++);
+            } while (i < count);
+            float limit = value;
+            while (sum > 10.0 && limit++ < 100.0)
+            {
+                sum /= 2.0;
+            }
+            if (sum < 0.0)
+            {
+                discard;
+            }
+            color = vec4(sum);
+        })";
+    compile(GL_FRAGMENT_SHADER, shaderString);
+    ASSERT_FALSE(mBinary.empty());
+    checkStructure();
+}
+
+// Test that shaders using something that isn't supported fall back to the GLSL output.
+TEST_F(SPIRVOutputTest, UnsupportedFallsBackToGLSL)
+{
+    const std::string &shaderString =
+        R"(#version 300 es
+        precision mediump float;
+        struct S
+        {
+            vec4 a;
+        };
+        uniform S s;
+        out vec4 color;
+        void main()
+        {
+            color = s.a;
+        })";
+    compile(GL_FRAGMENT_SHADER, shaderString);
+    EXPECT_TRUE(mBinary.empty());
+    EXPECT_FALSE(sh::GetObjectCode(mCompiler).empty());
+}
+
+// Test that no SPIR-V is output for the GLSL Vulkan output type.
+TEST_F(SPIRVOutputTest, GLSLOutputHasNoBinary)
+{
+    const std::string &shaderString =
+        R"(#version 300 es
+        precision mediump float;
+        out vec4 color;
+        void main()
+        {
+            color = vec4(1.0);
+        })";
+    compile(GL_FRAGMENT_SHADER, shaderString, SH_GLSL_VULKAN_OUTPUT);
+    EXPECT_TRUE(mBinary.empty());
+    EXPECT_FALSE(sh::GetObjectCode(mCompiler).empty());
+}
+
+}  // anonymous namespace
@@ -7,6 +7,10 @@
 //   Test the sh::Compile interface with different parameters.
 //
 
+#include <map>
+#include <thread>
+#include <vector>
+
 #include "angle_gl.h"
 #include "gtest/gtest.h"
 #include "GLSLANG/ShaderLang.h"
@@ -41,7 +45,6 @@ class ShCompileTest : public testing::Test
         EXPECT_EQ(expectation, success) << compileLog;
     }
 
-  private:
     ShBuiltInResources mResources;
     ShHandle mCompiler;
 };
@@ -81,3 +84,265 @@ TEST_F(ShCompileTest, TokensSplitInShaderStrings)
 
     testCompile(shaderStrings, 3, true);
 }
+
+// Test that compilers constructed on one thread can compile at the same time on other threads, the
+// way the GL frontend uses them, and that they produce the same results as on the main thread.
+TEST_F(ShCompileTest, CompileOnWorkerThreads)
+{
+    const std::string &shaderString =
+        "precision mediump float;\n"
+        "uniform vec4 u;\n"
+        "varying vec2 v;\n"
+        "float f(float x) { return x > 0.5 ? sin(x) : cos(x); }\n"
+        "void main() {\n"
+        "    vec4 c = u;\n"
+        "    for (int i = 0; i < 4; ++i) { c.x += f(v.x * float(i)); }\n"
+        "    gl_FragColor = c;\n"
+        "}";
+    const char *shaderStrings[] = {shaderString.c_str()};
+    const ShCompileOptions compileOptions = SH_OBJECT_CODE | SH_VARIABLES;
+
+    ASSERT_TRUE(sh::Compile(mCompiler, shaderStrings, 1, compileOptions));
+    const std::string expectedObjectCode = sh::GetObjectCode(mCompiler);
+
+    constexpr size_t kThreadCount = 4;
+    std::vector<ShHandle> compilers;
+    for (size_t i = 0; i < kThreadCount; ++i)
+    {
+        compilers.push_back(sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_WEBGL_SPEC,
+                                                  SH_GLSL_COMPATIBILITY_OUTPUT, &mResources));
+        ASSERT_TRUE(compilers.back() != nullptr);
+    }
+
+    std::vector<std::thread> threads;
+    std::vector<int> results(kThreadCount, 0);
+    for (size_t i = 0; i < kThreadCount; ++i)
+    {
+        threads.emplace_back([&compilers, &results, &shaderStrings, compileOptions, i]() {
+            for (int iteration = 0; iteration < 10; ++iteration)
+            {
+                if (sh::Compile(compilers[i], shaderStrings, 1, compileOptions))
+                {
+                    results[i]++;
+                }
+            }
+        });
+    }
+
+    for (size_t i = 0; i < kThreadCount; ++i)
+    {
+        threads[i].join();
+        EXPECT_EQ(10, results[i]) << sh::GetInfoLog(compilers[i]);
+        EXPECT_EQ(expectedObjectCode, sh::GetObjectCode(compilers[i]));
+        sh::Destruct(compilers[i]);
+    }
+}
+
+// Test that compiling with SH_REUSE_PARSED_AST produces the same results as parsing the shader
+// again, when the same shader is compiled with a sequence of different options. The options
+// transform the AST in different ways, so any change leaking into the reused AST would show up
+// in the output of the later compilations.
+TEST_F(ShCompileTest, ReuseParsedASTMatchesParsingAgain)
+{
+    const std::string &shaderString =
+        R"(#version 300 es
+        precision mediump float;
+        struct S { vec2 a; float b[2]; };
+        uniform S u;
+        uniform int n;
+        in vec2 v;
+        out vec4 color;
+        float f(S s, inout float x)
+        {
+            x += s.b[1];
+            return s.a.x > 0.5 || x < 0.0 ? -x : pow(x, 2.0);
+        }
+        void main()
+        {
+            float x;
+            vec4 c = vec4(v, 0, 1);
+            int i = 0;
+            do
+            {
+                x = float(i);
+                c.x += f(u, x);
+            } while (++i < n);
+            switch (n)
+            {
+                case 0:
+                    c.yz = -c.zy;
+                    break;
+                default:
+                    c *= 2.0;
+            }
+            color = c;
+        })";
+    const char *shaderStrings[] = {shaderString.c_str()};
+
+    const ShCompileOptions kBaseOptions = SH_OBJECT_CODE | SH_VARIABLES;
+    const ShCompileOptions kOptionSets[] = {
+        kBaseOptions,
+        kBaseOptions | SH_INIT_OUTPUT_VARIABLES | SH_INITIALIZE_UNINITIALIZED_LOCALS,
+        kBaseOptions | SH_REWRITE_DO_WHILE_LOOPS | SH_UNFOLD_SHORT_CIRCUIT,
+        kBaseOptions | SH_SCALARIZE_VEC_AND_MAT_CONSTRUCTOR_ARGS |
+            SH_REMOVE_POW_WITH_CONSTANT_EXPONENT | SH_REWRITE_FLOAT_UNARY_MINUS_OPERATOR,
+        kBaseOptions | SH_REGENERATE_STRUCT_NAMES,
+        kBaseOptions,
+    };
+
+    ShHandle reusingCompiler = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES3_SPEC,
+                                                     SH_GLSL_COMPATIBILITY_OUTPUT, &mResources);
+    ShHandle parsingCompiler = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES3_SPEC,
+                                                     SH_GLSL_COMPATIBILITY_OUTPUT, &mResources);
+    ASSERT_TRUE(reusingCompiler != nullptr && parsingCompiler != nullptr);
+
+    for (ShCompileOptions compileOptions : kOptionSets)
+    {
+        ASSERT_TRUE(sh::Compile(parsingCompiler, shaderStrings, 1, compileOptions))
+            << sh::GetInfoLog(parsingCompiler);
+        ASSERT_TRUE(
+            sh::Compile(reusingCompiler, shaderStrings, 1, compileOptions | SH_REUSE_PARSED_AST))
+            << sh::GetInfoLog(reusingCompiler);
+        EXPECT_EQ(sh::GetObjectCode(parsingCompiler), sh::GetObjectCode(reusingCompiler));
+        EXPECT_EQ(sh::GetInfoLog(parsingCompiler), sh::GetInfoLog(reusingCompiler));
+        ASSERT_NE(nullptr, sh::GetUniforms(reusingCompiler));
+        EXPECT_EQ(sh::GetUniforms(parsingCompiler)->size(),
+                  sh::GetUniforms(reusingCompiler)->size());
+    }
+
+    sh::Destruct(reusingCompiler);
+    sh::Destruct(parsingCompiler);
+}
+
+// Test that a compiler reusing parsed ASTs notices when it's given a different shader, including
+// one that fails to parse.
+TEST_F(ShCompileTest, ReuseParsedASTWithDifferentShaders)
+{
+    const std::string &shaderString1 =
+        "precision mediump float;\n"
+        "uniform vec4 u;\n"
+        "void main() {\n"
+        "    gl_FragColor = u;\n"
+        "}";
+    const std::string &shaderString2 =
+        "precision mediump float;\n"
+        "uniform vec4 u;\n"
+        "void main() {\n"
+        "    gl_FragColor = u.wzyx;\n"
+        "}";
+    const std::string &invalidShaderString =
+        "precision mediump float;\n"
+        "void main() {\n"
+        "    gl_FragColor = u;\n"
+        "}";
+    const char *shaderStrings[] = {shaderString1.c_str(), shaderString2.c_str(),
+                                   invalidShaderString.c_str(), shaderString1.c_str()};
+    const ShCompileOptions compileOptions = SH_OBJECT_CODE | SH_REUSE_PARSED_AST;
+
+    std::vector<std::string> objectCode;
+    for (const char *shaderString : shaderStrings)
+    {
+        bool success = sh::Compile(mCompiler, &shaderString, 1, compileOptions);
+        EXPECT_EQ(shaderString != invalidShaderString.c_str(), success);
+        objectCode.push_back(sh::GetObjectCode(mCompiler));
+    }
+
+    EXPECT_NE(objectCode[0], objectCode[1]);
+    EXPECT_EQ("", objectCode[2]);
+    EXPECT_EQ(objectCode[0], objectCode[3]);
+}
+
+// Test that the statistics of each compilation stage are recorded with
+// SH_COLLECT_COMPILE_STATISTICS, and not without it.
+TEST_F(ShCompileTest, CompileStatistics)
+{
+    const char *shaderString =
+        "precision mediump float;\n"
+        "#define SCALE(x) ((x) * 0.5)\n"
+        "uniform vec4 u;\n"
+        "void main() {\n"
+        "    gl_FragColor = SCALE(u);\n"
+        "}";
+
+    ASSERT_TRUE(sh::Compile(mCompiler, &shaderString, 1, SH_OBJECT_CODE));
+    EXPECT_TRUE(sh::GetCompileStatistics(mCompiler)->empty());
+
+    ASSERT_TRUE(
+        sh::Compile(mCompiler, &shaderString, 1, SH_OBJECT_CODE | SH_COLLECT_COMPILE_STATISTICS));
+    const std::vector<sh::CompileStageStatistics> &stages = *sh::GetCompileStatistics(mCompiler);
+    ASSERT_GE(stages.size(), 3u);
+
+    // The preprocessor doesn't allocate from the pool, so only its time is known.
+    EXPECT_EQ("Preprocess", stages[0].name);
+    EXPECT_EQ(0u, stages[0].nodesAllocated);
+
+    EXPECT_EQ("Parse", stages[1].name);
+    EXPECT_GT(stages[1].nodesAllocated, 0u);
+    EXPECT_GT(stages[1].poolBytes, 0u);
+
+    EXPECT_EQ("Output", stages.back().name);
+    EXPECT_GT(stages.back().nodesVisited, 0u);
+
+    for (const sh::CompileStageStatistics &stage : stages)
+    {
+        EXPECT_GE(stage.seconds, 0.0) << stage.name;
+    }
+
+    ASSERT_TRUE(sh::Compile(mCompiler, &shaderString, 1, SH_OBJECT_CODE));
+    EXPECT_TRUE(sh::GetCompileStatistics(mCompiler)->empty());
+}
+
+namespace
+{
+
+khronos_uint64_t HashByLength(const char *str, size_t length)
+{
+    return static_cast<khronos_uint64_t>(length);
+}
+
+}  // anonymous namespace
+
+// Test that every use of a user-defined name gets the same hashed name, and that the map of
+// hashed names returned by sh::GetNameHashingMap only covers the last compilation.
+TEST_F(ShCompileTest, HashedNames)
+{
+    ShBuiltInResources resources = mResources;
+    resources.HashFunction       = HashByLength;
+    ShHandle compiler = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_WEBGL_SPEC,
+                                              SH_GLSL_COMPATIBILITY_OUTPUT, &resources);
+    ASSERT_NE(nullptr, compiler);
+
+    const char *shaderString =
+        "precision mediump float;\n"
+        "uniform vec4 color;\n"
+        "vec4 scale(vec4 v) { return v * 0.5; }\n"
+        "void main() {\n"
+        "    vec4 c = scale(color);\n"
+        "    gl_FragColor = scale(c) + color;\n"
+        "}";
+    ASSERT_TRUE(sh::Compile(compiler, &shaderString, 1, SH_OBJECT_CODE));
+
+    const std::map<std::string, std::string> &hashedNames = *sh::GetNameHashingMap(compiler);
+    ASSERT_EQ(1u, hashedNames.count("color"));
+    ASSERT_EQ(1u, hashedNames.count("scale"));
+    EXPECT_EQ("webgl_5", hashedNames.at("color"));
+    EXPECT_EQ("webgl_5", hashedNames.at("scale"));
+    EXPECT_EQ("webgl_1", hashedNames.at("c"));
+    EXPECT_EQ("webgl_1", hashedNames.at("v"));
+
+    const std::string &objectCode = sh::GetObjectCode(compiler);
+    EXPECT_EQ(std::string::npos, objectCode.find("color"));
+    EXPECT_EQ(std::string::npos, objectCode.find("scale"));
+
+    const char *otherShaderString =
+        "precision mediump float;\n"
+        "uniform vec4 tint;\n"
+        "void main() {\n"
+        "    gl_FragColor = tint;\n"
+        "}";
+    ASSERT_TRUE(sh::Compile(compiler, &otherShaderString, 1, SH_OBJECT_CODE));
+    EXPECT_EQ(0u, sh::GetNameHashingMap(compiler)->count("color"));
+    EXPECT_EQ(1u, sh::GetNameHashingMap(compiler)->count("tint"));
+
+    sh::Destruct(compiler);
+}
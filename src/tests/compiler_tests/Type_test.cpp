@@ -4,12 +4,13 @@
 // found in the LICENSE file.
 //
 // Type_test.cpp:
-//   Tests for StaticType, TType and BasicType.
+//   Tests for StaticType, TType, TTypeInterner and BasicType.
 //
 
 #include "angle_gl.h"
 #include "compiler/translator/PoolAlloc.h"
 #include "compiler/translator/StaticType.h"
+#include "compiler/translator/TypeInterner.h"
 #include "compiler/translator/Types.h"
 #include "gtest/gtest.h"
 
@@ -58,4 +59,56 @@ TEST(Type, BaseTypeMangledNamesUnique)
     }
 }
 
+// Verify that the mangled names of arrays and of types with static mangled names are built the
+// same way.
+TEST(Type, StaticAndBuiltMangledNamesConsistent)
+{
+    TPoolAllocator allocator;
+    allocator.push();
+    SetGlobalPoolAllocator(&allocator);
+
+    TType vec3(EbtFloat, EbpHigh, EvqTemporary, 3, 1);
+    TType vec3Array(EbtFloat, EbpHigh, EvqTemporary, 3, 1);
+    vec3Array.makeArray(2u);
+    EXPECT_EQ("3f;", std::string(vec3.getMangledName()));
+    EXPECT_EQ("3f[2];", std::string(vec3Array.getMangledName()));
+
+    TType sampler(EbtUSampler2DArray, EbpLow, EvqUniform, 1, 1);
+    EXPECT_EQ(std::string(GetBasicMangledName(EbtUSampler2DArray)) + ";",
+              std::string(sampler.getMangledName()));
+
+    SetGlobalPoolAllocator(nullptr);
+    allocator.pop();
+}
+
+// Verify that structurally identical types are interned to the same instance, and that types that
+// differ in any way are not.
+TEST(TypeInterner, IdenticalTypesShareInstance)
+{
+    TPoolAllocator allocator;
+    allocator.push();
+    SetGlobalPoolAllocator(&allocator);
+
+    TTypeInterner interner;
+    TType mat2(EbtFloat, EbpMedium, EvqTemporary, 2, 2);
+    TType mat2Copy(mat2);
+    TType highpMat2(EbtFloat, EbpHigh, EvqTemporary, 2, 2);
+    TType mat2Array(mat2);
+    mat2Array.makeArray(4u);
+
+    const TType *interned = interner.intern(mat2);
+    EXPECT_NE(&mat2, interned);
+    EXPECT_EQ(interned, interner.intern(mat2Copy));
+    EXPECT_EQ(TTypeInterner::GetHash(mat2), TTypeInterner::GetHash(mat2Copy));
+    EXPECT_NE(interned, interner.intern(highpMat2));
+    EXPECT_NE(interned, interner.intern(mat2Array));
+    EXPECT_EQ(interner.intern(mat2Array), interner.intern(mat2Array));
+
+    EXPECT_TRUE(interned->isRealized());
+    EXPECT_EQ("22f;", std::string(interned->getMangledName()));
+
+    SetGlobalPoolAllocator(nullptr);
+    allocator.pop();
+}
+
 }  // namespace sh
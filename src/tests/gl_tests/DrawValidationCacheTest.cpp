@@ -0,0 +1,331 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DrawValidationCacheTest:
+//   Draw call validation caches the checks that only depend on the state. These tests make a
+//   draw succeed, change the state so that the same draw is invalid, and check that the error is
+//   generated.
+//
+
+#include "test_utils/ANGLETest.h"
+#include "test_utils/gl_raii.h"
+
+using namespace angle;
+
+namespace
+{
+
+constexpr GLsizei kVertexCount = 6;
+
+const std::string kVertexShader =
+    "attribute vec2 position;\n"
+    "void main()\n"
+    "{\n"
+    "    gl_Position = vec4(position, 0, 1);\n"
+    "}";
+
+const std::string kFragmentShader =
+    "precision mediump float;\n"
+    "void main()\n"
+    "{\n"
+    "    gl_FragColor = vec4(0, 1, 0, 1);\n"
+    "}";
+
+class DrawValidationCacheTest : public ANGLETest
+{
+  protected:
+    DrawValidationCacheTest()
+    {
+        setWindowWidth(64);
+        setWindowHeight(64);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+
+    // Fills the bound array buffer with |vertexCount| vertices for the position attribute.
+    static void FillVertexBuffer(GLsizei vertexCount)
+    {
+        std::vector<GLfloat> positions(vertexCount * 2, 0.5f);
+        glBufferData(GL_ARRAY_BUFFER, positions.size() * sizeof(GLfloat), positions.data(),
+                     GL_STATIC_DRAW);
+    }
+
+    // Points |location| at a buffer of |vertexCount| vertices.
+    static void SetupVertexAttribute(GLuint location, GLuint buffer, GLsizei vertexCount)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+        FillVertexBuffer(vertexCount);
+        glVertexAttribPointer(location, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+        glEnableVertexAttribArray(location);
+    }
+};
+
+class DrawValidationCacheTestES3 : public DrawValidationCacheTest
+{
+};
+
+class DrawValidationCacheTestWebGL : public DrawValidationCacheTest
+{
+  protected:
+    DrawValidationCacheTestWebGL() { setWebGLCompatibilityEnabled(true); }
+};
+
+// Test that shrinking the vertex buffer with bufferData is seen by the next draw, and that
+// growing it again makes the draw valid.
+TEST_P(DrawValidationCacheTest, BufferDataResize)
+{
+    ANGLE_GL_PROGRAM(program, kVertexShader, kFragmentShader);
+    glUseProgram(program);
+    GLint positionLocation = glGetAttribLocation(program, "position");
+    ASSERT_NE(-1, positionLocation);
+
+    GLBuffer buffer;
+    SetupVertexAttribute(positionLocation, buffer, kVertexCount);
+    glDrawArrays(GL_TRIANGLES, 0, kVertexCount);
+    ASSERT_GL_NO_ERROR();
+
+    FillVertexBuffer(kVertexCount / 2);
+    glDrawArrays(GL_TRIANGLES, 0, kVertexCount);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    FillVertexBuffer(kVertexCount);
+    glDrawArrays(GL_TRIANGLES, 0, kVertexCount);
+    EXPECT_GL_NO_ERROR();
+}
+
+// Test that shrinking the vertex buffer from a context of the share group is seen by the next draw
+// of the context that drew with it.
+TEST_P(DrawValidationCacheTest, BufferDataResizeFromSharedContext)
+{
+    ANGLE_GL_PROGRAM(program, kVertexShader, kFragmentShader);
+    glUseProgram(program);
+    GLint positionLocation = glGetAttribLocation(program, "position");
+    ASSERT_NE(-1, positionLocation);
+
+    GLBuffer buffer;
+    SetupVertexAttribute(positionLocation, buffer, kVertexCount);
+    glDrawArrays(GL_TRIANGLES, 0, kVertexCount);
+    ASSERT_GL_NO_ERROR();
+
+    EGLint contextAttributes[] = {
+        EGL_CONTEXT_MAJOR_VERSION_KHR,
+        GetParam().majorVersion,
+        EGL_CONTEXT_MINOR_VERSION_KHR,
+        GetParam().minorVersion,
+        EGL_NONE,
+    };
+
+    EGLWindow *window  = getEGLWindow();
+    EGLDisplay display = window->getDisplay();
+    EGLSurface surface = window->getSurface();
+    EGLContext sharedContext =
+        eglCreateContext(display, window->getConfig(), window->getContext(), contextAttributes);
+    ASSERT_NE(EGL_NO_CONTEXT, sharedContext);
+
+    eglMakeCurrent(display, surface, surface, sharedContext);
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    FillVertexBuffer(kVertexCount / 2);
+    ASSERT_GL_NO_ERROR();
+
+    eglMakeCurrent(display, surface, surface, window->getContext());
+    eglDestroyContext(display, sharedContext);
+
+    glDrawArrays(GL_TRIANGLES, 0, kVertexCount);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+}
+
+// Test that relinking the program with the position at another location, whose buffer is too
+// small, is seen by the next draw.
+TEST_P(DrawValidationCacheTest, ProgramRelink)
+{
+    ANGLE_GL_PROGRAM(program, kVertexShader, kFragmentShader);
+    glBindAttribLocation(program, 0, "position");
+    glLinkProgram(program);
+    glUseProgram(program);
+
+    // The attribute at location 1 isn't used by the program, so its buffer doesn't matter yet.
+    GLBuffer buffer;
+    GLBuffer smallBuffer;
+    SetupVertexAttribute(0, buffer, kVertexCount);
+    SetupVertexAttribute(1, smallBuffer, kVertexCount / 2);
+    glDrawArrays(GL_TRIANGLES, 0, kVertexCount);
+    ASSERT_GL_NO_ERROR();
+
+    glBindAttribLocation(program, 1, "position");
+    glLinkProgram(program);
+    ASSERT_GL_NO_ERROR();
+    glDrawArrays(GL_TRIANGLES, 0, kVertexCount);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    glBindAttribLocation(program, 0, "position");
+    glLinkProgram(program);
+    glDrawArrays(GL_TRIANGLES, 0, kVertexCount);
+    EXPECT_GL_NO_ERROR();
+}
+
+// Test that binding a vertex array with a smaller buffer, and changing the attributes of the
+// bound vertex array, are seen by the next draw.
+TEST_P(DrawValidationCacheTestES3, VertexArrayChange)
+{
+    ANGLE_GL_PROGRAM(program, kVertexShader, kFragmentShader);
+    glUseProgram(program);
+    GLint positionLocation = glGetAttribLocation(program, "position");
+    ASSERT_NE(-1, positionLocation);
+
+    GLVertexArray vertexArray;
+    GLBuffer buffer;
+    glBindVertexArray(vertexArray);
+    SetupVertexAttribute(positionLocation, buffer, kVertexCount);
+
+    GLVertexArray smallVertexArray;
+    GLBuffer smallBuffer;
+    glBindVertexArray(smallVertexArray);
+    SetupVertexAttribute(positionLocation, smallBuffer, kVertexCount / 2);
+
+    glBindVertexArray(vertexArray);
+    glDrawArrays(GL_TRIANGLES, 0, kVertexCount);
+    ASSERT_GL_NO_ERROR();
+
+    glBindVertexArray(smallVertexArray);
+    glDrawArrays(GL_TRIANGLES, 0, kVertexCount);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    glBindVertexArray(vertexArray);
+    glDrawArrays(GL_TRIANGLES, 0, kVertexCount);
+    ASSERT_GL_NO_ERROR();
+
+    // Skipping the first half of the buffer leaves too few vertices.
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0,
+                          reinterpret_cast<const void *>(kVertexCount / 2 * 2 * sizeof(GLfloat)));
+    glDrawArrays(GL_TRIANGLES, 0, kVertexCount);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glDrawArrays(GL_TRIANGLES, 0, kVertexCount);
+    ASSERT_GL_NO_ERROR();
+
+    // Without the attribute, the small buffer isn't read anymore.
+    glBindVertexArray(smallVertexArray);
+    glDisableVertexAttribArray(positionLocation);
+    glDrawArrays(GL_TRIANGLES, 0, kVertexCount);
+    EXPECT_GL_NO_ERROR();
+}
+
+// Test that attaching a stencil buffer to the draw framebuffer is seen by the next draw. WebGL
+// only allows different front and back stencil masks if the framebuffer has no stencil bits.
+TEST_P(DrawValidationCacheTestWebGL, FramebufferAttachmentChange)
+{
+    ANGLE_GL_PROGRAM(program, kVertexShader, kFragmentShader);
+    glUseProgram(program);
+    GLint positionLocation = glGetAttribLocation(program, "position");
+    ASSERT_NE(-1, positionLocation);
+
+    GLBuffer buffer;
+    SetupVertexAttribute(positionLocation, buffer, kVertexCount);
+
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 16, 16, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+    GLRenderbuffer stencilBuffer;
+    glBindRenderbuffer(GL_RENDERBUFFER, stencilBuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_STENCIL_INDEX8, 16, 16);
+
+    GLFramebuffer framebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+    ASSERT_GLENUM_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_FRAMEBUFFER));
+
+    glStencilMaskSeparate(GL_BACK, 0x0F);
+    glDrawArrays(GL_TRIANGLES, 0, kVertexCount);
+    ASSERT_GL_NO_ERROR();
+
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_RENDERBUFFER,
+                              stencilBuffer);
+    ASSERT_GLENUM_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_FRAMEBUFFER));
+    glDrawArrays(GL_TRIANGLES, 0, kVertexCount);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_RENDERBUFFER, 0);
+    glDrawArrays(GL_TRIANGLES, 0, kVertexCount);
+    EXPECT_GL_NO_ERROR();
+}
+
+// Test that the WebGL feedback loop check is redone when the sampled texture or the attachment of
+// the draw framebuffer changes.
+TEST_P(DrawValidationCacheTestWebGL, FeedbackLoop)
+{
+    const std::string fragmentShader =
+        "precision mediump float;\n"
+        "uniform sampler2D tex;\n"
+        "void main()\n"
+        "{\n"
+        "    gl_FragColor = texture2D(tex, vec2(0.5));\n"
+        "}";
+
+    ANGLE_GL_PROGRAM(program, kVertexShader, fragmentShader);
+    glUseProgram(program);
+    GLint positionLocation = glGetAttribLocation(program, "position");
+    ASSERT_NE(-1, positionLocation);
+    glUniform1i(glGetUniformLocation(program, "tex"), 0);
+
+    GLBuffer buffer;
+    SetupVertexAttribute(positionLocation, buffer, kVertexCount);
+
+    GLTexture textures[2];
+    for (GLTexture &texture : textures)
+    {
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 16, 16, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    }
+
+    GLFramebuffer framebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, textures[0], 0);
+    ASSERT_GLENUM_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_FRAMEBUFFER));
+
+    glBindTexture(GL_TEXTURE_2D, textures[1]);
+    glDrawArrays(GL_TRIANGLES, 0, kVertexCount);
+    ASSERT_GL_NO_ERROR();
+
+    // Sampling the attached texture.
+    glBindTexture(GL_TEXTURE_2D, textures[0]);
+    glDrawArrays(GL_TRIANGLES, 0, kVertexCount);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    glBindTexture(GL_TEXTURE_2D, textures[1]);
+    glDrawArrays(GL_TRIANGLES, 0, kVertexCount);
+    ASSERT_GL_NO_ERROR();
+
+    // Attaching the sampled texture.
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, textures[1], 0);
+    glDrawArrays(GL_TRIANGLES, 0, kVertexCount);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, textures[0], 0);
+    glDrawArrays(GL_TRIANGLES, 0, kVertexCount);
+    EXPECT_GL_NO_ERROR();
+}
+
+}  // anonymous namespace
+
+ANGLE_INSTANTIATE_TEST(DrawValidationCacheTest,
+                       ES2_D3D9(),
+                       ES2_D3D11(),
+                       ES3_D3D11(),
+                       ES2_OPENGL(),
+                       ES3_OPENGL(),
+                       ES2_OPENGLES(),
+                       ES3_OPENGLES());
+ANGLE_INSTANTIATE_TEST(DrawValidationCacheTestES3, ES3_D3D11(), ES3_OPENGL(), ES3_OPENGLES());
+ANGLE_INSTANTIATE_TEST(DrawValidationCacheTestWebGL,
+                       ES2_D3D9(),
+                       ES2_D3D11(),
+                       ES2_OPENGL(),
+                       ES2_OPENGLES());
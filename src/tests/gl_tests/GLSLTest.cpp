@@ -1446,6 +1446,91 @@ TEST_P(GLSLTest, InvalidFieldFirstChar)
     EXPECT_EQ(0, compileResult);
 }
 
+// Compiles many shaders before querying any of them, one of them failing, so that more of them
+// are translated at once than there are worker threads. Each shader must then report its own
+// results and be usable.
+TEST_P(GLSLTest, ConcurrentCompiles)
+{
+    const std::string vsSource =
+        R"(attribute vec4 position;
+        void main()
+        {
+            gl_Position = position;
+        })";
+
+    constexpr size_t kShaderCount   = 24;
+    constexpr size_t kInvalidShader = 13;
+    std::vector<GLuint> fragmentShaders;
+    for (size_t shaderIndex = 0; shaderIndex < kShaderCount; ++shaderIndex)
+    {
+        // Each shader outputs a different color, so that the results can't be mixed up.
+        std::stringstream fsStream;
+        fsStream << "precision mediump float;\n"
+                 << "void main()\n"
+                 << "{\n";
+        if (shaderIndex == kInvalidShader)
+        {
+            fsStream << "    gl_FragColor = undefinedColor;\n";
+        }
+        else
+        {
+            fsStream << "    gl_FragColor = vec4(" << shaderIndex << ".0 / 255.0, 1.0, 0.0, 1.0);\n";
+        }
+        fsStream << "}\n";
+
+        const std::string fsSource   = fsStream.str();
+        const char *fsSourceArray[1] = {fsSource.c_str()};
+
+        GLuint shader = glCreateShader(GL_FRAGMENT_SHADER);
+        glShaderSource(shader, 1, fsSourceArray, nullptr);
+        glCompileShader(shader);
+        fragmentShaders.push_back(shader);
+    }
+    ASSERT_GL_NO_ERROR();
+
+    GLuint vs = CompileShader(GL_VERTEX_SHADER, vsSource);
+    ASSERT_NE(0u, vs);
+
+    for (size_t shaderIndex = 0; shaderIndex < kShaderCount; ++shaderIndex)
+    {
+        GLuint shader = fragmentShaders[shaderIndex];
+
+        GLint compileStatus;
+        glGetShaderiv(shader, GL_COMPILE_STATUS, &compileStatus);
+        GLint infoLogLength;
+        glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &infoLogLength);
+
+        if (shaderIndex == kInvalidShader)
+        {
+            EXPECT_GL_FALSE(compileStatus);
+            EXPECT_GT(infoLogLength, 1);
+            continue;
+        }
+        EXPECT_GL_TRUE(compileStatus);
+
+        GLuint program = glCreateProgram();
+        glAttachShader(program, vs);
+        glAttachShader(program, shader);
+        glLinkProgram(program);
+
+        GLint linkStatus;
+        glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+        EXPECT_GL_TRUE(linkStatus);
+
+        drawQuad(program, "position", 0.5f);
+        EXPECT_PIXEL_NEAR(0, 0, shaderIndex, 255, 0, 255, 1);
+
+        glDeleteProgram(program);
+    }
+
+    glDeleteShader(vs);
+    for (GLuint shader : fragmentShaders)
+    {
+        glDeleteShader(shader);
+    }
+    EXPECT_GL_NO_ERROR();
+}
+
 // Verify that a length array with mixed positive and negative values compiles.
 TEST_P(GLSLTest, MixedShaderLengths)
 {
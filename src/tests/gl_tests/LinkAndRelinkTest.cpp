@@ -7,6 +7,7 @@
 //   Link and relink failure tests for rendering pipeline and compute pipeline.
 
 #include <vector>
+#include "common/angleutils.h"
 #include "test_utils/ANGLETest.h"
 #include "test_utils/gl_raii.h"
 
@@ -27,6 +28,13 @@ class LinkAndRelinkTestES31 : public ANGLETest
     LinkAndRelinkTestES31() {}
 };
 
+class LinkAndRelinkTestNoError : public ANGLETest
+{
+  protected:
+    // Without validation, the program calls aren't preceded by a validated program lookup.
+    LinkAndRelinkTestNoError() { setNoErrorEnabled(true); }
+};
+
 // When a program link or relink fails, if you try to install the unsuccessfully
 // linked program (via UseProgram) and start rendering or dispatch compute,
 // We can not always report INVALID_OPERATION for rendering/compute pipeline.
@@ -163,6 +171,287 @@ TEST_P(LinkAndRelinkTest, RenderingProgramFailsWithProgramInstalled)
     EXPECT_GL_ERROR(GL_INVALID_OPERATION);
 }
 
+// Links may finish in the background. Linking many programs before querying any of them should
+// give the same results as linking them one at a time.
+TEST_P(LinkAndRelinkTest, ManyProgramsLinkedBeforeUse)
+{
+    const std::string vsSource =
+        R"(attribute vec4 position;
+        void main()
+        {
+            gl_Position = position;
+        })";
+
+    const std::string fsSource =
+        R"(precision mediump float;
+        uniform vec4 color;
+        void main()
+        {
+            gl_FragColor = color;
+        })";
+
+    GLuint vs = CompileShader(GL_VERTEX_SHADER, vsSource);
+    GLuint fs = CompileShader(GL_FRAGMENT_SHADER, fsSource);
+    ASSERT_NE(0u, vs);
+    ASSERT_NE(0u, fs);
+
+    constexpr size_t kProgramCount = 16;
+    std::vector<GLuint> programs;
+    for (size_t programIndex = 0; programIndex < kProgramCount; ++programIndex)
+    {
+        GLuint program = glCreateProgram();
+        glAttachShader(program, vs);
+        glAttachShader(program, fs);
+        glLinkProgram(program);
+        programs.push_back(program);
+    }
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+    ASSERT_GL_NO_ERROR();
+
+    for (GLuint program : programs)
+    {
+        GLint linkStatus;
+        glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+        EXPECT_GL_TRUE(linkStatus);
+
+        glUseProgram(program);
+        glUniform4f(glGetUniformLocation(program, "color"), 0.0f, 1.0f, 0.0f, 1.0f);
+        drawQuad(program, "position", 0.5f);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    }
+
+    for (GLuint program : programs)
+    {
+        glDeleteProgram(program);
+    }
+    EXPECT_GL_NO_ERROR();
+}
+
+// Polling the completion status of a link and of the compiles it reads doesn't wait for them, and
+// eventually reports that they have finished.
+TEST_P(LinkAndRelinkTest, CompletionStatus)
+{
+    ANGLE_SKIP_TEST_IF(!extensionEnabled("GL_KHR_parallel_shader_compile"));
+
+    const std::string vsSource =
+        R"(attribute vec4 position;
+        void main()
+        {
+            gl_Position = position;
+        })";
+
+    const std::string fsSource =
+        R"(precision mediump float;
+        void main()
+        {
+            gl_FragColor = vec4(0.0, 1.0, 0.0, 1.0);
+        })";
+
+    GLuint vs = CompileShader(GL_VERTEX_SHADER, vsSource);
+    GLuint fs = CompileShader(GL_FRAGMENT_SHADER, fsSource);
+    ASSERT_NE(0u, vs);
+    ASSERT_NE(0u, fs);
+
+    GLint shaderCompletionStatus = GL_FALSE;
+    while (!shaderCompletionStatus)
+    {
+        glGetShaderiv(fs, GL_COMPLETION_STATUS_KHR, &shaderCompletionStatus);
+        ASSERT_GL_NO_ERROR();
+    }
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vs);
+    glAttachShader(program, fs);
+    glLinkProgram(program);
+
+    GLint completionStatus = GL_FALSE;
+    while (!completionStatus)
+    {
+        glGetProgramiv(program, GL_COMPLETION_STATUS_KHR, &completionStatus);
+        ASSERT_GL_NO_ERROR();
+    }
+
+    GLint linkStatus;
+    glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+    EXPECT_GL_TRUE(linkStatus);
+
+    drawQuad(program, "position", 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+
+    // A program that isn't being linked is complete.
+    GLuint emptyProgram = glCreateProgram();
+    glGetProgramiv(emptyProgram, GL_COMPLETION_STATUS_KHR, &completionStatus);
+    EXPECT_GL_TRUE(completionStatus);
+
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+    glDeleteProgram(program);
+    glDeleteProgram(emptyProgram);
+    EXPECT_GL_NO_ERROR();
+}
+
+// With no shader compiler threads, compiles and links finish before the calls return.
+TEST_P(LinkAndRelinkTest, NoShaderCompilerThreads)
+{
+    ANGLE_SKIP_TEST_IF(!extensionEnabled("GL_KHR_parallel_shader_compile"));
+
+    glMaxShaderCompilerThreadsKHR(0);
+    GLint maxThreads = -1;
+    glGetIntegerv(GL_MAX_SHADER_COMPILER_THREADS_KHR, &maxThreads);
+    EXPECT_EQ(0, maxThreads);
+
+    const std::string vsSource =
+        R"(attribute vec4 position;
+        void main()
+        {
+            gl_Position = position;
+        })";
+
+    const std::string fsSource =
+        R"(precision mediump float;
+        void main()
+        {
+            gl_FragColor = vec4(0.0, 1.0, 0.0, 1.0);
+        })";
+
+    GLuint vs = CompileShader(GL_VERTEX_SHADER, vsSource);
+    GLuint fs = CompileShader(GL_FRAGMENT_SHADER, fsSource);
+    ASSERT_NE(0u, vs);
+    ASSERT_NE(0u, fs);
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vs);
+    glAttachShader(program, fs);
+    glLinkProgram(program);
+
+    GLint completionStatus = GL_FALSE;
+    glGetProgramiv(program, GL_COMPLETION_STATUS_KHR, &completionStatus);
+    EXPECT_GL_TRUE(completionStatus);
+
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+    glDeleteProgram(program);
+    EXPECT_GL_NO_ERROR();
+}
+
+// Recompiling a shader right after linking a program must not affect the link result, even if
+// the link hasn't finished yet.
+TEST_P(LinkAndRelinkTest, RecompileShaderAfterLink)
+{
+    const std::string vsSource =
+        R"(attribute vec4 position;
+        void main()
+        {
+            gl_Position = position;
+        })";
+
+    const std::string greenSource =
+        R"(precision mediump float;
+        void main()
+        {
+            gl_FragColor = vec4(0.0, 1.0, 0.0, 1.0);
+        })";
+
+    const std::string invalidSource =
+        R"(precision mediump float;
+        void main()
+        {
+            gl_FragColor = undefined;
+        })";
+
+    GLuint vs = CompileShader(GL_VERTEX_SHADER, vsSource);
+    GLuint fs = CompileShader(GL_FRAGMENT_SHADER, greenSource);
+    ASSERT_NE(0u, vs);
+    ASSERT_NE(0u, fs);
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vs);
+    glAttachShader(program, fs);
+    glLinkProgram(program);
+
+    const char *invalidSourceArray[1] = {invalidSource.c_str()};
+    glShaderSource(fs, 1, invalidSourceArray, nullptr);
+    glCompileShader(fs);
+
+    GLint compileStatus;
+    glGetShaderiv(fs, GL_COMPILE_STATUS, &compileStatus);
+    EXPECT_GL_FALSE(compileStatus);
+
+    GLint linkStatus;
+    glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+    EXPECT_GL_TRUE(linkStatus);
+
+    drawQuad(program, "position", 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+    glDeleteProgram(program);
+    EXPECT_GL_NO_ERROR();
+}
+
+// Changing a program right after linking it must not affect the link result, even if the link
+// hasn't finished yet.
+TEST_P(LinkAndRelinkTestNoError, ChangeProgramAfterLink)
+{
+    const std::string vsSource =
+        R"(attribute vec4 position;
+        void main()
+        {
+            gl_Position = position;
+        })";
+
+    const std::string greenSource =
+        R"(precision mediump float;
+        void main()
+        {
+            gl_FragColor = vec4(0.0, 1.0, 0.0, 1.0);
+        })";
+
+    const std::string redSource =
+        R"(precision mediump float;
+        void main()
+        {
+            gl_FragColor = vec4(1.0, 0.0, 0.0, 1.0);
+        })";
+
+    GLuint vs      = CompileShader(GL_VERTEX_SHADER, vsSource);
+    GLuint greenFs = CompileShader(GL_FRAGMENT_SHADER, greenSource);
+    GLuint redFs   = CompileShader(GL_FRAGMENT_SHADER, redSource);
+    ASSERT_NE(0u, vs);
+    ASSERT_NE(0u, greenFs);
+    ASSERT_NE(0u, redFs);
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vs);
+    glAttachShader(program, greenFs);
+    glLinkProgram(program);
+
+    glDetachShader(program, greenFs);
+    glAttachShader(program, redFs);
+    glBindAttribLocation(program, 1, "position");
+
+    GLint linkStatus;
+    glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+    EXPECT_GL_TRUE(linkStatus);
+
+    drawQuad(program, "position", 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+
+    // Relinking picks up the changes.
+    glLinkProgram(program);
+    EXPECT_EQ(1, glGetAttribLocation(program, "position"));
+    drawQuad(program, "position", 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    glDeleteShader(vs);
+    glDeleteShader(greenFs);
+    glDeleteShader(redFs);
+    glDeleteProgram(program);
+    EXPECT_GL_NO_ERROR();
+}
+
 // When program link fails and no valid compute program is installed in the GL
 // state before the link, it should report an error for UseProgram and
 // DispatchCompute.
@@ -435,6 +724,14 @@ ANGLE_INSTANTIATE_TEST(LinkAndRelinkTest,
                        ES3_OPENGL(),
                        ES3_OPENGLES(),
                        ES3_D3D11());
+ANGLE_INSTANTIATE_TEST(LinkAndRelinkTestNoError,
+                       ES2_OPENGL(),
+                       ES2_OPENGLES(),
+                       ES2_D3D9(),
+                       ES2_D3D11(),
+                       ES3_OPENGL(),
+                       ES3_OPENGLES(),
+                       ES3_D3D11());
 ANGLE_INSTANTIATE_TEST(LinkAndRelinkTestES31, ES31_OPENGL(), ES31_OPENGLES());
 
 }  // namespace
@@ -6,11 +6,17 @@
 // CompilerPerfTest:
 //   Performance test for the shader translator. The test initializes the compiler once and then
 //   compiles the same shader repeatedly. There are different variations of the tests using
-//   different shaders.
+//   different shaders. The statistics of each compilation stage are reported as well: the time
+//   spent, the AST nodes visited and allocated, and the pool memory allocated. They're collected
+//   in separate compiles after the timed run, since collecting them adds overhead.
 //
 
 #include "ANGLEPerfTest.h"
 
+#include <cctype>
+#include <map>
+#include <sstream>
+
 #include "GLSLANG/ShaderLang.h"
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/InitializeGlobals.h"
@@ -162,19 +168,125 @@ void main()
 
 const char *kTrickyESSL300Id = "TrickyESSL300";
 
+// Many functions with many locals, some of them unused, to measure how the AST traversals scale
+// with the size of the shader.
+const char *GetLargeESSL300FragSource()
+{
+    static const std::string source = []() {
+        const int kFunctionCount = 64;
+        const int kLocalCount    = 16;
+
+        std::stringstream stream;
+        stream << "#version 300 es\n"
+               << "precision highp float;\n"
+               << "uniform vec4 u[" << kFunctionCount << "];\n"
+               << "out vec4 outColor;\n";
+        for (int function = 0; function < kFunctionCount; ++function)
+        {
+            stream << "vec4 f" << function << "(vec4 a, float b)\n{\n"
+                   << "    float unused = b * 2.0;\n"
+                   << "    vec4 sum = vec4(0.0);\n";
+            for (int local = 0; local < kLocalCount; ++local)
+            {
+                stream << "    vec4 v" << local << " = a * " << local
+                       << ".0 + vec4(b, sin(b), cos(b), " << local << ".0);\n"
+                       << "    sum += (v" << local << ".x > 0.5) ? v" << local << " : -v"
+                       << local << ";\n";
+            }
+            stream << "    return normalize(sum);\n}\n";
+        }
+        stream << "void main()\n{\n    outColor = vec4(0.0);\n";
+        for (int function = 0; function < kFunctionCount; ++function)
+        {
+            stream << "    outColor += f" << function << "(u[" << function << "], "
+                   << function << ".0);\n";
+        }
+        stream << "}\n";
+        return stream.str();
+    }();
+    return source.c_str();
+}
+
+const char *kLargeESSL300Id = "LargeESSL300";
+
+// A thousand functions with ten locals each, all named differently, to measure the cost of looking
+// up the hashed names of the identifiers and the functions in the call graph.
+const char *GetManyIdentifiersESSL300FragSource()
+{
+    static const std::string source = []() {
+        const int kFunctionCount = 1000;
+        const int kLocalCount    = 10;
+
+        std::stringstream stream;
+        stream << "#version 300 es\n"
+               << "precision highp float;\n"
+               << "uniform vec4 u;\n"
+               << "out vec4 outColor;\n";
+        for (int function = 0; function < kFunctionCount; ++function)
+        {
+            stream << "vec4 function" << function << "(vec4 a, float b)\n{\n"
+                   << "    vec4 sum" << function << " = a;\n";
+            for (int local = 0; local < kLocalCount; ++local)
+            {
+                stream << "    vec4 local" << function << "_" << local << " = sum" << function
+                       << " * b;\n"
+                       << "    sum" << function << " += local" << function << "_" << local
+                       << ";\n";
+            }
+            stream << "    return sum" << function << ";\n}\n";
+        }
+        stream << "void main()\n{\n    outColor = vec4(0.0);\n";
+        for (int function = 0; function < kFunctionCount; ++function)
+        {
+            stream << "    outColor += function" << function << "(u, " << function << ".0);\n";
+        }
+        stream << "}\n";
+        return stream.str();
+    }();
+    return source.c_str();
+}
+
+const char *kManyIdentifiersESSL300Id = "ManyIdentifiersESSL300";
+
+// 64-bit FNV-1a, to have the identifiers hashed like with a real hash function.
+khronos_uint64_t HashIdentifier(const char *str, size_t length)
+{
+    khronos_uint64_t hash = 0xcbf29ce484222325ull;
+    for (size_t i = 0; i < length; ++i)
+    {
+        hash = (hash ^ static_cast<unsigned char>(str[i])) * 1099511628211ull;
+    }
+    return hash;
+}
+
 struct CompilerPerfParameters final : public angle::CompilerParameters
 {
     CompilerPerfParameters(ShShaderOutput output,
                            const char *shaderSource,
-                           const char *shaderSourceId)
-        : angle::CompilerParameters(output), shaderSource(shaderSource)
+                           const char *shaderSourceId,
+                           ShCompileOptions extraCompileOptions = 0,
+                           ShHashFunction64 hashFunction        = nullptr)
+        : angle::CompilerParameters(output),
+          shaderSource(shaderSource),
+          extraCompileOptions(extraCompileOptions),
+          hashFunction(hashFunction)
     {
         testId = shaderSourceId;
         testId += "_";
         testId += angle::CompilerParameters::str();
+        if ((extraCompileOptions & SH_PARALLELIZE_FUNCTION_TRANSFORMS) != 0)
+        {
+            testId += "_parallel";
+        }
+        if (hashFunction != nullptr)
+        {
+            testId += "_hashed_names";
+        }
     }
 
     const char *shaderSource;
+    ShCompileOptions extraCompileOptions;
+    ShHashFunction64 hashFunction;
     std::string testId;
 };
 
@@ -199,6 +311,9 @@ class CompilerPerfTest : public ANGLEPerfTest,
     void setTestShader(const char *str) { mTestShader = str; }
 
   private:
+    ShCompileOptions getCompileOptions() const;
+    void printCompileStatistics();
+
     const char *mTestShader;
 
     ShBuiltInResources mResources;
@@ -206,7 +321,8 @@ class CompilerPerfTest : public ANGLEPerfTest,
     sh::TCompiler *mTranslator;
 };
 
-CompilerPerfTest::CompilerPerfTest() : ANGLEPerfTest("CompilerPerf", GetParam().testId)
+CompilerPerfTest::CompilerPerfTest()
+    : ANGLEPerfTest("CompilerPerf", GetParam().testId)
 {
 }
 
@@ -223,6 +339,7 @@ void CompilerPerfTest::SetUp()
     mTranslator = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_WEBGL2_SPEC, params.output);
     sh::InitBuiltInResources(&mResources);
     mResources.FragmentPrecisionHigh = true;
+    mResources.HashFunction          = params.hashFunction;
     if (!mTranslator->Init(mResources))
     {
         SafeDelete(mTranslator);
@@ -233,6 +350,8 @@ void CompilerPerfTest::SetUp()
 
 void CompilerPerfTest::TearDown()
 {
+    printCompileStatistics();
+
     SafeDelete(mTranslator);
 
     SetGlobalPoolAllocator(nullptr);
@@ -247,8 +366,7 @@ void CompilerPerfTest::step()
 {
     const char *shaderStrings[] = {mTestShader};
 
-    ShCompileOptions compileOptions = SH_OBJECT_CODE | SH_VARIABLES |
-                                      SH_INITIALIZE_UNINITIALIZED_LOCALS | SH_INIT_OUTPUT_VARIABLES;
+    ShCompileOptions compileOptions = getCompileOptions();
 
     const int kNumIterationsPerStep = 10;
 
@@ -267,6 +385,64 @@ void CompilerPerfTest::step()
     }
 }
 
+ShCompileOptions CompilerPerfTest::getCompileOptions() const
+{
+    return SH_OBJECT_CODE | SH_VARIABLES | SH_INITIALIZE_UNINITIALIZED_LOCALS |
+           SH_INIT_OUTPUT_VARIABLES | GetParam().extraCompileOptions;
+}
+
+void CompilerPerfTest::printCompileStatistics()
+{
+    if (mTranslator == nullptr || getNumStepsPerformed() == 0u)
+    {
+        return;
+    }
+
+    const char *shaderStrings[] = {mTestShader};
+    ShCompileOptions compileOptions = getCompileOptions() | SH_COLLECT_COMPILE_STATISTICS;
+
+    const unsigned int kNumStatisticsCompiles = 10;
+
+    // Totals over all the compiles for each stage. Some passes run more than once in a
+    // compilation, so the stages are summed up by name.
+    std::map<std::string, sh::CompileStageStatistics> totals;
+    for (unsigned int iteration = 0; iteration < kNumStatisticsCompiles; ++iteration)
+    {
+        mTranslator->compile(shaderStrings, 1, compileOptions);
+        for (const sh::CompileStageStatistics &stage : mTranslator->getCompileStatistics())
+        {
+            sh::CompileStageStatistics &total = totals[stage.name];
+            total.seconds += stage.seconds;
+            total.nodesVisited += stage.nodesVisited;
+            total.nodesAllocated += stage.nodesAllocated;
+            total.poolBytes += stage.poolBytes;
+        }
+    }
+
+    for (const auto &total : totals)
+    {
+        // Fused groups are named after the passes in them, so make the names safe to use as
+        // trace names.
+        std::string trace = "stage_" + total.first;
+        for (char &c : trace)
+        {
+            if (!isalnum(static_cast<unsigned char>(c)))
+            {
+                c = '_';
+            }
+        }
+
+        const sh::CompileStageStatistics &stage = total.second;
+        printResult(trace + "_time", stage.seconds * 1e6 / kNumStatisticsCompiles, "us", false);
+        printResult(trace + "_nodes_visited", stage.nodesVisited / kNumStatisticsCompiles,
+                    "nodes", false);
+        printResult(trace + "_nodes_allocated", stage.nodesAllocated / kNumStatisticsCompiles,
+                    "nodes", false);
+        printResult(trace + "_pool_bytes", stage.poolBytes / kNumStatisticsCompiles, "bytes",
+                    false);
+    }
+}
+
 TEST_P(CompilerPerfTest, Run)
 {
     run();
@@ -278,15 +454,38 @@ ANGLE_INSTANTIATE_TEST(
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kRealWorldESSL100FragSource, kRealWorldESSL100Id),
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, GetLargeESSL300FragSource(), kLargeESSL300Id),
+    CompilerPerfParameters(SH_HLSL_4_1_OUTPUT,
+                           GetLargeESSL300FragSource(),
+                           kLargeESSL300Id,
+                           SH_PARALLELIZE_FUNCTION_TRANSFORMS),
+    CompilerPerfParameters(SH_HLSL_4_1_OUTPUT,
+                           GetManyIdentifiersESSL300FragSource(),
+                           kManyIdentifiersESSL300Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT,
                            kRealWorldESSL100FragSource,
                            kRealWorldESSL100Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, GetLargeESSL300FragSource(), kLargeESSL300Id),
+    CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT,
+                           GetManyIdentifiersESSL300FragSource(),
+                           kManyIdentifiersESSL300Id,
+                           0,
+                           HashIdentifier),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kRealWorldESSL100FragSource, kRealWorldESSL100Id),
-    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id));
+    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_ESSL_OUTPUT, GetLargeESSL300FragSource(), kLargeESSL300Id),
+    CompilerPerfParameters(SH_ESSL_OUTPUT,
+                           GetManyIdentifiersESSL300FragSource(),
+                           kManyIdentifiersESSL300Id),
+    CompilerPerfParameters(SH_ESSL_OUTPUT,
+                           GetManyIdentifiersESSL300FragSource(),
+                           kManyIdentifiersESSL300Id,
+                           0,
+                           HashIdentifier));
 
 }  // anonymous namespace
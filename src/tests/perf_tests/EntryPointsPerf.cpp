@@ -0,0 +1,171 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// EntryPointsPerf:
+//   Performance test for the fixed cost of a GL call: finding the current context, validation
+//   and dispatch. The entry points that are called do almost nothing otherwise.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+namespace angle
+{
+
+enum class EntryPoint
+{
+    GetError,
+    IsEnabled,
+    BindBuffer,
+};
+
+struct EntryPointsParams final : public RenderTestParams
+{
+    EntryPointsParams()
+    {
+        majorVersion = 2;
+        minorVersion = 0;
+        windowWidth  = 64;
+        windowHeight = 64;
+
+        callsPerStep = 10000;
+        entryPoint   = EntryPoint::GetError;
+    }
+
+    std::string suffix() const override;
+
+    size_t callsPerStep;
+    EntryPoint entryPoint;
+};
+
+std::ostream &operator<<(std::ostream &os, const EntryPointsParams &params)
+{
+    os << params.suffix().substr(1);
+    return os;
+}
+
+std::string EntryPointsParams::suffix() const
+{
+    std::stringstream strstr;
+
+    strstr << RenderTestParams::suffix();
+
+    switch (entryPoint)
+    {
+        case EntryPoint::GetError:
+            strstr << "_get_error";
+            break;
+        case EntryPoint::IsEnabled:
+            strstr << "_is_enabled";
+            break;
+        case EntryPoint::BindBuffer:
+            strstr << "_bind_buffer";
+            break;
+        default:
+            UNREACHABLE();
+    }
+
+    return strstr.str();
+}
+
+class EntryPointsBenchmark : public ANGLERenderTest,
+                             public ::testing::WithParamInterface<EntryPointsParams>
+{
+  public:
+    EntryPointsBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mBuffer;
+    size_t mEnabledCount;
+};
+
+EntryPointsBenchmark::EntryPointsBenchmark()
+    : ANGLERenderTest("EntryPoints", GetParam()), mBuffer(0), mEnabledCount(0)
+{
+}
+
+void EntryPointsBenchmark::initializeBenchmark()
+{
+    glGenBuffers(1, &mBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+}
+
+void EntryPointsBenchmark::destroyBenchmark()
+{
+    glDeleteBuffers(1, &mBuffer);
+
+    size_t calls = getNumStepsPerformed() * GetParam().callsPerStep;
+    if (calls > 0)
+    {
+        printResult("time_per_call", mTimer->getElapsedTime() * 1e9 / calls, "ns", true);
+    }
+}
+
+void EntryPointsBenchmark::drawBenchmark()
+{
+    const auto &params = GetParam();
+
+    switch (params.entryPoint)
+    {
+        case EntryPoint::GetError:
+            for (size_t call = 0; call < params.callsPerStep; ++call)
+            {
+                glGetError();
+            }
+            break;
+        case EntryPoint::IsEnabled:
+            for (size_t call = 0; call < params.callsPerStep; ++call)
+            {
+                mEnabledCount += glIsEnabled(GL_BLEND);
+            }
+            break;
+        case EntryPoint::BindBuffer:
+            for (size_t call = 0; call < params.callsPerStep; ++call)
+            {
+                glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+            }
+            break;
+        default:
+            UNREACHABLE();
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+EntryPointsParams D3D11Params(EntryPoint entryPoint)
+{
+    EntryPointsParams params;
+    params.eglParameters = egl_platform::D3D11_NULL();
+    params.entryPoint    = entryPoint;
+    return params;
+}
+
+EntryPointsParams OpenGLOrGLESParams(EntryPoint entryPoint)
+{
+    EntryPointsParams params;
+    params.eglParameters = egl_platform::OPENGL_OR_GLES(true);
+    params.entryPoint    = entryPoint;
+    return params;
+}
+
+TEST_P(EntryPointsBenchmark, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(EntryPointsBenchmark,
+                       D3D11Params(EntryPoint::GetError),
+                       D3D11Params(EntryPoint::IsEnabled),
+                       D3D11Params(EntryPoint::BindBuffer),
+                       OpenGLOrGLESParams(EntryPoint::GetError),
+                       OpenGLOrGLESParams(EntryPoint::IsEnabled),
+                       OpenGLOrGLESParams(EntryPoint::BindBuffer));
+
+}  // namespace angle
@@ -0,0 +1,122 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// GlslangWrapperPerf:
+//   Performance benchmark for compiling Vulkan GLSL to SPIR-V with glslang, with the SPIR-V cache
+//   either cold or warm. Runs entirely on the CPU.
+
+#include "ANGLEPerfTest.h"
+
+#include "libANGLE/renderer/vulkan/GlslangWrapper.h"
+
+using namespace rx;
+
+namespace
+{
+
+const char *kVertexSource = R"(#version 450 core
+layout(location = 0) in vec4 position;
+layout(location = 1) in vec3 normal;
+layout(location = 2) in vec2 texCoord;
+layout(location = 0) out vec3 v_normal;
+layout(location = 1) out vec2 v_texCoord;
+layout(set = 0, binding = 0) uniform defaultUniforms
+{
+    mat4 mvp;
+    mat3 normalMatrix;
+    vec4 offsets[8];
+};
+void main()
+{
+    vec4 p = position;
+    for (int i = 0; i < 8; ++i)
+    {
+        p.xyz += offsets[i].xyz * offsets[i].w;
+    }
+    v_normal    = normalize(normalMatrix * normal);
+    v_texCoord  = texCoord;
+    gl_Position = mvp * p;
+})";
+
+const char *kFragmentSource = R"(#version 450 core
+layout(location = 0) in vec3 v_normal;
+layout(location = 1) in vec2 v_texCoord;
+layout(location = 0) out vec4 color;
+layout(set = 0, binding = 1) uniform defaultUniforms
+{
+    vec3 lightDirection;
+    vec4 ambient;
+};
+layout(set = 1, binding = 0) uniform sampler2D tex;
+void main()
+{
+    float diffuse = max(dot(normalize(v_normal), lightDirection), 0.0);
+    color         = texture(tex, v_texCoord) * (ambient + vec4(diffuse));
+})";
+
+class GlslangWrapperPerfTest : public ANGLEPerfTest, public ::testing::WithParamInterface<bool>
+{
+  public:
+    GlslangWrapperPerfTest();
+    ~GlslangWrapperPerfTest();
+
+    void SetUp() override;
+    void step() override;
+
+  private:
+    GlslangWrapper *mGlslangWrapper;
+    std::vector<uint32_t> mVertexCode;
+    std::vector<uint32_t> mFragmentCode;
+};
+
+GlslangWrapperPerfTest::GlslangWrapperPerfTest()
+    : ANGLEPerfTest("GlslangWrapperPerf", GetParam() ? "_warm_cache" : "_cold_cache"),
+      mGlslangWrapper(GlslangWrapper::GetReference())
+{
+}
+
+GlslangWrapperPerfTest::~GlslangWrapperPerfTest()
+{
+    GlslangWrapper::ReleaseReference();
+}
+
+void GlslangWrapperPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    // Only measure the memory cache, whatever ANGLE_SPIRV_CACHE_DIR is set to.
+    mGlslangWrapper->setSpirvCacheDirectory("");
+    mGlslangWrapper->clearSpirvCache();
+}
+
+void GlslangWrapperPerfTest::step()
+{
+    const int kNumIterationsPerStep = 10;
+
+    for (int iteration = 0; iteration < kNumIterationsPerStep; ++iteration)
+    {
+        if (!GetParam())
+        {
+            mGlslangWrapper->clearSpirvCache();
+        }
+
+        gl::LinkResult result = mGlslangWrapper->compileToSpirv(kVertexSource, kFragmentSource,
+                                                                &mVertexCode, &mFragmentCode);
+        if (result.isError() || !result.getResult())
+        {
+            abortTest();
+            return;
+        }
+    }
+}
+
+TEST_P(GlslangWrapperPerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_CASE_P(, GlslangWrapperPerfTest, ::testing::Values(false, true));
+
+}  // anonymous namespace
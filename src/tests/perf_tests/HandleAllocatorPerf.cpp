@@ -0,0 +1,162 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// HandleAllocatorPerf:
+//   Performance test for the handle allocators, with the patterns of long sessions: objects are
+//   created and deleted in turn, some of them with explicit handles.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <deque>
+#include <random>
+#include <sstream>
+
+#include "libANGLE/FreeListHandleAllocator.h"
+#include "libANGLE/HandleAllocator.h"
+
+namespace
+{
+
+constexpr size_t kHandlesPerStep = 65536;
+
+enum class Allocator
+{
+    HandleAllocator,
+    FreeListHandleAllocator,
+};
+
+struct HandleAllocatorPerfParameters final
+{
+    HandleAllocatorPerfParameters(Allocator allocatorIn,
+                                  size_t liveCountIn,
+                                  bool explicitHandlesIn)
+        : allocator(allocatorIn), liveCount(liveCountIn), explicitHandles(explicitHandlesIn)
+    {
+    }
+
+    std::string suffix() const
+    {
+        std::stringstream suffix;
+        switch (allocator)
+        {
+            case Allocator::HandleAllocator:
+                suffix << "_handle_allocator";
+                break;
+            case Allocator::FreeListHandleAllocator:
+                suffix << "_free_list_handle_allocator";
+                break;
+        }
+        suffix << "_live_" << liveCount;
+        if (explicitHandles)
+        {
+            suffix << "_explicit";
+        }
+        return suffix.str();
+    }
+
+    Allocator allocator;
+    size_t liveCount;
+    bool explicitHandles;
+};
+
+std::ostream &operator<<(std::ostream &stream, const HandleAllocatorPerfParameters &p)
+{
+    stream << p.suffix().substr(1);
+    return stream;
+}
+
+class HandleAllocatorPerfTest : public ANGLEPerfTest,
+                                public ::testing::WithParamInterface<HandleAllocatorPerfParameters>
+{
+  public:
+    HandleAllocatorPerfTest();
+
+    void step() override;
+
+  private:
+    template <typename HandleAllocatorType>
+    void churn(HandleAllocatorType *allocator);
+
+    gl::HandleAllocator mHandleAllocator;
+    gl::FreeListHandleAllocator mFreeListHandleAllocator;
+    std::deque<GLuint> mLiveHandles;
+    std::mt19937 mRandom;
+    GLuint mNextExplicitHandle;
+};
+
+HandleAllocatorPerfTest::HandleAllocatorPerfTest()
+    : ANGLEPerfTest("HandleAllocatorPerf", GetParam().suffix()),
+      mRandom(1),
+      mNextExplicitHandle(1000000)
+{
+}
+
+void HandleAllocatorPerfTest::step()
+{
+    switch (GetParam().allocator)
+    {
+        case Allocator::HandleAllocator:
+            churn(&mHandleAllocator);
+            break;
+        case Allocator::FreeListHandleAllocator:
+            churn(&mFreeListHandleAllocator);
+            break;
+    }
+}
+
+template <typename HandleAllocatorType>
+void HandleAllocatorPerfTest::churn(HandleAllocatorType *allocator)
+{
+    const HandleAllocatorPerfParameters &params = GetParam();
+
+    for (size_t iteration = 0; iteration < kHandlesPerStep; ++iteration)
+    {
+        // Delete a random live object and create a new one. One object out of 8 is created with
+        // an explicit handle, after the generated ones.
+        if (mLiveHandles.size() >= params.liveCount)
+        {
+            size_t index = mRandom() % mLiveHandles.size();
+            allocator->release(mLiveHandles[index]);
+            mLiveHandles[index] = mLiveHandles.back();
+            mLiveHandles.pop_back();
+        }
+
+        if (params.explicitHandles && mRandom() % 8 == 0)
+        {
+            allocator->reserve(mNextExplicitHandle);
+            mLiveHandles.push_back(mNextExplicitHandle++);
+        }
+        else
+        {
+            mLiveHandles.push_back(allocator->allocate());
+        }
+    }
+}
+
+TEST_P(HandleAllocatorPerfTest, Run)
+{
+    run();
+}
+
+std::vector<HandleAllocatorPerfParameters> HandleAllocatorPerfParams()
+{
+    std::vector<HandleAllocatorPerfParameters> params;
+    for (Allocator allocator : {Allocator::HandleAllocator, Allocator::FreeListHandleAllocator})
+    {
+        for (size_t liveCount : {64u, 4096u, 65536u})
+        {
+            params.emplace_back(allocator, liveCount, false);
+            params.emplace_back(allocator, liveCount, true);
+        }
+    }
+    return params;
+}
+
+INSTANTIATE_TEST_CASE_P(,
+                        HandleAllocatorPerfTest,
+                        ::testing::ValuesIn(HandleAllocatorPerfParams()));
+
+}  // anonymous namespace
@@ -0,0 +1,128 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// IndexRangePerf:
+//   Performance test for computing the range of the indices of a draw, with counts from a few
+//   triangles to whole meshes. Every step scans about the same number of indices.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <random>
+#include <sstream>
+
+#include "common/utilities.h"
+
+namespace
+{
+
+constexpr size_t kIndicesPerStep = 16777216;
+
+struct IndexRangePerfParameters final
+{
+    IndexRangePerfParameters(GLenum typeIn, size_t countIn, bool primitiveRestartEnabledIn)
+        : type(typeIn), count(countIn), primitiveRestartEnabled(primitiveRestartEnabledIn)
+    {
+    }
+
+    std::string suffix() const
+    {
+        std::stringstream suffix;
+        switch (type)
+        {
+            case GL_UNSIGNED_BYTE:
+                suffix << "_ubyte";
+                break;
+            case GL_UNSIGNED_SHORT:
+                suffix << "_ushort";
+                break;
+            default:
+                suffix << "_uint";
+                break;
+        }
+        suffix << "_" << count;
+        if (primitiveRestartEnabled)
+        {
+            suffix << "_restart";
+        }
+        return suffix.str();
+    }
+
+    GLenum type;
+    size_t count;
+    bool primitiveRestartEnabled;
+};
+
+std::ostream &operator<<(std::ostream &stream, const IndexRangePerfParameters &p)
+{
+    stream << p.suffix().substr(1);
+    return stream;
+}
+
+class IndexRangePerfTest : public ANGLEPerfTest,
+                           public ::testing::WithParamInterface<IndexRangePerfParameters>
+{
+  public:
+    IndexRangePerfTest();
+
+    void step() override;
+
+  private:
+    std::vector<uint8_t> mIndexData;
+    size_t mRangeSum;
+};
+
+IndexRangePerfTest::IndexRangePerfTest()
+    : ANGLEPerfTest("IndexRangePerf", GetParam().suffix()), mRangeSum(0)
+{
+    const IndexRangePerfParameters &params = GetParam();
+    size_t indexBytes                      = gl::ElementTypeSize(params.type);
+    GLuint restartIndex                    = gl::GetPrimitiveRestartIndex(params.type);
+
+    // One index out of 64 is a primitive restart index, like in long strips.
+    std::mt19937 random(1);
+    mIndexData.resize(params.count * indexBytes);
+    for (size_t index = 0; index < params.count; ++index)
+    {
+        GLuint value = random() % 64 == 0 ? restartIndex : random() % restartIndex;
+        memcpy(mIndexData.data() + index * indexBytes, &value, indexBytes);
+    }
+}
+
+void IndexRangePerfTest::step()
+{
+    const IndexRangePerfParameters &params = GetParam();
+
+    size_t iterations = std::max<size_t>(kIndicesPerStep / params.count, 1);
+    for (size_t iteration = 0; iteration < iterations; ++iteration)
+    {
+        gl::IndexRange range = gl::ComputeIndexRange(params.type, mIndexData.data(), params.count,
+                                                     params.primitiveRestartEnabled);
+        mRangeSum += range.end;
+    }
+}
+
+TEST_P(IndexRangePerfTest, Run)
+{
+    run();
+}
+
+std::vector<IndexRangePerfParameters> IndexRangePerfParams()
+{
+    std::vector<IndexRangePerfParameters> params;
+    for (size_t count : {64u, 1024u, 16384u, 262144u, 4194304u, 16777216u})
+    {
+        for (GLenum type : {GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT, GL_UNSIGNED_INT})
+        {
+            params.emplace_back(type, count, false);
+            params.emplace_back(type, count, true);
+        }
+    }
+    return params;
+}
+
+INSTANTIATE_TEST_CASE_P(, IndexRangePerfTest, ::testing::ValuesIn(IndexRangePerfParams()));
+
+}  // anonymous namespace
@@ -0,0 +1,157 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PreprocessorPerfTest:
+//   Performance test for the shader preprocessor on macro-heavy shaders, with and without the
+//   macro expansion cache. The shaders either invoke the same macros with the same arguments over
+//   and over, like generated shaders often do, or with different arguments each time.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+#include "compiler/preprocessor/DiagnosticsBase.h"
+#include "compiler/preprocessor/DirectiveHandlerBase.h"
+#include "compiler/preprocessor/Preprocessor.h"
+#include "compiler/preprocessor/Token.h"
+
+namespace
+{
+
+const char *kMacroLibrary = R"(#version 300 es
+precision highp float;
+#define MUL(a, b) ((a) * (b))
+#define MAD(a, b, c) (MUL(a, b) + (c))
+#define LERP(a, b, t) MAD((b) - (a), t, a)
+#define SQ(x) MUL(x, x)
+out vec4 color;
+uniform vec4 u;
+)";
+
+const int kFunctionCount = 1000;
+
+class NullDiagnostics : public pp::Diagnostics
+{
+  protected:
+    void print(ID id, const pp::SourceLocation &loc, const std::string &text) override {}
+};
+
+class NullDirectiveHandler : public pp::DirectiveHandler
+{
+  public:
+    void handleError(const pp::SourceLocation &loc, const std::string &msg) override {}
+    void handlePragma(const pp::SourceLocation &loc,
+                      const std::string &name,
+                      const std::string &value,
+                      bool stdgl) override
+    {
+    }
+    void handleExtension(const pp::SourceLocation &loc,
+                         const std::string &name,
+                         const std::string &behavior) override
+    {
+    }
+    void handleVersion(const pp::SourceLocation &loc, int version) override {}
+};
+
+struct PreprocessorPerfParameters final
+{
+    PreprocessorPerfParameters(bool repeatedArgumentsIn, bool cacheMacroExpansionsIn)
+        : repeatedArguments(repeatedArgumentsIn), cacheMacroExpansions(cacheMacroExpansionsIn)
+    {
+    }
+
+    std::string suffix() const
+    {
+        std::string suffix = repeatedArguments ? "_repeated_args" : "_unique_args";
+        suffix += cacheMacroExpansions ? "_cache" : "_no_cache";
+        return suffix;
+    }
+
+    bool repeatedArguments;
+    bool cacheMacroExpansions;
+};
+
+std::ostream &operator<<(std::ostream &stream, const PreprocessorPerfParameters &p)
+{
+    stream << p.suffix().substr(1);
+    return stream;
+}
+
+class PreprocessorPerfTest : public ANGLEPerfTest,
+                             public ::testing::WithParamInterface<PreprocessorPerfParameters>
+{
+  public:
+    PreprocessorPerfTest();
+
+    void step() override;
+
+  private:
+    std::string mShaderSource;
+    pp::PreprocessorSettings mSettings;
+    NullDiagnostics mDiagnostics;
+    NullDirectiveHandler mDirectiveHandler;
+};
+
+PreprocessorPerfTest::PreprocessorPerfTest()
+    : ANGLEPerfTest("PreprocessorPerf", GetParam().suffix())
+{
+    const PreprocessorPerfParameters &params = GetParam();
+    mSettings.cacheMacroExpansions           = params.cacheMacroExpansions;
+
+    std::stringstream source;
+    source << kMacroLibrary;
+    for (int i = 0; i < kFunctionCount; ++i)
+    {
+        int argument = params.repeatedArguments ? 0 : i;
+        source << "float f" << i << "(float x)\n"
+               << "{\n"
+               << "    return LERP(SQ(x), MAD(x, " << argument << ".5, 1.0e-3), 0.25);\n"
+               << "}\n";
+    }
+    source << "void main()\n"
+           << "{\n"
+           << "    color = vec4(f0(u.x));\n"
+           << "}\n";
+    mShaderSource = source.str();
+}
+
+void PreprocessorPerfTest::step()
+{
+    const char *shaderStrings[] = {mShaderSource.c_str()};
+
+    const int kNumIterationsPerStep = 10;
+
+    for (int iteration = 0; iteration < kNumIterationsPerStep; ++iteration)
+    {
+        pp::Preprocessor preprocessor(&mDiagnostics, &mDirectiveHandler, mSettings);
+        if (!preprocessor.init(1, shaderStrings, nullptr))
+        {
+            abortTest();
+            return;
+        }
+
+        pp::Token token;
+        do
+        {
+            preprocessor.lex(&token);
+        } while (token.type != pp::Token::LAST);
+    }
+}
+
+TEST_P(PreprocessorPerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_CASE_P(,
+                        PreprocessorPerfTest,
+                        ::testing::Values(PreprocessorPerfParameters(true, true),
+                                          PreprocessorPerfParameters(true, false),
+                                          PreprocessorPerfParameters(false, true),
+                                          PreprocessorPerfParameters(false, false)));
+
+}  // anonymous namespace
@@ -0,0 +1,120 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ResourceMapPerf:
+//   Performance test for the maps of GL objects in a long session: objects are created with
+//   increasing handles and deleted in the same order, and the live objects are looked up.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+#include "libANGLE/ResourceMap.h"
+
+namespace
+{
+
+constexpr size_t kObjectsPerStep = 1048576;
+
+struct ResourceMapPerfParameters final
+{
+    ResourceMapPerfParameters(GLuint firstHandleIn, size_t liveCountIn)
+        : firstHandle(firstHandleIn), liveCount(liveCountIn)
+    {
+    }
+
+    std::string suffix() const
+    {
+        std::stringstream suffix;
+        suffix << "_first_" << firstHandle << "_live_" << liveCount;
+        return suffix.str();
+    }
+
+    GLuint firstHandle;
+    size_t liveCount;
+};
+
+std::ostream &operator<<(std::ostream &stream, const ResourceMapPerfParameters &p)
+{
+    stream << p.suffix().substr(1);
+    return stream;
+}
+
+class ResourceMapPerfTest : public ANGLEPerfTest,
+                            public ::testing::WithParamInterface<ResourceMapPerfParameters>
+{
+  public:
+    ResourceMapPerfTest();
+    ~ResourceMapPerfTest() override;
+
+    void step() override;
+
+  private:
+    gl::ResourceMap<int> mMap;
+    int mObject;
+    GLuint mNextHandle;
+    size_t mFoundCount;
+};
+
+ResourceMapPerfTest::ResourceMapPerfTest()
+    : ANGLEPerfTest("ResourceMapPerf", GetParam().suffix()),
+      mObject(0),
+      mNextHandle(GetParam().firstHandle),
+      mFoundCount(0)
+{
+    for (size_t index = 0; index < GetParam().liveCount; ++index)
+    {
+        mMap.assign(mNextHandle++, &mObject);
+    }
+}
+
+ResourceMapPerfTest::~ResourceMapPerfTest()
+{
+    GLuint liveCount = static_cast<GLuint>(GetParam().liveCount);
+    for (GLuint handle = mNextHandle - liveCount; handle != mNextHandle; ++handle)
+    {
+        int *object = nullptr;
+        mMap.erase(handle, &object);
+    }
+}
+
+void ResourceMapPerfTest::step()
+{
+    GLuint liveCount = static_cast<GLuint>(GetParam().liveCount);
+
+    for (size_t iteration = 0; iteration < kObjectsPerStep; ++iteration)
+    {
+        // Delete the oldest object, look up one of the others and create a new one.
+        int *object = nullptr;
+        mMap.erase(mNextHandle - liveCount, &object);
+        mFoundCount += mMap.query(mNextHandle - liveCount / 2) != nullptr;
+        mMap.assign(mNextHandle++, &mObject);
+    }
+}
+
+TEST_P(ResourceMapPerfTest, Run)
+{
+    run();
+}
+
+std::vector<ResourceMapPerfParameters> ResourceMapPerfParams()
+{
+    std::vector<ResourceMapPerfParameters> params;
+
+    // Sessions start with handles in the flat array, and churn past it after a while.
+    for (GLuint firstHandle : {1u, 65536u})
+    {
+        for (size_t liveCount : {64u, 4096u, 262144u})
+        {
+            params.emplace_back(firstHandle, liveCount);
+        }
+    }
+    return params;
+}
+
+INSTANTIATE_TEST_CASE_P(, ResourceMapPerfTest, ::testing::ValuesIn(ResourceMapPerfParams()));
+
+}  // anonymous namespace
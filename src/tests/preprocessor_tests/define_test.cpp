@@ -1029,3 +1029,79 @@ TEST_F(DefineTest, LongMacroInvocationChain)
 
     preprocess(inputStream.str().c_str(), settings);
 }
+
+// The same function-like macro invocation is expanded several times before and after a macro used
+// in its arguments is redefined. The cached expansion must not be reused after the redefinition.
+TEST_F(DefineTest, ExpansionCacheInvalidatedByRedefinition)
+{
+    const char *input =
+        "#define foo(x) x + x\n"
+        "#define bar 1\n"
+        "foo(bar) foo(bar) foo(bar)\n"
+        "#undef bar\n"
+        "#define bar 2\n"
+        "foo(bar) foo(bar) foo(bar)\n"
+        "#undef bar\n"
+        "foo(bar) foo(bar) foo(bar)\n";
+    const char *expected =
+        "\n"
+        "\n"
+        "1 + 1 1 + 1 1 + 1\n"
+        "\n"
+        "\n"
+        "2 + 2 2 + 2 2 + 2\n"
+        "\n"
+        "bar + bar bar + bar bar + bar\n";
+    preprocess(input, expected);
+}
+
+// The same invocation with __LINE__ as an argument is expanded on different lines. Each expansion
+// should get the line it's on.
+TEST_F(DefineTest, ExpansionCacheWithLineArgument)
+{
+    const char *input =
+        "#define foo(x) x\n"
+        "foo(__LINE__)\n"
+        "foo(__LINE__)\n"
+        "foo(__LINE__)\n";
+    const char *expected =
+        "\n"
+        "2\n"
+        "3\n"
+        "4\n";
+    preprocess(input, expected);
+}
+
+// The same invocation is expanded both inside the expansion of a macro, where that macro is
+// disabled, and outside of it. The expansion with the macro disabled must not be reused where the
+// macro is enabled.
+TEST_F(DefineTest, ExpansionCacheWithDisabledMacro)
+{
+    const char *input =
+        "#define foo(x) x\n"
+        "#define bar foo(bar) x\n"
+        "bar bar bar\n"
+        "foo(bar) foo(bar)\n";
+    const char *expected =
+        "\n"
+        "\n"
+        "bar x bar x bar x\n"
+        "bar x bar x\n";
+    preprocess(input, expected);
+}
+
+// An invocation that generates an error while expanding its arguments is expanded several times.
+// The error should be reported every time.
+TEST_F(DefineTest, ExpansionCacheRepeatsErrors)
+{
+    const char *input =
+        "#define foo(x) x\n"
+        "#define bar(x) x\n"
+        "bar(foo(a, b))\n"
+        "bar(foo(a, b))\n"
+        "bar(foo(a, b))\n";
+
+    EXPECT_CALL(mDiagnostics, print(pp::Diagnostics::PP_MACRO_TOO_MANY_ARGS, _, "foo")).Times(3);
+
+    preprocess(input);
+}
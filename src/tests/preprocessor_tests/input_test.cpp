@@ -158,6 +158,23 @@ TEST(InputTest, ReadStringsWithLength)
     EXPECT_STREQ("fobar", buf);
 }
 
+// Reading across strings must not return more than maxSize characters.
+TEST(InputTest, ReadMultipleStringsPastMaxSize)
+{
+    int count = 2;
+    const char* str[] = {"fo", "obar"};
+    char buf[7] = {'\0', '\0', '\0', '\0', '\0', '\0', '\0'};
+    size_t maxSize = 4;
+    int lineNo = 0;
+
+    pp::Input input(count, str, nullptr);
+    EXPECT_EQ(maxSize, input.read(buf, maxSize, &lineNo));
+    EXPECT_STREQ("foob", buf);
+    EXPECT_EQ(2u, input.read(buf + 4, maxSize, &lineNo));
+    EXPECT_STREQ("foobar", buf);
+    EXPECT_EQ(0u, input.read(buf + 6, maxSize, &lineNo));
+}
+
 TEST(InputTest, ReadStringsWithLineContinuation)
 {
     int count = 2;